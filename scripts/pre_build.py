@@ -1,8 +1,11 @@
 # Porkchop pre-build script
-# Ensures model files exist and generates version info
+# Ensures model files exist and generates version info and web UI assets
 
 Import("env")
+import gzip
+import hashlib
 import os
+import re
 import subprocess
 from datetime import datetime
 
@@ -35,4 +38,72 @@ def pre_build_callback(source, target, env):
         f.write(f'#define BUILD_VERSION "{build_info["version"]}"\n')
         f.write(f'#define BUILD_COMMIT "{build_info["commit"]}"\n')
 
+# Web UI assets: the page, stylesheet and script live as PROGMEM raw strings
+# in fileserver.cpp. Emit gzip copies plus a content hash so the server can
+# answer with Content-Encoding: gzip, ETag and 304 on revalidation.
+WEB_ASSET_SOURCE = os.path.join("web", "fileserver.cpp")
+WEB_ASSET_HEADER = os.path.join("web", "web_assets.h")
+WEB_ASSETS = [
+    ("HTML_TEMPLATE", "WEB_ASSET_HTML"),
+    ("HTML_STYLE", "WEB_ASSET_CSS"),
+    ("HTML_SCRIPT", "WEB_ASSET_JS"),
+]
+
+def extract_raw_string(source, name):
+    """Body of `static const char NAME[] PROGMEM = R"rawliteral(...)rawliteral";`"""
+    m = re.search(r'static const char ' + name + r'\[\] PROGMEM = R"rawliteral\((.*?)\)rawliteral";',
+                  source, re.S)
+    if not m:
+        raise RuntimeError(f"web asset {name} not found in {WEB_ASSET_SOURCE}")
+    return m.group(1).encode("utf-8")
+
+def render_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+def generate_web_assets(src_dir):
+    with open(os.path.join(src_dir, WEB_ASSET_SOURCE), encoding="utf-8") as f:
+        source = f.read()
+
+    out = [
+        f"// Auto-generated by scripts/pre_build.py from src/{WEB_ASSET_SOURCE.replace(os.sep, '/')} - do not edit",
+        "// gzip copies of the web UI raw strings, plus content-hash ETags",
+        "#pragma once",
+        "",
+        "#include <stddef.h>",
+        "#include <stdint.h>",
+        "#include <pgmspace.h>",
+    ]
+    for raw_name, asset in WEB_ASSETS:
+        raw = extract_raw_string(source, raw_name)
+        # mtime=0 keeps the output identical for identical input
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        digest = hashlib.sha256(raw).hexdigest()[:16]
+        out += [
+            "",
+            f"// {raw_name}: {len(raw)} -> {len(packed)} bytes",
+            f'#define {asset}_HASH "{digest}"',
+            f"static const size_t {asset}_GZ_LEN = {len(packed)};",
+            f"static const uint8_t {asset}_GZ[] PROGMEM = {{",
+            render_bytes(packed),
+            "};",
+        ]
+    text = "\n".join(out) + "\n"
+
+    path = os.path.join(src_dir, WEB_ASSET_HEADER)
+    try:
+        with open(path, encoding="utf-8") as f:
+            if f.read() == text:
+                return  # Unchanged: do not touch the mtime (no rebuild)
+    except OSError:
+        pass
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(text)
+    print(f"[pre_build] Regenerated {WEB_ASSET_HEADER}")
+
+# Before compilation: fileserver.cpp includes the generated header
+generate_web_assets(env.get("PROJECT_SRC_DIR"))
+
 env.AddPreAction("buildprog", pre_build_callback)
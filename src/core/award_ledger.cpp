@@ -0,0 +1,317 @@
+// AwardLedger - On-SD hash set of keys that already earned file-transfer XP
+
+#include "award_ledger.h"
+#include "config.h"
+#include <Arduino.h>
+#include <SD.h>
+#include <string.h>
+
+namespace {
+
+static constexpr uint8_t kMagic[4] = {'P', 'X', 'A', 'L'};
+static constexpr size_t kSlotBytes = sizeof(AwardLedger::Slot);
+static constexpr size_t kProbeSlots = 4;     // 192 bytes per SD read
+static constexpr uint32_t kBloomBits = AwardLedger::kBloomBytes * 8;
+
+struct Header {
+    uint32_t capacity;
+    uint32_t count;
+    uint32_t journalBytes;
+};
+
+size_t slotOffset(uint32_t slot) {
+    return AwardLedger::kHeaderBytes + AwardLedger::kBloomBytes + (size_t)slot * kSlotBytes;
+}
+
+bool readHeader(File& f, Header& out) {
+    uint8_t hdr[AwardLedger::kHeaderBytes];
+    if (!f.seek(0) || f.read(hdr, sizeof(hdr)) != sizeof(hdr)) return false;
+    if (memcmp(hdr, kMagic, sizeof(kMagic)) != 0) return false;
+    uint16_t version, slotBytes;
+    memcpy(&version, hdr + 4, 2);
+    memcpy(&slotBytes, hdr + 6, 2);
+    if (version != AwardLedger::kVersion || slotBytes != kSlotBytes) return false;
+    memcpy(&out.capacity, hdr + 8, 4);
+    memcpy(&out.count, hdr + 12, 4);
+    memcpy(&out.journalBytes, hdr + 16, 4);
+    return true;
+}
+
+bool writeHeader(File& f, const Header& h) {
+    uint8_t hdr[AwardLedger::kHeaderBytes] = {0};
+    memcpy(hdr, kMagic, sizeof(kMagic));
+    uint16_t version = AwardLedger::kVersion;
+    uint16_t slotBytes = kSlotBytes;
+    memcpy(hdr + 4, &version, 2);
+    memcpy(hdr + 6, &slotBytes, 2);
+    memcpy(hdr + 8, &h.capacity, 4);
+    memcpy(hdr + 12, &h.count, 4);
+    memcpy(hdr + 16, &h.journalBytes, 4);
+    return f.seek(0) && f.write(hdr, sizeof(hdr)) == sizeof(hdr);
+}
+
+uint32_t fileSize(const char* path) {
+    File f = SD.open(path, FILE_READ);
+    if (!f) return 0;
+    uint32_t size = (uint32_t)f.size();
+    f.close();
+    return size;
+}
+
+bool keyMatches(const AwardLedger::Slot& s, const char* key) {
+    return strncmp(s.key, key, AwardLedger::kKeyBytes - 1) == 0;
+}
+
+// Linear probe from the key's home slot. True if present; otherwise
+// emptyOut = the slot an insert should use.
+bool probe(File& f, uint32_t capacity, const char* key, uint32_t h, uint32_t& emptyOut) {
+    AwardLedger::Slot chunk[kProbeSlots];
+    uint32_t mask = capacity - 1;
+    uint32_t slot = h & mask;
+    uint32_t seen = 0;
+    emptyOut = UINT32_MAX;
+    while (seen < capacity) {
+        uint32_t n = capacity - slot;
+        if (n > kProbeSlots) n = kProbeSlots;
+        if (!f.seek(slotOffset(slot))) return false;
+        if (f.read((uint8_t*)chunk, n * kSlotBytes) != n * kSlotBytes) return false;
+        for (uint32_t i = 0; i < n; i++) {
+            if (chunk[i].hash == 0) {
+                emptyOut = slot + i;
+                return false;
+            }
+            if (chunk[i].hash == h && keyMatches(chunk[i], key)) return true;
+        }
+        seen += n;
+        slot = (slot + n) & mask;
+    }
+    return false;
+}
+
+bool writeSlot(File& f, uint32_t slot, const char* key, uint32_t h) {
+    AwardLedger::Slot s;
+    memset(&s, 0, sizeof(s));
+    s.hash = h;
+    strncpy(s.key, key, sizeof(s.key) - 1);
+    return f.seek(slotOffset(slot)) && f.write((const uint8_t*)&s, sizeof(s)) == sizeof(s);
+}
+
+// Journal line -> trimmed, non-empty key (false for blank lines)
+bool readJournalLine(File& f, char* buf, size_t bufLen) {
+    size_t len = f.readBytesUntil('\n', buf, bufLen - 1);
+    buf[len] = '\0';
+    while (len > 0 && (buf[len - 1] == '\r' || buf[len - 1] == ' ')) {
+        buf[--len] = '\0';
+    }
+    return len > 0;
+}
+
+}  // namespace
+
+const char* AwardLedger::keyOf(const char* line) {
+    const char* slash = strrchr(line, '/');
+    return (slash && *(slash + 1)) ? slash + 1 : line;
+}
+
+uint32_t AwardLedger::hash(const char* key) {
+    // FNV-1a; 0 marks an empty slot
+    uint32_t h = 2166136261u;
+    for (const uint8_t* p = (const uint8_t*)key; *p; p++) {
+        h ^= *p;
+        h *= 16777619u;
+    }
+    return h ? h : 1;
+}
+
+void AwardLedger::bloomAdd(uint32_t h) {
+    uint32_t step = (h >> 17) | (h << 15) | 1;
+    for (uint32_t i = 0; i < 3; i++) {
+        uint32_t bit = (h + i * step) % kBloomBits;
+        bloom_[bit >> 3] |= (uint8_t)(1u << (bit & 7));
+    }
+}
+
+bool AwardLedger::bloomMayContain(uint32_t h) const {
+    uint32_t step = (h >> 17) | (h << 15) | 1;
+    for (uint32_t i = 0; i < 3; i++) {
+        uint32_t bit = (h + i * step) % kBloomBits;
+        if (!(bloom_[bit >> 3] & (1u << (bit & 7)))) return false;
+    }
+    return true;
+}
+
+bool AwardLedger::open(const char* ledgerPath, const char* journalPath) {
+    close();
+    if (!ledgerPath || !journalPath || !Config::isSDAvailable()) return false;
+    strncpy(ledgerPath_, ledgerPath, sizeof(ledgerPath_) - 1);
+    ledgerPath_[sizeof(ledgerPath_) - 1] = '\0';
+    strncpy(journalPath_, journalPath, sizeof(journalPath_) - 1);
+    journalPath_[sizeof(journalPath_) - 1] = '\0';
+
+    bloom_ = (uint8_t*)malloc(kBloomBytes);
+    if (!bloom_) return false;
+    if (load()) return true;
+
+    Serial.printf("[XPLEDGER] Rebuilding %s from %s\n", ledgerPath_, journalPath_);
+    if (rebuild(kInitialCapacity)) return true;
+    close();
+    return false;
+}
+
+void AwardLedger::close() {
+    free(bloom_);
+    bloom_ = nullptr;
+    capacity_ = 0;
+    count_ = 0;
+}
+
+bool AwardLedger::load() {
+    File f = SD.open(ledgerPath_, FILE_READ);
+    if (!f) return false;
+    Header h;
+    bool ok = readHeader(f, h) &&
+              h.capacity >= kInitialCapacity &&
+              (h.capacity & (h.capacity - 1)) == 0 &&
+              h.count * 2 <= h.capacity &&
+              f.size() == slotOffset(h.capacity) &&
+              h.journalBytes == fileSize(journalPath_) &&
+              f.seek(kHeaderBytes) &&
+              f.read(bloom_, kBloomBytes) == kBloomBytes;
+    f.close();
+    if (!ok) return false;
+    capacity_ = h.capacity;
+    count_ = h.count;
+    return true;
+}
+
+// Build a fresh table from the journal in a temp file, then swap it in
+bool AwardLedger::rebuild(uint32_t minCapacity) {
+    char lineBuf[128];
+    uint32_t lines = 0;
+    File journal = SD.open(journalPath_, FILE_READ);
+    if (journal) {
+        while (journal.available()) {
+            yield();
+            if (readJournalLine(journal, lineBuf, sizeof(lineBuf))) lines++;
+        }
+        journal.close();
+    }
+    uint32_t capacity = minCapacity < kInitialCapacity ? kInitialCapacity : minCapacity;
+    while (capacity < (lines + 1) * 2) capacity *= 2;
+
+    char tmpPath[72];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", ledgerPath_);
+    SD.remove(tmpPath);
+    File out = SD.open(tmpPath, FILE_WRITE);
+    if (!out) return false;
+
+    // Header, bloom and empty slots, zero-filled in 512-byte writes
+    static uint8_t zeros[512];
+    Header h = {capacity, 0, 0};
+    bool ok = writeHeader(out, h);
+    size_t remaining = slotOffset(capacity) - kHeaderBytes;
+    while (ok && remaining > 0) {
+        size_t n = remaining < sizeof(zeros) ? remaining : sizeof(zeros);
+        ok = out.write(zeros, n) == n;
+        remaining -= n;
+    }
+    out.close();
+
+    memset(bloom_, 0, kBloomBytes);
+    capacity_ = capacity;
+    count_ = 0;
+    uint32_t journalBytes = 0;
+    if (ok) out = SD.open(tmpPath, "r+");
+    if (ok && out) {
+        journal = SD.open(journalPath_, FILE_READ);
+        if (journal) {
+            journalBytes = (uint32_t)journal.size();
+            while (ok && journal.available()) {
+                yield();
+                if (!readJournalLine(journal, lineBuf, sizeof(lineBuf))) continue;
+                const char* key = keyOf(lineBuf);
+                uint32_t hv = hash(key);
+                uint32_t slot;
+                if (probe(out, capacity_, key, hv, slot)) continue;
+                ok = slot != UINT32_MAX && writeSlot(out, slot, key, hv);
+                if (ok) {
+                    count_++;
+                    bloomAdd(hv);
+                }
+            }
+            journal.close();
+        }
+        h.count = count_;
+        h.journalBytes = journalBytes;
+        ok = ok && out.seek(kHeaderBytes) &&
+             out.write(bloom_, kBloomBytes) == kBloomBytes &&
+             writeHeader(out, h);
+        out.close();
+    } else {
+        ok = false;
+    }
+
+    if (ok) {
+        SD.remove(ledgerPath_);
+        ok = SD.rename(tmpPath, ledgerPath_);
+    }
+    if (!ok) {
+        SD.remove(tmpPath);
+        Serial.printf("[XPLEDGER] Rebuild failed: %s\n", ledgerPath_);
+        return false;
+    }
+    Serial.printf("[XPLEDGER] %s: %lu keys, %lu slots\n", ledgerPath_,
+                  (unsigned long)count_, (unsigned long)capacity_);
+    return true;
+}
+
+bool AwardLedger::contains(const char* key) {
+    if (!isOpen() || !key || !key[0]) return false;
+    key = keyOf(key);
+    uint32_t h = hash(key);
+    if (!bloomMayContain(h)) return false;
+    File f = SD.open(ledgerPath_, FILE_READ);
+    if (!f) return false;
+    uint32_t slot;
+    bool found = probe(f, capacity_, key, h, slot);
+    f.close();
+    return found;
+}
+
+bool AwardLedger::add(const char* key) {
+    if (!isOpen() || !key || !key[0]) return false;
+    key = keyOf(key);
+    if (contains(key)) return false;
+
+    // Journal first: a table that misses the line is stale and gets rebuilt
+    File journal = SD.open(journalPath_, FILE_APPEND);
+    if (!journal) return false;
+    journal.println(key);
+    journal.close();
+
+    if ((count_ + 1) * 2 > capacity_) {
+        if (rebuild(capacity_ * 2)) return true;
+        close();  // No table: award nothing rather than award twice
+        return true;
+    }
+
+    uint32_t h = hash(key);
+    File f = SD.open(ledgerPath_, "r+");
+    uint32_t slot = UINT32_MAX;
+    bool ok = f && !probe(f, capacity_, key, h, slot) && slot != UINT32_MAX &&
+              writeSlot(f, slot, key, h);
+    if (ok) {
+        count_++;
+        bloomAdd(h);
+        Header hdr = {capacity_, count_, fileSize(journalPath_)};
+        ok = f.seek(kHeaderBytes) &&
+             f.write(bloom_, kBloomBytes) == kBloomBytes &&
+             writeHeader(f, hdr);
+    }
+    if (f) f.close();
+    if (!ok) {
+        Serial.printf("[XPLEDGER] Update failed: %s\n", ledgerPath_);
+        close();
+    }
+    return true;
+}
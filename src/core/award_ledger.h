@@ -0,0 +1,77 @@
+// AwardLedger - On-SD hash set of keys that already earned file-transfer XP
+// Replaces line-scanning the xp_awarded_*.txt files: keys live in an
+// open-addressing table of fixed slots on the card, and a bloom filter
+// (stored in the file, held in RAM while open) answers most "not awarded
+// yet" lookups without an SD read. A hit, or a bloom false positive, costs
+// one short linear probe.
+//
+// The line file stays the durable journal: add() appends to it as before,
+// and a table that is missing, damaged or out of step with it (the header
+// records the journal length) is rebuilt from it. That rebuild is also the
+// one-time migration for cards that only have the line files.
+//
+// File:   32-byte header ("PXAL", u16 version, u16 slot size, u32 capacity,
+//         u32 count, u32 journal bytes, 12 reserved), kBloomBytes of filter
+//         bits, then capacity Slot records. Capacity is a power of two, kept
+//         at most half full; a full table is rebuilt at twice the size.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class AwardLedger {
+public:
+    static constexpr uint16_t kVersion = 1;
+    static constexpr size_t kHeaderBytes = 32;
+    static constexpr size_t kBloomBytes = 1024;      // 8192 bits, 3 probes
+    static constexpr size_t kKeyBytes = 40;          // BSSID or WiGLE file name + NUL
+    static constexpr uint32_t kInitialCapacity = 256;
+
+    // Keys longer than kKeyBytes - 1 are stored truncated; the full-key hash
+    // still tells them apart
+    struct Slot {
+        uint32_t hash;      // 0 = empty
+        char key[kKeyBytes];
+        uint8_t reserved[4];
+    };
+    static_assert(sizeof(Slot) == 48, "AwardLedger slot layout");
+
+    AwardLedger() = default;
+    ~AwardLedger() { close(); }
+    AwardLedger(const AwardLedger&) = delete;
+    AwardLedger& operator=(const AwardLedger&) = delete;
+
+    // Load the table at ledgerPath, rebuilding it from journalPath when it
+    // is missing, damaged or stale. False only on SD / allocation failure.
+    bool open(const char* ledgerPath, const char* journalPath);
+    // Free the filter; the files stay
+    void close();
+    bool isOpen() const { return bloom_ != nullptr; }
+
+    bool contains(const char* key);
+    // Journal and insert key. True once the line is journaled; false if the
+    // key was already there or the journal write failed. If the table
+    // itself cannot be updated the ledger closes (no further awards this
+    // session) and is rebuilt on the next open().
+    bool add(const char* key);
+
+    uint32_t count() const { return count_; }
+    uint32_t capacity() const { return capacity_; }
+
+    // Journal lines may hold full paths (old WiGLE entries): keys are the
+    // part after the last '/'
+    static const char* keyOf(const char* line);
+    static uint32_t hash(const char* key);
+
+private:
+    bool load();
+    bool rebuild(uint32_t minCapacity);
+    void bloomAdd(uint32_t h);
+    bool bloomMayContain(uint32_t h) const;
+
+    char ledgerPath_[64] = {0};
+    char journalPath_[64] = {0};
+    uint8_t* bloom_ = nullptr;
+    uint32_t capacity_ = 0;
+    uint32_t count_ = 0;
+};
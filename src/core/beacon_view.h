@@ -0,0 +1,240 @@
+// BeaconView - Single-pass 802.11 management frame decoder
+// Shared by NetworkRecon and every mode callback (OINK, DONOHAM, SPECTRUM)
+// Zero-copy, bounds-checked, no heap. Safe to call from the WiFi task.
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+// Host builds supply wifi_auth_mode_t via test/host/esp_wifi_types.h
+#ifdef ARDUINO
+#include <esp_wifi.h>
+#endif
+
+namespace BeaconView {
+
+// Tagged parameters start after 24-byte header + 12-byte fixed params
+// (timestamp 8, beacon interval 2, capability 2) for beacons/probe responses
+static constexpr uint16_t kBeaconIeOffset = 36;
+// Assoc request: header(24) + capability(2) + listen interval(2)
+static constexpr uint16_t kAssocReqIeOffset = 28;
+// Reassoc request: header(24) + capability(2) + listen interval(2) + current AP(6)
+static constexpr uint16_t kReassocReqIeOffset = 34;
+
+// Element IDs we care about
+static constexpr uint8_t kIeSsid = 0x00;
+static constexpr uint8_t kIeDsParams = 0x03;
+static constexpr uint8_t kIeRsn = 0x30;
+static constexpr uint8_t kIeVendor = 0xDD;
+
+// One tagged parameter - data points into the caller's frame buffer
+struct IE {
+    uint8_t id;
+    uint8_t len;
+    const uint8_t* data;
+};
+
+// Bounds-checked IE walker. next() returns false at end of frame or on the
+// first element whose declared length runs past the buffer (truncated()).
+class IEIterator {
+public:
+    IEIterator(const uint8_t* frame, uint16_t len, uint16_t ieOffset)
+        : frame_(frame), len_(len), offset_(ieOffset), truncated_(false) {}
+
+    bool next(IE& out) {
+        if (!frame_ || offset_ + 2 > len_) return false;
+        uint8_t id = frame_[offset_];
+        uint8_t ieLen = frame_[offset_ + 1];
+        if ((uint32_t)offset_ + 2 + ieLen > len_) {
+            truncated_ = true;
+            offset_ = len_;
+            return false;
+        }
+        out.id = id;
+        out.len = ieLen;
+        out.data = frame_ + offset_ + 2;
+        offset_ = (uint16_t)(offset_ + 2 + ieLen);
+        return true;
+    }
+
+    bool truncated() const { return truncated_; }
+
+private:
+    const uint8_t* frame_;
+    uint16_t len_;
+    uint16_t offset_;
+    bool truncated_;
+};
+
+// Everything the promiscuous callbacks need from a beacon/probe response/assoc
+// request, decoded in one walk of the tagged parameters.
+struct Summary {
+    const uint8_t* bssid;     // Addr3, points into frame (valid only during callback)
+    uint16_t beaconInterval;  // TU, 0 if not a beacon/probe response
+    uint16_t capability;
+    char ssid[33];            // NUL-terminated, empty if hidden/absent/oversized
+    uint8_t ssidLen;          // Raw SSID IE length (0 if absent)
+    bool ssidPresent;         // SSID IE seen with a valid length (0-32)
+    bool isHidden;            // Zero-length or all-NUL SSID
+    uint8_t dsChannel;        // DS Parameter Set channel, 0 if absent
+    bool hasRSN;              // RSN IE (0x30) present
+    bool hasWPA;              // WPA1 vendor IE (00:50:F2:01) present
+    bool pmfCapable;          // RSN caps bit 6 (MFPC)
+    bool pmfRequired;         // RSN caps bit 7 (MFPR)
+    bool truncated;           // Element walk stopped on a malformed length
+    wifi_auth_mode_t authmode;
+
+    // True if SSID carries a printable name (not hidden, not absent)
+    bool hasNamedSsid() const { return ssidPresent && !isHidden && ssid[0] != 0; }
+};
+
+static inline uint16_t readLE16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+// Walk an RSN IE body to the capabilities field - no shortcuts, no assumptions
+// Returns false if the element is too short or not version 1.
+static inline bool parseRsnCaps(const uint8_t* rsn, uint8_t rsnLen, uint16_t& caps) {
+    if (rsnLen < 8) return false;
+    if (readLE16(rsn) != 1) return false;
+
+    uint32_t off = 6;  // Skip version(2) + group cipher(4)
+    if (off + 2 > rsnLen) return false;
+    uint16_t pairwiseCount = readLE16(rsn + off);
+    off += 2 + (uint32_t)pairwiseCount * 4;
+    if (off + 2 > rsnLen) return false;
+    uint16_t akmCount = readLE16(rsn + off);
+    off += 2 + (uint32_t)akmCount * 4;
+    if (off + 2 > rsnLen) return false;
+
+    // RSN Capabilities - IEEE 802.11-2016 Table 9-133
+    caps = readLE16(rsn + off);
+    return true;
+}
+
+// Auth classification, matching the legacy per-mode loops:
+// RSN + MFPR        = pure WPA3 (PMF required, no fallback)
+// RSN + MFPC only   = WPA2/WPA3 transitional (PMF capable, clients choose)
+// RSN alone         = WPA2
+// WPA vendor alone  = WPA1
+// RSN + WPA vendor  = WPA1/WPA2 mixed
+static inline void classifyAuth(Summary& s) {
+    if (s.hasRSN && s.hasWPA) {
+        s.authmode = WIFI_AUTH_WPA_WPA2_PSK;
+    } else if (s.hasRSN) {
+        if (s.pmfRequired) {
+            s.authmode = WIFI_AUTH_WPA3_PSK;
+        } else if (s.pmfCapable) {
+            s.authmode = WIFI_AUTH_WPA2_WPA3_PSK;
+        } else {
+            s.authmode = WIFI_AUTH_WPA2_PSK;
+        }
+    } else if (s.hasWPA) {
+        s.authmode = WIFI_AUTH_WPA_PSK;
+    } else {
+        s.authmode = WIFI_AUTH_OPEN;
+    }
+}
+
+/**
+ * @brief Decode a management frame's tagged parameters in one pass
+ * @param frame Raw 802.11 frame (starting at Frame Control)
+ * @param len Frame length without FCS/ghost bytes
+ * @param out Summary to fill (always initialized, even on failure)
+ * @param ieOffset Start of tagged parameters (kBeaconIeOffset for beacons/probe resp)
+ * @return false if the frame is too short to carry a BSSID and fixed params
+ */
+static inline bool parse(const uint8_t* frame, uint16_t len, Summary& out,
+                         uint16_t ieOffset = kBeaconIeOffset) {
+    memset(&out, 0, sizeof(out));
+    out.authmode = WIFI_AUTH_OPEN;
+    if (!frame || len < 24 || len < ieOffset) return false;
+
+    out.bssid = frame + 16;
+    if (ieOffset == kBeaconIeOffset) {
+        out.beaconInterval = readLE16(frame + 32);
+        out.capability = readLE16(frame + 34);
+    }
+
+    bool ssidDone = false;
+    bool rsnDone = false;
+    IEIterator it(frame, len, ieOffset);
+    IE ie;
+    while (it.next(ie)) {
+        switch (ie.id) {
+            case kIeSsid:
+                if (ssidDone) break;
+                ssidDone = true;
+                out.ssidLen = ie.len;
+                if (ie.len == 0) {
+                    out.ssidPresent = true;
+                    out.isHidden = true;
+                } else if (ie.len <= 32) {
+                    out.ssidPresent = true;
+                    memcpy(out.ssid, ie.data, ie.len);
+                    out.ssid[ie.len] = 0;
+                    bool allNull = true;
+                    for (uint8_t i = 0; i < ie.len; i++) {
+                        if (ie.data[i] != 0) { allNull = false; break; }
+                    }
+                    out.isHidden = allNull;
+                }
+                break;
+
+            case kIeDsParams:
+                if (ie.len == 1 && out.dsChannel == 0) {
+                    out.dsChannel = ie.data[0];
+                }
+                break;
+
+            case kIeRsn:
+                if (ie.len >= 2) out.hasRSN = true;
+                if (!rsnDone && ie.len >= 8) {
+                    rsnDone = true;
+                    uint16_t caps = 0;
+                    if (parseRsnCaps(ie.data, ie.len, caps)) {
+                        out.pmfCapable = (caps >> 6) & 0x01;  // MFPC
+                        out.pmfRequired = (caps >> 7) & 0x01; // MFPR
+                    }
+                }
+                break;
+
+            case kIeVendor:
+                if (ie.len >= 8 && ie.data[0] == 0x00 && ie.data[1] == 0x50 &&
+                    ie.data[2] == 0xF2 && ie.data[3] == 0x01) {
+                    out.hasWPA = true;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+    out.truncated = it.truncated();
+    classifyAuth(out);
+    return true;
+}
+
+// SSID-only fast path (assoc/reassoc requests, DNH dwell resolution).
+// Stops at the first SSID element instead of walking the whole frame.
+static inline bool findSsid(const uint8_t* frame, uint16_t len, uint16_t ieOffset,
+                            char* ssidOut, bool& allNull) {
+    ssidOut[0] = 0;
+    allNull = true;
+    if (!frame || len < ieOffset) return false;
+    IEIterator it(frame, len, ieOffset);
+    IE ie;
+    while (it.next(ie)) {
+        if (ie.id != kIeSsid) continue;
+        if (ie.len == 0 || ie.len > 32) return false;
+        memcpy(ssidOut, ie.data, ie.len);
+        ssidOut[ie.len] = 0;
+        for (uint8_t i = 0; i < ie.len; i++) {
+            if (ie.data[i] != 0) { allNull = false; break; }
+        }
+        return true;
+    }
+    return false;
+}
+
+} // namespace BeaconView
@@ -0,0 +1,120 @@
+// BssidIndex - Open-addressed BSSID -> table index lookup
+// Fixed-size, no heap, safe to use inside a spinlock.
+// Backing table owns the BSSIDs; the index stores only positions and verifies
+// every candidate against the table, so a hit is always a real match.
+#pragma once
+
+#include <cstdint>
+
+// BSSID key for map lookup (6 bytes as uint64_t)
+inline uint64_t bssidToKey(const uint8_t* bssid) {
+    return ((uint64_t)bssid[0] << 40) | ((uint64_t)bssid[1] << 32) |
+           ((uint64_t)bssid[2] << 24) | ((uint64_t)bssid[3] << 16) |
+           ((uint64_t)bssid[4] << 8) | bssid[5];
+}
+
+class BssidIndex {
+public:
+    // Power of two, >= 2x MAX_RECON_NETWORKS to keep linear probe chains short
+    static constexpr uint16_t kSlotBits = 9;
+    static constexpr uint16_t kSlots = 1u << kSlotBits;
+    static constexpr uint16_t kMaxEntries = kSlots / 2;
+    static constexpr uint16_t kEmpty = 0xFFFF;
+
+    BssidIndex() { clear(); }
+
+    void clear() {
+        for (uint16_t i = 0; i < kSlots; i++) slots_[i] = kEmpty;
+        count_ = 0;
+    }
+
+    uint16_t size() const { return count_; }
+
+    /**
+     * @brief Find table position for key
+     * @param keyAt Callable: keyAt(uint16_t idx) -> uint64_t key stored at idx
+     * @param probes Optional out: slots inspected (for tests/diagnostics)
+     * @return table index, or -1 if not indexed
+     */
+    template <typename KeyAt>
+    int find(uint64_t key, KeyAt keyAt, uint16_t* probes = nullptr) const {
+        uint16_t slot = home(key);
+        uint16_t n = 0;
+        while (n < kSlots) {
+            uint16_t v = slots_[slot];
+            n++;
+            if (v == kEmpty) break;
+            if (keyAt(v) == key) {
+                if (probes) *probes = n;
+                return (int)v;
+            }
+            slot = (slot + 1) & (kSlots - 1);
+        }
+        if (probes) *probes = n;
+        return -1;
+    }
+
+    // Caller guarantees key is not already present
+    bool insert(uint64_t key, uint16_t idx) {
+        if (count_ >= kMaxEntries || idx == kEmpty) return false;
+        uint16_t slot = home(key);
+        while (slots_[slot] != kEmpty) {
+            slot = (slot + 1) & (kSlots - 1);
+        }
+        slots_[slot] = idx;
+        count_++;
+        return true;
+    }
+
+    // Backward-shift deletion keeps probe chains intact without tombstones
+    template <typename KeyAt>
+    bool erase(uint64_t key, KeyAt keyAt) {
+        // Table is never more than half full, so the walk always hits an empty slot
+        uint16_t slot = home(key);
+        while (true) {
+            uint16_t v = slots_[slot];
+            if (v == kEmpty) return false;
+            if (keyAt(v) == key) break;
+            slot = (slot + 1) & (kSlots - 1);
+        }
+
+        uint16_t hole = slot;
+        uint16_t next = (hole + 1) & (kSlots - 1);
+        while (slots_[next] != kEmpty) {
+            uint16_t want = home(keyAt(slots_[next]));
+            // Move entry back if its home slot is not in (hole, next]
+            bool between = (hole <= next) ? (want > hole && want <= next)
+                                          : (want > hole || want <= next);
+            if (!between) {
+                slots_[hole] = slots_[next];
+                hole = next;
+            }
+            next = (next + 1) & (kSlots - 1);
+        }
+        slots_[hole] = kEmpty;
+        count_--;
+        return true;
+    }
+
+    /**
+     * @brief Rebuild from scratch after the table was compacted or reordered
+     * @return number of entries indexed (< count if table exceeds kMaxEntries)
+     */
+    template <typename KeyAt>
+    uint16_t rebuild(uint16_t count, KeyAt keyAt) {
+        clear();
+        for (uint16_t i = 0; i < count; i++) {
+            if (!insert(keyAt(i), i)) break;
+        }
+        return count_;
+    }
+
+private:
+    static uint16_t home(uint64_t key) {
+        // Fibonacci hashing - spreads sequential vendor MACs across the table
+        return (uint16_t)((key * 0x9E3779B97F4A7C15ull) >> (64 - kSlotBits));
+    }
+
+    uint16_t slots_[kSlots];
+    uint16_t count_;
+};
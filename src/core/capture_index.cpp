@@ -0,0 +1,365 @@
+// CaptureIndex - Binary manifest of the handshakes directory
+
+#include "capture_index.h"
+#include "config.h"
+#include "sd_layout.h"
+#include <Arduino.h>
+#include <SD.h>
+#include <time.h>
+#include <string.h>
+
+namespace CaptureIndex {
+
+namespace {
+
+static constexpr uint8_t kMagic[4] = {'P', 'C', 'I', 'X'};
+static constexpr size_t kChunkRecords = 8;   // 768 bytes per SD read
+
+// invalidate() bumps this; a rebuild that started earlier is discarded
+uint32_t generation = 0;
+
+File rbDir;
+File rbOut;
+bool rbActive = false;
+uint32_t rbGeneration = 0;
+uint32_t rbSlots = 0;
+char rbTmpPath[72] = {0};
+
+bool endsWith(const char* s, size_t len, const char* suffix) {
+    size_t n = strlen(suffix);
+    return len > n && strcmp(s + len - n, suffix) == 0;
+}
+
+int hexNibble(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+bool parseHexBssid(const char* s, uint8_t out[6]) {
+    for (int i = 0; i < 6; i++) {
+        int hi = hexNibble(s[i * 2]);
+        int lo = hexNibble(s[i * 2 + 1]);
+        if (hi < 0 || lo < 0) return false;
+        out[i] = (uint8_t)((hi << 4) | lo);
+    }
+    return true;
+}
+
+const char* baseName(const char* path) {
+    const char* slash = strrchr(path, '/');
+    return slash ? slash + 1 : path;
+}
+
+bool readHeader(File& f, uint32_t* slots) {
+    uint8_t hdr[kHeaderBytes];
+    if (f.read(hdr, sizeof(hdr)) != sizeof(hdr)) return false;
+    if (memcmp(hdr, kMagic, sizeof(kMagic)) != 0) return false;
+    uint16_t version, recordBytes;
+    memcpy(&version, hdr + 4, 2);
+    memcpy(&recordBytes, hdr + 6, 2);
+    if (version != kVersion || recordBytes != kRecordBytes) return false;
+    size_t body = f.size() - kHeaderBytes;
+    if (body % kRecordBytes != 0) return false;  // Torn append
+    if (slots) *slots = (uint32_t)(body / kRecordBytes);
+    return true;
+}
+
+bool writeHeader(File& f) {
+    uint8_t hdr[kHeaderBytes] = {0};
+    memcpy(hdr, kMagic, sizeof(kMagic));
+    uint16_t version = kVersion;
+    uint16_t recordBytes = kRecordBytes;
+    memcpy(hdr + 4, &version, 2);
+    memcpy(hdr + 6, &recordBytes, 2);
+    return f.write(hdr, sizeof(hdr)) == sizeof(hdr);
+}
+
+// Open the index and check its header. slots = records in the file.
+File openValid(const char* mode, uint32_t* slots) {
+    if (!Config::isSDAvailable()) return File();
+    File f = SD.open(SDLayout::captureIndexPath(), mode);
+    if (!f) return File();
+    if (!readHeader(f, slots)) {
+        f.close();
+        return File();
+    }
+    return f;
+}
+
+// Legacy BSSID-only captures keep the SSID in a companion .txt
+void readLegacySsid(Record& rec) {
+    char txtPath[80];
+    snprintf(txtPath, sizeof(txtPath), "%s/%.12s%s.txt", SDLayout::handshakesDir(),
+             rec.name, rec.type == TYPE_PMKID ? "_pmkid" : "");
+    if (!SD.exists(txtPath)) return;
+    File txt = SD.open(txtPath, FILE_READ);
+    if (!txt) return;
+    char buf[34];
+    int n = txt.readBytesUntil('\n', buf, sizeof(buf) - 1);
+    txt.close();
+    buf[n] = '\0';
+    while (n > 0 && (buf[n - 1] == ' ' || buf[n - 1] == '\r' || buf[n - 1] == '\t')) buf[--n] = '\0';
+    strncpy(rec.ssid, buf, sizeof(rec.ssid) - 1);
+}
+
+void finishRebuild() {
+    if (rbDir) rbDir.close();
+    bool ok = (bool)rbOut;
+    if (rbOut) rbOut.close();
+    rbActive = false;
+
+    if (!ok || rbGeneration != generation) {
+        SD.remove(rbTmpPath);
+        Serial.printf("[CAPIDX] Rebuild %s\n", ok ? "discarded (invalidated)" : "failed");
+        return;
+    }
+    const char* path = SDLayout::captureIndexPath();
+    SD.remove(path);
+    if (!SD.rename(rbTmpPath, path)) {
+        SD.remove(rbTmpPath);
+        Serial.println("[CAPIDX] Rebuild rename failed");
+        return;
+    }
+    Serial.printf("[CAPIDX] Rebuilt: %lu captures\n", (unsigned long)rbSlots);
+}
+
+}  // namespace
+
+bool parseName(const char* name, Record& out) {
+    memset(&out, 0, sizeof(out));
+    size_t len = strlen(name);
+    if (len >= sizeof(out.name)) return false;
+
+    if (endsWith(name, len, "_hs.22000")) {
+        out.type = TYPE_HS22000;
+    } else if (endsWith(name, len, ".22000")) {
+        out.type = TYPE_PMKID;
+    } else if (endsWith(name, len, ".pcap")) {
+        out.type = TYPE_PCAP;
+    } else {
+        return false;
+    }
+    memcpy(out.name, name, len + 1);
+
+    // Base name: strip the extension and the _hs suffix
+    const char* dot = strrchr(name, '.');
+    size_t baseLen = dot ? (size_t)(dot - name) : len;
+    if (baseLen > 3 && strncmp(name + baseLen - 3, "_hs", 3) == 0) {
+        baseLen -= 3;
+    }
+
+    if (baseLen == 12 && parseHexBssid(name, out.bssid)) {
+        // Legacy: BSSID only, SSID (if any) in a companion .txt
+    } else if (baseLen > 13 && name[baseLen - 13] == '_' &&
+               parseHexBssid(name + baseLen - 12, out.bssid)) {
+        // SSID_BSSID (sanitized SSID)
+        size_t ssidLen = baseLen - 13;
+        if (ssidLen > sizeof(out.ssid) - 1) ssidLen = sizeof(out.ssid) - 1;
+        memcpy(out.ssid, name, ssidLen);
+    } else {
+        out.flags |= FLAG_NO_BSSID;
+    }
+    return true;
+}
+
+bool isStale() {
+    File f = openValid(FILE_READ, nullptr);
+    if (!f) return true;
+    f.close();
+    return false;
+}
+
+void invalidate() {
+    generation++;
+    if (!Config::isSDAvailable()) return;
+    const char* path = SDLayout::captureIndexPath();
+    if (SD.exists(path)) {
+        SD.remove(path);
+        Serial.println("[CAPIDX] Invalidated");
+    }
+}
+
+bool rebuildBegin() {
+    rebuildCancel();
+    if (!Config::isSDAvailable()) return false;
+
+    const char* metaDir = SDLayout::metaDir();
+    if (!SD.exists(metaDir)) SD.mkdir(metaDir);
+    snprintf(rbTmpPath, sizeof(rbTmpPath), "%s.tmp", SDLayout::captureIndexPath());
+    rbOut = SD.open(rbTmpPath, FILE_WRITE);
+    if (!rbOut || !writeHeader(rbOut)) {
+        if (rbOut) rbOut.close();
+        Serial.println("[CAPIDX] Cannot create index");
+        return false;
+    }
+
+    // No handshakes directory yet: an empty index is still a valid one
+    const char* hsDir = SDLayout::handshakesDir();
+    if (SD.exists(hsDir)) {
+        rbDir = SD.open(hsDir);
+        if (rbDir && !rbDir.isDirectory()) rbDir.close();
+    }
+    rbActive = true;
+    rbGeneration = generation;
+    rbSlots = 0;
+    return true;
+}
+
+bool rebuildStep(size_t maxFiles) {
+    if (!rbActive) return true;
+    for (size_t i = 0; i < maxFiles; i++) {
+        File f = rbDir ? rbDir.openNextFile() : File();
+        if (!f) {
+            finishRebuild();
+            return true;
+        }
+        Record rec;
+        if (!f.isDirectory() && parseName(baseName(f.name()), rec)) {
+            rec.size = (uint32_t)f.size();
+            rec.time = (uint32_t)f.getLastWrite();
+            f.close();
+            if (rec.ssid[0] == '\0' && !(rec.flags & FLAG_NO_BSSID)) {
+                readLegacySsid(rec);
+            }
+            if (rbOut.write((const uint8_t*)&rec, sizeof(rec)) != sizeof(rec)) {
+                rebuildCancel();
+                return true;
+            }
+            rbSlots++;
+        } else {
+            f.close();
+        }
+    }
+    return false;
+}
+
+bool rebuildActive() {
+    return rbActive;
+}
+
+void rebuildCancel() {
+    if (!rbActive) return;
+    if (rbDir) rbDir.close();
+    if (rbOut) rbOut.close();
+    SD.remove(rbTmpPath);
+    rbActive = false;
+}
+
+bool rebuild() {
+    if (!rebuildBegin()) return false;
+    while (!rebuildStep(10)) {
+        yield();
+    }
+    return !isStale();
+}
+
+bool noteSaved(const char* path, const char* ssid, const uint8_t bssid[6]) {
+    Record rec;
+    if (!path || !parseName(baseName(path), rec)) return false;
+    if (ssid && ssid[0]) {
+        strncpy(rec.ssid, ssid, sizeof(rec.ssid) - 1);
+        rec.ssid[sizeof(rec.ssid) - 1] = '\0';
+    }
+    if (bssid) {
+        memcpy(rec.bssid, bssid, 6);
+        rec.flags &= ~FLAG_NO_BSSID;
+    }
+
+    uint32_t slots = 0;
+    File f = openValid("r+", &slots);
+    if (!f) return false;  // Stale: the next rebuild picks the file up
+
+    File saved = SD.open(path, FILE_READ);
+    if (saved) {
+        rec.size = (uint32_t)saved.size();
+        saved.close();
+    }
+    rec.time = (uint32_t)time(nullptr);
+
+    // Re-saved capture: refresh its slot, keeping the WPA-SEC flags
+    Record chunk[kChunkRecords];
+    uint32_t slot = slots;
+    for (uint32_t at = 0; at < slots && slot == slots; at += kChunkRecords) {
+        size_t n = slots - at < kChunkRecords ? slots - at : kChunkRecords;
+        if (f.read((uint8_t*)chunk, n * kRecordBytes) != n * kRecordBytes) {
+            f.close();
+            return false;
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (strcmp(chunk[i].name, rec.name) == 0) {
+                slot = at + (uint32_t)i;
+                rec.flags |= chunk[i].flags & (FLAG_UPLOADED | FLAG_CRACKED);
+                break;
+            }
+        }
+    }
+
+    bool ok = f.seek(kHeaderBytes + (size_t)slot * kRecordBytes) &&
+              f.write((const uint8_t*)&rec, sizeof(rec)) == sizeof(rec);
+    f.close();
+    return ok;
+}
+
+uint32_t forEach(Visitor fn, void* ctx, uint32_t firstSlot) {
+    uint32_t slots = 0;
+    File f = openValid(FILE_READ, &slots);
+    if (!f) return firstSlot;
+    if (firstSlot >= slots || !f.seek(kHeaderBytes + (size_t)firstSlot * kRecordBytes)) {
+        f.close();
+        return firstSlot < slots ? firstSlot : slots;
+    }
+
+    Record chunk[kChunkRecords];
+    uint32_t at = firstSlot;
+    while (at < slots) {
+        size_t n = slots - at < kChunkRecords ? slots - at : kChunkRecords;
+        if (f.read((uint8_t*)chunk, n * kRecordBytes) != n * kRecordBytes) break;
+        for (size_t i = 0; i < n; i++) {
+            uint32_t slot = at++;
+            if (!fn(chunk[i], slot, ctx)) {
+                f.close();
+                return slot + 1;
+            }
+        }
+    }
+    f.close();
+    return at;
+}
+
+size_t update(Updater fn, void* ctx) {
+    uint32_t slots = 0;
+    File f = openValid("r+", &slots);
+    if (!f) return 0;
+
+    Record chunk[kChunkRecords];
+    size_t changed = 0;
+    for (uint32_t at = 0; at < slots; at += kChunkRecords) {
+        size_t n = slots - at < kChunkRecords ? slots - at : kChunkRecords;
+        size_t bytes = n * kRecordBytes;
+        if (f.read((uint8_t*)chunk, bytes) != bytes) break;
+        size_t chunkChanged = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (fn(chunk[i], ctx)) chunkChanged++;
+        }
+        if (chunkChanged) {
+            size_t offset = kHeaderBytes + (size_t)at * kRecordBytes;
+            if (!f.seek(offset) || f.write((const uint8_t*)chunk, bytes) != bytes) break;
+            changed += chunkChanged;
+            f.seek(offset + bytes);
+        }
+    }
+    f.close();
+    return changed;
+}
+
+uint32_t count() {
+    uint32_t slots = 0;
+    File f = openValid(FILE_READ, &slots);
+    if (!f) return 0;
+    f.close();
+    return slots;
+}
+
+}  // namespace CaptureIndex
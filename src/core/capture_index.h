@@ -0,0 +1,84 @@
+// CaptureIndex - Binary manifest of the handshakes directory
+// One fixed-size record per capture file (.pcap, _hs.22000, .22000), so
+// the Captures menu, WPA-SEC sync and the file server can page through
+// captures without walking the directory or re-reading the files. The save
+// paths append/refresh records as they write; anything that changes the
+// directory behind our back calls invalidate(), and the next reader
+// rebuilds the index from one directory walk.
+//
+// File:   16-byte header ("PCIX", u16 version, u16 record size, 8 reserved)
+//         then Record[] in slot order. A torn tail or a header from another
+//         version makes the index stale.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CaptureIndex {
+
+static constexpr uint16_t kVersion = 1;
+static constexpr size_t kHeaderBytes = 16;
+static constexpr size_t kRecordBytes = 96;
+
+enum Type : uint8_t {
+    TYPE_PCAP = 1,          // Handshake, pcap
+    TYPE_HS22000 = 2,       // Handshake, hashcat WPA*02
+    TYPE_PMKID = 3          // PMKID, hashcat WPA*01
+};
+
+enum Flag : uint8_t {
+    FLAG_UPLOADED = 0x01,   // Sent to WPA-SEC
+    FLAG_CRACKED = 0x02,    // Password in the WPA-SEC potfile
+    FLAG_NO_BSSID = 0x40    // Name did not carry a BSSID (bssid is zero)
+};
+
+struct Record {
+    uint32_t time;          // Unix seconds (file mtime, or save time)
+    uint32_t size;          // File bytes
+    uint8_t bssid[6];
+    uint8_t type;           // Type
+    uint8_t flags;          // Flag bits
+    char ssid[33];          // "" if unknown
+    char name[47];          // File name inside SDLayout::handshakesDir()
+};
+static_assert(sizeof(Record) == kRecordBytes, "CaptureIndex record layout");
+
+// Visitor for forEach(): return false to stop
+typedef bool (*Visitor)(const Record& rec, uint32_t slot, void* ctx);
+// Updater for update(): edit rec in place, return true if it changed
+typedef bool (*Updater)(Record& rec, void* ctx);
+
+// Fill type/bssid/ssid from a capture file name. Handles SSID_BSSID names,
+// legacy BSSID-only names and the _hs suffix. False if the extension is not
+// a capture type; unknown name layouts return true with FLAG_NO_BSSID set.
+bool parseName(const char* name, Record& out);
+
+// Missing, torn, other version, or invalidated
+bool isStale();
+// Drop the index; the next rebuild() recreates it
+void invalidate();
+
+// Incremental rebuild from a directory walk: rebuildBegin(), then
+// rebuildStep() until it returns true. The new index replaces the old one
+// only when the walk completes. invalidate() during a rebuild discards it.
+bool rebuildBegin();
+bool rebuildStep(size_t maxFiles);
+bool rebuildActive();
+void rebuildCancel();
+// Blocking rebuild (yields between files). True if the index is valid.
+bool rebuild();
+
+// Save paths: refresh the record for a file just written (by name),
+// appending a new slot if it is not indexed yet. No-op while stale.
+bool noteSaved(const char* path, const char* ssid, const uint8_t bssid[6]);
+
+// Visit records in slot order starting at firstSlot. Returns the slot after
+// the last one visited (a paging cursor), or firstSlot if stale.
+uint32_t forEach(Visitor fn, void* ctx, uint32_t firstSlot = 0);
+// Rewrite records in place in one pass. Returns records changed.
+size_t update(Updater fn, void* ctx);
+
+// Slots in the index (0 if stale)
+uint32_t count();
+
+}  // namespace CaptureIndex
@@ -420,6 +420,9 @@ bool Config::reinitSD() {
     bool wasSdAvailable = sdAvailable;
     bool wasNewLayout = SDLayout::usingNewLayout();
 
+    // Log file closed and flush task parked across the remount
+    SDLog::suspend();
+
     // Clean up any existing SD state
     SD.end();
     delay(80);
@@ -473,6 +476,7 @@ bool Config::reinitSD() {
         Serial.println("[CONFIG] SD reinit failed, keeping previous SD state");
     }
 
+    SDLog::resume();
     return sdAvailable;
 }
 
@@ -0,0 +1,148 @@
+// EapolSlab - Fixed chunk pool for captured EAPOL frame bytes
+
+#include "eapol_slab.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#include <string.h>
+
+namespace EapolSlab {
+
+namespace {
+
+static constexpr uint16_t kWords = kChunks / 32;
+
+uint8_t* pool = nullptr;
+uint16_t poolChunks = 0;
+uint32_t usedBits[kWords];
+uint16_t chunksUsed = 0;
+uint16_t highWater = 0;
+uint32_t allocFails = 0;
+uint32_t bytesStored = 0;
+
+// Callback and main loop both alloc/release; keep the hold time to a bitmap scan
+portMUX_TYPE slabMux = portMUX_INITIALIZER_UNLOCKED;
+
+inline bool isUsed(uint16_t i) {
+    return (usedBits[i >> 5] >> (i & 31)) & 1u;
+}
+
+void setRange(uint16_t first, uint16_t n, bool used) {
+    for (uint16_t i = first; i < first + n; i++) {
+        uint32_t bit = 1u << (i & 31);
+        if (used) usedBits[i >> 5] |= bit;
+        else usedBits[i >> 5] &= ~bit;
+    }
+}
+
+// First free run of at least n chunks, skipping full words quickly
+uint16_t findRun(uint16_t n) {
+    uint16_t runStart = 0;
+    uint16_t runLen = 0;
+    uint16_t i = 0;
+    while (i < kChunks) {
+        if ((i & 31) == 0 && usedBits[i >> 5] == 0xFFFFFFFFu) {
+            runLen = 0;
+            i += 32;
+            continue;
+        }
+        if (isUsed(i)) {
+            runLen = 0;
+        } else {
+            if (runLen == 0) runStart = i;
+            if (++runLen == n) return runStart;
+        }
+        i++;
+    }
+    return kNone;
+}
+
+}  // namespace
+
+bool begin(uint16_t chunks) {
+    if (pool) return true;
+    if (chunks == 0 || chunks > kChunks) chunks = kChunks;
+    uint8_t* p = (uint8_t*)heap_caps_malloc((size_t)chunks * kChunkBytes, MALLOC_CAP_8BIT);
+    if (!p) return false;
+    taskENTER_CRITICAL(&slabMux);
+    // Chunks past the end of a short pool are permanently marked used
+    memset(usedBits, 0, sizeof(usedBits));
+    setRange(chunks, kChunks - chunks, true);
+    poolChunks = chunks;
+    chunksUsed = 0;
+    highWater = 0;
+    allocFails = 0;
+    bytesStored = 0;
+    pool = p;
+    taskEXIT_CRITICAL(&slabMux);
+    return true;
+}
+
+void end() {
+    uint8_t* p = nullptr;
+    taskENTER_CRITICAL(&slabMux);
+    if (pool && chunksUsed == 0) {
+        p = pool;
+        pool = nullptr;
+        poolChunks = 0;
+    }
+    taskEXIT_CRITICAL(&slabMux);
+    if (p) heap_caps_free(p);
+}
+
+bool isReady() {
+    return pool != nullptr;
+}
+
+uint16_t alloc(uint16_t bytes) {
+    uint16_t n = chunksFor(bytes);
+    if (n == 0) return kNone;
+    taskENTER_CRITICAL(&slabMux);
+    uint16_t first = (pool && n <= poolChunks) ? findRun(n) : kNone;
+    if (first != kNone) {
+        setRange(first, n, true);
+        chunksUsed += n;
+        if (chunksUsed > highWater) highWater = chunksUsed;
+        bytesStored += bytes;
+    } else {
+        allocFails++;
+    }
+    taskEXIT_CRITICAL(&slabMux);
+    return first;
+}
+
+void release(uint16_t handle, uint16_t bytes) {
+    uint16_t n = chunksFor(bytes);
+    if (handle == kNone || n == 0 || handle + n > poolChunks) return;
+    taskENTER_CRITICAL(&slabMux);
+    setRange(handle, n, false);
+    chunksUsed = chunksUsed >= n ? chunksUsed - n : 0;
+    bytesStored = bytesStored >= bytes ? bytesStored - bytes : 0;
+    taskEXIT_CRITICAL(&slabMux);
+}
+
+uint8_t* ptr(uint16_t handle) {
+    if (!pool || handle >= poolChunks) return nullptr;
+    return pool + (size_t)handle * kChunkBytes;
+}
+
+Stats getStats() {
+    Stats s = {};
+    taskENTER_CRITICAL(&slabMux);
+    s.chunksUsed = chunksUsed;
+    s.chunksTotal = poolChunks;
+    s.highWater = highWater;
+    s.allocFails = allocFails;
+    s.bytesStored = bytesStored;
+    uint16_t run = 0;
+    for (uint16_t i = 0; i < poolChunks; i++) {
+        if (isUsed(i)) {
+            run = 0;
+        } else if (++run > s.largestFree) {
+            s.largestFree = run;
+        }
+    }
+    taskEXIT_CRITICAL(&slabMux);
+    return s;
+}
+
+}  // namespace EapolSlab
@@ -0,0 +1,48 @@
+// EapolSlab - Fixed chunk pool for captured EAPOL frame bytes
+// One contiguous block carved into 32-byte chunks and tracked by a bitmap.
+// Handshake frames keep a 2-byte handle instead of 812 bytes of inline
+// buffers, so a typical 4-way handshake drops from ~3.3KB to ~700 bytes.
+// alloc()/release() never touch the heap and are safe from the WiFi
+// callback; begin()/end() allocate/free the block and are main-loop only.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace EapolSlab {
+
+static constexpr uint16_t kChunkBytes = 32;
+static constexpr uint16_t kChunks = 1024;               // 32KB pool
+static constexpr uint16_t kNone = 0xFFFF;
+
+struct Stats {
+    uint16_t chunksUsed;
+    uint16_t chunksTotal;
+    uint16_t highWater;      // Peak chunksUsed since begin()
+    uint16_t largestFree;    // Longest free run (chunks)
+    uint32_t allocFails;     // Since begin()
+    uint32_t bytesStored;    // Requested bytes, before chunk rounding
+};
+
+// Allocate a pool of chunks (<= kChunks) if none is present. An existing
+// pool is kept as-is. Returns false on OOM.
+bool begin(uint16_t chunks = kChunks);
+// Free the pool, but only once nothing is stored in it.
+void end();
+bool isReady();
+
+inline uint16_t chunksFor(uint16_t bytes) {
+    return (uint16_t)((bytes + kChunkBytes - 1) / kChunkBytes);
+}
+
+// First-fit contiguous run for bytes. Returns kNone when the pool is
+// missing, full or too fragmented.
+uint16_t alloc(uint16_t bytes);
+// bytes must match the alloc() size for this handle
+void release(uint16_t handle, uint16_t bytes);
+
+uint8_t* ptr(uint16_t handle);
+
+Stats getStats();
+
+}  // namespace EapolSlab
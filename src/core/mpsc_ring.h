@@ -0,0 +1,95 @@
+// MpscRing - Bounded multi-producer / single-consumer ring
+// Fixed-size, no locks. Any task may push; exactly one consumer pops at a
+// time (callers serialize consumers themselves). Per-slot sequence numbers
+// let producers claim a slot with one CAS and publish it without blocking
+// each other. Not for use from ISRs.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+template <typename T, uint16_t N>
+class MpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "MpscRing size must be a power of two");
+
+public:
+    static constexpr uint16_t kCapacity = N;
+
+    MpscRing() { reset(); }
+
+    // Producer side. Returns false (and counts a drop) when the ring is full.
+    bool push(const T& item) {
+        uint32_t pos = head_.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots_[pos & (N - 1)];
+            uint32_t seq = slot->seq.load(std::memory_order_acquire);
+            int32_t dif = (int32_t)(seq - pos);
+            if (dif == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (dif < 0) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+        slot->item = item;
+        slot->seq.store(pos + 1, std::memory_order_release);
+        pushed_.fetch_add(1, std::memory_order_relaxed);
+
+        uint32_t used = pos + 1 - tail_.load(std::memory_order_relaxed);
+        uint16_t hw = highWater_.load(std::memory_order_relaxed);
+        if (used > hw && used <= N) highWater_.store((uint16_t)used, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Consumer side. False when empty or the next slot is still being written.
+    bool pop(T& out) {
+        uint32_t pos = tail_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[pos & (N - 1)];
+        if (slot.seq.load(std::memory_order_acquire) != pos + 1) return false;
+        out = slot.item;
+        slot.seq.store(pos + N, std::memory_order_release);
+        tail_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate while producers are active
+    uint16_t size() const {
+        uint32_t used = head_.load(std::memory_order_acquire) -
+                        tail_.load(std::memory_order_acquire);
+        return used > N ? N : (uint16_t)used;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    // Counters (relaxed - diagnostics only)
+    uint32_t pushed() const { return pushed_.load(std::memory_order_relaxed); }
+    uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+    uint16_t highWater() const { return highWater_.load(std::memory_order_relaxed); }
+
+    // Only safe while no producer or consumer is running
+    void reset() {
+        for (uint32_t i = 0; i < N; i++) slots_[i].seq.store(i, std::memory_order_relaxed);
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+        pushed_.store(0, std::memory_order_relaxed);
+        dropped_.store(0, std::memory_order_relaxed);
+        highWater_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> seq;   // == pos: free for producer pos; == pos + 1: ready for consumer
+        T item;
+    };
+
+    Slot slots_[N];
+    // Free-running 32-bit positions; wraparound is handled by signed differences
+    std::atomic<uint32_t> head_{0};
+    std::atomic<uint32_t> tail_{0};
+    std::atomic<uint32_t> pushed_{0};
+    std::atomic<uint32_t> dropped_{0};
+    std::atomic<uint16_t> highWater_{0};
+};
@@ -8,6 +8,9 @@
 #include "wifi_utils.h"
 #include "heap_gates.h"
 #include "heap_policy.h"
+#include "bssid_index.h"
+#include "spsc_ring.h"
+#include "path_timing.h"
 #include <WiFi.h>
 #include <esp_wifi.h>
 #include <esp_heap_caps.h>
@@ -69,12 +72,88 @@ static const uint32_t BEACON_INTERVAL_MAX_MS = 5000;
 
 static portMUX_TYPE vectorMux = portMUX_INITIALIZER_UNLOCKED;
 
+// Seqlock over the network table: odd while a vectorMux holder may be writing.
+// Lets main-loop readers copy entries without blocking the WiFi task.
+static std::atomic<uint32_t> writeSeq{0};
+static uint8_t writeDepth = 0;  // Guarded by vectorMux (critical sections nest)
+
+// Bumped whenever table contents change (recon writers + markChanged())
+static std::atomic<uint32_t> tableVersion{0};
+
+// Snapshot copy attempts before falling back to a locked copy
+static const uint8_t SNAPSHOT_RETRIES = 4;
+
+static inline void beginWriteInternal() {
+    taskENTER_CRITICAL(&vectorMux);
+    if (writeDepth++ == 0) {
+        writeSeq.fetch_add(1, std::memory_order_acq_rel);
+    }
+}
+
+static inline void endWriteInternal(bool changed) {
+    if (changed) {
+        tableVersion.fetch_add(1, std::memory_order_release);
+    }
+    if (--writeDepth == 0) {
+        writeSeq.fetch_add(1, std::memory_order_release);
+    }
+    taskEXIT_CRITICAL(&vectorMux);
+}
+
 // ============================================================================
 // Shared Data
 // ============================================================================
 
 static std::vector<DetectedNetwork> networks;
 
+// Layout budget for the reserved MAX_RECON_NETWORKS table (see oink.h)
+static_assert(sizeof(DetectedNetwork) <= 88, "DetectedNetwork grew - keep cold fields packed");
+static_assert(offsetof(DetectedNetwork, ssid) == 48,
+              "computeRetentionScore fields left the hot prefix");
+
+// BSSID -> index lookup, kept in step with networks under vectorMux.
+// Self-heals on size mismatch; external reorders must call invalidateIndex().
+static BssidIndex networkIndex;
+static size_t indexedCount = 0;
+static std::atomic<bool> indexDirty{true};
+
+// ============================================================================
+// Frame Summary Ring (WiFi task -> main loop)
+// ============================================================================
+
+// Callback only decodes and pushes; update() applies under one lock per batch
+enum class FrameKind : uint8_t {
+    Beacon,
+    ProbeResponse,
+    SsidReveal,     // (Re)assoc request naming a possibly hidden network
+    Data
+};
+
+static const uint8_t FRAME_FLAG_HIDDEN = 0x01;
+static const uint8_t FRAME_FLAG_PMF_REQUIRED = 0x02;
+static const uint8_t FRAME_FLAG_NAMED = 0x04;
+
+struct FrameEvent {
+    uint32_t timestamp;     // millis() at capture, keeps beacon interval EMA honest
+    FrameKind kind;
+    uint8_t bssid[6];
+    int8_t rssi;
+    uint8_t channel;        // Beacon/probe resp: DS Parameter Set, else the channel tuned at capture
+    uint8_t flags;          // FRAME_FLAG_*
+    uint8_t clientBit;      // Data: clientHashIndex() of the station MAC
+    uint8_t authmode;       // wifi_auth_mode_t
+    char ssid[33];
+};
+static_assert(sizeof(FrameEvent) == 52, "FrameEvent grew; recheck the ring's BSS budget");
+
+// 64 x 52B = 3.3KB BSS plus the 416B drain batch. Twice the depth a busy
+// channel reaches across one slow UI frame (replay high water: 29).
+static const uint16_t FRAME_RING_SLOTS = 64;
+static const uint8_t FRAME_DRAIN_BATCH = 8;
+static SpscRing<FrameEvent, FRAME_RING_SLOTS> frameRing;
+static uint32_t framesDrained = 0;
+static uint32_t pendingAddDrops = 0;
+
 // ============================================================================
 // Deferred Event Processing (avoid allocations in callback)
 // ============================================================================
@@ -101,6 +180,10 @@ static std::atomic<uint8_t> pendingSsidWrite{0};
 static std::atomic<PacketCallback> modeCallback{nullptr};
 static NewNetworkCallback newNetworkCallback = nullptr;
 
+// Decoded summary of the frame currently being dispatched (WiFi task only)
+static BeaconView::Summary frameSummary;
+static bool frameSummaryValid = false;
+
 // ============================================================================
 // Internal Functions
 // ============================================================================
@@ -113,8 +196,37 @@ static void hopChannel() {
     esp_wifi_set_channel(currentChannel, WIFI_SECOND_CHAN_NONE);
 }
 
+static inline uint64_t networkKeyAt(uint16_t idx) {
+    return bssidToKey(networks[idx].bssid);
+}
+
+// Caller must hold vectorMux
+static void rebuildIndexInternal() {
+    networkIndex.rebuild((uint16_t)networks.size(), networkKeyAt);
+    indexedCount = networks.size();
+    indexDirty.store(false, std::memory_order_relaxed);
+}
+
+// Caller must hold vectorMux. Index the entry just appended at networks.back().
+static void indexAppendedInternal() {
+    if (indexDirty.load(std::memory_order_relaxed) || indexedCount + 1 != networks.size()) {
+        rebuildIndexInternal();
+        return;
+    }
+    uint16_t idx = (uint16_t)(networks.size() - 1);
+    networkIndex.insert(networkKeyAt(idx), idx);
+    indexedCount = networks.size();
+}
+
 static int findNetworkInternal(const uint8_t* bssid) {
-    for (size_t i = 0; i < networks.size(); i++) {
+    if (indexDirty.load(std::memory_order_relaxed) || indexedCount != networks.size()) {
+        rebuildIndexInternal();
+    }
+    int idx = networkIndex.find(bssidToKey(bssid), networkKeyAt);
+    if (idx >= 0) return idx;
+
+    // Only reached if an external injector pushed past the index capacity
+    for (size_t i = networkIndex.size(); i < networks.size(); i++) {
         if (memcmp(networks[i].bssid, bssid, 6) == 0) {
             return (int)i;
         }
@@ -133,6 +245,8 @@ static bool enqueuePendingNetwork(const DetectedNetwork& net) {
     uint8_t next = (uint8_t)((write + 1) % PENDING_NET_SLOTS);
     uint8_t read = pendingNetRead.load(std::memory_order_acquire);
     if (next == read) {
+        pendingAddDrops++;
+        PathTiming::countDrop(PathTiming::Drop::ReconPendingNetworks);
         return false;  // Queue full, drop
     }
     pendingNetworks[write] = net;
@@ -174,28 +288,6 @@ static bool applyPendingSsid(DetectedNetwork& net) {
     return false;
 }
 
-static void revealSsidIfKnown(const uint8_t* bssid, const char* ssid) {
-    if (!bssid || !ssid || ssid[0] == 0) return;
-
-    // Try to apply to existing network first
-    taskENTER_CRITICAL(&vectorMux);
-    int idx = findNetworkInternal(bssid);
-    if (idx >= 0 && idx < (int)networks.size()) {
-        if (networks[idx].ssid[0] == 0 || networks[idx].isHidden) {
-            strncpy(networks[idx].ssid, ssid, 32);
-            networks[idx].ssid[32] = 0;
-            networks[idx].isHidden = false;
-            networks[idx].lastSeen = millis();
-        }
-        taskEXIT_CRITICAL(&vectorMux);
-        return;
-    }
-    taskEXIT_CRITICAL(&vectorMux);
-
-    // Otherwise, store for when the network is added
-    storePendingSsid(bssid, ssid);
-}
-
 static inline uint8_t clientHashIndex(const uint8_t* mac) {
     uint32_t h = 2166136261u;  // FNV-1a
     for (int i = 0; i < 6; i++) {
@@ -240,321 +332,219 @@ static int computeRetentionScore(const DetectedNetwork& net, uint32_t now) {
     return score;
 }
 
-// PMF detection result - we need both bits to distinguish WPA3 from WPA2/WPA3 mixed
-// jader242 i know you reading dis. pig knows.
-struct PmfResult {
-    bool capable;   // MFPC (bit 6) - PMF capable (WPA2/WPA3 transitional sets this)
-    bool required;  // MFPR (bit 7) - PMF required (pure WPA3 sets both)
-};
-
-static PmfResult detectPMF(const uint8_t* payload, uint16_t len) {
-    PmfResult result = {false, false};
-    uint16_t offset = 36;
-    while (offset + 2 < len) {
-        uint8_t id = payload[offset];
-        uint8_t ieLen = payload[offset + 1];
-
-        if (offset + 2 + ieLen > len) break;
-
-        if (id == 0x30 && ieLen >= 8) {  // RSN IE
-            uint16_t rsnOffset = offset + 2;
-            uint16_t rsnEnd = rsnOffset + ieLen;
-            uint16_t version = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            if (version != 1) {
-                offset += 2 + ieLen;
-                continue;
-            }
-
-            // Walk the RSN IE properly - no shortcuts, no assumptions
-            rsnOffset += 6;  // Skip version(2) + group cipher(4)
-            if (rsnOffset + 2 > rsnEnd) break;
-
-            uint16_t pairwiseCount = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            rsnOffset += 2 + (pairwiseCount * 4);
-            if (rsnOffset + 2 > rsnEnd) break;
+// Caller must hold vectorMux (drain context only - pending queues are main-loop owned)
+static bool pendingNetworkQueued(const uint8_t* bssid) {
+    uint8_t read = pendingNetRead.load(std::memory_order_relaxed);
+    uint8_t write = pendingNetWrite.load(std::memory_order_relaxed);
+    for (uint8_t i = read; i != write; i = (uint8_t)((i + 1) % PENDING_NET_SLOTS)) {
+        if (memcmp(pendingNetworks[i].bssid, bssid, 6) == 0) return true;
+    }
+    return false;
+}
 
-            uint16_t akmCount = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            rsnOffset += 2 + (akmCount * 4);
-            if (rsnOffset + 2 > rsnEnd) break;
+// Caller must hold vectorMux. Returns true if the table changed.
+static bool revealSsidIfKnown(const uint8_t* bssid, const char* ssid, uint32_t now) {
+    if (!bssid || !ssid || ssid[0] == 0) return false;
 
-            // RSN Capabilities - IEEE 802.11-2016 Table 9-133
-            // Bit 6: MFPC (Management Frame Protection Capable)
-            // Bit 7: MFPR (Management Frame Protection Required)
-            uint16_t caps = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            result.capable  = (caps >> 6) & 0x01;  // MFPC
-            result.required = (caps >> 7) & 0x01;  // MFPR
-            break;
+    // Try to apply to existing network first
+    int idx = findNetworkInternal(bssid);
+    if (idx >= 0 && idx < (int)networks.size()) {
+        if (networks[idx].ssid[0] == 0 || networks[idx].isHidden) {
+            strncpy(networks[idx].ssid, ssid, 32);
+            networks[idx].ssid[32] = 0;
+            networks[idx].isHidden = false;
+            networks[idx].lastSeen = now;
+            return true;
         }
-
-        offset += 2 + ieLen;
+        return false;
     }
-    return result;
+
+    // Otherwise, store for when the network is added
+    storePendingSsid(bssid, ssid);
+    return false;
 }
 
-static void processBeacon(const uint8_t* payload, uint16_t len, int8_t rssi) {
-    if (len < 36) return;
-    
-    const uint8_t* bssid = payload + 16;
-    PmfResult pmf = detectPMF(payload, len);
-    uint32_t now = millis();
-    
-    // [BUG1 FIX] Lookup under spinlock - vector can be modified by cleanupStaleNetworks()
-    taskENTER_CRITICAL(&vectorMux);
-    int idx = findNetworkInternal(bssid);
-    taskEXIT_CRITICAL(&vectorMux);
+// Caller must hold vectorMux. Returns true if the table changed.
+static bool applyBeacon(const FrameEvent& ev) {
+    int idx = findNetworkInternal(ev.bssid);
     
     if (idx < 0) {
-        // New network - queue for deferred add
+        // New network - queue for deferred add (once per BSSID)
+        if (pendingNetworkQueued(ev.bssid)) return false;
+
         DetectedNetwork net = {0};
-        memcpy(net.bssid, bssid, 6);
-        net.rssi = rssi;
-        net.rssiAvg = rssi;
-        net.channel = currentChannel;
-        net.authmode = WIFI_AUTH_OPEN;
-        net.firstSeen = now;
-        net.lastSeen = now;
-        net.lastBeaconSeen = now;
+        memcpy(net.bssid, ev.bssid, 6);
+        net.rssi = ev.rssi;
+        net.rssiAvg = ev.rssi;
+        net.channel = ev.channel;
+        net.authmode = (wifi_auth_mode_t)ev.authmode;  // RSN/WPA/PMF classified by BeaconView
+        net.lastSeen = ev.timestamp;
+        net.lastBeaconSeen = ev.timestamp;
         net.beaconCount = 1;
         net.beaconIntervalEmaMs = 0;
         net.isTarget = false;
-        net.hasPMF = pmf.required;
+        net.hasPMF = (ev.flags & FRAME_FLAG_PMF_REQUIRED) != 0;
         net.hasHandshake = false;
         net.attackAttempts = 0;
-        net.isHidden = false;
+        net.isHidden = (ev.flags & FRAME_FLAG_HIDDEN) != 0;
         net.lastDataSeen = 0;
         net.cooldownUntil = 0;
         net.clientBitset = 0;
         net.clientBitsetHigh = 0;
-
-        // Parse SSID from IE
-        uint16_t offset = 36;
-        while (offset + 2 < len) {
-            uint8_t id = payload[offset];
-            uint8_t ieLen = payload[offset + 1];
-            
-            if (offset + 2 + ieLen > len) break;
-            
-            if (id == 0) {
-                if (ieLen > 0 && ieLen <= 32) {
-                    memcpy(net.ssid, payload + offset + 2, ieLen);
-                    net.ssid[ieLen] = 0;
-                    
-                    // Check for all-null SSID (hidden)
-                    bool allNull = true;
-                    for (uint8_t i = 0; i < ieLen; i++) {
-                        if (net.ssid[i] != 0) { allNull = false; break; }
-                    }
-                    if (allNull) {
-                        net.isHidden = true;
-                    }
-                } else if (ieLen == 0) {
-                    net.isHidden = true;
-                }
-                break;
-            }
-            
-            offset += 2 + ieLen;
+        if (!net.isHidden) {
+            memcpy(net.ssid, ev.ssid, sizeof(net.ssid));
         }
         
-        // Get channel from DS Parameter Set IE
-        offset = 36;
-        while (offset + 2 < len) {
-            uint8_t id = payload[offset];
-            uint8_t ieLen = payload[offset + 1];
-            
-            if (id == 3 && ieLen == 1) {
-                net.channel = payload[offset + 2];
-                break;
-            }
-            
-            offset += 2 + ieLen;
-        }
-        
-        // Parse auth mode from RSN (0x30) and WPA vendor (0xDD) IEs
-        // RSN + MFPR        = pure WPA3 (PMF required, no fallback)
-        // RSN + MFPC only   = WPA2/WPA3 transitional (PMF capable, clients choose)
-        // RSN alone          = WPA2
-        // WPA vendor alone   = WPA1
-        // RSN + WPA vendor   = WPA1/WPA2 mixed
-        bool hasRSN = false;
-        offset = 36;
-        while (offset + 2 < len) {
-            uint8_t id = payload[offset];
-            uint8_t ieLen = payload[offset + 1];
-
-            if (offset + 2 + ieLen > len) break;
-
-            if (id == 0x30 && ieLen >= 2) {  // RSN IE
-                hasRSN = true;
-                net.authmode = WIFI_AUTH_WPA2_PSK;
-            } else if (id == 0xDD && ieLen >= 8) {  // Vendor specific
-                if (payload[offset + 2] == 0x00 && payload[offset + 3] == 0x50 &&
-                    payload[offset + 4] == 0xF2 && payload[offset + 5] == 0x01) {
-                    if (!hasRSN) {
-                        net.authmode = WIFI_AUTH_WPA_PSK;
-                    } else {
-                        net.authmode = WIFI_AUTH_WPA_WPA2_PSK;
-                    }
-                }
-            }
-
-            offset += 2 + ieLen;
-        }
-
-        // Apply PMF classification on top of RSN detection
-        if (hasRSN && net.authmode == WIFI_AUTH_WPA2_PSK) {
-            if (pmf.required) {
-                net.authmode = WIFI_AUTH_WPA3_PSK;         // MFPR=1: pure WPA3-SAE
-            } else if (pmf.capable) {
-                net.authmode = WIFI_AUTH_WPA2_WPA3_PSK;    // MFPC=1 only: transitional
-            }
-        }
-        
-        if (net.channel == 0) {
-            net.channel = currentChannel;
-        }
-        
-        // Queue for deferred add
         enqueuePendingNetwork(net);
-    } else {
-        // Update existing network
-        taskENTER_CRITICAL(&vectorMux);
-        if (idx >= 0 && idx < (int)networks.size()) {
-            DetectedNetwork& net = networks[idx];
-            net.rssi = rssi;
-            net.rssiAvg = updateRssiAvg(net.rssiAvg, rssi);
-            net.lastSeen = now;
-            net.beaconCount++;
-            if (net.lastBeaconSeen > 0) {
-                uint32_t delta = now - net.lastBeaconSeen;
-                if (delta > 0 && delta < BEACON_INTERVAL_MAX_MS) {
-                    if (net.beaconIntervalEmaMs == 0) {
-                        net.beaconIntervalEmaMs = (uint16_t)delta;
-                    } else {
-                        uint32_t blended = (uint32_t)net.beaconIntervalEmaMs * 7 + delta;
-                        net.beaconIntervalEmaMs = (uint16_t)(blended / 8);
-                    }
-                }
+        return false;
+    }
+
+    // Update existing network
+    DetectedNetwork& net = networks[idx];
+    net.rssi = ev.rssi;
+    net.rssiAvg = updateRssiAvg(net.rssiAvg, ev.rssi);
+    net.lastSeen = ev.timestamp;
+    net.beaconCount++;
+    if (net.lastBeaconSeen > 0) {
+        uint32_t delta = ev.timestamp - net.lastBeaconSeen;
+        if (delta > 0 && delta < BEACON_INTERVAL_MAX_MS) {
+            if (net.beaconIntervalEmaMs == 0) {
+                net.beaconIntervalEmaMs = (uint16_t)delta;
+            } else {
+                uint32_t blended = (uint32_t)net.beaconIntervalEmaMs * 7 + delta;
+                net.beaconIntervalEmaMs = (uint16_t)(blended / 8);
             }
-            net.lastBeaconSeen = now;
-            net.hasPMF |= pmf.required;
         }
-        taskEXIT_CRITICAL(&vectorMux);
     }
+    net.lastBeaconSeen = ev.timestamp;
+    net.hasPMF |= (ev.flags & FRAME_FLAG_PMF_REQUIRED) != 0;
+    return true;
 }
 
-static void processProbeResponse(const uint8_t* payload, uint16_t len, int8_t rssi) {
-    if (len < 36) return;
-    
-    const uint8_t* bssid = payload + 16;
-    uint32_t now = millis();
+// Caller must hold vectorMux. Returns true if the table changed.
+static bool applyProbeResponse(const FrameEvent& ev) {
+    // Probe responses can reveal hidden SSIDs
+    bool hasName = (ev.flags & FRAME_FLAG_NAMED) != 0;
 
-    // Parse SSID from IE (probe responses can reveal hidden SSIDs)
-    char ssidBuf[33] = {0};
-    bool ssidFound = false;
-    bool ssidAllNull = true;
-    uint16_t offset = 36;
-    while (offset + 2 < len) {
-        uint8_t id = payload[offset];
-        uint8_t ieLen = payload[offset + 1];
-        
-        if (offset + 2 + ieLen > len) break;
-        
-        if (id == 0 && ieLen > 0 && ieLen <= 32) {
-            memcpy(ssidBuf, payload + offset + 2, ieLen);
-            ssidBuf[ieLen] = 0;
-            ssidFound = true;
-            
-            for (uint8_t i = 0; i < ieLen; i++) {
-                if (ssidBuf[i] != 0) { ssidAllNull = false; break; }
-            }
-            break;
-        }
-        
-        offset += 2 + ieLen;
-    }
-    
-    // [BUG5 FIX] Do lookup inside critical section to prevent TOCTOU race
-    // cleanupStaleNetworks() can modify vector between lookup and use
-    taskENTER_CRITICAL(&vectorMux);
-    int idx = findNetworkInternal(bssid);
-    
+    int idx = findNetworkInternal(ev.bssid);
     if (idx < 0) {
-        taskEXIT_CRITICAL(&vectorMux);
-        if (ssidFound && !ssidAllNull) {
-            revealSsidIfKnown(bssid, ssidBuf);
+        if (hasName) {
+            // Unknown BSSID: only stashes the name for a later add
+            revealSsidIfKnown(ev.bssid, ev.ssid, ev.timestamp);
         }
-        return;
+        return false;
     }
     
-    // idx is valid and we hold the lock - safe to use
-    if ((networks[idx].ssid[0] == 0 || networks[idx].isHidden) && ssidFound && !ssidAllNull) {
-        memcpy(networks[idx].ssid, ssidBuf, 33);
+    if ((networks[idx].ssid[0] == 0 || networks[idx].isHidden) && hasName) {
+        memcpy(networks[idx].ssid, ev.ssid, 33);
         networks[idx].isHidden = false;
     }
     
-    networks[idx].rssi = rssi;
-    networks[idx].rssiAvg = updateRssiAvg(networks[idx].rssiAvg, rssi);
-    networks[idx].lastSeen = now;
-    taskEXIT_CRITICAL(&vectorMux);
+    networks[idx].rssi = ev.rssi;
+    networks[idx].rssiAvg = updateRssiAvg(networks[idx].rssiAvg, ev.rssi);
+    networks[idx].lastSeen = ev.timestamp;
+    return true;
 }
 
-static void processAssocRequest(const uint8_t* payload, uint16_t len, bool isReassoc) {
-    if (len < 36) return;
-    
-    const uint8_t* bssid = payload + 16;
-    uint16_t fixedLen = isReassoc ? 10 : 4;
-    uint16_t offset = 24 + fixedLen;
-    if (offset + 2 > len) return;
-    
-    // Parse SSID IE from tagged parameters
-    char ssidBuf[33] = {0};
-    bool ssidFound = false;
-    bool ssidAllNull = true;
-    while (offset + 2 < len) {
-        uint8_t id = payload[offset];
-        uint8_t ieLen = payload[offset + 1];
-        if (offset + 2 + ieLen > len) break;
-        
-        if (id == 0 && ieLen > 0 && ieLen <= 32) {
-            memcpy(ssidBuf, payload + offset + 2, ieLen);
-            ssidBuf[ieLen] = 0;
-            ssidFound = true;
-            for (uint8_t i = 0; i < ieLen; i++) {
-                if (ssidBuf[i] != 0) { ssidAllNull = false; break; }
-            }
-            break;
-        }
-        offset += 2 + ieLen;
-    }
-    
-    if (ssidFound && !ssidAllNull) {
-        revealSsidIfKnown(bssid, ssidBuf);
+// Caller must hold vectorMux. Returns true if the table changed.
+static bool applyDataActivity(const FrameEvent& ev) {
+    int idx = findNetworkInternal(ev.bssid);
+    if (idx < 0 || idx >= (int)networks.size()) return false;
+
+    DetectedNetwork& net = networks[idx];
+    net.lastDataSeen = ev.timestamp;
+    if (ev.clientBit < 64) {
+        net.clientBitset |= (1ULL << ev.clientBit);
+    } else {
+        net.clientBitsetHigh |= (1ULL << (ev.clientBit - 64));
     }
+    return true;
 }
 
-static void markDataActivity(const uint8_t* bssid, const uint8_t* clientMac) {
-    taskENTER_CRITICAL(&vectorMux);
-
-    int idx = findNetworkInternal(bssid);
-    if (idx >= 0 && idx < (int)networks.size()) {
-        DetectedNetwork& net = networks[idx];
-        net.lastDataSeen = millis();
-        if (clientMac) {
-            uint8_t bit = clientHashIndex(clientMac);
-            if (bit < 64) {
-                net.clientBitset |= (1ULL << bit);
-            } else {
-                net.clientBitsetHigh |= (1ULL << (bit - 64));
+static void drainFrameRing() {
+    static FrameEvent batch[FRAME_DRAIN_BATCH];
+    // Bounded so a flooded channel cannot starve the rest of update()
+    uint16_t budget = FRAME_RING_SLOTS;
+
+    while (budget > 0) {
+        uint16_t want = budget < FRAME_DRAIN_BATCH ? budget : FRAME_DRAIN_BATCH;
+        uint16_t n = frameRing.popBatch(batch, want);
+        if (n == 0) break;
+        budget -= n;
+        framesDrained += n;
+
+        // One lock per batch instead of one or two per frame
+        bool changed = false;
+        beginWriteInternal();
+        for (uint16_t i = 0; i < n; i++) {
+            const FrameEvent& ev = batch[i];
+            switch (ev.kind) {
+                case FrameKind::Beacon:
+                    changed |= applyBeacon(ev);
+                    break;
+                case FrameKind::ProbeResponse:
+                    changed |= applyProbeResponse(ev);
+                    break;
+                case FrameKind::SsidReveal:
+                    changed |= revealSsidIfKnown(ev.bssid, ev.ssid, ev.timestamp);
+                    break;
+                case FrameKind::Data:
+                    changed |= applyDataActivity(ev);
+                    break;
             }
         }
+        endWriteInternal(changed);
     }
+}
 
-    taskEXIT_CRITICAL(&vectorMux);
+// ----------------------------------------------------------------------------
+// Producers (WiFi task) - decode only, never touch networks or vectorMux
+// ----------------------------------------------------------------------------
+
+static void produceBeaconEvent(FrameKind kind, const BeaconView::Summary& frame,
+                               int8_t rssi, uint32_t now) {
+    FrameEvent ev;
+    ev.kind = kind;
+    memcpy(ev.bssid, frame.bssid, 6);
+    ev.rssi = rssi;
+    // No DS Parameter Set: the channel we are on now, not at drain time
+    // (recon may have hopped by then)
+    ev.channel = frame.dsChannel ? frame.dsChannel : currentChannel;
+    ev.flags = 0;
+    if (frame.isHidden) ev.flags |= FRAME_FLAG_HIDDEN;
+    if (frame.pmfRequired) ev.flags |= FRAME_FLAG_PMF_REQUIRED;
+    if (frame.hasNamedSsid()) ev.flags |= FRAME_FLAG_NAMED;
+    ev.clientBit = 0;
+    ev.authmode = frame.authmode;
+    ev.timestamp = now;
+    memcpy(ev.ssid, frame.ssid, sizeof(ev.ssid));
+    frameRing.push(ev);
+}
+
+static void processAssocRequest(const uint8_t* payload, uint16_t len, bool isReassoc, uint32_t now) {
+    if (len < 36) return;
+    
+    const uint8_t* bssid = payload + 16;
+    uint16_t ieOffset = isReassoc ? BeaconView::kReassocReqIeOffset : BeaconView::kAssocReqIeOffset;
+    
+    // Parse SSID IE from tagged parameters
+    FrameEvent ev;
+    bool ssidAllNull = true;
+    if (!BeaconView::findSsid(payload, len, ieOffset, ev.ssid, ssidAllNull) || ssidAllNull) {
+        return;
+    }
+    ev.kind = FrameKind::SsidReveal;
+    memcpy(ev.bssid, bssid, 6);
+    ev.rssi = 0;
+    ev.channel = 0;
+    ev.flags = FRAME_FLAG_NAMED;
+    ev.clientBit = 0;
+    ev.authmode = WIFI_AUTH_OPEN;
+    ev.timestamp = now;
+    frameRing.push(ev);
 }
 
-static void processDataFrame(const uint8_t* payload, uint16_t len, int8_t rssi) {
-    (void)rssi;
+static void processDataFrame(const uint8_t* payload, uint16_t len, uint32_t now) {
     if (len < 28) return;
     
     uint8_t toDs = (payload[1] & 0x01);
@@ -571,11 +561,20 @@ static void processDataFrame(const uint8_t* payload, uint16_t len, int8_t rssi)
         clientMac = payload + 10;
     }
     
-    if (bssid && clientMac) {
-        if ((clientMac[0] & 0x01) == 0) {
-            markDataActivity(bssid, clientMac);
-        }
-    }
+    if (!bssid || !clientMac) return;
+    if ((clientMac[0] & 0x01) != 0) return;  // Multicast/broadcast station
+
+    FrameEvent ev;
+    ev.kind = FrameKind::Data;
+    memcpy(ev.bssid, bssid, 6);
+    ev.rssi = 0;
+    ev.channel = 0;
+    ev.flags = 0;
+    ev.clientBit = clientHashIndex(clientMac);
+    ev.authmode = WIFI_AUTH_OPEN;
+    ev.timestamp = now;
+    ev.ssid[0] = 0;
+    frameRing.push(ev);
 }
 
 static void promiscuousCallback(void* buf, wifi_promiscuous_pkt_type_t type) {
@@ -601,34 +600,47 @@ static void promiscuousCallback(void* buf, wifi_promiscuous_pkt_type_t type) {
     
     const uint8_t* payload = pkt->payload;
     uint8_t frameSubtype = (payload[0] >> 4) & 0x0F;
+    uint32_t now = millis();
+    uint32_t t0 = PathTiming::now();
     
-    // Basic network tracking (always happens)
+    // Basic network tracking - decode and queue only, update() applies
     switch (type) {
         case WIFI_PKT_MGMT:
-            if (frameSubtype == 0x08) {  // Beacon
-                processBeacon(payload, len, rssi);
-            } else if (frameSubtype == 0x05) {  // Probe Response
-                processProbeResponse(payload, len, rssi);
+            if (frameSubtype == 0x08 || frameSubtype == 0x05) {  // Beacon / Probe Response
+                // Single IE walk - mode callbacks reuse this via getFrameSummary()
+                if (BeaconView::parse(payload, len, frameSummary)) {
+                    frameSummaryValid = true;
+                    produceBeaconEvent(frameSubtype == 0x08 ? FrameKind::Beacon
+                                                            : FrameKind::ProbeResponse,
+                                       frameSummary, rssi, now);
+                }
             } else if (frameSubtype == 0x00) {  // Assoc Request
-                processAssocRequest(payload, len, false);
+                processAssocRequest(payload, len, false, now);
             } else if (frameSubtype == 0x02) {  // Reassoc Request
-                processAssocRequest(payload, len, true);
+                processAssocRequest(payload, len, true, now);
             }
             break;
             
         case WIFI_PKT_DATA:
-            processDataFrame(payload, len, rssi);
+            processDataFrame(payload, len, now);
             break;
             
         default:
             break;
     }
+    // Recon's own share only - the mode callback below times itself
+    if (type == WIFI_PKT_MGMT) {
+        PathTiming::record(PathTiming::Path::ReconMgmt, PathTiming::now() - t0);
+    } else if (type == WIFI_PKT_DATA) {
+        PathTiming::record(PathTiming::Path::ReconData, PathTiming::now() - t0);
+    }
     
     // Mode-specific callback (for EAPOL capture, PCAP logging, etc.)
     PacketCallback cb = modeCallback.load(std::memory_order_relaxed);
     if (cb) {
         cb(pkt, type);
     }
+    frameSummaryValid = false;
 }
 
 static void processDeferredEvents() {
@@ -646,10 +658,21 @@ static void processDeferredEvents() {
 
         bool inserted = false;
         bool replaced = false;
+
+        // An earlier queued beacon for the same BSSID may already have been added
+        taskENTER_CRITICAL(&vectorMux);
+        bool duplicate = findNetworkInternal(pending.bssid) >= 0;
+        taskEXIT_CRITICAL(&vectorMux);
+        if (duplicate) {
+            processed++;
+            continue;
+        }
+
         if (hasCapacity) {
-            taskENTER_CRITICAL(&vectorMux);
+            beginWriteInternal();
             networks.push_back(pending);  // Safe: capacity pre-reserved at init
-            taskEXIT_CRITICAL(&vectorMux);
+            indexAppendedInternal();
+            endWriteInternal(true);
             inserted = true;
         } else {
             // Vector is full - evict a low-value entry if the new one is better
@@ -658,7 +681,7 @@ static void processDeferredEvents() {
             int worstScore = 100000;
             int worstIdx = -1;
             
-            taskENTER_CRITICAL(&vectorMux);
+            beginWriteInternal();
             for (size_t i = 0; i < networks.size(); i++) {
                 if (networks[i].isTarget) continue;
                 int score = computeRetentionScore(networks[i], now);
@@ -668,10 +691,13 @@ static void processDeferredEvents() {
                 }
             }
             if (worstIdx >= 0 && pendingScore > worstScore) {
+                // Drop the evicted key before overwriting - erase reads it back
+                networkIndex.erase(networkKeyAt((uint16_t)worstIdx), networkKeyAt);
                 networks[worstIdx] = pending;
+                networkIndex.insert(networkKeyAt((uint16_t)worstIdx), (uint16_t)worstIdx);
                 replaced = true;
             }
-            taskEXIT_CRITICAL(&vectorMux);
+            endWriteInternal(replaced);
         }
         
         if (inserted || replaced) {
@@ -698,7 +724,8 @@ static void cleanupStaleNetworks() {
     // [BUG6 FIX] Single critical section for collect + erase
     // Previously had gap between collect and erase where vector could change
     // erase() doesn't allocate - just shifts elements and decrements size - safe in spinlock
-    taskENTER_CRITICAL(&vectorMux);
+    beginWriteInternal();
+    bool changed = false;
     
     // Collect stale indices (static to avoid stack/heap allocation)
     static size_t staleIndices[50];
@@ -706,9 +733,11 @@ static void cleanupStaleNetworks() {
 
     for (size_t i = 0; i < networks.size() && staleCount < 50; i++) {
         if (networks[i].lastDataSeen > 0 &&
-            now - networks[i].lastDataSeen > CLIENT_BITMAP_RESET_MS) {
+            now - networks[i].lastDataSeen > CLIENT_BITMAP_RESET_MS &&
+            (networks[i].clientBitset | networks[i].clientBitsetHigh) != 0) {
             networks[i].clientBitset = 0;
             networks[i].clientBitsetHigh = 0;
+            changed = true;
         }
         int8_t rssi = (networks[i].rssiAvg != 0) ? networks[i].rssiAvg : networks[i].rssi;
         uint32_t timeout = STALE_TIMEOUT_MS;  // 60s default (strong signal)
@@ -725,7 +754,13 @@ static void cleanupStaleNetworks() {
         networks.erase(networks.begin() + staleIndices[i]);
     }
     
-    taskEXIT_CRITICAL(&vectorMux);
+    // Erase shifted every later entry down - positions in the index are stale
+    if (staleCount > 0) {
+        rebuildIndexInternal();
+        changed = true;
+    }
+    
+    endWriteInternal(changed);
 }
 
 // ============================================================================
@@ -739,6 +774,9 @@ void init() {
     
     networks.clear();
     networks.reserve(MAX_RECON_NETWORKS);  // Full upfront reserve — eliminates growth reallocations
+    networkIndex.clear();
+    indexedCount = 0;
+    indexDirty.store(false, std::memory_order_relaxed);
     
     packetCount.store(0, std::memory_order_relaxed);
     currentChannel = 1;
@@ -755,6 +793,9 @@ void init() {
     for (uint8_t i = 0; i < PENDING_SSID_SLOTS; i++) {
         pendingSsids[i].ready.store(false, std::memory_order_relaxed);
     }
+    frameRing.reset();  // Callback not registered yet
+    framesDrained = 0;
+    pendingAddDrops = 0;
     modeCallback.store(nullptr, std::memory_order_relaxed);
     heapStabilized = false;
     
@@ -789,6 +830,9 @@ void start() {
     for (uint8_t i = 0; i < PENDING_SSID_SLOTS; i++) {
         pendingSsids[i].ready.store(false, std::memory_order_relaxed);
     }
+    frameRing.reset();  // Callback not registered yet
+    framesDrained = 0;
+    pendingAddDrops = 0;
     
     // Handle BLE coexistence
     if (NimBLEDevice::isInitialized()) {
@@ -859,10 +903,12 @@ void stop() {
 }
 
 void freeNetworks() {
-    taskENTER_CRITICAL(&vectorMux);
+    beginWriteInternal();
     networks.clear();
     networks.shrink_to_fit();
-    taskEXIT_CRITICAL(&vectorMux);
+    networkIndex.clear();
+    indexedCount = 0;
+    endWriteInternal(true);
     Serial.println("[RECON] Networks vector freed");
 }
 
@@ -922,7 +968,8 @@ void update() {
     
     uint32_t now = millis();
     
-    // Process deferred events from callback
+    // Apply queued frame summaries, then add any networks they discovered
+    drainFrameRing();
     processDeferredEvents();
     
     // Channel hopping
@@ -992,6 +1039,18 @@ uint32_t getPacketCount() {
     return packetCount.load(std::memory_order_relaxed);
 }
 
+FrameRingStats getFrameRingStats() {
+    FrameRingStats stats;
+    stats.queued = frameRing.pushed();
+    stats.dropped = frameRing.dropped();
+    stats.drained = framesDrained;
+    stats.pendingAddDrops = pendingAddDrops;
+    stats.depth = frameRing.size();
+    stats.highWater = frameRing.highWater();
+    stats.capacity = FRAME_RING_SLOTS;
+    return stats;
+}
+
 uint8_t estimateClientCount(const DetectedNetwork& net) {
     return (uint8_t)(__builtin_popcountll(net.clientBitset) +
                      __builtin_popcountll(net.clientBitsetHigh));
@@ -1068,6 +1127,124 @@ int findNetworkIndex(const uint8_t* bssid) {
     return idx;
 }
 
+int findNetworkIndexLocked(const uint8_t* bssid) {
+    return findNetworkInternal(bssid);
+}
+
+void invalidateIndex() {
+    indexDirty.store(true, std::memory_order_release);
+    markChanged();
+}
+
+void markChanged() {
+    tableVersion.fetch_add(1, std::memory_order_release);
+}
+
+uint32_t getVersion() {
+    return tableVersion.load(std::memory_order_acquire);
+}
+
+bool hasChangedSince(uint32_t version) {
+    return tableVersion.load(std::memory_order_acquire) != version;
+}
+
+// Copy [first, first + maxCount) without vectorMux; retry if a writer ran meanwhile.
+// Capacity is reserved up front, so data() stays put while readers copy.
+static uint16_t copyConsistent(uint16_t first, DetectedNetwork* out, uint16_t maxCount,
+                               uint32_t* versionOut) {
+    for (uint8_t attempt = 0; attempt < SNAPSHOT_RETRIES; attempt++) {
+        uint32_t seqBefore = writeSeq.load(std::memory_order_acquire);
+        if (seqBefore & 1) continue;  // Writer active (other core, or we hold the lock)
+
+        uint32_t version = tableVersion.load(std::memory_order_acquire);
+        size_t size = networks.size();
+        uint16_t n = 0;
+        if (first < size) {
+            size_t avail = size - first;
+            n = avail < maxCount ? (uint16_t)avail : maxCount;
+            memcpy(out, networks.data() + first, n * sizeof(DetectedNetwork));
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (writeSeq.load(std::memory_order_relaxed) == seqBefore) {
+            if (versionOut) *versionOut = version;
+            return n;
+        }
+    }
+
+    // Writer kept interleaving - take the lock for a short memcpy instead
+    taskENTER_CRITICAL(&vectorMux);
+    uint16_t n = 0;
+    if (first < networks.size()) {
+        size_t avail = networks.size() - first;
+        n = avail < maxCount ? (uint16_t)avail : maxCount;
+        memcpy(out, networks.data() + first, n * sizeof(DetectedNetwork));
+    }
+    if (versionOut) *versionOut = tableVersion.load(std::memory_order_relaxed);
+    taskEXIT_CRITICAL(&vectorMux);
+    return n;
+}
+
+uint16_t copySnapshot(DetectedNetwork* out, uint16_t maxCount, uint32_t* versionOut) {
+    if (!out || maxCount == 0) {
+        if (versionOut) *versionOut = getVersion();
+        return 0;
+    }
+    return copyConsistent(0, out, maxCount, versionOut);
+}
+
+uint32_t copySnapshot(std::vector<DetectedNetwork>& out) {
+    // Sized from capacity (stable), then trimmed - resize within reserve never allocates
+    size_t cap = networks.capacity();
+    if (cap > 0xFFFF) cap = 0xFFFF;
+    out.resize(cap);
+    uint32_t version = 0;
+    uint16_t n = copySnapshot(out.data(), (uint16_t)cap, &version);
+    out.resize(n);
+    return version;
+}
+
+bool readNetwork(uint16_t index, DetectedNetwork& out) {
+    return copyConsistent(index, &out, 1, nullptr) == 1;
+}
+
+bool applyOrder(std::vector<DetectedNetwork>& ordered, uint32_t snapshotVersion) {
+    // Entries changed or added since the snapshot are refreshed from the live
+    // table below; this needs one bit per live entry and spare capacity.
+    static uint32_t seen[(BssidIndex::kMaxEntries + 31) / 32];
+    if (ordered.capacity() < networks.capacity()) return false;
+
+    beginWriteInternal();
+    size_t live = networks.size();
+    if (live > BssidIndex::kMaxEntries || live > ordered.capacity()) {
+        endWriteInternal(false);
+        return false;
+    }
+
+    if (tableVersion.load(std::memory_order_relaxed) != snapshotVersion ||
+        ordered.size() != live) {
+        memset(seen, 0, sizeof(seen));
+        size_t w = 0;
+        for (size_t r = 0; r < ordered.size(); r++) {
+            int idx = findNetworkInternal(ordered[r].bssid);
+            if (idx < 0 || (seen[idx >> 5] & (1u << (idx & 31)))) continue;  // Gone since snapshot
+            seen[idx >> 5] |= 1u << (idx & 31);
+            ordered[w++] = networks[idx];
+        }
+        ordered.resize(w);
+        for (size_t i = 0; i < live; i++) {
+            if (!(seen[i >> 5] & (1u << (i & 31)))) {
+                ordered.push_back(networks[i]);  // Added since snapshot - keep at the end
+            }
+        }
+    }
+
+    // assign() within existing capacity copies in place - no allocation under the lock
+    networks.assign(ordered.begin(), ordered.end());
+    rebuildIndexInternal();
+    endWriteInternal(true);
+    return true;
+}
+
 void lockChannel(uint8_t channel) {
     if (channel < 1 || channel > 14) return;
 
@@ -1102,12 +1279,17 @@ void setNewNetworkCallback(NewNetworkCallback callback) {
     newNetworkCallback = callback;
 }
 
+const BeaconView::Summary* getFrameSummary() {
+    return frameSummaryValid ? &frameSummary : nullptr;
+}
+
 void enterCritical() {
-    taskENTER_CRITICAL(&vectorMux);
+    // Callers may write through getNetworks() - treat as a write for snapshot readers
+    beginWriteInternal();
 }
 
 void exitCritical() {
-    taskEXIT_CRITICAL(&vectorMux);
+    endWriteInternal(false);
 }
 
 } // namespace NetworkRecon
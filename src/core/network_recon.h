@@ -6,6 +6,7 @@
 #include <Arduino.h>
 #include <esp_wifi.h>
 #include <vector>
+#include "beacon_view.h"
 
 // Maximum networks to track
 #define MAX_RECON_NETWORKS 200
@@ -108,6 +109,23 @@ void clearHopIntervalOverride();
  */
 uint32_t getPacketCount();
 
+/**
+ * @brief Frame summary ring counters (WiFi callback -> update())
+ * The callback only decodes frames and queues fixed-size summaries;
+ * update() applies them to the network table in batches.
+ */
+struct FrameRingStats {
+    uint32_t queued;           // Summaries accepted by the ring
+    uint32_t dropped;          // Summaries lost because the ring was full
+    uint32_t drained;          // Summaries applied by update()
+    uint32_t pendingAddDrops;  // New networks lost because the add queue was full
+    uint16_t depth;            // Current ring occupancy
+    uint16_t highWater;        // Peak occupancy since start()
+    uint16_t capacity;
+};
+
+FrameRingStats getFrameRingStats();
+
 // ============================================================================
 // Quality + Client Estimates
 // ============================================================================
@@ -132,6 +150,8 @@ uint8_t getQualityScore(const DetectedNetwork& net);
  * @brief Get reference to shared networks vector
  * Thread-safe access via internal mutex
  * @warning Do not hold reference across yield() calls
+ * @warning Call invalidateIndex() after reordering entries in place
+ * @note Prefer copySnapshot()/readNetwork() for scans that do not write
  */
 std::vector<DetectedNetwork>& getNetworks();
 
@@ -151,10 +171,76 @@ bool findNetwork(const uint8_t* bssid, DetectedNetwork* out);
 
 /**
  * @brief Find network index by BSSID
+ * O(1) via the BSSID hash index (open addressing keyed by bssidToKey())
  * @return Index or -1 if not found
  */
 int findNetworkIndex(const uint8_t* bssid);
 
+/**
+ * @brief Same as findNetworkIndex() for callers already inside enterCritical()
+ */
+int findNetworkIndexLocked(const uint8_t* bssid);
+
+/**
+ * @brief Mark the BSSID index stale after reordering getNetworks() externally
+ * Size changes are detected automatically; same-size reorders (sort, swap) are not.
+ * Call while still holding the critical section used for the reorder.
+ */
+void invalidateIndex();
+
+// ============================================================================
+// Versioned Snapshots (lock-free reads)
+// ============================================================================
+
+/**
+ * @brief Table version - changes whenever network contents change
+ * Bumped by recon's own writers and by markChanged(). Compare with
+ * hasChangedSince() to skip re-sorting/re-scoring an unchanged table.
+ */
+uint32_t getVersion();
+
+/**
+ * @brief True if the table changed after the given getVersion()/snapshot version
+ */
+bool hasChangedSince(uint32_t version);
+
+/**
+ * @brief Record an external write made through getNetworks()
+ * Call inside enterCritical() after mutating entries (flags, push_back, erase).
+ */
+void markChanged();
+
+/**
+ * @brief Copy a consistent view of the table without holding the spinlock
+ * Seqlock read: retries if a writer interleaved, falls back to a short locked
+ * copy if it keeps losing. Main loop only (not from a PacketCallback).
+ * @param out Caller buffer for up to maxCount entries
+ * @param versionOut Optional out: version the copy corresponds to
+ * @return entries copied
+ */
+uint16_t copySnapshot(DetectedNetwork* out, uint16_t maxCount, uint32_t* versionOut = nullptr);
+
+/**
+ * @brief Same as above into a vector (resized to fit; reserve once to avoid allocs)
+ * @return version the copy corresponds to
+ */
+uint32_t copySnapshot(std::vector<DetectedNetwork>& out);
+
+/**
+ * @brief Copy one entry consistently without holding the spinlock
+ * @return false if index is out of range
+ */
+bool readNetwork(uint16_t index, DetectedNetwork& out);
+
+/**
+ * @brief Replace the table order with a reordered snapshot
+ * Entries updated since the snapshot keep their live data, removed ones are
+ * dropped and newly added ones are appended. Rebuilds the BSSID index.
+ * @param ordered Reordered copySnapshot() result; capacity must cover the table
+ * @return false if ordered lacks capacity (table left untouched)
+ */
+bool applyOrder(std::vector<DetectedNetwork>& ordered, uint32_t snapshotVersion);
+
 // ============================================================================
 // Channel Control
 // ============================================================================
@@ -199,6 +285,14 @@ using PacketCallback = void(*)(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuo
  */
 void setPacketCallback(PacketCallback callback);
 
+/**
+ * @brief Decoded beacon/probe response for the frame currently being dispatched
+ * Lets mode callbacks reuse NetworkRecon's single IE walk instead of re-parsing.
+ * @return Summary, or nullptr if recon did not decode this frame (non-beacon,
+ *         recon busy, malformed). Only valid inside a PacketCallback.
+ */
+const BeaconView::Summary* getFrameSummary();
+
 /**
  * @brief New network discovery callback type
  * Called from update() when a new network is added to the shared vector
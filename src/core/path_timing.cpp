@@ -0,0 +1,127 @@
+// PathTiming - Per-path latency histograms for the promiscuous callbacks
+
+#include "path_timing.h"
+#include <string.h>
+
+namespace PathTiming {
+
+namespace {
+
+struct PathStats {
+    volatile uint32_t count;
+    volatile uint32_t minTicks;
+    volatile uint32_t maxTicks;
+    volatile uint64_t sumTicks;
+    volatile uint32_t buckets[kBuckets];
+};
+
+PathStats stats[(uint8_t)Path::Count];
+volatile uint32_t drops[(uint8_t)Drop::Count];
+
+const char* const kPathNames[(uint8_t)Path::Count] = {
+    "RECON MGMT", "RECON DATA",
+    "OINK MGMT", "OINK DATA", "OINK EAPOL",
+    "DNH MGMT", "DNH DATA", "DNH EAPOL",
+    "SPEC MGMT", "SPEC DATA"
+};
+
+const char* const kDropNames[(uint8_t)Drop::Count] = {
+    "RECON PENDING NET",
+    "OINK PENDING HS", "OINK PENDING PMKID",
+    "DNH PENDING HS", "DNH PENDING PMKID", "DNH PENDING INCOMPLETE"
+};
+
+// Ticks per microsecond: CPU MHz on device, nanoseconds on host
+uint32_t ticksPerUs() {
+#ifdef ARDUINO
+    static uint32_t mhz = 0;
+    if (mhz == 0) mhz = ESP.getCpuFreqMHz();
+    return mhz ? mhz : 240;
+#else
+    return 1000;
+#endif
+}
+
+uint32_t ticksToNs(uint64_t ticks) {
+    uint64_t ns = ticks * 1000ULL / ticksPerUs();
+    return ns > UINT32_MAX ? UINT32_MAX : (uint32_t)ns;
+}
+
+}  // namespace
+
+void record(Path path, uint32_t ticks) {
+    uint8_t p = (uint8_t)path;
+    if (p >= (uint8_t)Path::Count) return;
+    PathStats& s = stats[p];
+    uint32_t n = s.count;
+    if (n == 0 || ticks < s.minTicks) s.minTicks = ticks;
+    if (ticks > s.maxTicks) s.maxTicks = ticks;
+    s.sumTicks = s.sumTicks + ticks;
+    uint8_t b = bucketFor(ticks);
+    s.buckets[b] = s.buckets[b] + 1;
+    s.count = n + 1;  // Last, so a reader never sees count ahead of the buckets
+}
+
+void countDrop(Drop drop) {
+    uint8_t d = (uint8_t)drop;
+    if (d < (uint8_t)Drop::Count) drops[d] = drops[d] + 1;
+}
+
+Summary summarize(Path path) {
+    Summary out = {};
+    uint8_t p = (uint8_t)path;
+    if (p >= (uint8_t)Path::Count) return out;
+    const PathStats& s = stats[p];
+    out.count = s.count;
+    if (out.count == 0) return out;
+
+    out.minNs = ticksToNs(s.minTicks);
+    out.maxNs = ticksToNs(s.maxTicks);
+    out.avgNs = ticksToNs(s.sumTicks / out.count);
+
+    // Walk buckets to the first one holding the 99th percentile sample
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < kBuckets; i++) total += s.buckets[i];
+    uint32_t target = total - total / 100;
+    uint32_t seen = 0;
+    out.p99Ns = out.maxNs;
+    for (uint8_t i = 0; i < kBuckets; i++) {
+        seen += s.buckets[i];
+        if (seen >= target && seen > 0) {
+            uint32_t upper = (i + 1 < kBuckets) ? bucketLower(i + 1) - 1 : UINT32_MAX;
+            uint32_t ns = ticksToNs(upper);
+            if (ns < out.p99Ns) out.p99Ns = ns;
+            break;
+        }
+    }
+    return out;
+}
+
+uint32_t getDrops(Drop drop) {
+    uint8_t d = (uint8_t)drop;
+    return d < (uint8_t)Drop::Count ? drops[d] : 0;
+}
+
+void getBuckets(Path path, uint32_t* out) {
+    uint8_t p = (uint8_t)path;
+    for (uint8_t i = 0; i < kBuckets; i++) {
+        out[i] = p < (uint8_t)Path::Count ? stats[p].buckets[i] : 0;
+    }
+}
+
+const char* pathName(Path path) {
+    uint8_t p = (uint8_t)path;
+    return p < (uint8_t)Path::Count ? kPathNames[p] : "?";
+}
+
+const char* dropName(Drop drop) {
+    uint8_t d = (uint8_t)drop;
+    return d < (uint8_t)Drop::Count ? kDropNames[d] : "?";
+}
+
+void reset() {
+    memset((void*)stats, 0, sizeof(stats));
+    memset((void*)drops, 0, sizeof(drops));
+}
+
+}  // namespace PathTiming
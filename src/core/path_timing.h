@@ -0,0 +1,102 @@
+// PathTiming - Per-path latency histograms for the promiscuous callbacks
+// Fixed half-octave buckets, no heap, no locks. CPU cycle counter on device,
+// steady_clock on host. record() runs on the WiFi task (single writer per
+// path); readers tolerate a torn sample - these numbers are diagnostics only.
+#pragma once
+
+#include <cstdint>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+namespace PathTiming {
+
+// EAPOL time is also counted in the enclosing DATA path
+enum class Path : uint8_t {
+    ReconMgmt = 0,
+    ReconData,
+    OinkMgmt,
+    OinkData,
+    OinkEapol,
+    DnhMgmt,
+    DnhData,
+    DnhEapol,
+    SpectrumMgmt,
+    SpectrumData,
+    Count
+};
+
+// Callback-side hand-off queues that drop when the main loop falls behind
+enum class Drop : uint8_t {
+    ReconPendingNetworks = 0,
+    OinkPendingHs,
+    OinkPendingPmkid,
+    DnhPendingHs,
+    DnhPendingPmkid,
+    DnhPendingIncomplete,
+    Count
+};
+
+// Bucket i covers [lower(i), lower(i+1)) ticks; two buckets per power of two
+static constexpr uint8_t kBuckets = 64;
+
+struct Summary {
+    uint32_t count;
+    uint32_t minNs;
+    uint32_t avgNs;
+    uint32_t p99Ns;   // Upper edge of the p99 bucket, clamped to maxNs
+    uint32_t maxNs;
+};
+
+#ifdef ARDUINO
+inline uint32_t now() { return ESP.getCycleCount(); }
+#else
+inline uint32_t now() {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+inline uint8_t bucketFor(uint32_t ticks) {
+    if (ticks < 2) return (uint8_t)ticks;
+    uint8_t msb = (uint8_t)(31 - __builtin_clz(ticks));
+    return (uint8_t)(msb * 2 + ((ticks >> (msb - 1)) & 1));
+}
+
+inline uint32_t bucketLower(uint8_t idx) {
+    if (idx < 2) return idx;
+    uint8_t msb = idx / 2;
+    return (1u << msb) | ((uint32_t)(idx & 1) << (msb - 1));
+}
+
+void record(Path path, uint32_t ticks);
+void countDrop(Drop drop);
+
+Summary summarize(Path path);
+uint32_t getDrops(Drop drop);
+// Raw bucket counts (out must hold kBuckets entries)
+void getBuckets(Path path, uint32_t* out);
+
+const char* pathName(Path path);
+const char* dropName(Drop drop);
+
+// Clears every path and drop counter. Racy against a live callback by design.
+void reset();
+
+// Times the enclosing block into one path
+class Scope {
+public:
+    explicit Scope(Path path) : path_(path), start_(now()) {}
+    ~Scope() { record(path_, now() - start_); }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    Path path_;
+    uint32_t start_;
+};
+
+}  // namespace PathTiming
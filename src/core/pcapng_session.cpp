@@ -0,0 +1,309 @@
+// PcapngSession - One append-only pcapng file per capture outing
+
+#include "pcapng_session.h"
+#include "sd_layout.h"
+#include <Arduino.h>
+#include <SD.h>
+#include <esp_heap_caps.h>
+#include <sys/time.h>
+#include <time.h>
+#include <string.h>
+
+namespace PcapngSession {
+
+namespace {
+
+static constexpr uint32_t kBlockSHB = 0x0A0D0D0A;
+static constexpr uint32_t kBlockIDB = 0x00000001;
+static constexpr uint32_t kBlockEPB = 0x00000006;
+static constexpr uint32_t kByteOrderMagic = 0x1A2B3C4D;
+static constexpr uint16_t kLinkRadiotap = 127;
+static constexpr uint16_t kOptEnd = 0;
+static constexpr uint16_t kOptComment = 1;
+static constexpr uint16_t kOptShbHardware = 2;
+static constexpr uint16_t kOptShbUserAppl = 4;
+static constexpr uint16_t kOptIfName = 2;
+static constexpr uint16_t kOptIfDescription = 3;
+static constexpr size_t kMaxCommentLen = 160;
+static constexpr time_t kMinValidEpoch = 1700000000;  // RTC/NTP/GPS has set the clock
+
+// Radiotap: bare 8-byte header, plus the dBm antenna signal byte when known
+static constexpr uint8_t kRadiotapLen = 8;
+
+uint8_t* buf = nullptr;
+size_t used = 0;
+File file;
+bool fileOpen = false;
+bool headerWritten = false;
+bool active = false;
+char tag[8] = {0};
+char filePath[96] = {0};
+uint32_t fileBytes = 0;
+uint32_t oldestMs = 0;        // millis() of the oldest unwritten byte
+uint32_t pendingPackets = 0;  // Packets with bytes still in RAM
+Stats stats = {};
+
+inline size_t pad4(size_t n) {
+    return (n + 3) & ~(size_t)3;
+}
+
+inline void put16(uint8_t* p, uint16_t v) { memcpy(p, &v, 2); }
+inline void put32(uint8_t* p, uint32_t v) { memcpy(p, &v, 4); }
+
+inline size_t optionBytes(size_t len) {
+    return 4 + pad4(len);
+}
+
+size_t putOption(uint8_t* p, uint16_t code, const void* data, size_t len) {
+    put16(p, code);
+    put16(p + 2, (uint16_t)len);
+    if (len) memcpy(p + 4, data, len);
+    size_t padded = pad4(len);
+    if (padded > len) memset(p + 4 + len, 0, padded - len);
+    return 4 + padded;
+}
+
+// Session header + single radiotap interface, emitted ahead of the first packet
+size_t encodeHeaders(uint8_t* out) {
+    static const char kHardware[] = "M5Cardputer ESP32-S3";
+    static const char kAppl[] = "M5PORKCHOP";
+    static const char kIfName[] = "wlan0";
+    char ifDesc[32];
+    snprintf(ifDesc, sizeof(ifDesc), "%s promiscuous", tag);
+
+    uint8_t* p = out;
+    size_t shbLen = 24 + optionBytes(strlen(kHardware)) + optionBytes(strlen(kAppl)) + 4 + 4;
+    put32(p, kBlockSHB);
+    put32(p + 4, (uint32_t)shbLen);
+    put32(p + 8, kByteOrderMagic);
+    put16(p + 12, 1);                 // Major
+    put16(p + 14, 0);                 // Minor
+    put32(p + 16, 0xFFFFFFFF);        // Section length unknown (64-bit -1)
+    put32(p + 20, 0xFFFFFFFF);
+    size_t o = 24;
+    o += putOption(p + o, kOptShbHardware, kHardware, strlen(kHardware));
+    o += putOption(p + o, kOptShbUserAppl, kAppl, strlen(kAppl));
+    o += putOption(p + o, kOptEnd, nullptr, 0);
+    put32(p + o, (uint32_t)shbLen);
+    p += shbLen;
+
+    size_t idbLen = 16 + optionBytes(strlen(kIfName)) + optionBytes(strlen(ifDesc)) + 4 + 4;
+    put32(p, kBlockIDB);
+    put32(p + 4, (uint32_t)idbLen);
+    put16(p + 8, kLinkRadiotap);
+    put16(p + 10, 0);                 // Reserved
+    put32(p + 12, 65535);             // Snaplen
+    o = 16;
+    o += putOption(p + o, kOptIfName, kIfName, strlen(kIfName));
+    o += putOption(p + o, kOptIfDescription, ifDesc, strlen(ifDesc));
+    o += putOption(p + o, kOptEnd, nullptr, 0);
+    put32(p + o, (uint32_t)idbLen);
+    p += idbLen;
+
+    return (size_t)(p - out);
+}
+
+// Microseconds since epoch when the clock is valid, uptime otherwise
+uint64_t timestampUs(uint32_t tsMs) {
+    uint32_t ageMs = millis() - tsMs;
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    if (tv.tv_sec >= kMinValidEpoch) {
+        uint64_t nowUs = (uint64_t)tv.tv_sec * 1000000ULL + (uint64_t)tv.tv_usec;
+        return nowUs - (uint64_t)ageMs * 1000ULL;
+    }
+    return (uint64_t)tsMs * 1000ULL;
+}
+
+bool openFile() {
+    if (fileOpen) return true;
+    const char* dir = SDLayout::handshakesDir();
+    if (!SD.exists(dir) && !SD.mkdir(dir)) return false;
+
+    char stamp[32];  // "YYYYMMDD_HHMMSS" or "boot" + 64-bit seconds
+    time_t now = time(nullptr);
+    if (now >= kMinValidEpoch) {
+        strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", localtime(&now));
+    } else {
+        snprintf(stamp, sizeof(stamp), "boot%lu", (unsigned long)(millis() / 1000));
+    }
+    snprintf(filePath, sizeof(filePath), "%s/session_%s_%s.pcapng", dir, stamp, tag);
+    for (uint8_t n = 2; SD.exists(filePath) && n < 100; n++) {
+        snprintf(filePath, sizeof(filePath), "%s/session_%s_%s_%u.pcapng", dir, stamp, tag, n);
+    }
+
+    file = SD.open(filePath, FILE_WRITE);
+    if (!file) {
+        filePath[0] = 0;
+        return false;
+    }
+    fileOpen = true;
+    fileBytes = 0;
+    Serial.printf("[PCAPNG] Session file: %s\n", filePath);
+    return true;
+}
+
+// Write the first n buffered bytes; on failure the whole buffer is dropped.
+// Blocks straddle writes, so once a write fails after data reached the file
+// its last block is torn and readers stop there: close it and carry on in a
+// new file (fresh headers) rather than append behind the tear.
+bool writeOut(size_t n) {
+    if (n == 0) return true;
+    bool ok = openFile();
+    if (ok) {
+        size_t wrote = file.write(buf, n);
+        stats.writes++;
+        stats.bytesWritten += wrote;
+        fileBytes += wrote;
+        ok = (wrote == n);
+    }
+    if (!ok) {
+        stats.dropped += pendingPackets;
+        pendingPackets = 0;
+        used = 0;
+        headerWritten = false;  // Lost with the block, or due in the next file
+        if (fileOpen && fileBytes > 0) {
+            Serial.printf("[PCAPNG] Write failed at %lu bytes, closing %s\n",
+                          (unsigned long)fileBytes, filePath);
+            file.close();
+            fileOpen = false;
+        }
+        return false;
+    }
+    memmove(buf, buf + n, used - n);
+    used -= n;
+    if (used == 0) pendingPackets = 0;
+    oldestMs = millis();
+    return true;
+}
+
+// Buffer full: write up to the last sector boundary of the file and keep the
+// tail, so these writes cover whole sectors. flush() (time budget, end())
+// writes the tail too; the next write here realigns.
+bool writeAligned() {
+    uint32_t end = (uint32_t)((fileBytes + used) / kSectorBytes * kSectorBytes);
+    if (end <= fileBytes) return true;
+    return writeOut(end - fileBytes);
+}
+
+}  // namespace
+
+bool begin(const char* modeTag) {
+    if (active) return true;
+    buf = (uint8_t*)heap_caps_malloc(kBufferBytes, MALLOC_CAP_8BIT);
+    if (!buf) return false;
+    strncpy(tag, modeTag ? modeTag : "cap", sizeof(tag) - 1);
+    tag[sizeof(tag) - 1] = 0;
+    used = 0;
+    fileOpen = false;
+    headerWritten = false;
+    filePath[0] = 0;
+    fileBytes = 0;
+    pendingPackets = 0;
+    oldestMs = millis();
+    stats = {};
+    active = true;
+    return true;
+}
+
+void end() {
+    if (!active) return;
+    flush();
+    if (fileOpen) {
+        file.close();
+        fileOpen = false;
+        Serial.printf("[PCAPNG] Session closed: %lu packets, %lu bytes in %lu writes\n",
+                      (unsigned long)stats.packets, (unsigned long)stats.bytesWritten,
+                      (unsigned long)stats.writes);
+    }
+    heap_caps_free(buf);
+    buf = nullptr;
+    used = 0;
+    active = false;
+}
+
+bool isActive() {
+    return active;
+}
+
+bool appendFrame(const uint8_t* frame, uint16_t len, uint32_t tsMs,
+                 int8_t rssi, const char* comment) {
+    if (!active || !frame || len == 0) return false;
+
+    size_t commentLen = comment ? strnlen(comment, kMaxCommentLen) : 0;
+    uint8_t rtLen = kRadiotapLen + (rssi != 0 ? 1 : 0);
+    uint32_t capLen = rtLen + len;
+    size_t recLen = 28 + pad4(capLen) + (commentLen ? optionBytes(commentLen) + 4 : 0) + 4;
+    size_t hdrLen = headerWritten ? 0 : 256;  // Upper bound for SHB + IDB
+
+    if (used + hdrLen + recLen > kBufferBytes) writeAligned();
+    if (used + hdrLen + recLen > kBufferBytes) writeOut(used);
+    if (hdrLen + recLen > kBufferBytes - used) {
+        stats.dropped++;
+        return false;
+    }
+
+    if (used == 0) oldestMs = millis();
+    if (!headerWritten) {
+        used += encodeHeaders(buf + used);
+        headerWritten = true;
+    }
+
+    uint8_t* p = buf + used;
+    uint64_t ts = timestampUs(tsMs);
+    put32(p, kBlockEPB);
+    put32(p + 4, (uint32_t)recLen);
+    put32(p + 8, 0);                          // Interface 0
+    put32(p + 12, (uint32_t)(ts >> 32));
+    put32(p + 16, (uint32_t)ts);
+    put32(p + 20, capLen);
+    put32(p + 24, capLen);
+
+    uint8_t* rt = p + 28;
+    rt[0] = 0x00;                             // Revision
+    rt[1] = 0x00;                             // Pad
+    put16(rt + 2, rtLen);
+    put32(rt + 4, rssi != 0 ? 0x00000020 : 0);  // Present: dBm antenna signal
+    if (rssi != 0) rt[8] = (uint8_t)rssi;
+    memcpy(rt + rtLen, frame, len);
+    size_t o = 28 + capLen;
+    size_t padded = 28 + pad4(capLen);
+    if (padded > o) memset(p + o, 0, padded - o);
+    o = padded;
+
+    if (commentLen) {
+        o += putOption(p + o, kOptComment, comment, commentLen);
+        o += putOption(p + o, kOptEnd, nullptr, 0);
+    }
+    put32(p + o, (uint32_t)recLen);
+
+    used += recLen;
+    pendingPackets++;
+    stats.packets++;
+    return true;
+}
+
+bool flushDue() {
+    if (!active || used == 0) return false;
+    return used >= kFlushBytes || (millis() - oldestMs) >= kFlushIntervalMs;
+}
+
+bool flush() {
+    if (!active) return false;
+    if (used == 0) return true;
+    bool ok = writeOut(used);
+    if (ok) file.flush();
+    return ok;
+}
+
+const char* path() {
+    return filePath;
+}
+
+Stats getStats() {
+    Stats s = stats;
+    s.buffered = (uint16_t)used;
+    return s;
+}
+
+}  // namespace PcapngSession
@@ -0,0 +1,52 @@
+// PcapngSession - One append-only pcapng file per capture outing
+// Frames are encoded into a RAM block and reach the SD card in few large
+// writes (whole sectors when the block fills, the remainder on the flush
+// budget), so a session costs one open/close instead of one per handshake.
+// A failed write closes the file; the session carries on in a new one.
+// Every call here may touch the SD card: use it from the mode's SD window
+// (NetworkRecon paused), never from the promiscuous callback.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace PcapngSession {
+
+static constexpr size_t kBufferBytes = 4096;          // 8 sectors
+static constexpr size_t kSectorBytes = 512;
+static constexpr size_t kFlushBytes = 2048;           // Size budget
+static constexpr uint32_t kFlushIntervalMs = 15000;   // Time budget
+
+struct Stats {
+    uint32_t packets;
+    uint32_t bytesWritten;   // Bytes handed to the SD card
+    uint32_t writes;         // SD write calls
+    uint32_t dropped;        // Packets lost to OOM or SD errors
+    uint16_t buffered;       // Bytes waiting in RAM
+};
+
+// Start a session for one mode ("oink", "dnh"). Allocates the block buffer;
+// the file itself is created on the first flush so empty outings leave no
+// trace. No-op if a session is already open.
+bool begin(const char* modeTag);
+// Flush everything and close the file. Safe to call when not started.
+void end();
+bool isActive();
+
+// Append one 802.11 frame as an Enhanced Packet Block. tsMs is millis() at
+// capture; it is shifted to wall-clock time when the RTC is set. rssi 0
+// means unknown and is left out of the radiotap header. comment
+// (optional) becomes opt_comment, e.g. "M2 rssi=-61 gps=...".
+bool appendFrame(const uint8_t* frame, uint16_t len, uint32_t tsMs,
+                 int8_t rssi, const char* comment);
+
+// True when buffered data exceeds the size budget or has aged past the
+// time budget. Callers pause recon and call flush().
+bool flushDue();
+bool flush();
+
+// Current file path ("" until the first flush)
+const char* path();
+Stats getStats();
+
+}  // namespace PcapngSession
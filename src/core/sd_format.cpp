@@ -84,6 +84,12 @@ bool wipePorkchopLayout() {
     return true;
 }
 
+void reportProgress(SDFormat::ProgressCallback cb, const char* stage, uint8_t percent) {
+    if (cb) {
+        cb(stage, percent);
+    }
+}
+
 #if SD_FORMAT_HAS_FF
 constexpr uint64_t kGiB = 1024ULL * 1024 * 1024;
 constexpr uint64_t kMaxFormatBytes = 32ULL * kGiB; // Cardputer docs prefer FAT32 <= 32GB
@@ -115,12 +121,6 @@ enum class RawInitStatus : uint8_t {
     WRITE_PROTECT
 };
 
-void reportProgress(SDFormat::ProgressCallback cb, const char* stage, uint8_t percent) {
-    if (cb) {
-        cb(stage, percent);
-    }
-}
-
 RawInitStatus initRawDisk(uint8_t& pdrv) {
     const uint32_t speeds[] = {
         25000000,
@@ -393,6 +393,7 @@ Result formatCard(FormatMode mode, bool allowFallback, ProgressCallback cb) {
     bool logWasEnabled = SDLog::isEnabled();
     SDLog::close();
     SDLog::setEnabled(false);
+    SDLog::suspend();   // Flush task stays off the card until resume()
 
 #if SD_FORMAT_HAS_FF
     SD.end();
@@ -400,10 +401,12 @@ Result formatCard(FormatMode mode, bool allowFallback, ProgressCallback cb) {
     uint8_t pdrv = 0xFF;
     RawInitStatus rawInit = initRawDisk(pdrv);
     if (rawInit == RawInitStatus::WRITE_PROTECT) {
+        SDLog::resume();
         SDLog::setEnabled(logWasEnabled);
         return makeResult(false, false, "WRITE PROTECT");
     }
     if (rawInit != RawInitStatus::OK) {
+        SDLog::resume();
         SDLog::setEnabled(logWasEnabled);
         return makeResult(false, false, "NO SD CARD");
     }
@@ -411,6 +414,7 @@ Result formatCard(FormatMode mode, bool allowFallback, ProgressCallback cb) {
     DiskGeometry geo{};
     if (!getDiskGeometry(pdrv, geo)) {
         sdcard_uninit(pdrv);
+        SDLog::resume();
         SDLog::setEnabled(logWasEnabled);
         return makeResult(false, false, "GEOMETRY FAIL");
     }
@@ -419,6 +423,7 @@ Result formatCard(FormatMode mode, bool allowFallback, ProgressCallback cb) {
         reportProgress(cb, "ERASING", 0);
         if (!fullErase(pdrv, geo, cb)) {
             sdcard_uninit(pdrv);
+            SDLog::resume();
             SDLog::setEnabled(logWasEnabled);
             return makeResult(false, false, "ERASE FAIL");
         }
@@ -429,9 +434,11 @@ Result formatCard(FormatMode mode, bool allowFallback, ProgressCallback cb) {
         sdcard_uninit(pdrv);
         if (allowFallback && Config::reinitSD() && wipePorkchopLayout()) {
             reportProgress(cb, "WIPE", 100);
+            SDLog::resume();
             SDLog::setEnabled(logWasEnabled);
             return makeResult(true, true, "WIPE OK");
         }
+        SDLog::resume();
         SDLog::setEnabled(logWasEnabled);
         return makeResult(false, allowFallback, "FORMAT FAIL");
     }
@@ -440,6 +447,7 @@ Result formatCard(FormatMode mode, bool allowFallback, ProgressCallback cb) {
 
     // Remount with retry and exponential backoff
     if (!remountWithRetry()) {
+        SDLog::resume();
         SDLog::setEnabled(logWasEnabled);
         return makeResult(false, false, "REMOUNT FAIL");
     }
@@ -447,6 +455,7 @@ Result formatCard(FormatMode mode, bool allowFallback, ProgressCallback cb) {
     SDLayout::setUseNewLayout(true);
     SDLayout::ensureDirs();
     reportProgress(cb, "FORMAT", 100);
+    SDLog::resume();
     SDLog::setEnabled(logWasEnabled);
     return makeResult(true, false, mode == FormatMode::FULL ? "FULL OK" : "FORMAT OK");
 #endif
@@ -454,10 +463,13 @@ Result formatCard(FormatMode mode, bool allowFallback, ProgressCallback cb) {
     // Fallback path when FATFS not available
     if (allowFallback && Config::isSDAvailable() && wipePorkchopLayout()) {
         reportProgress(cb, "WIPE", 100);
+        SDLog::resume();
         SDLog::setEnabled(logWasEnabled);
         return makeResult(true, true, "WIPE OK");
     }
 
+    SDLog::resume();
+
     SDLog::setEnabled(logWasEnabled);
     return makeResult(false, allowFallback, "FORMAT FAIL");
 }
@@ -0,0 +1,106 @@
+// SDJournal - Write-behind block buffer for append-only text logs
+
+#include "sd_journal.h"
+#include <Arduino.h>
+#include <SD.h>
+#include <esp_heap_caps.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+// SD can be busy with other operations; same budget as the old per-row opens
+static const int SD_RETRY_COUNT = 3;
+static const int SD_RETRY_DELAY_MS = 10;
+
+bool SDJournal::begin(const char* path) {
+    if (buf_) return true;
+    if (!path || !path[0]) return false;
+    buf_ = (char*)heap_caps_malloc(kBlockBytes, MALLOC_CAP_8BIT);
+    if (!buf_) return false;
+    strncpy(path_, path, sizeof(path_) - 1);
+    path_[sizeof(path_) - 1] = '\0';
+    used_ = 0;
+    fileBytes_ = 0;
+    pendingRows_ = 0;
+    oldestMs_ = millis();
+    stats_ = {};
+    return true;
+}
+
+void SDJournal::end() {
+    if (!buf_) return;
+    flush();
+    heap_caps_free(buf_);
+    buf_ = nullptr;
+    used_ = 0;
+}
+
+bool SDJournal::appendf(const char* fmt, ...) {
+    if (!buf_) return false;
+
+    for (int attempt = 0; attempt < 2; attempt++) {
+        size_t room = kBlockBytes - used_;
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vsnprintf(buf_ + used_, room, fmt, ap);
+        va_end(ap);
+        if (n < 0) break;
+        if ((size_t)n < room) {
+            if (used_ == 0) oldestMs_ = millis();
+            used_ += (size_t)n;
+            pendingRows_++;
+            stats_.rows++;
+            return true;
+        }
+        // Row did not fit: write the block out (emptied even on failure)
+        // and format again at the start
+        if (used_ == 0) break;
+        flush();
+    }
+
+    stats_.droppedRows++;
+    return false;
+}
+
+bool SDJournal::flushDue() const {
+    if (!buf_ || used_ == 0) return false;
+    return used_ >= kFlushBytes || (millis() - oldestMs_) >= kFlushIntervalMs;
+}
+
+bool SDJournal::flush() {
+    if (!buf_) return false;
+    if (used_ == 0) return true;
+
+    File f;
+    for (int retry = 0; retry < SD_RETRY_COUNT; retry++) {
+        f = SD.open(path_, FILE_APPEND);
+        if (f) break;
+        delay(SD_RETRY_DELAY_MS);
+    }
+
+    bool ok = false;
+    if (f) {
+        size_t wrote = f.write((const uint8_t*)buf_, used_);
+        f.close();  // Commits data and directory entry
+        stats_.writes++;
+        stats_.bytesWritten += wrote;
+        fileBytes_ += wrote;
+        ok = (wrote == used_);
+    }
+    if (!ok) {
+        Serial.printf("[JOURNAL] Write failed, %lu rows lost: %s\n",
+                      (unsigned long)pendingRows_, path_);
+        stats_.droppedRows += pendingRows_;
+    }
+
+    used_ = 0;
+    pendingRows_ = 0;
+    oldestMs_ = millis();
+    return ok;
+}
+
+SDJournal::Stats SDJournal::getStats() const {
+    Stats s = stats_;
+    s.buffered = (uint16_t)used_;
+    return s;
+}
@@ -0,0 +1,59 @@
+// SDJournal - Write-behind block buffer for append-only text logs
+// Rows are formatted straight into a fixed RAM block and reach the SD card
+// as one open/write/close per block instead of one per row. Every flush
+// closes the file, so what has been flushed survives a crash or power cut;
+// at most one block (or kFlushIntervalMs of rows) is at risk.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class SDJournal {
+public:
+    static constexpr size_t kBlockBytes = 2048;
+    static constexpr size_t kFlushBytes = 1536;          // Size budget
+    static constexpr uint32_t kFlushIntervalMs = 15000;  // Time budget
+
+    struct Stats {
+        uint32_t rows;
+        uint32_t bytesWritten;   // Bytes handed to the SD card
+        uint32_t writes;         // SD open/write/close cycles
+        uint32_t droppedRows;    // Rows lost to SD errors or oversize
+        uint16_t buffered;       // Bytes waiting in RAM
+    };
+
+    SDJournal() = default;
+    ~SDJournal() { end(); }
+    SDJournal(const SDJournal&) = delete;
+    SDJournal& operator=(const SDJournal&) = delete;
+
+    // Allocate the block and target path. The file is created (appended to)
+    // on the first flush. Re-targets after end(); no-op while open.
+    bool begin(const char* path);
+    // Flush and free the block. Safe to call when not started.
+    void end();
+    bool isOpen() const { return buf_ != nullptr; }
+    const char* path() const { return path_; }
+
+    // printf-style row, formatted in place. Flushes the block first when
+    // the row does not fit. Returns false if the row was dropped.
+    bool appendf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+    // True when buffered data exceeds the size budget or has aged past the
+    // time budget
+    bool flushDue() const;
+    bool flush();
+
+    // Bytes journaled since begin(): on the card plus still in RAM
+    uint32_t size() const { return fileBytes_ + (uint32_t)used_; }
+    Stats getStats() const;
+
+private:
+    char* buf_ = nullptr;
+    size_t used_ = 0;
+    uint32_t fileBytes_ = 0;
+    uint32_t oldestMs_ = 0;       // millis() of the oldest unwritten row
+    uint32_t pendingRows_ = 0;    // Rows with bytes still in RAM
+    char path_[128] = {0};
+    Stats stats_ = {};
+};
@@ -47,6 +47,11 @@ static constexpr const char* kLegacyHeapWatermarks = "/heap_wm.bin";
 static constexpr const char* kLegacyWpasecKey = "/wpasec_key.txt";
 static constexpr const char* kLegacyWigleKey = "/wigle_key.txt";
 static constexpr const char* kLegacyConfigBin = "/porkchop.dat";
+static constexpr const char* kLegacyCaptureIndex = "/captures.idx";
+static constexpr const char* kLegacyXpLedgerWpa = "/xp_awarded_wpa.idx";
+static constexpr const char* kLegacyXpLedgerWigle = "/xp_awarded_wigle.idx";
+static constexpr const char* kLegacyCrackedIndex = "/wpasec_results.idx";
+static constexpr const char* kLegacyPotfileState = "/wpasec_potfile.state";
 
 static constexpr const char* kNewConfigPath = "/m5porkchop/config/porkchop.conf";
 static constexpr const char* kNewPersonalityPath = "/m5porkchop/config/personality.json";
@@ -64,6 +69,11 @@ static constexpr const char* kNewHeapWatermarks = "/m5porkchop/diagnostics/heap_
 static constexpr const char* kNewWpasecKey = "/m5porkchop/wpa-sec/wpasec_key.txt";
 static constexpr const char* kNewWigleKey = "/m5porkchop/wigle/wigle_key.txt";
 static constexpr const char* kNewConfigBin = "/m5porkchop/config/porkchop.dat";
+static constexpr const char* kNewCaptureIndex = "/m5porkchop/meta/captures.idx";
+static constexpr const char* kNewXpLedgerWpa = "/m5porkchop/meta/xp_awarded_wpa.idx";
+static constexpr const char* kNewXpLedgerWigle = "/m5porkchop/meta/xp_awarded_wigle.idx";
+static constexpr const char* kNewCrackedIndex = "/m5porkchop/meta/wpasec_results.idx";
+static constexpr const char* kNewPotfileState = "/m5porkchop/meta/wpasec_potfile.state";
 
 // Use mutex to protect shared state
 static portMUX_TYPE layoutMutex = portMUX_INITIALIZER_UNLOCKED;
@@ -464,6 +474,11 @@ const char* heapLogPath() { return usingNewLayout() ? kNewHeapLog : kLegacyHeapL
 const char* heapWatermarksPath() { return usingNewLayout() ? kNewHeapWatermarks : kLegacyHeapWatermarks; }
 const char* wpasecKeyPath() { return usingNewLayout() ? kNewWpasecKey : kLegacyWpasecKey; }
 const char* wigleKeyPath() { return usingNewLayout() ? kNewWigleKey : kLegacyWigleKey; }
+const char* captureIndexPath() { return usingNewLayout() ? kNewCaptureIndex : kLegacyCaptureIndex; }
+const char* xpLedgerWpaPath() { return usingNewLayout() ? kNewXpLedgerWpa : kLegacyXpLedgerWpa; }
+const char* xpLedgerWiglePath() { return usingNewLayout() ? kNewXpLedgerWigle : kLegacyXpLedgerWigle; }
+const char* crackedIndexPath() { return usingNewLayout() ? kNewCrackedIndex : kLegacyCrackedIndex; }
+const char* potfileStatePath() { return usingNewLayout() ? kNewPotfileState : kLegacyPotfileState; }
 
 const char* legacyConfigPath() { return kLegacyConfig; }
 const char* legacyPersonalityPath() { return kLegacyPersonality; }
@@ -43,6 +43,11 @@ namespace SDLayout {
     const char* heapWatermarksPath();
     const char* wpasecKeyPath();
     const char* wigleKeyPath();
+    const char* captureIndexPath();
+    const char* xpLedgerWpaPath();      // Rebuilt from xpAwardedWpaPath()
+    const char* xpLedgerWiglePath();    // Rebuilt from xpAwardedWiglePath()
+    const char* crackedIndexPath();     // Rebuilt from wpasecResultsPath()
+    const char* potfileStatePath();     // Delta cursor for wpasecResultsPath()
 
     // Legacy paths (explicit, for fallback imports)
     const char* legacyConfigPath();
@@ -3,10 +3,191 @@
 #include "sdlog.h"
 #include "config.h"
 #include "sd_layout.h"
+#include "mpsc_ring.h"
 #include <SD.h>
 #include <stdarg.h>
+#include <new>
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#ifdef ARDUINO
+#include <esp_system.h>
+#endif
+
+namespace {
+
+static constexpr uint16_t kRingSlots = 32;
+static constexpr size_t kLineBytes = 222;           // Slot payload incl. '\n'
+static constexpr size_t kBatchBytes = 1024;         // One SD write per batch
+static constexpr uint32_t kDrainIntervalMs = 500;   // Flush task wakeup
+static constexpr uint32_t kSyncIntervalMs = 2000;   // FAT sync (dir entry + size)
+static constexpr uint32_t kFlushWaitMs = 200;       // flush()/close() lock wait
+static constexpr uint32_t kShutdownFlushMs = 100;
+
+enum LineKind : uint8_t {
+    LINE_TEXT = 0,      // Finished text line
+    LINE_RECORD = 1     // Binary record body (msg id + args), framed at drain
+};
+
+struct LogLine {
+    uint16_t len;
+    uint8_t kind;
+    uint32_t ms;        // Capture time for binary records
+    char text[kLineBytes];
+};
+
+struct Backend {
+    MpscRing<LogLine, kRingSlots> ring;
+    char batch[kBatchBytes];
+};
+
+// Allocated on first enable and kept: the flush task lives for the whole boot
+Backend* backend = nullptr;
+TaskHandle_t flushTaskHandle = nullptr;
+SemaphoreHandle_t wakeSem = nullptr;
+// Held by whoever drains the ring; also owns logFile and the counters below
+SemaphoreHandle_t fileMutex = nullptr;
+
+File logFile;
+bool headerPending = false;
+uint32_t lastSyncMs = 0;
+uint32_t lastRecordMs = 0;          // Delta base for binary records
+bool dirty = false;                 // Written since the last sync
+uint8_t suspendDepth = 0;           // SD remount in progress: no card access
+std::atomic<uint32_t> truncatedLines{0};
+uint32_t lostLines = 0;
+uint32_t linesWritten = 0;
+uint32_t bytesWritten = 0;
+uint32_t writeCalls = 0;
+
+void enqueue(LogLine& line) {
+    if (!backend) return;
+    backend->ring.push(line);
+    // Wake the task early rather than letting a burst fill the ring
+    if (backend->ring.size() >= kRingSlots / 2) xSemaphoreGive(wakeSem);
+}
+
+// fileMutex held
+bool openLocked(const char* path) {
+    if (logFile) return true;
+    if (!path[0] || !Config::isSDAvailable()) return false;
+
+    if (headerPending) {
+        const char* logsDir = SDLayout::logsDir();
+        if (!SD.exists(logsDir)) {
+            SD.mkdir(logsDir);
+        }
+        // Fresh file per logging session, with header
+        logFile = SD.open(path, FILE_WRITE);
+        if (!logFile) {
+            Serial.printf("[SDLOG] Failed to create: %s\n", path);
+            return false;
+        }
+        if (SDLog::isBinary()) {
+            uint8_t hdr[SDLogCodec::kFileHeaderBytes];
+            logFile.write(hdr, SDLogCodec::putFileHeader(hdr, SDLogMsg::kTableHash));
+            lastRecordMs = 0;
+        } else {
+            logFile.println("=== PORKCHOP LOG ===");
+            logFile.printf("Started at millis: %lu\n", millis());
+            logFile.println("====================");
+        }
+        headerPending = false;
+        dirty = true;
+        Serial.printf("[SDLOG] Log file: %s\n", path);
+        return true;
+    }
+
+    logFile = SD.open(path, FILE_APPEND);
+    return (bool)logFile;
+}
+
+// fileMutex held
+void writeBatchLocked(const char* path, size_t n, uint16_t lines) {
+    if (n == 0) return;
+    if (!openLocked(path)) {
+        lostLines += lines;
+        return;
+    }
+    size_t wrote = logFile.write((const uint8_t*)backend->batch, n);
+    writeCalls++;
+    bytesWritten += wrote;
+    dirty = true;
+    if (wrote != n) {
+        // Card pulled or remounted: drop the handle, reopen on the next batch
+        lostLines += lines;
+        logFile.close();
+        return;
+    }
+    linesWritten += lines;
+}
+
+// fileMutex held. budgetMs 0 = until empty. Returns true if the ring emptied.
+bool drainLocked(const char* path, uint32_t budgetMs, bool sync) {
+    if (suspendDepth) return backend->ring.empty();
+    uint32_t start = millis();
+    size_t used = 0;
+    uint16_t lines = 0;
+    bool emptied = true;
+    LogLine line;
+
+    const uint8_t wantKind = SDLog::isBinary() ? LINE_RECORD : LINE_TEXT;
+
+    while (backend->ring.pop(line)) {
+        if (line.kind != wantKind) {
+            // Queued just before a format switch; would corrupt the other file
+            lostLines++;
+            continue;
+        }
+        // Binary records get their length + time delta prefix here, where
+        // records are in file order
+        uint8_t prefix[16];
+        size_t prefixLen = 0;
+        if (line.kind == LINE_RECORD) {
+            uint8_t dt[10];
+            size_t dtLen = SDLogCodec::putVarint(dt, sizeof(dt),
+                SDLogCodec::zigzag((int64_t)(int32_t)(line.ms - lastRecordMs)));
+            prefixLen = SDLogCodec::putVarint(prefix, sizeof(prefix), dtLen + line.len);
+            memcpy(prefix + prefixLen, dt, dtLen);
+            prefixLen += dtLen;
+            lastRecordMs = line.ms;
+        }
+        if (used + prefixLen + line.len > kBatchBytes) {
+            writeBatchLocked(path, used, lines);
+            used = 0;
+            lines = 0;
+        }
+        memcpy(backend->batch + used, prefix, prefixLen);
+        used += prefixLen;
+        memcpy(backend->batch + used, line.text, line.len);
+        used += line.len;
+        lines++;
+        if (budgetMs && millis() - start >= budgetMs) {
+            emptied = backend->ring.empty();
+            break;
+        }
+    }
+    writeBatchLocked(path, used, lines);
+
+    if (logFile && dirty && (sync || millis() - lastSyncMs >= kSyncIntervalMs)) {
+        logFile.flush();
+        dirty = false;
+        lastSyncMs = millis();
+    }
+    return emptied;
+}
+
+#ifdef ARDUINO
+void shutdownFlush() {
+    SDLog::crashFlush(kShutdownFlushMs);
+}
+#endif
+
+}  // namespace
 
 bool SDLog::logEnabled = false;
+bool SDLog::binaryMode = false;
 bool SDLog::initialized = false;
 char SDLog::currentLogFile[64] = {0};
 
@@ -15,12 +196,60 @@ void SDLog::init() {
     // Logging starts disabled, user enables via settings
 }
 
+bool SDLog::startBackend() {
+    if (flushTaskHandle) return true;
+
+    if (!backend) {
+        void* mem = heap_caps_malloc(sizeof(Backend), MALLOC_CAP_8BIT);
+        if (!mem) return false;
+        backend = new (mem) Backend();
+    }
+    if (!wakeSem) wakeSem = xSemaphoreCreateBinary();
+    if (!fileMutex) fileMutex = xSemaphoreCreateMutex();
+    if (!wakeSem || !fileMutex) return false;
+
+    xTaskCreatePinnedToCore(
+        flushTask,          // Function
+        "sdlog",            // Name
+        4096,               // Stack size
+        NULL,               // Parameters
+        1,                  // Priority (low)
+        &flushTaskHandle,   // Task handle
+        0                   // Core 0, away from the main loop
+    );
+    if (!flushTaskHandle) return false;
+
+#ifdef ARDUINO
+    esp_register_shutdown_handler(shutdownFlush);
+#endif
+    return true;
+}
+
+void SDLog::flushTask(void* pvParameters) {
+    (void)pvParameters;
+    for (;;) {
+        xSemaphoreTake(wakeSem, pdMS_TO_TICKS(kDrainIntervalMs));
+        if (xSemaphoreTake(fileMutex, pdMS_TO_TICKS(kFlushWaitMs)) != pdTRUE) continue;
+        drainLocked(currentLogFile, 0, false);
+        // Logging switched off: let go of the file once everything is out
+        if (!logEnabled && logFile && backend->ring.empty()) {
+            logFile.close();
+        }
+        xSemaphoreGive(fileMutex);
+    }
+}
+
 void SDLog::setEnabled(bool enabled) {
     Serial.printf("[SDLOG] setEnabled(%s), SD available: %s\n",
                   enabled ? "true" : "false",
                   Config::isSDAvailable() ? "true" : "false");
 
-    logEnabled = enabled && Config::isSDAvailable();
+    bool want = enabled && Config::isSDAvailable();
+    if (want && !startBackend()) {
+        Serial.printf("[SDLOG] Flush task failed to start\n");
+        want = false;
+    }
+    logEnabled = want;
 
     if (logEnabled && currentLogFile[0] == '\0') {
         ensureLogFile();
@@ -31,34 +260,63 @@ void SDLog::setEnabled(bool enabled) {
         log("SDLOG", "SD logging enabled");
     } else {
         Serial.printf("[SDLOG] Logging DISABLED\n");
+        if (flushTaskHandle) xSemaphoreGive(wakeSem);
     }
 }
 
 void SDLog::ensureLogFile() {
     if (currentLogFile[0] != '\0') return;
-    if (!Config::isSDAvailable()) return;
+    if (!Config::isSDAvailable() || !fileMutex) return;
+
+    // Use fixed filename - easier to find and read. The flush task creates
+    // it (with header) on the first batch.
+    xSemaphoreTake(fileMutex, portMAX_DELAY);
+    snprintf(currentLogFile, sizeof(currentLogFile), "%s/%s", SDLayout::logsDir(),
+             binaryMode ? "porkchop.blg" : "porkchop.log");
+    headerPending = true;
+    xSemaphoreGive(fileMutex);
+}
 
-    // Create logs directory if needed
-    const char* logsDir = SDLayout::logsDir();
-    if (!SD.exists(logsDir)) {
-        SD.mkdir(logsDir);
+void SDLog::setBinary(bool binary) {
+    if (binaryMode == binary) return;
+    if (!fileMutex) {
+        binaryMode = binary;
+        return;
     }
+    // Finish the old file in its own format, then point at the new one
+    xSemaphoreTake(fileMutex, portMAX_DELAY);
+    drainLocked(currentLogFile, 0, true);
+    if (logFile) logFile.close();
+    binaryMode = binary;
+    currentLogFile[0] = '\0';
+    xSemaphoreGive(fileMutex);
+    if (logEnabled) ensureLogFile();
+    Serial.printf("[SDLOG] Format: %s (%s)\n", binary ? "binary" : "text", currentLogFile);
+}
 
-    // Use fixed filename - easier to find and read
-    snprintf(currentLogFile, sizeof(currentLogFile), "%s/porkchop.log", logsDir);
+void SDLog::logEncoded(uint16_t id, const uint8_t* args, size_t len) {
+    if (!logEnabled) return;
+    if (currentLogFile[0] == '\0') {
+        ensureLogFile();
+        if (currentLogFile[0] == '\0') return;
+    }
+    if (len == 0) {
+        // Arguments did not fit the record
+        truncatedLines.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
 
-    // Create file with header
-    File f = SD.open(currentLogFile, FILE_WRITE);
-    if (f) {
-        f.println("=== PORKCHOP LOG ===");
-        f.printf("Started at millis: %lu\n", millis());
-        f.println("====================");
-        f.close();
-        Serial.printf("[SDLOG] Log file: %s\n", currentLogFile);
-    } else {
-        Serial.printf("[SDLOG] Failed to create: %s\n", currentLogFile);
-        currentLogFile[0] = '\0';
+    LogLine line;
+    line.kind = LINE_RECORD;
+    line.ms = millis();
+    size_t n = SDLogCodec::putVarint((uint8_t*)line.text, sizeof(line.text), id);
+    if (n == 0 || n + len > sizeof(line.text)) {
+        truncatedLines.fetch_add(1, std::memory_order_relaxed);
+        return;
     }
+    memcpy(line.text + n, args, len);
+    line.len = (uint16_t)(n + len);
+    enqueue(line);
 }
 
 void SDLog::log(const char* tag, const char* format, ...) {
@@ -67,40 +325,46 @@ void SDLog::log(const char* tag, const char* format, ...) {
         return;
     }
     if (currentLogFile[0] == '\0') {
-        // Try to create log file if it doesn't exist
         ensureLogFile();
-        if (currentLogFile[0] == '\0') {
-            Serial.printf("[SDLOG] ERROR: Could not create log file\n");
-            return;
-        }
+        if (currentLogFile[0] == '\0') return;
     }
-    
-    // Format the message first (before SD operations)
-    char buffer[256];
+
+    if (binaryMode) {
+        // Free-form text still works in binary mode as a TEXT record
+        char msg[SDLogCodec::kMaxStringBytes + 1];
+        va_list args;
+        va_start(args, format);
+        int m = vsnprintf(msg, sizeof(msg), format, args);
+        va_end(args);
+        if (m < 0) return;
+        if ((size_t)m >= sizeof(msg)) truncatedLines.fetch_add(1, std::memory_order_relaxed);
+        uint8_t buf[kMaxEventBytes];
+        logEncoded(SDLogMsg::TEXT, buf, SDLogCodec::encodeArgs(buf, sizeof(buf), tag, msg));
+        return;
+    }
+
+    // Format straight into the ring record; the SD work happens on the flush task
+    LogLine line;
+    line.kind = LINE_TEXT;
+    line.ms = 0;
+    const size_t room = sizeof(line.text) - 1;  // Keep one byte for '\n'
+    int n = snprintf(line.text, room, "[%lu][%s] ", millis(), tag);
+    if (n < 0) return;
+    size_t len = (size_t)n < room ? (size_t)n : room - 1;
+
     va_list args;
     va_start(args, format);
-    vsnprintf(buffer, sizeof(buffer), format, args);
+    int m = vsnprintf(line.text + len, room - len, format, args);
     va_end(args);
-    
-    // Debug: show what we're logging
-    Serial.printf("[SDLOG->SD] [%s] %s\n", tag, buffer);
-    
-    // Try to open file with retry on failure (SD can be busy with other operations)
-    File f;
-    for (int retry = 0; retry < 3; retry++) {
-        f = SD.open(currentLogFile, FILE_APPEND);
-        if (f) break;
-        delay(5);  // Brief delay before retry
-    }
-
-    if (!f) {
-        Serial.printf("[SDLOG] Failed to open log file for append\n");
-        return;
+    if (m > 0) len += (size_t)m;
+
+    if (len > room - 1) {
+        len = room - 1;
+        truncatedLines.fetch_add(1, std::memory_order_relaxed);
     }
-    
-    // Write timestamp, tag, and message
-    f.printf("[%lu][%s] %s\n", millis(), tag, buffer);
-    f.close();
+    line.text[len++] = '\n';
+    line.len = (uint16_t)len;
+    enqueue(line);
 }
 
 void SDLog::logRaw(const char* message) {
@@ -110,27 +374,85 @@ void SDLog::logRaw(const char* message) {
         if (currentLogFile[0] == '\0') return;
     }
 
-    // Try to open file with retry on failure
-    File f;
-    for (int retry = 0; retry < 3; retry++) {
-        f = SD.open(currentLogFile, FILE_APPEND);
-        if (f) break;
-        delay(5);
-    }
-    
-    if (f) {
-        f.println(message);
-        f.close();
+    if (binaryMode) {
+        uint8_t buf[kMaxEventBytes];
+        logEncoded(SDLogMsg::TEXT, buf, SDLogCodec::encodeArgs(buf, sizeof(buf), "", message));
+        return;
     }
+
+    LogLine line;
+    line.kind = LINE_TEXT;
+    line.ms = 0;
+    size_t len = strnlen(message, sizeof(line.text) - 2);
+    if (message[len] != '\0') truncatedLines.fetch_add(1, std::memory_order_relaxed);
+    memcpy(line.text, message, len);
+    line.text[len++] = '\r';
+    line.text[len++] = '\n';
+    line.len = (uint16_t)len;
+    enqueue(line);
 }
 
 void SDLog::flush() {
-    // Files are closed after each write, so nothing to flush
+    if (!backend || !fileMutex) return;
+    if (xSemaphoreTake(fileMutex, pdMS_TO_TICKS(kFlushWaitMs)) != pdTRUE) return;
+    drainLocked(currentLogFile, 0, true);
+    xSemaphoreGive(fileMutex);
+}
+
+bool SDLog::crashFlush(uint32_t budgetMs) {
+    if (!backend || !fileMutex) return true;
+    // The flush task may be mid-write; wait at most the whole budget for it
+    if (xSemaphoreTake(fileMutex, pdMS_TO_TICKS(budgetMs)) != pdTRUE) return false;
+    bool emptied = drainLocked(currentLogFile, budgetMs, true);
+    if (logFile) logFile.close();
+    xSemaphoreGive(fileMutex);
+    return emptied;
 }
 
 void SDLog::close() {
     if (logEnabled && currentLogFile[0] != '\0') {
         log("SDLOG", "Log closed");
     }
+    if (backend && fileMutex && xSemaphoreTake(fileMutex, pdMS_TO_TICKS(kFlushWaitMs)) == pdTRUE) {
+        drainLocked(currentLogFile, 0, true);
+        if (logFile) logFile.close();
+        currentLogFile[0] = '\0';
+        xSemaphoreGive(fileMutex);
+        return;
+    }
     currentLogFile[0] = '\0';
 }
+
+void SDLog::suspend() {
+    // Without a flush task nothing else touches the card
+    if (!fileMutex) return;
+    xSemaphoreTake(fileMutex, portMAX_DELAY);
+    if (suspendDepth++ == 0 && logFile) logFile.close();
+    xSemaphoreGive(fileMutex);
+}
+
+void SDLog::resume() {
+    if (!fileMutex) return;
+    xSemaphoreTake(fileMutex, portMAX_DELAY);
+    if (suspendDepth) suspendDepth--;
+    bool wake = suspendDepth == 0;
+    xSemaphoreGive(fileMutex);
+    // Queued lines go to the remounted card (reopened for append)
+    if (wake && flushTaskHandle) xSemaphoreGive(wakeSem);
+}
+
+SDLog::Stats SDLog::getStats() {
+    Stats s = {};
+    s.truncated = truncatedLines.load(std::memory_order_relaxed);
+    s.lost = lostLines;
+    s.linesWritten = linesWritten;
+    s.bytesWritten = bytesWritten;
+    s.writes = writeCalls;
+    if (backend) {
+        s.queued = backend->ring.pushed();
+        s.dropped = backend->ring.dropped();
+        s.pending = backend->ring.size();
+        s.highWater = backend->ring.highWater();
+    }
+    return s;
+}
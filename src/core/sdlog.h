@@ -1,30 +1,84 @@
 // SD Card Logger
+// log() formats into a lock-free ring and returns; a low-priority task
+// drains the ring into the open log file in batches.
+// Binary mode writes event() records (message ID + raw args, see
+// sdlog_codec.h) to porkchop.blg; decode with tools/sdlog_decode.
 #pragma once
 
 #include <Arduino.h>
+#include "sdlog_messages.h"
+#include "sdlog_codec.h"
 
 class SDLog {
 public:
+    struct Stats {
+        uint32_t queued;        // Lines accepted into the ring
+        uint32_t dropped;       // Lines lost because the ring was full
+        uint32_t truncated;     // Lines cut to the slot size
+        uint32_t lost;          // Lines lost to SD open/write errors
+        uint32_t linesWritten;
+        uint32_t bytesWritten;
+        uint32_t writes;        // SD write calls
+        uint16_t pending;       // Lines waiting in the ring
+        uint16_t highWater;
+    };
+
     static void init();
     static void setEnabled(bool enabled);
     static bool isEnabled() { return logEnabled; }
-    
+
+    // Binary record format instead of text (switches log file)
+    static void setBinary(bool binary);
+    static bool isBinary() { return binaryMode; }
+
     // Log functions - mirror Serial.printf behavior
     static void log(const char* tag, const char* format, ...);
     static void logRaw(const char* message);
-    
-    // Flush to ensure data is written
+
+    // Table-driven message: no formatting in binary mode, printf of the
+    // table format in text mode
+    template <typename... Args>
+    static void event(SDLogMsg::Id id, Args... args) {
+        if (!logEnabled) return;
+        if (!binaryMode) {
+            log(SDLogMsg::tag(id), SDLogMsg::format(id), args...);
+            return;
+        }
+        uint8_t buf[kMaxEventBytes];
+        size_t n = SDLogCodec::encodeArgs(buf, sizeof(buf), args...);
+        logEncoded(id, buf, n);
+    }
+
+    // Drain the ring to the card and sync (waits briefly for the flush task)
     static void flush();
-    
+
+    // Last-chance drain before a restart: never blocks longer than budgetMs.
+    // Returns true if everything queued reached the card.
+    static bool crashFlush(uint32_t budgetMs);
+
     // Close current log file (call on shutdown)
     static void close();
-    
+
+    // Around an SD unmount/remount: suspend() waits out a flush in progress,
+    // closes the log file and keeps the flush task off the card until the
+    // matching resume(). Lines logged meanwhile stay queued. Calls nest.
+    static void suspend();
+    static void resume();
+
+    static Stats getStats();
+
 private:
+    static constexpr size_t kMaxEventBytes = 200;
+
     static bool logEnabled;
+    static bool binaryMode;
     static bool initialized;
     static char currentLogFile[64];
-    
+
     static void ensureLogFile();
+    static void logEncoded(uint16_t id, const uint8_t* args, size_t len);
+    static bool startBackend();
+    static void flushTask(void* pvParameters);
 };
 
 // Convenience macro - logs to both Serial and SD if enabled
@@ -33,3 +87,11 @@ private:
     Serial.printf("[%s] " fmt "\n", tag, ##__VA_ARGS__); \
     SDLog::log(tag, fmt, ##__VA_ARGS__); \
 } while(0)
+
+// Same for table messages: SDLOG_EVENT(SDLogMsg::GPS_FIX_LOST)
+#define SDLOG_EVENT(id, ...) do { \
+    Serial.printf("[%s] ", SDLogMsg::tag(id)); \
+    Serial.printf(SDLogMsg::format(id), ##__VA_ARGS__); \
+    Serial.print("\n"); \
+    SDLog::event(id, ##__VA_ARGS__); \
+} while(0)
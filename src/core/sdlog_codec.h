@@ -0,0 +1,158 @@
+// SDLogCodec - Wire format for binary SD logs (shared with the host decoder)
+//
+// File:    "PBLG" | u8 version | u32 table hash (LE)   then records
+// Record:  varint len | zigzag varint dt ms | varint msg id | args   (len
+//          covers everything after itself; dt is relative to the previous
+//          record, the first one to 0)
+// Args:    u8 count | 2-bit type per arg, packed 4 per byte | values
+//          signed -> zigzag varint, unsigned -> varint,
+//          double -> 8 bytes LE, string -> varint len + bytes
+// Header-only, no Arduino dependencies.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace SDLogCodec {
+
+static constexpr uint8_t kMagic[4] = {'P', 'B', 'L', 'G'};
+static constexpr uint8_t kVersion = 1;
+static constexpr size_t kFileHeaderBytes = 9;
+static constexpr uint8_t kMaxArgs = 8;
+static constexpr size_t kMaxStringBytes = 128;   // Longer strings are cut
+
+enum ArgType : uint8_t {
+    ARG_SIGNED = 0,
+    ARG_UNSIGNED = 1,
+    ARG_DOUBLE = 2,
+    ARG_STRING = 3
+};
+
+// ---- primitives ----
+
+inline uint64_t zigzag(int64_t v) {
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+inline int64_t unzigzag(uint64_t v) {
+    return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+// Returns bytes written, 0 if it doesn't fit
+inline size_t putVarint(uint8_t* out, size_t cap, uint64_t v) {
+    size_t n = 0;
+    do {
+        if (n >= cap) return 0;
+        uint8_t b = v & 0x7F;
+        v >>= 7;
+        out[n++] = b | (v ? 0x80 : 0);
+    } while (v);
+    return n;
+}
+
+// Returns bytes consumed, 0 on truncated/overlong input
+inline size_t getVarint(const uint8_t* in, size_t len, uint64_t& v) {
+    v = 0;
+    for (size_t i = 0; i < len && i < 10; i++) {
+        v |= (uint64_t)(in[i] & 0x7F) << (7 * i);
+        if (!(in[i] & 0x80)) return i + 1;
+    }
+    return 0;
+}
+
+inline size_t putFileHeader(uint8_t* out, uint32_t tableHash) {
+    memcpy(out, kMagic, 4);
+    out[4] = kVersion;
+    for (int i = 0; i < 4; i++) out[5 + i] = (uint8_t)(tableHash >> (8 * i));
+    return kFileHeaderBytes;
+}
+
+// ---- argument encoder ----
+
+class ArgWriter {
+public:
+    ArgWriter(uint8_t* out, size_t cap) : out_(out), cap_(cap) {}
+
+    // Size of the encoded args, 0 if they did not fit
+    template <typename... Args>
+    size_t write(Args... args) {
+        static_assert(sizeof...(Args) <= kMaxArgs, "Too many SDLog arguments");
+        const size_t maskBytes = (sizeof...(Args) + 3) / 4;
+        if (cap_ < 1 + maskBytes) return 0;
+        out_[0] = (uint8_t)sizeof...(Args);
+        memset(out_ + 1, 0, maskBytes);
+        pos_ = 1 + maskBytes;
+        index_ = 0;
+        ok_ = true;
+        int expand[] = {0, (put(args), 0)...};
+        (void)expand;
+        return ok_ ? pos_ : 0;
+    }
+
+private:
+    void setType(ArgType t) {
+        out_[1 + index_ / 4] |= (uint8_t)(t << ((index_ % 4) * 2));
+        index_++;
+    }
+
+    void putRaw(const void* p, size_t n) {
+        if (!ok_ || pos_ + n > cap_) {
+            ok_ = false;
+            return;
+        }
+        memcpy(out_ + pos_, p, n);
+        pos_ += n;
+    }
+
+    void putVar(uint64_t v) {
+        size_t n = ok_ ? putVarint(out_ + pos_, cap_ - pos_, v) : 0;
+        if (n == 0) ok_ = false;
+        pos_ += n;
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type
+    put(T v) {
+        if (std::is_signed<T>::value) {
+            setType(ARG_SIGNED);
+            putVar(zigzag((int64_t)v));
+        } else {
+            setType(ARG_UNSIGNED);
+            putVar((uint64_t)v);
+        }
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type
+    put(T v) {
+        setType(ARG_DOUBLE);
+        double d = (double)v;
+        uint8_t b[8];
+        memcpy(b, &d, 8);  // Little-endian on both ESP32 and x86
+        putRaw(b, 8);
+    }
+
+    void put(const char* s) {
+        setType(ARG_STRING);
+        if (!s) s = "(null)";
+        size_t n = 0;
+        while (n < kMaxStringBytes && s[n]) n++;
+        putVar(n);
+        putRaw(s, n);
+    }
+
+    uint8_t* out_;
+    size_t cap_;
+    size_t pos_ = 0;
+    uint8_t index_ = 0;
+    bool ok_ = true;
+};
+
+template <typename... Args>
+inline size_t encodeArgs(uint8_t* out, size_t cap, Args... args) {
+    return ArgWriter(out, cap).write(args...);
+}
+
+}  // namespace SDLogCodec
@@ -0,0 +1,66 @@
+// SDLog message table - IDs, tags and format strings for binary logging
+// The X-macro list below is the single source: the preprocessor expands it
+// into the ID enum, the lookup tables and a table hash at build time, and
+// tools/sdlog_decode includes this same header to turn records back into
+// text. Append new messages at the end; never reorder or reuse an ID, or
+// logs written by older builds decode wrong (the hash catches mismatches).
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#define SDLOG_MESSAGES(X) \
+    X(TEXT,                 "",         "%s") \
+    X(WARHOG_PROCESSING,    "WARHOG",   "Processing %d networks (GPS: %s)") \
+    X(WARHOG_FOUND,         "WARHOG",   "Found %lu new (%lu geotagged)") \
+    X(GPS_FIX_ACQUIRED,     "GPS",      "Fix acquired (sats: %d)") \
+    X(GPS_FIX_LOST,         "GPS",      "Fix lost") \
+    X(WIGLE_UPLOAD_OK,      "WIGLE",    "Upload OK: %s") \
+    X(WIGLE_UPLOAD_FAILED,  "WIGLE",    "Upload failed: %s") \
+    X(OINK_PMKID_CAPTURED,  "OINK",     "PMKID captured: %s") \
+    X(OINK_HS_CAPTURED,     "OINK",     "Handshake captured: %s") \
+    X(OINK_HS_SAVED,        "OINK",     "Handshake saved: %s (pcap:%s 22000:%s)") \
+    X(OINK_PMKID_SAVED,     "OINK",     "PMKID saved: %s") \
+    X(DNH_PMKID_SAVED,      "DNH",      "PMKID saved: %s (%s)") \
+    X(DNH_HS_SAVED,         "DNH",      "Handshake saved: %s (%s)") \
+    X(XP_LEVEL_UP,          "XP",       "LEVEL UP: %d -> %d (%s)") \
+    X(XP_ACHIEVEMENT,       "XP",       "Achievement: %s")
+
+namespace SDLogMsg {
+
+#define SDLOG_MSG_ID(id, tag, fmt) id,
+enum Id : uint16_t {
+    SDLOG_MESSAGES(SDLOG_MSG_ID)
+    Count
+};
+#undef SDLOG_MSG_ID
+
+#define SDLOG_MSG_TAG(id, tag, fmt) tag,
+static constexpr const char* kTags[] = { SDLOG_MESSAGES(SDLOG_MSG_TAG) };
+#undef SDLOG_MSG_TAG
+
+#define SDLOG_MSG_FMT(id, tag, fmt) fmt,
+static constexpr const char* kFormats[] = { SDLOG_MESSAGES(SDLOG_MSG_FMT) };
+#undef SDLOG_MSG_FMT
+
+inline const char* tag(uint16_t id) {
+    return id < Count ? kTags[id] : "?";
+}
+
+inline const char* format(uint16_t id) {
+    return id < Count ? kFormats[id] : nullptr;
+}
+
+// FNV-1a over every tag and format, in ID order. Written into the binary
+// log header so the decoder can tell it was built from a different table.
+constexpr uint32_t fnv1a(const char* s, uint32_t h) {
+    return *s ? fnv1a(s + 1, (h ^ (uint8_t)*s) * 16777619u) : (h ^ 0xFFu) * 16777619u;
+}
+
+constexpr uint32_t tableHash(size_t i = 0, uint32_t h = 2166136261u) {
+    return i < Count ? tableHash(i + 1, fnv1a(kFormats[i], fnv1a(kTags[i], h))) : h;
+}
+
+static constexpr uint32_t kTableHash = tableHash();
+
+}  // namespace SDLogMsg
@@ -0,0 +1,92 @@
+// SpscRing - Bounded single-producer / single-consumer ring
+// Fixed-size, no heap, no locks. One task pushes, one task pops.
+// Used to hand promiscuous-callback work (WiFi task) to the main loop.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+template <typename T, uint16_t N>
+class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+    static_assert(N <= 32768, "SpscRing indices are 16-bit");
+
+public:
+    static constexpr uint16_t kCapacity = N;
+
+    // Producer side. Returns false (and counts a drop) when the ring is full.
+    bool push(const T& item) {
+        uint16_t head = head_.load(std::memory_order_relaxed);
+        uint16_t tail = tail_.load(std::memory_order_acquire);
+        uint16_t used = (uint16_t)(head - tail);
+        if (used >= N) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        slots_[head & (N - 1)] = item;
+        head_.store((uint16_t)(head + 1), std::memory_order_release);
+        pushed_.fetch_add(1, std::memory_order_relaxed);
+        if (used + 1 > highWater_.load(std::memory_order_relaxed)) {
+            highWater_.store((uint16_t)(used + 1), std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& out) {
+        uint16_t tail = tail_.load(std::memory_order_relaxed);
+        uint16_t head = head_.load(std::memory_order_acquire);
+        if (head == tail) return false;
+        out = slots_[tail & (N - 1)];
+        tail_.store((uint16_t)(tail + 1), std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pop up to max items into out[] in one pass (consumer side)
+     * @return number of items copied
+     */
+    uint16_t popBatch(T* out, uint16_t max) {
+        uint16_t tail = tail_.load(std::memory_order_relaxed);
+        uint16_t head = head_.load(std::memory_order_acquire);
+        uint16_t avail = (uint16_t)(head - tail);
+        if (avail > max) avail = max;
+        for (uint16_t i = 0; i < avail; i++) {
+            out[i] = slots_[(uint16_t)(tail + i) & (N - 1)];
+        }
+        if (avail > 0) {
+            tail_.store((uint16_t)(tail + avail), std::memory_order_release);
+        }
+        return avail;
+    }
+
+    uint16_t size() const {
+        return (uint16_t)(head_.load(std::memory_order_acquire) -
+                          tail_.load(std::memory_order_acquire));
+    }
+
+    bool empty() const { return size() == 0; }
+
+    // Counters (relaxed - diagnostics only)
+    uint32_t pushed() const { return pushed_.load(std::memory_order_relaxed); }
+    uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+    uint16_t highWater() const { return highWater_.load(std::memory_order_relaxed); }
+
+    // Only safe while neither side is running (e.g. before callback registration)
+    void reset() {
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+        pushed_.store(0, std::memory_order_relaxed);
+        dropped_.store(0, std::memory_order_relaxed);
+        highWater_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    T slots_[N];
+    // Free-running 16-bit counters; N <= 32768 keeps (head - tail) unambiguous
+    std::atomic<uint16_t> head_{0};
+    std::atomic<uint16_t> tail_{0};
+    std::atomic<uint32_t> pushed_{0};
+    std::atomic<uint32_t> dropped_{0};
+    std::atomic<uint16_t> highWater_{0};
+};
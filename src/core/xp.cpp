@@ -1036,7 +1036,7 @@ void XP::addXP(uint16_t amount) {
         data.cachedLevel = newLevel;
         Serial.printf("[XP] LEVEL UP! %d -> %d (%s)\n", 
                       oldLevel, newLevel, getTitleForLevel(newLevel));
-        SDLog::log("XP", "LEVEL UP: %d -> %d (%s)", oldLevel, newLevel, getTitleForLevel(newLevel));
+        SDLog::event(SDLogMsg::XP_LEVEL_UP, oldLevel, newLevel, getTitleForLevel(newLevel));
         
         if (levelUpCallback) {
             levelUpCallback(oldLevel, newLevel);
@@ -1084,7 +1084,7 @@ void XP::addXPSilent(uint16_t amount) {
         data.cachedLevel = newLevel;
         Serial.printf("[XP] LEVEL UP! %d -> %d (%s)\n", 
                       oldLevel, newLevel, getTitleForLevel(newLevel));
-        SDLog::log("XP", "LEVEL UP: %d -> %d (%s)", oldLevel, newLevel, getTitleForLevel(newLevel));
+        SDLog::event(SDLogMsg::XP_LEVEL_UP, oldLevel, newLevel, getTitleForLevel(newLevel));
         
         if (levelUpCallback) {
             levelUpCallback(oldLevel, newLevel);
@@ -1192,6 +1192,24 @@ uint8_t XP::getProgress() {
     return (progress * 100) / levelRange;
 }
 
+uint32_t XP::getXPToNextLevel(uint32_t xp) {
+    uint8_t level = calculateLevel(xp);
+    if (level >= MAX_LEVEL) return 0;
+    
+    return getXPForLevel(level + 1) - xp;
+}
+
+uint8_t XP::getProgress(uint32_t xp) {
+    uint8_t level = calculateLevel(xp);
+    if (level >= MAX_LEVEL) return 100;
+    
+    uint32_t currentLevelXP = getXPForLevel(level);
+    uint32_t levelRange = getXPForLevel(level + 1) - currentLevelXP;
+    
+    if (levelRange == 0) return 100;
+    return ((xp - currentLevelXP) * 100) / levelRange;
+}
+
 const char* XP::getTitle() {
     return getTitleForLevel(getLevel());
 }
@@ -1308,7 +1326,7 @@ void XP::unlockAchievement(PorkAchievement ach) {
     }
     
     Serial.printf("[XP] Achievement unlocked: %s\n", ACHIEVEMENT_NAMES[idx]);
-    SDLog::log("XP", "Achievement: %s", ACHIEVEMENT_NAMES[idx]);
+    SDLog::event(SDLogMsg::XP_ACHIEVEMENT, ACHIEVEMENT_NAMES[idx]);
     
     // Queue achievement for celebration (prevents cascade of sounds)
     // Celebration happens in processAchievementQueue() called from main loop
@@ -233,6 +233,10 @@ public:
     static uint32_t getXPForLevel(uint8_t level);
     static uint32_t getXPToNextLevel();
     static uint8_t getProgress();  // 0-100%
+    // Pure level math for an arbitrary XP total (no state, host-testable)
+    static uint8_t calculateLevel(uint32_t xp);
+    static uint32_t getXPToNextLevel(uint32_t xp);
+    static uint8_t getProgress(uint32_t xp);
     static const char* getTitle();
     static const char* getTitleForLevel(uint8_t level);
     
@@ -296,7 +300,6 @@ private:
     
     static void load();
     static void checkAchievements();
-    static uint8_t calculateLevel(uint32_t xp);
     
     // SD backup - immortal pig survives M5Burner
     static bool backupToSD();
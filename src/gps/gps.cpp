@@ -162,12 +162,12 @@ void GPS::updateData() {
         Mood::onGPSFix();
         Display::setGPSStatus(true);
         Serial.println("[GPS] Fix acquired!");
-        SDLog::log("GPS", "Fix acquired (sats: %d)", satellites);
+        SDLog::event(SDLogMsg::GPS_FIX_ACQUIRED, satellites);
     } else if (!fix && hadFix) {
         Mood::onGPSLost();
         Display::setGPSStatus(false);
         Serial.println("[GPS] Fix lost");
-        SDLog::log("GPS", "Fix lost");
+        SDLog::event(SDLogMsg::GPS_FIX_LOST);
     }
 }
 
@@ -8,14 +8,18 @@
 #include <NimBLEDevice.h>  // For BLE coexistence check
 #include "../core/config.h"
 #include "../core/sd_layout.h"
+#include "../core/beacon_view.h"
 #include "../audio/sfx.h"
 #include "../core/sdlog.h"
+#include "../core/capture_index.h"
 #include "../core/xp.h"
 #include "../core/wsl_bypasser.h"
 #include "../core/wifi_utils.h"
 #include "../core/heap_gates.h"
 #include "../core/heap_policy.h"
 #include "../core/heap_health.h"
+#include "../core/path_timing.h"
+#include "../core/pcapng_session.h"
 #include "../ui/display.h"
 #include "../piglet/mood.h"
 #include "../piglet/avatar.h"
@@ -23,34 +27,6 @@
 #include <esp_heap_caps.h>
 #include <atomic>
 
-// PCAP file format structures (same as OINK for WPA-SEC compatibility)
-#pragma pack(push, 1)
-struct DNH_PCAPHeader {
-    uint32_t magic;
-    uint16_t version_major;
-    uint16_t version_minor;
-    int32_t thiszone;
-    uint32_t sigfigs;
-    uint32_t snaplen;
-    uint32_t linktype;
-};
-
-struct DNH_PCAPPacketHeader {
-    uint32_t ts_sec;
-    uint32_t ts_usec;
-    uint32_t incl_len;
-    uint32_t orig_len;
-};
-#pragma pack(pop)
-
-// Minimal radiotap header (8 bytes) - required for WPA-SEC
-static const uint8_t DNH_RADIOTAP_HEADER[] = {
-    0x00,       // Header revision
-    0x00,       // Header pad
-    0x08, 0x00, // Header length (8, little-endian)
-    0x00, 0x00, 0x00, 0x00  // Present flags (no optional fields)
-};
-
 // Static member initialization
 bool DoNoHamMode::running = false;
 DNHState DoNoHamMode::state = DNHState::HOPPING;
@@ -115,7 +91,7 @@ struct PendingHandshakeFrame {
     uint8_t bssid[6];
     uint8_t station[6];
     uint8_t messageNum;  // DEPRECATED - kept for compatibility
-    EAPOLFrame frames[4];  // Store all 4 EAPOL frames (M1-M4)
+    EAPOLStagingFrame frames[4];  // Store all 4 EAPOL frames (M1-M4)
     uint8_t capturedMask;  // Bitmask: bit0=M1, bit1=M2, bit2=M3, bit3=M4
 };
 // Ring-buffered deferred handshake frame add (heap allocated on start)
@@ -187,11 +163,20 @@ void DoNoHamMode::start() {
     // Clear DNH-specific data (networks is shared via NetworkRecon)
     pmkids.clear();
     pmkids.shrink_to_fit();
+    for (auto& hs : handshakes) {
+        hs.releaseFrames();
+    }
     handshakes.clear();
     handshakes.shrink_to_fit();
     incompleteHandshakes.clear();
     incompleteHandshakes.shrink_to_fit();
 
+    // EAPOL frame bytes live in the slab; handshake entries only hold handles
+    if (!EapolSlab::begin()) {
+        SDLog::log("DNH", "EAPOL slab alloc failed - handshakes will not be stored");
+    }
+    PcapngSession::begin("dnh");
+
     // Reserve memory for captures
     size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
     if (largest >= (sizeof(CapturedPMKID) * 8 + HeapPolicy::kReserveSlackSmall)) {
@@ -325,12 +310,14 @@ void DoNoHamMode::stop() {
     pendingSaveFlag = false;
     saveAllPMKIDs();
     saveAllHandshakes();
+    PcapngSession::end();
     if (pausedByUs) {
         NetworkRecon::resume();
     }
     
-    // Free per-handshake beacon memory to prevent leaks
+    // Free per-handshake beacon memory and slab-backed frames to prevent leaks
     for (auto& hs : handshakes) {
+        hs.releaseFrames();
         if (hs.beaconData) {
             free(hs.beaconData);
             hs.beaconData = nullptr;
@@ -344,6 +331,7 @@ void DoNoHamMode::stop() {
     handshakes.shrink_to_fit();
     incompleteHandshakes.clear();
     incompleteHandshakes.shrink_to_fit();
+    EapolSlab::end();
     
     // Reset deferred flags
     pendingPMKIDWrite = 0;
@@ -559,21 +547,15 @@ void DoNoHamMode::update() {
                 if (pendingHandshakeLocal.capturedMask & (1 << msgIdx)) {
                     // Frame is present in the queued data
                     if (hs.frames[msgIdx].len == 0) {  // Not already captured
-                        uint16_t copyLen = pendingHandshakeLocal.frames[msgIdx].len;
-                        if (copyLen > 0 && copyLen <= 512) {
-                            // EAPOL payload for hashcat 22000
-                            memcpy(hs.frames[msgIdx].data, pendingHandshakeLocal.frames[msgIdx].data, copyLen);
-                            hs.frames[msgIdx].len = copyLen;
+                        const EAPOLStagingFrame& staged = pendingHandshakeLocal.frames[msgIdx];
+                        // EAPOL payload for hashcat 22000 + full 802.11 frame for PCAP
+                        // export (radiotap + WPA-SEC), stored at actual length
+                        if (staged.len > 0 &&
+                            hs.frames[msgIdx].store(staged.data, staged.len,
+                                                    staged.fullFrame, staged.fullFrameLen)) {
                             hs.frames[msgIdx].messageNum = msgIdx + 1;
                             hs.frames[msgIdx].timestamp = now;
-                            
-                            // Full 802.11 frame for PCAP export (radiotap + WPA-SEC)
-                            uint16_t fullCopyLen = pendingHandshakeLocal.frames[msgIdx].fullFrameLen;
-                            if (fullCopyLen > 0 && fullCopyLen <= 300) {
-                                memcpy(hs.frames[msgIdx].fullFrame, pendingHandshakeLocal.frames[msgIdx].fullFrame, fullCopyLen);
-                                hs.frames[msgIdx].fullFrameLen = fullCopyLen;
-                                hs.frames[msgIdx].rssi = pendingHandshakeLocal.frames[msgIdx].rssi;
-                            }
+                            hs.frames[msgIdx].rssi = staged.rssi;
                             
                             hs.capturedMask |= (1 << msgIdx);
                             hs.lastSeen = now;
@@ -759,6 +741,9 @@ void DoNoHamMode::update() {
         pendingSaveFlag = true;
         lastSaveTime = now;
     }
+    if (PcapngSession::flushDue()) {
+        pendingSaveFlag = true;
+    }
     if (pendingSaveFlag) {
         pendingSaveFlag = false;
         bool pausedByUs = false;
@@ -1030,7 +1015,8 @@ void DoNoHamMode::saveAllPMKIDs() {
         f.close();
 
         p.saved = true;
-        SDLog::log("DNH", "PMKID saved: %s (%s)", p.ssid, filename);
+        CaptureIndex::noteSaved(filename, p.ssid, p.bssid);
+        SDLog::event(SDLogMsg::DNH_PMKID_SAVED, p.ssid, filename);
     }
 }
 
@@ -1130,7 +1116,7 @@ void DoNoHamMode::saveAllHandshakes() {
         // Extract MIC from M2 (offset 81, 16 bytes)
         char micHex[33];
         for (int i = 0; i < 16; i++) {
-            sprintf(micHex + i*2, "%02x", eapolFrame->data[81 + i]);
+            sprintf(micHex + i*2, "%02x", eapolFrame->data()[81 + i]);
         }
         
         // MAC_AP
@@ -1157,11 +1143,11 @@ void DoNoHamMode::saveAllHandshakes() {
         // ANonce from M1 or M3 (offset 17, 32 bytes)
         char nonceHex[65];
         for (int i = 0; i < 32; i++) {
-            sprintf(nonceHex + i*2, "%02x", nonceFrame->data[17 + i]);
+            sprintf(nonceHex + i*2, "%02x", nonceFrame->data()[17 + i]);
         }
         
         // EAPOL frame with MIC zeroed
-        uint16_t eapolLen = (eapolFrame->data[2] << 8) | eapolFrame->data[3];
+        uint16_t eapolLen = (eapolFrame->data()[2] << 8) | eapolFrame->data()[3];
         eapolLen += 4;
         if (eapolLen > eapolFrame->len) eapolLen = eapolFrame->len;
         
@@ -1170,7 +1156,7 @@ void DoNoHamMode::saveAllHandshakes() {
 
         // Copy and zero MIC
         uint8_t eapolCopy[512];
-        memcpy(eapolCopy, eapolFrame->data, eapolLen);
+        memcpy(eapolCopy, eapolFrame->data(), eapolLen);
         memset(eapolCopy + 81, 0, 16);
 
         for (int i = 0; i < eapolLen; i++) {
@@ -1182,6 +1168,7 @@ void DoNoHamMode::saveAllHandshakes() {
         f.printf("WPA*02*%s*%s*%s*%s*%s*%s*%02x\n",
             micHex, macAP, macClient, essidHex, nonceHex, eapolHex, msgPair);
         f.close();
+        CaptureIndex::noteSaved(filename, hs.ssid, hs.bssid);
 
         // Also save PCAP (for WPA-SEC upload and wireshark analysis)
         char pcapFilename[64];
@@ -1190,32 +1177,14 @@ void DoNoHamMode::saveAllHandshakes() {
         
         File pcapFile = SD.open(pcapFilename, FILE_WRITE);
         if (pcapFile) {
-            // Write PCAP global header
-            DNH_PCAPHeader hdr = {
-                .magic = 0xA1B2C3D4,
-                .version_major = 2,
-                .version_minor = 4,
-                .thiszone = 0,
-                .sigfigs = 0,
-                .snaplen = 65535,
-                .linktype = 127  // IEEE802_11_RADIOTAP
-            };
-            pcapFile.write((uint8_t*)&hdr, sizeof(hdr));
+            // Same layout as OINK's handshake pcaps (WPA-SEC needs radiotap)
+            OinkMode::writePCAPHeader(pcapFile);
             
             int packetCount = 0;
             
             // Write beacon if available
             if (hs.hasBeacon()) {
-                uint32_t beaconTotalLen = sizeof(DNH_RADIOTAP_HEADER) + hs.beaconLen;
-                DNH_PCAPPacketHeader beaconPkt = {
-                    .ts_sec = hs.firstSeen / 1000,
-                    .ts_usec = (hs.firstSeen % 1000) * 1000,
-                    .incl_len = beaconTotalLen,
-                    .orig_len = beaconTotalLen
-                };
-                pcapFile.write((uint8_t*)&beaconPkt, sizeof(beaconPkt));
-                pcapFile.write(DNH_RADIOTAP_HEADER, sizeof(DNH_RADIOTAP_HEADER));
-                pcapFile.write(hs.beaconData, hs.beaconLen);
+                OinkMode::writePCAPPacket(pcapFile, hs.beaconData, hs.beaconLen, hs.firstSeen);
                 packetCount++;
             }
             
@@ -1227,25 +1196,24 @@ void DoNoHamMode::saveAllHandshakes() {
                 
                 // Prefer fullFrame if available
                 if (frame.fullFrameLen > 0 && frame.fullFrameLen <= 300) {
-                    uint32_t totalLen = sizeof(DNH_RADIOTAP_HEADER) + frame.fullFrameLen;
-                    DNH_PCAPPacketHeader pkt = {
-                        .ts_sec = frame.timestamp / 1000,
-                        .ts_usec = (frame.timestamp % 1000) * 1000,
-                        .incl_len = totalLen,
-                        .orig_len = totalLen
-                    };
-                    pcapFile.write((uint8_t*)&pkt, sizeof(pkt));
-                    pcapFile.write(DNH_RADIOTAP_HEADER, sizeof(DNH_RADIOTAP_HEADER));
-                    pcapFile.write(frame.fullFrame, frame.fullFrameLen);
+                    OinkMode::writePCAPPacket(pcapFile, frame.fullFrame(), frame.fullFrameLen,
+                                              frame.timestamp);
                     packetCount++;
                 }
             }
             
             pcapFile.close();
+            CaptureIndex::noteSaved(pcapFilename, hs.ssid, hs.bssid);
         }
         
         hs.saved = true;
-        SDLog::log("DNH", "Handshake saved: %s (%s)", hs.ssid, filename);
+        OinkMode::appendSessionHandshake(hs);
+        SDLog::event(SDLogMsg::DNH_HS_SAVED, hs.ssid, filename);
+    }
+    
+    // Session pcapng: write out on its size/time budget
+    if (PcapngSession::flushDue()) {
+        PcapngSession::flush();
     }
 }
 
@@ -1382,6 +1350,7 @@ void DoNoHamMode::injectTestNetwork(const uint8_t* bssid, const char* ssid, uint
             net.rssi = rssi;
             net.lastSeen = millis();
             net.beaconCount++;
+            NetworkRecon::markChanged();
             NetworkRecon::exitCritical();
             return;
         }
@@ -1408,6 +1377,7 @@ void DoNoHamMode::injectTestNetwork(const uint8_t* bssid, const char* ssid, uint
         net.lastDataSeen = 0;
         
         networks().push_back(net);
+        NetworkRecon::markChanged();
     } catch (...) {
         // OOM during push_back - silently ignore
         Serial.println("[DNH] OOM in injectTestNetwork - dropping");
@@ -1429,16 +1399,20 @@ void DoNoHamMode::promiscuousCallback(const wifi_promiscuous_pkt_t* pkt, wifi_pr
     int8_t rssi = pkt->rx_ctrl.rssi;
     
     switch (type) {
-        case WIFI_PKT_MGMT:
+        case WIFI_PKT_MGMT: {
+            PathTiming::Scope timing(PathTiming::Path::DnhMgmt);
             if (frameSubtype == 0x08) {  // Beacon
                 handleBeacon(payload, len, rssi);
             } else if (frameSubtype == 0x05) {  // Probe Response
                 handleProbeResponse(payload, len, rssi);
             }
             break;
-        case WIFI_PKT_DATA:
+        }
+        case WIFI_PKT_DATA: {
+            PathTiming::Scope timing(PathTiming::Path::DnhData);
             handleEAPOL(payload, len, rssi);
             break;
+        }
         default:
             break;
     }
@@ -1458,23 +1432,14 @@ void DoNoHamMode::handleBeacon(const uint8_t* frame, uint16_t len, int8_t rssi)
     
     const uint8_t* bssid = frame + 16;
     
-    // Parse SSID from IE 0
-    char ssid[33] = {0};
-    uint16_t offset = 36;  // Start of IEs (24-byte header + 12-byte fixed params)
-    
-    while (offset + 2 < len) {
-        if (offset + 2 >= len) break; // Extra bounds check
-        uint8_t ieType = frame[offset];
-        uint8_t ieLen = frame[offset + 1];
-        if (offset + 2 + ieLen > len) break;
-        
-        if (ieType == 0 && ieLen > 0 && ieLen <= 32) {
-            memcpy(ssid, frame + offset + 2, ieLen);
-            ssid[ieLen] = 0;
-            break;
-        }
-        offset += 2 + ieLen;
+    // SSID from NetworkRecon's single IE walk (fallback: decode here)
+    BeaconView::Summary local;
+    const BeaconView::Summary* beacon = NetworkRecon::getFrameSummary();
+    if (!beacon) {
+        BeaconView::parse(frame, len, local);
+        beacon = &local;
     }
+    const char* ssid = beacon->ssid;
     
     // Check if this resolves a pending PMKID dwell
     if (state == DNHState::DWELLING && ssid[0] != 0) {
@@ -1584,6 +1549,7 @@ void DoNoHamMode::handleEAPOL(const uint8_t* frame, uint16_t len, int8_t rssi) {
         frame[offset+6] != 0x88 || frame[offset+7] != 0x8E) {
         return;  // Not EAPOL
     }
+    PathTiming::Scope eapolTiming(PathTiming::Path::DnhEapol);
     
     // EAPOL payload starts after LLC/SNAP
     const uint8_t* eapol = frame + offset + 8;
@@ -1666,6 +1632,8 @@ void DoNoHamMode::handleEAPOL(const uint8_t* frame, uint16_t len, int8_t rssi) {
                             
                             pendingPMKIDWrite = (pendingPMKIDWrite + 1) % PENDING_PMKID_SLOTS;
                             pendingPMKIDCount++;
+                        } else {
+                            PathTiming::countDrop(PathTiming::Drop::DnhPendingPmkid);
                         }
                         taskEXIT_CRITICAL(&pendingPMKIDMux);
                         break;  // Found PMKID, stop searching
@@ -1729,6 +1697,8 @@ void DoNoHamMode::handleEAPOL(const uint8_t* frame, uint16_t len, int8_t rssi) {
             slotRef.capturedMask |= (1 << frameIdx);
             pendingHandshakeUsed[slot] = true;
         }
+    } else {
+        PathTiming::countDrop(PathTiming::Drop::DnhPendingHs);
     }
     taskEXIT_CRITICAL(&pendingHandshakeMux);
     
@@ -1750,6 +1720,8 @@ void DoNoHamMode::handleEAPOL(const uint8_t* frame, uint16_t len, int8_t rssi) {
         slot.lastSeen = millis();
         pendingIncompleteWrite = (pendingIncompleteWrite + 1) % PENDING_INCOMPLETE_SLOTS;
         pendingIncompleteCount++;
+    } else {
+        PathTiming::countDrop(PathTiming::Drop::DnhPendingIncomplete);
     }
     taskEXIT_CRITICAL(&pendingIncompleteMux);
 }
@@ -11,7 +11,7 @@
 // DNH-specific constants
 static const size_t DNH_MAX_NETWORKS = 100;
 static const size_t DNH_MAX_PMKIDS = 50;
-static const size_t DNH_MAX_HANDSHAKES = 25;
+static const size_t DNH_MAX_HANDSHAKES = 50;  // Frames live in EapolSlab (~700B each)
 static const uint32_t DNH_STALE_TIMEOUT = 30000;  // 30s
 static const uint16_t DNH_HOP_INTERVAL = 200;     // Legacy default (now adaptive)
 static const uint16_t DNH_DWELL_TIME = 300;       // 300ms dwell for SSID
@@ -71,6 +71,8 @@ public:
     static size_t getNetworkCount() { return NetworkRecon::getNetworkCount(); }
     static size_t getPMKIDCount() { return pmkids.size(); }
     static size_t getHandshakeCount() { return handshakes.size(); }
+    static const std::vector<CapturedPMKID>& getPMKIDs() { return pmkids; }
+    static const std::vector<CapturedHandshake>& getHandshakes() { return handshakes; }
     
     // Packet callback for NetworkRecon
     static void promiscuousCallback(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type);
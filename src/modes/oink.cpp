@@ -9,10 +9,15 @@
 #include "../core/wifi_utils.h"
 #include "../core/heap_gates.h"
 #include "../core/sdlog.h"
+#include "../core/capture_index.h"
 #include "../core/sd_layout.h"
 #include "../core/xp.h"
 #include "../core/heap_policy.h"
 #include "../core/heap_health.h"
+#include "../core/beacon_view.h"
+#include "../core/path_timing.h"
+#include "../core/pcapng_session.h"
+#include "../gps/gps.h"
 #include "../ui/display.h"
 #include "../piglet/mood.h"
 #include "../piglet/avatar.h"
@@ -56,6 +61,8 @@ static volatile bool pendingDeauthSuccess = false;
 static uint8_t pendingDeauthStation[6] = {0};
 
 static volatile bool pendingHandshakeComplete = false;
+static volatile bool handshakeFlagsDirty = false;  // A handshake completed since syncHandshakeFlags()
+static uint32_t handshakeFlagsVersion = 0;
 static char pendingHandshakeSSID[33] = {0};
 static volatile bool pendingAutoSave = false;  // Trigger autoSaveCheck from main loop
 
@@ -87,7 +94,7 @@ struct PendingHandshakeFrame {
     uint8_t bssid[6];
     uint8_t station[6];
     uint8_t messageNum;        // DEPRECATED - used only for logging now
-    EAPOLFrame frames[4];      // Store all 4 EAPOL frames (M1-M4)
+    EAPOLStagingFrame frames[4]; // Store all 4 EAPOL frames (M1-M4)
     uint8_t capturedMask;      // Bitmask: bit0=M1, bit1=M2, bit2=M3, bit3=M4
     uint8_t pmkid[16];         // If M1, may contain PMKID
     bool hasPMKID;
@@ -95,7 +102,7 @@ struct PendingHandshakeFrame {
 
 // Circular buffer for pending handshake frames (4 slots to handle rapid EAPOL bursts)
 // STATIC POOL: Pre-allocated to avoid malloc in WiFi callback context (heap fragmentation risk)
-// WARNING: Each PendingHandshakeFrame is ~3.3KB (contains 4x EAPOLFrame @ 822 bytes each)
+// WARNING: Each PendingHandshakeFrame is ~3.3KB (contains 4x EAPOLStagingFrame @ 818 bytes each)
 // Total static pool: 4 * 3.3KB = ~13KB permanently in .bss - reduces heap even when idle!
 static const uint8_t PENDING_HS_SLOTS = 4;
 static PendingHandshakeFrame pendingHsPool[PENDING_HS_SLOTS];  // Static pool - no heap ops in callback
@@ -135,7 +142,10 @@ static bool enqueuePendingPMKID(const uint8_t* bssid, const uint8_t* station,
     uint8_t write = pendingPmkidWrite.load(std::memory_order_relaxed);
     uint8_t next = (uint8_t)((write + 1) % PENDING_PMKID_SLOTS);
     uint8_t read = pendingPmkidRead.load(std::memory_order_acquire);
-    if (next == read) return false;  // Queue full
+    if (next == read) {
+        PathTiming::countDrop(PathTiming::Drop::OinkPendingPmkid);
+        return false;  // Queue full
+    }
     PendingPMKIDCreate& slot = pendingPMKIDPool[write];
     memcpy(slot.bssid, bssid, 6);
     memcpy(slot.station, station, 6);
@@ -196,7 +206,7 @@ uint8_t OinkMode::filteredCacheIndex = 0;
 
 // Memory limits to prevent OOM
 const size_t MAX_NETWORKS = 200;       // Max tracked networks
-const size_t MAX_HANDSHAKES = 50;      // Max handshakes (each can be large)
+const size_t MAX_HANDSHAKES = 50;      // Max handshakes (frame bytes live in EapolSlab)
 const size_t MAX_PMKIDS = 50;          // Max PMKIDs (smaller than handshakes)
 const uint16_t MAX_BEACON_SIZE = 1500; // IEEE 802.11 practical limit (protect against oversized/malformed frames)
 
@@ -305,6 +315,10 @@ static uint32_t lastBoredUpdate = 0;            // For periodic bored mood updat
 static uint32_t oinkStartMs = 0;
 static uint32_t reconPacketStart = 0;
 
+// NetworkRecon table version at the last priority sort (skip re-sorting if unchanged)
+static uint32_t lastSortVersion = 0;
+static bool sortVersionValid = false;
+
 static bool isWarmForTargets(uint32_t now);
 static uint8_t computeQualityScore(const DetectedNetwork& net, uint32_t now);
 static int computeTargetScore(const DetectedNetwork& net, uint32_t now);
@@ -340,12 +354,14 @@ void OinkMode::init() {
     pendingNewNetwork = false;
     pendingDeauthSuccess = false;
     pendingHandshakeComplete = false;
+    handshakeFlagsDirty = true;  // First update() syncs
     pendingPMKIDCapture = false;
     
     // Reset bored state tracking
     consecutiveFailedScans = 0;
     lastBoredUpdate = 0;
     boredStateReset = true;
+    sortVersionValid = false;
 
     // Reset static pool tracking (no heap ops - pool is pre-allocated)
     for (int i = 0; i < PENDING_HS_SLOTS; i++) {
@@ -358,8 +374,9 @@ void OinkMode::init() {
     pendingPmkidWrite = 0;
     pendingPmkidRead = 0;
 
-    // Free per-handshake beacon memory
+    // Free per-handshake beacon memory and slab-backed frames
     for (auto& hs : handshakes) {
+        hs.releaseFrames();
         if (hs.beaconData) {
             free(hs.beaconData);
             hs.beaconData = nullptr;
@@ -420,6 +437,14 @@ void OinkMode::start() {
     // Initialize WSL bypasser for deauth frame injection
     WSLBypasser::init();
     
+    // EAPOL frame pool must exist before the callback can store into it
+    if (!EapolSlab::begin()) {
+        Serial.println("[OINK] EAPOL slab alloc failed - handshakes will not be stored");
+    }
+    
+    // One pcapng per outing alongside the per-handshake files
+    PcapngSession::begin("oink");
+    
     // Register our packet callback for EAPOL/handshake capture
     NetworkRecon::setPacketCallback(promiscuousCallback);
     
@@ -472,14 +497,28 @@ void OinkMode::stop() {
     // Process any deferred XP saves
     XP::processPendingSave();
     
+    // Close the session pcapng (final flush needs the SD bus to ourselves)
+    if (PcapngSession::isActive()) {
+        bool pausedByUs = false;
+        if (NetworkRecon::isRunning()) {
+            NetworkRecon::pause();
+            pausedByUs = true;
+        }
+        PcapngSession::end();
+        if (pausedByUs) {
+            NetworkRecon::resume();
+        }
+    }
+    
     // Reset beacon frame (static storage, no free)
     beaconFrame = beaconFrameStorage;
     beaconFrameLen = 0;
     beaconCaptured = false;
     clearTargetClients();
     
-    // Free per-handshake beacon memory to prevent leaks on repeated start/stop
+    // Free per-handshake beacon memory and slab-backed frames to prevent leaks on repeated start/stop
     for (auto& hs : handshakes) {
+        hs.releaseFrames();
         if (hs.beaconData) {
             free(hs.beaconData);
             hs.beaconData = nullptr;
@@ -491,6 +530,7 @@ void OinkMode::stop() {
     handshakes.shrink_to_fit();
     pmkids.clear();
     pmkids.shrink_to_fit();
+    EapolSlab::end();
     
     // Reset static pool tracking (no heap ops - pool is pre-allocated)
     for (int i = 0; i < PENDING_HS_SLOTS; i++) {
@@ -614,7 +654,7 @@ void OinkMode::update() {
         strncpy(lastPwnedSSID, pendingPMKIDCopy, sizeof(lastPwnedSSID) - 1);
         lastPwnedSSID[sizeof(lastPwnedSSID) - 1] = '\0';
         Display::showLoot(lastPwnedSSID);  // Show PWNED banner in top bar
-        SDLog::log("OINK", "PMKID captured: %s", pendingPMKIDCopy);
+        SDLog::event(SDLogMsg::OINK_PMKID_CAPTURED, pendingPMKIDCopy);
         
         // BUG FIX: Trigger auto-save for PMKID (was missing, causing beeps but no file)
         pendingAutoSave = true;
@@ -628,7 +668,7 @@ void OinkMode::update() {
         shouldAutoSave = true;
     }
     NetworkRecon::exitCritical();
-    if (shouldAutoSave) {
+    if (shouldAutoSave || PcapngSession::flushDue()) {
         autoSaveCheck();
     }
     
@@ -650,21 +690,14 @@ void OinkMode::update() {
                 if (pendingHandshakes[slot]->capturedMask & (1 << msgIdx)) {
                     // Frame is present in the queued data
                     if (hs.frames[msgIdx].len == 0) {  // Not already captured
-                        uint16_t copyLen = pendingHandshakes[slot]->frames[msgIdx].len;
-                        if (copyLen > 0 && copyLen <= 512) {
-                            // EAPOL payload
-                            memcpy(hs.frames[msgIdx].data, pendingHandshakes[slot]->frames[msgIdx].data, copyLen);
-                            hs.frames[msgIdx].len = copyLen;
+                        const EAPOLStagingFrame& staged = pendingHandshakes[slot]->frames[msgIdx];
+                        // EAPOL payload + full 802.11 frame for PCAP, stored at actual length
+                        if (staged.len > 0 &&
+                            hs.frames[msgIdx].store(staged.data, staged.len,
+                                                    staged.fullFrame, staged.fullFrameLen)) {
                             hs.frames[msgIdx].messageNum = msgIdx + 1;
                             hs.frames[msgIdx].timestamp = millis();
-                            
-                            // Full 802.11 frame for PCAP
-                            uint16_t fullLen = pendingHandshakes[slot]->frames[msgIdx].fullFrameLen;
-                            if (fullLen > 0 && fullLen <= 300) {
-                                memcpy(hs.frames[msgIdx].fullFrame, pendingHandshakes[slot]->frames[msgIdx].fullFrame, fullLen);
-                                hs.frames[msgIdx].fullFrameLen = fullLen;
-                                hs.frames[msgIdx].rssi = pendingHandshakes[slot]->frames[msgIdx].rssi;
-                            }
+                            hs.frames[msgIdx].rssi = staged.rssi;
                             
                             hs.capturedMask |= (1 << msgIdx);
                             hs.lastSeen = millis();
@@ -684,6 +717,7 @@ void OinkMode::update() {
             
             // Check if handshake is now complete
             if (hs.isComplete() && !hs.saved) {
+                handshakeFlagsDirty = true;
                 pendingHandshakeComplete = true;
                 strncpy(pendingHandshakeSSID, hs.ssid, 32);
                 pendingHandshakeSSID[32] = 0;
@@ -716,6 +750,8 @@ void OinkMode::update() {
         pendingHsRead = (pendingHsRead + 1) % PENDING_HS_SLOTS;
     }
     
+    syncHandshakeFlags();
+    
     // Process pending PMKID creation (callback queued, we do push_back here)
     {
         PendingPMKIDCreate pmkidPending = {};
@@ -940,6 +976,7 @@ void OinkMode::update() {
                 // Select this target (locks to channel, stops hopping)
                 selectTarget(selectionIndex);
                 networks()[selectionIndex].attackAttempts++;
+                NetworkRecon::markChanged();
                 
                 // Go to LOCKING state to discover clients before attacking
                 autoState = AutoState::LOCKING;
@@ -979,16 +1016,12 @@ void OinkMode::update() {
             
             // Rebind target index by BSSID snapshot (avoid stale index/races)
             DetectedNetwork targetCopy = {};
-            int foundIdx = -1;
             const bool wasBusy = oinkBusy;
             oinkBusy = true;
             NetworkRecon::enterCritical();
-            for (int i = 0; i < (int)networks().size(); i++) {
-                if (memcmp(networks()[i].bssid, targetBssid, 6) == 0) {
-                    targetCopy = networks()[i];
-                    foundIdx = i;
-                    break;
-                }
+            int foundIdx = NetworkRecon::findNetworkIndexLocked(targetBssid);
+            if (foundIdx >= 0) {
+                targetCopy = networks()[foundIdx];
             }
             NetworkRecon::exitCritical();
             oinkBusy = wasBusy;
@@ -1055,16 +1088,14 @@ void OinkMode::update() {
                 const bool wasBusy = oinkBusy;
                 oinkBusy = true;
                 NetworkRecon::enterCritical();
-                for (int i = 0; i < (int)networks().size(); i++) {
-                    if (memcmp(networks()[i].bssid, targetBssid, 6) == 0) {
-                        targetFound = true;
-                        targetIndex = i;
-                        memcpy(targetBssidLocal, networks()[i].bssid, 6);
-                        strncpy(targetSSIDLocal, networks()[i].ssid, 32);
-                        targetSSIDLocal[32] = 0;
-                        targetHasPMF = networks()[i].hasPMF;
-                        break;
-                    }
+                int foundIdx = NetworkRecon::findNetworkIndexLocked(targetBssid);
+                if (foundIdx >= 0) {
+                    targetFound = true;
+                    targetIndex = foundIdx;
+                    memcpy(targetBssidLocal, networks()[foundIdx].bssid, 6);
+                    strncpy(targetSSIDLocal, networks()[foundIdx].ssid, 32);
+                    targetSSIDLocal[32] = 0;
+                    targetHasPMF = networks()[foundIdx].hasPMF;
                 }
                 NetworkRecon::exitCritical();
 
@@ -1152,15 +1183,12 @@ void OinkMode::update() {
                 NetworkRecon::enterCritical();
                 for (const auto& hs : handshakes) {
                     if (!hs.isComplete()) continue;
-                    int netIdx = -1;
-                    for (int i = 0; i < (int)networks().size(); i++) {
-                        if (memcmp(networks()[i].bssid, hs.bssid, 6) == 0) {
-                            netIdx = i;
-                            break;
-                        }
-                    }
+                    int netIdx = NetworkRecon::findNetworkIndexLocked(hs.bssid);
                     if (netIdx >= 0) {
-                        networks()[netIdx].hasHandshake = true;
+                        if (!networks()[netIdx].hasHandshake) {
+                            networks()[netIdx].hasHandshake = true;
+                            NetworkRecon::markChanged();
+                        }
                         if (targetIndex >= 0 && targetIndex < (int)networks().size() &&
                             memcmp(networks()[targetIndex].bssid, hs.bssid, 6) == 0) {
                             targetHandshakeCaptured = true;
@@ -1173,7 +1201,7 @@ void OinkMode::update() {
                 oinkBusy = wasBusyHandshake;
                 if (targetHandshakeCaptured) {
                     if (targetHandshakeSSID[0] != 0) {
-                        SDLog::log("OINK", "Handshake captured: %s", targetHandshakeSSID);
+                        SDLog::event(SDLogMsg::OINK_HS_CAPTURED, targetHandshakeSSID);
                     } else {
                         SDLog::log("OINK", "Handshake captured");
                     }
@@ -1196,6 +1224,7 @@ void OinkMode::update() {
                             else if (tRssi >= -65) cooldown = 8000;
                             else cooldown = 12000;
                             net.cooldownUntil = now + cooldown;
+                            NetworkRecon::markChanged();
                             break;
                         }
                     }
@@ -1314,13 +1343,7 @@ void OinkMode::update() {
         // Revalidate targetIndex using stored BSSID
         if (targetIndex >= 0) {
             NetworkRecon::enterCritical();
-            int foundIdx = -1;
-            for (int i = 0; i < (int)networks().size(); i++) {
-                if (memcmp(networks()[i].bssid, targetBssid, 6) == 0) {
-                    foundIdx = i;
-                    break;
-                }
-            }
+            int foundIdx = NetworkRecon::findNetworkIndexLocked(targetBssid);
             NetworkRecon::exitCritical();
             
             if (foundIdx != targetIndex) {
@@ -1364,18 +1387,13 @@ void OinkMode::update() {
                 }
             }
             networks().erase(networks().begin());
+            NetworkRecon::markChanged();
             emergencyErased++;
         }
         
         // Revalidate target by BSSID instead of blanket reset
         if (emergencyErased > 0 && targetIndex >= 0) {
-            int foundIdx = -1;
-            for (int i = 0; i < (int)networks().size(); i++) {
-                if (memcmp(networks()[i].bssid, targetBssid, 6) == 0) {
-                    foundIdx = i;
-                    break;
-                }
-            }
+            int foundIdx = NetworkRecon::findNetworkIndexLocked(targetBssid);
             targetIndex = foundIdx;
             if (targetIndex < 0) {
                 // Target was erased - only now do we abort
@@ -1414,6 +1432,7 @@ void OinkMode::selectTarget(int index) {
         targetIndex = index;
         memcpy(targetBssid, networks()[index].bssid, 6);  // Store BSSID
         networks()[index].isTarget = true;
+        NetworkRecon::markChanged();
         
         // Clear old beacon frame when target changes (static storage, no free)
         beaconFrame = beaconFrameStorage;
@@ -1434,6 +1453,7 @@ void OinkMode::selectTarget(int index) {
 void OinkMode::clearTarget() {
     if (targetIndex >= 0 && targetIndex < (int)networks().size()) {
         networks()[targetIndex].isTarget = false;
+        NetworkRecon::markChanged();
     }
     targetIndex = -1;
     memset(targetBssid, 0, 6);
@@ -1527,35 +1547,26 @@ void OinkMode::promiscuousCallback(const wifi_promiscuous_pkt_t* pkt, wifi_promi
 
     packetCount.fetch_add(1, std::memory_order_relaxed);
     
-    // #region agent log - H5 callback firing
-    {
-        static uint32_t lastCbLog = 0;
-        static uint32_t cbCount = 0;
-        cbCount++;
-        uint32_t now = millis();
-        if (now - lastCbLog > 3000) {
-            lastCbLog = now;
-            Serial.printf("[DBG-H5] OINK callback count=%lu type=%d\n", cbCount, (int)type);
-        }
-    }
-    // #endregion
-    
     const uint8_t* payload = pkt->payload;
     uint8_t frameSubtype = (payload[0] >> 4) & 0x0F;
     
     switch (type) {
-        case WIFI_PKT_MGMT:
+        case WIFI_PKT_MGMT: {
+            PathTiming::Scope timing(PathTiming::Path::OinkMgmt);
             if (frameSubtype == 0x08) {  // Beacon
                 // Only capture beacon for target AP (PCAP needs it)
                 processBeacon(payload, len, rssi);
             }
             // Note: Probe responses handled by NetworkRecon for SSID reveal
             break;
+        }
             
-        case WIFI_PKT_DATA:
+        case WIFI_PKT_DATA: {
             // EAPOL/handshake capture (OINK's main job)
+            PathTiming::Scope timing(PathTiming::Path::OinkData);
             processDataFrame(payload, len, rssi);
             break;
+        }
             
         default:
             break;
@@ -1585,16 +1596,7 @@ void OinkMode::processBeacon(const uint8_t* payload, uint16_t len, int8_t rssi)
         }
     }
     
-    // Update hasHandshake flag in shared network data
-    int idx = findNetwork(bssid);
-    if (idx >= 0) {
-        NetworkRecon::enterCritical();
-        auto& nets = NetworkRecon::getNetworks();
-        if (idx < (int)nets.size()) {
-            nets[idx].hasHandshake = hasHandshakeFor(bssid);
-        }
-        NetworkRecon::exitCritical();
-    }
+    // hasHandshake is kept in sync by syncHandshakeFlags() on the main core
 }
 
 // Note: Legacy processBeacon network discovery code removed
@@ -1624,30 +1626,26 @@ void OinkMode::processProbeResponse(const uint8_t* payload, uint16_t len, int8_t
     
     // If network has hidden SSID, try to extract from probe response
     if (networks()[idx].ssid[0] == 0 || networks()[idx].isHidden) {
-        uint16_t offset = 36;
-        while (offset + 2 < len) {
-            uint8_t id = payload[offset];
-            uint8_t ieLen = payload[offset + 1];
-            
-            if (offset + 2 + ieLen > len) break;
+        // Reuse NetworkRecon's decode when available, otherwise walk IEs once here
+        BeaconView::Summary local;
+        const BeaconView::Summary* frame = NetworkRecon::getFrameSummary();
+        if (!frame) {
+            BeaconView::parse(payload, len, local);
+            frame = &local;
+        }
+        if (frame->ssidPresent && frame->ssidLen > 0) {
+            memcpy(networks()[idx].ssid, frame->ssid, 33);
+            networks()[idx].isHidden = false;
+            NetworkRecon::markChanged();
             
-            if (id == 0 && ieLen > 0 && ieLen <= 32) {
-                memcpy(networks()[idx].ssid, payload + offset + 2, ieLen);
-                networks()[idx].ssid[ieLen] = 0;
-                networks()[idx].isHidden = false;
-                
-                // DEFERRED: Queue mood event for main thread
-                if (!pendingNewNetwork) {
-                    strncpy(pendingNetworkSSID, networks()[idx].ssid, 32);
-                    pendingNetworkSSID[32] = 0;
-                    pendingNetworkRSSI = rssi;
-                    pendingNetworkChannel = networks()[idx].channel;
-                    pendingNewNetwork = true;
-                }
-                break;
+            // DEFERRED: Queue mood event for main thread
+            if (!pendingNewNetwork) {
+                strncpy(pendingNetworkSSID, networks()[idx].ssid, 32);
+                pendingNetworkSSID[32] = 0;
+                pendingNetworkRSSI = rssi;
+                pendingNetworkChannel = networks()[idx].channel;
+                pendingNewNetwork = true;
             }
-            
-            offset += 2 + ieLen;
         }
     }
     
@@ -1721,6 +1719,7 @@ void OinkMode::processDataFrame(const uint8_t* payload, uint16_t len, int8_t rss
         const uint8_t* srcMac = payload + 10;  // TA
         const uint8_t* dstMac = payload + 4;   // RA
         
+        PathTiming::Scope timing(PathTiming::Path::OinkEapol);
         processEAPOL(payload + offset + 8, len - offset - 8, srcMac, dstMac, payload, len, rssi);
     }
 }
@@ -1791,7 +1790,7 @@ void OinkMode::processEAPOL(const uint8_t* payload, uint16_t len,
             
             // Look for PMKID KDE: dd 14 00 0f ac 04 (vendor IE, IEEE OUI, PMKID type)
             // Can appear at start or within Key Data
-            for (uint16_t i = 0; i + 22 < keyDataLen; i++) {  // Strict < ensures 22 bytes remain
+            for (uint16_t i = 0; i + 22 <= keyDataLen; i++) {  // KDE must fit entirely in Key Data
                 if (keyData[i] == 0xdd && keyData[i+1] == 0x14 &&
                     keyData[i+2] == 0x00 && keyData[i+3] == 0x0f &&
                     keyData[i+4] == 0xac && keyData[i+5] == 0x04) {
@@ -1829,12 +1828,10 @@ void OinkMode::processEAPOL(const uint8_t* payload, uint16_t len,
                         
                         // Look up SSID (already holding lock)
                         if (p.ssid[0] == 0) {
-                            for (int ni = 0; ni < (int)networks().size(); ni++) {
-                                if (memcmp(networks()[ni].bssid, bssid, 6) == 0) {
-                                    strncpy(p.ssid, networks()[ni].ssid, 32);
-                                    p.ssid[32] = 0;
-                                    break;
-                                }
+                            int ni = NetworkRecon::findNetworkIndexLocked(bssid);
+                            if (ni >= 0) {
+                                strncpy(p.ssid, networks()[ni].ssid, 32);
+                                p.ssid[32] = 0;
                             }
                         }
                         
@@ -1853,12 +1850,10 @@ void OinkMode::processEAPOL(const uint8_t* payload, uint16_t len,
                         // Get SSID from networks if available (with spinlock)
                         char ssidBuf[33] = {0};
                         NetworkRecon::enterCritical();
-                        for (int ni = 0; ni < (int)networks().size(); ni++) {
-                            if (memcmp(networks()[ni].bssid, bssid, 6) == 0) {
-                                strncpy(ssidBuf, networks()[ni].ssid, 32);
-                                ssidBuf[32] = 0;
-                                break;
-                            }
+                        int ni = NetworkRecon::findNetworkIndexLocked(bssid);
+                        if (ni >= 0) {
+                            strncpy(ssidBuf, networks()[ni].ssid, 32);
+                            ssidBuf[32] = 0;
                         }
                         NetworkRecon::exitCritical();
 
@@ -1895,32 +1890,29 @@ void OinkMode::processEAPOL(const uint8_t* payload, uint16_t len,
         
         CapturedHandshake& hs = handshakes[hsIdx];
         
-        // Store this frame (EAPOL payload for hashcat 22000)
+        // Store this frame: EAPOL payload for hashcat 22000 plus the full
+        // 802.11 frame for PCAP export. The payload sits inside the frame, so
+        // the slab keeps one copy. No heap ops - the pool exists since start().
         uint8_t frameIdx = messageNum - 1;
-        uint16_t copyLen = min((uint16_t)512, len);
-        memcpy(hs.frames[frameIdx].data, payload, copyLen);
-        hs.frames[frameIdx].len = copyLen;
+        if (!hs.frames[frameIdx].store(payload, len, fullFrame, fullFrameLen)) {
+            hs.capturedMask &= ~(1 << frameIdx);  // Old copy was released
+            NetworkRecon::exitCritical();
+            return;
+        }
         hs.frames[frameIdx].messageNum = messageNum;
         hs.frames[frameIdx].timestamp = millis();
         hs.frames[frameIdx].rssi = rssi;
         
-        // Store full 802.11 frame for PCAP export (radiotap + WPA-SEC compatibility)
-        uint16_t fullCopyLen = min((uint16_t)300, fullFrameLen);
-        memcpy(hs.frames[frameIdx].fullFrame, fullFrame, fullCopyLen);
-        hs.frames[frameIdx].fullFrameLen = fullCopyLen;
-        
         // Update mask
         hs.capturedMask |= (1 << frameIdx);
         hs.lastSeen = millis();
         
         // Look up SSID from networks if not set (already holding NetworkRecon critical section)
         if (hs.ssid[0] == 0) {
-            for (int ni = 0; ni < (int)networks().size(); ni++) {
-                if (memcmp(networks()[ni].bssid, bssid, 6) == 0) {
-                    strncpy(hs.ssid, networks()[ni].ssid, 32);
-                    hs.ssid[32] = 0;
-                    break;
-                }
+            int ni = NetworkRecon::findNetworkIndexLocked(bssid);
+            if (ni >= 0) {
+                strncpy(hs.ssid, networks()[ni].ssid, 32);
+                hs.ssid[32] = 0;
             }
         }
         
@@ -1936,6 +1928,7 @@ void OinkMode::processEAPOL(const uint8_t* payload, uint16_t len,
         
         // Queue mood/save events outside critical section
         if (isComplete && notSaved) {
+            handshakeFlagsDirty = true;
             if (!pendingHandshakeComplete) {
                 strncpy(pendingHandshakeSSID, ssidCopy, 32);
                 pendingHandshakeSSID[32] = 0;
@@ -1988,7 +1981,10 @@ void OinkMode::processEAPOL(const uint8_t* payload, uint16_t len,
                 
                 pendingHsBusy[targetSlot] = false;  // Unlock after init
             }
-            // else: buffer full, drop this frame (extremely rare with 4 slots)
+            else {
+                // Buffer full, drop this frame (extremely rare with 4 slots)
+                PathTiming::countDrop(PathTiming::Drop::OinkPendingHs);
+            }
         }
         
         // Store frame in target slot if we have one
@@ -2234,7 +2230,9 @@ void OinkMode::autoSaveCheck() {
         }
     }
     
-    if (!hasUnsavedHS && !hasUnsavedPMKID) {
+    bool sessionFlushDue = PcapngSession::flushDue();
+    
+    if (!hasUnsavedHS && !hasUnsavedPMKID && !sessionFlushDue) {
         return;  // Nothing to save, skip promiscuous pause
     }
     
@@ -2283,8 +2281,9 @@ void OinkMode::autoSaveCheck() {
             
             if (pcapOk || hs22kOk) {
                 hs.saved = true;
-                SDLog::log("OINK", "Handshake saved: %s (pcap:%s 22000:%s)",
-                           hs.ssid, pcapOk ? "OK" : "FAIL", hs22kOk ? "OK" : "FAIL");
+                appendSessionHandshake(hs);
+                SDLog::event(SDLogMsg::OINK_HS_SAVED,
+                             hs.ssid, pcapOk ? "OK" : "FAIL", hs22kOk ? "OK" : "FAIL");
             } else {
                 // Failed - increment attempt counter
                 hs.saveAttempts++;
@@ -2303,6 +2302,11 @@ void OinkMode::autoSaveCheck() {
     // Also save any unsaved PMKIDs
     saveAllPMKIDs();
     
+    // Session pcapng: write out on its size/time budget
+    if (PcapngSession::flushDue()) {
+        PcapngSession::flush();
+    }
+    
     // Resume promiscuous mode if we paused it
     if (pausedByUs) {
         NetworkRecon::resume();
@@ -2403,7 +2407,7 @@ bool OinkMode::saveHandshakePCAP(const CapturedHandshake& hs, const char* path)
         // Prefer stored fullFrame (real 802.11 capture) over reconstruction
         if (frame.fullFrameLen > 0 && frame.fullFrameLen <= 300) {
             // Use the actual captured 802.11 frame (best quality)
-            writePCAPPacket(f, frame.fullFrame, frame.fullFrameLen, frame.timestamp);
+            writePCAPPacket(f, frame.fullFrame(), frame.fullFrameLen, frame.timestamp);
             packetCount++;
         } else {
             // Fallback: reconstruct frame from EAPOL payload (legacy path)
@@ -2438,7 +2442,7 @@ bool OinkMode::saveHandshakePCAP(const CapturedHandshake& hs, const char* path)
             
             // EAPOL data
             if (32 + frame.len > sizeof(pkt)) continue;
-            memcpy(pkt + 32, frame.data, frame.len);
+            memcpy(pkt + 32, frame.data(), frame.len);
             pktLen += frame.len;
             
             writePCAPPacket(f, pkt, pktLen, frame.timestamp);
@@ -2447,9 +2451,37 @@ bool OinkMode::saveHandshakePCAP(const CapturedHandshake& hs, const char* path)
     }
     
     f.close();
+    CaptureIndex::noteSaved(path, hs.ssid, hs.bssid);
     return true;
 }
 
+void OinkMode::appendSessionHandshake(const CapturedHandshake& hs) {
+    if (!PcapngSession::isActive()) return;
+    
+    // Shared metadata: SSID + GPS fix when available
+    char meta[96];
+    GPSData gps = GPS::getData();
+    if (gps.valid && gps.fix) {
+        snprintf(meta, sizeof(meta), "ssid=%s gps=%.6f,%.6f", hs.ssid, gps.latitude, gps.longitude);
+    } else {
+        snprintf(meta, sizeof(meta), "ssid=%s", hs.ssid);
+    }
+    
+    char comment[128];
+    if (hs.hasBeacon()) {
+        snprintf(comment, sizeof(comment), "beacon %s", meta);
+        PcapngSession::appendFrame(hs.beaconData, hs.beaconLen, hs.firstSeen, 0, comment);
+    }
+    for (int i = 0; i < 4; i++) {
+        if (!(hs.capturedMask & (1 << i))) continue;
+        const EAPOLFrame& frame = hs.frames[i];
+        if (frame.fullFrameLen == 0) continue;
+        snprintf(comment, sizeof(comment), "M%d rssi=%d %s", i + 1, frame.rssi, meta);
+        PcapngSession::appendFrame(frame.fullFrame(), frame.fullFrameLen,
+                                   frame.timestamp, frame.rssi, comment);
+    }
+}
+
 bool OinkMode::saveAllHandshakes() {
     bool success = true;
     autoSaveCheck();  // This saves any unsaved ones
@@ -2507,6 +2539,7 @@ bool OinkMode::savePMKID22000(const CapturedPMKID& p, const char* path) {
     f.printf("WPA*01*%s*%s*%s*%s***01\n", pmkidHex, macAP, macClient, essidHex);
     
     f.close();
+    CaptureIndex::noteSaved(path, p.ssid, p.bssid);
     return true;
 }
 
@@ -2552,7 +2585,7 @@ bool OinkMode::saveHandshake22000(const CapturedHandshake& hs, const char* path)
     // Offsets: 0-3=EAPOL hdr, 4=desc, 5-6=keyinfo, 7-8=keylen, 9-16=replay, 17-48=nonce, 49-64=iv, 65-72=rsc, 73-80=reserved, 81-96=MIC
     char micHex[33];
     for (int i = 0; i < 16; i++) {
-        sprintf(micHex + i*2, "%02x", eapolFrame->data[81 + i]);
+        sprintf(micHex + i*2, "%02x", eapolFrame->data()[81 + i]);
     }
     
     // MAC_AP (6 bytes as 12 hex chars)
@@ -2579,12 +2612,12 @@ bool OinkMode::saveHandshake22000(const CapturedHandshake& hs, const char* path)
     // ANonce from M1 or M3 (offset 17, 32 bytes)
     char nonceHex[65];
     for (int i = 0; i < 32; i++) {
-        sprintf(nonceHex + i*2, "%02x", nonceFrame->data[17 + i]);
+        sprintf(nonceHex + i*2, "%02x", nonceFrame->data()[17 + i]);
     }
     
     // Full EAPOL frame from M2 (hex-encoded)
     // The EAPOL frame length is in bytes 2-3 (big-endian) + 4 bytes header
-    uint16_t eapolLen = (eapolFrame->data[2] << 8) | eapolFrame->data[3];
+    uint16_t eapolLen = (eapolFrame->data()[2] << 8) | eapolFrame->data()[3];
     eapolLen += 4;  // Add EAPOL header (version + type + length)
     if (eapolLen > eapolFrame->len) eapolLen = eapolFrame->len;
     
@@ -2599,7 +2632,7 @@ bool OinkMode::saveHandshake22000(const CapturedHandshake& hs, const char* path)
     // Zero the MIC in EAPOL copy for hashcat (MIC at offset 81)
     // Work on a copy to avoid modifying original
     uint8_t eapolCopy[512];
-    memcpy(eapolCopy, eapolFrame->data, eapolLen);
+    memcpy(eapolCopy, eapolFrame->data(), eapolLen);
     memset(eapolCopy + 81, 0, 16);  // Zero MIC field
     
     for (int i = 0; i < eapolLen; i++) {
@@ -2612,6 +2645,7 @@ bool OinkMode::saveHandshake22000(const CapturedHandshake& hs, const char* path)
              micHex, macAP, macClient, essidHex, nonceHex, eapolHex, msgPair);
     
     f.close();
+    CaptureIndex::noteSaved(path, hs.ssid, hs.bssid);
     
     return true;
 }
@@ -2671,7 +2705,7 @@ bool OinkMode::saveAllPMKIDs() {
             
             if (savePMKID22000(p, filename)) {
                 p.saved = true;
-                SDLog::log("OINK", "PMKID saved: %s", p.ssid);
+                SDLog::event(SDLogMsg::OINK_PMKID_SAVED, p.ssid);
             } else {
                 // Failed - increment attempt counter
                 p.saveAttempts++;
@@ -2886,70 +2920,33 @@ void OinkMode::trackTargetClient(const uint8_t* bssid, const uint8_t* clientMac,
 }
 
 bool OinkMode::detectPMF(const uint8_t* payload, uint16_t len) {
-    // Parse RSN IE to detect PMF (Protected Management Frames)
-    // RSN IE starts with tag 0x30
-    uint16_t offset = 36;  // After fixed beacon fields
-    
-    while (offset + 2 < len) {
-        uint8_t tag = payload[offset];
-        uint8_t tagLen = payload[offset + 1];
-        
-        if (offset + 2 + tagLen > len) break;
-        
-        if (tag == 0x30 && tagLen >= 8) {  // RSN IE
-            // RSN IE structure: version(2) + group cipher(4) + pairwise count(2) + ...
-            // RSN capabilities are at the end, look for MFPC/MFPR bits
-            uint16_t rsnOffset = offset + 2;
-            uint16_t rsnEnd = rsnOffset + tagLen;
-            
-            // Skip version (2), group cipher (4)
-            rsnOffset += 6;
-            if (rsnOffset + 2 > rsnEnd) break;
-            
-            // Pairwise cipher count and suites
-            uint16_t pairwiseCount = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            rsnOffset += 2 + (pairwiseCount * 4);
-            if (rsnOffset + 2 > rsnEnd) break;
-            
-            // AKM count and suites
-            uint16_t akmCount = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            rsnOffset += 2 + (akmCount * 4);
-            if (rsnOffset + 2 > rsnEnd) break;
-            
-            // RSN Capabilities (2 bytes)
-            uint16_t rsnCaps = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            
-            // IEEE 802.11-2016 standard:
-            // Bit 6: MFPC (Management Frame Protection Capable)
-            // Bit 7: MFPR (Management Frame Protection Required)
-            bool mfpr = (rsnCaps >> 7) & 0x01;
-            
-            if (mfpr) {
-                return true;  // PMF required - deauth won't work
-            }
-        }
-        
-        offset += 2 + tagLen;
-    }
-    
-    return false;
+    // PMF required (MFPR) - deauth won't work
+    BeaconView::Summary frame;
+    BeaconView::parse(payload, len, frame);
+    return frame.pmfRequired;
 }
 
 int OinkMode::findNetwork(const uint8_t* bssid) {
     return NetworkRecon::findNetworkIndex(bssid);
 }
 
-bool OinkMode::hasHandshakeFor(const uint8_t* bssid) {
+// Mirror completed handshakes into DetectedNetwork::hasHandshake. Runs when
+// a handshake completed or the table changed (recon re-adds a network with
+// the flag clear after cleanup); only a flip bumps the table version.
+void OinkMode::syncHandshakeFlags() {
+    if (!handshakeFlagsDirty && !NetworkRecon::hasChangedSince(handshakeFlagsVersion)) return;
+    handshakeFlagsDirty = false;
     NetworkRecon::enterCritical();
-    bool result = false;
     for (const auto& hs : handshakes) {
-        if (memcmp(hs.bssid, bssid, 6) == 0 && hs.isComplete()) {
-            result = true;
-            break;
+        if (!hs.isComplete()) continue;
+        int idx = NetworkRecon::findNetworkIndexLocked(hs.bssid);
+        if (idx >= 0 && !networks()[idx].hasHandshake) {
+            networks()[idx].hasHandshake = true;
+            NetworkRecon::markChanged();
         }
     }
+    handshakeFlagsVersion = NetworkRecon::getVersion();
     NetworkRecon::exitCritical();
-    return result;
 }
 
 void OinkMode::updateTargetCache() {
@@ -2985,13 +2982,18 @@ void OinkMode::sortNetworksByPriority() {
     // 4. Networks with handshake already (skip)
     // 5. PMF protected (can't attack)
     
+    // Nothing added, aged out or flagged since the last sort - order still holds
+    if (sortVersionValid && !NetworkRecon::hasChangedSince(lastSortVersion)) {
+        return;
+    }
+
     bool wasBusy = oinkBusy;
     oinkBusy = true;
 
+    // Lock-free copy; room for entries added while we sort (applyOrder appends them)
     std::vector<DetectedNetwork> sorted;
-    NetworkRecon::enterCritical();
-    sorted = networks();
-    NetworkRecon::exitCritical();
+    sorted.reserve(networks().capacity());
+    uint32_t snapshotVersion = NetworkRecon::copySnapshot(sorted);
 
     uint32_t now = millis();
     std::sort(sorted.begin(), sorted.end(), [now](const DetectedNetwork& a, const DetectedNetwork& b) {
@@ -3009,18 +3011,16 @@ void OinkMode::sortNetworksByPriority() {
         return getScore(a) > getScore(b);
     });
 
-    NetworkRecon::enterCritical();
-    networks().swap(sorted);
+    // Merges anything that changed during the sort and rebuilds the BSSID index
+    if (NetworkRecon::applyOrder(sorted, snapshotVersion)) {
+        lastSortVersion = NetworkRecon::getVersion();
+        sortVersionValid = true;
+    }
 
+    NetworkRecon::enterCritical();
     // Revalidate target index after reordering
     if (targetIndex >= 0) {
-        int foundIdx = -1;
-        for (int i = 0; i < (int)networks().size(); i++) {
-            if (memcmp(networks()[i].bssid, targetBssid, 6) == 0) {
-                foundIdx = i;
-                break;
-            }
-        }
+        int foundIdx = NetworkRecon::findNetworkIndexLocked(targetBssid);
         targetIndex = foundIdx;
         if (targetIndex < 0) {
             deauthing = false;
@@ -3154,25 +3154,29 @@ int OinkMode::getNextTarget() {
     int bestRecentIdx = -1;
     int bestRecentScore = -100000;
 
-    NetworkRecon::enterCritical();
+    // Per-entry seqlock reads - scoring no longer holds the spinlock.
+    // Structural changes only happen on this (main loop) task, so indices hold.
+    int totalCount = (int)NetworkRecon::getNetworkCount();
+    DetectedNetwork net;
     
     // #region agent log - H3 PMF detection check
     {
         static uint32_t lastTargetLog = 0;
         if (now - lastTargetLog > 2000) {
             lastTargetLog = now;
-            int pmfCount = 0, validCount = 0, totalCount = (int)networks().size();
+            int pmfCount = 0, validCount = 0;
             for (int i = 0; i < totalCount && i < 10; i++) {
-                if (networks()[i].hasPMF) pmfCount++;
-                if (!networks()[i].hasPMF && !networks()[i].hasHandshake && networks()[i].authmode != WIFI_AUTH_OPEN && networks()[i].ssid[0] != 0) validCount++;
+                if (!NetworkRecon::readNetwork((uint16_t)i, net)) break;
+                if (net.hasPMF) pmfCount++;
+                if (!net.hasPMF && !net.hasHandshake && net.authmode != WIFI_AUTH_OPEN && net.ssid[0] != 0) validCount++;
             }
             Serial.printf("[DBG-H3] getNextTarget total=%d pmf=%d valid=%d\n", totalCount, pmfCount, validCount);
         }
     }
     // #endregion
 
-    for (int i = 0; i < (int)networks().size(); i++) {
-        const DetectedNetwork& net = networks()[i];
+    for (int i = 0; i < totalCount; i++) {
+        if (!NetworkRecon::readNetwork((uint16_t)i, net)) break;
         if (isExcluded(net.bssid)) continue;  // BOAR BRO - skip
         if (!isEligibleTarget(net, now)) continue;
 
@@ -3190,7 +3194,6 @@ int OinkMode::getNextTarget() {
         }
     }
     
-    NetworkRecon::exitCritical();
     if (bestRecentIdx >= 0) {
         return bestRecentIdx;
     }
@@ -3377,6 +3380,7 @@ void OinkMode::injectTestNetwork(const uint8_t* bssid, const char* ssid, uint8_t
             net.rssi = rssi;
             net.lastSeen = millis();
             net.beaconCount++;
+            NetworkRecon::markChanged();
             NetworkRecon::exitCritical();
             return;
         }
@@ -3409,6 +3413,7 @@ void OinkMode::injectTestNetwork(const uint8_t* bssid, const char* ssid, uint8_t
         SDLog::log("OINK", "Failed to inject test network: out of memory");
         return;
     }
+    NetworkRecon::markChanged();
     NetworkRecon::exitCritical();
 }
 
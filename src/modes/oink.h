@@ -8,6 +8,7 @@
 #include <atomic>
 #include <FS.h>
 #include "../core/network_recon.h"
+#include "../core/eapol_slab.h"
 
 // Maximum clients to track for the current target (dense environments)
 #define MAX_CLIENTS_PER_NETWORK 20
@@ -18,38 +19,119 @@ struct DetectedClient {
     uint32_t lastSeen;
 };
 
+// Field order is hot-first: recon's per-frame updates and the cleanup /
+// retention / quality passes read the leading 49 bytes (through ssid[0]);
+// the retention score's flag, authmode and cooldown checks sit in what would
+// otherwise be alignment padding ahead of the bitsets. Flags are packed so
+// the 200-entry table costs 17.6KB instead of 19.2KB.
 struct DetectedNetwork {
+    // Hot - updated per frame, scanned every cleanup/score pass
     uint8_t bssid[6];
-    char ssid[33];
     int8_t rssi;
     int8_t rssiAvg;          // Smoothed RSSI (EMA), helps quality scoring
-    uint8_t channel;
-    wifi_auth_mode_t authmode;
-    uint32_t firstSeen;      // millis() when first detected
     uint32_t lastSeen;
+    uint32_t lastDataSeen;     // millis() of most recent client data frame
     uint32_t lastBeaconSeen; // millis() of last beacon (for interval EMA)
     uint16_t beaconCount;
     uint16_t beaconIntervalEmaMs; // Smoothed beacon interval (ms), 0 if unknown
-    bool isTarget;
-    bool hasPMF;  // Protected Management Frames (immune to deauth)
-    bool hasHandshake;  // Already captured handshake for this network
-    uint8_t attackAttempts;  // Number of attack attempts (for retry logic)
-    bool isHidden;  // Hidden SSID (needs probe response)
-    uint32_t lastDataSeen;     // millis() of most recent client data frame
     uint32_t cooldownUntil;    // millis() until eligible for auto-target
+    uint8_t channel;
+    wifi_auth_mode_t authmode : 8;
+    uint8_t attackAttempts;  // Number of attack attempts (for retry logic)
+    bool isTarget : 1;
+    bool hasPMF : 1;  // Protected Management Frames (immune to deauth)
+    bool hasHandshake : 1;  // Already captured handshake for this network
+    bool isHidden : 1;  // Hidden SSID (needs probe response)
     uint64_t clientBitset;     // Approximate unique client tracker (bits 0-63)
     uint64_t clientBitsetHigh; // Extended client tracker (bits 64-127)
+
+    // Cold - identity (the retention score only tests ssid[0])
+    char ssid[33];
 };
 
-// Frame storage for PCAP export - stores full 802.11 frame with headers
-struct EAPOLFrame {
+// Callback-side staging copy of one EAPOL message (fixed buffers, no allocation)
+struct EAPOLStagingFrame {
     uint8_t data[512];       // EAPOL payload only (for hashcat 22000)
     uint8_t fullFrame[300];  // Full 802.11 frame for PCAP (header + LLC + EAPOL)
     uint16_t len;            // EAPOL payload length
     uint16_t fullFrameLen;   // Full 802.11 frame length
-    uint8_t messageNum;      // 1-4
+    int8_t rssi;             // Signal strength for radiotap header
+};
+
+// Stored EAPOL message - bytes live in EapolSlab at their actual length.
+// The payload is normally the tail of the 802.11 frame, so it is stored once
+// and data() points inside fullFrame(). Plain data: copies share the slot,
+// call release() exactly once when the owning handshake is dropped.
+struct EAPOLFrame {
+    static constexpr uint16_t kMaxData = 512;
+    static constexpr uint16_t kMaxFull = 300;
+
+    uint16_t slot;           // EapolSlab handle (valid while storedBytes() > 0)
+    uint16_t len;            // EAPOL payload length (0 = not captured)
+    uint16_t fullFrameLen;   // Full 802.11 frame length
+    uint16_t dataOffset;     // Payload offset within the slot
     uint32_t timestamp;
+    uint8_t messageNum;      // 1-4
     int8_t rssi;             // Signal strength for radiotap header
+
+    uint16_t storedBytes() const {
+        uint16_t dataEnd = dataOffset + len;
+        return dataEnd > fullFrameLen ? dataEnd : fullFrameLen;
+    }
+    const uint8_t* fullFrame() const {
+        return fullFrameLen ? EapolSlab::ptr(slot) : nullptr;
+    }
+    const uint8_t* data() const {
+        const uint8_t* base = len ? EapolSlab::ptr(slot) : nullptr;
+        return base ? base + dataOffset : nullptr;
+    }
+
+    // Replace contents. Lengths are clamped to kMaxData/kMaxFull. Returns
+    // false (frame left empty) when the slab is missing or full.
+    bool store(const uint8_t* eapol, uint16_t eapolLen,
+               const uint8_t* full, uint16_t fullLen) {
+        release();
+        if (eapolLen > kMaxData) eapolLen = kMaxData;
+        if (!full) fullLen = 0;
+        if (fullLen > kMaxFull) fullLen = kMaxFull;
+        if (eapolLen == 0) return false;
+
+        // Locate the payload inside the full frame: same buffer, or an
+        // identical tail (optionally followed by a 4-byte FCS)
+        int32_t shared = -1;
+        if (fullLen >= eapolLen) {
+            if (eapol >= full && eapol + eapolLen <= full + fullLen) {
+                shared = (int32_t)(eapol - full);
+            } else if (memcmp(full + fullLen - eapolLen, eapol, eapolLen) == 0) {
+                shared = fullLen - eapolLen;
+            } else if (fullLen >= eapolLen + 4 &&
+                       memcmp(full + fullLen - eapolLen - 4, eapol, eapolLen) == 0) {
+                shared = fullLen - eapolLen - 4;
+            }
+        }
+
+        uint16_t offset = shared >= 0 ? (uint16_t)shared : fullLen;
+        uint16_t bytes = shared >= 0 ? fullLen : (uint16_t)(fullLen + eapolLen);
+        uint16_t h = EapolSlab::alloc(bytes);
+        uint8_t* dst = EapolSlab::ptr(h);
+        if (!dst) return false;
+        if (fullLen) memcpy(dst, full, fullLen);
+        if (shared < 0) memcpy(dst + offset, eapol, eapolLen);
+        slot = h;
+        len = eapolLen;
+        fullFrameLen = fullLen;
+        dataOffset = offset;
+        return true;
+    }
+
+    void release() {
+        uint16_t bytes = storedBytes();
+        if (bytes) EapolSlab::release(slot, bytes);
+        slot = EapolSlab::kNone;
+        len = 0;
+        fullFrameLen = 0;
+        dataOffset = 0;
+    }
 };
 
 struct CapturedHandshake {
@@ -83,6 +165,12 @@ struct CapturedHandshake {
         if (hasM2() && hasM3()) return 0x02;  // M2+M3: EAPOL from M2 (authorized)
         return 0xFF;  // Invalid
     }
+
+    // Return frame bytes to EapolSlab (beaconData is freed separately)
+    void releaseFrames() {
+        for (auto& f : frames) f.release();
+        capturedMask = 0;
+    }
 };
 
 // PMKID capture - clientless attack, extracted from EAPOL M1
@@ -125,6 +213,8 @@ public:
     static bool saveHandshakePCAP(const CapturedHandshake& hs, const char* path);
     static bool saveAllHandshakes();
     static void autoSaveCheck();
+    // Queue a saved handshake into the session pcapng (SD window only)
+    static void appendSessionHandshake(const CapturedHandshake& hs);
     
     // PMKID capture (clientless attack)
     static const std::vector<CapturedPMKID>& getPMKIDs() { return pmkids; }
@@ -178,6 +268,11 @@ public:
     // Packet callback for OINK-specific processing (EAPOL/handshakes)
     // Called by NetworkRecon for mode-specific packet handling
     static void promiscuousCallback(const wifi_promiscuous_pkt_t* pkt, wifi_promiscuous_pkt_type_t type);
+
+    // Classic pcap (radiotap link type) for handshake files; DO NO HAM
+    // writes its .pcap files through these too
+    static void writePCAPHeader(fs::File& f);
+    static void writePCAPPacket(fs::File& f, const uint8_t* data, uint16_t len, uint32_t ts);
     
 private:
     static bool running;
@@ -232,10 +327,8 @@ private:
     static int findOrCreatePMKIDSafe(const uint8_t* bssid, const uint8_t* station);      // Main thread only
     static void sortNetworksByPriority();
     static void updateTargetCache();
-    static bool hasHandshakeFor(const uint8_t* bssid);
+    static void syncHandshakeFlags();  // Main thread only
     static int getNextTarget();  // Smart target selection
-    static void writePCAPHeader(fs::File& f);
-    static void writePCAPPacket(fs::File& f, const uint8_t* data, uint16_t len, uint32_t ts);
     
     // BOAR BROS storage (fixed array, zero heap allocation)
     static BoarBro boarBros[50];
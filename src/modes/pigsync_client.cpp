@@ -337,17 +337,9 @@ static bool parseSirloinHandshake(const uint8_t* data, uint16_t len, CapturedHan
         }
 
         EAPOLFrame& frame = out.frames[msgNum - 1];
-        uint16_t copyLen = frameLen;
-        if (copyLen > sizeof(frame.data)) copyLen = sizeof(frame.data);
-        memcpy(frame.data, frameData, copyLen);
-        frame.len = copyLen;
-
-        uint16_t fullCopyLen = fullLen;
-        if (fullCopyLen > sizeof(frame.fullFrame)) fullCopyLen = sizeof(frame.fullFrame);
-        if (fullCopyLen > 0) {
-            memcpy(frame.fullFrame, fullFrame, fullCopyLen);
+        if (!frame.store(frameData, frameLen, fullFrame, fullLen)) {
+            continue;
         }
-        frame.fullFrameLen = fullCopyLen;
         frame.messageNum = msgNum;
         frame.rssi = rssi;
         frame.timestamp = (ts < 1000000000) ? ts : millis();
@@ -2220,6 +2212,11 @@ bool PigSyncMode::savePMKID(const uint8_t* data, uint16_t len) {
 bool PigSyncMode::saveHandshake(const uint8_t* data, uint16_t len) {
     if (!Config::isSDAvailable()) return false;
 
+    // Small private slab for one handshake (4 messages at worst-case length)
+    static const uint16_t kSlabChunks =
+        4 * EapolSlab::chunksFor(EAPOLFrame::kMaxData + EAPOLFrame::kMaxFull);
+    if (!EapolSlab::begin(kSlabChunks)) return false;
+
     static CapturedHandshake hs;
     if (hs.beaconData) {
         free(hs.beaconData);
@@ -2228,6 +2225,8 @@ bool PigSyncMode::saveHandshake(const uint8_t* data, uint16_t len) {
     memset(&hs, 0, sizeof(hs));
 
     if (!parseSirloinHandshake(data, len, hs)) {
+        hs.releaseFrames();
+        EapolSlab::end();
         return false;
     }
 
@@ -2249,6 +2248,8 @@ bool PigSyncMode::saveHandshake(const uint8_t* data, uint16_t len) {
     bool pcapOk = OinkMode::saveHandshakePCAP(hs, filenamePcap);
     bool hs22kOk = OinkMode::saveHandshake22000(hs, filename22000);
 
+    hs.releaseFrames();
+    EapolSlab::end();
     if (hs.beaconData) {
         free(hs.beaconData);
         hs.beaconData = nullptr;
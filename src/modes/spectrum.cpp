@@ -5,6 +5,7 @@
 #include "../core/config.h"
 #include "../audio/sfx.h"
 #include "../core/network_recon.h"
+#include "../core/beacon_view.h"
 #include "../core/oui.h"
 #include "../core/stress_test.h"
 #include "../core/wsl_bypasser.h"
@@ -12,6 +13,7 @@
 #include "../core/heap_gates.h"
 #include "../core/heap_policy.h"
 #include "../core/xp.h"
+#include "../core/path_timing.h"
 #include "../ui/display.h"
 #include <M5Cardputer.h>
 #include <WiFi.h>
@@ -2019,11 +2021,13 @@ void SpectrumMode::promiscuousCallback(const wifi_promiscuous_pkt_t* pkt, wifi_p
     
     // Handle data frames when monitoring
     if (type == WIFI_PKT_DATA && monitoringNetwork) {
+        PathTiming::Scope timing(PathTiming::Path::SpectrumData);
         processDataFrame(payload, len, rssi);
         return;
     }
     
     if (type != WIFI_PKT_MGMT) return;
+    PathTiming::Scope timing(PathTiming::Path::SpectrumMgmt);
     
     if (len < 36) return;
     
@@ -2036,83 +2040,26 @@ void SpectrumMode::promiscuousCallback(const wifi_promiscuous_pkt_t* pkt, wifi_p
     // BSSID is at offset 16
     const uint8_t* bssid = payload + 16;
     
-    // Parse SSID and DS channel from tagged parameters (starts at offset 36)
-    char ssid[33] = {0};
-    bool ssidFound = false;
-    uint8_t dsChannel = 0;
-    uint16_t offset = 36;
-    
-    while (offset + 2 < len) {
-        if (offset + 2 >= len) break; // Additional bounds check
-        uint8_t tagNum = payload[offset];
-        uint8_t tagLen = payload[offset + 1];
-        
-        if (offset + 2 + tagLen > len) break;
-        
-        if (tagNum == 0 && tagLen <= 32) {  // SSID tag
-            if (offset + 2 + tagLen >= len) break; // Bounds check before memcpy
-            memcpy(ssid, payload + offset + 2, tagLen);
-            ssid[tagLen] = 0;
-            ssidFound = true;
-        } else if (tagNum == 3 && tagLen == 1) {  // DS Parameter Set (channel)
-            dsChannel = payload[offset + 2];
-        }
-        
-        if (ssidFound && dsChannel >= 1 && dsChannel <= 13) break;
-        offset += 2 + tagLen;
+    // Single IE walk - reuse NetworkRecon's decode of this frame when present
+    BeaconView::Summary local;
+    const BeaconView::Summary* frame = NetworkRecon::getFrameSummary();
+    if (!frame) {
+        BeaconView::parse(payload, len, local);
+        frame = &local;
     }
     
-    bool channelTrusted = (dsChannel >= 1 && dsChannel <= 13);
-    uint8_t channel = channelTrusted ? dsChannel : rxChannel;
+    bool channelTrusted = (frame->dsChannel >= 1 && frame->dsChannel <= 13);
+    uint8_t channel = channelTrusted ? frame->dsChannel : rxChannel;
     
     // Validate channel range (after DS channel override)
     if (channel < 1 || channel > 13) return;
     
-    // Parse auth mode from RSN (0x30) and WPA (0xDD) IEs
-    wifi_auth_mode_t authmode = WIFI_AUTH_OPEN;  // Default to open
-    bool hasRSN = false;
-    offset = 36;
-    while (offset + 2 < len) {
-        if (offset + 2 >= len) break; // Additional bounds check
-        uint8_t tagNum = payload[offset];
-        uint8_t tagLen = payload[offset + 1];
-        
-        if (offset + 2 + tagLen > len) break;
-        
-        if (tagNum == 0x30 && tagLen >= 2) {  // RSN IE = WPA2/WPA3
-            hasRSN = true;
-            authmode = WIFI_AUTH_WPA2_PSK;
-        } else if (tagNum == 0xDD && tagLen >= 8) {  // Vendor specific
-            // Check for WPA1 OUI: 00:50:F2:01
-            if (offset + 5 < len &&  // Ensure we don't read past buffer
-                payload[offset + 2] == 0x00 && payload[offset + 3] == 0x50 &&
-                payload[offset + 4] == 0xF2 && payload[offset + 5] == 0x01) {
-                // WPA1 - only set if not already WPA2
-                if (!hasRSN) {
-                    authmode = WIFI_AUTH_WPA_PSK;
-                } else {
-                    authmode = WIFI_AUTH_WPA_WPA2_PSK;
-                }
-            }
-        }
-        
-        offset += 2 + tagLen;
-    }
-    
-    // Detect PMF - need both MFPC and MFPR to distinguish WPA3 from WPA2/WPA3 mixed
-    bool hasPMF = false;
-    bool pmfCapable = false;
-    if (hasRSN && authmode == WIFI_AUTH_WPA2_PSK) {
-        detectPMFBits(payload, len, pmfCapable, hasPMF);
-        if (hasPMF) {
-            authmode = WIFI_AUTH_WPA3_PSK;         // MFPR=1: pure WPA3-SAE
-        } else if (pmfCapable) {
-            authmode = WIFI_AUTH_WPA2_WPA3_PSK;    // MFPC=1 only: transitional
-        }
-    }
+    // Auth mode from RSN/WPA IEs, PMF bits distinguish WPA3 from WPA2/WPA3 mixed
+    wifi_auth_mode_t authmode = frame->authmode;
+    bool hasPMF = frame->hasRSN && !frame->hasWPA && frame->pmfRequired;
     
     // Update spectrum data
-    onBeacon(bssid, channel, channelTrusted, rssi, ssid, authmode, hasPMF, isProbeResponse);
+    onBeacon(bssid, channel, channelTrusted, rssi, frame->ssid, authmode, hasPMF, isProbeResponse);
 }
 
 // Check if auth mode is considered vulnerable (OPEN, WEP, WPA1)
@@ -2171,50 +2118,11 @@ const char* SpectrumMode::authModeToShortString(wifi_auth_mode_t mode) {
     }
 }
 
-// Extract both PMF bits from RSN IE - MFPC (capable) and MFPR (required)
-// MFPC=1,MFPR=0 = WPA2/WPA3 transitional. MFPR=1 = pure WPA3, deauth immune.
-void SpectrumMode::detectPMFBits(const uint8_t* payload, uint16_t len, bool& mfpc, bool& mfpr) {
-    mfpc = false;
-    mfpr = false;
-    uint16_t offset = 36;
-
-    while (offset + 2 < len) {
-        uint8_t tag = payload[offset];
-        uint8_t tagLen = payload[offset + 1];
-
-        if (offset + 2 + tagLen > len) break;
-
-        if (tag == 0x30 && tagLen >= 8) {  // RSN IE
-            uint16_t rsnOffset = offset + 2;
-            uint16_t rsnEnd = rsnOffset + tagLen;
-
-            rsnOffset += 6;  // Skip version(2) + group cipher(4)
-            if (rsnOffset + 2 > rsnEnd) break;
-
-            uint16_t pairwiseCount = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            rsnOffset += 2 + (pairwiseCount * 4);
-            if (rsnOffset + 2 > rsnEnd) break;
-
-            uint16_t akmCount = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            rsnOffset += 2 + (akmCount * 4);
-            if (rsnOffset + 2 > rsnEnd) break;
-
-            // RSN Capabilities - IEEE 802.11-2016 Table 9-133
-            uint16_t rsnCaps = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
-            mfpc = (rsnCaps >> 6) & 0x01;  // Bit 6: MFPC
-            mfpr = (rsnCaps >> 7) & 0x01;  // Bit 7: MFPR
-            return;
-        }
-
-        offset += 2 + tagLen;
-    }
-}
-
 // Detect if PMF is required (MFPR=1) - deauth won't work against these
 bool SpectrumMode::detectPMF(const uint8_t* payload, uint16_t len) {
-    bool mfpc, mfpr;
-    detectPMFBits(payload, len, mfpc, mfpr);
-    return mfpr;
+    BeaconView::Summary frame;
+    BeaconView::parse(payload, len, frame);
+    return frame.pmfRequired;
 }
 
 // Process data frame to extract client MAC
@@ -4,7 +4,7 @@
 // - No entries[] vector - data goes directly to disk
 // - No "waiting for GPS" state - either GPS or ML-only
 // - Simpler memory management - Bloom filter for duplicate detection
-// - Per-network file writes instead of batch saves
+// - Per-network rows go through a write-behind SD journal (one write per block)
 
 #include "warhog.h"
 #include "oink.h"
@@ -17,6 +17,7 @@
 #include "../core/wsl_bypasser.h"
 #include "../core/sdlog.h"
 #include "../core/sd_layout.h"
+#include "../core/sd_journal.h"
 #include "../core/xp.h"
 #include "../ui/display.h"
 #include "../piglet/mood.h"
@@ -53,32 +54,21 @@ static const size_t BOUNTY_POOL_SIZE = 50;
 // Minimum scan interval to avoid tight-loop scanning
 static const uint32_t SCAN_INTERVAL_MIN_MS = 1000;
 
-// SD card retry settings (SD can be busy with other operations)
-static const int SD_RETRY_COUNT = 3;
-static const int SD_RETRY_DELAY_MS = 10;
-
 // WiGLE file size limit for upload compatibility (400KB - leave room for headers)
 // Files larger than this will be rotated to a new file
 static const size_t WIGLE_FILE_MAX_SIZE = 400000;
 
+// Write-behind journals for the session CSV and WiGLE files
+static SDJournal csvJournal;
+static SDJournal wigleJournal;
+
 // Graceful stop request flag for background scan task
 static volatile bool stopRequested = false;
 // Set by scan task just before self-deleting, used for safe cleanup in stop()
 static volatile bool scanTaskExited = false;
 
-// Helper: Open SD file with retry logic
-static File openFileWithRetry(const char* path, const char* mode) {
-    File f;
-    for (int retry = 0; retry < SD_RETRY_COUNT; retry++) {
-        f = SD.open(path, mode);
-        if (f) return f;
-        delay(SD_RETRY_DELAY_MS);
-    }
-    return f;  // Returns invalid File if all retries failed
-}
-
 // Haversine formula for GPS distance calculation
-static double haversineMeters(double lat1, double lon1, double lat2, double lon2) {
+double WarhogMode::haversineMeters(double lat1, double lon1, double lat2, double lon2) {
     const double R = 6371000.0;  // Earth radius in meters
     double dLat = (lat2 - lat1) * M_PI / 180.0;
     double dLon = (lon2 - lon1) * M_PI / 180.0;
@@ -176,17 +166,35 @@ static uint32_t clampScanIntervalMs(uint32_t intervalMs) {
     return (intervalMs < SCAN_INTERVAL_MIN_MS) ? SCAN_INTERVAL_MIN_MS : intervalMs;
 }
 
-// Helper to write CSV-escaped SSID field (quoted, doubles internal quotes, strips control chars)
-static void writeCSVField(File& f, const char* ssid) {
-    f.print("\"");
-    for (int i = 0; i < 32 && ssid[i]; i++) {
+void WarhogMode::escapeCSVField(char* out, size_t outSize, const char* ssid) {
+    size_t o = 0;
+    out[o++] = '"';
+    for (int i = 0; i < 32 && ssid[i] && o + 3 < outSize; i++) {
         if (ssid[i] == '"') {
-            f.print("\"\"");
-        } else if (ssid[i] >= 32) {  // Skip control characters (newlines, etc)
-            f.print(ssid[i]);
+            out[o++] = '"';
+            out[o++] = '"';
+        } else if ((uint8_t)ssid[i] >= 32) {  // Skip control characters (newlines, etc); keep UTF-8
+            out[o++] = ssid[i];
         }
     }
-    f.print("\"");
+    out[o++] = '"';
+    out[o] = '\0';
+}
+
+// WiGLE FirstSeen column from GPS date (DDMMYY) and time (HHMMSSCC)
+static void formatFirstSeen(char* out, size_t outSize, const GPSData& gps) {
+    if (gps.date > 0 && gps.time > 0) {
+        uint8_t day = gps.date / 10000;
+        uint8_t month = (gps.date / 100) % 100;
+        uint8_t year = gps.date % 100;
+        uint8_t hour = gps.time / 1000000;
+        uint8_t minute = (gps.time / 10000) % 100;
+        uint8_t second = (gps.time / 100) % 100;
+        snprintf(out, outSize, "20%02d-%02d-%02d %02d:%02d:%02d", year, month, day, hour, minute, second);
+    } else {
+        // Fallback - use boot time reference
+        snprintf(out, outSize, "1970-01-01 00:00:%02lu", (unsigned long)((millis() / 1000) % 60));
+    }
 }
 
 void WarhogMode::init() {
@@ -195,6 +203,8 @@ void WarhogMode::init() {
     wepNetworks = 0;
     wpaNetworks = 0;
     savedCount = 0;
+    csvJournal.end();
+    wigleJournal.end();
     currentFilename[0] = '\0';
     currentWigleFilename[0] = '\0';
 
@@ -212,6 +222,8 @@ void WarhogMode::start() {
     wepNetworks = 0;
     wpaNetworks = 0;
     savedCount = 0;
+    csvJournal.end();
+    wigleJournal.end();
     currentFilename[0] = '\0';
     currentWigleFilename[0] = '\0';
 
@@ -296,6 +308,10 @@ void WarhogMode::stop() {
     }
     scanInProgress = false;
     scanResult = -2;
+
+    // Write out whatever the journals still hold
+    csvJournal.end();
+    wigleJournal.end();
     
     // Stop grass animation
     Avatar::setGrassMoving(false);
@@ -405,6 +421,10 @@ void WarhogMode::update() {
         lastPhraseTime = now;
     }
     
+    // Write-behind journals: flush on size or time budget
+    if (csvJournal.flushDue()) csvJournal.flush();
+    if (wigleJournal.flushDue()) wigleJournal.flush();
+    
     // Check if background scan task is complete
     if (scanInProgress) {
         if (scanResult >= 0) {
@@ -477,9 +497,9 @@ void WarhogMode::performScan() {
     }
 }
 
-// Ensure CSV file exists with header
+// Ensure CSV journal is open with header queued
 bool WarhogMode::ensureCSVFileReady() {
-    if (currentFilename[0] != '\0') return true;
+    if (csvJournal.isOpen()) return true;
 
     // Ensure wardriving directory exists
     const char* wardrivingDir = SDLayout::wardrivingDir();
@@ -491,14 +511,12 @@ bool WarhogMode::ensureCSVFileReady() {
 
     generateFilename(currentFilename, sizeof(currentFilename), "csv");
 
-    File f = openFileWithRetry(currentFilename, FILE_WRITE);
-    if (!f) {
+    if (!csvJournal.begin(currentFilename)) {
         currentFilename[0] = '\0';
         return false;
     }
     
-    f.println("BSSID,SSID,RSSI,Channel,AuthMode,Latitude,Longitude,Altitude,Timestamp");
-    f.close();
+    csvJournal.appendf("BSSID,SSID,RSSI,Channel,AuthMode,Latitude,Longitude,Altitude,Timestamp\r\n");
     
     return true;
 }
@@ -508,41 +526,31 @@ void WarhogMode::appendCSVEntry(const uint8_t* bssid, const char* ssid,
                                  int8_t rssi, uint8_t channel, wifi_auth_mode_t auth,
                                  double lat, double lon, double alt) {
     if (!ensureCSVFileReady()) return;
-    
-    File f = openFileWithRetry(currentFilename, FILE_APPEND);
-    if (!f) return;
 
-    f.printf("%02X:%02X:%02X:%02X:%02X:%02X,",
-            bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]);
-    writeCSVField(f, ssid);
-    f.print(",");
-    f.printf("%d,%d,%s,%.6f,%.6f,%.1f,%lu\n",
-            rssi, channel, authModeToString(auth),
-            lat, lon, alt, millis());
-    f.close();
+    char ssidField[68];
+    escapeCSVField(ssidField, sizeof(ssidField), ssid);
+    csvJournal.appendf("%02X:%02X:%02X:%02X:%02X:%02X,%s,%d,%d,%s,%.6f,%.6f,%.1f,%lu\n",
+                       bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5],
+                       ssidField, rssi, channel, authModeToString(auth),
+                       lat, lon, alt, millis());
 }
 
-// Check if WiGLE file needs rotation due to size
+// Check if WiGLE file needs rotation due to size (tracked in RAM, no SD stat)
 void WarhogMode::checkWigleFileRotation() {
-    if (currentWigleFilename[0] == '\0') return;
-
-    File f = SD.open(currentWigleFilename, FILE_READ);
-    if (!f) return;
+    if (!wigleJournal.isOpen()) return;
 
-    size_t fileSize = f.size();
-    f.close();
-
-    if (fileSize >= WIGLE_FILE_MAX_SIZE) {
+    if (wigleJournal.size() >= WIGLE_FILE_MAX_SIZE) {
+        wigleJournal.end();
         currentWigleFilename[0] = '\0';  // Force new file creation on next append
     }
 }
 
-// Ensure WiGLE file exists with header
+// Ensure WiGLE journal is open with header queued
 bool WarhogMode::ensureWigleFileReady() {
     // Check if current file needs rotation
     checkWigleFileRotation();
     
-    if (currentWigleFilename[0] != '\0') return true;
+    if (wigleJournal.isOpen()) return true;
 
     // Ensure wardriving directory exists
     const char* wardrivingDir = SDLayout::wardrivingDir();
@@ -554,24 +562,22 @@ bool WarhogMode::ensureWigleFileReady() {
 
     generateFilename(currentWigleFilename, sizeof(currentWigleFilename), "wigle.csv");
 
-    File f = openFileWithRetry(currentWigleFilename, FILE_WRITE);
-    if (!f) {
+    if (!wigleJournal.begin(currentWigleFilename)) {
         currentWigleFilename[0] = '\0';
         return false;
     }
     
     // WiGLE format v1.6 pre-header
-    f.print("WigleWifi-1.6,appRelease=");
     #ifdef BUILD_VERSION
-    f.print(BUILD_VERSION);
+    const char* appRelease = BUILD_VERSION;
     #else
-    f.print("0.1.x");
+    const char* appRelease = "0.1.x";
     #endif
-    f.print(",model=M5Cardputer,release=ESP32-S3,device=PORKCHOP,display=240x135,board=m5stack,brand=M5Stack,star=Sol,body=3,subBody=0\n");
+    wigleJournal.appendf("WigleWifi-1.6,appRelease=%s,model=M5Cardputer,release=ESP32-S3,device=PORKCHOP,display=240x135,board=m5stack,brand=M5Stack,star=Sol,body=3,subBody=0\n",
+                         appRelease);
     
     // WiGLE format header
-    f.println("MAC,SSID,AuthMode,FirstSeen,Channel,Frequency,RSSI,CurrentLatitude,CurrentLongitude,AltitudeMeters,AccuracyMeters,RCOIs,MfgrId,Type");
-    f.close();
+    wigleJournal.appendf("MAC,SSID,AuthMode,FirstSeen,Channel,Frequency,RSSI,CurrentLatitude,CurrentLongitude,AltitudeMeters,AccuracyMeters,RCOIs,MfgrId,Type\r\n");
     
     return true;
 }
@@ -607,63 +613,25 @@ static int channelToFrequency(uint8_t channel) {
     return 0;
 }
 
-// Append single network to WiGLE file
+// Append single network to WiGLE file. firstSeen is formatted once per scan
+// so rows don't take the GPS mutex each.
 void WarhogMode::appendWigleEntry(const uint8_t* bssid, const char* ssid,
                                    int8_t rssi, uint8_t channel, wifi_auth_mode_t auth,
-                                   double lat, double lon, double alt, double accuracy) {
+                                   double lat, double lon, double alt, double accuracy,
+                                   const char* firstSeen) {
     if (!ensureWigleFileReady()) return;
-    
-    File f = openFileWithRetry(currentWigleFilename, FILE_APPEND);
-    if (!f) return;
-    
-    // MAC (BSSID with colons)
-    f.printf("%02X:%02X:%02X:%02X:%02X:%02X,",
-            bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]);
-    
-    // SSID (escaped)
-    writeCSVField(f, ssid);
-    f.print(",");
-    
-    // AuthMode (WiGLE capability string)
-    f.print(authModeToWigleString(auth));
-    f.print(",");
-    
-    // FirstSeen (timestamp) - use GPS time if available, else millis
-    GPSData gps = GPS::getData();
-    if (gps.date > 0 && gps.time > 0) {
-        // date format: DDMMYY, time format: HHMMSSCC
-        uint8_t day = gps.date / 10000;
-        uint8_t month = (gps.date / 100) % 100;
-        uint8_t year = gps.date % 100;
-        uint8_t hour = gps.time / 1000000;
-        uint8_t minute = (gps.time / 10000) % 100;
-        uint8_t second = (gps.time / 100) % 100;
-        f.printf("20%02d-%02d-%02d %02d:%02d:%02d,", year, month, day, hour, minute, second);
-    } else {
-        // Fallback - use boot time reference
-        f.printf("1970-01-01 00:00:%02d,", (millis() / 1000) % 60);
-    }
-    
-    // Channel
-    f.printf("%d,", channel);
-    
-    // Frequency (best-effort mapping for 2.4/5/6 GHz)
-    int freq = channelToFrequency(channel);
-    f.printf("%d,", freq);
-    
-    // RSSI
-    f.printf("%d,", rssi);
-    
-    // Latitude, Longitude, Altitude
-    f.printf("%.6f,%.6f,%.1f,", lat, lon, alt);
-    
-    // AccuracyMeters (GPS HDOP as accuracy estimate, or default 10m)
-    f.printf("%.1f,", accuracy > 0 ? accuracy : 10.0);
-    
-    // RCOIs (empty), MfgrId (empty), Type (WIFI)
-    f.println(",,WIFI");
-    
-    f.close();
+
+    char ssidField[68];
+    escapeCSVField(ssidField, sizeof(ssidField), ssid);
+
+    // MAC, SSID, AuthMode (WiGLE capability string), FirstSeen, Channel,
+    // Frequency (best-effort 2.4/5/6 GHz mapping), RSSI, Lat, Lon, Alt,
+    // AccuracyMeters (GPS HDOP estimate, or default 10m), RCOIs, MfgrId, Type
+    wigleJournal.appendf("%02X:%02X:%02X:%02X:%02X:%02X,%s,%s,%s,%d,%d,%d,%.6f,%.6f,%.1f,%.1f,,,WIFI\r\n",
+                         bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5],
+                         ssidField, authModeToWigleString(auth), firstSeen,
+                         channel, channelToFrequency(channel), rssi,
+                         lat, lon, alt, accuracy > 0 ? accuracy : 10.0);
 }
 
 void WarhogMode::processScanResults() {
@@ -678,7 +646,10 @@ void WarhogMode::processScanResults() {
     GPSData gpsData = GPS::getData();
     bool hasGPS = GPS::hasFix();
     
-    SDLOG("WARHOG", "Processing %d networks (GPS: %s)", n, hasGPS ? "yes" : "no");
+    SDLOG_EVENT(SDLogMsg::WARHOG_PROCESSING, n, hasGPS ? "yes" : "no");
+
+    char firstSeen[24];
+    formatFirstSeen(firstSeen, sizeof(firstSeen), gpsData);
     
     uint32_t newThisScan = 0;
     uint32_t geotaggedThisScan = 0;
@@ -760,7 +731,8 @@ void WarhogMode::processScanResults() {
                 // WiGLE format export (HDOP * 5 as rough accuracy estimate in meters)
                 double accuracy = gpsData.hdop > 0 ? gpsData.hdop * 5.0 : 10.0;
                 appendWigleEntry(bssidPtr, ssid, rssi, channel, authmode,
-                                gpsData.latitude, gpsData.longitude, gpsData.altitude, accuracy);
+                                gpsData.latitude, gpsData.longitude, gpsData.altitude, accuracy,
+                                firstSeen);
                 
                 savedCount++;
                 geotaggedThisScan++;
@@ -772,7 +744,7 @@ void WarhogMode::processScanResults() {
     // Trigger mood update if we found new networks
     if (newThisScan > 0) {
         Mood::onWarhogFound(nullptr, 0);
-        SDLOG("WARHOG", "Found %lu new (%lu geotagged)", newThisScan, geotaggedThisScan);
+        SDLOG_EVENT(SDLogMsg::WARHOG_FOUND, newThisScan, geotaggedThisScan);
     }
     
     WiFi.scanDelete();
@@ -8,13 +8,8 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include "../gps/gps.h"
+#include "../core/bssid_index.h"  // bssidToKey()
 
-// BSSID key for map lookup (6 bytes as uint64_t)
-inline uint64_t bssidToKey(const uint8_t* bssid) {
-    return ((uint64_t)bssid[0] << 40) | ((uint64_t)bssid[1] << 32) |
-           ((uint64_t)bssid[2] << 24) | ((uint64_t)bssid[3] << 16) |
-           ((uint64_t)bssid[4] << 8) | bssid[5];
-}
 
 class WarhogMode {
 public:
@@ -48,6 +43,13 @@ public:
     static void markCaptured(const uint8_t* bssid);                   // Track captures to exclude from bounties
     static void buildBountyList(uint8_t* buffer, uint8_t* count);     // Populate bounty payload buffer (max 15)
     static std::vector<uint64_t> getUnclaimedBSSIDs();                // Random sample of seen, excluding captured
+    
+    // Great-circle distance between two fixes (haversine, meters)
+    static double haversineMeters(double lat1, double lon1, double lat2, double lon2);
+
+    // CSV SSID field: quoted, internal quotes doubled, control chars dropped,
+    // at most 32 SSID bytes. out needs 2 * 32 + 3 bytes for the worst case
+    static void escapeCSVField(char* out, size_t outSize, const char* ssid);
 
 private:
     static bool running;
@@ -73,7 +75,7 @@ private:
     static void scanTask(void* pvParameters);
     static void processScanResults();
     
-    // File helpers - write directly per-network
+    // File helpers - rows go through write-behind journals (see SDJournal)
     static bool ensureCSVFileReady();
     static bool ensureWigleFileReady();
     static void checkWigleFileRotation();
@@ -82,7 +84,8 @@ private:
                                double lat, double lon, double alt);
     static void appendWigleEntry(const uint8_t* bssid, const char* ssid,
                                  int8_t rssi, uint8_t channel, wifi_auth_mode_t auth,
-                                 double lat, double lon, double alt, double accuracy);
+                                 double lat, double lon, double alt, double accuracy,
+                                 const char* firstSeen);
     
     static const char* authModeToString(wifi_auth_mode_t mode);
     static const char* authModeToWigleString(wifi_auth_mode_t mode);
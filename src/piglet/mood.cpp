@@ -2127,17 +2127,19 @@ bool Mood::pickFatiguePhraseIfDue(uint32_t now) {
 bool Mood::pickEncryptionPhraseIfDue(uint32_t now) {
     if (now - lastEncryptionPhraseMs < 300000) return false;  // Max 1 per 5 min
 
-    // Scan current networks for notable encryption types
-    auto& nets = NetworkRecon::getNetworks();
+    // Scan current networks for notable encryption types (lock-free per-entry reads)
+    uint16_t count = NetworkRecon::getNetworkCount();
+    DetectedNetwork net;
     uint8_t openCount = 0;
     bool hasWEP = false;
     bool hasWPA3 = false;
 
-    for (size_t i = 0; i < nets.size(); i++) {
-        if (nets[i].authmode == WIFI_AUTH_OPEN) openCount++;
-        if (nets[i].authmode == WIFI_AUTH_WEP) hasWEP = true;
-        if (nets[i].authmode == WIFI_AUTH_WPA3_PSK ||
-            nets[i].authmode == WIFI_AUTH_WPA2_WPA3_PSK) hasWPA3 = true;
+    for (uint16_t i = 0; i < count; i++) {
+        if (!NetworkRecon::readNetwork(i, net)) break;
+        if (net.authmode == WIFI_AUTH_OPEN) openCount++;
+        if (net.authmode == WIFI_AUTH_WEP) hasWEP = true;
+        if (net.authmode == WIFI_AUTH_WPA3_PSK ||
+            net.authmode == WIFI_AUTH_WPA2_WPA3_PSK) hasWPA3 = true;
     }
 
     bool triggered = false;
@@ -11,6 +11,7 @@
 #include "../web/wpasec.h"
 #include "../core/config.h"
 #include "../core/sd_layout.h"
+#include "../core/capture_index.h"
 #include "../core/wifi_utils.h"
 #include "../core/heap_health.h"
 #include <esp_heap_caps.h>
@@ -25,10 +26,8 @@ bool CapturesMenu::nukeConfirmActive = false;
 bool CapturesMenu::detailViewActive = false;
 bool CapturesMenu::scanInProgress = false;
 unsigned long CapturesMenu::lastScanTime = 0;
-File CapturesMenu::scanDir;
-File CapturesMenu::currentFile;
 bool CapturesMenu::scanComplete = false;
-size_t CapturesMenu::scanProgress = 0;
+bool CapturesMenu::indexFlagsDirty = false;
 bool CapturesMenu::wpasecUpdateInProgress = false;
 unsigned long CapturesMenu::lastWpasecUpdateTime = 0;
 size_t CapturesMenu::wpasecUpdateProgress = 0;
@@ -87,12 +86,7 @@ void CapturesMenu::hide() {
     // Reset all async state to prevent leaks (redundant after emergencyCleanup but safe)
     scanInProgress = false;
     wpasecUpdateInProgress = false;
-    if (scanDir) {
-        scanDir.close();
-    }
-    if (currentFile) {
-        currentFile.close();
-    }
+    CaptureIndex::rebuildCancel();
 }
 
 void CapturesMenu::emergencyCleanup() {
@@ -107,18 +101,13 @@ void CapturesMenu::emergencyCleanup() {
     // Stop any in-progress operations
     scanInProgress = false;
     wpasecUpdateInProgress = false;
-    if (scanDir) {
-        scanDir.close();
-    }
-    if (currentFile) {
-        currentFile.close();
-    }
+    CaptureIndex::rebuildCancel();
 }
 
 bool CapturesMenu::scanCaptures() {
-    // Initialize async scan
     captures.clear();
     captures.reserve(MAX_CAPTURES);  // Full upfront reserve — no mid-scan reallocations
+    CaptureIndex::rebuildCancel();
 
     // Guard: Skip if no SD card available
     if (!Config::isSDAvailable()) {
@@ -148,33 +137,125 @@ bool CapturesMenu::scanCaptures() {
         }
     }
 
-    scanDir = SD.open(handshakesDir);
-    if (!scanDir || !scanDir.isDirectory()) {
-        Serial.println("[CAPTURES] Failed to open handshakes directory");
+    // Fresh index: list straight from it. Stale: rebuild it in chunks
+    // from update(), then list.
+    if (!CaptureIndex::isStale()) {
+        loadFromIndex();
+        return true;
+    }
+    if (!CaptureIndex::rebuildBegin()) {
         scanComplete = true;
         scanInProgress = false;
-        scanDir.close();
         return false;
     }
 
+    Serial.println("[CAPTURES] Capture index stale, rebuilding");
     scanInProgress = true;
     scanComplete = false;
-    scanProgress = 0;
     lastScanTime = millis();
     
     return true;
 }
 
-// Helper: check if string of length n is all hex chars
-static bool isAllHex(const char* s, size_t n) {
-    for (size_t i = 0; i < n; i++) {
-        char c = s[i];
-        if (!((c >= '0' && c <= '9') || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f')))
-            return false;
+// Base name length: strip the extension and the _hs suffix
+static size_t captureBaseLen(const char* name) {
+    const char* dot = strrchr(name, '.');
+    size_t baseLen = dot ? (size_t)(dot - name) : strlen(name);
+    if (baseLen > 3 && strncmp(name + baseLen - 3, "_hs", 3) == 0) {
+        baseLen -= 3;
+    }
+    return baseLen;
+}
+
+static bool sameCapture(const char* a, const char* b) {
+    size_t aLen = captureBaseLen(a);
+    return aLen == captureBaseLen(b) && strncmp(a, b, aLen) == 0;
+}
+
+// forEach visitor: keep the newest MAX_CAPTURES, one entry per capture
+bool CapturesMenu::collectCapture(const CaptureIndex::Record& rec, uint32_t slot, void* ctx) {
+    (void)slot;
+    (void)ctx;
+
+    // Handshakes have a .pcap and an _hs.22000: show the 22000 only
+    if (rec.type != CaptureIndex::TYPE_PMKID) {
+        for (auto& cap : captures) {
+            if (cap.isPMKID || !sameCapture(cap.filename, rec.name)) continue;
+            if (rec.type == CaptureIndex::TYPE_PCAP) return true;
+            fillCaptureInfo(cap, rec);
+            return true;
+        }
+    }
+
+    if (captures.size() < MAX_CAPTURES) {
+        captures.emplace_back();
+        fillCaptureInfo(captures.back(), rec);
+        return true;
+    }
+    // Full: replace the oldest if this one is newer
+    size_t oldest = 0;
+    for (size_t i = 1; i < captures.size(); i++) {
+        if (captures[i].captureTime < captures[oldest].captureTime) oldest = i;
+    }
+    if ((time_t)rec.time > captures[oldest].captureTime) {
+        fillCaptureInfo(captures[oldest], rec);
     }
     return true;
 }
 
+void CapturesMenu::fillCaptureInfo(CaptureInfo& info, const CaptureIndex::Record& rec) {
+    memset(&info, 0, sizeof(info));
+    strncpy(info.filename, rec.name, sizeof(info.filename) - 1);
+    info.fileSize = rec.size;
+    info.captureTime = rec.time;
+    info.isPMKID = rec.type == CaptureIndex::TYPE_PMKID;
+
+    if (rec.flags & CaptureIndex::FLAG_NO_BSSID) {
+        // Unknown name format — use full base as BSSID display
+        size_t copyLen = captureBaseLen(rec.name);
+        if (copyLen > sizeof(info.bssid) - 1) copyLen = sizeof(info.bssid) - 1;
+        memcpy(info.bssid, rec.name, copyLen);
+        info.bssid[copyLen] = '\0';
+    } else {
+        const uint8_t* b = rec.bssid;
+        snprintf(info.bssid, sizeof(info.bssid), "%02X:%02X:%02X:%02X:%02X:%02X",
+                 b[0], b[1], b[2], b[3], b[4], b[5]);
+    }
+
+    strncpy(info.ssid, rec.ssid[0] ? rec.ssid : "[UNKNOWN]", sizeof(info.ssid) - 1);
+
+    // Last known WPA-SEC state; the async update refreshes it (and the password)
+    if (rec.flags & CaptureIndex::FLAG_CRACKED) {
+        info.status = CaptureStatus::CRACKED;
+    } else if (rec.flags & CaptureIndex::FLAG_UPLOADED) {
+        info.status = CaptureStatus::UPLOADED;
+    } else {
+        info.status = CaptureStatus::LOCAL;
+    }
+}
+
+void CapturesMenu::loadFromIndex() {
+    captures.clear();
+    CaptureIndex::forEach(collectCapture, nullptr);
+    scanComplete = true;
+    scanInProgress = false;
+    indexFlagsDirty = false;
+
+    // Sort by capture time (newest first)
+    std::sort(captures.begin(), captures.end(), [](const CaptureInfo& a, const CaptureInfo& b) {
+        return a.captureTime > b.captureTime;
+    });
+
+    // Start async WPA-SEC status update
+    if (!captures.empty()) {
+        wpasecUpdateInProgress = true;
+        wpasecUpdateProgress = 0;
+        lastWpasecUpdateTime = millis();
+    }
+
+    Serial.printf("[CAPTURES] Loaded %d captures from index\n", captures.size());
+}
+
 void CapturesMenu::processAsyncScan() {
     if (!scanInProgress || scanComplete) {
         return;
@@ -187,149 +268,10 @@ void CapturesMenu::processAsyncScan() {
 
     lastScanTime = millis();
 
-    // Process a chunk of files
-    size_t processed = 0;
-    while (processed < SCAN_CHUNK_SIZE && !scanComplete) {
-        currentFile = scanDir.openNextFile();
-
-        if (!currentFile) {
-            // No more files, we're done with scanning
-            scanComplete = true;
-            scanInProgress = false;
-            scanDir.close();
-
-            // Sort by capture time (newest first)
-            std::sort(captures.begin(), captures.end(), [](const CaptureInfo& a, const CaptureInfo& b) {
-                return a.captureTime > b.captureTime;
-            });
-
-            // Start async WPA-SEC status update after scanning is complete
-            if (!captures.empty()) {
-                wpasecUpdateInProgress = true;
-                wpasecUpdateProgress = 0;
-                lastWpasecUpdateTime = millis();
-            }
-
-            Serial.printf("[CAPTURES] Async scan complete. Found %d captures\n", captures.size());
-            break;
-        }
-
-        // Zero-String scan: use const char* from File directly
-        const char* name = currentFile.name();
-        size_t nameLen = strlen(name);
-
-        bool isPCAP = (nameLen > 5 && strcmp(name + nameLen - 5, ".pcap") == 0);
-        bool isHS22000 = (nameLen > 9 && strcmp(name + nameLen - 9, "_hs.22000") == 0);
-        bool isPMKID = !isHS22000 && (nameLen > 6 && strcmp(name + nameLen - 6, ".22000") == 0);
-
-        // Skip PCAP if we have the corresponding _hs.22000 (avoid duplicates).
-        if (isPCAP) {
-            // Build base name: everything before the dot
-            const char* dot = strrchr(name, '.');
-            size_t baseLen = dot ? (size_t)(dot - name) : nameLen;
-            char hs22kPath[80];
-            snprintf(hs22kPath, sizeof(hs22kPath), "%s/%.*s_hs.22000",
-                     SDLayout::handshakesDir(), (int)baseLen, name);
-            if (SD.exists(hs22kPath)) {
-                currentFile.close();
-                processed++;
-                continue;
-            }
-        }
-
-        if (isPCAP || isPMKID || isHS22000) {
-            CaptureInfo info;
-            memset(&info, 0, sizeof(info));
-            strncpy(info.filename, name, sizeof(info.filename) - 1);
-            info.fileSize = currentFile.size();
-            info.captureTime = currentFile.getLastWrite();
-            info.isPMKID = isPMKID;
-
-            // Compute base name (strip extension and _hs suffix)
-            const char* dot = strrchr(name, '.');
-            size_t baseLen = dot ? (size_t)(dot - name) : nameLen;
-            if (baseLen > 3 && strncmp(name + baseLen - 3, "_hs", 3) == 0) {
-                baseLen -= 3;
-            }
-
-            // Dual-format detection:
-            // Legacy: base name is exactly 12 hex chars (BSSID only)
-            // New format: last 12 chars are hex, preceded by '_' (SSID_BSSID)
-            if (baseLen == 12 && isAllHex(name, 12)) {
-                // Legacy format: BSSID is first 12 chars
-                const char* b = name;
-                snprintf(info.bssid, sizeof(info.bssid),
-                         "%.2s:%.2s:%.2s:%.2s:%.2s:%.2s",
-                         b, b+2, b+4, b+6, b+8, b+10);
-
-                // Try companion .txt for SSID (legacy files)
-                char txtPath[80];
-                if (isPMKID) {
-                    snprintf(txtPath, sizeof(txtPath), "%s/%.12s_pmkid.txt",
-                             SDLayout::handshakesDir(), name);
-                } else {
-                    snprintf(txtPath, sizeof(txtPath), "%s/%.12s.txt",
-                             SDLayout::handshakesDir(), name);
-                }
-                if (SD.exists(txtPath)) {
-                    File txtFile = SD.open(txtPath, FILE_READ);
-                    if (txtFile) {
-                        char buf[34];
-                        int n = txtFile.readBytesUntil('\n', buf, sizeof(buf) - 1);
-                        buf[n] = '\0';
-                        while (n > 0 && (buf[n-1] == ' ' || buf[n-1] == '\r' || buf[n-1] == '\t')) buf[--n] = '\0';
-                        if (n > 0) {
-                            strncpy(info.ssid, buf, sizeof(info.ssid) - 1);
-                        }
-                        txtFile.close();
-                    }
-                }
-            } else if (baseLen > 13 && name[baseLen - 13] == '_' &&
-                       isAllHex(name + baseLen - 12, 12)) {
-                // New format: SSID_BSSID — extract BSSID from last 12 chars
-                const char* b = name + baseLen - 12;
-                snprintf(info.bssid, sizeof(info.bssid),
-                         "%.2s:%.2s:%.2s:%.2s:%.2s:%.2s",
-                         b, b+2, b+4, b+6, b+8, b+10);
-
-                // Extract SSID from chars before _BSSID
-                size_t ssidLen = baseLen - 13;
-                if (ssidLen > sizeof(info.ssid) - 1) ssidLen = sizeof(info.ssid) - 1;
-                memcpy(info.ssid, name, ssidLen);
-                info.ssid[ssidLen] = '\0';
-            } else {
-                // Unknown format — use full base as BSSID display
-                size_t copyLen = baseLen < sizeof(info.bssid) - 1 ? baseLen : sizeof(info.bssid) - 1;
-                memcpy(info.bssid, name, copyLen);
-                info.bssid[copyLen] = '\0';
-            }
-
-            if (info.ssid[0] == '\0') {
-                strncpy(info.ssid, "[UNKNOWN]", sizeof(info.ssid) - 1);
-            }
-
-            info.status = CaptureStatus::LOCAL;
-
-            captures.push_back(info);
-
-            if (captures.size() >= MAX_CAPTURES) {
-                scanComplete = true;
-                scanInProgress = false;
-                currentFile.close();
-                scanDir.close();
-                Serial.println("[CAPTURES] Hit capture limit, stopped scan");
-                break;
-            }
-        }
-
-        currentFile.close();
-        processed++;
-        scanProgress++;
-
-        if (processed >= SCAN_CHUNK_SIZE) {
-            break;
-        }
+    if (!CaptureIndex::rebuildStep(SCAN_CHUNK_SIZE)) {
+        return;
     }
+    loadFromIndex();
 }
 
 void CapturesMenu::updateWPASecStatus() {
@@ -357,6 +299,24 @@ void CapturesMenu::updateWPASecStatus() {
     }
 }
 
+// update() pass: mirror WPA-SEC cracked/uploaded state into index flags
+bool CapturesMenu::syncIndexFlags(CaptureIndex::Record& rec, void* ctx) {
+    (void)ctx;
+    if (rec.flags & CaptureIndex::FLAG_NO_BSSID) return false;
+    char key[13];
+    snprintf(key, sizeof(key), "%02X%02X%02X%02X%02X%02X",
+             rec.bssid[0], rec.bssid[1], rec.bssid[2], rec.bssid[3], rec.bssid[4], rec.bssid[5]);
+    uint8_t flags = rec.flags & ~(CaptureIndex::FLAG_UPLOADED | CaptureIndex::FLAG_CRACKED);
+    if (WPASec::isCracked(key)) {
+        flags |= CaptureIndex::FLAG_CRACKED | CaptureIndex::FLAG_UPLOADED;
+    } else if (WPASec::isUploaded(key)) {
+        flags |= CaptureIndex::FLAG_UPLOADED;
+    }
+    if (flags == rec.flags) return false;
+    rec.flags = flags;
+    return true;
+}
+
 void CapturesMenu::processAsyncWPASecUpdate() {
     if (!wpasecUpdateInProgress || captures.empty()) {
         wpasecUpdateInProgress = false;
@@ -374,6 +334,7 @@ void CapturesMenu::processAsyncWPASecUpdate() {
     size_t processed = 0;
     while (processed < WPASEC_UPDATE_CHUNK_SIZE && wpasecUpdateProgress < captures.size()) {
         auto& cap = captures[wpasecUpdateProgress];
+        CaptureStatus indexed = cap.status;
         
         // Normalize BSSID for lookup (remove colons)
         char normalized[13] = {0};
@@ -392,6 +353,7 @@ void CapturesMenu::processAsyncWPASecUpdate() {
         } else {
             cap.status = CaptureStatus::LOCAL;
         }
+        if (cap.status != indexed) indexFlagsDirty = true;
         
         wpasecUpdateProgress++;
         processed++;
@@ -407,6 +369,14 @@ void CapturesMenu::processAsyncWPASecUpdate() {
     if (wpasecUpdateProgress >= captures.size()) {
         wpasecUpdateInProgress = false;
         Serial.printf("[CAPTURES] Async WPA-SEC update complete. Updated %d captures\n", captures.size());
+
+        // Index flags lag the WPA-SEC lists: bring every record up to date
+        // in one pass so the next open shows the right status immediately
+        if (indexFlagsDirty) {
+            size_t changed = CaptureIndex::update(syncIndexFlags, nullptr);
+            indexFlagsDirty = false;
+            Serial.printf("[CAPTURES] Index flags refreshed: %u\n", (unsigned int)changed);
+        }
     }
 }
 
@@ -775,6 +745,7 @@ void CapturesMenu::nukeLoot() {
     }
     
     Serial.printf("[CAPTURES] Nuked %d files\n", deleted);
+    CaptureIndex::invalidate();
     
     // Reset selection
     selectedIndex = 0;
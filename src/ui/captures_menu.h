@@ -6,6 +6,7 @@
 #include <vector>
 #include <FS.h>
 #include <SD.h>
+#include "../core/capture_index.h"
 
 // WPA-SEC status for display
 enum class CaptureStatus {
@@ -70,18 +71,18 @@ private:
     static void formatTime(char* out, size_t len, time_t t);
     static const size_t MAX_CAPTURES = 100;
     
-    // Async scan state
+    // Async scan state (only while the capture index is rebuilt)
     static bool scanInProgress;
     static unsigned long lastScanTime;
     static const unsigned long SCAN_DELAY = 50; // ms between scan chunks
-    static File scanDir;
-    static File currentFile;
     static bool scanComplete;
-    static size_t scanProgress;
-    static const size_t SCAN_CHUNK_SIZE = 5; // files to process per chunk
+    static const size_t SCAN_CHUNK_SIZE = 16; // files to index per chunk
     
     // Async scan processing
     static void processAsyncScan();
+    static void loadFromIndex();
+    static bool collectCapture(const CaptureIndex::Record& rec, uint32_t slot, void* ctx);
+    static void fillCaptureInfo(CaptureInfo& info, const CaptureIndex::Record& rec);
     
     // Async WPA-SEC status update state
     static bool wpasecUpdateInProgress;
@@ -92,6 +93,8 @@ private:
     
     // Async WPA-SEC status update processing
     static void processAsyncWPASecUpdate();
+    static bool indexFlagsDirty;  // A status differed from the index flags
+    static bool syncIndexFlags(CaptureIndex::Record& rec, void* ctx);
     
     // WPA-SEC Sync modal state
     static bool syncModalActive;
@@ -13,6 +13,10 @@
 #include "../core/heap_health.h"
 #include "../core/heap_policy.h"
 #include "../core/wifi_utils.h"
+#include "../core/network_recon.h"
+#include "../core/path_timing.h"
+#include "../core/eapol_slab.h"
+#include "../core/sdlog.h"
 #include <WiFi.h>
 #include <esp_heap_caps.h>
 #include <esp_wifi.h>
@@ -24,11 +28,22 @@ uint16_t DiagnosticsMenu::cachedWpaCracked = 0;
 uint16_t DiagnosticsMenu::cachedWigleUploaded = 0;
 uint32_t DiagnosticsMenu::lastStatRefreshMs = 0;
 uint32_t DiagnosticsMenu::statRefreshIntervalMs = 2000;  // tighter refresh interval
+bool DiagnosticsMenu::showPaths = false;
+
+// Microseconds with one decimal below 10us, whole numbers above
+static void formatUs(char* buf, size_t len, uint32_t ns) {
+    if (ns < 10000) {
+        snprintf(buf, len, "%u.%u", (unsigned)(ns / 1000), (unsigned)((ns % 1000) / 100));
+    } else {
+        snprintf(buf, len, "%u", (unsigned)(ns / 1000));
+    }
+}
 
 void DiagnosticsMenu::show() {
     active = true;
     keyWasPressed = true;  // Ignore the Enter that brought us here
     lastStatRefreshMs = 0; // force immediate refresh
+    showPaths = false;
     HeapHealth::setKnuthEnabled(true);
 }
 
@@ -83,6 +98,19 @@ void DiagnosticsMenu::update() {
         return;
     }
 
+    // P key - toggle callback timing page
+    if (M5Cardputer.Keyboard.isKeyPressed('p') || M5Cardputer.Keyboard.isKeyPressed('P')) {
+        showPaths = !showPaths;
+        return;
+    }
+
+    // C key - clear callback timings (timing page only)
+    if (showPaths && (M5Cardputer.Keyboard.isKeyPressed('c') || M5Cardputer.Keyboard.isKeyPressed('C'))) {
+        PathTiming::reset();
+        Display::setTopBarMessage("TIMINGS CLEARED", 3000);
+        return;
+    }
+
     // Periodically refresh stats (e.g., every 5 seconds)
     if (millis() - lastStatRefreshMs > statRefreshIntervalMs) {
         refreshStats();
@@ -167,6 +195,54 @@ void DiagnosticsMenu::saveSnapshot() {
     file.printf("  Is Charging: %s\n", M5.Power.isCharging() ? "YES" : "NO");
     file.printf("\n");
 
+    // Recon frame pipeline
+    NetworkRecon::FrameRingStats ring = NetworkRecon::getFrameRingStats();
+    file.printf("RECON FRAME RING:\n");
+    file.printf("  Packets: %u\n", (unsigned int)NetworkRecon::getPacketCount());
+    file.printf("  Queued: %u  Drained: %u  Dropped: %u\n",
+                (unsigned int)ring.queued, (unsigned int)ring.drained, (unsigned int)ring.dropped);
+    file.printf("  Depth: %u/%u  High Water: %u\n",
+                (unsigned int)ring.depth, (unsigned int)ring.capacity, (unsigned int)ring.highWater);
+    file.printf("  Add Queue Drops: %u\n", (unsigned int)ring.pendingAddDrops);
+    file.printf("\n");
+
+    // Handshake frame storage (pool only exists while OINK/DNH run)
+    EapolSlab::Stats slab = EapolSlab::getStats();
+    file.printf("EAPOL SLAB:\n");
+    file.printf("  Chunks: %u/%u  High Water: %u  Largest Free: %u\n",
+                (unsigned int)slab.chunksUsed, (unsigned int)slab.chunksTotal,
+                (unsigned int)slab.highWater, (unsigned int)slab.largestFree);
+    file.printf("  Bytes Stored: %u  Alloc Fails: %u\n",
+                (unsigned int)slab.bytesStored, (unsigned int)slab.allocFails);
+    file.printf("\n");
+
+    // Async SD log ring (counters stay zero until logging is enabled)
+    SDLog::Stats sdlog = SDLog::getStats();
+    file.printf("SD LOG:\n");
+    file.printf("  Queued: %u  Written: %u  Pending: %u  High Water: %u\n",
+                (unsigned int)sdlog.queued, (unsigned int)sdlog.linesWritten,
+                (unsigned int)sdlog.pending, (unsigned int)sdlog.highWater);
+    file.printf("  Dropped: %u  Truncated: %u  Lost: %u  Writes: %u\n",
+                (unsigned int)sdlog.dropped, (unsigned int)sdlog.truncated,
+                (unsigned int)sdlog.lost, (unsigned int)sdlog.writes);
+    file.printf("\n");
+
+    // Promiscuous callback timings (ns; p99 is a bucket upper edge)
+    file.printf("CALLBACK TIMING (ns):\n");
+    file.printf("  %-11s %9s %8s %8s %8s %8s\n", "PATH", "COUNT", "MIN", "AVG", "P99", "MAX");
+    for (uint8_t i = 0; i < (uint8_t)PathTiming::Path::Count; i++) {
+        PathTiming::Summary s = PathTiming::summarize((PathTiming::Path)i);
+        file.printf("  %-11s %9u %8u %8u %8u %8u\n", PathTiming::pathName((PathTiming::Path)i),
+                    (unsigned int)s.count, (unsigned int)s.minNs, (unsigned int)s.avgNs,
+                    (unsigned int)s.p99Ns, (unsigned int)s.maxNs);
+    }
+    file.printf("QUEUE DROPS:\n");
+    for (uint8_t i = 0; i < (uint8_t)PathTiming::Drop::Count; i++) {
+        file.printf("  %s: %u\n", PathTiming::dropName((PathTiming::Drop)i),
+                    (unsigned int)PathTiming::getDrops((PathTiming::Drop)i));
+    }
+    file.printf("\n");
+
     file.close();
 }
 
@@ -235,6 +311,11 @@ void DiagnosticsMenu::draw(M5Canvas& canvas) {
     canvas.setTextColor(COLOR_FG);
     canvas.setTextSize(1);
 
+    if (showPaths) {
+        drawPaths(canvas);
+        return;
+    }
+
     int y = 2;
     int lineH = 14;
 
@@ -361,7 +442,60 @@ void DiagnosticsMenu::draw(M5Canvas& canvas) {
     y += lineH + 6;
 
     // Controls (compressed)
-    canvas.drawString("[ENT]SAVE [R]WIFI", 4, y);
+    canvas.drawString("[ENT]SAVE [R]WIFI [P]TIMING", 4, y);
     y += lineH;
     canvas.drawString("[H]HEAP [G]GC [BKSPC]BACK", 4, y);
 }
+
+void DiagnosticsMenu::drawPaths(M5Canvas& canvas) {
+    int y = 2;
+    const int lineH = 9;
+
+    // Times in microseconds
+    canvas.drawString("PATH", 4, y);
+    canvas.drawString("N", 78, y);
+    canvas.drawString("AVG", 126, y);
+    canvas.drawString("P99", 162, y);
+    canvas.drawString("MAX", 198, y);
+    y += lineH + 1;
+
+    char buf[16];
+    for (uint8_t i = 0; i < (uint8_t)PathTiming::Path::Count; i++) {
+        PathTiming::Summary s = PathTiming::summarize((PathTiming::Path)i);
+        canvas.drawString(PathTiming::pathName((PathTiming::Path)i), 4, y);
+        if (s.count >= 100000) {
+            snprintf(buf, sizeof(buf), "%uk", (unsigned)(s.count / 1000));
+        } else {
+            snprintf(buf, sizeof(buf), "%u", (unsigned)s.count);
+        }
+        canvas.drawString(buf, 78, y);
+        if (s.count > 0) {
+            formatUs(buf, sizeof(buf), s.avgNs);
+            canvas.drawString(buf, 126, y);
+            formatUs(buf, sizeof(buf), s.p99Ns);
+            canvas.drawString(buf, 162, y);
+            formatUs(buf, sizeof(buf), s.maxNs);
+            canvas.drawString(buf, 198, y);
+        }
+        y += lineH;
+    }
+    y += 2;
+
+    // Hand-off queue drops: recon ring + pending adds, then mode pools
+    NetworkRecon::FrameRingStats ring = NetworkRecon::getFrameRingStats();
+    char line[48];
+    snprintf(line, sizeof(line), "DROP RING:%u NET:%u",
+             (unsigned)ring.dropped, (unsigned)ring.pendingAddDrops);
+    canvas.drawString(line, 4, y);
+    y += lineH;
+    snprintf(line, sizeof(line), "OINK HS:%u PMK:%u DNH HS:%u PMK:%u INC:%u",
+             (unsigned)PathTiming::getDrops(PathTiming::Drop::OinkPendingHs),
+             (unsigned)PathTiming::getDrops(PathTiming::Drop::OinkPendingPmkid),
+             (unsigned)PathTiming::getDrops(PathTiming::Drop::DnhPendingHs),
+             (unsigned)PathTiming::getDrops(PathTiming::Drop::DnhPendingPmkid),
+             (unsigned)PathTiming::getDrops(PathTiming::Drop::DnhPendingIncomplete));
+    canvas.drawString(line, 4, y);
+    y += lineH + 2;
+
+    canvas.drawString("[P]PAGE [C]CLEAR [ENT]SAVE", 4, y);
+}
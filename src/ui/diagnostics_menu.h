@@ -19,9 +19,11 @@ private:
     static uint16_t cachedWigleUploaded;
     static uint32_t lastStatRefreshMs;
     static uint32_t statRefreshIntervalMs;
+    static bool showPaths;  // Second page: promiscuous callback timings
     static void saveSnapshot();
     static void resetWiFi();
     static void logHeapSnapshot();
     static void collectGarbage();
     static void refreshStats();
+    static void drawPaths(M5Canvas& canvas);
 };
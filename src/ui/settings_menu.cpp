@@ -60,6 +60,7 @@ enum SettingId : uint8_t {
     SET_BLE_BURST,
     SET_BLE_ADV,
     SET_SD_LOG,
+    SET_SD_LOG_BIN,
     SET_CALLSIGN
 };
 
@@ -154,7 +155,8 @@ static const EntryData kBleEntries[] = {
 // ML entries removed for heap savings
 
 static const EntryData kLogEntries[] = {
-    {SET_SD_LOG, "SD LOG", SettingType::TOGGLE, 0, 1, 1, "", "DEBUG SPAM TO SD"}
+    {SET_SD_LOG, "SD LOG", SettingType::TOGGLE, 0, 1, 1, "", "DEBUG SPAM TO SD"},
+    {SET_SD_LOG_BIN, "BIN LOG", SettingType::TOGGLE, 0, 1, 1, "", "COMPACT, DECODE ON PC"}
 };
 
 static const char* const kG0ActionLabels[G0_ACTION_COUNT] = {
@@ -543,6 +545,8 @@ static int getSettingValue(SettingId id) {
             return Config::ble().advDuration;
         case SET_SD_LOG:
             return SDLog::isEnabled() ? 1 : 0;
+        case SET_SD_LOG_BIN:
+            return SDLog::isBinary() ? 1 : 0;
         default:
             return 0;
     }
@@ -759,6 +763,12 @@ static bool setSettingValue(SettingId id, int value) {
             SDLog::setEnabled(enabled);
             return true;
         }
+        case SET_SD_LOG_BIN: {
+            bool binary = value != 0;
+            if (SDLog::isBinary() == binary) return false;
+            SDLog::setBinary(binary);
+            return true;
+        }
         default:
             return false;
     }
@@ -0,0 +1,473 @@
+// CrackedIndex - Sorted on-SD index of the WPA-SEC potfile
+
+#include "cracked_index.h"
+#include "../core/config.h"
+#include "../core/sd_layout.h"
+#include <Arduino.h>
+#include <SD.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+namespace CrackedIndex {
+
+namespace {
+
+static constexpr uint8_t kMagic[4] = {'P', 'W', 'R', 'X'};
+static constexpr size_t kFenceBytes = kFences * 6;
+static constexpr size_t kRecordsAt = kHeaderBytes + kFenceBytes;
+
+struct Header {
+    uint32_t count;
+    uint32_t sourceBytes;
+    uint32_t stride;
+};
+
+// Open state: header and fences in RAM, plus the last page and lookup
+bool opened = false;
+Header header = {0, 0, 1};
+uint8_t fences[kFences][6];
+Record page[kPageRecords];
+uint32_t pageFirst = 0;
+uint32_t pageLen = 0;          // 0 = nothing cached
+uint8_t lastBssid[6];
+bool lastValid = false;
+const Entry* lastResult = nullptr;
+Entry lastEntry;
+
+enum PathId : uint8_t { PATH_RUN_A, PATH_RUN_B, PATH_OUT };
+
+const char* scratchPath(PathId id) {
+    static const char* const kSuffix[] = {".a", ".b", ".tmp"};
+    static char paths[3][64];
+    snprintf(paths[id], sizeof(paths[id]), "%s%s", SDLayout::crackedIndexPath(), kSuffix[id]);
+    return paths[id];
+}
+
+int hexNibble(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+// BSSID order, then potfile order (earlier line first)
+bool recordLess(const Record& a, const Record& b) {
+    int c = memcmp(a.bssid, b.bssid, 6);
+    if (c != 0) return c < 0;
+    return a.offset < b.offset;
+}
+
+bool readHeader(File& f, Header& out) {
+    uint8_t hdr[kHeaderBytes];
+    if (f.read(hdr, sizeof(hdr)) != sizeof(hdr)) return false;
+    if (memcmp(hdr, kMagic, sizeof(kMagic)) != 0) return false;
+    uint16_t version, recordBytes;
+    memcpy(&version, hdr + 4, 2);
+    memcpy(&recordBytes, hdr + 6, 2);
+    if (version != kVersion || recordBytes != kRecordBytes) return false;
+    memcpy(&out.count, hdr + 8, 4);
+    memcpy(&out.sourceBytes, hdr + 12, 4);
+    memcpy(&out.stride, hdr + 16, 4);
+    return out.stride > 0 && f.size() == kRecordsAt + (size_t)out.count * kRecordBytes;
+}
+
+bool writeHeader(File& f, const Header& h) {
+    uint8_t hdr[kHeaderBytes] = {0};
+    memcpy(hdr, kMagic, sizeof(kMagic));
+    uint16_t version = kVersion;
+    uint16_t recordBytes = kRecordBytes;
+    memcpy(hdr + 4, &version, 2);
+    memcpy(hdr + 6, &recordBytes, 2);
+    memcpy(hdr + 8, &h.count, 4);
+    memcpy(hdr + 12, &h.sourceBytes, 4);
+    memcpy(hdr + 16, &h.stride, 4);
+    return f.write(hdr, sizeof(hdr)) == sizeof(hdr);
+}
+
+// Buffered sequential reader over records [pos, end) of a record array that
+// starts origin bytes into the file; refills seek first so two readers can
+// share one File during a merge
+struct RunReader {
+    File* file;
+    size_t origin;
+    uint32_t pos;
+    uint32_t end;
+    Record* buf;
+    size_t cap;
+    size_t len;
+    size_t at;
+    bool failed;
+
+    const Record* peek() {
+        if (at < len) return &buf[at];
+        if (pos >= end) return nullptr;
+        size_t n = end - pos < cap ? end - pos : cap;
+        if (!file->seek(origin + (size_t)pos * kRecordBytes) ||
+            file->read((uint8_t*)buf, n * kRecordBytes) != n * kRecordBytes) {
+            failed = true;
+            return nullptr;
+        }
+        pos += (uint32_t)n;
+        len = n;
+        at = 0;
+        return &buf[0];
+    }
+};
+
+struct RunWriter {
+    File* file;
+    Record* buf;
+    size_t cap;
+    size_t len;
+    bool failed;
+
+    void put(const Record& r) {
+        buf[len++] = r;
+        if (len == cap) flush();
+    }
+
+    void flush() {
+        if (len && !failed) {
+            failed = file->write((const uint8_t*)buf, len * kRecordBytes) != len * kRecordBytes;
+        }
+        len = 0;
+    }
+};
+
+// Pass 0: parse the potfile from its current position into sorted runs of
+// kRunRecords in PATH_RUN_A
+bool writeRuns(File& potfile, Record* work, uint32_t& total) {
+    File out = SD.open(scratchPath(PATH_RUN_A), FILE_WRITE);
+    if (!out) return false;
+    char lineBuf[160];
+    size_t n = 0;
+    bool ok = true;
+    total = 0;
+    while (ok && potfile.available()) {
+        size_t lineAt = potfile.position();
+        size_t len = potfile.readBytesUntil('\n', lineBuf, sizeof(lineBuf) - 1);
+        lineBuf[len] = '\0';
+        while (len > 0 && (lineBuf[len - 1] == '\r' || lineBuf[len - 1] == ' ')) {
+            lineBuf[--len] = '\0';
+        }
+        Record& r = work[n];
+        size_t ssidAt, ssidLen, passwordLen;
+        if (!parseLine(lineBuf, len, r.bssid, ssidAt, ssidLen, passwordLen)) continue;
+        r.ssidLen = (uint8_t)ssidLen;
+        r.passwordLen = (uint8_t)passwordLen;
+        r.offset = (uint32_t)(lineAt + ssidAt);
+        total++;
+        if (++n == kRunRecords) {
+            std::sort(work, work + n, recordLess);
+            ok = out.write((const uint8_t*)work, n * kRecordBytes) == n * kRecordBytes;
+            n = 0;
+            yield();
+        }
+    }
+    if (ok && n > 0) {
+        std::sort(work, work + n, recordLess);
+        ok = out.write((const uint8_t*)work, n * kRecordBytes) == n * kRecordBytes;
+    }
+    out.close();
+    return ok;
+}
+
+// 2-way merge passes A -> B -> A ...; returns the file holding the result
+bool mergeRuns(Record* work, uint32_t count, PathId& sorted) {
+    PathId from = PATH_RUN_A;
+    bool ok = true;
+    for (uint32_t width = kRunRecords; ok && width < count; width *= 2) {
+        PathId to = from == PATH_RUN_A ? PATH_RUN_B : PATH_RUN_A;
+        File in = SD.open(scratchPath(from), FILE_READ);
+        File out = SD.open(scratchPath(to), FILE_WRITE);
+        ok = in && out;
+        RunReader a = {&in, 0, 0, 0, work, 64, 0, 0, false};
+        RunReader b = {&in, 0, 0, 0, work + 64, 64, 0, 0, false};
+        RunWriter w = {&out, work + 128, kRunRecords - 128, 0, false};
+        for (uint32_t start = 0; ok && start < count; start += 2 * width) {
+            a.pos = start;
+            a.end = start + width < count ? start + width : count;
+            b.pos = a.end;
+            b.end = a.end + width < count ? a.end + width : count;
+            a.len = a.at = b.len = b.at = 0;
+            for (;;) {
+                const Record* ra = a.peek();
+                const Record* rb = b.peek();
+                if (!ra && !rb) break;
+                if (rb && (!ra || recordLess(*rb, *ra))) {
+                    w.put(*rb);
+                    b.at++;
+                } else {
+                    w.put(*ra);
+                    a.at++;
+                }
+            }
+            ok = !a.failed && !b.failed && !w.failed;
+            yield();
+        }
+        w.flush();
+        ok = ok && !w.failed;
+        if (in) in.close();
+        if (out) out.close();
+        from = to;
+    }
+    sorted = from;
+    return ok;
+}
+
+// Final pass: drop repeated BSSIDs (keep the first line), sample fences and
+// write the index with its header. With a base index, its baseCount sorted
+// records are merged in; they come from earlier potfile lines, so they win
+// over new lines for the same BSSID.
+bool writeIndex(Record* work, PathId sorted, uint32_t total, uint32_t sourceBytes,
+                File* base, uint32_t baseCount) {
+    File in = SD.open(scratchPath(sorted), FILE_READ);
+    File out = SD.open(scratchPath(PATH_OUT), FILE_WRITE);
+    bool ok = in && out;
+
+    uint32_t estimate = total + baseCount;
+    Header h = {0, sourceBytes, (uint32_t)((estimate + kFences - 1) / kFences)};
+    if (h.stride == 0) h.stride = 1;
+    memset(fences, 0xFF, sizeof(fences));
+    ok = ok && writeHeader(out, h) && out.write((const uint8_t*)fences, kFenceBytes) == kFenceBytes;
+
+    RunReader r = {&in, 0, 0, total, work, 64, 0, 0, false};
+    RunReader b = {base, kRecordsAt, 0, base ? baseCount : 0, work + 64, 64, 0, 0, false};
+    RunWriter w = {&out, work + 128, kRunRecords - 128, 0, false};
+    uint8_t prev[6];
+    bool havePrev = false;
+    while (ok) {
+        const Record* rec = r.peek();
+        const Record* old = b.peek();
+        if (!rec && !old) break;
+        if (old && (!rec || memcmp(old->bssid, rec->bssid, 6) <= 0)) {
+            rec = old;
+            b.at++;
+        } else {
+            r.at++;
+        }
+        if (havePrev && memcmp(prev, rec->bssid, 6) == 0) continue;
+        memcpy(prev, rec->bssid, 6);
+        havePrev = true;
+        if (h.count % h.stride == 0) memcpy(fences[h.count / h.stride], rec->bssid, 6);
+        w.put(*rec);
+        h.count++;
+    }
+    w.flush();
+    ok = ok && !r.failed && !b.failed && !w.failed;
+    ok = ok && out.seek(0) && writeHeader(out, h) &&
+         out.write((const uint8_t*)fences, kFenceBytes) == kFenceBytes;
+    if (in) in.close();
+    if (out) out.close();
+    header = h;
+    return ok;
+}
+
+// Sort the potfile from fromBytes on and write it as the new index, merged
+// with the current index when base is given
+bool build(File& potfile, uint32_t fromBytes, File* base, uint32_t baseCount,
+           uint32_t& lines) {
+    uint32_t sourceBytes = (uint32_t)potfile.size();
+    Record* work = (Record*)malloc(kRunRecords * sizeof(Record));
+    if (!work) return false;
+    lines = 0;
+    PathId sorted = PATH_RUN_A;
+    bool ok = potfile.seek(fromBytes) && writeRuns(potfile, work, lines);
+    ok = ok && mergeRuns(work, lines, sorted);
+    ok = ok && writeIndex(work, sorted, lines, sourceBytes, base, baseCount);
+    free(work);
+    SD.remove(scratchPath(PATH_RUN_A));
+    SD.remove(scratchPath(PATH_RUN_B));
+    return ok;
+}
+
+bool install(bool ok) {
+    const char* path = SDLayout::crackedIndexPath();
+    if (ok) {
+        SD.remove(path);
+        ok = SD.rename(scratchPath(PATH_OUT), path);
+    }
+    if (!ok) SD.remove(scratchPath(PATH_OUT));
+    return ok;
+}
+
+bool rebuild() {
+    File potfile = SD.open(SDLayout::wpasecResultsPath(), FILE_READ);
+    if (!potfile) return false;
+    uint32_t total = 0;
+    bool ok = build(potfile, 0, nullptr, 0, total);
+    potfile.close();
+    if (!install(ok)) {
+        Serial.println("[WPAIDX] Rebuild failed");
+        return false;
+    }
+    Serial.printf("[WPAIDX] Rebuilt: %lu cracked (%lu potfile lines)\n",
+                  (unsigned long)header.count, (unsigned long)total);
+    return true;
+}
+
+bool loadIndex(uint32_t sourceBytes) {
+    File f = SD.open(SDLayout::crackedIndexPath(), FILE_READ);
+    if (!f) return false;
+    Header h;
+    bool ok = readHeader(f, h) && h.sourceBytes == sourceBytes &&
+              f.read((uint8_t*)fences, kFenceBytes) == kFenceBytes;
+    f.close();
+    if (ok) header = h;
+    return ok;
+}
+
+bool readRecords(uint32_t first, uint32_t n, Record* out) {
+    File f = SD.open(SDLayout::crackedIndexPath(), FILE_READ);
+    if (!f) return false;
+    bool ok = f.seek(kRecordsAt + (size_t)first * kRecordBytes) &&
+              f.read((uint8_t*)out, n * kRecordBytes) == n * kRecordBytes;
+    f.close();
+    return ok;
+}
+
+// SSID and password text for a record, from the potfile
+bool readEntry(const Record& r, Entry& out) {
+    File f = SD.open(SDLayout::wpasecResultsPath(), FILE_READ);
+    if (!f) return false;
+    char buf[2 * 255 + 2];
+    size_t n = (size_t)r.ssidLen + 1 + r.passwordLen;
+    bool ok = f.seek(r.offset) && f.read((uint8_t*)buf, n) == n;
+    f.close();
+    if (!ok) return false;
+    size_t ssidLen = r.ssidLen < sizeof(out.ssid) ? r.ssidLen : sizeof(out.ssid) - 1;
+    memcpy(out.ssid, buf, ssidLen);
+    out.ssid[ssidLen] = '\0';
+    size_t pwLen = r.passwordLen < sizeof(out.password) ? r.passwordLen : sizeof(out.password) - 1;
+    memcpy(out.password, buf + r.ssidLen + 1, pwLen);
+    out.password[pwLen] = '\0';
+    return true;
+}
+
+}  // namespace
+
+bool parseLine(const char* line, size_t len, uint8_t bssid[6], size_t& ssidAt,
+               size_t& ssidLen, size_t& passwordLen) {
+    // AP BSSID at 0-11 (colon at 12), client BSSID at 13-24 (colon at 25),
+    // then SSID up to the next colon; the password may contain colons
+    if (len < 27 || line[12] != ':' || line[25] != ':') return false;
+    const char* third = (const char*)memchr(line + 26, ':', len - 26);
+    if (!third) return false;
+    for (int i = 0; i < 6; i++) {
+        int hi = hexNibble(line[i * 2]);
+        int lo = hexNibble(line[i * 2 + 1]);
+        if (hi < 0 || lo < 0) return false;
+        bssid[i] = (uint8_t)((hi << 4) | lo);
+    }
+    ssidAt = 26;
+    ssidLen = (size_t)(third - line) - ssidAt;
+    passwordLen = len - ssidAt - ssidLen - 1;
+    return ssidLen <= 255 && passwordLen <= 255;
+}
+
+bool open() {
+    if (opened) return true;
+    if (!Config::isSDAvailable()) return false;
+    File potfile = SD.open(SDLayout::wpasecResultsPath(), FILE_READ);
+    if (!potfile) return false;
+    uint32_t sourceBytes = (uint32_t)potfile.size();
+    potfile.close();
+
+    pageLen = 0;
+    lastValid = false;
+    if (!loadIndex(sourceBytes) && !rebuild()) return false;
+    opened = true;
+    return true;
+}
+
+bool isOpen() {
+    return opened;
+}
+
+bool merge(uint32_t fromBytes, uint32_t& added) {
+    added = 0;
+    if (!Config::isSDAvailable()) return false;
+    close();
+    if (!loadIndex(fromBytes)) return false;
+    uint32_t baseCount = header.count;
+
+    File potfile = SD.open(SDLayout::wpasecResultsPath(), FILE_READ);
+    if (!potfile) return false;
+    File base = SD.open(SDLayout::crackedIndexPath(), FILE_READ);
+    uint32_t lines = 0;
+    bool ok = base && potfile.size() >= fromBytes &&
+              build(potfile, fromBytes, &base, baseCount, lines);
+    potfile.close();
+    if (base) base.close();
+    if (!install(ok)) {
+        Serial.println("[WPAIDX] Merge failed");
+        return false;
+    }
+    added = header.count - baseCount;
+    opened = true;
+    Serial.printf("[WPAIDX] Merged %lu new lines: %lu cracked (+%lu)\n",
+                  (unsigned long)lines, (unsigned long)header.count, (unsigned long)added);
+    return true;
+}
+
+const Entry* find(const uint8_t bssid[6]) {
+    if (!opened || header.count == 0) return nullptr;
+    if (lastValid && memcmp(lastBssid, bssid, 6) == 0) return lastResult;
+
+    // Fences: the stride-sized range that can hold the BSSID
+    uint32_t fenceCount = (header.count + header.stride - 1) / header.stride;
+    uint32_t f = 0;
+    while (f + 1 < fenceCount && memcmp(fences[f + 1], bssid, 6) <= 0) f++;
+    uint32_t lo = f * header.stride;
+    uint32_t hi = lo + header.stride < header.count ? lo + header.stride : header.count;
+
+    // Binary search on single records until the range fits one page
+    Record probe;
+    while (hi - lo > kPageRecords) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (!readRecords(mid, 1, &probe)) return nullptr;
+        if (memcmp(probe.bssid, bssid, 6) <= 0) lo = mid;
+        else hi = mid;
+    }
+    if (pageLen == 0 || lo < pageFirst || hi > pageFirst + pageLen) {
+        uint32_t n = header.count - lo < kPageRecords ? header.count - lo : kPageRecords;
+        if (!readRecords(lo, n, page)) {
+            pageLen = 0;
+            return nullptr;
+        }
+        pageFirst = lo;
+        pageLen = n;
+    }
+
+    memcpy(lastBssid, bssid, 6);
+    lastValid = true;
+    lastResult = nullptr;
+    for (uint32_t i = lo - pageFirst; i < hi - pageFirst; i++) {
+        int c = memcmp(page[i].bssid, bssid, 6);
+        if (c > 0) break;
+        if (c == 0) {
+            if (readEntry(page[i], lastEntry)) lastResult = &lastEntry;
+            else lastValid = false;
+            break;
+        }
+    }
+    return lastResult;
+}
+
+uint32_t count() {
+    return opened ? header.count : 0;
+}
+
+void close() {
+    opened = false;
+    pageLen = 0;
+    lastValid = false;
+}
+
+void invalidate() {
+    close();
+    if (Config::isSDAvailable()) SD.remove(SDLayout::crackedIndexPath());
+}
+
+}  // namespace CrackedIndex
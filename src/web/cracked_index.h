@@ -0,0 +1,69 @@
+// CrackedIndex - Sorted on-SD index of the WPA-SEC potfile
+// The potfile (wpasec_results.txt) stays as downloaded; the index holds one
+// fixed record per AP BSSID, sorted by the 48-bit BSSID, pointing at the
+// SSID/password text in the potfile. Lookups narrow with a small fence
+// table held in RAM, then read one page of records: no per-entry heap and
+// no cap on the number of results.
+//
+// File:   32-byte header ("PWRX", u16 version, u16 record size, u32 count,
+//         u32 potfile bytes, u32 fence stride, 12 reserved), kFences BSSID
+//         fences (every stride-th record), then Record[] sorted by BSSID.
+//         A different potfile size makes the index stale.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CrackedIndex {
+
+static constexpr uint16_t kVersion = 1;
+static constexpr size_t kHeaderBytes = 32;
+static constexpr size_t kRecordBytes = 12;
+static constexpr size_t kFences = 64;
+static constexpr size_t kPageRecords = 32;      // One SD read per lookup
+static constexpr size_t kRunRecords = 256;      // 3 KiB sort run while building
+
+struct Record {
+    uint8_t bssid[6];
+    uint8_t ssidLen;        // Field lengths in the potfile line
+    uint8_t passwordLen;
+    uint32_t offset;        // Potfile byte offset of the SSID
+};
+static_assert(sizeof(Record) == kRecordBytes, "CrackedIndex record layout");
+
+struct Entry {
+    char ssid[33];
+    char password[64];
+};
+
+// Check the index against the potfile, rebuilding it if missing or stale,
+// and load the fence table. Cheap once open. False with no potfile or on
+// SD error (lookups then miss).
+bool open();
+bool isOpen();
+
+// Lines were appended to a potfile that was fromBytes long: sort just the
+// new lines and merge them into the index (no reparse of the old lines).
+// added = BSSIDs not in the index before. False when the index on SD does
+// not match fromBytes; open() then rebuilds from scratch.
+bool merge(uint32_t fromBytes, uint32_t& added);
+
+// Entry for the AP BSSID, or nullptr. The pointer stays valid until the
+// next lookup; the first line for a BSSID in the potfile wins.
+const Entry* find(const uint8_t bssid[6]);
+
+// Distinct cracked BSSIDs (0 when not open)
+uint32_t count();
+
+// Forget the in-RAM state; the next open() re-validates
+void close();
+
+// The potfile was rewritten: drop the index so open() rebuilds it
+void invalidate();
+
+// Potfile line "AP:CLIENT:SSID:password" (12 hex each BSSID). On success
+// the SSID is line[ssidAt, ssidAt + ssidLen) and the password follows it.
+bool parseLine(const char* line, size_t len, uint8_t bssid[6], size_t& ssidAt,
+               size_t& ssidLen, size_t& passwordLen);
+
+}  // namespace CrackedIndex
@@ -0,0 +1,400 @@
+// DirIndex - Cached on-SD listing of one directory for paged /api/ls
+
+#include "dir_index.h"
+#include "../core/config.h"
+#include "../core/sd_layout.h"
+#include <Arduino.h>
+#include <SD.h>
+#include <esp_random.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <algorithm>
+
+namespace DirIndex {
+
+namespace {
+
+static constexpr uint8_t kMagic[4] = {'P', 'L', 'S', 'X'};
+static constexpr uint16_t kVersion = 1;
+static constexpr size_t kReadChunk = 8;          // Records per SD read in read()
+
+struct Header {
+    uint8_t magic[4];
+    uint16_t version;
+    uint16_t recordBytes;
+    uint32_t generation;
+    uint32_t source;        // Base generation a sorted view was built from
+    uint32_t count;
+    uint8_t sort;
+    uint8_t descending;
+    uint8_t reserved[2];
+    char dir[168];
+};
+static_assert(sizeof(Header) == 192, "DirIndex header layout");
+
+enum PathId : uint8_t { PATH_BASE, PATH_VIEW, PATH_TMP_A, PATH_TMP_B };
+
+const char* indexPath(PathId id) {
+    static const char* const kNames[] = {"ls_base.idx", "ls_view.idx", "ls_a.tmp", "ls_b.tmp"};
+    static char paths[4][64];
+    const char* meta = SDLayout::metaDir();
+    snprintf(paths[id], sizeof(paths[id]), "%s%s%s", meta,
+             meta[strlen(meta) - 1] == '/' ? "" : "/", kNames[id]);
+    return paths[id];
+}
+
+bool isOwnFile(const char* path) {
+    for (uint8_t id = PATH_BASE; id <= PATH_TMP_B; id++) {
+        if (strcmp(path, indexPath((PathId)id)) == 0) return true;
+    }
+    return false;
+}
+
+uint32_t newGeneration() {
+    uint32_t g = esp_random();
+    return g ? g : 1;
+}
+
+bool readHeader(PathId id, Header& hdr) {
+    File f = SD.open(indexPath(id), FILE_READ);
+    if (!f) return false;
+    bool ok = f.read((uint8_t*)&hdr, sizeof(hdr)) == sizeof(hdr) &&
+              memcmp(hdr.magic, kMagic, sizeof(kMagic)) == 0 &&
+              hdr.version == kVersion && hdr.recordBytes == kRecordBytes &&
+              hdr.dir[sizeof(hdr.dir) - 1] == '\0' &&
+              f.size() == sizeof(Header) + (size_t)hdr.count * kRecordBytes;
+    f.close();
+    return ok;
+}
+
+void initHeader(Header& hdr, const char* dir) {
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, kMagic, sizeof(kMagic));
+    hdr.version = kVersion;
+    hdr.recordBytes = kRecordBytes;
+    strncpy(hdr.dir, dir, sizeof(hdr.dir) - 1);
+}
+
+bool replaceWith(PathId from, PathId to) {
+    SD.remove(indexPath(to));
+    return SD.rename(indexPath(from), indexPath(to));
+}
+
+// One walk of the directory into the base listing (FAT order)
+bool buildBase(const char* dir, Header& hdr) {
+    File root = SD.open(dir);
+    if (!root || !root.isDirectory()) {
+        if (root) root.close();
+        return false;
+    }
+    const char* metaDir = SDLayout::metaDir();
+    if (!SD.exists(metaDir)) SD.mkdir(metaDir);
+    File out = SD.open(indexPath(PATH_TMP_A), FILE_WRITE);
+    initHeader(hdr, dir);
+    if (!out || out.write((const uint8_t*)&hdr, sizeof(hdr)) != sizeof(hdr)) {
+        if (out) out.close();
+        root.close();
+        return false;
+    }
+
+    bool ok = true;
+    uint32_t count = 0;
+    File f = root.openNextFile();
+    while (f) {
+        const char* path = f.path();
+        const char* slash = strrchr(f.name(), '/');
+        const char* name = slash ? slash + 1 : f.name();
+        size_t nameLen = strlen(name);
+        if (!isOwnFile(path)) {
+            if (nameLen > kMaxNameBytes || count >= kMaxEntries) {
+                ok = false;
+                f.close();
+                break;
+            }
+            Entry e;
+            memset(&e, 0, sizeof(e));
+            e.isDir = f.isDirectory() ? 1 : 0;
+            e.size = e.isDir ? 0 : (uint32_t)f.size();
+            e.mtime = (uint32_t)f.getLastWrite();
+            memcpy(e.name, name, nameLen);
+            if (out.write((const uint8_t*)&e, sizeof(e)) != sizeof(e)) {
+                ok = false;
+                f.close();
+                break;
+            }
+            count++;
+        }
+        f.close();
+        if ((count & 15) == 0) yield();
+        f = root.openNextFile();
+    }
+    root.close();
+
+    if (ok) {
+        hdr.generation = newGeneration();
+        hdr.count = count;
+        ok = out.seek(0) && out.write((const uint8_t*)&hdr, sizeof(hdr)) == sizeof(hdr);
+    }
+    out.close();
+    if (!ok || !replaceWith(PATH_TMP_A, PATH_BASE)) {
+        SD.remove(indexPath(PATH_TMP_A));
+        Serial.printf("[DIRIDX] Not indexing %s (%lu entries so far)\n", dir, (unsigned long)count);
+        return false;
+    }
+    Serial.printf("[DIRIDX] Indexed %s: %lu entries\n", dir, (unsigned long)count);
+    return true;
+}
+
+// Directories first; ties broken by name so the order is total
+int compareEntries(const Entry& a, const Entry& b, Sort sort, bool descending) {
+    if (a.isDir != b.isDir) return a.isDir ? -1 : 1;
+    int c = 0;
+    if (sort == Sort::Size && a.size != b.size) c = a.size < b.size ? -1 : 1;
+    if (sort == Sort::Mtime && a.mtime != b.mtime) c = a.mtime < b.mtime ? -1 : 1;
+    if (c == 0) c = strcasecmp(a.name, b.name);
+    if (c == 0) c = strcmp(a.name, b.name);
+    return descending ? -c : c;
+}
+
+// Buffered sequential reader over records [pos, end) of a file whose
+// records start at byte offset base. Refills seek first, so two readers can
+// share one File handle during a merge.
+struct RunReader {
+    File* file;
+    size_t base;
+    uint32_t pos;
+    uint32_t end;
+    Entry* buf;
+    size_t cap;
+    size_t len;
+    size_t at;
+    bool failed;
+
+    const Entry* peek() {
+        if (at < len) return &buf[at];
+        if (pos >= end) return nullptr;
+        size_t n = end - pos < cap ? end - pos : cap;
+        if (!file->seek(base + (size_t)pos * kRecordBytes) ||
+            file->read((uint8_t*)buf, n * kRecordBytes) != n * kRecordBytes) {
+            failed = true;
+            return nullptr;
+        }
+        pos += (uint32_t)n;
+        len = n;
+        at = 0;
+        return &buf[0];
+    }
+};
+
+struct RunWriter {
+    File* file;
+    Entry* buf;
+    size_t cap;
+    size_t len;
+    bool failed;
+
+    void put(const Entry& e) {
+        buf[len++] = e;
+        if (len == cap) flush();
+    }
+
+    void flush() {
+        if (len && !failed) {
+            failed = file->write((const uint8_t*)buf, len * kRecordBytes) != len * kRecordBytes;
+        }
+        len = 0;
+    }
+};
+
+// Sorted view of the base listing: sorted runs of kRunRecords, then 2-way
+// merge passes between two scratch files. The last pass (or the run pass,
+// for small directories) writes the view file with its header.
+bool buildView(const Header& base, Sort sort, bool descending, Header& view) {
+    Entry* work = (Entry*)malloc(kRunRecords * sizeof(Entry));
+    if (!work) return false;
+
+    const uint32_t count = base.count;
+    uint32_t runs = (count + kRunRecords - 1) / kRunRecords;
+    uint8_t passes = 0;
+    while ((1u << passes) < runs) passes++;
+
+    view = base;
+    view.generation = newGeneration();
+    view.source = base.generation;
+    view.sort = (uint8_t)sort;
+    view.descending = descending ? 1 : 0;
+
+    auto openDst = [&](bool last, PathId scratch) -> File {
+        File f = SD.open(indexPath(last ? PATH_TMP_B : scratch), FILE_WRITE);
+        if (f && last && f.write((const uint8_t*)&view, sizeof(view)) != sizeof(view)) f.close();
+        return f;
+    };
+
+    // Pass 0: sorted runs
+    bool ok = true;
+    File src = SD.open(indexPath(PATH_BASE), FILE_READ);
+    File dst = openDst(passes == 0, PATH_TMP_A);
+    ok = src && dst && src.seek(sizeof(Header));
+    uint8_t order[kRunRecords];
+    for (uint32_t at = 0; ok && at < count; at += kRunRecords) {
+        size_t n = count - at < kRunRecords ? count - at : kRunRecords;
+        if (src.read((uint8_t*)work, n * kRecordBytes) != n * kRecordBytes) {
+            ok = false;
+            break;
+        }
+        for (size_t i = 0; i < n; i++) order[i] = (uint8_t)i;
+        std::sort(order, order + n, [&](uint8_t x, uint8_t y) {
+            return compareEntries(work[x], work[y], sort, descending) < 0;
+        });
+        for (size_t i = 0; ok && i < n; i++) {
+            ok = dst.write((const uint8_t*)&work[order[i]], kRecordBytes) == kRecordBytes;
+        }
+        yield();
+    }
+    if (src) src.close();
+    if (dst) dst.close();
+
+    // Merge passes: A -> B -> A ... (the final one into the view scratch)
+    PathId from = PATH_TMP_A;
+    uint32_t width = kRunRecords;
+    for (uint8_t pass = 1; ok && pass <= passes; pass++) {
+        bool last = pass == passes;
+        PathId to = from == PATH_TMP_A ? PATH_TMP_B : PATH_TMP_A;
+        // Intermediate passes use the scratch not being read; the view
+        // scratch is PATH_TMP_B, so the last pass must read from A
+        if (last && from == PATH_TMP_B) {
+            ok = replaceWith(PATH_TMP_B, PATH_TMP_A);
+            from = PATH_TMP_A;
+        }
+        File in = SD.open(indexPath(from), FILE_READ);
+        File out = openDst(last, to);
+        ok = ok && in && out;
+        RunReader a = {&in, 0, 0, 0, work, 12, 0, 0, false};
+        RunReader b = {&in, 0, 0, 0, work + 12, 12, 0, 0, false};
+        RunWriter w = {&out, work + 24, kRunRecords - 24, 0, false};
+        for (uint32_t start = 0; ok && start < count; start += 2 * width) {
+            a.pos = start;
+            a.end = start + width < count ? start + width : count;
+            b.pos = a.end;
+            b.end = a.end + width < count ? a.end + width : count;
+            a.len = a.at = b.len = b.at = 0;
+            for (;;) {
+                const Entry* ea = a.peek();
+                const Entry* eb = b.peek();
+                if (!ea && !eb) break;
+                if (eb && (!ea || compareEntries(*eb, *ea, sort, descending) < 0)) {
+                    w.put(*eb);
+                    b.at++;
+                } else {
+                    w.put(*ea);
+                    a.at++;
+                }
+            }
+            ok = !a.failed && !b.failed && !w.failed;
+            yield();
+        }
+        w.flush();
+        ok = ok && !w.failed;
+        if (in) in.close();
+        if (out) out.close();
+        from = to;
+        width *= 2;
+    }
+    free(work);
+
+    SD.remove(indexPath(PATH_TMP_A));
+    if (!ok || !replaceWith(PATH_TMP_B, PATH_VIEW)) {
+        SD.remove(indexPath(PATH_TMP_B));
+        Serial.printf("[DIRIDX] Sort failed for %s\n", base.dir);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+Sort parseSort(const char* s) {
+    if (!s) return Sort::None;
+    if (strcmp(s, "name") == 0) return Sort::Name;
+    if (strcmp(s, "size") == 0) return Sort::Size;
+    if (strcmp(s, "mtime") == 0) return Sort::Mtime;
+    return Sort::None;
+}
+
+bool prepare(const char* dir, Sort sort, bool descending, bool refresh, Listing& out) {
+    if (!Config::isSDAvailable() || !dir) return false;
+    Header base;
+    if (strlen(dir) >= sizeof(base.dir)) return false;
+
+    bool baseOk = !refresh && readHeader(PATH_BASE, base) && strcmp(base.dir, dir) == 0;
+    if (!baseOk) {
+        invalidate();
+        if (!buildBase(dir, base)) return false;
+    }
+    if (sort == Sort::None) {
+        out = {base.generation, base.count, Sort::None, false};
+        return true;
+    }
+
+    Header view;
+    bool viewOk = readHeader(PATH_VIEW, view) && view.source == base.generation &&
+                  view.sort == (uint8_t)sort && view.descending == (descending ? 1 : 0);
+    if (!viewOk && !buildView(base, sort, descending, view)) return false;
+    out = {view.generation, view.count, sort, descending};
+    return true;
+}
+
+uint32_t read(const Listing& listing, uint32_t slot, Visitor fn, void* ctx) {
+    PathId id = listing.sort == Sort::None ? PATH_BASE : PATH_VIEW;
+    Header hdr;
+    if (!readHeader(id, hdr) || hdr.generation != listing.generation) return slot;
+    if (slot >= hdr.count) return hdr.count;
+
+    File f = SD.open(indexPath(id), FILE_READ);
+    if (!f || !f.seek(sizeof(Header) + (size_t)slot * kRecordBytes)) {
+        if (f) f.close();
+        return slot;
+    }
+    Entry chunk[kReadChunk];
+    while (slot < hdr.count) {
+        size_t n = hdr.count - slot < kReadChunk ? hdr.count - slot : kReadChunk;
+        if (f.read((uint8_t*)chunk, n * kRecordBytes) != n * kRecordBytes) break;
+        for (size_t i = 0; i < n; i++) {
+            slot++;
+            if (!fn(chunk[i], ctx)) {
+                f.close();
+                return slot;
+            }
+        }
+    }
+    f.close();
+    return slot;
+}
+
+void invalidate() {
+    if (!Config::isSDAvailable()) return;
+    for (uint8_t id = PATH_BASE; id <= PATH_TMP_B; id++) {
+        const char* path = indexPath((PathId)id);
+        if (SD.exists(path)) SD.remove(path);
+    }
+}
+
+void formatCursor(uint32_t generation, uint32_t slot, char* out, size_t outLen) {
+    snprintf(out, outLen, "%08lx.%lu", (unsigned long)generation, (unsigned long)slot);
+}
+
+bool parseCursor(const char* s, uint32_t& generation, uint32_t& slot) {
+    if (!s || !*s) return false;
+    char* end = nullptr;
+    unsigned long g = strtoul(s, &end, 16);
+    if (end == s || *end != '.') return false;
+    const char* slotStr = end + 1;
+    unsigned long n = strtoul(slotStr, &end, 10);
+    if (end == slotStr || *end != '\0') return false;
+    generation = (uint32_t)g;
+    slot = (uint32_t)n;
+    return true;
+}
+
+}  // namespace DirIndex
@@ -0,0 +1,63 @@
+// DirIndex - Cached on-SD listing of one directory for paged /api/ls
+// The first page walks the directory once and stores fixed-size records in
+// the meta dir; every later page seeks straight to its slot instead of
+// re-walking the FAT from the start. Sorted views are built from that base
+// listing with an external merge sort (a few KiB of RAM for any size) and
+// cached next to it. One directory is cached at a time.
+//
+// Every build gets a new generation number. Paging cursors carry it, so a
+// cursor from before a rebuild is detected instead of skipping entries.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace DirIndex {
+
+static constexpr size_t kRecordBytes = 128;
+static constexpr size_t kMaxNameBytes = 118;     // Longer names: no index
+static constexpr uint32_t kMaxEntries = 16384;
+static constexpr size_t kRunRecords = 32;        // 4 KiB in-RAM sort run
+
+enum class Sort : uint8_t { None = 0, Name = 1, Size = 2, Mtime = 3 };
+
+struct Entry {
+    uint32_t size;
+    uint32_t mtime;
+    uint8_t isDir;
+    char name[kMaxNameBytes + 1];
+};
+static_assert(sizeof(Entry) == kRecordBytes, "DirIndex record layout");
+
+// An open view: pass back to read()
+struct Listing {
+    uint32_t generation;
+    uint32_t count;
+    Sort sort;
+    bool descending;
+};
+
+// Visitor for read(): return false to stop
+typedef bool (*Visitor)(const Entry& e, void* ctx);
+
+// Parse "name" / "size" / "mtime" (anything else: None)
+Sort parseSort(const char* s);
+
+// Ready the listing of dir in the requested order, reusing the cached
+// index when it is still valid. refresh forces a new walk. Sorted views
+// list directories first; descending flips the order within each group.
+// False when the directory cannot be indexed (missing, more than
+// kMaxEntries, a name longer than kMaxNameBytes, SD error).
+bool prepare(const char* dir, Sort sort, bool descending, bool refresh, Listing& out);
+
+// Visit entries from slot on. Returns the slot after the last one visited.
+uint32_t read(const Listing& listing, uint32_t slot, Visitor fn, void* ctx);
+
+// Drop all cached listings (something under the file server changed)
+void invalidate();
+
+// Opaque paging cursor "<generation hex>.<slot>"
+void formatCursor(uint32_t generation, uint32_t slot, char* out, size_t outLen);
+bool parseCursor(const char* s, uint32_t& generation, uint32_t& slot);
+
+}  // namespace DirIndex
@@ -16,8 +16,16 @@
 #include "../core/xp.h"
 #include "../ui/swine_stats.h"
 #include "../core/sd_layout.h"
+#include "../core/capture_index.h"
+#include "../core/award_ledger.h"
 #include "../core/config.h"
 #include "wigle.h"
+#include "zip_stream.h"
+#include "http_range.h"
+#include "web_assets.h"
+#include "json_writer.h"
+#include "dir_index.h"
+#include "http_scheduler.h"
 
 #ifndef PORKCHOP_LOG_ENABLED
 #define PORKCHOP_LOG_ENABLED 1
@@ -37,7 +45,7 @@
 #endif
 
 // Static members
-WebServer* FileServer::server = nullptr;
+DetachableWebServer* FileServer::server = nullptr;
 FileServerState FileServer::state = FileServerState::IDLE;
 char FileServer::statusMessage[64] = "Ready";
 char FileServer::targetSSID[64] = "";
@@ -58,6 +66,27 @@ static std::atomic<bool> uploadRejected{false};  // FIX: Atomic for cross-contex
 static std::atomic<bool> listActive{false};  // FIX: Atomic for cross-context synchronization
 static std::atomic<uint32_t> listStartTime{0};  // FIX: Atomic - accessed from callback and update loop
 static char uploadPathBuf[256] = "";  // FIX: Fixed buffer instead of String to avoid heap fragmentation
+static char uploadPartBuf[262] = "";  // Receiving side file: uploadPathBuf + ".part"
+static bool uploadResumable = false;  // Keep the partial file when the transfer drops
+static char uploadRejectMsg[64] = "";  // 409 body when the reject is not a busy server
+
+// Resumed uploads prove they continue the same file: CRC32 of the last
+// RESUME_CHECK_BYTES of the partial must match what the client holds
+static const size_t RESUME_CHECK_BYTES = 4096;
+
+// Uploads land in "<name>.part" and are renamed into place only when
+// complete, so a cut-off CSV or pcap never shows up under its real name
+// (capture index, WiGLE/WPA-SEC sync). Partials kept for a resume are
+// tracked here and deleted once abandoned: after PART_TTL_MS without a
+// resume, when the table is full, or when the server stops.
+static const char PART_SUFFIX[] = ".part";
+static const uint8_t MAX_KEPT_PARTS = 3;
+static const uint32_t PART_TTL_MS = 15UL * 60UL * 1000UL;
+struct KeptPart {
+    char path[262];
+    uint32_t keptMs;
+};
+static KeptPart keptParts[MAX_KEPT_PARTS] = {};
 
 // XP award tracking (browser-less, device-side)
 static const char* XP_WPA_AWARDED_FILE = nullptr;
@@ -69,18 +98,13 @@ static const uint16_t XP_WIGLE_PER = 10;
 static const uint16_t XP_SESSION_CAP = 200;
 static const size_t MIN_PCAP_BYTES = 300;
 static const size_t MIN_WIGLE_BYTES = 200;
-static const size_t XP_AWARD_CACHE_MAX = 512;
 static uint32_t xpLastScanMs = 0;
 static uint32_t xpLastUploadCount = 0;
 static uint16_t xpSessionAwarded = 0;
 static bool xpScanPending = false;
-static bool xpWpaLoaded = false;
-static bool xpWigleLoaded = false;
-static bool xpWpaCacheComplete = false;
-static bool xpWigleCacheComplete = false;
-struct XpAwardEntry { char key[40]; };  // 12-char BSSID or WiGLE filename (was 80)
-static std::vector<XpAwardEntry> xpAwardedWpa;
-static std::vector<XpAwardEntry> xpAwardedWigle;
+// Opened lazily by scanXpAwards(), closed when the server stops
+static AwardLedger xpLedgerWpa;
+static AwardLedger xpLedgerWigle;
 
 static void refreshSdPaths() {
     XP_WPA_AWARDED_FILE = SDLayout::xpAwardedWpaPath();
@@ -135,11 +159,10 @@ static bool isUiHeapLow(size_t* outFree, size_t* outLargest) {
     return (freeHeap < HeapPolicy::kFileServerUiMinFree) || (largest < HeapPolicy::kFileServerUiMinLargest);
 }
 
-static size_t sendProgmemResponse(WebServer* srv, int status, const char* contentType, const char* data) {
-    if (!srv || !data) return 0;
-    const size_t totalLen = strlen_P(data);
+// Stream totalLen PROGMEM bytes (text or binary). Extra headers are set by the caller.
+static size_t sendProgmemBody(WebServer* srv, int status, const char* contentType,
+                              const char* data, size_t totalLen) {
     srv->sendHeader("Connection", "close");
-    srv->sendHeader("Cache-Control", "no-store");
     srv->setContentLength(totalLen);
     srv->send(status, contentType, "");
 
@@ -172,8 +195,37 @@ static size_t sendProgmemResponse(WebServer* srv, int status, const char* conten
     return offset;
 }
 
-static size_t sendProgmemResponse(WebServer* srv, const char* contentType, const char* data) {
-    return sendProgmemResponse(srv, 200, contentType, data);
+static size_t sendProgmemResponse(WebServer* srv, int status, const char* contentType, const char* data) {
+    if (!srv || !data) return 0;
+    srv->sendHeader("Cache-Control", "no-store");
+    return sendProgmemBody(srv, status, contentType, data, strlen_P(data));
+}
+
+// UI page/stylesheet/script: gzip copy from web_assets.h when the browser
+// takes it, ETag from the content hash, and 304 when the cached copy is
+// still current. no-cache = always revalidate, which costs one header
+// exchange instead of the asset.
+static size_t sendUiAsset(WebServer* srv, const char* contentType, const char* raw,
+                          const uint8_t* gz, size_t gzLen, const char* hash) {
+    if (!srv || !raw) return 0;
+    const bool useGzip = gz && srv->header("Accept-Encoding").indexOf("gzip") >= 0;
+    char etag[32];
+    snprintf(etag, sizeof(etag), "\"%s%s\"", hash, useGzip ? "-gz" : "");
+
+    srv->sendHeader("Cache-Control", "no-cache");
+    srv->sendHeader("ETag", etag);
+    srv->sendHeader("Vary", "Accept-Encoding");
+    // Either encoding of the same content satisfies the cached copy
+    if (srv->header("If-None-Match").indexOf(hash) >= 0) {
+        srv->sendHeader("Connection", "close");
+        srv->send(304, contentType, "");
+        return 0;
+    }
+    if (useGzip) {
+        srv->sendHeader("Content-Encoding", "gzip");
+        return sendProgmemBody(srv, 200, contentType, (const char*)gz, gzLen);
+    }
+    return sendProgmemBody(srv, 200, contentType, raw, strlen_P(raw));
 }
 
 static const char LOW_HEAP_PAGE[] PROGMEM = R"rawliteral(
@@ -198,26 +250,85 @@ static void sendBusyResponse(WebServer* srv) {
     srv->send(503, "text/plain", "BUSY");
 }
 
+// Downloads/listings streaming from HttpScheduler slots hold files open:
+// don't delete, rename or move things under them
+static bool isStreamBusy() {
+    return HttpScheduler::active() > 0;
+}
+
+// Time slice for HttpScheduler streams per update(), and from inside the
+// blocking upload/ZIP loops so open streams keep moving meanwhile
+static constexpr uint32_t STREAM_SLICE_MS = 20;
+
+// Status line and headers for a response streamed from a slot. Bodies
+// without a length end when the connection closes.
+static size_t formatStreamHead(char* out, size_t cap, int code, const char* type,
+                               size_t contentLength, bool hasLength, const char* extra) {
+    const char* reason = code == 206 ? "Partial Content" : "OK";
+    int n = snprintf(out, cap, "HTTP/1.1 %d %s\r\nContent-Type: %s\r\n", code, reason, type);
+    if (hasLength && n > 0 && (size_t)n < cap) {
+        n += snprintf(out + n, cap - n, "Content-Length: %lu\r\n", (unsigned long)contentLength);
+    }
+    if (n > 0 && (size_t)n < cap) {
+        n += snprintf(out + n, cap - n, "%sConnection: close\r\n\r\n", extra ? extra : "");
+    }
+    return (n > 0 && (size_t)n < cap) ? (size_t)n : 0;
+}
+
+static void forgetPart(const char* part) {
+    for (uint8_t i = 0; i < MAX_KEPT_PARTS; i++) {
+        if (keptParts[i].path[0] != '\0' && strcmp(keptParts[i].path, part) == 0) {
+            keptParts[i].path[0] = '\0';
+        }
+    }
+}
+
+static void keepPart(const char* part) {
+    forgetPart(part);
+    uint8_t slot = 0;
+    for (uint8_t i = 0; i < MAX_KEPT_PARTS; i++) {
+        if (keptParts[i].path[0] == '\0') { slot = i; break; }
+        if ((int32_t)(keptParts[i].keptMs - keptParts[slot].keptMs) < 0) slot = i;
+    }
+    if (keptParts[slot].path[0] != '\0') {
+        FS_LOGF("[FILESERVER] Partial upload evicted: %s\n", keptParts[slot].path);
+        SD.remove(keptParts[slot].path);
+    }
+    strncpy(keptParts[slot].path, part, sizeof(keptParts[slot].path) - 1);
+    keptParts[slot].path[sizeof(keptParts[slot].path) - 1] = '\0';
+    keptParts[slot].keptMs = millis();
+}
+
+// Delete kept partials nobody resumed in time (all of them when stopping)
+static void expireParts(bool all) {
+    uint32_t now = millis();
+    for (uint8_t i = 0; i < MAX_KEPT_PARTS; i++) {
+        KeptPart& kp = keptParts[i];
+        if (kp.path[0] == '\0' || (!all && now - kp.keptMs < PART_TTL_MS)) continue;
+        FS_LOGF("[FILESERVER] Partial upload expired: %s\n", kp.path);
+        SD.remove(kp.path);
+        kp.path[0] = '\0';
+    }
+}
+
 static void resetUploadState(bool removePartial) {
     if (uploadFile) {
         uploadFile.close();
     }
-    if (removePartial && uploadPathBuf[0] != '\0') {
-        SD.remove(uploadPathBuf);
+    if (removePartial && !uploadResumable && uploadPartBuf[0] != '\0') {
+        SD.remove(uploadPartBuf);
+    } else if (removePartial && uploadPartBuf[0] != '\0') {
+        FS_LOGF("[FILESERVER] Upload dropped, partial kept for resume: %s\n", uploadPartBuf);
+        keepPart(uploadPartBuf);
     }
+    uploadResumable = false;
     uploadActive.store(false);
     uploadRejected.store(false);
     uploadPathBuf[0] = '\0';
+    uploadPartBuf[0] = '\0';
     uploadDirBuf[0] = '\0';
 }
 
-static bool listContains(const std::vector<XpAwardEntry>& list, const char* value) {
-    for (size_t i = 0; i < list.size(); i++) {
-        if (strcmp(list[i].key, value) == 0) return true;
-    }
-    return false;
-}
-
 // FIX: Rewritten to avoid heap allocations in hot path.
 // Uses char* comparisons instead of creating temporary String objects.
 static String mapUiPathToFs(const String& path) {
@@ -273,6 +384,26 @@ static const char* basenameFromPath(const char* path) {
     return last + 1;
 }
 
+// Something under path was created, removed or renamed. Drop the cached
+// directory listing; when the handshakes directory (or a parent of it) is
+// affected the capture index no longer matches either, rebuild it lazily.
+static void notePathChanged(const char* path) {
+    DirIndex::invalidate();
+    const char* hsDir = SDLayout::handshakesDir();
+    size_t pathLen = strlen(path);
+    size_t hsLen = strlen(hsDir);
+    while (pathLen > 1 && path[pathLen - 1] == '/') pathLen--;
+    bool inside = pathLen >= hsLen && strncmp(path, hsDir, hsLen) == 0 &&
+                  (path[hsLen] == '\0' || path[hsLen] == '/');
+    bool parent = pathLen < hsLen && strncmp(hsDir, path, pathLen) == 0 &&
+                  (hsDir[pathLen] == '/' || pathLen == 1);
+    if (inside || parent) CaptureIndex::invalidate();
+}
+
+static void notePathChanged(const String& path) {
+    notePathChanged(path.c_str());
+}
+
 static bool isSameOrSubPath(const String& parent, const String& child) {
     if (parent.isEmpty() || child.isEmpty()) return false;
     String p = parent;
@@ -285,106 +416,6 @@ static bool isSameOrSubPath(const String& parent, const String& child) {
     return (c.length() > p.length() && c.charAt(p.length()) == '/');
 }
 
-static void loadAwardedList(const char* path, std::vector<XpAwardEntry>& out, bool& loaded, bool& complete) {
-    if (loaded) return;
-    if (!path || !path[0]) {
-        out.clear();
-        complete = true;
-        loaded = true;
-        return;
-    }
-    out.clear();
-    // Reserve conservatively — full 512 entries may not fit alongside WebServer
-    size_t freeHeap = ESP.getFreeHeap();
-    size_t reserveCount = (freeHeap > 60000) ? XP_AWARD_CACHE_MAX : 64;
-    try { out.reserve(reserveCount); } catch (...) { /* grow on demand */ }
-    complete = true;
-    File f = SD.open(path, FILE_READ);
-    if (f) {
-        char lineBuf[128];
-        while (f.available()) {
-            yield();
-            size_t len = f.readBytesUntil('\n', lineBuf, sizeof(lineBuf) - 1);
-            lineBuf[len] = '\0';
-            while (len > 0 && (lineBuf[len - 1] == '\r' || lineBuf[len - 1] == ' ')) {
-                lineBuf[--len] = '\0';
-            }
-            if (len > 0) {
-                if (out.size() < XP_AWARD_CACHE_MAX) {
-                    // For WiGLE entries (full paths), store only the filename
-                    const char* stored = lineBuf;
-                    const char* slash = strrchr(lineBuf, '/');
-                    if (slash && *(slash + 1)) stored = slash + 1;
-                    XpAwardEntry entry;
-                    strncpy(entry.key, stored, sizeof(entry.key) - 1);
-                    entry.key[sizeof(entry.key) - 1] = '\0';
-                    try { out.push_back(entry); } catch (...) { complete = false; break; }
-                } else {
-                    complete = false;
-                    break;
-                }
-            }
-        }
-        f.close();
-    }
-    loaded = true;
-}
-
-static bool appendAwarded(const char* path, std::vector<XpAwardEntry>& out, const char* value) {
-    if (!path || !path[0]) return false;
-    if (listContains(out, value)) return false;
-    if (out.size() >= XP_AWARD_CACHE_MAX) return false;
-    File f = SD.open(path, FILE_APPEND);
-    if (!f) return false;
-    f.println(value);
-    f.close();
-    XpAwardEntry entry;
-    strncpy(entry.key, value, sizeof(entry.key) - 1);
-    entry.key[sizeof(entry.key) - 1] = '\0';
-    try { out.push_back(entry); } catch (...) { /* file written, cache just won't track it */ }
-    return true;
-}
-
-static bool fileHasLine(const char* path, const char* value) {
-    if (!path || !path[0]) return false;
-    File f = SD.open(path, FILE_READ);
-    if (!f) return false;
-    char lineBuf[128];
-    while (f.available()) {
-        yield();
-        size_t len = f.readBytesUntil('\n', lineBuf, sizeof(lineBuf) - 1);
-        lineBuf[len] = '\0';
-        while (len > 0 && (lineBuf[len - 1] == '\r' || lineBuf[len - 1] == ' ')) {
-            lineBuf[--len] = '\0';
-        }
-        if (len == 0) continue;
-        // Compare directly, and also compare basename for backward compat with old full-path entries
-        if (strcmp(lineBuf, value) == 0) {
-            f.close();
-            return true;
-        }
-        const char* slash = strrchr(lineBuf, '/');
-        if (slash && *(slash + 1) && strcmp(slash + 1, value) == 0) {
-            f.close();
-            return true;
-        }
-    }
-    f.close();
-    return false;
-}
-
-static bool isAwarded(const char* path,
-                      const char* value,
-                      std::vector<XpAwardEntry>& cache,
-                      bool& loaded,
-                      bool& complete) {
-    loadAwardedList(path, cache, loaded, complete);
-    if (!path || !path[0]) return false;
-    if (listContains(cache, value)) return true;
-    if (complete) return false;
-    return fileHasLine(path, value);
-}
-
 static size_t normalizeHexToken(const char* input, char* out, size_t outLen, size_t maxHex) {
     size_t j = 0;
     for (size_t i = 0; input[i] && j < maxHex && j < outLen - 1; i++) {
@@ -488,11 +519,11 @@ static bool wigleLooksValid(const char* path) {
     return false;
 }
 
-static bool awardXpEntry(const char* src, uint16_t per, const char* awardFile, std::vector<XpAwardEntry>& awardList, const char* key) {
+static bool awardXpEntry(const char* src, uint16_t per, AwardLedger& ledger, const char* key) {
     if (xpSessionAwarded + per > XP_SESSION_CAP) {
         return false;
     }
-    if (!appendAwarded(awardFile, awardList, key)) {
+    if (!ledger.add(key)) {
         return false;
     }
     XP::addXP(per);
@@ -508,7 +539,7 @@ static void scanXpAwards() {
     }
     if (xpSessionAwarded >= XP_SESSION_CAP) return;
 
-    // Gate: defer scan if heap is too low for SD reads + vector operations
+    // Gate: defer scan if heap is too low for SD reads + ledger filters
     HeapGates::GateStatus gate = HeapGates::checkGate(
         HeapPolicy::kFileServerMinHeap,
         HeapPolicy::kFileServerMinLargest);
@@ -523,15 +554,21 @@ static void scanXpAwards() {
         return;
     }
 
-    loadAwardedList(XP_WPA_AWARDED_FILE, xpAwardedWpa, xpWpaLoaded, xpWpaCacheComplete);
-    loadAwardedList(XP_WIGLE_AWARDED_FILE, xpAwardedWigle, xpWigleLoaded, xpWigleCacheComplete);
+    // First open per session migrates/validates against the .txt journals;
+    // a ledger that cannot open awards nothing rather than awarding twice
+    if (!xpLedgerWpa.isOpen()) {
+        xpLedgerWpa.open(SDLayout::xpLedgerWpaPath(), XP_WPA_AWARDED_FILE);
+    }
+    if (!xpLedgerWigle.isOpen()) {
+        xpLedgerWigle.open(SDLayout::xpLedgerWiglePath(), XP_WIGLE_AWARDED_FILE);
+    }
 
     // WPA-SEC awards — zero String allocations in loop
     File wpaFile = SD.open(WPA_SENT_FILE, FILE_READ);
     if (!wpaFile) {
         wpaFile = SD.open(SDLayout::wpasecUploadedPath(), FILE_READ);
     }
-    if (wpaFile) {
+    if (wpaFile && xpLedgerWpa.isOpen()) {
         char lineBuf[64];
         char bssid[16];
         char pcapPathBuf[128];
@@ -547,17 +584,17 @@ static void scanXpAwards() {
             if (len == 0) continue;
             size_t hexLen = normalizeHexToken(lineBuf, bssid, sizeof(bssid), 12);
             if (hexLen < 12) continue;
-            if (isAwarded(XP_WPA_AWARDED_FILE, bssid, xpAwardedWpa, xpWpaLoaded, xpWpaCacheComplete)) continue;
+            if (xpLedgerWpa.contains(bssid)) continue;
             snprintf(pcapPathBuf, sizeof(pcapPathBuf), "%s/%s.pcap", hsDir, bssid);
             if (!pcapLooksValid(pcapPathBuf)) continue;
-            awardXpEntry("WPA", XP_WPA_PER, XP_WPA_AWARDED_FILE, xpAwardedWpa, bssid);
+            awardXpEntry("WPA", XP_WPA_PER, xpLedgerWpa, bssid);
         }
-        wpaFile.close();
     }
+    if (wpaFile) wpaFile.close();
 
     // WiGLE awards — zero String allocations in loop
     File wigleFile = SD.open(WIGLE_UPLOADED_FILE, FILE_READ);
-    if (wigleFile) {
+    if (wigleFile && xpLedgerWigle.isOpen()) {
         char lineBuf[128];
         char pathBuf[160];
         const char* wdDir = SDLayout::wardrivingDir();
@@ -583,49 +620,14 @@ static void scanXpAwards() {
             if (pathLen < 10) continue;
             if (strcasecmp(path + pathLen - 10, ".wigle.csv") != 0) continue;
 
-            // Use filename-only as key (fits in 18-byte XpAwardEntry)
+            // Use filename-only as key (old journal lines hold full paths)
             const char* fname = basenameFromPath(path);
-            if (isAwarded(XP_WIGLE_AWARDED_FILE, fname, xpAwardedWigle, xpWigleLoaded, xpWigleCacheComplete)) continue;
+            if (xpLedgerWigle.contains(fname)) continue;
             if (!wigleLooksValid(path)) continue;
-            awardXpEntry("WIGLE", XP_WIGLE_PER, XP_WIGLE_AWARDED_FILE, xpAwardedWigle, fname);
+            awardXpEntry("WIGLE", XP_WIGLE_PER, xpLedgerWigle, fname);
         }
-        wigleFile.close();
-    }
-}
-
-static void appendJsonEscaped(String& out, const char* in) {
-    // FIX: Pre-reserve space to avoid repeated reallocs.
-    // Worst case: every char needs escaping (2x size).
-    const size_t inLen = strlen(in);
-    out.reserve(out.length() + inLen + (inLen / 4));  // +25% for escapes
-    
-    // FIX: Batch small runs of safe chars to reduce concat calls
-    const char* runStart = in;
-    while (*in) {
-        char c = *in;
-        if (c == '\"' || c == '\\' || static_cast<uint8_t>(c) < 0x20) {
-            // Flush any pending safe chars first
-            if (in > runStart) {
-                out.concat(runStart, in - runStart);
-            }
-            // Handle special char
-            if (c == '\"') {
-                out += "\\\"";
-            } else if (c == '\\') {
-                out += "\\\\";
-            } else {
-                out += ' ';
-            }
-            in++;
-            runStart = in;
-        } else {
-            in++;
-        }
-    }
-    // Flush remaining safe chars
-    if (in > runStart) {
-        out.concat(runStart, in - runStart);
     }
+    if (wigleFile) wigleFile.close();
 }
 
 static const char* pickMoodName(uint8_t flags, bool debuff) {
@@ -1504,8 +1506,12 @@ let sdInfoLoading = false;
 let refreshInProgress = false;
 let refreshPending = false;
 let lastRefreshAt = 0;
-let fetchQueue = Promise.resolve();
-const LIST_LIMIT = 200;
+let fetchesInFlight = 0;
+const fetchWaiters = [];
+const FETCH_PARALLEL = 3;
+const BUSY_RETRIES = 4;
+const LIST_PAGE = 200;
+const LIST_MAX_ITEMS = 5000;
 let opsBusy = false;
 let queueLoading = false;
 const creds = {
@@ -1528,11 +1534,48 @@ let editLoading = false;
 const LOG_MAX = 5;
 let logBuffer = [];
 
-function queuedFetch(url, options) {
-    const run = () => fetch(url, options);
-    const p = fetchQueue.then(run, run);
-    fetchQueue = p.catch(() => {});
-    return p;
+// The device streams a few responses at once (downloads, listings); keep
+// that many requests in flight and retry when it answers 503 BUSY
+async function queuedFetch(url, options) {
+    while (fetchesInFlight >= FETCH_PARALLEL) {
+        await new Promise(resolve => fetchWaiters.push(resolve));
+    }
+    fetchesInFlight++;
+    try {
+        for (let attempt = 0; ; attempt++) {
+            const r = await fetch(url, options);
+            if (r.status !== 503 || attempt >= BUSY_RETRIES) return r;
+            await new Promise(resolve => setTimeout(resolve, 300 * (attempt + 1)));
+        }
+    } finally {
+        fetchesInFlight--;
+        const next = fetchWaiters.shift();
+        if (next) next();
+    }
+}
+
+// Page through /api/ls (dirs first, by name). onPage gets each batch as it
+// arrives. A 409 means the device rebuilt the listing: start over once.
+async function fetchListing(path, onPage) {
+    const base = '/api/ls?dir=' + encodeURIComponent(path) + '&sort=name&limit=' + LIST_PAGE + '&cursor=';
+    let items = [];
+    let cursor = '';
+    let restarted = false;
+    while (true) {
+        const r = await queuedFetch(base + encodeURIComponent(cursor));
+        if (r.status === 409 && !restarted) {
+            restarted = true;
+            items = [];
+            cursor = '';
+            continue;
+        }
+        if (!r.ok) throw new Error('HTTP ' + r.status);
+        const page = await r.json();
+        items = items.concat(page.items || []);
+        if (onPage) onPage(items);
+        if (!page.next || items.length >= LIST_MAX_ITEMS) return items;
+        cursor = page.next;
+    }
 }
 
 // Initialize
@@ -1738,26 +1781,16 @@ async function loadPane(id, path) {
     list.innerHTML = '<div style="padding:20px;opacity:0.5">jacking in...</div>';
     
     try {
-        const r = await queuedFetch('/api/ls?dir=' + encodeURIComponent(path) + '&full=1&limit=' + LIST_LIMIT);
-        const items = await r.json();
-        
-        // Sort: directories first, then alphabetically
-        pane.items = [];
-        
-        // Parent directory entry
-        if (path !== '/') {
-            pane.items.push({ name: '..', isDir: true, isParent: true, size: 0 });
-        }
-        
-        // Directories
-        items.filter(i => i.isDir).sort((a,b) => a.name.localeCompare(b.name))
-            .forEach(i => pane.items.push(i));
-        
-        // Files
-        items.filter(i => !i.isDir).sort((a,b) => a.name.localeCompare(b.name))
-            .forEach(i => pane.items.push(i));
-        
-        renderPane(id);
+        // Already sorted by the device: directories first, then by name
+        const show = items => {
+            pane.items = [];
+            if (path !== '/') {
+                pane.items.push({ name: '..', isDir: true, isParent: true, size: 0 });
+            }
+            items.forEach(i => pane.items.push(i));
+            renderPane(id);
+        };
+        await fetchListing(path, show);
     } catch(e) {
         list.innerHTML = '<div style="padding:20px;opacity:0.5">load failed</div>';
     } finally {
@@ -1995,10 +2028,7 @@ async function loadQueues() {
 
 async function listDir(path) {
     try {
-        const r = await queuedFetch('/api/ls?dir=' + encodeURIComponent(path) + '&full=1&limit=' + LIST_LIMIT);
-        if (!r.ok) return [];
-        const items = await r.json();
-        return Array.isArray(items) ? items : [];
+        return await fetchListing(path);
     } catch (e) {
         return [];
     }
@@ -2393,20 +2423,26 @@ async function deleteSelected() {
 }
 
 async function downloadSelected() {
-    const items = getSelectedPaths().filter(i => !i.isDir);
+    const items = getSelectedPaths();
     if (items.length === 0) {
-        addSysLog('NO FILES MARKED. DIRS NEED ZIP. WE AINT GOT ZIP.');
+        addSysLog('NOTHING MARKED');
         return;
     }
     
-    addSysLog('EXFILTRATING ' + items.length + ' FILE(S)...');
+    addSysLog('EXFILTRATING ' + items.length + ' ITEM(S)...');
     
-    // Download files sequentially (browser limitation)
+    // Download sequentially (browser limitation); dirs come down as one ZIP
     for (let i = 0; i < items.length; i++) {
         await new Promise(resolve => {
             const a = document.createElement('a');
-            a.href = '/download?f=' + encodeURIComponent(items[i].path);
-            a.download = items[i].path.split('/').pop();
+            const name = items[i].path.split('/').pop();
+            if (items[i].isDir) {
+                a.href = '/download?dir=' + encodeURIComponent(items[i].path);
+                a.download = name + '.zip';
+            } else {
+                a.href = '/download?f=' + encodeURIComponent(items[i].path);
+                a.download = name;
+            }
             a.click();
             setTimeout(resolve, 300); // Small delay between downloads
         });
@@ -2834,24 +2870,27 @@ async function uploadFiles(files) {
         addSysLog('INJECTING ' + (i+1) + '/' + files.length + ': ' + files[i].name);
         fill.style.width = '0%';
         
-        const formData = new FormData();
-        formData.append('file', files[i]);
-        
-        try {
-            await new Promise((resolve, reject) => {
-                const xhr = new XMLHttpRequest();
-                xhr.upload.onprogress = (e) => {
-                    if (e.lengthComputable) fill.style.width = (e.loaded/e.total*100) + '%';
-                };
-                xhr.onload = () => xhr.status === 200 ? resolve() : reject();
-                xhr.onerror = () => reject();
-                xhr.open('POST', '/upload?dir=' + encodeURIComponent(pane.path));
-                xhr.send(formData);
+        const file = files[i];
+        let offset = 0;
+        let done = false;
+        let restart = false;
+        for (let attempt = 0; attempt <= UPLOAD_RETRIES && !done; attempt++) {
+            if (restart) {
+                offset = 0;
+                addSysLog('RESUME MISMATCH. RESTARTING ' + file.name);
+            } else if (attempt > 0) {
+                offset = await uploadResumeOffset(pane.path, file);
+                addSysLog('LINK DROPPED. RESUMING AT ' + offset + '/' + file.size);
+            }
+            const status = await sendUploadPart(pane.path, file, offset, (loaded) => {
+                fill.style.width = ((offset + loaded) / Math.max(file.size, 1) * 100) + '%';
             });
-            uploaded++;
-        } catch(e) {
-            addSysLog('INJECT FAILED: ' + files[i].name);
+            if (status === 200) done = true;
+            else if (status === 409 && offset === 0) break;  // Busy, not a drop
+            restart = status === 409;
         }
+        if (done) uploaded++;
+        else addSysLog('INJECT FAILED: ' + file.name);
     }
     
     bar.classList.remove('active');
@@ -2862,6 +2901,57 @@ async function uploadFiles(files) {
     if (input) input.value = '';
 }
 
+// Resumable uploads: a dropped transfer continues from the partial file
+// already on the card instead of starting over
+const UPLOAD_RETRIES = 3;
+const RESUME_CHECK_BYTES = 4096;
+const CRC_TABLE = (() => {
+    const t = new Uint32Array(256);
+    for (let i = 0; i < 256; i++) {
+        let c = i;
+        for (let k = 0; k < 8; k++) c = (c & 1) ? (0xEDB88320 ^ (c >>> 1)) : (c >>> 1);
+        t[i] = c >>> 0;
+    }
+    return t;
+})();
+
+function crc32Hex(bytes) {
+    let c = 0xFFFFFFFF;
+    for (let i = 0; i < bytes.length; i++) c = CRC_TABLE[(c ^ bytes[i]) & 0xFF] ^ (c >>> 8);
+    return ((c ^ 0xFFFFFFFF) >>> 0).toString(16).padStart(8, '0');
+}
+
+async function uploadResumeOffset(dir, file) {
+    try {
+        const path = (dir === '/' ? '' : dir) + '/' + file.name;
+        const r = await fetch('/api/upload-status?path=' + encodeURIComponent(path));
+        if (!r.ok) return 0;
+        const j = await r.json();
+        return (j.size > 0 && j.size < file.size) ? j.size : 0;
+    } catch(e) {
+        return 0;
+    }
+}
+
+async function sendUploadPart(dir, file, offset, onProgress) {
+    let query = '/upload?dir=' + encodeURIComponent(dir) + '&resume=1';
+    if (offset > 0) {
+        const tail = file.slice(Math.max(0, offset - RESUME_CHECK_BYTES), offset);
+        const crc = crc32Hex(new Uint8Array(await tail.arrayBuffer()));
+        query += '&offset=' + offset + '&crc=' + crc;
+    }
+    const formData = new FormData();
+    formData.append('file', offset > 0 ? file.slice(offset) : file, file.name);
+    return await new Promise(resolve => {
+        const xhr = new XMLHttpRequest();
+        xhr.upload.onprogress = (e) => { if (e.lengthComputable) onProgress(e.loaded); };
+        xhr.onload = () => resolve(xhr.status);
+        xhr.onerror = () => resolve(0);
+        xhr.open('POST', query);
+        xhr.send(formData);
+    });
+}
+
 function triggerUploadPicker() {
     const input = document.getElementById('uploadPick');
     if (input) {
@@ -3515,6 +3605,9 @@ void FileServer::startServer() {
     bool mdnsOk = MDNS.begin("porkchop");
     FS_LOGF("[FILESERVER] mDNS %s\n", mdnsOk ? "ok" : "fail");
 
+    // Modes that ran since the last session may have written files
+    DirIndex::invalidate();
+
     // Heap guard before WebServer allocation - prevent OOM on ADV/tight heap
     {
         HeapGates::GateStatus gate = HeapGates::checkGate(
@@ -3531,7 +3624,7 @@ void FileServer::startServer() {
         }
     }
 
-    server = new WebServer(80);
+    server = new DetachableWebServer(80);
     if (!server) {
         FS_LOGLN("[FILESERVER] WebServer allocation failed");
         snprintf(statusMessage, sizeof(statusMessage), "%s", "Server alloc fail");
@@ -3541,11 +3634,17 @@ void FileServer::startServer() {
         return;
     }
 
+    // Stream slots for downloads/listings; without them those answer BUSY
+    if (!HttpScheduler::begin()) {
+        FS_LOGLN("[FILESERVER] Stream slot pool allocation failed");
+    }
+
     server->on("/", HTTP_GET, handleRoot);
     server->on("/ui.css", HTTP_GET, handleStyle);
     server->on("/ui.js", HTTP_GET, handleScript);
     server->on("/api/swine", HTTP_GET, handleSwine);
     server->on("/api/ls", HTTP_GET, handleFileList);
+    server->on("/api/captures", HTTP_GET, handleCaptures);
     server->on("/api/sdinfo", HTTP_GET, handleSDInfo);
     server->on("/api/bulkdelete", HTTP_POST, handleBulkDelete);
     server->on("/api/rename", HTTP_GET, handleRename);
@@ -3558,8 +3657,13 @@ void FileServer::startServer() {
     server->on("/delete", HTTP_GET, handleDelete);
     server->on("/rmdir", HTTP_GET, handleDelete);
     server->on("/mkdir", HTTP_GET, handleMkdir);
+    server->on("/api/upload-status", HTTP_GET, handleUploadStatus);
     server->onNotFound(handleNotFound);
 
+    // WebServer only keeps request headers it was told about
+    static const char* kCollectHeaders[] = {"Range", "Accept-Encoding", "If-None-Match"};
+    server->collectHeaders(kCollectHeaders, sizeof(kCollectHeaders) / sizeof(kCollectHeaders[0]));
+
     server->begin();
 
     state = FileServerState::RUNNING;
@@ -3569,22 +3673,19 @@ void FileServer::startServer() {
     xpLastUploadCount = sessionUploadCount;
     xpSessionAwarded = 0;
     xpScanPending = true;
-    xpAwardedWpa.clear();
-    xpAwardedWpa.shrink_to_fit();
-    xpAwardedWigle.clear();
-    xpAwardedWigle.shrink_to_fit();
-    xpWpaLoaded = false;
-    xpWigleLoaded = false;
-    xpWpaCacheComplete = false;
-    xpWigleCacheComplete = false;
+    xpLedgerWpa.close();
+    xpLedgerWigle.close();
 }
 
 void FileServer::stop() {
     if (state == FileServerState::IDLE) {
         return;
     }
-    // Close any pending upload file
-    resetUploadState(false);
+    // Close any pending upload file and open streams; partials kept for a
+    // resume go too (nothing can continue them once the server is down)
+    resetUploadState(true);
+    expireParts(true);
+    HttpScheduler::end();
 
     scanXpAwards();
     
@@ -3627,15 +3728,9 @@ void FileServer::stop() {
     sessionDownloadCount = 0;
     xpSessionAwarded = 0;
     xpScanPending = false;
-    // FIX: Purge vectors to free heap, prevent unbounded growth
-    xpAwardedWpa.clear();
-    xpAwardedWpa.shrink_to_fit();
-    xpAwardedWigle.clear();
-    xpAwardedWigle.shrink_to_fit();
-    xpWpaLoaded = false;
-    xpWigleLoaded = false;
-    xpWpaCacheComplete = false;
-    xpWigleCacheComplete = false;
+    // Release the ledger filters; the tables stay on SD
+    xpLedgerWpa.close();
+    xpLedgerWigle.close();
 }
 
 void FileServer::update() {
@@ -3680,11 +3775,13 @@ void FileServer::updateRunning() {
     }
     if (server) {
         server->handleClient();
+        HttpScheduler::service(STREAM_SLICE_MS);
     }
 
     if (uploadActive.load() && (millis() - uploadLastProgress.load() > 10000)) {
         resetUploadState(true);
     }
+    expireParts(false);
     
     // FIX: Timeout safety for listActive - prevent permanent lockout
     if (listActive.load() && (millis() - listStartTime.load() > 60000)) {
@@ -3717,6 +3814,7 @@ void FileServer::updateRunning() {
             }
             
             // Stop server but keep credentials
+            HttpScheduler::end();
             if (server) {
                 server->stop();
                 delete server;
@@ -3759,7 +3857,8 @@ void FileServer::handleRoot() {
         sessionTxBytes += sent;
         return;
     }
-    size_t sent = sendProgmemResponse(server, "text/html; charset=utf-8", HTML_TEMPLATE);
+    size_t sent = sendUiAsset(server, "text/html; charset=utf-8", HTML_TEMPLATE,
+                              WEB_ASSET_HTML_GZ, WEB_ASSET_HTML_GZ_LEN, WEB_ASSET_HTML_HASH);
     sessionTxBytes += sent;
     logHeapStatus("after /");
 }
@@ -3779,7 +3878,8 @@ void FileServer::handleStyle() {
         server->send(503, "text/plain", "LOW HEAP");
         return;
     }
-    size_t sent = sendProgmemResponse(server, "text/css", HTML_STYLE);
+    size_t sent = sendUiAsset(server, "text/css", HTML_STYLE,
+                              WEB_ASSET_CSS_GZ, WEB_ASSET_CSS_GZ_LEN, WEB_ASSET_CSS_HASH);
     sessionTxBytes += sent;
 }
 
@@ -3798,7 +3898,8 @@ void FileServer::handleScript() {
         server->send(503, "text/plain", "LOW HEAP");
         return;
     }
-    size_t sent = sendProgmemResponse(server, "application/javascript", HTML_SCRIPT);
+    size_t sent = sendUiAsset(server, "application/javascript", HTML_SCRIPT,
+                              WEB_ASSET_JS_GZ, WEB_ASSET_JS_GZ_LEN, WEB_ASSET_JS_HASH);
     sessionTxBytes += sent;
 }
 
@@ -3942,19 +4043,173 @@ void FileServer::handleCredsSave() {
     server->send(200, "application/json", "{\"ok\":true}");
 }
 
+// Directory listing
+//   GET /api/ls?dir=D[&full=1][&limit=N]
+//     -> [{name,size[,isDir,mtime]}...]  first N entries in FAT order
+//   GET /api/ls?dir=D&cursor=[C][&limit=N][&sort=name|size|mtime][&desc=1]
+//               [&q=text][&refresh=1]
+//     -> {"items":[{name,size,isDir,mtime}...],"next":"C"|null,"total":T}
+// Paged requests start with an empty cursor and pass "next" back until it
+// is null. Pages come from DirIndex, so the FAT is walked once per listing,
+// not once per page. A cursor from an older listing answers 409.
+// The body is built in place in an HttpScheduler slot buffer while it
+// streams. One listing at a time: DirIndex caches a single directory.
+static constexpr uint16_t LIST_MAX_PAGE = 1000;
+static constexpr uint16_t LIST_DEFAULT_PAGE = 200;
+static constexpr uint32_t LIST_SCAN_BUDGET = 4096;   // Filtered records per page
+static constexpr size_t LIST_ENTRY_MAX = 640;        // Room one entry (or the tail) needs
+
+enum ListPhase : uint8_t { LIST_OPEN, LIST_ITEMS, LIST_TAIL, LIST_DONE };
+
+struct ListJob {
+    JsonWriter json;
+    DirIndex::Listing listing;
+    File root;              // Walk mode: directory being read
+    uint32_t next;          // Index slot / walk position of the next entry
+    uint32_t skip;          // Walk mode: entries earlier pages sent
+    uint32_t scanned;
+    uint16_t limit;
+    uint16_t sent;
+    char query[64];
+    bool indexed;
+    bool paged;
+    bool full;
+    bool more;
+    ListPhase phase;
+};
+static ListJob listJobs[HttpScheduler::kSlots];
+
+// Fills stop while an entry still fits, so the writer never overflows
+static bool listOverflow(const char*, size_t, void*) {
+    return false;
+}
+
+static bool containsNoCase(const char* haystack, const char* needle) {
+    size_t n = strlen(needle);
+    for (; *haystack; haystack++) {
+        if (strncasecmp(haystack, needle, n) == 0) return true;
+    }
+    return n == 0;
+}
+
+static bool listHasRoom(const ListJob& job) {
+    return job.json.ok() && job.json.buffered() + LIST_ENTRY_MAX <= HttpScheduler::kSlotBytes;
+}
+
+static void writeListEntry(JsonWriter& json, const char* name, uint32_t size,
+                           bool isDir, uint32_t mtime, bool full) {
+    json.beginObject().kv("name", name).kv("size", size);
+    if (full) {
+        json.kvBool("isDir", isDir);
+        if (mtime > 0) json.kv("mtime", mtime);
+    }
+    json.endObject();
+}
+
+static bool appendListEntry(const DirIndex::Entry& e, void* ctx) {
+    ListJob& job = *static_cast<ListJob*>(ctx);
+    job.scanned++;
+    if (!job.query[0] || containsNoCase(e.name, job.query)) {
+        writeListEntry(job.json, e.name, e.size, e.isDir, e.mtime, true);
+        job.sent++;
+    }
+    return listHasRoom(job) && job.sent < job.limit && job.scanned < LIST_SCAN_BUDGET;
+}
+
+static void fillListWalk(ListJob& job) {
+    for (; job.skip > 0; job.skip--) {
+        File file = job.root.openNextFile();
+        if (!file) break;
+        file.close();
+        if ((job.skip & 31) == 0) yield();
+    }
+    while (job.sent < job.limit && listHasRoom(job)) {
+        File file = job.root.openNextFile();
+        if (!file) {
+            job.phase = LIST_TAIL;
+            return;
+        }
+        const char* baseName = basenameFromPath(file.name());
+        job.next++;
+        if (!job.paged || !job.query[0] || containsNoCase(baseName, job.query)) {
+            writeListEntry(job.json, baseName, (uint32_t)file.size(), file.isDirectory(),
+                           (uint32_t)file.getLastWrite(), job.full || job.paged);
+            job.sent++;
+        }
+        file.close();
+    }
+    if (job.sent >= job.limit) {
+        File file = job.root.openNextFile();
+        job.more = (bool)file;
+        if (file) file.close();
+        job.phase = LIST_TAIL;
+    }
+}
+
+static size_t fillList(uint8_t* buf, size_t cap, void* ctx) {
+    (void)buf;
+    (void)cap;
+    ListJob& job = *static_cast<ListJob*>(ctx);
+    if (job.phase == LIST_OPEN) {
+        // Not before start(): the slot buffer carries the head until sent
+        if (job.paged) job.json.beginObject().key("items");
+        job.json.beginArray();
+        job.phase = LIST_ITEMS;
+    }
+    if (job.phase == LIST_ITEMS) {
+        if (job.indexed) {
+            uint32_t from = job.next;
+            job.next = DirIndex::read(job.listing, from, appendListEntry, &job);
+            if (job.next == from || job.next >= job.listing.count ||
+                job.sent >= job.limit || job.scanned >= LIST_SCAN_BUDGET) {
+                job.more = job.next < job.listing.count;
+                job.phase = LIST_TAIL;
+            }
+        } else {
+            fillListWalk(job);
+        }
+    }
+    if (job.phase == LIST_TAIL && listHasRoom(job)) {
+        job.json.endArray();
+        if (job.paged) {
+            char cursor[24];
+            job.json.key("next");
+            if (job.more) {
+                DirIndex::formatCursor(job.indexed ? job.listing.generation : 0, job.next,
+                                       cursor, sizeof(cursor));
+                job.json.str(cursor);
+            } else {
+                job.json.null();
+            }
+            if (job.indexed) job.json.kv("total", job.listing.count);
+            job.json.endObject();
+        }
+        job.phase = LIST_DONE;
+    }
+    return job.json.ok() ? job.json.take() : 0;
+}
+
+void FileServer::finishList(void* ctx, size_t sent, bool complete) {
+    (void)complete;
+    ListJob& job = *static_cast<ListJob*>(ctx);
+    if (job.root) job.root.close();
+    job.root = File();
+    sessionTxBytes += sent;
+    logHeapStatusIfLow("after /api/ls");
+    listActive.store(false);
+}
+
 void FileServer::handleFileList() {
     String dir = mapUiPathToFs(server->arg("dir"));
-    bool full = server->arg("full") == "1";
+    bool paged = server->hasArg("cursor");
     uint16_t limit = server->arg("limit").toInt();
     logRequest(server, "REQ");
     if (listActive.load() || isTransferBusy()) {
         sendBusyResponse(server);
         return;
     }
-    listActive.store(true);
-    listStartTime.store(millis());  // FIX: Atomic store for cross-context safety
-    if (limit == 0 || limit > 1000) {
-        limit = 200;
+    if (limit == 0 || limit > LIST_MAX_PAGE) {
+        limit = LIST_DEFAULT_PAGE;
     }
     if (dir.isEmpty()) dir = "/";
     logHeapStatusIfLow("before /api/ls");
@@ -3963,99 +4218,195 @@ void FileServer::handleFileList() {
     if (dir.indexOf("..") >= 0) {
         server->sendHeader("Connection", "close");
         server->send(400, "application/json", "[]");
-        listActive.store(false);
         return;
     }
-    
-    File root = SD.open(dir);
-    if (!root || !root.isDirectory()) {
-        server->sendHeader("Connection", "close");
-        server->send(200, "application/json", "[]");
-        listActive.store(false);
+
+    int slot = HttpScheduler::acquire();
+    if (slot < 0) {
+        sendBusyResponse(server);
         return;
     }
-
-    WiFiClient client = server->client();
-    client.setNoDelay(true);
-
-    server->sendHeader("Connection", "close");
-    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
-    server->send(200, "application/json", "[");
-
-    bool first = true;
-    uint16_t sentCount = 0;
-    String buffer;
-    buffer.reserve(1024);
-
-    File file = root.openNextFile();
-    while (file && sentCount < limit) {
-        yield(); // Feed watchdog during file operations
-        
-        // Check if client is still connected before continuing
-        if (!client.connected()) {
-            file.close();
-            root.close();
-            listActive.store(false);
+    ListJob& job = listJobs[slot];
+    job.listing = {0, 0, DirIndex::Sort::None, false};
+    job.next = 0;
+    job.skip = 0;
+    job.scanned = 0;
+    job.limit = limit;
+    job.sent = 0;
+    job.indexed = false;
+    job.paged = paged;
+    job.full = server->arg("full") == "1";
+    job.more = false;
+    job.phase = LIST_OPEN;
+    snprintf(job.query, sizeof(job.query), "%s", paged ? server->arg("q").c_str() : "");
+
+    // Paged: serve from the cached index, fall back to a walk when the
+    // directory cannot be indexed (cursor generation 0)
+    if (paged) {
+        uint32_t generation = 0;
+        uint32_t from = 0;
+        String cursorArg = server->arg("cursor");
+        bool resume = DirIndex::parseCursor(cursorArg.c_str(), generation, from);
+        DirIndex::Sort sort = DirIndex::parseSort(server->arg("sort").c_str());
+        bool desc = server->arg("desc") == "1";
+        bool refresh = !resume && server->arg("refresh") == "1";
+        job.indexed = DirIndex::prepare(dir.c_str(), sort, desc, refresh, job.listing);
+        if (resume && generation != (job.indexed ? job.listing.generation : 0)) {
+            HttpScheduler::release(slot);
+            server->sendHeader("Connection", "close");
+            server->send(409, "application/json", "{\"error\":\"cursor expired\"}");
             return;
         }
-
-        // FIX: Use stack buffer for number formatting to avoid heap allocs in loop
-        char numBuf[16];
-        
-        if (!first) {
-            buffer += ",";
-        }
-        buffer += "{\"name\":\"";
-        const char* baseName = basenameFromPath(file.name());
-        appendJsonEscaped(buffer, baseName);
-        buffer += "\",\"size\":";
-        snprintf(numBuf, sizeof(numBuf), "%u", (unsigned)file.size());
-        buffer += numBuf;
-        if (full) {
-            buffer += ",\"isDir\":";
-            buffer += file.isDirectory() ? "true" : "false";
-            time_t t = file.getLastWrite();
-            if (t > 0) {
-                buffer += ",\"mtime\":";
-                snprintf(numBuf, sizeof(numBuf), "%lu", (unsigned long)t);
-                buffer += numBuf;
-            }
+        if (resume) {
+            job.next = from;
+            job.skip = job.indexed ? 0 : from;
         }
-        buffer += "}";
-
-        if (buffer.length() >= 1024) {
-            server->sendContent(buffer);
-            sessionTxBytes += buffer.length();
-            buffer.remove(0);  // FIX: Clear in-place to keep capacity, avoid realloc
-            if (!client.connected()) {
-                file.close();
-                root.close();
-                listActive.store(false);
-                return;
-            }
+    }
+
+    if (!job.indexed) {
+        job.root = SD.open(dir);
+        if (!job.root || !job.root.isDirectory()) {
+            if (job.root) job.root.close();
+            job.root = File();
+            HttpScheduler::release(slot);
+            server->sendHeader("Connection", "close");
+            server->send(200, "application/json",
+                         paged ? "{\"items\":[],\"next\":null,\"total\":0}" : "[]");
+            return;
         }
+    }
 
-        first = false;
-        sentCount++;
-        file.close();
-        file = root.openNextFile();
+    job.json = JsonWriter((char*)HttpScheduler::buffer(slot), HttpScheduler::kSlotBytes,
+                          listOverflow, nullptr);
+
+    char head[128];
+    size_t headLen = formatStreamHead(head, sizeof(head), 200, "application/json", 0, false, nullptr);
+    HttpScheduler::Job sched = {fillList, finishList, &job};
+    listActive.store(true);
+    listStartTime.store(millis());  // FIX: Atomic store for cross-context safety
+    if (!HttpScheduler::start(slot, server->detachClient(), head, headLen, sched)) {
+        listActive.store(false);
+        HttpScheduler::release(slot);
+        if (job.root) job.root.close();
+        job.root = File();
+        server->sendHeader("Connection", "close");
+        server->send(500, "application/json", "[]");
     }
+}
 
-    if (file) {
-        file.close();
+// Capture list straight from the capture index (no directory walk).
+// GET /api/captures?cursor=N&limit=M ->
+//   {"next":N,"total":T,"items":[{name,ssid,bssid,type,size,mtime,uploaded,cracked}]}
+// "next" is the cursor for the following page; next == total at the end.
+struct CaptureListPage {
+    WebServer* web;
+    WiFiClient* client;
+    JsonWriter* json;
+    uint64_t* txBytes;
+    uint16_t limit;
+    uint16_t sent;
+};
+
+static bool flushCaptureJson(const char* data, size_t len, void* ctx) {
+    CaptureListPage& page = *static_cast<CaptureListPage*>(ctx);
+    page.web->sendContent(data, len);
+    *page.txBytes += len;
+    return page.client->connected();
+}
+
+static bool appendCaptureJson(const CaptureIndex::Record& rec, uint32_t slot, void* ctx) {
+    (void)slot;
+    CaptureListPage& page = *static_cast<CaptureListPage*>(ctx);
+    char bssid[18] = "";
+    if (!(rec.flags & CaptureIndex::FLAG_NO_BSSID)) {
+        snprintf(bssid, sizeof(bssid), "%02X:%02X:%02X:%02X:%02X:%02X",
+                 rec.bssid[0], rec.bssid[1], rec.bssid[2], rec.bssid[3], rec.bssid[4], rec.bssid[5]);
+    }
+    const char* type = rec.type == CaptureIndex::TYPE_PMKID ? "pmkid" :
+                       rec.type == CaptureIndex::TYPE_HS22000 ? "hs22000" : "pcap";
+    page.json->beginObject()
+        .kv("name", rec.name)
+        .kv("ssid", rec.ssid)
+        .kv("bssid", bssid)
+        .kv("type", type)
+        .kv("size", rec.size)
+        .kv("mtime", rec.time)
+        .kvBool("uploaded", rec.flags & CaptureIndex::FLAG_UPLOADED)
+        .kvBool("cracked", rec.flags & CaptureIndex::FLAG_CRACKED)
+        .endObject();
+    page.sent++;
+    yield();
+    return page.json->ok() && page.sent < page.limit;
+}
+
+void FileServer::handleCaptures() {
+    uint32_t cursor = (uint32_t)server->arg("cursor").toInt();
+    uint16_t limit = server->arg("limit").toInt();
+    logRequest(server, "REQ");
+    if (listActive.load() || isTransferBusy()) {
+        sendBusyResponse(server);
+        return;
+    }
+    if (limit == 0 || limit > 200) {
+        limit = 50;
+    }
+    // The JSON is built in a scheduler slot buffer, not on the heap
+    int slot = HttpScheduler::acquire();
+    if (slot < 0) {
+        sendBusyResponse(server);
+        return;
     }
-    root.close();
+    listActive.store(true);
+    listStartTime.store(millis());
 
-    buffer += "]";
-    server->sendContent(buffer);
-    sessionTxBytes += buffer.length();
-    server->sendContent("");  // Finalize chunked transfer
-    client.flush();
-    client.stop();
-    logHeapStatusIfLow("after /api/ls");
+    // Something changed the directory behind the index: one walk, then paged reads
+    if (CaptureIndex::isStale()) {
+        CaptureIndex::rebuild();
+    }
+    uint32_t total = CaptureIndex::count();
+
+    WiFiClient client = server->client();
+    client.setNoDelay(true);
+    server->sendHeader("Connection", "close");
+    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server->send(200, "application/json", "");
+
+    JsonWriter json;
+    CaptureListPage page = {server, &client, &json, &sessionTxBytes, limit, 0};
+    json = JsonWriter((char*)HttpScheduler::buffer(slot), HttpScheduler::kSlotBytes,
+                      flushCaptureJson, &page);
+    json.beginObject().key("items").beginArray();
+    uint32_t next = CaptureIndex::forEach(appendCaptureJson, &page, cursor);
+    json.endArray()
+        .kv("next", next < total ? next : total)
+        .kv("total", total)
+        .endObject();
+    bool complete = json.flush();
+    HttpScheduler::release(slot);
+    if (complete) {
+        server->sendContent("");  // Finalize chunked transfer
+        client.flush();
+        client.stop();
+    }
     listActive.store(false);
 }
 
+// File bodies streamed from HttpScheduler slots
+struct DownloadJob {
+    File file;
+    size_t left;            // Body bytes still to read
+};
+static DownloadJob downloadJobs[HttpScheduler::kSlots];
+
+static size_t fillDownload(uint8_t* buf, size_t cap, void* ctx) {
+    DownloadJob& job = *static_cast<DownloadJob*>(ctx);
+    size_t n = job.left < cap ? job.left : cap;
+    if (n == 0) return 0;
+    n = job.file.read(buf, n);
+    job.left -= n;
+    return n;
+}
+
 void FileServer::handleDownload() {
     String path = mapUiPathToFs(server->arg("f"));
     String dir = mapUiPathToFs(server->arg("dir"));  // For ZIP download
@@ -4064,10 +4415,8 @@ void FileServer::handleDownload() {
     
     // ZIP download of folder
     if (!dir.isEmpty()) {
-        // Simple implementation: send files one by one is not possible
-        // Instead, we'll create a simple text manifest for now
-        // Full ZIP requires external library
-        server->send(501, "text/plain", "ZIP download not yet implemented - download files individually");
+        sendDirectoryZip(dir);
+        logHeapStatusIfLow("after /download zip");
         return;
     }
     
@@ -4113,97 +4462,134 @@ void FileServer::handleDownload() {
     else if (path.endsWith(".json")) contentType = "application/json";
     else if (path.endsWith(".pcap")) contentType = "application/vnd.tcpdump.pcap";
     
-    const size_t totalSize = file.size();
-    
-    // FIX: Build Content-Disposition header in stack buffer to avoid String concat
-    char dispositionBuf[160];
-    snprintf(dispositionBuf, sizeof(dispositionBuf), "attachment; filename=\"%s\"", filename);
-    
-    server->sendHeader("Connection", "close");
-    server->sendHeader("Content-Disposition", dispositionBuf);
-    server->setContentLength(totalSize);
-    server->send(200, contentType, "");
-
-    WiFiClient client = server->client();
-    client.setNoDelay(true);
-
-    static uint8_t buffer[1024];
-    size_t sentTotal = 0;
-    uint32_t lastProgress = millis();
-    bool stalled = false;
-
-    while (sentTotal < totalSize && client.connected()) {
-        yield(); // Feed watchdog during long operations
-
-        // Check for timeout
-        if (millis() - lastProgress > 30000) {  // 30 second timeout
-            stalled = true;
-            break;
-        }
+    const size_t fileSize = file.size();
 
-        size_t toRead = totalSize - sentTotal;
-        if (toRead > sizeof(buffer)) {
-            toRead = sizeof(buffer);
-        }
-
-        size_t readBytes = file.read(buffer, toRead);
-        if (readBytes == 0) {
-            break;
-        }
-
-        size_t offset = 0;
-        while (offset < readBytes && client.connected()) {
-            size_t chunk = readBytes - offset;
-            int avail = client.availableForWrite();
-            if (avail > 0 && chunk > static_cast<size_t>(avail)) {
-                chunk = static_cast<size_t>(avail);
-            }
-
-            size_t written = client.write(buffer + offset, chunk);
-            if (written == 0) {
-                if (millis() - lastProgress > 8000) {
-                    stalled = true;
-                    break;
-                }
-                delay(1);
-                yield();
-                continue;
-            }
-
-            offset += written;
-            sentTotal += written;
-            lastProgress = millis();
-        }
-
-        if (stalled) {
-            break;
-        }
+    // Range: resume a dropped transfer from where it stopped
+    size_t rangeFirst = 0;
+    size_t rangeLast = fileSize ? fileSize - 1 : 0;
+    HttpRange::Result range = HttpRange::Result::Full;
+    if (server->hasHeader("Range")) {
+        range = HttpRange::parse(server->header("Range").c_str(), fileSize, rangeFirst, rangeLast);
+    }
+    char rangeBuf[64];
+    if (range == HttpRange::Result::Unsatisfiable) {
+        file.close();
+        snprintf(rangeBuf, sizeof(rangeBuf), "bytes */%lu", (unsigned long)fileSize);
+        server->sendHeader("Connection", "close");
+        server->sendHeader("Content-Range", rangeBuf);
+        server->send(416, "text/plain", "Range not satisfiable");
+        return;
+    }
+    if (range == HttpRange::Result::Partial && !file.seek(rangeFirst)) {
+        range = HttpRange::Result::Full;
+        rangeFirst = 0;
+        file.seek(0);
+    }
+    const size_t totalSize = range == HttpRange::Result::Partial ? rangeLast - rangeFirst + 1 : fileSize;
+    
+    int slot = HttpScheduler::acquire();
+    if (slot < 0) {
+        file.close();
+        sendBusyResponse(server);
+        return;
     }
 
-    client.flush();
-    client.stop();
-    file.close();
+    // FIX: Build headers in a stack buffer to avoid String concat
+    char extra[320];
+    int extraLen = snprintf(extra, sizeof(extra),
+                            "Content-Disposition: attachment; filename=\"%s\"\r\nAccept-Ranges: bytes\r\n",
+                            filename);
+    if (range == HttpRange::Result::Partial && extraLen > 0 && (size_t)extraLen < sizeof(extra)) {
+        snprintf(extra + extraLen, sizeof(extra) - extraLen, "Content-Range: bytes %lu-%lu/%lu\r\n",
+                 (unsigned long)rangeFirst, (unsigned long)rangeLast, (unsigned long)fileSize);
+    }
+    char head[512];
+    size_t headLen = formatStreamHead(head, sizeof(head),
+                                      range == HttpRange::Result::Partial ? 206 : 200,
+                                      contentType, totalSize, true, extra);
+
+    // Stream from a scheduler slot; this handler returns right away
+    DownloadJob& job = downloadJobs[slot];
+    job.file = file;
+    job.left = totalSize;
+    HttpScheduler::Job sched = {fillDownload, finishDownload, &job};
+    if (headLen == 0 || !HttpScheduler::start(slot, server->detachClient(), head, headLen, sched)) {
+        HttpScheduler::release(slot);
+        job.file = File();
+        file.close();
+        server->sendHeader("Connection", "close");
+        server->send(500, "text/plain", "Stream setup failed");
+        return;
+    }
+    logHeapStatusIfLow("after /download");
+}
 
-    if (sentTotal > 0) {
-        sessionTxBytes += sentTotal;
+void FileServer::finishDownload(void* ctx, size_t sent, bool complete) {
+    DownloadJob& job = *static_cast<DownloadJob*>(ctx);
+    job.file.close();
+    job.file = File();
+    if (sent > 0) {
+        sessionTxBytes += sent;
         sessionDownloadCount++;
     }
-
-    logHeapStatusIfLow("after /download");
+    if (!complete) {
+        FS_LOGF("[FILESERVER] Download dropped after %lu bytes\n", (unsigned long)sent);
+    }
 }
 
 void FileServer::handleUpload() {
     logRequest(server, "REQ");
     if (uploadRejected.load()) {
         server->sendHeader("Connection", "close");
-        server->send(409, "text/plain", "Transfer in progress");
+        server->send(409, "text/plain", uploadRejectMsg[0] ? uploadRejectMsg : "Transfer in progress");
         uploadRejected.store(false);
+        uploadRejectMsg[0] = '\0';
         return;
     }
     server->sendHeader("Connection", "close");
     server->send(200, "text/plain", "OK");
 }
 
+// Check that the partial on the card ends with the bytes the client has
+static bool verifyResumeTail(File& partial, size_t size, const char* crcHex) {
+    char* end = nullptr;
+    uint32_t expected = (uint32_t)strtoul(crcHex, &end, 16);
+    if (!crcHex[0] || *end != '\0') return false;
+    size_t window = size < RESUME_CHECK_BYTES ? size : RESUME_CHECK_BYTES;
+    if (!partial.seek(size - window)) return false;
+    uint8_t buf[256];
+    uint32_t crc = 0;
+    while (window > 0) {
+        size_t n = window < sizeof(buf) ? window : sizeof(buf);
+        if (partial.read(buf, n) != n) return false;
+        crc = ZipStream::crc32(crc, buf, n);
+        window -= n;
+    }
+    return crc == expected;
+}
+
+// Resume point for an upload: {"size":N} is the partial file length
+void FileServer::handleUploadStatus() {
+    String path = mapUiPathToFs(server->arg("path"));
+    logRequest(server, "REQ");
+    if (path.isEmpty() || path.indexOf("..") >= 0) {
+        server->sendHeader("Connection", "close");
+        server->send(400, "text/plain", "Invalid path");
+        return;
+    }
+    // Size of the partial a resume would continue, not of the target file
+    path += PART_SUFFIX;
+    unsigned long size = 0;
+    File f = SD.open(path);
+    if (f && !f.isDirectory()) size = (unsigned long)f.size();
+    if (f) f.close();
+    char json[64];
+    snprintf(json, sizeof(json), "{\"size\":%lu,\"busy\":%s}", size,
+             isTransferBusy() ? "true" : "false");
+    server->sendHeader("Connection", "close");
+    server->send(200, "application/json", json);
+}
+
 void FileServer::handleUploadProcess() {
     HTTPUpload& upload = server->upload();
     
@@ -4213,6 +4599,7 @@ void FileServer::handleUploadProcess() {
             return;
         }
         uploadRejected.store(false);
+        uploadRejectMsg[0] = '\0';
         uploadActive.store(true);
         uploadLastProgress.store(millis());
         
@@ -4251,13 +4638,43 @@ void FileServer::handleUploadProcess() {
         } else {
             snprintf(uploadPathBuf, sizeof(uploadPathBuf), "%s%s", uploadDirBuf, filename);
         }
+        snprintf(uploadPartBuf, sizeof(uploadPartBuf), "%s%s", uploadPathBuf, PART_SUFFIX);
         logHeapStatusIfLow("before upload");
-        
-        uploadFile = SD.open(uploadPathBuf, FILE_WRITE);
+
+        // offset=N continues a dropped upload: the body is the file from
+        // byte N, and the .part on the card must be exactly N bytes ending
+        // in the client's crc. resume=1 keeps the .part on a drop.
+        size_t offset = (size_t)strtoul(server->arg("offset").c_str(), nullptr, 10);
+        uploadResumable = offset > 0 || server->arg("resume") == "1";
+        forgetPart(uploadPartBuf);  // In use again; re-kept if this one drops too
+        if (offset > 0) {
+            File partial = SD.open(uploadPartBuf, FILE_READ);
+            size_t have = (partial && !partial.isDirectory()) ? partial.size() : 0;
+            bool match = have == offset && verifyResumeTail(partial, have, server->arg("crc").c_str());
+            if (partial) partial.close();
+            if (!match) {
+                FS_LOGF("[FILESERVER] Resume rejected: %s offset=%u have=%u\n", uploadPathBuf,
+                        (unsigned)offset, (unsigned)have);
+                snprintf(uploadRejectMsg, sizeof(uploadRejectMsg), "Resume mismatch: have %lu",
+                         (unsigned long)have);
+                uploadResumable = false;
+                uploadPathBuf[0] = '\0';
+                uploadPartBuf[0] = '\0';
+                uploadActive.store(false);
+                uploadRejected.store(true);
+                return;
+            }
+            uploadFile = SD.open(uploadPartBuf, FILE_APPEND);
+        } else {
+            uploadFile = SD.open(uploadPartBuf, FILE_WRITE);
+        }
         if (!uploadFile) {
             resetUploadState(false);
             uploadRejected.store(true);
         }
+    } else if (uploadRejected.load()) {
+        // Rejected at START: drop the body, keep the reject for handleUpload()
+        return;
     } else if (upload.status == UPLOAD_FILE_WRITE) {
         if (uploadFile) {
             size_t written = uploadFile.write(upload.buf, upload.currentSize);
@@ -4269,7 +4686,7 @@ void FileServer::handleUploadProcess() {
             }
             sessionRxBytes += upload.currentSize;
             uploadLastProgress.store(millis());
-            yield(); // Feed watchdog during upload
+            HttpScheduler::service(STREAM_SLICE_MS);  // Also feeds the watchdog
         } else {
             // Safety check: if uploadFile is not open, reject the upload
             FS_LOGLN("[FILESERVER] Upload write attempted but no file open");
@@ -4279,7 +4696,19 @@ void FileServer::handleUploadProcess() {
     } else if (upload.status == UPLOAD_FILE_END) {
         if (uploadFile) {
             uploadFile.close();
-            sessionUploadCount++;
+            // Complete: replace the target only now
+            if (SD.exists(uploadPathBuf)) SD.remove(uploadPathBuf);
+            if (SD.rename(uploadPartBuf, uploadPathBuf)) {
+                sessionUploadCount++;
+                notePathChanged(uploadPathBuf);
+            } else {
+                FS_LOGF("[FILESERVER] Upload rename failed: %s\n", uploadPartBuf);
+                SD.remove(uploadPartBuf);
+                resetUploadState(false);
+                snprintf(uploadRejectMsg, sizeof(uploadRejectMsg), "%s", "Rename failed");
+                uploadRejected.store(true);  // handleUpload() answers 409
+                return;
+            }
         }
         resetUploadState(false);
     } else if (upload.status == UPLOAD_FILE_ABORTED) {
@@ -4311,6 +4740,195 @@ static void recursiveYieldCheck() {
     }
 }
 
+// ============================================================================
+// ZIP download: store-mode archive streamed straight from the SD card
+// ============================================================================
+
+// Archive bytes are coalesced into one TCP-sized block per chunk
+static constexpr size_t ZIP_OUT_BUF = 1436;
+
+struct ZipSinkState {
+    WebServer* web;
+    WiFiClient* client;
+    uint8_t* buf;
+    size_t used;
+    uint32_t sent;
+};
+
+static bool zipSinkFlush(ZipSinkState& st) {
+    if (st.used == 0) return true;
+    if (!st.client->connected()) return false;
+    st.web->sendContent((const char*)st.buf, st.used);
+    st.sent += st.used;
+    st.used = 0;
+    HttpScheduler::service(STREAM_SLICE_MS);
+    return st.client->connected();
+}
+
+static bool zipSink(const uint8_t* data, size_t len, void* ctx) {
+    ZipSinkState& st = *static_cast<ZipSinkState*>(ctx);
+    while (len > 0) {
+        size_t n = ZIP_OUT_BUF - st.used;
+        if (n > len) n = len;
+        memcpy(st.buf + st.used, data, n);
+        st.used += n;
+        data += n;
+        len -= n;
+        if (st.used == ZIP_OUT_BUF && !zipSinkFlush(st)) return false;
+    }
+    return true;
+}
+
+// Shared path buffer: children are appended in place and cut off again on
+// the way back up, so recursion costs no per-level path copies
+static char zipPathBuf[256];
+
+static bool zipAddTree(ZipStream& zip, size_t pathLen, size_t nameOffset,
+                       const char* spillPath, uint8_t* readBuf, size_t readBufLen,
+                       uint8_t depth) {
+    if (depth > MAX_RECURSION_DEPTH) {
+        FS_LOGF("[FILESERVER] ZIP depth limit exceeded at: %s\n", zipPathBuf);
+        return true;  // Skip the subtree, keep the archive
+    }
+    File dir = SD.open(zipPathBuf);
+    if (!dir || !dir.isDirectory()) {
+        if (dir) dir.close();
+        return true;
+    }
+
+    File entry = dir.openNextFile();
+    while (entry) {
+        const char* entryName = basenameFromPath(entry.name());
+        size_t entryNameLen = strlen(entryName);
+        bool entryIsDir = entry.isDirectory();
+        size_t childLen = pathLen + (pathLen > 1 ? 1 : 0) + entryNameLen;
+
+        if (childLen >= sizeof(zipPathBuf)) {
+            FS_LOGF("[FILESERVER] Path too long in ZIP: %s/%s\n", zipPathBuf, entryName);
+            entry.close();
+            entry = dir.openNextFile();
+            continue;
+        }
+        if (pathLen > 1) zipPathBuf[pathLen] = '/';
+        memcpy(zipPathBuf + childLen - entryNameLen, entryName, entryNameLen + 1);
+
+        bool ok = true;
+        if (entryIsDir) {
+            entry.close();
+            ok = zipAddTree(zip, childLen, nameOffset, spillPath, readBuf, readBufLen, depth + 1);
+        } else if (strcmp(zipPathBuf, spillPath) != 0) {
+            ok = zip.beginEntry(zipPathBuf + nameOffset, entry.getLastWrite());
+            uint32_t lastProgress = millis();
+            while (ok) {
+                size_t n = entry.read(readBuf, readBufLen);
+                if (n == 0) break;
+                ok = zip.write(readBuf, n);
+                if (millis() - lastProgress > 50) {
+                    yield();
+                    lastProgress = millis();
+                }
+            }
+            entry.close();
+            ok = ok && zip.endEntry();
+        } else {
+            entry.close();
+        }
+        zipPathBuf[pathLen] = '\0';
+        if (!ok) {
+            dir.close();
+            return false;
+        }
+        recursiveYieldCheck();
+        entry = dir.openNextFile();
+    }
+    dir.close();
+    return true;
+}
+
+void FileServer::sendDirectoryZip(const String& dir) {
+    if (isTransferBusy()) {
+        server->sendHeader("Connection", "close");
+        server->send(409, "text/plain", "Upload in progress");
+        return;
+    }
+    if (dir.indexOf("..") >= 0 || dir.length() >= sizeof(zipPathBuf)) {
+        server->sendHeader("Connection", "close");
+        server->send(400, "text/plain", "Invalid path");
+        return;
+    }
+    File probe = SD.open(dir);
+    bool isDir = probe && probe.isDirectory();
+    if (probe) probe.close();
+    if (!isDir) {
+        server->sendHeader("Connection", "close");
+        server->send(404, "text/plain", "Directory not found");
+        return;
+    }
+
+    // Same budget as the server itself: the archive only adds the output
+    // block, the read block and one File for the central directory spill
+    HeapGates::GateStatus gate = HeapGates::checkGate(
+        HeapPolicy::kFileServerMinHeap,
+        HeapPolicy::kFileServerMinLargest);
+    if (gate.failure != HeapGates::TlsGateFailure::None) {
+        FS_LOGF("[FILESERVER] Low heap for ZIP: free=%u largest=%u\n",
+                (unsigned)gate.freeHeap, (unsigned)gate.largestBlock);
+        server->sendHeader("Connection", "close");
+        server->send(503, "text/plain", "Low heap");
+        return;
+    }
+
+    const char* metaDir = SDLayout::metaDir();
+    if (!SD.exists(metaDir)) SD.mkdir(metaDir);
+    char spillPath[96];
+    snprintf(spillPath, sizeof(spillPath), "%s%szip_cd.tmp", metaDir,
+             metaDir[strlen(metaDir) - 1] == '/' ? "" : "/");
+
+    // Entry names are relative to the parent of dir, so the archive
+    // unpacks into a folder named after it ("handshakes/...")
+    size_t pathLen = dir.length();
+    while (pathLen > 1 && dir[pathLen - 1] == '/') pathLen--;
+    memcpy(zipPathBuf, dir.c_str(), pathLen);
+    zipPathBuf[pathLen] = '\0';
+    const char* folder = pathLen > 1 ? basenameFromPath(zipPathBuf) : "sd";
+    size_t nameOffset = pathLen > 1 ? (size_t)(folder - zipPathBuf) : 1;
+
+    char dispositionBuf[160];
+    snprintf(dispositionBuf, sizeof(dispositionBuf), "attachment; filename=\"%s.zip\"", folder);
+
+    static ZipStream zip;
+    static uint8_t outBuf[ZIP_OUT_BUF];
+    static uint8_t readBuf[1024];
+    WiFiClient client = server->client();
+    ZipSinkState sink = {server, &client, outBuf, 0, 0};
+    if (!zip.begin(zipSink, &sink, spillPath)) {
+        server->sendHeader("Connection", "close");
+        server->send(500, "text/plain", "Cannot create ZIP scratch file");
+        return;
+    }
+
+    client.setNoDelay(true);
+    server->sendHeader("Connection", "close");
+    server->sendHeader("Content-Disposition", dispositionBuf);
+    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server->send(200, "application/zip", "");
+
+    bool ok = zipAddTree(zip, pathLen, nameOffset, spillPath, readBuf, sizeof(readBuf), 0);
+    ok = ok && zip.finish() && zipSinkFlush(sink);
+    if (!ok) {
+        zip.abort();
+        FS_LOGF("[FILESERVER] ZIP aborted after %u bytes\n", (unsigned)sink.sent);
+    } else {
+        server->sendContent("");  // Finalize chunked transfer
+        sessionDownloadCount++;
+        FS_LOGF("[FILESERVER] ZIP %s: %u entries, %u bytes\n", zipPathBuf,
+                (unsigned)zip.entries(), (unsigned)sink.sent);
+    }
+    sessionTxBytes += sink.sent;
+    client.flush();
+    client.stop();
+}
+
 // Internal recursive delete with depth tracking
 // FIX: Use char buffer for path building to avoid String allocs in recursion
 static bool deletePathRecursiveInternal(const char* path, size_t pathLen, uint8_t depth) {
@@ -4389,13 +5007,15 @@ static bool deletePathRecursiveInternal(const char* path, size_t pathLen, uint8_
 bool FileServer::deletePathRecursive(const String& path) {
     recursiveOpLastYield = millis();  // FIX: Reset yield state for new operation
     recursiveOpCounter = 0;
-    return deletePathRecursiveInternal(path.c_str(), path.length(), 0);
+    bool ok = deletePathRecursiveInternal(path.c_str(), path.length(), 0);
+    notePathChanged(path);
+    return ok;
 }
 
 void FileServer::handleDelete() {
     String path = mapUiPathToFs(server->arg("f"));
     logRequest(server, "REQ");
-    if (isTransferBusy()) {
+    if (isTransferBusy() || isStreamBusy()) {
         sendBusyResponse(server);
         return;
     }
@@ -4425,7 +5045,7 @@ void FileServer::handleDelete() {
 
 void FileServer::handleBulkDelete() {
     logRequest(server, "REQ");
-    if (isTransferBusy()) {
+    if (isTransferBusy() || isStreamBusy()) {
         sendBusyResponse(server);
         return;
     }
@@ -4522,6 +5142,7 @@ void FileServer::handleMkdir() {
     }
     
     if (SD.mkdir(path)) {
+        notePathChanged(path);
         server->sendHeader("Connection", "close");
         server->send(200, "text/plain", "SPAWNED");
         } else {
@@ -4534,7 +5155,7 @@ void FileServer::handleRename() {
     String oldPath = mapUiPathToFs(server->arg("old"));
     String newPath = mapUiPathToFs(server->arg("new"));
     logRequest(server, "REQ");
-    if (isTransferBusy()) {
+    if (isTransferBusy() || isStreamBusy()) {
         sendBusyResponse(server);
         return;
     }
@@ -4553,6 +5174,8 @@ void FileServer::handleRename() {
     }
     
     if (SD.rename(oldPath, newPath)) {
+        notePathChanged(oldPath);
+        notePathChanged(newPath);
         server->sendHeader("Connection", "close");
         server->send(200, "application/json", "{\"success\":true}");
     } else {
@@ -4708,7 +5331,7 @@ bool FileServer::copyPathRecursive(const String& srcPath, const String& dstPath,
 
 void FileServer::handleCopy() {
     logRequest(server, "REQ");
-    if (isTransferBusy()) {
+    if (isTransferBusy() || isStreamBusy()) {
         sendBusyResponse(server);
         return;
     }
@@ -4795,6 +5418,7 @@ void FileServer::handleCopy() {
         }
 
         if (copyPathRecursive(srcPath, dstPath)) {
+            notePathChanged(dstPath);
             copied++;
         } else {
             failed++;
@@ -4812,7 +5436,7 @@ void FileServer::handleCopy() {
 
 void FileServer::handleMove() {
     logRequest(server, "REQ");
-    if (isTransferBusy()) {
+    if (isTransferBusy() || isStreamBusy()) {
         sendBusyResponse(server);
         return;
     }
@@ -4898,6 +5522,8 @@ void FileServer::handleMove() {
         }
 
         // Try SD.rename first (fast, atomic)
+        notePathChanged(srcPath);
+        notePathChanged(dstPath);
         if (SD.rename(srcPath, dstPath)) {
             moved++;
         } else if (copyPathRecursive(srcPath, dstPath)) {
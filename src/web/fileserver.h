@@ -5,6 +5,20 @@
 #include <WebServer.h>
 #include <WiFi.h>
 
+// WebServer that can hand its current client to HttpScheduler. With the
+// client detached the core skips its wait-for-close on that socket and
+// accepts the next connection while the response streams.
+class DetachableWebServer : public WebServer {
+public:
+    explicit DetachableWebServer(int port) : WebServer(port) {}
+
+    WiFiClient detachClient() {
+        WiFiClient client = _currentClient;
+        _currentClient = WiFiClient();
+        return client;
+    }
+};
+
 enum class FileServerState {
     IDLE,
     CONNECTING,
@@ -35,7 +49,7 @@ public:
     static bool deletePathRecursive(const String& path);
     
 private:
-    static WebServer* server;
+    static DetachableWebServer* server;
     static FileServerState state;
     static char statusMessage[64];
     static char targetSSID[64];
@@ -58,9 +72,12 @@ private:
     static void handleScript();
     static void handleSwine();
     static void handleFileList();
+    static void handleCaptures();
     static void handleDownload();
+    static void sendDirectoryZip(const String& dir);
     static void handleUpload();
     static void handleUploadProcess();
+    static void handleUploadStatus();
     static void handleDelete();
     static void handleBulkDelete();
     static void handleMkdir();
@@ -71,6 +88,10 @@ private:
     static void handleNotFound();
     static void handleCreds();
     static void handleCredsSave();
+
+    // HttpScheduler: a streamed response closed
+    static void finishDownload(void* ctx, size_t sent, bool complete);
+    static void finishList(void* ctx, size_t sent, bool complete);
     
     // File operation helpers
     static bool copyFileChunked(const String& srcPath, const String& dstPath);
@@ -0,0 +1,444 @@
+// GzipStream - Streaming gzip (deflate) encoder in fixed memory
+
+#include "gzip_stream.h"
+#include "zip_stream.h"
+#include <algorithm>
+#include <string.h>
+
+namespace {
+
+// RFC 1951 3.2.5: length codes 257..285 and distance codes 0..29
+static constexpr uint16_t kLenBase[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static constexpr uint8_t kLenExtra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static constexpr uint16_t kDistBase[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+    8193, 12289, 16385, 24577};
+static constexpr uint8_t kDistExtra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+// RFC 1951 3.2.7: order the code length code lengths are sent in
+static constexpr uint8_t kLenOrder[19] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+static constexpr uint8_t kRepeatExtra[3] = {2, 3, 7};   // Codes 16, 17, 18
+
+static constexpr uint16_t kEndOfBlock = 256;
+static constexpr uint8_t kMaxBits = 15;
+static constexpr uint8_t kMaxLenBits = 7;
+
+inline uint16_t hash3(const uint8_t* p) {
+    uint32_t v = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16);
+    return (uint16_t)((v * 2654435761u) >> (32 - GzipStream::kHashBits));
+}
+
+// Largest i with base[i] <= v
+inline uint8_t findCode(const uint16_t* base, uint8_t count, uint16_t v) {
+    uint8_t i = count - 1;
+    while (base[i] > v) i--;
+    return i;
+}
+
+inline uint8_t fixedLitLen(uint16_t sym) {
+    return sym < 144 ? 8 : sym < 256 ? 9 : sym < 280 ? 7 : 8;
+}
+
+// Moffat & Katajainen in-place Huffman: a[0..n) sorted ascending by weight
+// becomes the code lengths, longest first. n >= 2.
+void minimumRedundancy(uint32_t* a, int n) {
+    a[0] += a[1];
+    int root = 0, leaf = 2;
+    for (int next = 1; next < n - 1; next++) {
+        if (leaf >= n || a[root] < a[leaf]) {
+            a[next] = a[root];
+            a[root++] = next;
+        } else {
+            a[next] = a[leaf++];
+        }
+        if (leaf >= n || (root < next && a[root] < a[leaf])) {
+            a[next] += a[root];
+            a[root++] = next;
+        } else {
+            a[next] += a[leaf++];
+        }
+    }
+    a[n - 2] = 0;
+    for (int next = n - 3; next >= 0; next--) a[next] = a[a[next]] + 1;
+    int avail = 1, used = 0, depth = 0;
+    int root2 = n - 2, next = n - 1;
+    while (avail > 0) {
+        while (root2 >= 0 && (int)a[root2] == depth) {
+            used++;
+            root2--;
+        }
+        while (avail > used) {
+            a[next--] = depth;
+            avail--;
+        }
+        avail = 2 * used;
+        depth++;
+        used = 0;
+    }
+}
+
+// Canonical codes for the lengths (RFC 1951 3.2.2), stored bit-reversed
+void makeCodes(const uint8_t* len, uint16_t n, uint16_t* code) {
+    uint16_t count[kMaxBits + 1] = {0};
+    for (uint16_t i = 0; i < n; i++) count[len[i]]++;
+    count[0] = 0;
+    uint16_t next[kMaxBits + 1] = {0};
+    uint16_t c = 0;
+    for (uint8_t bits = 1; bits <= kMaxBits; bits++) {
+        c = (uint16_t)((c + count[bits - 1]) << 1);
+        next[bits] = c;
+    }
+    for (uint16_t i = 0; i < n; i++) {
+        if (len[i] == 0) continue;
+        uint16_t v = next[len[i]]++;
+        uint16_t rev = 0;
+        for (uint8_t b = 0; b < len[i]; b++) {
+            rev = (uint16_t)((rev << 1) | (v & 1));
+            v >>= 1;
+        }
+        code[i] = rev;
+    }
+}
+
+}  // namespace
+
+bool GzipStream::begin(Sink sink, void* ctx) {
+    if (!sink) return false;
+    sink_ = sink;
+    ctx_ = ctx;
+    open_ = true;
+    ok_ = true;
+    crc_ = 0;
+    in_ = 0;
+    out_ = 0;
+    bitBuf_ = 0;
+    bitCount_ = 0;
+    pending_ = 0;
+    pos_ = 0;
+    end_ = 0;
+    havePrev_ = false;
+    prevLen_ = 0;
+    prevDist_ = 0;
+    symCount_ = 0;
+    memset(litFreq_, 0, sizeof(litFreq_));
+    memset(distFreq_, 0, sizeof(distFreq_));
+    for (size_t i = 0; i < sizeof(head_) / sizeof(head_[0]); i++) head_[i] = kNil;
+
+    // ID1 ID2, CM deflate, no flags, no mtime, XFL 0, OS Unix
+    static const uint8_t kHeader[10] = {0x1F, 0x8B, 8, 0, 0, 0, 0, 0, 0, 3};
+    for (uint8_t b : kHeader) putByte(b);
+    return ok_;
+}
+
+bool GzipStream::write(const uint8_t* data, size_t len) {
+    if (!open_ || !ok_) return false;
+    crc_ = ZipStream::crc32(crc_, data, len);
+    in_ += (uint32_t)len;
+    while (len > 0 && ok_) {
+        size_t n = kBufSize - end_;
+        if (n > len) n = len;
+        memcpy(win_ + end_, data, n);
+        end_ += n;
+        data += n;
+        len -= n;
+        if (end_ == kBufSize) {
+            deflate(false);
+            slide();
+        }
+    }
+    return ok_;
+}
+
+bool GzipStream::finish() {
+    if (!open_) return false;
+    open_ = false;
+    if (!ok_) return false;
+    deflate(true);
+    flushBlock(true);
+    if (bitCount_ > 0) putBits(0, 8 - bitCount_);
+    for (int i = 0; i < 32; i += 8) putByte((uint8_t)(crc_ >> i));
+    for (int i = 0; i < 32; i += 8) putByte((uint8_t)(in_ >> i));
+    return drain();
+}
+
+// Match up to the lookahead a later match could still need, or everything.
+// Lazy: a match found at pos_ - 1 is only taken if pos_ has no longer one.
+void GzipStream::deflate(bool flush) {
+    while (ok_ && (flush ? pos_ < end_ : end_ - pos_ >= kMaxMatch)) {
+        uint16_t dist = 0;
+        uint16_t len = prevLen_ < kNiceMatch ? longestMatch(pos_, dist) : 0;
+        if (prevLen_ >= kMinMatch && len <= prevLen_) {
+            record(prevLen_, prevDist_);
+            size_t stop = pos_ - 1 + prevLen_;
+            for (; pos_ < stop; pos_++) insert(pos_);
+            havePrev_ = false;
+            prevLen_ = 0;
+            continue;
+        }
+        if (havePrev_) record(win_[pos_ - 1], 0);
+        insert(pos_);
+        pos_++;
+        havePrev_ = true;
+        prevLen_ = len;
+        prevDist_ = dist;
+    }
+    if (flush && havePrev_) {
+        if (prevLen_ >= kMinMatch) record(prevLen_, prevDist_);
+        else record(win_[pos_ - 1], 0);
+        havePrev_ = false;
+        prevLen_ = 0;
+    }
+}
+
+// Drop the older half of the buffer; chain entries into it become nil
+void GzipStream::slide() {
+    memmove(win_, win_ + kWindowSize, end_ - kWindowSize);
+    pos_ -= kWindowSize;
+    end_ -= kWindowSize;
+    for (size_t i = 0; i < sizeof(head_) / sizeof(head_[0]); i++) {
+        head_[i] = (head_[i] == kNil || head_[i] < kWindowSize) ? kNil : head_[i] - kWindowSize;
+    }
+    for (size_t i = 0; i < kWindowSize; i++) {
+        prev_[i] = (prev_[i] == kNil || prev_[i] < kWindowSize) ? kNil : prev_[i] - kWindowSize;
+    }
+}
+
+void GzipStream::insert(size_t pos) {
+    if (pos + kMinMatch > end_) return;
+    uint16_t h = hash3(win_ + pos);
+    prev_[pos & (kWindowSize - 1)] = head_[h];
+    head_[h] = (uint16_t)pos;
+}
+
+uint16_t GzipStream::longestMatch(size_t pos, uint16_t& dist) {
+    size_t avail = end_ - pos;
+    if (avail < kMinMatch) return 0;
+    uint16_t maxLen = avail < kMaxMatch ? (uint16_t)avail : kMaxMatch;
+    const uint8_t* cur = win_ + pos;
+    uint16_t best = 0;
+    uint16_t cand = head_[hash3(cur)];
+    for (uint16_t chain = kMaxChain; chain > 0 && cand != kNil; chain--) {
+        // prev_ slots are reused every kWindowSize bytes; older links are stale
+        if (cand >= pos || pos - cand >= kWindowSize) break;
+        const uint8_t* ref = win_ + cand;
+        if (ref[best] == cur[best] && ref[0] == cur[0]) {
+            uint16_t len = 0;
+            while (len < maxLen && ref[len] == cur[len]) len++;
+            if (len > best) {
+                best = len;
+                dist = (uint16_t)(pos - cand);
+                if (len >= kNiceMatch || len == maxLen) break;
+            }
+        }
+        uint16_t next = prev_[cand & (kWindowSize - 1)];
+        if (next >= cand) break;
+        cand = next;
+    }
+    return best;
+}
+
+void GzipStream::record(uint16_t litOrLen, uint16_t dist) {
+    if (dist == 0) {
+        symLit_[symCount_] = (uint8_t)litOrLen;
+        litFreq_[litOrLen]++;
+    } else {
+        symLit_[symCount_] = (uint8_t)(litOrLen - kMinMatch);
+        litFreq_[257 + findCode(kLenBase, 29, litOrLen)]++;
+        distFreq_[findCode(kDistBase, 30, dist)]++;
+    }
+    symDist_[symCount_++] = dist;
+    if (symCount_ == kBlockSymbols) flushBlock(false);
+}
+
+// Huffman code lengths for freq[0..n), none longer than maxBits. Unused
+// symbols get 0; a code always has at least two symbols.
+void GzipStream::buildLengths(const uint16_t* freq, uint16_t n, uint8_t maxBits, uint8_t* len) {
+    uint16_t used = 0;
+    for (uint16_t i = 0; i < n; i++) {
+        len[i] = 0;
+        if (freq[i]) work_[used++] = ((uint32_t)freq[i] << 9) | i;
+    }
+    if (used < 2) {
+        uint16_t a = used ? (uint16_t)(work_[0] & 0x1FF) : 0;
+        len[a] = 1;
+        len[a == 0 ? 1 : 0] = 1;
+        return;
+    }
+    std::sort(work_, work_ + used);
+    for (uint16_t i = 0; i < used; i++) {
+        sym_[i] = (uint16_t)(work_[i] & 0x1FF);
+        work_[i] >>= 9;
+    }
+    minimumRedundancy(work_, used);
+
+    // Clamp to maxBits, then lengthen shorter codes until the Kraft sum fits
+    uint16_t count[kMaxBits + 1] = {0};
+    for (uint16_t i = 0; i < used; i++) count[work_[i] < maxBits ? work_[i] : maxBits]++;
+    uint32_t total = 0;
+    for (uint8_t b = 1; b <= maxBits; b++) total += (uint32_t)count[b] << (maxBits - b);
+    while (total > (1u << maxBits)) {
+        count[maxBits]--;
+        for (uint8_t b = maxBits - 1; b > 0; b--) {
+            if (count[b]) {
+                count[b]--;
+                count[b + 1] += 2;
+                break;
+            }
+        }
+        total--;
+    }
+    // Longest codes to the rarest symbols
+    uint16_t i = 0;
+    for (uint8_t b = maxBits; b > 0; b--) {
+        for (uint16_t c = count[b]; c > 0; c--) len[sym_[i++]] = b;
+    }
+}
+
+// Run-length code the literal/length and distance code lengths into
+// rleSym_/rleExtra_ (RFC 1951 3.2.7); returns the entry count
+uint16_t GzipStream::encodeLengths(uint16_t hlit, uint16_t hdist, uint16_t* clFreq) {
+    uint16_t total = hlit + hdist;
+    uint16_t n = 0;
+    auto at = [&](uint16_t i) { return i < hlit ? litLen_[i] : distLen_[i - hlit]; };
+    auto emit = [&](uint8_t sym, uint8_t extra) {
+        rleSym_[n] = sym;
+        rleExtra_[n++] = extra;
+        clFreq[sym]++;
+    };
+    for (uint16_t i = 0; i < total;) {
+        uint8_t v = at(i);
+        uint16_t run = 1;
+        while (i + run < total && at(i + run) == v) run++;
+        i += run;
+        if (v == 0) {
+            while (run >= 11) {
+                uint16_t r = run < 138 ? run : 138;
+                emit(18, (uint8_t)(r - 11));
+                run -= r;
+            }
+            if (run >= 3) {
+                emit(17, (uint8_t)(run - 3));
+                run = 0;
+            }
+        } else {
+            emit(v, 0);
+            run--;
+            while (run >= 3) {
+                uint16_t r = run < 6 ? run : 6;
+                emit(16, (uint8_t)(r - 3));
+                run -= r;
+            }
+        }
+        for (; run > 0; run--) emit(v, 0);
+    }
+    return n;
+}
+
+// Code the collected symbols as one block, dynamic or fixed, whichever is
+// smaller
+void GzipStream::flushBlock(bool last) {
+    litFreq_[kEndOfBlock] = 1;
+    buildLengths(litFreq_, kLitCodes, kMaxBits, litLen_);
+    buildLengths(distFreq_, kDistCodes, kMaxBits, distLen_);
+    uint16_t hlit = 286;
+    while (hlit > 257 && litLen_[hlit - 1] == 0) hlit--;
+    uint16_t hdist = kDistCodes;
+    while (hdist > 1 && distLen_[hdist - 1] == 0) hdist--;
+
+    uint16_t clFreq[kLenCodes] = {0};
+    uint8_t clLen[kLenCodes];
+    uint16_t clCode[kLenCodes] = {0};
+    uint16_t rleCount = encodeLengths(hlit, hdist, clFreq);
+    buildLengths(clFreq, kLenCodes, kMaxLenBits, clLen);
+    uint8_t hclen = kLenCodes;
+    while (hclen > 4 && clLen[kLenOrder[hclen - 1]] == 0) hclen--;
+
+    // Sizes in bits; length/distance extra bits cost the same in both
+    uint32_t dynBits = 5 + 5 + 4 + 3 * (uint32_t)hclen;
+    uint32_t fixedBits = 0;
+    for (uint8_t i = 0; i < kLenCodes; i++) {
+        dynBits += (uint32_t)clFreq[i] * clLen[i];
+        if (i >= 16) dynBits += (uint32_t)clFreq[i] * kRepeatExtra[i - 16];
+    }
+    for (uint16_t i = 0; i < kLitCodes; i++) {
+        dynBits += (uint32_t)litFreq_[i] * litLen_[i];
+        fixedBits += (uint32_t)litFreq_[i] * fixedLitLen(i);
+    }
+    for (uint8_t i = 0; i < kDistCodes; i++) {
+        dynBits += (uint32_t)distFreq_[i] * distLen_[i];
+        fixedBits += (uint32_t)distFreq_[i] * 5;
+    }
+
+    putBits(last ? 1 : 0, 1);
+    if (dynBits < fixedBits) {
+        putBits(2, 2);
+        putBits(hlit - 257, 5);
+        putBits(hdist - 1, 5);
+        putBits(hclen - 4, 4);
+        for (uint8_t i = 0; i < hclen; i++) putBits(clLen[kLenOrder[i]], 3);
+        makeCodes(clLen, kLenCodes, clCode);
+        for (uint16_t i = 0; i < rleCount; i++) {
+            uint8_t s = rleSym_[i];
+            putBits(clCode[s], clLen[s]);
+            if (s >= 16) putBits(rleExtra_[i], kRepeatExtra[s - 16]);
+        }
+    } else {
+        putBits(1, 2);
+        for (uint16_t i = 0; i < kLitCodes; i++) litLen_[i] = fixedLitLen(i);
+        for (uint8_t i = 0; i < kDistCodes; i++) distLen_[i] = 5;
+    }
+    makeCodes(litLen_, kLitCodes, litCode_);
+    makeCodes(distLen_, kDistCodes, distCode_);
+
+    for (uint16_t i = 0; i < symCount_ && ok_; i++) {
+        uint16_t dist = symDist_[i];
+        if (dist == 0) {
+            uint8_t c = symLit_[i];
+            putBits(litCode_[c], litLen_[c]);
+            continue;
+        }
+        uint16_t len = symLit_[i] + kMinMatch;
+        uint8_t lc = findCode(kLenBase, 29, len);
+        putBits(litCode_[257 + lc], litLen_[257 + lc]);
+        putBits(len - kLenBase[lc], kLenExtra[lc]);
+        uint8_t dc = findCode(kDistBase, 30, dist);
+        putBits(distCode_[dc], distLen_[dc]);
+        putBits(dist - kDistBase[dc], kDistExtra[dc]);
+    }
+    putBits(litCode_[kEndOfBlock], litLen_[kEndOfBlock]);
+
+    symCount_ = 0;
+    memset(litFreq_, 0, sizeof(litFreq_));
+    memset(distFreq_, 0, sizeof(distFreq_));
+}
+
+void GzipStream::putBits(uint32_t bits, uint8_t count) {
+    bitBuf_ |= bits << bitCount_;
+    bitCount_ += count;
+    while (bitCount_ >= 8) {
+        putByte((uint8_t)bitBuf_);
+        bitBuf_ >>= 8;
+        bitCount_ -= 8;
+    }
+}
+
+void GzipStream::putByte(uint8_t b) {
+    outBuf_[pending_++] = b;
+    if (pending_ == sizeof(outBuf_)) drain();
+}
+
+bool GzipStream::drain() {
+    if (pending_ > 0 && ok_) {
+        ok_ = sink_(outBuf_, pending_, ctx_);
+        out_ += pending_;
+    }
+    pending_ = 0;
+    return ok_;
+}
@@ -0,0 +1,109 @@
+// GzipStream - Streaming gzip (deflate) encoder in fixed memory
+// Bytes fed in are LZ77-matched (lazy, hash chains) against a small sliding
+// window and collected into blocks of up to kBlockSymbols literals/matches.
+// Each block gets its own Huffman tables (RFC 1951 dynamic block), or the
+// fixed ones when those come out smaller, and is handed to a sink as soon
+// as it is coded. Nothing depends on the input length, so a file of any
+// size is compressed in one pass with the same ~23 KiB of state and no
+// allocations.
+//
+// The 2 KiB window gives up some ratio against desktop gzip, but WiGLE CSV
+// repeats itself line to line (timestamps, capability strings, coordinate
+// prefixes), so it still shrinks 3-4x. Output is a gzip member (RFC 1952)
+// that any inflater accepts.
+//
+// Encoding is deterministic: the same input always yields the same bytes,
+// so a caller can run a counting pass for Content-Length and then stream.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class GzipStream {
+public:
+    // Receives compressed bytes in order. Return false to abort.
+    typedef bool (*Sink)(const uint8_t* data, size_t len, void* ctx);
+
+    static constexpr uint8_t kWindowBits = 11;
+    static constexpr size_t kWindowSize = (size_t)1 << kWindowBits;
+    static constexpr uint8_t kHashBits = 11;
+    static constexpr uint16_t kMaxChain = 32;       // Candidates tried per position
+    static constexpr uint16_t kNiceMatch = 128;     // Long enough, stop searching
+    static constexpr uint16_t kBlockSymbols = 2048; // Literals + matches per block
+
+    GzipStream() = default;
+    GzipStream(const GzipStream&) = delete;
+    GzipStream& operator=(const GzipStream&) = delete;
+
+    // Start a stream and emit the gzip header
+    bool begin(Sink sink, void* ctx);
+    bool write(const uint8_t* data, size_t len);
+    // Code what is buffered and emit the last block and the trailer. The
+    // stream is complete only if this returns true.
+    bool finish();
+
+    bool isOpen() const { return open_; }
+    uint32_t bytesIn() const { return in_; }
+    uint32_t bytesOut() const { return out_; }
+
+private:
+    static constexpr uint16_t kNil = 0xFFFF;
+    static constexpr size_t kBufSize = kWindowSize * 2;
+    static constexpr uint16_t kMinMatch = 3;
+    static constexpr uint16_t kMaxMatch = 258;
+    static constexpr uint16_t kLitCodes = 288;      // Incl. the two the fixed table reserves
+    static constexpr uint16_t kDistCodes = 30;
+    static constexpr uint16_t kLenCodes = 19;       // Code length alphabet
+
+    void deflate(bool flush);
+    void slide();
+    void insert(size_t pos);
+    uint16_t longestMatch(size_t pos, uint16_t& dist);
+    void record(uint16_t litOrLen, uint16_t dist);  // dist 0: literal
+    void flushBlock(bool last);
+    void buildLengths(const uint16_t* freq, uint16_t n, uint8_t maxBits, uint8_t* len);
+    uint16_t encodeLengths(uint16_t hlit, uint16_t hdist, uint16_t* clFreq);
+    void putBits(uint32_t bits, uint8_t count);
+    void putByte(uint8_t b);
+    bool drain();
+
+    Sink sink_ = nullptr;
+    void* ctx_ = nullptr;
+    bool open_ = false;
+    bool ok_ = false;
+    uint32_t crc_ = 0;
+    uint32_t in_ = 0;
+    uint32_t out_ = 0;
+    uint32_t bitBuf_ = 0;
+    uint8_t bitCount_ = 0;
+    uint16_t pending_ = 0;          // Bytes in outBuf_ not yet handed to the sink
+
+    // Matcher
+    size_t pos_ = 0;                // Next byte of win_ to look at
+    size_t end_ = 0;                // Bytes of win_ filled
+    bool havePrev_ = false;         // Byte at pos_ - 1 awaits literal or match
+    uint16_t prevLen_ = 0;          // Best match found at pos_ - 1
+    uint16_t prevDist_ = 0;
+    uint8_t win_[kBufSize];         // Window behind pos_ plus lookahead
+    uint16_t head_[1u << kHashBits];
+    uint16_t prev_[kWindowSize];
+
+    // Current block
+    uint16_t symCount_ = 0;
+    uint8_t symLit_[kBlockSymbols]; // Literal, or match length - 3
+    uint16_t symDist_[kBlockSymbols];
+    uint16_t litFreq_[kLitCodes];
+    uint16_t distFreq_[kDistCodes];
+
+    // Block coding scratch
+    uint8_t litLen_[kLitCodes];
+    uint8_t distLen_[kDistCodes];
+    uint16_t litCode_[kLitCodes];   // Bit-reversed, ready for putBits()
+    uint16_t distCode_[kDistCodes];
+    uint32_t work_[kLitCodes];
+    uint16_t sym_[kLitCodes];
+    uint8_t rleSym_[kLitCodes + kDistCodes];
+    uint8_t rleExtra_[kLitCodes + kDistCodes];
+
+    uint8_t outBuf_[1024];          // Sink gets whole KiB pieces (fewer TLS records)
+};
@@ -0,0 +1,72 @@
+// HttpRange - "Range: bytes=..." parsing for file downloads
+// Single ranges only: a multi-range or malformed header is ignored and the
+// whole file is served, which RFC 9110 allows. Ranges are inclusive.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+
+namespace HttpRange {
+
+enum class Result : uint8_t {
+    Full,           // No usable Range header: 200 with the whole file
+    Partial,        // 206 with bytes first..last
+    Unsatisfiable   // 416 with "Content-Range: bytes */size"
+};
+
+namespace detail {
+
+// Digits only, no sign or whitespace; false on overflow
+inline bool parseNumber(const char* s, size_t len, uint64_t& out) {
+    if (len == 0 || len > 19) return false;
+    uint64_t v = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (!isdigit((unsigned char)s[i])) return false;
+        v = v * 10 + (uint64_t)(s[i] - '0');
+    }
+    out = v;
+    return true;
+}
+
+}  // namespace detail
+
+inline Result parse(const char* header, size_t size, size_t& first, size_t& last) {
+    if (!header) return Result::Full;
+    while (*header == ' ') header++;
+    if (strncmp(header, "bytes=", 6) != 0) return Result::Full;
+    const char* spec = header + 6;
+    size_t len = strlen(spec);
+    while (len > 0 && spec[len - 1] == ' ') len--;
+    if (memchr(spec, ',', len)) return Result::Full;
+    const char* dash = (const char*)memchr(spec, '-', len);
+    if (!dash) return Result::Full;
+
+    size_t startLen = (size_t)(dash - spec);
+    size_t endLen = len - startLen - 1;
+    uint64_t a = 0, b = 0;
+
+    if (startLen == 0) {
+        // Suffix: the last N bytes
+        if (!detail::parseNumber(dash + 1, endLen, b)) return Result::Full;
+        if (b == 0 || size == 0) return Result::Unsatisfiable;
+        first = b >= size ? 0 : size - (size_t)b;
+        last = size - 1;
+        return Result::Partial;
+    }
+
+    if (!detail::parseNumber(spec, startLen, a)) return Result::Full;
+    if (endLen == 0) {
+        b = size == 0 ? 0 : size - 1;
+    } else if (!detail::parseNumber(dash + 1, endLen, b) || b < a) {
+        return Result::Full;
+    }
+    if (a >= size) return Result::Unsatisfiable;
+    first = (size_t)a;
+    last = b >= size ? size - 1 : (size_t)b;
+    return Result::Partial;
+}
+
+}  // namespace HttpRange
@@ -0,0 +1,192 @@
+// HttpScheduler - Interleaved response streaming for the file server
+
+#include "http_scheduler.h"
+#include <Arduino.h>
+#include <errno.h>
+#include <lwip/sockets.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace HttpScheduler {
+
+namespace {
+
+enum class SlotState : uint8_t { Free, Reserved, Streaming };
+
+struct Slot {
+    SlotState state;
+    bool eof;               // fill() returned 0
+    WiFiClient client;
+    Job job;
+    size_t pos;             // Next byte of buf to send
+    size_t len;             // Bytes in buf
+    size_t headLeft;        // Head bytes still in buf (not counted as body)
+    size_t bodySent;
+    uint32_t lastProgress;
+};
+
+uint8_t* pool = nullptr;
+Slot slots[kSlots];
+uint8_t nextVisit = 0;      // Round-robin start, so no slot always goes first
+
+void close(uint8_t i, bool complete) {
+    Slot& s = slots[i];
+    s.client.flush();
+    s.client.stop();
+    s.client = WiFiClient();
+    s.state = SlotState::Free;
+    if (s.job.finish) s.job.finish(s.job.ctx, s.bodySent, complete);
+    s.job = {nullptr, nullptr, nullptr};
+}
+
+// One visit: refill when drained, then write at most one quantum
+size_t pump(uint8_t i) {
+    Slot& s = slots[i];
+    uint8_t* buf = pool + (size_t)i * kSlotBytes;
+    if (!s.client.connected()) {
+        close(i, false);
+        return 0;
+    }
+    if (s.pos == s.len && !s.eof) {
+        s.pos = 0;
+        s.len = s.job.fill(buf, kSlotBytes, s.job.ctx);
+        if (s.len > kSlotBytes) s.len = kSlotBytes;
+        if (s.len == 0) s.eof = true;
+    }
+    if (s.pos == s.len) {
+        close(i, true);
+        return 0;
+    }
+
+    size_t chunk = s.len - s.pos;
+    if (chunk > kWriteQuantum) chunk = kWriteQuantum;
+    // Straight to the socket: WiFiClient::write() waits in select() for send
+    // space (up to 10 x 1 s) and availableForWrite() is always 0
+    int fd = s.client.fd();
+    ssize_t sent = fd >= 0 ? lwip_send(fd, buf + s.pos, chunk, MSG_DONTWAIT) : -1;
+    if (sent < 0 && (fd < 0 || (errno != EAGAIN && errno != EWOULDBLOCK))) {
+        close(i, false);
+        return 0;
+    }
+    size_t written = sent > 0 ? static_cast<size_t>(sent) : 0;
+    uint32_t now = millis();
+    if (written == 0) {
+        if (now - s.lastProgress > kStallMs) {
+            Serial.printf("[HTTPQ] Slot %u stalled, dropping client\n", (unsigned)i);
+            close(i, false);
+        }
+        return 0;
+    }
+    s.pos += written;
+    if (s.headLeft >= written) {
+        s.headLeft -= written;
+    } else {
+        s.bodySent += written - s.headLeft;
+        s.headLeft = 0;
+    }
+    s.lastProgress = now;
+    return written;
+}
+
+}  // namespace
+
+bool begin() {
+    if (pool) return true;
+    pool = (uint8_t*)malloc((size_t)kSlots * kSlotBytes);
+    if (!pool) {
+        Serial.println("[HTTPQ] Slot pool allocation failed");
+        return false;
+    }
+    for (uint8_t i = 0; i < kSlots; i++) slots[i].state = SlotState::Free;
+    nextVisit = 0;
+    return true;
+}
+
+void end() {
+    abortAll();
+    for (uint8_t i = 0; i < kSlots; i++) slots[i].state = SlotState::Free;
+    free(pool);
+    pool = nullptr;
+}
+
+int acquire() {
+    if (!pool) return -1;
+    for (uint8_t i = 0; i < kSlots; i++) {
+        if (slots[i].state == SlotState::Free) {
+            slots[i].state = SlotState::Reserved;
+            return i;
+        }
+    }
+    return -1;
+}
+
+void release(int slot) {
+    if (slot < 0 || slot >= kSlots) return;
+    if (slots[slot].state == SlotState::Reserved) slots[slot].state = SlotState::Free;
+}
+
+uint8_t* buffer(int slot) {
+    if (!pool || slot < 0 || slot >= kSlots) return nullptr;
+    return pool + (size_t)slot * kSlotBytes;
+}
+
+bool start(int slot, const WiFiClient& client, const char* head, size_t headLen, const Job& job) {
+    if (slot < 0 || slot >= kSlots || !pool || !job.fill) return false;
+    Slot& s = slots[slot];
+    if (s.state != SlotState::Reserved || headLen > kSlotBytes) return false;
+    memcpy(pool + (size_t)slot * kSlotBytes, head, headLen);
+    s.client = client;
+    s.client.setNoDelay(true);
+    s.job = job;
+    s.pos = 0;
+    s.len = headLen;
+    s.headLeft = headLen;
+    s.bodySent = 0;
+    s.eof = false;
+    s.lastProgress = millis();
+    s.state = SlotState::Streaming;
+    return true;
+}
+
+size_t service(uint32_t budgetMs) {
+    if (!pool) return 0;
+    uint32_t startMs = millis();
+    size_t total = 0;
+    bool progressed = true;
+    // Keep going round while someone moves and the budget lasts; a round
+    // with no progress means every socket is full (or every job is done)
+    while (progressed && active() > 0) {
+        progressed = false;
+        uint8_t first = nextVisit;
+        for (uint8_t k = 0; k < kSlots; k++) {
+            uint8_t i = (uint8_t)((first + k) % kSlots);
+            if (slots[i].state != SlotState::Streaming) continue;
+            size_t n = pump(i);
+            if (n > 0 || slots[i].state != SlotState::Streaming) progressed = true;
+            total += n;
+            if (millis() - startMs >= budgetMs) {
+                nextVisit = (uint8_t)((i + 1) % kSlots);
+                return total;
+            }
+        }
+        nextVisit = (uint8_t)((first + 1) % kSlots);
+        yield();
+    }
+    return total;
+}
+
+uint8_t active() {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < kSlots; i++) {
+        if (slots[i].state == SlotState::Streaming) n++;
+    }
+    return n;
+}
+
+void abortAll() {
+    for (uint8_t i = 0; i < kSlots; i++) {
+        if (slots[i].state == SlotState::Streaming) close(i, false);
+    }
+}
+
+}  // namespace HttpScheduler
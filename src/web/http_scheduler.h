@@ -0,0 +1,61 @@
+// HttpScheduler - Interleaved response streaming for the file server
+// The Arduino WebServer parses and answers one request at a time. Handlers
+// for long responses (downloads, listings) write their status line and
+// headers into a slot here, hand over the client and return, so the server
+// goes straight back to accepting connections. service() then feeds every
+// open slot round-robin within a time budget, one TCP segment per visit.
+// Sends never wait: a slot whose socket is full is skipped until it drains.
+//
+// Slot buffers come from one block allocated by begin(); nothing is
+// allocated per request. Job state lives with the caller, indexed by slot.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <WiFiClient.h>
+
+namespace HttpScheduler {
+
+static constexpr uint8_t kSlots = 4;
+static constexpr size_t kSlotBytes = 1536;
+static constexpr size_t kWriteQuantum = 1436;    // One segment per visit
+static constexpr uint32_t kStallMs = 15000;      // No progress: drop client
+
+// Produce up to cap bytes of body into buf. Return 0 to end the response.
+typedef size_t (*Fill)(uint8_t* buf, size_t cap, void* ctx);
+// Slot closed. sent counts body bytes; complete is false when the client
+// went away or stalled before fill() ran dry.
+typedef void (*Finish)(void* ctx, size_t sent, bool complete);
+
+struct Job {
+    Fill fill;
+    Finish finish;
+    void* ctx;
+};
+
+// Allocate the slot pool / drop every stream and free it
+bool begin();
+void end();
+
+// Reserve a free slot: its index, or -1 when all slots are streaming
+int acquire();
+// Give back a slot reserved but never started
+void release(int slot);
+
+// Slot buffer, e.g. for a job that builds its body in place
+uint8_t* buffer(int slot);
+
+// Queue head (status line + headers, sent first) and start streaming.
+// Takes over client; head must fit in kSlotBytes.
+bool start(int slot, const WiFiClient& client, const char* head, size_t headLen, const Job& job);
+
+// Feed open slots round-robin for up to budgetMs. Returns bytes written.
+size_t service(uint32_t budgetMs);
+
+// Slots streaming right now
+uint8_t active();
+
+// Close every stream (finish() with complete = false)
+void abortAll();
+
+}  // namespace HttpScheduler
@@ -0,0 +1,148 @@
+// JsonWriter - Streaming JSON into a fixed caller-owned buffer
+// Output is built in place and handed to a flush callback whenever the
+// buffer fills, so a response of any length costs one static block and no
+// heap. Commas between members/elements are inserted automatically.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+class JsonWriter {
+public:
+    // Receives output in order. Return false to stop (e.g. client gone).
+    typedef bool (*Flush)(const char* data, size_t len, void* ctx);
+
+    static constexpr uint8_t kMaxDepth = 16;
+
+    JsonWriter() : JsonWriter(nullptr, 0, nullptr, nullptr) {}
+    JsonWriter(char* buf, size_t cap, Flush flush, void* ctx)
+        : buf_(buf), cap_(cap), flush_(flush), ctx_(ctx) {}
+
+    JsonWriter& beginObject() { value(); put('{'); push(); return *this; }
+    JsonWriter& endObject() { pop(); put('}'); return *this; }
+    JsonWriter& beginArray() { value(); put('['); push(); return *this; }
+    JsonWriter& endArray() { pop(); put(']'); return *this; }
+
+    // Member name; the next call writes its value
+    JsonWriter& key(const char* k) {
+        value();
+        quoted(k);
+        put(':');
+        afterKey_ = true;
+        return *this;
+    }
+
+    JsonWriter& str(const char* s) { value(); quoted(s ? s : ""); return *this; }
+    JsonWriter& u32(uint32_t v) { value(); number("%lu", (unsigned long)v); return *this; }
+    JsonWriter& i32(int32_t v) { value(); number("%ld", (long)v); return *this; }
+    JsonWriter& boolean(bool v) { value(); raw(v ? "true" : "false"); return *this; }
+    JsonWriter& null() { value(); raw("null"); return *this; }
+
+    // Shorthands for object members
+    JsonWriter& kv(const char* k, const char* s) { return key(k).str(s); }
+    JsonWriter& kv(const char* k, uint32_t v) { return key(k).u32(v); }
+    JsonWriter& kvBool(const char* k, bool v) { return key(k).boolean(v); }
+
+    // Hand everything buffered to the callback
+    bool flush() {
+        if (used_ > 0 && ok_) {
+            ok_ = flush_(buf_, used_, ctx_);
+            total_ += used_;
+        }
+        used_ = 0;
+        return ok_;
+    }
+
+    // Claim the buffered bytes for sending elsewhere; the buffer restarts
+    // empty. For writers whose buffer is itself the send buffer.
+    size_t take() {
+        size_t n = used_;
+        total_ += used_;
+        used_ = 0;
+        return n;
+    }
+
+    bool ok() const { return ok_; }
+    size_t buffered() const { return used_; }
+    // Bytes handed to the callback so far
+    size_t total() const { return total_; }
+
+private:
+    void put(char c) {
+        if (used_ == cap_ && !flush()) return;
+        if (!ok_) return;
+        buf_[used_++] = c;
+    }
+
+    void raw(const char* s) {
+        while (*s) put(*s++);
+    }
+
+    void number(const char* fmt, unsigned long v) {
+        char tmp[24];
+        snprintf(tmp, sizeof(tmp), fmt, v);
+        raw(tmp);
+    }
+
+    void number(const char* fmt, long v) {
+        char tmp[24];
+        snprintf(tmp, sizeof(tmp), fmt, v);
+        raw(tmp);
+    }
+
+    void quoted(const char* s) {
+        static const char kHex[] = "0123456789abcdef";
+        put('"');
+        for (; *s; s++) {
+            uint8_t c = (uint8_t)*s;
+            if (c == '"' || c == '\\') {
+                put('\\');
+                put((char)c);
+            } else if (c < 0x20) {
+                put('\\');
+                put('u');
+                put('0');
+                put('0');
+                put(kHex[c >> 4]);
+                put(kHex[c & 0x0F]);
+            } else {
+                put((char)c);
+            }
+        }
+        put('"');
+    }
+
+    // Comma before every value/member except the first in its container
+    void value() {
+        if (afterKey_) {
+            afterKey_ = false;
+            return;
+        }
+        if (depth_ == 0) return;
+        uint32_t bit = 1u << (depth_ - 1);
+        if (hasItems_ & bit) put(',');
+        hasItems_ |= bit;
+    }
+
+    void push() {
+        if (depth_ < kMaxDepth) depth_++;
+        hasItems_ &= ~(1u << (depth_ - 1));
+    }
+
+    void pop() {
+        if (depth_ > 0) depth_--;
+    }
+
+    char* buf_;
+    size_t cap_;
+    Flush flush_;
+    void* ctx_;
+    size_t used_ = 0;
+    size_t total_ = 0;
+    uint32_t hasItems_ = 0;   // Bit per depth: container already has a value
+    uint8_t depth_ = 0;
+    bool afterKey_ = false;
+    bool ok_ = true;
+};
@@ -0,0 +1,354 @@
+// PotfileSync - Incremental download of the WPA-SEC potfile
+
+#include "potfile_sync.h"
+#include "cracked_index.h"
+#include "sync_session.h"
+#include "../core/config.h"
+#include "../core/sd_layout.h"
+#include <Arduino.h>
+#include <SD.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace PotfileSync {
+
+namespace {
+
+static constexpr uint8_t kMagic[4] = {'P', 'W', 'P', 'S'};
+static constexpr uint16_t kVersion = 1;
+static constexpr uint32_t kFnvBasis = 2166136261u;
+
+struct State {
+    uint8_t magic[4];
+    uint16_t version;
+    uint16_t bytes;
+    uint32_t remoteBytes;   // Server potfile bytes consumed (ends on a line)
+    uint32_t remoteHash;    // FNV-1a of those bytes
+    uint32_t localBytes;    // Local potfile size after consuming them
+    uint32_t cracked;       // Cracked index count after the last sync
+    uint32_t keyHash;       // API key cookie the bytes belong to
+    char etag[72];
+    char lastModified[40];
+};
+
+inline uint32_t fnv(uint32_t h, uint8_t c) {
+    return (h ^ c) * 16777619u;
+}
+
+uint32_t hashString(const char* s) {
+    uint32_t h = kFnvBasis;
+    while (*s) h = fnv(h, (uint8_t)*s++);
+    return h;
+}
+
+bool loadState(State& st) {
+    File f = SD.open(SDLayout::potfileStatePath(), FILE_READ);
+    if (!f) return false;
+    bool ok = f.read((uint8_t*)&st, sizeof(st)) == sizeof(st);
+    f.close();
+    ok = ok && memcmp(st.magic, kMagic, sizeof(kMagic)) == 0 && st.version == kVersion &&
+         st.bytes == sizeof(State);
+    st.etag[sizeof(st.etag) - 1] = '\0';
+    st.lastModified[sizeof(st.lastModified) - 1] = '\0';
+    return ok;
+}
+
+bool saveState(State& st) {
+    memcpy(st.magic, kMagic, sizeof(kMagic));
+    st.version = kVersion;
+    st.bytes = sizeof(State);
+    File f = SD.open(SDLayout::potfileStatePath(), FILE_WRITE);
+    if (!f) return false;
+    bool ok = f.write((const uint8_t*)&st, sizeof(st)) == sizeof(st);
+    f.close();
+    return ok;
+}
+
+// Local potfile size, false when there is none
+bool localSize(uint32_t& size) {
+    File f = SD.open(SDLayout::wpasecResultsPath(), FILE_READ);
+    if (!f) return false;
+    size = (uint32_t)f.size();
+    f.close();
+    return true;
+}
+
+// "bytes 100-199/200" -> first = 100; "bytes */200" -> total = 200
+bool parseContentRange(const char* s, uint32_t& first, uint32_t& total) {
+    if (strncmp(s, "bytes ", 6) != 0) return false;
+    s += 6;
+    const char* slash = strchr(s, '/');
+    if (!slash) return false;
+    total = strtoul(slash + 1, nullptr, 10);
+    if (*s == '*') return false;
+    first = strtoul(s, nullptr, 10);
+    return true;
+}
+
+// Splits the body into potfile lines while hashing every byte. With a
+// known prefix (200 from a server without Range) the first verifyEnd bytes
+// are only hashed and checked, never stored.
+struct Receiver {
+    File* out;
+    uint32_t pos;               // Remote offset of the next body byte
+    uint32_t hash;              // FNV-1a of remote bytes [0, pos)
+    uint32_t verifyEnd;
+    uint32_t verifyHash;
+    uint32_t committedPos;      // Just after the last complete line
+    uint32_t committedHash;
+    uint32_t lines;
+    size_t lineLen;
+    bool overflow;
+    bool mismatch;
+    char line[160];
+
+    bool verifying() const { return pos < verifyEnd; }
+
+    void feed(const uint8_t* data, size_t n) {
+        for (size_t i = 0; i < n && !mismatch; i++) {
+            uint8_t c = data[i];
+            hash = fnv(hash, c);
+            pos++;
+            if (pos <= verifyEnd) {
+                if (pos < verifyEnd) continue;
+                mismatch = hash != verifyHash;
+                commit();
+                continue;
+            }
+            if (c == '\n') {
+                finishLine();
+                commit();
+            } else if (lineLen < sizeof(line) - 1) {
+                line[lineLen++] = (char)c;
+            } else {
+                overflow = true;
+            }
+        }
+    }
+
+    // Body ended cleanly without a final newline
+    void finishTail() {
+        if (lineLen == 0 && !overflow) return;
+        finishLine();
+        commit();
+    }
+
+    void commit() {
+        committedPos = pos;
+        committedHash = hash;
+    }
+
+    void finishLine() {
+        while (lineLen > 0 && line[lineLen - 1] == '\r') lineLen--;
+        line[lineLen] = '\0';
+        // Format: AP:CLIENT:SSID:password (hashcat potfile); longer lines
+        // than any valid entry are dropped whole
+        int colonCount = 0;
+        for (size_t i = 0; i < lineLen; i++) {
+            if (line[i] == ':') colonCount++;
+        }
+        if (!overflow && colonCount >= 2 && lineLen > 10) {
+            out->println(line);
+            lines++;
+        }
+        lineLen = 0;
+        overflow = false;
+    }
+};
+
+int request(SyncSession& session, const char* path, const char* cookie, const State* resume,
+            char* etag, char* lastModified, char* contentRange) {
+    int status = 0;
+    for (uint8_t attempt = 0; attempt < 2; attempt++) {
+        if (!session.begin("GET", path)) return -1;
+        session.header("Cookie", cookie);
+        if (resume) {
+            char range[24];
+            snprintf(range, sizeof(range), "bytes=%lu-", (unsigned long)resume->remoteBytes);
+            session.header("Range", range);
+            if (resume->etag[0]) session.header("If-None-Match", resume->etag);
+            else if (resume->lastModified[0]) session.header("If-Modified-Since", resume->lastModified);
+        }
+        session.captureHeader("ETag", etag, sizeof(State::etag));
+        session.captureHeader("Last-Modified", lastModified, sizeof(State::lastModified));
+        session.captureHeader("Content-Range", contentRange, 48);
+        status = session.endHeaders(-1) ? session.awaitResponse(15000) : 0;
+        if (status != 0 || !session.shouldRetry()) break;
+        session.end();
+        Serial.println("[WPASEC] Kept-alive connection dropped, resending");
+    }
+    return status;
+}
+
+}  // namespace
+
+bool fetch(SyncSession& session, const char* path, const char* cookie, Result& out,
+           char* err, size_t errLen) {
+    out = {Outcome::Full, 0, 0, 0};
+    const char* potPath = SDLayout::wpasecResultsPath();
+    char scratch[80];
+    snprintf(scratch, sizeof(scratch), "%s.tmp", potPath);
+
+    State st;
+    uint32_t keyHash = hashString(cookie);
+    uint32_t local = 0;
+    bool haveState = loadState(st);
+    bool resume = haveState && st.keyHash == keyHash && st.remoteBytes > 0 &&
+                  localSize(local) && local == st.localBytes;
+    uint32_t cracked = haveState ? st.cracked : 0;
+
+    // Second pass only when the known prefix turned out to be stale
+    for (uint8_t pass = 0; pass < 2; pass++) {
+        char etag[sizeof(State::etag)];
+        char lastModified[sizeof(State::lastModified)];
+        char contentRange[48];
+        int status = request(session, path, cookie, resume ? &st : nullptr,
+                             etag, lastModified, contentRange);
+        if (status < 0) {
+            char tlsErr[64] = {0};
+            int errCode = session.lastTlsError(tlsErr, sizeof(tlsErr) - 1);
+            snprintf(err, errLen, "POTFILE TLS: %d", errCode);
+            return false;
+        }
+        if (status == 0) {
+            session.end();
+            snprintf(err, errLen, "POTFILE TIMEOUT");
+            return false;
+        }
+
+        uint32_t first = 0, total = 0;
+        bool known = parseContentRange(contentRange, first, total);
+        if (resume && (status == 304 || (status == 416 && total == st.remoteBytes))) {
+            session.end();
+            out.outcome = Outcome::NotModified;
+            Serial.println("[WPASEC] Potfile unchanged");
+            return true;
+        }
+        bool stale = resume && (status == 416 || (status == 206 && (!known || first != st.remoteBytes)));
+        if (!stale && status != 200 && !(resume && status == 206)) {
+            session.end();
+            snprintf(err, errLen, "POTFILE HTTP %d", status);
+            return false;
+        }
+
+        File f;
+        if (!stale) f = resume ? SD.open(potPath, FILE_APPEND) : SD.open(scratch, FILE_WRITE);
+        if (!stale && !f) {
+            session.close();
+            session.end();
+            snprintf(err, errLen, "CANNOT WRITE CACHE");
+            return false;
+        }
+
+        Receiver rx = {};
+        rx.out = &f;
+        rx.hash = kFnvBasis;
+        if (resume && status == 206) {
+            rx.pos = st.remoteBytes;
+            rx.hash = st.remoteHash;
+        } else if (resume) {
+            rx.verifyEnd = st.remoteBytes;
+            rx.verifyHash = st.remoteHash;
+        }
+        rx.committedPos = rx.pos;
+        rx.committedHash = rx.hash;
+
+        bool timedOut = false;
+        if (!stale) {
+            uint8_t buf[256];
+            size_t n;
+            uint32_t deadline = millis() + kBodyTimeoutMs;
+            while (!rx.mismatch && (n = session.read(buf, sizeof(buf), 10000)) > 0) {
+                out.bodyBytes += n;
+                rx.feed(buf, n);
+                if ((int32_t)(millis() - deadline) > 0) {
+                    Serial.println("[WPASEC] Potfile download timeout");
+                    session.close();
+                    break;
+                }
+                yield();
+            }
+            timedOut = !rx.mismatch && !session.bodyComplete();
+            if (!timedOut && !rx.mismatch) {
+                if (rx.verifying()) rx.mismatch = true;   // Server copy got shorter
+                else rx.finishTail();
+            }
+            f.close();
+            stale = rx.mismatch;
+        }
+        session.end();
+
+        if (stale) {
+            if (!resume) break;
+            Serial.println("[WPASEC] Potfile changed on the server, downloading all of it");
+            resume = false;
+            continue;
+        }
+        if (timedOut && rx.verifying()) {
+            snprintf(err, errLen, "POTFILE TIMEOUT");
+            return false;
+        }
+        if (!resume) {
+            SD.remove(potPath);
+            if (!SD.rename(scratch, potPath)) {
+                SD.remove(scratch);
+                snprintf(err, errLen, "CANNOT WRITE CACHE");
+                return false;
+            }
+        }
+
+        out.outcome = resume ? Outcome::Delta : Outcome::Full;
+        out.lines = rx.lines;
+        out.fromBytes = resume ? st.localBytes : 0;
+
+        State next = {};
+        next.remoteBytes = rx.committedPos;
+        next.remoteHash = rx.committedHash;
+        next.cracked = cracked;
+        next.keyHash = keyHash;
+        localSize(next.localBytes);
+        strncpy(next.etag, etag, sizeof(next.etag) - 1);
+        strncpy(next.lastModified, lastModified, sizeof(next.lastModified) - 1);
+        if (!saveState(next)) SD.remove(SDLayout::potfileStatePath());
+
+        Serial.printf("[WPASEC] Potfile %s: %lu new lines (%lu bytes received)\n",
+                      resume ? "delta" : "full", (unsigned long)rx.lines,
+                      (unsigned long)out.bodyBytes);
+        return true;
+    }
+    snprintf(err, errLen, "POTFILE CHANGED");
+    return false;
+}
+
+bool updateIndex(const Result& result, uint32_t& newCracked) {
+    newCracked = 0;
+    State st;
+    bool haveState = loadState(st);
+    uint32_t before = haveState ? st.cracked : 0;
+
+    bool ok = false;
+    bool exact = false;
+    if (result.outcome == Outcome::Delta && result.lines > 0) {
+        exact = CrackedIndex::merge(result.fromBytes, newCracked);
+        ok = exact;
+    }
+    if (!ok) {
+        if (result.outcome == Outcome::Full) CrackedIndex::invalidate();
+        ok = CrackedIndex::open();
+    }
+    uint32_t count = CrackedIndex::count();
+    if (!exact && result.outcome != Outcome::NotModified) {
+        newCracked = count > before ? count - before : 0;
+    }
+    if (ok && haveState && st.cracked != count) {
+        st.cracked = count;
+        saveState(st);
+    }
+    return ok;
+}
+
+void reset() {
+    if (Config::isSDAvailable()) SD.remove(SDLayout::potfileStatePath());
+}
+
+}  // namespace PotfileSync
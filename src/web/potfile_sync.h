@@ -0,0 +1,56 @@
+// PotfileSync - Incremental download of the WPA-SEC potfile
+// The potfile only ever grows on the server, so a sync fetches what came
+// after the bytes it already has instead of the whole file:
+//
+// - The last response's ETag / Last-Modified go back as If-None-Match /
+//   If-Modified-Since: 304 means nothing new.
+// - "Range: bytes=<known>-": a 206 is exactly the new lines.
+// - A server that ignores both sends the whole file (200). The prefix we
+//   already have is hashed as it streams past and only the lines after it
+//   are stored. A prefix that no longer matches (server rewrote the file,
+//   other API key) switches to a full download.
+//
+// New lines are appended to the local potfile and merged into the cracked
+// index (CrackedIndex::merge) without re-parsing the old ones.
+//
+// State (meta dir): "PWPS", u16 version, u16 size, then the remote bytes
+// consumed and their FNV-1a hash, the local potfile size they produced,
+// the cracked count, a hash of the API key and the validators. Losing it
+// only costs one full download.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class SyncSession;
+
+namespace PotfileSync {
+
+static constexpr uint32_t kBodyTimeoutMs = 45000;
+
+enum class Outcome : uint8_t {
+    NotModified,    // Server said nothing changed
+    Delta,          // New lines appended to the local potfile
+    Full            // Local potfile replaced
+};
+
+struct Result {
+    Outcome outcome;
+    uint32_t lines;         // Potfile lines written
+    uint32_t bodyBytes;     // Response body bytes received
+    uint32_t fromBytes;     // Delta: local potfile size before the append
+};
+
+// GET path with the key cookie and write what is new to the potfile. On
+// failure err holds a short reason for the UI.
+bool fetch(SyncSession& session, const char* path, const char* cookie, Result& out,
+           char* err, size_t errLen);
+
+// Bring the cracked index up to date with a successful fetch(). Call once
+// the TLS connection is closed. newCracked = BSSIDs not cracked before.
+bool updateIndex(const Result& result, uint32_t& newCracked);
+
+// Forget the state: the next fetch() downloads everything
+void reset();
+
+}  // namespace PotfileSync
@@ -0,0 +1,320 @@
+// SyncSession - One kept-alive HTTPS connection for a WPA-SEC / WiGLE sync
+
+#include "sync_session.h"
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+SyncSession::SyncSession(const char* host, uint16_t port, const char* tag)
+    : host_(host), port_(port), tag_(tag) {}
+
+bool SyncSession::connect() {
+    close();
+    uint32_t t0 = millis();
+    client_.setInsecure();  // Skip cert validation - saves ~10KB heap
+    Serial.printf("[%s] Connecting to %s:%u\n", tag_, host_, (unsigned int)port_);
+    if (!client_.connect(host_, port_, kConnectTimeoutMs)) {
+        char tlsErr[64] = {0};
+        int errCode = client_.lastError(tlsErr, sizeof(tlsErr) - 1);
+        Serial.printf("[%s] TLS connect failed: err=%d (%s)\n", tag_, errCode, tlsErr);
+        return false;
+    }
+    connected_ = true;
+    served_ = 0;
+    handshakes_++;
+    timing_.connectMs = millis() - t0;
+    return true;
+}
+
+void SyncSession::close() {
+    if (connected_) client_.stop();
+    connected_ = false;
+    body_ = Body::None;
+    remaining_ = 0;
+    pending_ = 0;
+    sentHead_ = 0;
+}
+
+bool SyncSession::isConnected() {
+    return connected_ && client_.connected();
+}
+
+int SyncSession::lastTlsError(char* buf, size_t len) {
+    return client_.lastError(buf, len);
+}
+
+bool SyncSession::begin(const char* method, const char* path) {
+    if (inResponse_) end();
+    if (pending_ > 0) close();   // Unread pipelined responses: start clean
+    timing_ = {};
+    retryable_ = false;
+    status_ = 0;
+    captureCount_ = 0;
+
+    bool reuse = isConnected() && (millis() - lastUseMs_) < kIdleCloseMs;
+    if (!reuse && !connect()) return false;
+    inResponse_ = true;
+    send(method, path, reuse ? 0 : timing_.connectMs, reuse);
+    return true;
+}
+
+bool SyncSession::queue(const char* method, const char* path) {
+    if (pending_ == 0) return begin(method, path);
+    if (pending_ >= kMaxInFlight) return false;
+    if (!isConnected()) {
+        retryable_ = served_ > 0;
+        return false;
+    }
+    send(method, path, 0, true);
+    return true;
+}
+
+// Remember the request for its response, then write the request line
+void SyncSession::send(const char* method, const char* path, uint32_t connectMs, bool reused) {
+    Sent& s = sent_[(sentHead_ + pending_) % kMaxInFlight];
+    strncpy(s.method, method, sizeof(s.method) - 1);
+    s.method[sizeof(s.method) - 1] = '\0';
+    strncpy(s.path, path, sizeof(s.path) - 1);
+    s.path[sizeof(s.path) - 1] = '\0';
+    s.connectMs = connectMs;
+    s.reused = reused;
+    s.startMs = millis();
+    pending_++;
+    requests_++;
+    client_.printf("%s %s HTTP/1.1\r\n", method, path);
+    client_.printf("Host: %s\r\n", host_);
+    client_.print("Connection: keep-alive\r\n");
+}
+
+void SyncSession::header(const char* name, const char* value) {
+    client_.printf("%s: %s\r\n", name, value);
+}
+
+void SyncSession::captureHeader(const char* name, char* buf, size_t cap) {
+    if (cap == 0) return;
+    buf[0] = '\0';
+    if (captureCount_ < kMaxCaptures) captures_[captureCount_++] = {name, buf, cap};
+}
+
+bool SyncSession::endHeaders(long contentLength) {
+    if (contentLength >= 0) {
+        client_.printf("Content-Length: %lu\r\n", (unsigned long)contentLength);
+    }
+    return write((const uint8_t*)"\r\n", 2);
+}
+
+bool SyncSession::write(const uint8_t* data, size_t len) {
+    if (client_.write(data, len) == len) return true;
+    // Nothing came back yet: a dropped keep-alive connection, not a reply
+    retryable_ = served_ > 0;
+    return false;
+}
+
+bool SyncSession::waitAvailable(uint32_t timeoutMs) {
+    uint32_t start = millis();
+    while (!client_.available()) {
+        if (!client_.connected()) return false;
+        if (millis() - start >= timeoutMs) return false;
+        delay(1);
+        yield();
+    }
+    return true;
+}
+
+int SyncSession::readByte(uint32_t timeoutMs) {
+    if (!waitAvailable(timeoutMs)) return -1;
+    return client_.read();
+}
+
+// Header/chunk-size line without "\r\n"; -1 if the peer sent nothing
+size_t SyncSession::readRawLine(char* buf, size_t cap, uint32_t timeoutMs) {
+    size_t len = 0;
+    bool any = false;
+    for (;;) {
+        int c = readByte(timeoutMs);
+        if (c < 0) break;
+        any = true;
+        if (c == '\n') break;
+        if (len < cap - 1) buf[len++] = (char)c;
+    }
+    while (len > 0 && buf[len - 1] == '\r') len--;
+    buf[len] = '\0';
+    return any ? len : (size_t)-1;
+}
+
+int SyncSession::awaitResponse(uint32_t timeoutMs) {
+    inResponse_ = true;
+    if (pending_ > 0) {
+        // Oldest request in flight: this response is its
+        const Sent& s = sent_[sentHead_];
+        memcpy(method_, s.method, sizeof(method_));
+        memcpy(path_, s.path, sizeof(path_));
+        startMs_ = s.startMs;
+        timing_ = {};
+        timing_.connectMs = s.connectMs;
+        timing_.reused = s.reused;
+        sentHead_ = (sentHead_ + 1) % kMaxInFlight;
+        pending_--;
+    }
+    markMs_ = millis();
+    timing_.sendMs = markMs_ - startMs_;
+    status_ = 0;
+    body_ = Body::None;
+    remaining_ = 0;
+    complete_ = false;
+
+    char line[128];
+    size_t len = readRawLine(line, sizeof(line), timeoutMs);
+    if (len == (size_t)-1 || strncmp(line, "HTTP/1.", 7) != 0) {
+        // A connection the server closed after earlier replies (idle
+        // keep-alive, request limit) says nothing
+        retryable_ = served_ > 0 && len == (size_t)-1;
+        close();
+        return 0;
+    }
+    served_++;
+    keepAlive_ = line[7] == '1';   // HTTP/1.0 closes unless it says otherwise
+    const char* sp = strchr(line, ' ');
+    status_ = sp ? atoi(sp + 1) : 0;
+    timing_.waitMs = millis() - markMs_;
+    markMs_ = millis();
+
+    bool haveLength = false;
+    bool chunked = false;
+    for (;;) {
+        len = readRawLine(line, sizeof(line), timeoutMs);
+        if (len == (size_t)-1) {
+            close();
+            return status_;
+        }
+        if (len == 0) break;
+        char* colon = strchr(line, ':');
+        if (!colon) continue;
+        *colon = '\0';
+        const char* value = colon + 1;
+        while (*value == ' ') value++;
+        if (strcasecmp(line, "Content-Length") == 0) {
+            haveLength = true;
+            remaining_ = strtoul(value, nullptr, 10);
+        } else if (strcasecmp(line, "Transfer-Encoding") == 0) {
+            chunked = strstr(value, "chunked") != nullptr;
+        } else if (strcasecmp(line, "Connection") == 0) {
+            if (strncasecmp(value, "close", 5) == 0) keepAlive_ = false;
+            else if (strncasecmp(value, "keep-alive", 10) == 0) keepAlive_ = true;
+        }
+        for (uint8_t i = 0; i < captureCount_; i++) {
+            if (strcasecmp(line, captures_[i].name) != 0) continue;
+            strncpy(captures_[i].buf, value, captures_[i].cap - 1);
+            captures_[i].buf[captures_[i].cap - 1] = '\0';
+        }
+    }
+
+    if (chunked) {
+        body_ = Body::Chunked;
+        remaining_ = 0;
+        chunkCrlf_ = false;
+    } else if (haveLength) {
+        body_ = remaining_ > 0 ? Body::Length : Body::None;
+    } else if (status_ == 204 || status_ == 304 || status_ < 200 ||
+               strcmp(method_, "HEAD") == 0) {
+        body_ = Body::None;
+    } else {
+        body_ = Body::UntilClose;
+        keepAlive_ = false;
+    }
+    complete_ = body_ == Body::None;
+    return status_;
+}
+
+// Advance to the next chunk; false after the last one
+bool SyncSession::nextChunk(uint32_t timeoutMs) {
+    char line[32];
+    if (chunkCrlf_) readRawLine(line, sizeof(line), timeoutMs);
+    size_t len = readRawLine(line, sizeof(line), timeoutMs);
+    if (len == (size_t)-1 || len == 0) {
+        keepAlive_ = false;
+        body_ = Body::None;
+        return false;
+    }
+    remaining_ = strtoul(line, nullptr, 16);
+    chunkCrlf_ = true;
+    if (remaining_ == 0) {
+        // Trailers up to the blank line
+        while ((len = readRawLine(line, sizeof(line), timeoutMs)) != 0) {
+            if (len == (size_t)-1) {
+                keepAlive_ = false;
+                break;
+            }
+        }
+        body_ = Body::None;
+        complete_ = true;
+        return false;
+    }
+    return true;
+}
+
+size_t SyncSession::read(uint8_t* buf, size_t len, uint32_t timeoutMs) {
+    if (body_ == Body::None || len == 0) return 0;
+    if (body_ == Body::Chunked && remaining_ == 0 && !nextChunk(timeoutMs)) return 0;
+    size_t want = len;
+    if (body_ != Body::UntilClose && want > remaining_) want = remaining_;
+    if (!waitAvailable(timeoutMs)) {
+        // Closed (end of an until-close body) or stalled: no reuse either way
+        complete_ = body_ == Body::UntilClose && !client_.connected();
+        keepAlive_ = false;
+        body_ = Body::None;
+        return 0;
+    }
+    int n = client_.read(buf, want);
+    if (n <= 0) {
+        keepAlive_ = false;
+        body_ = Body::None;
+        return 0;
+    }
+    if (body_ != Body::UntilClose) {
+        remaining_ -= (size_t)n;
+        if (body_ == Body::Length && remaining_ == 0) {
+            body_ = Body::None;
+            complete_ = true;
+        }
+    }
+    return (size_t)n;
+}
+
+bool SyncSession::readLine(char* buf, size_t cap, size_t& len, uint32_t timeoutMs) {
+    len = 0;
+    bool any = false;
+    uint8_t c;
+    while (read(&c, 1, timeoutMs) == 1) {
+        any = true;
+        if (c == '\n') break;
+        if (len < cap - 1) buf[len++] = (char)c;
+    }
+    while (len > 0 && buf[len - 1] == '\r') len--;
+    buf[len] = '\0';
+    return any;
+}
+
+void SyncSession::end() {
+    if (!inResponse_) return;
+    inResponse_ = false;
+
+    // Skip a short unread body; a long one costs less to reconnect past
+    uint8_t sink[64];
+    size_t drained = 0;
+    while (body_ != Body::None && body_ != Body::UntilClose && drained < kDrainMax) {
+        size_t n = read(sink, sizeof(sink), 2000);
+        if (n == 0) break;
+        drained += n;
+    }
+    if (body_ != Body::None) keepAlive_ = false;
+    if (status_ > 0) timing_.readMs = millis() - markMs_;
+
+    Serial.printf("[%s] %s %s -> %d (%s: connect %lu, send %lu, wait %lu, read %lu ms)\n",
+                  tag_, method_, path_, status_, timing_.reused ? "reused" : "new",
+                  (unsigned long)timing_.connectMs, (unsigned long)timing_.sendMs,
+                  (unsigned long)timing_.waitMs, (unsigned long)timing_.readMs);
+
+    if (!keepAlive_ || status_ == 0) close();
+    lastUseMs_ = millis();
+}
@@ -0,0 +1,136 @@
+// SyncSession - One kept-alive HTTPS connection for a WPA-SEC / WiGLE sync
+// A sync used to open a fresh WiFiClientSecure per file and pay a full TLS
+// handshake (seconds, and the biggest heap spike of the sync) every time.
+// A session connects once and sends every request of the sync over that
+// connection with HTTP/1.1 keep-alive. It reconnects only when the server
+// ends the connection (Connection: close, idle timeout, error), and times
+// and logs every request.
+//
+// The core's WiFiClientSecure runs the whole handshake inside connect() with
+// no way to hand it a saved TLS session, so a reconnect is a full handshake;
+// keeping the one connection open is what saves them.
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClientSecure.h>
+
+class SyncSession {
+public:
+    static constexpr uint32_t kConnectTimeoutMs = 15000;
+    static constexpr uint32_t kIdleCloseMs = 20000;   // Reconnect rather than trust an idle link
+    static constexpr size_t kDrainMax = 4096;         // Larger unread bodies: close instead
+    static constexpr uint8_t kMaxInFlight = 4;        // Pipelined requests awaiting a response
+
+    struct Timing {
+        uint32_t connectMs;     // TLS connect; 0 on a reused connection
+        uint32_t sendMs;        // Request line to last body byte
+        uint32_t waitMs;        // Last body byte to status line
+        uint32_t readMs;        // Status line to end of body
+        bool reused;
+    };
+
+    // tag prefixes the log lines, e.g. "WPASEC"
+    SyncSession(const char* host, uint16_t port, const char* tag);
+    ~SyncSession() { close(); }
+    SyncSession(const SyncSession&) = delete;
+    SyncSession& operator=(const SyncSession&) = delete;
+
+    // Start a request, connecting first if there is no live connection.
+    // Writes the request line, Host and Connection; add headers with
+    // header(), then endHeaders(). False if the connect fails.
+    bool begin(const char* method, const char* path);
+    // Pipelining: start another request on the live connection before the
+    // earlier responses were read. awaitResponse() returns them in order.
+    // Only for requests that are safe to send twice. False if the
+    // connection is gone or kMaxInFlight requests are already unanswered.
+    bool queue(const char* method, const char* path);
+    void header(const char* name, const char* value);
+    // contentLength < 0: request without a body
+    bool endHeaders(long contentLength);
+    // Body bytes; false on a short write (connection lost)
+    bool write(const uint8_t* data, size_t len);
+    bool print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+
+    // Copy the value of a response header into buf ("" if absent). Call
+    // before awaitResponse(); holds for the current request only.
+    void captureHeader(const char* name, char* buf, size_t cap);
+    // Status of the (next) response, 0 if none arrived within timeoutMs.
+    // Consumes the headers; read the body with read() / readLine().
+    int awaitResponse(uint32_t timeoutMs);
+    // Body bytes (chunked bodies are decoded), 0 at the end or on timeout
+    size_t read(uint8_t* buf, size_t len, uint32_t timeoutMs = 5000);
+    // One body line without "\r\n", truncated to cap - 1; false at the end
+    bool readLine(char* buf, size_t cap, size_t& len, uint32_t timeoutMs = 5000);
+    // The whole body arrived (as opposed to a stall or a dropped connection)
+    bool bodyComplete() const { return complete_; }
+    // Done with the response: skip what is left of the body so the next
+    // request can reuse the connection (or close it), and log the timing
+    void end();
+
+    // The last request got no response on a connection that had answered
+    // before: the server dropped the connection, so send it again
+    bool shouldRetry() const { return retryable_; }
+
+    void close();
+    bool isConnected();
+    // mbedTLS error of the connection, as WiFiClientSecure::lastError()
+    int lastTlsError(char* buf, size_t len);
+
+    const Timing& lastTiming() const { return timing_; }
+    uint16_t requestCount() const { return requests_; }
+    uint16_t handshakeCount() const { return handshakes_; }
+
+private:
+    enum class Body : uint8_t { None, Length, Chunked, UntilClose };
+    static constexpr uint8_t kMaxCaptures = 3;
+
+    struct Capture {
+        const char* name;
+        char* buf;
+        size_t cap;
+    };
+
+    // A sent request whose response is unread, for its log line and timing
+    struct Sent {
+        char method[8];
+        char path[48];
+        uint32_t startMs;
+        uint32_t connectMs;     // 0 unless this request opened the connection
+        bool reused;
+    };
+
+    bool connect();
+    void send(const char* method, const char* path, uint32_t connectMs, bool reused);
+    bool waitAvailable(uint32_t timeoutMs);
+    int readByte(uint32_t timeoutMs);
+    size_t readRawLine(char* buf, size_t cap, uint32_t timeoutMs);   // (size_t)-1: nothing
+    bool nextChunk(uint32_t timeoutMs);
+
+    WiFiClientSecure client_;
+    const char* host_;
+    uint16_t port_;
+    const char* tag_;
+    bool connected_ = false;
+    bool keepAlive_ = false;
+    bool retryable_ = false;
+    bool inResponse_ = false;
+    bool chunkCrlf_ = false;        // A chunk's data ended; its CRLF is unread
+    bool complete_ = false;
+    Capture captures_[kMaxCaptures] = {};
+    uint8_t captureCount_ = 0;
+    Body body_ = Body::None;
+    size_t remaining_ = 0;          // Length: body bytes; Chunked: bytes left in chunk
+    uint32_t lastUseMs_ = 0;
+    uint32_t startMs_ = 0;
+    uint32_t markMs_ = 0;
+    int status_ = 0;
+    char method_[8] = {0};          // Request of the current response
+    char path_[48] = {0};
+    Timing timing_ = {};
+    Sent sent_[kMaxInFlight] = {};  // Ring, oldest at sentHead_
+    uint8_t sentHead_ = 0;
+    uint8_t pending_ = 0;           // Requests sent whose status line is unread
+    uint16_t served_ = 0;           // Responses on the current connection
+    uint16_t requests_ = 0;
+    uint16_t handshakes_ = 0;
+};
@@ -0,0 +1,1255 @@
+// Auto-generated by scripts/pre_build.py from src/web/fileserver.cpp - do not edit
+// gzip copies of the web UI raw strings, plus content-hash ETags
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <pgmspace.h>
+
+// HTML_TEMPLATE: 14783 -> 2548 bytes
+#define WEB_ASSET_HTML_HASH "c9f63e6f1ebd26f0"
+static const size_t WEB_ASSET_HTML_GZ_LEN = 2548;
+static const uint8_t WEB_ASSET_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x5b, 0x4b, 0x73, 0x9b, 0x4a,
+    0x16, 0xde, 0xeb, 0x57, 0xf4, 0xa5, 0x6a, 0xca, 0x76, 0x4d, 0xf4, 0xf0, 0x23, 0xb9, 0xbe, 0xb6,
+    0xa4, 0x29, 0x8c, 0x5a, 0xb6, 0xca, 0x18, 0xb8, 0x80, 0x22, 0x7b, 0x33, 0x55, 0x04, 0x5a, 0x16,
+    0xd7, 0x08, 0x18, 0x68, 0xd9, 0xf1, 0x54, 0x16, 0xb3, 0xca, 0x7e, 0x1e, 0xcb, 0x59, 0xce, 0x2f,
+    0xcb, 0x2f, 0x99, 0xd3, 0x80, 0x04, 0x48, 0x20, 0x23, 0xc7, 0x4e, 0x25, 0x15, 0xb9, 0x62, 0x07,
+    0xfa, 0x71, 0xfa, 0xf4, 0x39, 0x7d, 0xce, 0xf7, 0x75, 0xb7, 0x54, 0x6b, 0xff, 0xd2, 0x93, 0x05,
+    0xfd, 0x46, 0xc1, 0x68, 0x42, 0xa7, 0x4e, 0xb7, 0xd6, 0x9e, 0xff, 0x47, 0x0c, 0xab, 0x5b, 0x43,
+    0xf0, 0xd3, 0x9e, 0x12, 0x6a, 0x20, 0x73, 0x62, 0x04, 0x21, 0xa1, 0x1d, 0x6e, 0xa8, 0xf7, 0xeb,
+    0xc7, 0x5c, 0xb6, 0xca, 0x35, 0xa6, 0xa4, 0xc3, 0xdd, 0xdb, 0xe4, 0xc1, 0xf7, 0x02, 0xca, 0x21,
+    0xd3, 0x73, 0x29, 0x71, 0xa1, 0xe9, 0x83, 0x6d, 0xd1, 0x49, 0xc7, 0x22, 0xf7, 0xb6, 0x49, 0xea,
+    0xd1, 0xcb, 0x1b, 0x64, 0xbb, 0x36, 0xb5, 0x0d, 0xa7, 0x1e, 0x9a, 0x86, 0x43, 0x3a, 0xfb, 0x8d,
+    0xd6, 0x5c, 0x14, 0xb5, 0xa9, 0x43, 0xba, 0x8a, 0xf0, 0xee, 0xa8, 0x81, 0xaf, 0x71, 0xbb, 0x19,
+    0xbf, 0xc7, 0x75, 0x8e, 0xed, 0xde, 0xa1, 0x80, 0x38, 0x1d, 0x2e, 0xa4, 0x8f, 0x0e, 0x09, 0x27,
+    0x84, 0xc0, 0x38, 0x93, 0x80, 0x8c, 0x3b, 0x5c, 0x73, 0x66, 0x37, 0xcc, 0x30, 0x04, 0x31, 0xed,
+    0x66, 0xac, 0x74, 0xfb, 0x83, 0x67, 0x3d, 0x22, 0xd3, 0x31, 0xc2, 0xb0, 0xc3, 0x4d, 0xcd, 0xf9,
+    0x00, 0x96, 0x7d, 0x3f, 0x2f, 0x64, 0xed, 0x48, 0x90, 0x54, 0x44, 0x95, 0x93, 0xfd, 0xcc, 0xd0,
+    0xf0, 0x92, 0xd6, 0x64, 0xba, 0x85, 0x56, 0xdd, 0x76, 0xc7, 0x1e, 0x87, 0x6c, 0x8b, 0xbd, 0x0c,
+    0xd8, 0x73, 0xb7, 0xd1, 0x68, 0xb4, 0x9b, 0xd0, 0x28, 0x19, 0x25, 0xf3, 0x98, 0xed, 0xf9, 0x60,
+    0xbb, 0xa4, 0x1e, 0xd2, 0xc0, 0xf6, 0xb9, 0x12, 0xd9, 0x51, 0x0b, 0x98, 0x28, 0x49, 0xc4, 0xb3,
+    0x77, 0x11, 0x7e, 0xf7, 0xb9, 0xae, 0xf8, 0xbe, 0x85, 0xa4, 0x16, 0xea, 0x1d, 0xe9, 0x3c, 0xfa,
+    0x84, 0xf4, 0xfd, 0x43, 0x15, 0x5e, 0x25, 0x0c, 0xcf, 0xd7, 0x0a, 0x6a, 0xa1, 0xdd, 0xd6, 0x9f,
+    0xf6, 0xe0, 0xf9, 0xec, 0xa8, 0x77, 0x7e, 0xa8, 0xa1, 0x56, 0xb3, 0x95, 0x51, 0xa2, 0xf2, 0x30,
+    0x07, 0x5c, 0x77, 0xb4, 0x7f, 0x2e, 0x1e, 0x22, 0xa9, 0xc9, 0x06, 0x39, 0x1b, 0xf6, 0xfb, 0x27,
+    0x6c, 0x94, 0xc3, 0xe2, 0xc9, 0xad, 0xcc, 0x70, 0x6a, 0xd8, 0x6e, 0xc9, 0xd4, 0x7c, 0xc3, 0x25,
+    0x61, 0xa6, 0xae, 0xa8, 0x1e, 0x19, 0x26, 0xb5, 0xef, 0x13, 0xa5, 0x58, 0x81, 0xc8, 0x21, 0xcf,
+    0x35, 0x1d, 0xdb, 0xbc, 0x03, 0x25, 0x09, 0xe5, 0xa3, 0x6a, 0x05, 0x2a, 0x76, 0x77, 0xc4, 0x9d,
+    0xbd, 0x25, 0x69, 0x45, 0x12, 0xeb, 0x2b, 0x4e, 0xce, 0xb5, 0x0e, 0xa1, 0x4d, 0xae, 0xb9, 0x45,
+    0x4c, 0x2f, 0xa8, 0x3b, 0x64, 0x4c, 0xb9, 0xee, 0x97, 0xff, 0xfc, 0xe3, 0x27, 0xfb, 0xf7, 0xbf,
+    0x76, 0x93, 0x59, 0xa4, 0xaa, 0xb1, 0x7c, 0x83, 0x4e, 0xe6, 0xbe, 0xa2, 0x13, 0x91, 0xeb, 0x36,
+    0x37, 0xeb, 0x1f, 0x1b, 0x3b, 0xb0, 0x6f, 0x27, 0x91, 0xb5, 0xff, 0xfb, 0xb3, 0x19, 0xbc, 0xcc,
+    0x5a, 0x4b, 0x91, 0x5b, 0xb4, 0xb6, 0x4d, 0xcf, 0x79, 0x62, 0x69, 0x2f, 0x35, 0x0e, 0x59, 0x52,
+    0xee, 0x96, 0x48, 0x2e, 0xea, 0xc0, 0xf2, 0x39, 0xd7, 0x95, 0xe0, 0xef, 0x06, 0x9d, 0x42, 0xfb,
+    0xef, 0xd0, 0x49, 0x83, 0xbf, 0x1b, 0x74, 0xa2, 0x36, 0x1b, 0xe9, 0xca, 0xb3, 0xec, 0x71, 0xd9,
+    0xcc, 0x9f, 0x36, 0xc8, 0xd8, 0x76, 0x58, 0x46, 0x0b, 0x69, 0xbc, 0x20, 0xd9, 0x93, 0x58, 0x3a,
+    0xdf, 0x95, 0x2c, 0x31, 0xf6, 0x3c, 0xba, 0x41, 0x96, 0x88, 0x9b, 0x6f, 0x93, 0xc5, 0x26, 0xc1,
+    0x3e, 0xb7, 0x99, 0x1d, 0xde, 0xc5, 0x2e, 0x8a, 0x0b, 0x7a, 0xf0, 0x1e, 0x39, 0xea, 0x39, 0xb2,
+    0xb6, 0xf9, 0xa3, 0x6a, 0xfe, 0x28, 0x2a, 0x5a, 0x0a, 0x82, 0x14, 0x75, 0xd5, 0x72, 0xd4, 0x55,
+    0xb7, 0xa8, 0xfb, 0x7d, 0xa1, 0xae, 0xba, 0x45, 0xdd, 0x2d, 0xea, 0x7e, 0x4f, 0xa8, 0xab, 0x6e,
+    0x51, 0xf7, 0xc7, 0x40, 0x5d, 0x75, 0x8b, 0xba, 0xdf, 0x18, 0x75, 0x4b, 0x8e, 0x05, 0x3c, 0x3f,
+    0x2c, 0xd9, 0x33, 0x43, 0x4d, 0x9d, 0x99, 0xde, 0x59, 0xb3, 0x6f, 0x66, 0x6d, 0x3e, 0x38, 0x9e,
+    0x79, 0xf7, 0x04, 0x2e, 0xb3, 0x76, 0xd5, 0x61, 0x99, 0xb5, 0xde, 0x06, 0x5a, 0xb5, 0xe0, 0x60,
+    0xb6, 0x8a, 0xce, 0xa9, 0xea, 0x0f, 0x81, 0xe1, 0x97, 0x58, 0xb7, 0xbc, 0x17, 0xd7, 0x1d, 0x29,
+    0x7c, 0x5d, 0xc3, 0x02, 0xfa, 0x7d, 0x88, 0x87, 0x78, 0xdd, 0xb0, 0x85, 0x42, 0xa2, 0xd3, 0xb7,
+    0xf9, 0x03, 0x3b, 0xd4, 0x49, 0x22, 0xfd, 0xc1, 0x37, 0xae, 0xa0, 0x24, 0xcb, 0xe5, 0x26, 0xde,
+    0x83, 0x10, 0x10, 0x2b, 0x84, 0xac, 0x6f, 0x38, 0xbb, 0xc0, 0xe4, 0x2e, 0xf1, 0xcd, 0x09, 0x1a,
+    0x4a, 0x97, 0x92, 0x3c, 0x92, 0x36, 0x1e, 0x98, 0x1d, 0xd6, 0x78, 0x6e, 0xb8, 0x66, 0xc2, 0x51,
+    0xb7, 0x0f, 0x33, 0x4a, 0xbd, 0x45, 0xc7, 0x0f, 0xd4, 0x45, 0xf0, 0x5b, 0xf7, 0x66, 0x34, 0x3d,
+    0x7f, 0x82, 0x82, 0x91, 0x6f, 0xc8, 0x3e, 0x71, 0x33, 0xda, 0x3e, 0xc4, 0x25, 0x2a, 0x09, 0x67,
+    0x0e, 0x0d, 0x99, 0xb6, 0x8a, 0xac, 0xa3, 0xfe, 0x40, 0x04, 0x13, 0xc5, 0x32, 0xd7, 0xe8, 0xba,
+    0xce, 0x77, 0x9b, 0xf8, 0x75, 0x9b, 0xec, 0x9e, 0x4d, 0x96, 0xfe, 0x36, 0x23, 0xb3, 0x78, 0x27,
+    0x80, 0xc0, 0x95, 0x6b, 0x08, 0x53, 0x37, 0xf6, 0x29, 0x7b, 0x8a, 0x5e, 0x35, 0x6d, 0xd0, 0xcb,
+    0xbc, 0x2a, 0xbc, 0xa6, 0xa5, 0xaf, 0x79, 0xe9, 0x21, 0x35, 0xe8, 0x0c, 0x56, 0xa0, 0xa6, 0x3f,
+    0x9f, 0xc3, 0xc4, 0x92, 0x52, 0x12, 0x03, 0xca, 0xfe, 0xce, 0x8a, 0xca, 0x79, 0x8c, 0xed, 0xfa,
+    0x33, 0x8a, 0xe8, 0xa3, 0x4f, 0x62, 0x06, 0xb4, 0xe8, 0xa7, 0xc0, 0xc2, 0xe5, 0x90, 0x61, 0x9a,
+    0xc4, 0xa7, 0x1d, 0xae, 0x41, 0x3f, 0xd2, 0x37, 0x0d, 0xdf, 0xa3, 0x71, 0x9b, 0xe8, 0xd0, 0xba,
+    0xc3, 0x01, 0x14, 0xfb, 0x8e, 0xf1, 0x78, 0xe2, 0x7a, 0xb0, 0xfa, 0xab, 0xc2, 0xc5, 0x16, 0x18,
+    0x7e, 0x4e, 0x60, 0x18, 0x9c, 0x8b, 0xf8, 0xa5, 0x61, 0xc1, 0xbe, 0x75, 0xc8, 0x93, 0xc0, 0x20,
+    0xa8, 0xb8, 0xa7, 0x7d, 0x7b, 0x68, 0x48, 0xe1, 0x80, 0x69, 0xa9, 0x3d, 0xba, 0x66, 0x16, 0x10,
+    0xe6, 0x65, 0x4c, 0x41, 0xed, 0x46, 0x12, 0xb6, 0x38, 0xf0, 0xa3, 0xe1, 0x00, 0xf3, 0xe0, 0x06,
+    0x48, 0x20, 0x61, 0xfd, 0xdb, 0xa6, 0x7e, 0xa6, 0x5f, 0x79, 0xf2, 0x5f, 0x43, 0xe7, 0xab, 0x5d,
+    0x8f, 0xf9, 0x81, 0x77, 0x1b, 0x90, 0x10, 0xf2, 0xb2, 0x11, 0x24, 0x47, 0x38, 0x49, 0xc9, 0x19,
+    0x14, 0x74, 0x0b, 0x9b, 0x02, 0x78, 0x38, 0xf9, 0xb6, 0x7d, 0x56, 0x92, 0xe8, 0xb7, 0x6e, 0xb4,
+    0xc4, 0x42, 0xf1, 0x0d, 0x5f, 0x62, 0x2d, 0x7e, 0xc4, 0x0f, 0xf4, 0x81, 0x74, 0x8e, 0x64, 0xb5,
+    0x87, 0x55, 0x0d, 0x7d, 0x42, 0x5f, 0x3e, 0xff, 0xf3, 0xcb, 0xe7, 0x7f, 0x23, 0x89, 0x7f, 0x0f,
+    0x2f, 0x9a, 0xc2, 0x0b, 0x18, 0x69, 0x58, 0x84, 0x67, 0x2c, 0xe9, 0x58, 0x45, 0xf8, 0x1a, 0x88,
+    0xe9, 0x27, 0xa4, 0xf3, 0x67, 0xa8, 0x2f, 0x0e, 0x94, 0x64, 0xbc, 0xe2, 0x01, 0xc7, 0x77, 0xe4,
+    0x31, 0x9a, 0x5a, 0x31, 0x68, 0xb1, 0xea, 0xa5, 0xa4, 0x73, 0x41, 0x1c, 0x9f, 0x45, 0x73, 0x14,
+    0x6f, 0xdd, 0xfe, 0x7e, 0xb2, 0xcc, 0xfe, 0xb2, 0x06, 0xfa, 0x0a, 0xa4, 0xa8, 0x84, 0x1d, 0x9b,
+    0x2c, 0x72, 0x57, 0x22, 0xec, 0x20, 0x11, 0xa6, 0x62, 0xa9, 0xba, 0xb8, 0x80, 0x8c, 0xc1, 0xc4,
+    0x93, 0x8c, 0x98, 0xc3, 0x85, 0x98, 0xfe, 0x66, 0x5a, 0x61, 0xcb, 0xa6, 0xcb, 0x3a, 0x1d, 0x25,
+    0xc2, 0x70, 0x4f, 0xaf, 0x2e, 0xcc, 0xf4, 0xfc, 0x47, 0x8d, 0x38, 0xc4, 0xa4, 0xc4, 0xca, 0xc8,
+    0x7a, 0x9b, 0xc8, 0x12, 0x94, 0x9b, 0xea, 0xb2, 0xa6, 0xde, 0x3d, 0x29, 0x90, 0xf5, 0x2e, 0x91,
+    0x75, 0x25, 0xbf, 0xdf, 0x6c, 0x92, 0x12, 0x79, 0xe8, 0x7b, 0x0e, 0x70, 0x87, 0xe5, 0x99, 0xfe,
+    0x3a, 0x97, 0x78, 0xd9, 0xab, 0x2e, 0xd1, 0x02, 0xcd, 0x68, 0x91, 0x7e, 0xc7, 0x89, 0xb4, 0x1e,
+    0x16, 0xab, 0x4b, 0xa3, 0x90, 0xae, 0x6f, 0x49, 0x30, 0xf4, 0x1d, 0xcf, 0xb0, 0x18, 0x35, 0x23,
+    0x41, 0x46, 0xe4, 0x6f, 0x89, 0x48, 0x65, 0xa8, 0x6f, 0x36, 0x65, 0xd1, 0xbb, 0x15, 0x00, 0xdb,
+    0x3c, 0x87, 0xa4, 0xd2, 0xf6, 0x5b, 0x89, 0x34, 0x51, 0x3e, 0x5f, 0xcd, 0x05, 0x25, 0x84, 0x71,
+    0xb6, 0x50, 0x8c, 0x43, 0x53, 0xd8, 0xe3, 0xd8, 0xbe, 0x43, 0xd8, 0x50, 0x13, 0xc3, 0xbd, 0x25,
+    0xf3, 0x6a, 0x08, 0x76, 0x12, 0xee, 0xd2, 0x89, 0x1d, 0x36, 0x58, 0xcf, 0x70, 0x6f, 0x1d, 0x91,
+    0x8c, 0x07, 0xfd, 0xa5, 0x5e, 0x47, 0xe0, 0x17, 0x14, 0x3b, 0x06, 0x45, 0x9e, 0x41, 0xf5, 0xfa,
+    0xea, 0xc1, 0xc3, 0x94, 0xd5, 0xc4, 0xba, 0xb8, 0x39, 0x3f, 0x66, 0x66, 0x6c, 0x8f, 0x77, 0xc9,
+    0x3d, 0x71, 0x69, 0x83, 0x1a, 0xc1, 0x2d, 0xa1, 0x9d, 0x4e, 0x87, 0xe9, 0xb2, 0x37, 0xb1, 0xad,
+    0x34, 0xe0, 0x0a, 0x2d, 0x17, 0x09, 0xaf, 0x27, 0x9f, 0x02, 0x59, 0xa6, 0xa9, 0x93, 0x43, 0xc8,
+    0xed, 0x23, 0xd4, 0x97, 0x45, 0xc8, 0x42, 0xed, 0x26, 0xbc, 0xd6, 0x4a, 0x19, 0x36, 0x25, 0x1f,
+    0xe9, 0x92, 0x92, 0xec, 0x7c, 0x94, 0x43, 0x30, 0x7b, 0x93, 0x4c, 0xa2, 0x82, 0x0e, 0x17, 0x8b,
+    0x82, 0x34, 0x76, 0x85, 0x39, 0x54, 0x04, 0x30, 0x9e, 0x0b, 0xae, 0xb4, 0xbc, 0x07, 0x37, 0x33,
+    0x27, 0x28, 0x81, 0x09, 0xed, 0x60, 0xd0, 0x31, 0xd8, 0xd9, 0x33, 0x03, 0x62, 0x50, 0x12, 0x8f,
+    0xb0, 0xbb, 0x77, 0xba, 0xd2, 0x2a, 0x34, 0x0d, 0x9f, 0xec, 0x94, 0x4c, 0xbd, 0x78, 0xfa, 0xe5,
+    0x3c, 0xa8, 0x88, 0xfb, 0xa4, 0x11, 0x9f, 0xd3, 0x24, 0x62, 0x63, 0xbc, 0xbe, 0x66, 0xdb, 0xfb,
+    0xd4, 0x1e, 0x7b, 0x21, 0x38, 0xa7, 0xbb, 0xc0, 0x4b, 0x02, 0x8b, 0xa7, 0x22, 0xa9, 0x95, 0xa0,
+    0x2e, 0x5d, 0x6e, 0x2c, 0x8f, 0x57, 0x5b, 0x68, 0x13, 0x68, 0xf9, 0xcd, 0xd6, 0xd8, 0x25, 0xbe,
+    0x39, 0x93, 0x79, 0xb5, 0x87, 0xb4, 0x0b, 0x59, 0xd5, 0x85, 0x21, 0x63, 0x13, 0x2b, 0x6b, 0xcd,
+    0x0f, 0xc8, 0x3c, 0xa4, 0xc6, 0x20, 0x29, 0x3a, 0x4d, 0x3f, 0x69, 0x35, 0x8e, 0xdf, 0x92, 0xe9,
+    0x29, 0x33, 0x1f, 0x50, 0x17, 0x46, 0xfb, 0x4e, 0xf6, 0x1b, 0xef, 0x4e, 0x3d, 0xdf, 0x30, 0x6d,
+    0xfa, 0xc8, 0xaa, 0x61, 0x38, 0x5e, 0x55, 0xe5, 0x11, 0x1a, 0x2a, 0xcd, 0x1e, 0x70, 0x64, 0xc4,
+    0x20, 0x74, 0x70, 0x0e, 0x7e, 0x8a, 0xce, 0x28, 0xb4, 0x5a, 0x8c, 0x9f, 0x8b, 0x1f, 0x59, 0xc1,
+    0x52, 0xb2, 0xe0, 0x51, 0x13, 0xb1, 0x1e, 0xa2, 0xcc, 0xf7, 0x6a, 0x31, 0xe2, 0x2e, 0x7e, 0x74,
+    0xf9, 0x9c, 0x51, 0x7e, 0x40, 0x60, 0x2c, 0xe8, 0x03, 0x59, 0xaa, 0x31, 0xe0, 0xcd, 0xfc, 0x68,
+    0xa3, 0x81, 0x2e, 0x5c, 0x20, 0x85, 0x97, 0x70, 0x4d, 0xd0, 0x55, 0xf1, 0xcf, 0x7c, 0x5a, 0x15,
+    0xf5, 0x41, 0xbc, 0x28, 0xd6, 0xfa, 0x07, 0xb9, 0xe5, 0x01, 0x08, 0x08, 0x61, 0x01, 0x83, 0x0b,
+    0x43, 0x0d, 0xf7, 0xd0, 0x40, 0xc7, 0x57, 0xb5, 0xfe, 0x51, 0xae, 0x09, 0xee, 0x0d, 0xe2, 0xb3,
+    0x15, 0xb4, 0xdb, 0xee, 0x1c, 0x5c, 0x9e, 0xed, 0xd5, 0xfa, 0x87, 0x4b, 0x32, 0xfa, 0x2a, 0xd6,
+    0x2e, 0x6a, 0xfd, 0xb7, 0xb9, 0x62, 0x41, 0x56, 0x6e, 0x22, 0xbe, 0xf0, 0xe5, 0xf3, 0xbf, 0x90,
+    0xac, 0x5f, 0xc0, 0xe4, 0x22, 0xdd, 0xfa, 0xef, 0x72, 0xcd, 0x00, 0x57, 0x70, 0x61, 0xb3, 0x5f,
+    0x73, 0xcd, 0xd2, 0x9c, 0x50, 0xeb, 0x1f, 0x37, 0x21, 0xd9, 0x63, 0x3d, 0xb1, 0x4d, 0xf2, 0x1c,
+    0xcf, 0x11, 0xf7, 0x6a, 0xfd, 0xdf, 0x72, 0x1d, 0x87, 0x4a, 0x64, 0xcc, 0xfe, 0x7e, 0x2b, 0x5b,
+    0x0a, 0xc9, 0x18, 0x14, 0x94, 0x34, 0x59, 0x4c, 0x8c, 0x95, 0xba, 0xe4, 0x6a, 0x28, 0xea, 0x83,
+    0xd4, 0x0b, 0x67, 0xbc, 0x70, 0x99, 0xf1, 0x84, 0xc2, 0x83, 0xc9, 0xf4, 0xb9, 0x2a, 0xf9, 0xb8,
+    0x80, 0xe5, 0xf2, 0x4a, 0x51, 0x9f, 0x0f, 0x4e, 0x51, 0xd6, 0xf0, 0x33, 0x63, 0x33, 0x8d, 0x4b,
+    0xc0, 0x2a, 0x94, 0x80, 0x55, 0xb5, 0xf0, 0x74, 0xbc, 0xdb, 0x0d, 0xa2, 0x33, 0x0f, 0x85, 0x85,
+    0x21, 0x0a, 0x02, 0x59, 0x80, 0xb2, 0x36, 0x05, 0x01, 0x9a, 0xf1, 0x50, 0x49, 0x64, 0x26, 0x4a,
+    0x09, 0x73, 0x11, 0x92, 0xcc, 0xdc, 0xaa, 0xbd, 0xb6, 0x1f, 0xf2, 0x33, 0x7b, 0x19, 0x67, 0x30,
+    0x42, 0x58, 0xcd, 0x0b, 0x64, 0x4e, 0x1d, 0x9f, 0x76, 0x83, 0xe9, 0x78, 0x21, 0x49, 0xa9, 0xe6,
+    0xd8, 0x70, 0x42, 0x52, 0x29, 0x5d, 0x22, 0x36, 0x08, 0xec, 0x69, 0x4b, 0xb2, 0x67, 0xa6, 0x5b,
+    0xd2, 0xb0, 0xf4, 0x8c, 0xa8, 0xa0, 0x6d, 0x7c, 0x7e, 0xb1, 0x98, 0x8b, 0x1e, 0x1f, 0x67, 0xb0,
+    0x24, 0x53, 0x61, 0x57, 0x96, 0xc8, 0x98, 0x46, 0x67, 0x14, 0x0b, 0x73, 0xb0, 0xb7, 0x6e, 0xab,
+    0x79, 0xd0, 0x3a, 0x3a, 0x46, 0x67, 0x9b, 0x7f, 0xc2, 0x21, 0x11, 0xca, 0x3e, 0x14, 0x5a, 0x34,
+    0x05, 0x46, 0x32, 0x0c, 0x40, 0xdd, 0xe5, 0x79, 0x24, 0xc5, 0x99, 0xa9, 0x44, 0x6c, 0x24, 0x43,
+    0x26, 0x80, 0xad, 0x59, 0x4e, 0xe4, 0x81, 0x4b, 0xf2, 0x18, 0xbb, 0x68, 0x8f, 0x35, 0x88, 0x28,
+    0x4c, 0xb6, 0x7a, 0xc0, 0x0a, 0x22, 0xca, 0xd8, 0x9c, 0x8b, 0x7d, 0xce, 0x0c, 0x4a, 0x2f, 0x4d,
+    0x0b, 0xda, 0x82, 0x92, 0xe1, 0x9c, 0xa2, 0xfe, 0x55, 0x4e, 0x28, 0x2a, 0xd2, 0x78, 0x48, 0xc6,
+    0x28, 0x29, 0xbd, 0x9e, 0x97, 0xce, 0xd9, 0x40, 0x55, 0xf7, 0x64, 0x77, 0x97, 0xac, 0x48, 0x4b,
+    0x76, 0x98, 0x40, 0x55, 0x7a, 0x37, 0xcf, 0xdd, 0x3c, 0xa7, 0xc1, 0x12, 0xef, 0xe9, 0xaa, 0x85,
+    0x4b, 0x90, 0xee, 0xff, 0xbe, 0x05, 0xab, 0x88, 0xe1, 0xb4, 0x32, 0x6b, 0x8d, 0xb5, 0x03, 0x42,
+    0x5e, 0xc0, 0x5a, 0x19, 0xe0, 0x45, 0x94, 0xf5, 0x79, 0x8c, 0xd5, 0xf2, 0x62, 0x33, 0x3d, 0x8f,
+    0xad, 0x66, 0xd5, 0x85, 0x66, 0x16, 0x71, 0xb3, 0x0a, 0xcb, 0x8e, 0xa5, 0xb0, 0x4f, 0x9a, 0xbc,
+    0x52, 0x92, 0x4d, 0x55, 0xe7, 0x16, 0x06, 0xfd, 0x8e, 0xe8, 0x6d, 0xba, 0x10, 0xe7, 0x97, 0x73,
+    0xfc, 0x8c, 0x4e, 0xaa, 0x2d, 0xc7, 0x07, 0xdf, 0x60, 0x8d, 0xab, 0xae, 0xc7, 0x28, 0x41, 0x8c,
+    0xe2, 0x3e, 0x7c, 0x64, 0xcc, 0xdd, 0x1d, 0xd3, 0x70, 0x4d, 0xe2, 0xec, 0x3c, 0x77, 0x85, 0x2e,
+    0x74, 0x1e, 0xea, 0x17, 0x05, 0xeb, 0x74, 0x45, 0x52, 0x49, 0x56, 0x64, 0xdd, 0x91, 0x0c, 0x56,
+    0x44, 0x03, 0x09, 0xf1, 0x40, 0xbe, 0x80, 0x17, 0x31, 0x7e, 0x0b, 0x9c, 0xf4, 0x0d, 0x02, 0x12,
+    0x27, 0x01, 0x2b, 0xd4, 0x87, 0xaa, 0x84, 0x80, 0xcf, 0xe1, 0x46, 0xfb, 0x43, 0xb0, 0x2a, 0x22,
+    0x26, 0x66, 0x1a, 0x02, 0xda, 0x7a, 0x21, 0x0f, 0xf5, 0x58, 0xe4, 0x48, 0x96, 0x76, 0x74, 0x74,
+    0x86, 0x11, 0x3b, 0x65, 0x06, 0x36, 0xda, 0x6b, 0x6c, 0x92, 0x07, 0xbf, 0x0e, 0xdb, 0x8b, 0xac,
+    0x6d, 0xc0, 0x33, 0xb3, 0x75, 0xa4, 0x9c, 0x24, 0x8f, 0x5e, 0x62, 0x25, 0x16, 0x8d, 0xe3, 0x07,
+    0x9e, 0x49, 0x88, 0xc5, 0x86, 0x52, 0x54, 0x59, 0xc0, 0xb8, 0xf7, 0x5a, 0x23, 0xa5, 0xeb, 0xe7,
+    0x85, 0xa2, 0x80, 0xdd, 0x0e, 0xc0, 0x5a, 0xb3, 0x81, 0x5e, 0x54, 0x0b, 0x02, 0x73, 0x71, 0x9d,
+    0x50, 0x2d, 0x25, 0xe7, 0xaf, 0x1f, 0x9e, 0xb5, 0xea, 0x79, 0x65, 0x10, 0xad, 0x28, 0xa0, 0xee,
+    0x03, 0x5e, 0xd4, 0x4a, 0x16, 0x7e, 0xb2, 0xd5, 0x9b, 0x82, 0x06, 0xb6, 0x0b, 0x2b, 0x1f, 0xcc,
+    0x32, 0x3d, 0xd9, 0x6f, 0xf9, 0x1f, 0xcb, 0x20, 0x35, 0xe9, 0x60, 0x7a, 0x8e, 0x17, 0x9c, 0xdc,
+    0x1b, 0xc1, 0x6e, 0xbd, 0x6e, 0xd9, 0xd3, 0xbd, 0xd3, 0x95, 0xcd, 0x62, 0x5e, 0xe4, 0x91, 0xff,
+    0xf1, 0x94, 0x81, 0x40, 0x9d, 0x06, 0x86, 0x1b, 0x8e, 0xbd, 0x60, 0x7a, 0x32, 0xf3, 0x7d, 0x12,
+    0x98, 0x46, 0x48, 0x4e, 0x1d, 0x42, 0xd9, 0x47, 0x69, 0x42, 0xb6, 0x9d, 0x74, 0x6f, 0x41, 0xc0,
+    0x21, 0x1b, 0x7f, 0x1e, 0xb6, 0xb0, 0x6d, 0x45, 0xbb, 0x87, 0x07, 0x10, 0x56, 0xd7, 0x48, 0xb8,
+    0xe0, 0x55, 0x6d, 0xaf, 0xca, 0x4d, 0x64, 0x8a, 0x38, 0xcc, 0xf6, 0xb0, 0x20, 0x2e, 0xd9, 0xd1,
+    0x55, 0x0e, 0x6e, 0x16, 0x79, 0x01, 0x2c, 0x05, 0x83, 0x70, 0x68, 0x6a, 0x7c, 0x74, 0x88, 0x7b,
+    0x4b, 0x27, 0x1d, 0xee, 0xf0, 0x80, 0x43, 0xa1, 0x4f, 0x1c, 0xc7, 0x9c, 0x10, 0xe6, 0xab, 0x88,
+    0x49, 0x72, 0x08, 0x62, 0xc3, 0x33, 0xbd, 0xa9, 0xcf, 0x0e, 0xe6, 0x3a, 0x9c, 0x37, 0x1e, 0x73,
+    0x65, 0x97, 0x2d, 0xeb, 0xe0, 0x2a, 0x03, 0x46, 0x25, 0x8e, 0x5e, 0x17, 0xf8, 0xdf, 0xb3, 0xcb,
+    0xa2, 0x1b, 0x3a, 0x66, 0xcf, 0x18, 0xc2, 0x36, 0x76, 0x13, 0xbb, 0x71, 0x28, 0x20, 0x06, 0x79,
+    0xb9, 0x39, 0x47, 0xbd, 0x3b, 0xda, 0x3a, 0xea, 0x6b, 0x1c, 0xa5, 0xcb, 0x97, 0x2b, 0x37, 0x02,
+    0x55, 0x3d, 0xa5, 0x7b, 0x77, 0x8c, 0x25, 0x95, 0xb8, 0x2a, 0x92, 0xfc, 0xa3, 0xf8, 0x2a, 0x97,
+    0x54, 0x29, 0xfb, 0x46, 0x1a, 0xdb, 0x17, 0xf4, 0x60, 0x12, 0xa8, 0x87, 0xdf, 0x0f, 0x00, 0xf4,
+    0x61, 0x63, 0xde, 0x1f, 0x9c, 0x37, 0x90, 0x82, 0x55, 0x6d, 0xa0, 0xe9, 0x1a, 0xe2, 0x05, 0x55,
+    0xd6, 0x34, 0x00, 0xfd, 0x33, 0x59, 0xd6, 0xb5, 0xc6, 0x6b, 0xe2, 0x74, 0x68, 0xdc, 0xc7, 0x93,
+    0x8a, 0xee, 0x7a, 0x41, 0xb1, 0x17, 0x40, 0x4a, 0xd3, 0x21, 0x46, 0xb0, 0x10, 0x2a, 0x88, 0x98,
+    0x57, 0xd9, 0x69, 0xd9, 0x0b, 0xf1, 0xce, 0xa5, 0xfb, 0xf3, 0xaf, 0x82, 0xdd, 0x76, 0x68, 0x06,
+    0xb6, 0x4f, 0x51, 0x18, 0x98, 0xf1, 0x57, 0x1b, 0xff, 0x08, 0xa3, 0x0f, 0x6b, 0x46, 0xa5, 0xec,
+    0x2b, 0x8e, 0x8c, 0xb0, 0x45, 0x5f, 0x75, 0x8c, 0xbe, 0xa6, 0xf9, 0x7f, 0xff, 0x59, 0x36, 0x24,
+    0xbf, 0x39, 0x00, 0x00,
+};
+
+// HTML_STYLE: 17061 -> 3709 bytes
+#define WEB_ASSET_CSS_HASH "7df224323493a649"
+static const size_t WEB_ASSET_CSS_GZ_LEN = 3709;
+static const uint8_t WEB_ASSET_CSS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x1b, 0xdb, 0x6e, 0xe3, 0x36,
+    0xf6, 0x3d, 0x5f, 0x41, 0xa4, 0x28, 0x30, 0x9e, 0x5a, 0x1e, 0xc9, 0x8e, 0x1d, 0xdb, 0x41, 0x8b,
+    0xed, 0x24, 0x13, 0x6c, 0x81, 0xa6, 0xd3, 0x6d, 0xbb, 0xc0, 0x02, 0x8b, 0x7d, 0xa0, 0x25, 0xda,
+    0xe6, 0x5a, 0x96, 0xbc, 0xa2, 0x1c, 0x27, 0x15, 0xf2, 0xef, 0x7b, 0x0e, 0x2f, 0x12, 0x75, 0xb3,
+    0x9d, 0x19, 0xb5, 0x9d, 0x0c, 0x5a, 0xdb, 0x24, 0x45, 0x9e, 0xfb, 0x8d, 0x47, 0x17, 0xef, 0xde,
+    0x92, 0x6f, 0x3b, 0xf9, 0xbb, 0x20, 0x84, 0xfc, 0x7c, 0x3b, 0xb9, 0x1a, 0x7c, 0xf8, 0xd7, 0x07,
+    0xc2, 0xb6, 0x0b, 0x16, 0x04, 0x2c, 0x20, 0x4b, 0x1e, 0x32, 0x22, 0x58, 0xf2, 0xc8, 0x12, 0xf2,
+    0xcf, 0x1f, 0x70, 0xcd, 0x03, 0x0f, 0x22, 0xbe, 0x5a, 0xa7, 0xe4, 0x36, 0xde, 0x6e, 0x69, 0x14,
+    0xc0, 0x44, 0x48, 0x9f, 0xe3, 0x7d, 0x4a, 0xbe, 0x21, 0x1f, 0x42, 0xe6, 0xa7, 0x09, 0xf7, 0xc9,
+    0xfb, 0x70, 0xcf, 0xc8, 0x8e, 0x86, 0x2c, 0x4d, 0x19, 0x3e, 0xf4, 0x31, 0x0c, 0x84, 0xbf, 0x8e,
+    0xe3, 0x90, 0xa4, 0x2c, 0xd9, 0xf2, 0x88, 0x86, 0x84, 0x32, 0x91, 0xae, 0x59, 0x0a, 0x8b, 0x1d,
+    0x22, 0x76, 0x34, 0x49, 0x69, 0x44, 0x60, 0x3b, 0xc2, 0x96, 0x4b, 0xd8, 0x84, 0x3f, 0xca, 0xe7,
+    0xba, 0x41, 0x8d, 0xbc, 0x7d, 0x77, 0x71, 0x31, 0x4f, 0xe2, 0x38, 0xcd, 0x60, 0x53, 0xa0, 0x98,
+    0xe3, 0x38, 0xcd, 0xb0, 0xca, 0x19, 0x58, 0x4d, 0xe0, 0x4b, 0x90, 0x38, 0x8b, 0xd5, 0x9c, 0x7c,
+    0xe5, 0xde, 0x79, 0x9e, 0x77, 0x7d, 0x63, 0xc6, 0x96, 0x38, 0xf6, 0x61, 0xf2, 0xe1, 0xee, 0x7e,
+    0x94, 0x8f, 0xf9, 0xfb, 0x24, 0x61, 0x51, 0x0a, 0x13, 0xde, 0xc4, 0x7b, 0x3f, 0x1c, 0x16, 0x13,
+    0x40, 0x23, 0x35, 0x71, 0x7d, 0x37, 0x1d, 0xcf, 0xdc, 0x62, 0xe2, 0x99, 0x46, 0xb8, 0xb7, 0x7b,
+    0x0f, 0x7f, 0xf9, 0xe8, 0x2a, 0x61, 0x0c, 0x87, 0x47, 0xf7, 0xef, 0x67, 0xe3, 0x62, 0x71, 0x9c,
+    0xd0, 0x68, 0xc5, 0x60, 0xfc, 0xde, 0x9d, 0x4e, 0x47, 0x1f, 0xf2, 0xf1, 0x1d, 0x8f, 0x36, 0x72,
+    0x93, 0xf7, 0xf6, 0x26, 0xbb, 0x7d, 0xb2, 0x0b, 0x59, 0x7d, 0x3c, 0x61, 0x01, 0x6e, 0x31, 0x1d,
+    0x7b, 0x57, 0xb3, 0x7c, 0xf0, 0x99, 0x85, 0x61, 0x7c, 0x80, 0xf1, 0xbb, 0xe1, 0x6c, 0x86, 0x80,
+    0x17, 0x04, 0xfa, 0x95, 0x01, 0x7b, 0x91, 0x3f, 0x69, 0xbc, 0x61, 0x91, 0x20, 0x6f, 0x1e, 0x6e,
+    0x1d, 0x2e, 0xd6, 0x3d, 0x9b, 0x46, 0x48, 0xa0, 0x47, 0x9a, 0xbc, 0xd1, 0xd4, 0xea, 0xa9, 0x7d,
+    0x97, 0xf6, 0xe8, 0xd2, 0x8c, 0x06, 0x7c, 0x3b, 0x27, 0xc9, 0x6a, 0x41, 0xdf, 0x0c, 0x47, 0x6e,
+    0x7f, 0x38, 0xba, 0xee, 0x0f, 0xaf, 0x46, 0xfd, 0xc1, 0xc4, 0xed, 0x99, 0x53, 0xdf, 0xc7, 0x09,
+    0x88, 0x93, 0x98, 0x13, 0x41, 0xb7, 0x8c, 0x50, 0x41, 0xe0, 0x11, 0x10, 0x98, 0xa7, 0xb4, 0x4f,
+    0x7e, 0xfa, 0xf8, 0x1b, 0xa1, 0xbe, 0x0f, 0xb4, 0x24, 0x7e, 0x1c, 0xc6, 0x80, 0x4b, 0x0e, 0x82,
+    0x7c, 0xc8, 0x11, 0xf1, 0x32, 0x6d, 0xda, 0x7e, 0xe8, 0xea, 0xe3, 0xe1, 0x31, 0x47, 0xb0, 0x5d,
+    0xe3, 0x9a, 0xb1, 0x02, 0xc1, 0x71, 0x76, 0x34, 0x62, 0x61, 0x99, 0xed, 0x0a, 0xb4, 0x87, 0x5b,
+    0xb2, 0x66, 0x14, 0x85, 0x7d, 0x41, 0x13, 0x01, 0x22, 0xcb, 0x8c, 0xf8, 0x2c, 0x50, 0x7c, 0x34,
+    0x2c, 0x29, 0x4f, 0x43, 0xe6, 0x80, 0x78, 0x4b, 0x01, 0x2e, 0x53, 0x47, 0xcb, 0x88, 0x86, 0xa6,
+    0xb2, 0xb2, 0xa0, 0x58, 0x4e, 0x2e, 0xb5, 0xc2, 0xda, 0xe9, 0x2b, 0x77, 0x36, 0x99, 0xdd, 0x7d,
+    0xdf, 0x30, 0x2b, 0x45, 0xf2, 0xfe, 0x5e, 0x89, 0x92, 0x82, 0xf7, 0x76, 0x9f, 0x88, 0x18, 0x34,
+    0x93, 0x47, 0xac, 0x0d, 0xd8, 0x65, 0xec, 0xef, 0x85, 0xde, 0xd9, 0x92, 0x14, 0x35, 0xbc, 0x54,
+    0xc3, 0xf8, 0xa7, 0x49, 0xb3, 0xa5, 0xc9, 0xa6, 0xcc, 0x59, 0x29, 0xad, 0x1a, 0xda, 0x03, 0x4d,
+    0xa2, 0xf2, 0xac, 0x12, 0x5a, 0xc3, 0x7b, 0xfc, 0x9e, 0x94, 0x17, 0x00, 0x0f, 0x73, 0xce, 0xdf,
+    0xef, 0x23, 0x40, 0x25, 0x8e, 0xc8, 0x86, 0x3d, 0x93, 0x75, 0x9c, 0xe2, 0x87, 0x06, 0x13, 0xbe,
+    0xd6, 0xd1, 0xc7, 0xc1, 0x2a, 0xd6, 0x8e, 0x23, 0xd6, 0x34, 0x40, 0x61, 0x96, 0x1c, 0x76, 0xfb,
+    0xf8, 0x6f, 0x30, 0x76, 0x0d, 0x6f, 0x97, 0x09, 0x48, 0x95, 0xb3, 0xa2, 0x20, 0x02, 0x57, 0xbb,
+    0xa7, 0x1b, 0xcd, 0xef, 0xc0, 0x79, 0x9a, 0x93, 0xa9, 0xf9, 0xbd, 0x04, 0xe1, 0xf3, 0x46, 0xf8,
+    0xeb, 0xe5, 0xe2, 0xe2, 0x6d, 0x46, 0x16, 0xf1, 0x93, 0x23, 0xf8, 0xef, 0x3c, 0x5a, 0xcd, 0xb5,
+    0x9c, 0xc1, 0xc8, 0x0d, 0x01, 0x5a, 0xac, 0x78, 0x34, 0x77, 0x6f, 0xc0, 0x6e, 0x04, 0x01, 0xce,
+    0xc2, 0xd7, 0x97, 0x8b, 0x75, 0xba, 0x0d, 0xfb, 0xf0, 0x4c, 0xf0, 0x9c, 0x81, 0xb4, 0xa0, 0x91,
+    0x9c, 0x7b, 0xae, 0xfb, 0x35, 0x4e, 0xe1, 0xe0, 0x60, 0xeb, 0xa3, 0xfd, 0x59, 0x50, 0x7f, 0xb3,
+    0x4a, 0xe2, 0x7d, 0x14, 0x18, 0x62, 0x68, 0xc5, 0x91, 0x82, 0x5d, 0x91, 0x83, 0x65, 0x1c, 0xa5,
+    0xce, 0x92, 0x6e, 0x79, 0xf8, 0x3c, 0x27, 0x7b, 0xee, 0x6c, 0xe3, 0x28, 0x06, 0x6b, 0xe9, 0xb3,
+    0x3e, 0xf9, 0xf5, 0xfe, 0x01, 0x7e, 0x38, 0xbf, 0xb0, 0xd5, 0x3e, 0xa4, 0x49, 0x9f, 0x3c, 0xb0,
+    0x28, 0x8c, 0xe1, 0x23, 0x06, 0xa1, 0x82, 0xcf, 0xdb, 0x38, 0x12, 0x71, 0x48, 0x45, 0x9f, 0x5c,
+    0xfe, 0xc8, 0x17, 0x2c, 0xa1, 0x92, 0xbe, 0xf8, 0xc8, 0x25, 0x0c, 0xdd, 0xc6, 0xfb, 0x84, 0x83,
+    0x34, 0xff, 0xc4, 0x0e, 0xf0, 0x33, 0xdf, 0x35, 0x3f, 0x12, 0x90, 0x66, 0x39, 0x28, 0x42, 0x82,
+    0x82, 0xb2, 0xe4, 0x68, 0xb4, 0x88, 0x07, 0x4a, 0x83, 0x83, 0x01, 0x17, 0x3b, 0x30, 0xff, 0xf3,
+    0x65, 0xc8, 0x24, 0x09, 0xf1, 0x13, 0x34, 0x3d, 0x61, 0x92, 0x9d, 0x73, 0x40, 0x69, 0xbf, 0x8d,
+    0x70, 0x22, 0x06, 0x0f, 0xb2, 0x44, 0x53, 0xb3, 0xe6, 0xe0, 0x58, 0xa2, 0xfc, 0x20, 0x38, 0x82,
+    0x83, 0x99, 0x71, 0x42, 0xbe, 0xa2, 0xe9, 0x3e, 0x61, 0xc0, 0x80, 0x28, 0x8e, 0x98, 0x64, 0x80,
+    0x32, 0x44, 0x1d, 0xfc, 0xa1, 0x2b, 0xf9, 0x2d, 0xde, 0x29, 0xdd, 0x45, 0x3b, 0x16, 0xf2, 0x0d,
+    0xeb, 0xe1, 0x68, 0x37, 0xfb, 0xa3, 0xac, 0x0e, 0x94, 0x7d, 0x40, 0x0e, 0x1b, 0xa1, 0x20, 0xe3,
+    0xdd, 0x93, 0xa6, 0xa1, 0x14, 0xb4, 0x5e, 0x13, 0xc5, 0xfe, 0xbb, 0x17, 0x29, 0x5f, 0x3e, 0x83,
+    0x7d, 0x8a, 0x52, 0x74, 0x15, 0x92, 0x0f, 0xce, 0x82, 0xa5, 0x07, 0xa6, 0xc8, 0x44, 0x81, 0x34,
+    0x91, 0xc3, 0x53, 0xb6, 0x15, 0x73, 0x34, 0x80, 0x2c, 0xc9, 0x09, 0x2d, 0xd6, 0x09, 0xba, 0x00,
+    0xe9, 0x29, 0xea, 0x62, 0x55, 0xb1, 0x20, 0x75, 0x19, 0xab, 0x18, 0x11, 0xb9, 0x20, 0x17, 0xf3,
+    0x34, 0x8d, 0xc1, 0x5e, 0x7b, 0x80, 0x01, 0x88, 0x11, 0x0f, 0x8c, 0xa8, 0xca, 0xe9, 0x1e, 0xb2,
+    0x47, 0x23, 0x4c, 0xd6, 0x5e, 0x56, 0x96, 0x1a, 0x8f, 0x6d, 0x73, 0xf6, 0x1e, 0xb4, 0xbc, 0x44,
+    0x71, 0xb2, 0xa5, 0xa1, 0x14, 0x23, 0xf4, 0xb3, 0x60, 0xaf, 0x01, 0x4d, 0x49, 0xa3, 0xc1, 0x44,
+    0xa9, 0xdb, 0x40, 0x04, 0x60, 0x0f, 0x97, 0x71, 0x65, 0xb3, 0xc1, 0x4c, 0xed, 0x16, 0xe3, 0xfa,
+    0xf4, 0x19, 0x07, 0x24, 0xba, 0x87, 0x35, 0x50, 0x44, 0xee, 0xc2, 0x70, 0xf7, 0x43, 0x42, 0x77,
+    0x52, 0x66, 0x06, 0xe2, 0x80, 0x72, 0x2a, 0xc0, 0xdc, 0xed, 0x4a, 0xbc, 0xb8, 0x6a, 0xe0, 0x45,
+    0x9d, 0x66, 0xc6, 0x01, 0xbc, 0x8a, 0x16, 0x8d, 0x00, 0x57, 0x18, 0xf4, 0x62, 0x20, 0x43, 0x35,
+    0xca, 0x2a, 0x08, 0x18, 0xf8, 0x1b, 0xd5, 0x04, 0x1d, 0xa0, 0x93, 0x8f, 0x83, 0xbf, 0xe6, 0x3b,
+    0xc1, 0x45, 0x65, 0x47, 0x08, 0xbe, 0xec, 0xfd, 0x73, 0x72, 0x0d, 0xa6, 0x53, 0x34, 0x3f, 0xdd,
+    0xaa, 0xd2, 0x03, 0xe5, 0x11, 0x39, 0xc4, 0xc9, 0x46, 0x42, 0x4f, 0xa4, 0x61, 0xed, 0x58, 0x99,
+    0xb6, 0x70, 0x44, 0xa6, 0xa9, 0x38, 0xf7, 0x6c, 0xbd, 0x59, 0x25, 0x3c, 0xc0, 0xdf, 0xf8, 0xe9,
+    0x80, 0x52, 0xc0, 0x20, 0xd0, 0x31, 0x89, 0x0f, 0x60, 0x39, 0x20, 0xb2, 0xdc, 0xd2, 0x27, 0x30,
+    0xfd, 0xc4, 0x5b, 0x26, 0x3d, 0xeb, 0xe7, 0xe0, 0x7a, 0xb8, 0x54, 0x9c, 0x82, 0x31, 0x63, 0xc4,
+    0x5a, 0xd4, 0x46, 0x32, 0x5f, 0x91, 0xec, 0xe3, 0x3e, 0x45, 0x8f, 0x2f, 0xf9, 0x4c, 0xd0, 0x66,
+    0x60, 0x1c, 0x80, 0xe0, 0xa1, 0x98, 0x88, 0xac, 0x41, 0x9b, 0xab, 0xdb, 0xd7, 0xf8, 0x89, 0x6b,
+    0x94, 0xf7, 0x30, 0xd6, 0xd5, 0xb8, 0xa5, 0x5e, 0x7d, 0xc0, 0xad, 0x0d, 0x15, 0x62, 0x79, 0x54,
+    0x1e, 0x4f, 0x0a, 0xf6, 0x53, 0xee, 0x2c, 0x79, 0x24, 0x58, 0x0a, 0x27, 0xe1, 0x3f, 0xdc, 0xd1,
+    0x76, 0x9e, 0xde, 0x34, 0x27, 0xc5, 0x6f, 0x87, 0x98, 0x48, 0xac, 0xf1, 0x01, 0x1e, 0x30, 0x02,
+    0xc1, 0xbb, 0x25, 0x03, 0x9a, 0x46, 0x86, 0x36, 0xcd, 0xac, 0x3b, 0xe9, 0x24, 0x4e, 0x52, 0xef,
+    0x04, 0x66, 0x2f, 0xea, 0x74, 0x54, 0x06, 0x03, 0x85, 0xd6, 0xe1, 0x90, 0x61, 0x78, 0x78, 0xc4,
+    0x9a, 0x21, 0x8e, 0x3f, 0xe3, 0xb3, 0xd2, 0x28, 0xa2, 0xa7, 0xc8, 0x1d, 0x05, 0x39, 0xf0, 0x74,
+    0x2d, 0x69, 0x16, 0x24, 0x14, 0x74, 0x6c, 0x45, 0x02, 0xe6, 0xc7, 0xca, 0xa1, 0x8a, 0x5e, 0x8e,
+    0xb3, 0x53, 0x38, 0x80, 0x9a, 0x71, 0x2e, 0xdc, 0xe6, 0x95, 0xb2, 0x0e, 0x27, 0x18, 0x54, 0xa5,
+    0x58, 0x8b, 0x0f, 0x68, 0x30, 0x93, 0x55, 0x8a, 0x69, 0x92, 0x38, 0x12, 0x64, 0x49, 0x86, 0xac,
+    0xea, 0x06, 0x2c, 0xb9, 0xf9, 0x44, 0xa3, 0xe4, 0x83, 0x4d, 0x32, 0x8c, 0x05, 0x24, 0xf3, 0x05,
+    0x12, 0x6c, 0x88, 0xc7, 0x10, 0xf9, 0x9b, 0xc2, 0x18, 0x6b, 0x6e, 0x0c, 0xb5, 0xe1, 0xb7, 0xe0,
+    0x93, 0x2b, 0xff, 0x7c, 0x00, 0x11, 0x1e, 0x1b, 0xbe, 0x44, 0x71, 0xab, 0x04, 0xe0, 0x8e, 0xa6,
+    0xeb, 0x2a, 0x6f, 0x89, 0x7b, 0xd3, 0x85, 0x25, 0x47, 0x93, 0xf0, 0xe4, 0x1c, 0x78, 0x90, 0xae,
+    0xe7, 0x64, 0x02, 0x01, 0xa3, 0xed, 0xb7, 0x5c, 0x05, 0x46, 0x73, 0x78, 0x78, 0x8e, 0x36, 0x0c,
+    0x94, 0x83, 0x27, 0x55, 0x39, 0xe8, 0xb7, 0x4f, 0x37, 0xb3, 0x41, 0xa7, 0xad, 0xb9, 0xba, 0xdc,
+    0x4a, 0xbd, 0xd5, 0x79, 0x91, 0x20, 0x60, 0x82, 0x21, 0xd5, 0x00, 0x03, 0x29, 0xd2, 0xe7, 0x50,
+    0x2b, 0x0d, 0xe0, 0x0a, 0x19, 0x24, 0x64, 0xfb, 0x90, 0x79, 0x51, 0xd0, 0x98, 0x18, 0xd6, 0xa1,
+    0xbe, 0x60, 0x32, 0x56, 0xa8, 0xcb, 0x71, 0xd3, 0xae, 0xcc, 0x03, 0x58, 0xf7, 0x91, 0xbf, 0x46,
+    0xbb, 0x4e, 0xa6, 0xf8, 0x39, 0xf4, 0xd7, 0x72, 0x29, 0x86, 0xf3, 0x6e, 0x89, 0x60, 0x40, 0x2e,
+    0x13, 0xe0, 0x9f, 0xd0, 0xb2, 0x7a, 0xcc, 0x52, 0xc6, 0x97, 0x6f, 0x7b, 0x39, 0xdb, 0x52, 0x48,
+    0x67, 0xc4, 0x12, 0xa2, 0x18, 0x08, 0xc3, 0x77, 0x3b, 0x96, 0xf8, 0x54, 0xb0, 0xc6, 0x70, 0x66,
+    0xa4, 0x8f, 0x3e, 0x3f, 0x8e, 0x2a, 0x88, 0x41, 0xbe, 0x03, 0x5a, 0x3c, 0x66, 0xaf, 0x95, 0x9e,
+    0x66, 0x01, 0xb4, 0x24, 0xe8, 0xaa, 0x04, 0x93, 0x96, 0xee, 0x2a, 0x48, 0x3a, 0x41, 0x6e, 0x86,
+    0x69, 0x0e, 0x99, 0x44, 0xea, 0xf8, 0x6b, 0x1e, 0x06, 0x59, 0x6d, 0x27, 0x13, 0xb0, 0xdb, 0x4f,
+    0xc9, 0xef, 0x48, 0xdb, 0xac, 0xac, 0x6b, 0x35, 0x5b, 0xa0, 0xf7, 0xb8, 0xd2, 0xba, 0x56, 0xdd,
+    0x22, 0xe5, 0xdb, 0x57, 0x6e, 0x71, 0x31, 0xc0, 0xa2, 0x15, 0x58, 0x6e, 0x91, 0x96, 0xdd, 0x90,
+    0xa1, 0x9d, 0xf3, 0x3c, 0xa7, 0xfb, 0x34, 0x2e, 0x0d, 0x3d, 0x9d, 0xef, 0x62, 0x72, 0x4f, 0xb1,
+    0x8c, 0x63, 0x0c, 0x0f, 0xa4, 0xa0, 0xa3, 0x75, 0x00, 0xb7, 0x03, 0x92, 0xbc, 0x21, 0x7b, 0x41,
+    0x57, 0x4c, 0x7a, 0x0f, 0x4b, 0x13, 0x2c, 0xf7, 0x61, 0xb9, 0x0c, 0xb5, 0xc5, 0x5f, 0xe4, 0x32,
+    0xa6, 0xe3, 0x13, 0x3e, 0x43, 0x41, 0xf7, 0xc5, 0xbb, 0x8e, 0x12, 0x98, 0x5f, 0xb0, 0x07, 0x31,
+    0x70, 0x82, 0x8c, 0xb4, 0x27, 0x00, 0xf5, 0xb4, 0xa1, 0x6e, 0xa4, 0x6b, 0x7c, 0xe9, 0x9f, 0x5c,
+    0x75, 0x9e, 0x45, 0xff, 0x3b, 0x06, 0x76, 0xc2, 0x4f, 0xe2, 0x30, 0x54, 0xa9, 0x72, 0x5e, 0x07,
+    0x7e, 0xe4, 0x0b, 0xa6, 0xe4, 0x36, 0x57, 0x2e, 0x88, 0xaa, 0xff, 0xb7, 0x67, 0xfb, 0x42, 0xd3,
+    0xf2, 0x07, 0x8d, 0x2b, 0x53, 0x76, 0x01, 0xf2, 0x82, 0xad, 0xc8, 0x09, 0xa9, 0x74, 0xc2, 0xb2,
+    0x19, 0xf9, 0x7e, 0xf3, 0x39, 0x64, 0x8b, 0x8b, 0x0d, 0x07, 0xf9, 0x34, 0x1b, 0x01, 0x5e, 0xc5,
+    0x11, 0x0d, 0xf3, 0x59, 0x2e, 0xf5, 0x72, 0xbb, 0xce, 0x13, 0x9d, 0x7b, 0xac, 0x7e, 0x63, 0x6a,
+    0x51, 0xc4, 0x82, 0x20, 0x1c, 0x02, 0x12, 0x2b, 0xa5, 0xd4, 0x57, 0x44, 0x3b, 0x27, 0x50, 0xfd,
+    0x06, 0x57, 0xd7, 0x75, 0x85, 0x41, 0x92, 0x0a, 0x35, 0xfa, 0x33, 0x9d, 0x66, 0xb3, 0x69, 0x38,
+    0xee, 0x4a, 0x7d, 0x59, 0x50, 0x9c, 0xef, 0x62, 0x6e, 0xd6, 0xdb, 0xf6, 0x48, 0x7a, 0x47, 0x40,
+    0x1b, 0x36, 0x33, 0x71, 0xbc, 0x92, 0x01, 0xd7, 0xb2, 0xc8, 0xbb, 0x84, 0x2d, 0xf9, 0x53, 0xd6,
+    0x5e, 0x1a, 0xf8, 0x03, 0xfc, 0x98, 0x75, 0xf0, 0x00, 0x32, 0x8e, 0xa3, 0x1a, 0x50, 0x5a, 0xcc,
+    0x9e, 0x98, 0xdf, 0xb4, 0xda, 0x14, 0x3d, 0x2b, 0xcb, 0xf1, 0x7b, 0xd6, 0x1c, 0x40, 0x98, 0x95,
+    0x11, 0x55, 0x9e, 0xac, 0x03, 0xd7, 0x5e, 0xa2, 0x6f, 0x17, 0x14, 0x42, 0xd8, 0xce, 0xa4, 0x8f,
+    0x5c, 0x7a, 0x2e, 0x75, 0x4c, 0x00, 0xd0, 0x1e, 0x57, 0x55, 0x5c, 0x7a, 0x29, 0xa5, 0x19, 0x5b,
+    0x85, 0x24, 0x53, 0x27, 0x8c, 0xf6, 0x5b, 0x96, 0x70, 0x1f, 0x44, 0x8e, 0x2e, 0xb0, 0xee, 0x89,
+    0x03, 0xe2, 0x8f, 0x14, 0x1e, 0x13, 0x80, 0x7c, 0x1a, 0x0a, 0xdd, 0x63, 0xa0, 0x2d, 0x35, 0x4a,
+    0x0b, 0x49, 0x98, 0x00, 0x0b, 0x1d, 0x42, 0x52, 0x0e, 0x61, 0xf7, 0xa5, 0xbe, 0x61, 0x90, 0x85,
+    0xda, 0x4b, 0xb2, 0xd8, 0xa7, 0x44, 0xec, 0x17, 0x98, 0xcc, 0x96, 0x6c, 0xc7, 0x7c, 0x8d, 0x8f,
+    0x56, 0x0b, 0xd1, 0x32, 0xeb, 0x9f, 0x4c, 0xfb, 0xd7, 0x5e, 0x7f, 0x06, 0x89, 0xff, 0xa8, 0x48,
+    0xfc, 0x1f, 0x68, 0xb2, 0x61, 0xc1, 0x3b, 0x21, 0xef, 0x10, 0xc0, 0x13, 0x48, 0xb3, 0x51, 0xde,
+    0x72, 0x60, 0x26, 0x1b, 0x77, 0x9d, 0xba, 0xfd, 0xe1, 0xd8, 0xed, 0x7b, 0xc3, 0x51, 0x7f, 0xe0,
+    0x0d, 0x2d, 0xca, 0x96, 0x1e, 0x25, 0xb6, 0x3a, 0xf5, 0x8f, 0xac, 0x30, 0x6a, 0x54, 0xe2, 0x87,
+    0xbe, 0x9c, 0x28, 0x52, 0x93, 0xe2, 0xfa, 0x03, 0x2b, 0x1c, 0x80, 0xb0, 0x80, 0x88, 0xec, 0x2e,
+    0xa1, 0x3e, 0x50, 0x1c, 0x89, 0xb5, 0x17, 0x40, 0x34, 0x0a, 0x6e, 0xed, 0x11, 0x58, 0xbf, 0x06,
+    0xd6, 0x85, 0xc8, 0xbe, 0x5e, 0x05, 0x2f, 0x79, 0x17, 0x52, 0x47, 0x4b, 0xa7, 0x60, 0xfa, 0xfe,
+    0xa4, 0xa1, 0x76, 0xaf, 0xaf, 0x50, 0xaa, 0xb8, 0xea, 0xed, 0xda, 0x51, 0x2d, 0x2f, 0x40, 0x4c,
+    0x8f, 0x4c, 0xa3, 0x88, 0x1d, 0x99, 0x6e, 0x94, 0xdb, 0x12, 0x64, 0x16, 0xa1, 0xbe, 0xc1, 0xa2,
+    0xd4, 0x06, 0x2f, 0x08, 0xe5, 0x67, 0x02, 0x39, 0x1c, 0x0f, 0x43, 0x72, 0xa9, 0x46, 0x2f, 0x5b,
+    0xd8, 0x7d, 0x36, 0x7d, 0x5e, 0x8e, 0x3d, 0x4d, 0xaa, 0xde, 0xe1, 0x28, 0x67, 0xbb, 0x73, 0xee,
+    0x1f, 0x77, 0x42, 0x56, 0xb4, 0x42, 0xf0, 0xee, 0x2a, 0x4d, 0x23, 0x6b, 0x1a, 0x2e, 0x7b, 0x78,
+    0x1f, 0x8d, 0x31, 0x4a, 0x90, 0x57, 0xfc, 0xd4, 0xaa, 0x8e, 0x9d, 0x79, 0xbc, 0x13, 0xaf, 0x70,
+    0xe3, 0xe8, 0xc2, 0xe1, 0xbf, 0xb2, 0x9f, 0x6e, 0x2b, 0x24, 0x7e, 0x76, 0x91, 0x70, 0xd8, 0x3b,
+    0xab, 0x1a, 0xf7, 0x22, 0xb1, 0x50, 0x4f, 0x95, 0x6a, 0xed, 0x6d, 0xc5, 0xbb, 0x4f, 0x2c, 0x04,
+    0xda, 0xe7, 0x60, 0x6d, 0xaf, 0x74, 0xe8, 0xb9, 0x05, 0x3e, 0xf9, 0xd4, 0x22, 0x8c, 0xfd, 0x4d,
+    0xf6, 0x39, 0x25, 0x49, 0xfb, 0x5e, 0xcf, 0xec, 0x5a, 0xaf, 0x64, 0x1c, 0x4f, 0xc2, 0x5e, 0x9b,
+    0xda, 0x9d, 0x59, 0xe7, 0x43, 0x50, 0xbe, 0xe0, 0x5c, 0xad, 0x00, 0xef, 0xcb, 0xcc, 0xd1, 0x10,
+    0x3e, 0x75, 0x23, 0x86, 0x07, 0x36, 0x97, 0xfa, 0xce, 0xe3, 0xaf, 0xd4, 0xd0, 0xe9, 0x59, 0x25,
+    0xa8, 0x6a, 0x99, 0xcf, 0x86, 0x23, 0x7b, 0x75, 0xed, 0x69, 0xdc, 0x5e, 0x29, 0x6c, 0x22, 0xa9,
+    0x3e, 0x6c, 0xcb, 0x52, 0x9a, 0x75, 0x53, 0xc7, 0x6c, 0x0e, 0x7f, 0xcd, 0x21, 0x78, 0x37, 0xb5,
+    0xc9, 0xaa, 0xa9, 0x04, 0xa9, 0xae, 0xd0, 0x11, 0x4a, 0x4b, 0x20, 0xaa, 0x4e, 0x2f, 0x2a, 0xf0,
+    0x40, 0x13, 0x6c, 0x42, 0x42, 0x57, 0x9f, 0x6f, 0x45, 0xa5, 0x16, 0x37, 0x5e, 0xd0, 0x48, 0xde,
+    0x4c, 0x8a, 0x40, 0xea, 0x1f, 0x98, 0x5f, 0x42, 0x28, 0x90, 0x30, 0x72, 0x09, 0x01, 0x19, 0xc4,
+    0x52, 0x97, 0xe4, 0xdb, 0xef, 0x08, 0xb8, 0x22, 0x70, 0x00, 0x45, 0x76, 0x67, 0xd5, 0x2f, 0x81,
+    0x11, 0x04, 0x98, 0x80, 0x5d, 0x4a, 0x8a, 0xff, 0xd8, 0xe1, 0x23, 0x4d, 0xba, 0xca, 0x55, 0xd1,
+    0x1a, 0xe4, 0xb9, 0x31, 0x24, 0x8f, 0x8d, 0x56, 0x5e, 0xd9, 0x70, 0x6c, 0x7d, 0xb0, 0x76, 0xa6,
+    0xb8, 0xa3, 0xc0, 0x49, 0xa1, 0xba, 0x1f, 0x4a, 0x89, 0x98, 0x16, 0xa8, 0x06, 0x63, 0x70, 0xa4,
+    0xd4, 0x73, 0x32, 0xe8, 0xac, 0xa4, 0x6a, 0x16, 0x0e, 0xd9, 0x19, 0x2e, 0xe2, 0xfc, 0x1b, 0xd2,
+    0xd7, 0x09, 0xf2, 0x55, 0x9b, 0x20, 0x97, 0x20, 0x1c, 0x1c, 0x76, 0xd4, 0xa6, 0x34, 0xfe, 0xce,
+    0x5a, 0x7d, 0x28, 0xfa, 0x6f, 0x73, 0x25, 0xe8, 0x41, 0x3a, 0xdc, 0x07, 0xfb, 0x3b, 0x1e, 0x2f,
+    0x93, 0x5e, 0x69, 0xc2, 0x55, 0x13, 0xae, 0x7b, 0x72, 0x02, 0x47, 0x6a, 0x00, 0xf1, 0x55, 0xc8,
+    0xca, 0x20, 0xe1, 0xc8, 0x79, 0x40, 0x0d, 0xf5, 0x11, 0x93, 0xfc, 0x88, 0x6b, 0x7f, 0x5d, 0x3a,
+    0xca, 0x3e, 0x4b, 0xd5, 0x65, 0xed, 0xb3, 0x3a, 0xad, 0x1e, 0xb7, 0xcb, 0x85, 0x2e, 0x08, 0x47,
+    0x71, 0xfa, 0x66, 0xbe, 0xe4, 0x89, 0x29, 0x0b, 0xf7, 0xf2, 0x62, 0x4d, 0x0e, 0x4a, 0x7d, 0x4d,
+    0x56, 0xf3, 0x0e, 0x5e, 0x89, 0x88, 0xf5, 0xa2, 0x6d, 0x5b, 0x10, 0x62, 0x15, 0x71, 0x4f, 0xd5,
+    0x6b, 0xf5, 0xde, 0x60, 0x8e, 0x2a, 0xf7, 0xe2, 0x75, 0x6b, 0x45, 0x5e, 0x6c, 0x24, 0xec, 0x07,
+    0x1b, 0xd7, 0x16, 0xb7, 0x20, 0x40, 0x3f, 0xe6, 0xf3, 0x25, 0xf7, 0x5b, 0x4d, 0x82, 0x92, 0x04,
+    0x43, 0x98, 0x74, 0xad, 0x28, 0xf2, 0x66, 0x58, 0xa2, 0x5b, 0xeb, 0xa2, 0x33, 0x4b, 0xe0, 0x5e,
+    0x4d, 0x24, 0x0d, 0x12, 0x22, 0xa5, 0xe9, 0x5e, 0x64, 0xf6, 0x26, 0xda, 0x54, 0x34, 0xe2, 0xac,
+    0x97, 0x97, 0x4f, 0x35, 0x0e, 0xb4, 0x54, 0xbe, 0x99, 0xb8, 0x6e, 0xa3, 0x0a, 0x1b, 0x77, 0x56,
+    0xc5, 0xad, 0x1d, 0x1e, 0xb9, 0x3d, 0x91, 0x3d, 0x1c, 0x72, 0xd2, 0x89, 0x37, 0x59, 0x5b, 0x85,
+    0x01, 0x81, 0xd6, 0xab, 0x0e, 0x94, 0xa7, 0xf5, 0x75, 0xaa, 0xb1, 0xb1, 0xb4, 0x10, 0x62, 0x3f,
+    0x1a, 0xb6, 0xba, 0x95, 0x62, 0x9d, 0x0f, 0x69, 0x22, 0x64, 0x3d, 0xf5, 0x95, 0xa6, 0xa5, 0xad,
+    0xf3, 0x3a, 0xe3, 0xfb, 0x3d, 0xd8, 0xcf, 0x08, 0xdb, 0x0a, 0x37, 0x8c, 0xed, 0xc8, 0x82, 0xad,
+    0xe9, 0x23, 0x8f, 0x93, 0x3e, 0x24, 0xf8, 0x91, 0xd5, 0x7a, 0xa0, 0x2a, 0x90, 0x4b, 0x30, 0x20,
+    0x98, 0xdd, 0xe3, 0x13, 0x1d, 0xe7, 0x24, 0x8b, 0x34, 0xca, 0x8e, 0x57, 0xf6, 0x1a, 0x2f, 0x21,
+    0x8f, 0xa6, 0x1a, 0xb2, 0x33, 0xb3, 0x1c, 0xeb, 0x8c, 0x60, 0xa1, 0xe7, 0xb6, 0xd5, 0x15, 0x4b,
+    0x2d, 0x6f, 0x3c, 0x5a, 0x83, 0xdf, 0x6a, 0xab, 0xab, 0x34, 0x5f, 0xbe, 0xbd, 0x48, 0x44, 0x4c,
+    0x14, 0x71, 0xa4, 0xca, 0x71, 0xe5, 0x02, 0x2f, 0x35, 0x94, 0x8d, 0xa1, 0x28, 0xd1, 0x5b, 0x81,
+    0xfb, 0xc6, 0xd0, 0x20, 0xb0, 0xec, 0xc7, 0x68, 0x7c, 0x63, 0x60, 0x07, 0x2b, 0x07, 0x12, 0x0c,
+    0xd2, 0xc6, 0x02, 0xf3, 0x84, 0x13, 0xef, 0x53, 0xd3, 0xe8, 0xd3, 0x29, 0x35, 0x7b, 0x06, 0x3d,
+    0x73, 0xc2, 0x19, 0x68, 0x8e, 0x87, 0x7f, 0x80, 0xc8, 0x96, 0x3a, 0x36, 0xb1, 0x5b, 0x02, 0x62,
+    0x24, 0xa9, 0x3e, 0xb2, 0xe8, 0xd2, 0x75, 0xe1, 0x5b, 0x36, 0x81, 0xd2, 0xc6, 0x14, 0xeb, 0xbc,
+    0x1e, 0xae, 0x34, 0xde, 0x1d, 0x6f, 0xe0, 0xaa, 0x5d, 0xbb, 0xe0, 0x99, 0x65, 0x57, 0x54, 0x6a,
+    0x25, 0x9b, 0x28, 0xf1, 0xad, 0x9b, 0xd3, 0x66, 0x49, 0x3d, 0x5e, 0x75, 0xac, 0x6a, 0x4a, 0x5d,
+    0x29, 0xf6, 0x02, 0xe7, 0x65, 0xe5, 0x64, 0x6e, 0xae, 0x55, 0xba, 0xe8, 0x20, 0x43, 0x2c, 0xed,
+    0xbb, 0xdd, 0x32, 0xa0, 0xe6, 0x56, 0x45, 0x2d, 0x3b, 0x53, 0xa1, 0xf4, 0x72, 0x6c, 0xea, 0x8f,
+    0x6c, 0x86, 0xf1, 0x48, 0x76, 0x90, 0xca, 0x14, 0xbc, 0xb9, 0x34, 0xab, 0xea, 0x19, 0x86, 0x48,
+    0x93, 0xb6, 0x04, 0x4a, 0x75, 0x04, 0xd7, 0xcb, 0x6e, 0xaa, 0x29, 0xd8, 0xe6, 0x7a, 0x42, 0x03,
+    0xbe, 0x17, 0x32, 0x77, 0x2b, 0xdc, 0xca, 0xc9, 0xae, 0xc0, 0xa6, 0x1a, 0xf4, 0xa9, 0x40, 0xb8,
+    0x5d, 0x93, 0x4f, 0x8a, 0x9e, 0x15, 0xe1, 0x90, 0xa1, 0xee, 0xf5, 0xa8, 0xdd, 0x06, 0x77, 0xc0,
+    0x6b, 0x79, 0x6f, 0x9d, 0xc4, 0xe0, 0x40, 0x85, 0x40, 0x8d, 0x9d, 0x2b, 0x67, 0x93, 0xf2, 0xe8,
+    0xb9, 0x9f, 0x3b, 0x17, 0x79, 0x33, 0xad, 0x17, 0x19, 0x8d, 0x33, 0xc0, 0x35, 0x34, 0x55, 0x54,
+    0x2d, 0xcd, 0xb8, 0x74, 0x15, 0x9d, 0xdf, 0xf1, 0xd9, 0x3b, 0xea, 0x4b, 0xca, 0xe2, 0xea, 0x4e,
+    0x09, 0x04, 0xb1, 0x97, 0x2d, 0x79, 0x18, 0x66, 0xd5, 0x62, 0x4b, 0x13, 0x13, 0x4a, 0x5d, 0xe8,
+    0x3a, 0x5c, 0x95, 0x4b, 0xa5, 0xa1, 0xe5, 0x2a, 0x3f, 0x94, 0xe3, 0x64, 0xe0, 0x29, 0xd3, 0x44,
+    0x93, 0xee, 0x4b, 0x89, 0x77, 0x9c, 0x86, 0xf1, 0x4a, 0x90, 0x77, 0xe4, 0x21, 0x0e, 0x68, 0x28,
+    0xaf, 0x0b, 0x01, 0x3f, 0x1c, 0x54, 0x37, 0xa7, 0x5d, 0x77, 0x47, 0xe2, 0x29, 0x59, 0x8d, 0xd2,
+    0x20, 0xd7, 0xb1, 0x46, 0x5a, 0xe6, 0xaf, 0x38, 0x22, 0xdb, 0xfb, 0xea, 0xad, 0x8e, 0x76, 0x97,
+    0xdf, 0x54, 0x71, 0xad, 0xda, 0x88, 0x5c, 0xd8, 0xb3, 0xe6, 0xfc, 0xf2, 0x77, 0x87, 0x43, 0x70,
+    0xf2, 0x84, 0xdc, 0x91, 0x4c, 0x96, 0x40, 0x99, 0xa7, 0xb3, 0x73, 0x2d, 0xf3, 0xf1, 0x0a, 0xa5,
+    0xd5, 0xa7, 0xe8, 0x12, 0x0f, 0x95, 0xf5, 0xca, 0xcd, 0x35, 0x56, 0xcd, 0x94, 0x43, 0x0b, 0x2f,
+    0x37, 0x25, 0x79, 0x43, 0xd5, 0xd5, 0x44, 0x87, 0x1a, 0xfa, 0xf7, 0x6c, 0xf8, 0x75, 0x1d, 0x5e,
+    0xb2, 0x1e, 0x65, 0x56, 0x45, 0xd5, 0x91, 0x67, 0xa9, 0xff, 0x7b, 0x43, 0xf3, 0xb5, 0x74, 0xd2,
+    0xc4, 0x0a, 0x62, 0x5a, 0xee, 0x33, 0xff, 0xe4, 0x96, 0xec, 0x23, 0xbd, 0xd5, 0x0a, 0x57, 0xf9,
+    0x66, 0x42, 0x8b, 0x81, 0xab, 0x74, 0xf7, 0x8f, 0x2b, 0x3d, 0xd7, 0x63, 0x6b, 0x9b, 0x54, 0x75,
+    0x56, 0x6b, 0x6b, 0x2d, 0xcd, 0xdb, 0xb4, 0x21, 0x5f, 0x37, 0x77, 0x64, 0x35, 0x6f, 0x98, 0x6f,
+    0x74, 0xaa, 0x4c, 0x63, 0xc8, 0x6b, 0x9f, 0xe4, 0x0d, 0x8b, 0xda, 0xcd, 0x8f, 0xa0, 0x5e, 0xbe,
+    0x7c, 0xcd, 0x41, 0x19, 0x2e, 0x50, 0x37, 0x47, 0xff, 0xfe, 0xab, 0xe4, 0xcf, 0xad, 0x76, 0xf3,
+    0x0d, 0x9b, 0x85, 0xcf, 0x02, 0xb5, 0x22, 0x7a, 0xee, 0x17, 0x2e, 0x65, 0x15, 0xe0, 0x77, 0x09,
+    0xcb, 0xce, 0x0d, 0xda, 0x9b, 0x45, 0x6d, 0x34, 0xbe, 0x69, 0x45, 0xdf, 0xa0, 0x6e, 0xe3, 0xf8,
+    0x95, 0x37, 0xf3, 0xbe, 0x57, 0xef, 0xd8, 0x35, 0x79, 0x5d, 0xdb, 0x9d, 0x5e, 0xab, 0x03, 0x4b,
+    0xef, 0x0a, 0x00, 0xc0, 0x4e, 0xfe, 0xb6, 0x40, 0xa7, 0x5e, 0xe0, 0x83, 0x69, 0x96, 0x61, 0x01,
+    0x4f, 0xe3, 0x84, 0xbc, 0xd9, 0xfa, 0xf8, 0x4d, 0xbe, 0x34, 0xd7, 0xb1, 0x03, 0x50, 0x27, 0xfc,
+    0xd5, 0xc6, 0xb6, 0x2a, 0xec, 0xd3, 0xaa, 0xb0, 0x5f, 0x7d, 0x6d, 0x5f, 0x77, 0x4c, 0x87, 0x8f,
+    0xeb, 0x57, 0xdd, 0x02, 0x99, 0x9b, 0xae, 0x97, 0x1c, 0xe1, 0xe2, 0xa6, 0xa5, 0x23, 0xa9, 0x6f,
+    0x57, 0xb4, 0x8a, 0xd0, 0x76, 0xf4, 0xda, 0xce, 0x2b, 0xb4, 0x4c, 0xa3, 0x9c, 0x5f, 0x05, 0xbc,
+    0xf6, 0x7d, 0x1a, 0xfd, 0xbc, 0xac, 0xee, 0x17, 0x79, 0xeb, 0x4c, 0x46, 0x5a, 0x7a, 0x2e, 0x77,
+    0x08, 0xad, 0xad, 0xfa, 0x8d, 0x8a, 0x67, 0x01, 0x07, 0xd1, 0x26, 0x64, 0xb3, 0xea, 0xfa, 0x40,
+    0x32, 0xdd, 0xc4, 0x6a, 0x95, 0xd0, 0x0d, 0xc2, 0x3a, 0xa4, 0xa7, 0x89, 0x53, 0x3e, 0x2d, 0x27,
+    0x36, 0x4f, 0x7f, 0xb6, 0xb1, 0xa9, 0xd8, 0x97, 0x3a, 0x3e, 0x73, 0x79, 0x37, 0x0d, 0x64, 0xd3,
+    0x49, 0x76, 0x9e, 0x08, 0xe9, 0x75, 0x45, 0xdf, 0xe6, 0x99, 0x15, 0xf2, 0x53, 0x49, 0xc0, 0x69,
+    0x39, 0xec, 0x50, 0x0c, 0x0b, 0x3c, 0x20, 0x65, 0x12, 0x9f, 0x9c, 0xa8, 0x59, 0xbd, 0xe9, 0x9d,
+    0x25, 0x69, 0x06, 0x30, 0x53, 0x1e, 0xac, 0x49, 0x43, 0x39, 0x28, 0xd1, 0x65, 0x8d, 0x1f, 0xa2,
+    0xdd, 0x3e, 0x95, 0x77, 0x26, 0x1c, 0xbf, 0xfd, 0x3b, 0x7d, 0xde, 0xb1, 0x6f, 0x2f, 0x91, 0x99,
+    0x97, 0xff, 0xc9, 0x5e, 0xe7, 0x3e, 0xce, 0x30, 0x94, 0x39, 0x3d, 0xec, 0x1b, 0x99, 0x06, 0x71,
+    0xd4, 0x56, 0xd0, 0x5c, 0x15, 0xd7, 0x41, 0xd3, 0x52, 0x86, 0x91, 0x96, 0x2d, 0x67, 0x05, 0x69,
+    0x5a, 0x5a, 0xb1, 0xaa, 0xb6, 0xda, 0x55, 0x8c, 0x50, 0x41, 0xbd, 0x37, 0x9a, 0xf5, 0x87, 0xa3,
+    0x51, 0x7f, 0x38, 0x1e, 0x95, 0x5e, 0xe0, 0xf9, 0x85, 0x89, 0x1d, 0xf8, 0x6c, 0xb0, 0x7d, 0x26,
+    0xf1, 0x5b, 0x33, 0xf5, 0xa2, 0x35, 0xb8, 0x73, 0xee, 0xf7, 0x91, 0x1a, 0x21, 0xdd, 0x09, 0xa6,
+    0xaa, 0x8d, 0x0b, 0xb6, 0x8c, 0x13, 0x19, 0x56, 0xfd, 0x6d, 0x0b, 0x3c, 0xa1, 0xe0, 0xcd, 0xec,
+    0x77, 0x14, 0x40, 0x42, 0x65, 0x4d, 0x5a, 0xbd, 0xa8, 0xd5, 0xf8, 0x32, 0x96, 0x69, 0x59, 0x00,
+    0x1e, 0x11, 0xa2, 0xdf, 0x98, 0x6a, 0xb1, 0xf5, 0xed, 0x9d, 0x0c, 0xc5, 0xc3, 0xf9, 0x4b, 0x3d,
+    0xa5, 0x1b, 0x7f, 0xa5, 0x98, 0xe7, 0x28, 0x99, 0xda, 0x09, 0xbb, 0x2e, 0x8e, 0xf4, 0x58, 0x14,
+    0xab, 0x9a, 0xba, 0x0d, 0x3e, 0xeb, 0xe4, 0xa2, 0x1f, 0xae, 0xd6, 0xb4, 0x4a, 0xc8, 0x19, 0x97,
+    0x5a, 0xad, 0xad, 0x21, 0x95, 0x2b, 0xad, 0x6b, 0xeb, 0xcd, 0xb7, 0x99, 0x1c, 0x6a, 0x1c, 0x98,
+    0xa9, 0x56, 0xd0, 0xda, 0xe1, 0xed, 0x17, 0x58, 0x67, 0x02, 0x80, 0x9b, 0x4f, 0xfc, 0x75, 0x71,
+    0xc0, 0xcb, 0xc5, 0xff, 0x01, 0x4a, 0xc8, 0x59, 0x32, 0xa5, 0x42, 0x00, 0x00,
+};
+
+// HTML_SCRIPT: 59446 -> 13400 bytes
+#define WEB_ASSET_JS_HASH "d417aed1d72d5e32"
+static const size_t WEB_ASSET_JS_GZ_LEN = 13400;
+static const uint8_t WEB_ASSET_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0x5d, 0x73, 0xdb, 0x48,
+    0xae, 0xe8, 0x7b, 0x7e, 0x05, 0x33, 0xa7, 0x36, 0xa4, 0x26, 0xb2, 0xec, 0x24, 0x33, 0x7b, 0x67,
+    0xe5, 0x38, 0x2e, 0x59, 0x92, 0x63, 0x6d, 0x64, 0xc9, 0x2b, 0xc9, 0x93, 0xc9, 0xcd, 0xf8, 0xa4,
+    0x68, 0x89, 0xb6, 0x39, 0x96, 0x44, 0x2d, 0x49, 0xc5, 0xf6, 0x66, 0xfd, 0x7a, 0xde, 0x4f, 0xdd,
+    0x7f, 0x78, 0x7e, 0xc9, 0x05, 0xd0, 0x1f, 0xec, 0x6e, 0x36, 0x29, 0xc9, 0x71, 0x66, 0xe7, 0x54,
+    0xed, 0x56, 0xed, 0xc4, 0x6a, 0xf6, 0x27, 0x1a, 0x40, 0x03, 0x68, 0x00, 0xfd, 0xe4, 0xc9, 0xf6,
+    0xb6, 0x73, 0xe2, 0xcf, 0x03, 0x27, 0x49, 0xfd, 0x34, 0x78, 0x32, 0x8e, 0xe6, 0x49, 0xea, 0xb4,
+    0xda, 0x87, 0x8d, 0xd3, 0xee, 0xe8, 0x53, 0xb7, 0x7d, 0x38, 0x72, 0xf6, 0x1c, 0x77, 0x7b, 0xf6,
+    0xe3, 0x22, 0x8a, 0xaf, 0xc7, 0x57, 0xd1, 0x62, 0xfb, 0xca, 0x9f, 0x4f, 0x92, 0x2b, 0xff, 0x3a,
+    0x48, 0xdc, 0x5d, 0xa3, 0xfa, 0xa0, 0xf3, 0xf6, 0x28, 0x57, 0xff, 0xc6, 0x8f, 0x27, 0x71, 0xf8,
+    0x39, 0x9c, 0x5f, 0xca, 0xfa, 0x47, 0x8d, 0x5e, 0x6b, 0x78, 0xd4, 0x78, 0xd7, 0x1e, 0x7e, 0x6a,
+    0x75, 0x06, 0x6b, 0x0c, 0xf0, 0xbe, 0xf3, 0xb6, 0xdb, 0xb6, 0xd5, 0xb5, 0x74, 0xbe, 0x80, 0xc5,
+    0x24, 0x50, 0xef, 0xcb, 0x13, 0x07, 0xfe, 0xd7, 0xad, 0x3b, 0x5f, 0xa0, 0x28, 0xbd, 0xaa, 0x43,
+    0x43, 0xb7, 0xea, 0x84, 0x69, 0x30, 0x4b, 0xea, 0xce, 0xc7, 0xb3, 0xaa, 0x93, 0x04, 0xd3, 0x60,
+    0x9c, 0x06, 0x93, 0xba, 0x33, 0x0f, 0x6e, 0x9c, 0x61, 0x90, 0x7a, 0x95, 0xaa, 0x73, 0x11, 0x8d,
+    0x97, 0x49, 0x67, 0x72, 0x5b, 0x77, 0x76, 0xaa, 0xce, 0x34, 0xf2, 0x27, 0xd0, 0x75, 0xdd, 0xb9,
+    0xf0, 0xa7, 0x49, 0xe0, 0xdc, 0x57, 0xa9, 0xcb, 0xc1, 0x63, 0x76, 0xf9, 0xe4, 0x7e, 0xf7, 0xc9,
+    0x34, 0x48, 0x1d, 0x7f, 0x9c, 0x86, 0x9f, 0x03, 0xda, 0x08, 0x58, 0x62, 0xd7, 0x65, 0xa5, 0xc9,
+    0xa4, 0x33, 0xbf, 0x88, 0xba, 0xac, 0x0d, 0x7c, 0xa0, 0x46, 0xec, 0x53, 0x1c, 0x5c, 0xc4, 0x41,
+    0x72, 0xd5, 0x99, 0x9f, 0xc4, 0xd1, 0x25, 0xfc, 0x95, 0x58, 0x3f, 0x9f, 0x04, 0xf3, 0x7c, 0xd3,
+    0xa9, 0x9f, 0xa4, 0x03, 0xf6, 0xbd, 0x91, 0xc2, 0xa7, 0x1d, 0x56, 0x7c, 0x11, 0xa4, 0xe3, 0xab,
+    0x20, 0xe9, 0xcc, 0x0f, 0xa7, 0xe1, 0xe5, 0x15, 0xff, 0xc0, 0x60, 0x4a, 0x9f, 0xde, 0xfb, 0xb0,
+    0xd2, 0x18, 0xc7, 0xf9, 0x78, 0x26, 0x3e, 0x1c, 0xb6, 0x47, 0xcd, 0xa3, 0x4f, 0x27, 0x8d, 0x41,
+    0xa3, 0xdb, 0x6d, 0x77, 0xe1, 0xd3, 0x2b, 0xf1, 0xe5, 0xe0, 0x74, 0xf8, 0xe1, 0xd3, 0xa0, 0x3d,
+    0x1a, 0x74, 0xda, 0x43, 0x28, 0xff, 0x41, 0x94, 0x77, 0x3b, 0xc3, 0x11, 0x34, 0x78, 0xdb, 0x86,
+    0xc2, 0x97, 0x3b, 0x3b, 0x5a, 0xf1, 0x71, 0xe3, 0x97, 0x4f, 0x9d, 0x51, 0xfb, 0x18, 0x1b, 0xfc,
+    0xb8, 0xb3, 0xc3, 0xe7, 0x15, 0x2d, 0x92, 0x83, 0x65, 0x72, 0xa7, 0xaf, 0xe1, 0xef, 0xcb, 0x60,
+    0x19, 0xe4, 0x00, 0xc3, 0xfa, 0x1a, 0xc7, 0xc1, 0x24, 0xc3, 0x80, 0x9b, 0x85, 0xff, 0x2e, 0xb8,
+    0x83, 0xbd, 0x72, 0xd9, 0xf6, 0xdd, 0x84, 0x97, 0xd3, 0xe0, 0x34, 0x09, 0x62, 0xa3, 0x68, 0x14,
+    0x5d, 0x07, 0x73, 0x2c, 0x13, 0x5b, 0x02, 0x0d, 0xff, 0x86, 0xa3, 0xf0, 0x05, 0x53, 0x11, 0x56,
+    0xcc, 0x15, 0x2e, 0xfc, 0x41, 0x90, 0x2c, 0xa7, 0x69, 0x72, 0x04, 0x98, 0x3b, 0xc5, 0x4f, 0xf3,
+    0xe5, 0x74, 0xca, 0x77, 0xf0, 0x26, 0x9c, 0x07, 0xa3, 0x70, 0x16, 0xc4, 0x5a, 0x31, 0xb4, 0x69,
+    0x2c, 0xd3, 0xab, 0xb7, 0x40, 0x72, 0xc3, 0xab, 0xe8, 0x66, 0xae, 0x2f, 0x8e, 0x7f, 0x1d, 0x22,
+    0x45, 0x22, 0x3a, 0x0c, 0xda, 0x7f, 0x3b, 0xed, 0x0c, 0xda, 0x2d, 0x57, 0xfb, 0x7c, 0x1c, 0x4d,
+    0xfc, 0x29, 0xec, 0xfe, 0x2c, 0x4c, 0x02, 0x5b, 0xe7, 0xf4, 0x1d, 0x66, 0x16, 0x4d, 0x3f, 0x67,
+    0xdf, 0x19, 0x84, 0xda, 0xad, 0x0e, 0x83, 0xf6, 0xc1, 0x87, 0x11, 0x6d, 0xcf, 0xcb, 0x9d, 0x1f,
+    0x7e, 0x62, 0x8d, 0x83, 0x49, 0x98, 0x9e, 0x00, 0x72, 0xe3, 0xb8, 0x6e, 0x56, 0xd4, 0x0a, 0xe3,
+    0xd4, 0xd8, 0x02, 0x2c, 0x2e, 0xd8, 0x81, 0x6e, 0xff, 0x2d, 0x76, 0x8f, 0xdb, 0xc8, 0x51, 0x2e,
+    0xba, 0x3c, 0x58, 0x5e, 0x5c, 0x10, 0x14, 0x10, 0x6e, 0xc8, 0x75, 0x46, 0x57, 0x81, 0x33, 0x09,
+    0x3e, 0x87, 0x63, 0xe4, 0x3d, 0x71, 0xe0, 0xcf, 0x12, 0xc7, 0x07, 0x4c, 0xbb, 0x01, 0xdc, 0x4d,
+    0x16, 0xd0, 0x0d, 0x50, 0xb1, 0x0f, 0xbb, 0x3f, 0x87, 0xef, 0xde, 0x04, 0x60, 0x84, 0xa4, 0x93,
+    0x00, 0x05, 0x85, 0x49, 0x0a, 0x43, 0x26, 0x95, 0x5d, 0xe7, 0x3a, 0x08, 0x16, 0xd8, 0x53, 0x7a,
+    0x05, 0x15, 0x67, 0xfe, 0xfc, 0x0e, 0x9a, 0x02, 0x62, 0x24, 0x69, 0xe2, 0x84, 0x73, 0xe7, 0x82,
+    0xa1, 0x31, 0xec, 0x09, 0x14, 0xa7, 0xf1, 0x9d, 0x73, 0x73, 0x15, 0xcc, 0x81, 0x5a, 0xa1, 0x24,
+    0xb9, 0x41, 0x44, 0xfe, 0x71, 0xe7, 0x15, 0xa1, 0xe9, 0x13, 0x3f, 0xb9, 0x9b, 0x8f, 0x9d, 0x8b,
+    0xe5, 0x1c, 0x88, 0x30, 0x9a, 0x33, 0xdc, 0x9a, 0x1c, 0x22, 0xce, 0x7b, 0xcb, 0x78, 0x5a, 0x05,
+    0x0c, 0xc4, 0xf2, 0xa4, 0x22, 0x30, 0xea, 0x2a, 0x84, 0x5d, 0xf6, 0x4c, 0x7a, 0x79, 0xb3, 0x67,
+    0x90, 0x83, 0xa8, 0x8f, 0xff, 0xf3, 0x6f, 0x80, 0x7a, 0x88, 0x2b, 0xf0, 0x1d, 0xf3, 0x62, 0xb1,
+    0x33, 0x6f, 0x34, 0xf2, 0xaa, 0x2d, 0x96, 0xc9, 0x95, 0xf8, 0x58, 0xa9, 0xec, 0x52, 0x0f, 0xf7,
+    0xf4, 0x5f, 0x63, 0xc0, 0xe7, 0xcf, 0xd9, 0x47, 0x5c, 0x5a, 0x36, 0xd0, 0x45, 0x14, 0x3b, 0x1e,
+    0x71, 0x94, 0x14, 0xf8, 0xd2, 0x82, 0x91, 0xb1, 0xb3, 0x2b, 0x7e, 0x3e, 0x7f, 0xae, 0xce, 0x0a,
+    0xff, 0xc7, 0x76, 0x0c, 0x37, 0x86, 0xcd, 0xf1, 0x22, 0xbf, 0xee, 0x5d, 0xad, 0x41, 0x78, 0xe1,
+    0x78, 0x71, 0x0d, 0x8f, 0x8b, 0x65, 0xe2, 0x3c, 0xdd, 0xdb, 0x23, 0x38, 0xfe, 0xf3, 0x9f, 0x72,
+    0x40, 0x80, 0x83, 0x4a, 0xfc, 0x15, 0x84, 0xfe, 0x32, 0x9e, 0x3b, 0xb1, 0xde, 0x4d, 0x29, 0x44,
+    0x92, 0x20, 0x45, 0xa2, 0x89, 0x96, 0xa9, 0x28, 0xad, 0x3a, 0xaf, 0x76, 0x76, 0x9c, 0xef, 0x1d,
+    0x4f, 0x0c, 0xf3, 0xdc, 0x79, 0x51, 0xa9, 0x28, 0x53, 0x63, 0x30, 0xba, 0x77, 0x2e, 0xc2, 0xb9,
+    0x3f, 0x9d, 0x6a, 0x20, 0xd1, 0xe1, 0xb6, 0xb5, 0x95, 0x35, 0x62, 0x8b, 0x9f, 0x07, 0xb7, 0x08,
+    0x27, 0x6d, 0x1b, 0x92, 0xab, 0xf0, 0x02, 0xd8, 0x77, 0x56, 0x15, 0x97, 0x8d, 0x15, 0x2b, 0x54,
+    0xdd, 0x93, 0x3b, 0x73, 0xff, 0x84, 0x1d, 0xa1, 0x97, 0x01, 0xe0, 0x61, 0x1c, 0x2d, 0x2f, 0xaf,
+    0x9c, 0x6d, 0x7f, 0x11, 0x6e, 0x4f, 0x13, 0x40, 0xdb, 0x10, 0xd0, 0xec, 0x02, 0xfe, 0x93, 0x56,
+    0x9d, 0xf3, 0x3b, 0x67, 0xee, 0xcf, 0x82, 0x4a, 0x0d, 0x50, 0x9a, 0x6a, 0x5f, 0x06, 0x80, 0xa7,
+    0x81, 0x3f, 0xbe, 0x72, 0xce, 0x7d, 0x18, 0xd8, 0xf1, 0x01, 0x6b, 0x53, 0xec, 0xcb, 0x8f, 0xe1,
+    0x48, 0x0b, 0x92, 0x9a, 0xd3, 0x70, 0x7e, 0xd8, 0xf9, 0x8b, 0x33, 0x0b, 0x00, 0x61, 0xa1, 0x6f,
+    0x49, 0x2d, 0x71, 0x70, 0xbe, 0x0c, 0xa7, 0x29, 0x15, 0x71, 0x6a, 0xa8, 0xe3, 0xf1, 0x1d, 0x03,
+    0xb5, 0x7c, 0x06, 0x12, 0x43, 0x92, 0xa9, 0x99, 0x48, 0x4d, 0x8b, 0xeb, 0xb2, 0xda, 0x1e, 0x9e,
+    0x5e, 0x55, 0x3e, 0x0f, 0x81, 0x0f, 0x0c, 0x14, 0xe7, 0x3e, 0x31, 0x13, 0x97, 0x2f, 0x61, 0x1f,
+    0x56, 0xb0, 0xe7, 0x02, 0xac, 0x83, 0xf9, 0x38, 0x9a, 0x04, 0xa7, 0x83, 0x4e, 0x33, 0x9a, 0x01,
+    0x71, 0x06, 0xf3, 0x94, 0x3a, 0xa9, 0xc0, 0x27, 0xf7, 0x59, 0x12, 0xc5, 0xe9, 0x1e, 0x2e, 0xee,
+    0xd9, 0x34, 0x9c, 0x85, 0x29, 0x35, 0xc8, 0xf8, 0x3c, 0xd6, 0x18, 0x2f, 0x63, 0xa8, 0xb4, 0xe7,
+    0x32, 0xa0, 0x21, 0x7a, 0xd2, 0xa9, 0xc9, 0xb9, 0x81, 0x28, 0x63, 0xb5, 0x38, 0xe7, 0x11, 0x85,
+    0xb0, 0xff, 0xb8, 0xb4, 0x60, 0x92, 0x31, 0x19, 0x85, 0x08, 0xd3, 0x78, 0x19, 0xa8, 0x18, 0x6d,
+    0x62, 0xb3, 0x4a, 0xcb, 0xb4, 0x36, 0xeb, 0x52, 0xd8, 0xc0, 0x15, 0x63, 0xb7, 0x25, 0x92, 0xef,
+    0x01, 0x92, 0xe3, 0x4e, 0x3c, 0x7b, 0xe6, 0x3c, 0x95, 0xd3, 0x31, 0xe9, 0x48, 0x9d, 0x27, 0xce,
+    0xca, 0x20, 0x1a, 0x63, 0xb9, 0x72, 0xbe, 0xe6, 0x92, 0x95, 0x85, 0xc0, 0x56, 0xa9, 0xdd, 0xdc,
+    0x6b, 0x93, 0x7b, 0x1a, 0xd7, 0xa2, 0xeb, 0x0a, 0xa1, 0xdc, 0x0d, 0x51, 0x51, 0x3b, 0x8e, 0xa3,
+    0xd8, 0x73, 0x8f, 0x46, 0xa3, 0x13, 0x07, 0x37, 0x40, 0xcc, 0xbe, 0x62, 0x62, 0xfb, 0x02, 0x91,
+    0x4f, 0xc0, 0x27, 0xae, 0xfd, 0x96, 0x44, 0x73, 0x0d, 0xcf, 0xf9, 0x4c, 0xe9, 0xdf, 0x1a, 0x34,
+    0x19, 0xfb, 0xb8, 0xd7, 0x97, 0x41, 0x8d, 0x7d, 0x01, 0x4a, 0xff, 0x78, 0x66, 0x40, 0x4a, 0x60,
+    0x12, 0xfb, 0xd7, 0xa3, 0x8a, 0x46, 0x95, 0xa7, 0xd4, 0x05, 0x51, 0x1a, 0xf4, 0xc0, 0x3a, 0x9f,
+    0x06, 0xf3, 0x4b, 0x38, 0x69, 0x80, 0x61, 0xe8, 0xc7, 0xbf, 0x64, 0x19, 0x54, 0x4d, 0x99, 0xbf,
+    0x00, 0x96, 0xec, 0x4b, 0x27, 0xc2, 0xce, 0x3c, 0x4c, 0x43, 0x7f, 0x1a, 0xfe, 0x23, 0x78, 0x32,
+    0x01, 0xa1, 0x6b, 0x06, 0x5b, 0x5b, 0xf3, 0x27, 0x93, 0xf6, 0x67, 0xf8, 0x03, 0x51, 0x3f, 0x98,
+    0x07, 0x00, 0xa1, 0x56, 0xff, 0xb8, 0x09, 0xc0, 0xc5, 0x32, 0x38, 0x51, 0x82, 0x09, 0x88, 0x70,
+    0x5e, 0x05, 0x99, 0x0e, 0xdb, 0xcf, 0x92, 0x96, 0xd7, 0xc1, 0x1d, 0x1e, 0x44, 0xd0, 0xe0, 0x8a,
+    0x4e, 0xfa, 0x77, 0xec, 0x37, 0x5f, 0xe9, 0x79, 0x14, 0xa5, 0x70, 0x90, 0xf9, 0x0b, 0x84, 0xe6,
+    0x3d, 0xfc, 0xdf, 0x24, 0x41, 0xa5, 0x02, 0x1f, 0x8b, 0xed, 0x01, 0x1e, 0x6c, 0x30, 0xa3, 0x8b,
+    0xf0, 0xf2, 0x10, 0x38, 0x61, 0x8b, 0x88, 0x5c, 0xec, 0x48, 0x56, 0x03, 0x65, 0x43, 0x0f, 0x24,
+    0xc3, 0xaa, 0x26, 0x9d, 0x17, 0x54, 0x1b, 0x28, 0xd5, 0x48, 0x2a, 0xcf, 0xd5, 0x1b, 0xb6, 0x50,
+    0xb4, 0xcc, 0x0f, 0x33, 0x44, 0x81, 0x45, 0x14, 0xd3, 0xc6, 0x65, 0x22, 0x8c, 0x8a, 0xf2, 0x9a,
+    0x60, 0x03, 0xec, 0xba, 0x03, 0x10, 0x8d, 0x3f, 0xfb, 0x53, 0x4f, 0x76, 0x52, 0x75, 0x5e, 0xa0,
+    0x10, 0xa7, 0x1d, 0x61, 0x21, 0xec, 0xd0, 0xfb, 0x85, 0x7f, 0x12, 0x8e, 0xaf, 0x01, 0xa0, 0xb9,
+    0xc1, 0x49, 0xb4, 0x4a, 0x64, 0xf9, 0x64, 0x32, 0xbc, 0x4b, 0xba, 0xd1, 0xa5, 0xe7, 0x36, 0xfb,
+    0xc7, 0xc7, 0xa0, 0x34, 0xb4, 0x07, 0x4e, 0xbf, 0xd7, 0xed, 0xf4, 0xda, 0x2e, 0x82, 0xf8, 0xc9,
+    0x13, 0x09, 0x5a, 0x98, 0x40, 0x43, 0x4a, 0xd0, 0x5e, 0x28, 0x89, 0x53, 0x13, 0xab, 0xc3, 0xc9,
+    0xae, 0xbe, 0xc3, 0xc0, 0x81, 0xdb, 0xd3, 0x00, 0xff, 0x3c, 0xb8, 0xeb, 0x4c, 0x3c, 0x17, 0x55,
+    0x87, 0xae, 0x5b, 0xa9, 0x8d, 0x41, 0x42, 0x4e, 0x70, 0xdb, 0x6b, 0x69, 0x74, 0x09, 0x12, 0x9f,
+    0xe7, 0xb2, 0x7e, 0x50, 0xd8, 0x9f, 0x10, 0x37, 0x80, 0x7d, 0xa8, 0xac, 0xd1, 0xd9, 0x60, 0xbd,
+    0xce, 0x06, 0x7c, 0x39, 0x06, 0xbe, 0xd8, 0xf1, 0x42, 0xb0, 0x6b, 0x14, 0x72, 0x6b, 0x4c, 0xb8,
+    0x55, 0xd8, 0x07, 0x2f, 0x16, 0x32, 0xae, 0xfd, 0x0b, 0x89, 0xba, 0xca, 0x27, 0x5d, 0x82, 0x28,
+    0x63, 0xa1, 0xec, 0x5c, 0xa0, 0xae, 0xdc, 0x1c, 0xb7, 0x44, 0x7e, 0x64, 0x93, 0x2d, 0xc6, 0x17,
+    0x97, 0x25, 0xfc, 0xc6, 0xb2, 0x18, 0x0f, 0x5a, 0xe0, 0xaf, 0x61, 0x30, 0xc6, 0x02, 0xe0, 0x17,
+    0x2e, 0x00, 0x32, 0x8d, 0xc3, 0x59, 0x41, 0x43, 0x65, 0xb9, 0xac, 0x2d, 0x16, 0x34, 0x16, 0x61,
+    0x0f, 0xce, 0xa4, 0x35, 0x9b, 0x0b, 0x98, 0x68, 0xed, 0x59, 0x61, 0x41, 0x07, 0x42, 0xe0, 0x18,
+    0xe3, 0xe9, 0xed, 0x69, 0xa7, 0x10, 0xf0, 0x22, 0x94, 0x4d, 0xe1, 0xc0, 0xbe, 0xf0, 0x51, 0x31,
+    0x50, 0x28, 0x60, 0xb9, 0x98, 0x80, 0x54, 0xdf, 0xc4, 0x81, 0x87, 0xc4, 0x9f, 0x3d, 0x03, 0x95,
+    0x2d, 0x15, 0xb4, 0x13, 0x1a, 0xe0, 0x02, 0xd3, 0xd4, 0x20, 0xb6, 0x0f, 0xf8, 0xd8, 0x6f, 0xb4,
+    0x40, 0x41, 0x70, 0x40, 0x81, 0x39, 0xee, 0x0c, 0x87, 0x9d, 0xde, 0x5b, 0xb1, 0xed, 0xac, 0x11,
+    0x2e, 0x88, 0x56, 0x67, 0x00, 0x0c, 0x8e, 0x34, 0x13, 0x08, 0x95, 0x75, 0xfa, 0x5b, 0xf8, 0xed,
+    0x29, 0xf4, 0x57, 0x88, 0xfd, 0x50, 0xe1, 0x38, 0x48, 0x7d, 0x81, 0x24, 0xca, 0x2c, 0x56, 0xb4,
+    0xc3, 0x2a, 0x6a, 0x4b, 0x44, 0x2d, 0x1a, 0x4d, 0x85, 0x2f, 0x15, 0xd4, 0x52, 0x38, 0x00, 0x38,
+    0x27, 0x47, 0x64, 0x7e, 0xd7, 0xfe, 0x50, 0xa7, 0x93, 0x0f, 0xbe, 0x6a, 0x3c, 0x07, 0x7b, 0x60,
+    0x23, 0x57, 0xc4, 0x14, 0xcc, 0xb6, 0x4d, 0xd0, 0xae, 0x86, 0xbc, 0x35, 0xd6, 0xc8, 0x71, 0x97,
+    0xf7, 0x8a, 0x4a, 0xe6, 0x91, 0xa9, 0xa4, 0x92, 0xe9, 0x97, 0xaa, 0xb2, 0x46, 0xdf, 0x76, 0xd7,
+    0xdb, 0x6a, 0xe8, 0xb7, 0xcf, 0x94, 0x5b, 0xef, 0x1c, 0xfe, 0x23, 0x7a, 0xcc, 0x14, 0x5e, 0x2c,
+    0x55, 0x01, 0x18, 0x92, 0x5e, 0xfb, 0xd1, 0x3d, 0x4f, 0xe7, 0x30, 0xa1, 0x21, 0x70, 0x0b, 0xe0,
+    0x22, 0xfc, 0x57, 0x7f, 0x11, 0xcc, 0xc5, 0x2f, 0x5c, 0x02, 0x7d, 0xe5, 0xd2, 0x06, 0xb4, 0xab,
+    0x81, 0x62, 0xd0, 0x06, 0x61, 0xd3, 0x43, 0xa6, 0xf3, 0x26, 0x47, 0xee, 0x41, 0xd9, 0xae, 0x00,
+    0x3f, 0xd5, 0x69, 0x3d, 0x00, 0x48, 0x06, 0xd3, 0xda, 0x24, 0x4c, 0xfc, 0xf3, 0x29, 0x49, 0x3c,
+    0xd9, 0x4c, 0xef, 0x2b, 0x06, 0xa2, 0x20, 0xb3, 0x5f, 0x81, 0x2a, 0x58, 0xc5, 0xd8, 0x70, 0x2c,
+    0xaa, 0x88, 0xe6, 0xf9, 0x91, 0x54, 0x30, 0xc2, 0xca, 0x66, 0x3e, 0x1c, 0xe6, 0x97, 0x5d, 0x3c,
+    0xba, 0x92, 0x68, 0x19, 0x8f, 0xe1, 0xf0, 0x99, 0x25, 0x97, 0x3a, 0xe1, 0xa4, 0x08, 0x3b, 0x94,
+    0x94, 0x5a, 0xb8, 0x87, 0x40, 0xcf, 0x51, 0x37, 0x1a, 0xfb, 0x53, 0x3a, 0xc4, 0x86, 0x40, 0xdc,
+    0x20, 0x17, 0xf3, 0x29, 0x70, 0xe9, 0x03, 0x1a, 0x80, 0xec, 0x0a, 0xe0, 0x86, 0x7f, 0x58, 0xaf,
+    0xf8, 0xfb, 0x8c, 0xb0, 0x04, 0x7a, 0xd7, 0x27, 0x11, 0x07, 0xf3, 0x49, 0x10, 0xc3, 0x24, 0x00,
+    0xab, 0x40, 0x61, 0x09, 0x0c, 0xaa, 0x05, 0x05, 0xb8, 0x0c, 0x06, 0x53, 0xd9, 0x4e, 0x05, 0xc3,
+    0x53, 0x28, 0x16, 0xb2, 0x10, 0x17, 0x88, 0xa3, 0x4b, 0x03, 0x75, 0xa5, 0x66, 0x2d, 0xa4, 0xa9,
+    0x7d, 0xa5, 0xe8, 0xb7, 0x28, 0x9c, 0x7b, 0xee, 0xaf, 0x73, 0xb7, 0x82, 0x84, 0xdc, 0xeb, 0xa3,
+    0x62, 0x3e, 0x74, 0xf5, 0x89, 0xa3, 0xbe, 0x89, 0x67, 0x6c, 0x21, 0xdc, 0xa6, 0x21, 0x9d, 0x9e,
+    0xc5, 0x50, 0x96, 0x53, 0xe3, 0xa3, 0x92, 0x06, 0x8b, 0xad, 0x2a, 0x9a, 0xa8, 0x9e, 0x9b, 0xe9,
+    0x1b, 0x61, 0x27, 0x50, 0x49, 0x3b, 0xab, 0xa5, 0x69, 0x60, 0x8c, 0x94, 0x81, 0x60, 0x38, 0x25,
+    0xb9, 0x45, 0xbb, 0x22, 0xb7, 0xd0, 0xdc, 0x0e, 0x83, 0xf4, 0xae, 0xa2, 0x1b, 0xcb, 0x66, 0xd9,
+    0x9a, 0x65, 0x90, 0x98, 0xa1, 0x45, 0x65, 0xc5, 0x36, 0x92, 0xd5, 0x45, 0xdd, 0x44, 0x6a, 0x54,
+    0x61, 0x6d, 0x41, 0x24, 0xbf, 0x9b, 0x06, 0x88, 0xcd, 0x8b, 0xa9, 0x4f, 0xc7, 0xf6, 0xc5, 0x34,
+    0xb8, 0x35, 0x36, 0xe4, 0x2a, 0x9c, 0x04, 0x85, 0x78, 0xf4, 0x0d, 0xa6, 0x30, 0x07, 0x1d, 0xc8,
+    0x98, 0x02, 0x48, 0x5e, 0xc0, 0x51, 0x10, 0x2b, 0x14, 0x6c, 0x10, 0x88, 0xe2, 0xbe, 0x3f, 0x69,
+    0xb8, 0x62, 0xe7, 0xcd, 0x56, 0xc8, 0x79, 0x0a, 0xdb, 0xa1, 0x15, 0xb7, 0xa8, 0x25, 0x97, 0xf4,
+    0x6c, 0xed, 0x86, 0x1f, 0x86, 0x6a, 0x2b, 0x8b, 0x94, 0x24, 0x84, 0x59, 0xde, 0x12, 0xd7, 0xac,
+    0x99, 0x4e, 0x75, 0x22, 0x32, 0xad, 0xaa, 0x99, 0xb6, 0xb6, 0xa9, 0x20, 0x94, 0x40, 0x0f, 0x17,
+    0x91, 0x9b, 0x53, 0xb1, 0x26, 0x25, 0xf2, 0x0e, 0x57, 0xc2, 0xc6, 0x48, 0xbc, 0x9e, 0x37, 0xa9,
+    0x2d, 0x13, 0x60, 0x6b, 0xdb, 0xce, 0x04, 0xf8, 0x51, 0x8a, 0xbb, 0xf4, 0xbd, 0xf3, 0x02, 0x84,
+    0x66, 0xf8, 0x75, 0x18, 0xde, 0x06, 0x13, 0x6f, 0x27, 0xd7, 0x14, 0x1b, 0x00, 0xbf, 0x92, 0x24,
+    0x39, 0x04, 0x7d, 0x47, 0xf4, 0x83, 0x8d, 0x5f, 0xfe, 0x90, 0x6b, 0x42, 0x5d, 0x5b, 0xda, 0x50,
+    0x79, 0xbe, 0x51, 0x21, 0x72, 0x31, 0xc8, 0xa1, 0x2c, 0xa4, 0xf1, 0x20, 0x31, 0x23, 0xe4, 0x96,
+    0xdb, 0x44, 0x88, 0x72, 0x40, 0x2c, 0xf2, 0xb0, 0x04, 0x17, 0x0c, 0x3f, 0xfe, 0x54, 0x51, 0xf4,
+    0x5c, 0x76, 0x40, 0x36, 0xa6, 0xd3, 0x43, 0xd0, 0x8c, 0x82, 0xb8, 0x15, 0x26, 0xd7, 0x1e, 0xef,
+    0xab, 0x2a, 0xbb, 0xa8, 0x62, 0x53, 0xc1, 0x05, 0x6c, 0xc2, 0xd6, 0xa6, 0xb3, 0x45, 0x3e, 0x38,
+    0x6c, 0xd5, 0x1c, 0x62, 0x87, 0xfd, 0x51, 0x6d, 0xc5, 0x84, 0xdc, 0xad, 0x2d, 0x3c, 0x56, 0xd9,
+    0x7f, 0xf7, 0x5d, 0x39, 0x93, 0xbc, 0x9d, 0xa9, 0xc0, 0x5a, 0x2f, 0x35, 0x54, 0xe3, 0xc0, 0xea,
+    0x2d, 0x67, 0xe7, 0xa0, 0x04, 0x81, 0xce, 0x94, 0x99, 0x30, 0x74, 0x04, 0xe4, 0xe7, 0x90, 0x5a,
+    0x11, 0x85, 0xd1, 0x9d, 0xec, 0xec, 0xe2, 0xe7, 0x96, 0x1b, 0xcc, 0xb7, 0x4e, 0x87, 0xae, 0x0e,
+    0x25, 0x47, 0x07, 0x13, 0xef, 0x8c, 0xb7, 0x50, 0x3a, 0xb3, 0xcd, 0x90, 0xf1, 0x41, 0x52, 0xe3,
+    0x8e, 0x02, 0x50, 0x92, 0x63, 0x0f, 0x00, 0xe3, 0xab, 0xf4, 0xf5, 0x94, 0x15, 0xa8, 0x74, 0x95,
+    0x1d, 0x17, 0x2f, 0xca, 0x38, 0x14, 0x69, 0x8e, 0x78, 0x88, 0xbc, 0xd0, 0xa5, 0x43, 0x6c, 0xf8,
+    0x72, 0xad, 0x86, 0x2f, 0xf5, 0x43, 0x92, 0x06, 0x84, 0xa5, 0xd0, 0x5f, 0x2f, 0xb3, 0x39, 0xa9,
+    0x7d, 0x07, 0x9f, 0x99, 0x84, 0x03, 0x93, 0xae, 0xb1, 0x1f, 0xb8, 0x76, 0x75, 0xf8, 0x34, 0x4c,
+    0x49, 0x44, 0xa6, 0x2a, 0xec, 0x07, 0x0a, 0xfe, 0xbd, 0x1d, 0xa7, 0xf5, 0xc3, 0xa8, 0xe1, 0xe6,
+    0xaa, 0x1e, 0xfb, 0xf1, 0xb5, 0x56, 0xbd, 0xff, 0x39, 0x88, 0x63, 0xe0, 0xdd, 0x28, 0x3e, 0x7f,
+    0x4f, 0x92, 0xb3, 0xd6, 0x88, 0xf4, 0x40, 0x52, 0x48, 0x78, 0xa3, 0xac, 0x80, 0x8d, 0x03, 0x5a,
+    0xad, 0x5a, 0xff, 0x76, 0x31, 0x22, 0xea, 0xe4, 0xb5, 0xc5, 0x4f, 0x73, 0xda, 0xb7, 0x0b, 0xe5,
+    0x02, 0x88, 0xd7, 0x94, 0x25, 0x66, 0x65, 0x90, 0xff, 0x4e, 0xe7, 0xd3, 0x08, 0x94, 0x6f, 0xe4,
+    0x50, 0xb4, 0xa7, 0x35, 0xad, 0x0c, 0xb4, 0xd1, 0x25, 0xec, 0x3c, 0xe0, 0x36, 0x1a, 0xb8, 0xf6,
+    0x9d, 0x1d, 0x58, 0x86, 0x59, 0xcb, 0xe8, 0x50, 0xcc, 0x52, 0xf6, 0xc6, 0x0b, 0xca, 0xba, 0xa2,
+    0x2a, 0x7c, 0x83, 0x68, 0xfb, 0x0c, 0x12, 0x95, 0x48, 0xeb, 0x76, 0x7f, 0x46, 0xe6, 0xc1, 0x76,
+    0x0c, 0x79, 0x09, 0x31, 0x17, 0xda, 0x9c, 0xe7, 0xca, 0x36, 0x3c, 0xcf, 0x1a, 0x38, 0xff, 0x74,
+    0x46, 0x2f, 0x5e, 0x0d, 0xa8, 0x62, 0x06, 0x61, 0xbd, 0xc2, 0x2f, 0xcc, 0x42, 0xa6, 0x91, 0x21,
+    0x87, 0x6f, 0x25, 0xe3, 0x58, 0x0a, 0x1c, 0x19, 0xe3, 0x32, 0x7a, 0x39, 0xf8, 0xa1, 0xf5, 0xf6,
+    0xd5, 0x90, 0x7a, 0x52, 0x61, 0xf8, 0x1c, 0x6f, 0x05, 0x59, 0x99, 0xba, 0x4c, 0x45, 0x03, 0xfa,
+    0xd9, 0x9f, 0xa2, 0x10, 0xee, 0x3c, 0x25, 0x1a, 0xaa, 0x65, 0x65, 0x2a, 0x64, 0x63, 0x7f, 0x2e,
+    0xd1, 0x8b, 0x6a, 0x0c, 0xb0, 0xc0, 0xdc, 0xd0, 0x9b, 0xf0, 0x22, 0xd4, 0x6a, 0xbd, 0xc7, 0x02,
+    0xb3, 0xd6, 0x38, 0x98, 0x4e, 0xb5, 0x5a, 0x4d, 0x2c, 0x30, 0x6b, 0x9d, 0xa7, 0x5a, 0x9d, 0x83,
+    0x34, 0x57, 0x63, 0x16, 0x45, 0x93, 0xd1, 0xdd, 0x22, 0x90, 0xbb, 0x2d, 0x0b, 0x10, 0x83, 0x0f,
+    0x4e, 0x0f, 0x0f, 0x91, 0xd9, 0x46, 0xa7, 0x8b, 0x45, 0x10, 0x37, 0xfd, 0x24, 0x27, 0x3d, 0x45,
+    0x13, 0x31, 0x02, 0xfd, 0xcd, 0xd1, 0xfe, 0x95, 0x6b, 0xd6, 0xea, 0xfa, 0xe7, 0x44, 0xad, 0x5e,
+    0x36, 0xe0, 0x1e, 0xf1, 0x6d, 0x34, 0xfc, 0x20, 0x79, 0xe1, 0x50, 0x75, 0x87, 0xda, 0x02, 0x56,
+    0x65, 0xd5, 0x00, 0xf6, 0x4c, 0x89, 0xc3, 0x92, 0x0a, 0x87, 0xbc, 0xd4, 0xff, 0x08, 0xc6, 0x9a,
+    0xac, 0x89, 0xfc, 0xc2, 0x3c, 0x1d, 0xde, 0xbf, 0x78, 0xdb, 0x7d, 0xe5, 0xfc, 0x07, 0x99, 0x50,
+    0x11, 0xe4, 0xcf, 0x69, 0xb3, 0xdf, 0xd7, 0x99, 0x6e, 0x08, 0xd0, 0xc5, 0x82, 0x26, 0xfd, 0x24,
+    0xb8, 0xe2, 0xcf, 0x03, 0xfa, 0x79, 0x9e, 0xf2, 0xca, 0x62, 0x06, 0xb4, 0x0e, 0xc1, 0x93, 0x03,
+    0xbc, 0xef, 0x5d, 0x6b, 0xec, 0xde, 0x76, 0xa3, 0xa0, 0x93, 0x22, 0xf1, 0x87, 0xd9, 0xec, 0xac,
+    0x67, 0xc8, 0x1a, 0x42, 0x0c, 0xb6, 0x36, 0xad, 0x39, 0xdc, 0xbc, 0xac, 0xb2, 0x77, 0x45, 0xbc,
+    0x81, 0x2d, 0x2c, 0x91, 0x70, 0x0a, 0x0e, 0x8f, 0xb2, 0xc3, 0x69, 0x7b, 0xdb, 0x09, 0x2f, 0xe7,
+    0x51, 0x1c, 0x94, 0xae, 0x93, 0x1b, 0xf7, 0xaa, 0x0e, 0xbb, 0x7a, 0x50, 0xe5, 0xe2, 0x05, 0x33,
+    0xf1, 0xd1, 0xe5, 0xff, 0xc7, 0x70, 0x72, 0x96, 0x9d, 0x0f, 0x58, 0x54, 0x9b, 0xda, 0xe4, 0x40,
+    0xf5, 0x8b, 0x26, 0x06, 0xd2, 0x87, 0x05, 0xbb, 0x04, 0xc5, 0x7f, 0x94, 0x52, 0x71, 0xc3, 0x0f,
+    0xdc, 0x3b, 0xf0, 0xa5, 0x05, 0x93, 0x3e, 0x89, 0x7b, 0x7e, 0x76, 0x71, 0x8e, 0xc5, 0xab, 0x0c,
+    0x84, 0xe9, 0x15, 0x6e, 0x32, 0xe0, 0xa4, 0x81, 0x07, 0x34, 0x34, 0x52, 0xc7, 0xb6, 0xab, 0x1f,
+    0x90, 0x49, 0x5a, 0x2a, 0xfa, 0xc3, 0x77, 0xde, 0x21, 0x57, 0xc9, 0xd0, 0xea, 0x18, 0xce, 0xe7,
+    0x41, 0x7c, 0x34, 0x3a, 0xc6, 0xdb, 0x79, 0xf7, 0xf5, 0x24, 0xfc, 0xec, 0x90, 0x06, 0xb0, 0xf7,
+    0xdd, 0x02, 0xa4, 0x6e, 0xbc, 0x3a, 0x7a, 0xb9, 0xb3, 0xb8, 0xdd, 0x8d, 0x16, 0xfe, 0x38, 0x4c,
+    0xef, 0xea, 0x3b, 0xb5, 0x1f, 0xbf, 0x7b, 0xf3, 0x9b, 0x3f, 0xbe, 0x46, 0x98, 0x84, 0xf3, 0x5a,
+    0xad, 0xf6, 0x7a, 0x1b, 0xda, 0xbc, 0x71, 0x95, 0x15, 0xe9, 0x08, 0x06, 0x5b, 0xd7, 0x98, 0xc6,
+    0xb0, 0xcf, 0x77, 0x0e, 0xde, 0x03, 0x01, 0x07, 0x3c, 0xbf, 0x53, 0x6e, 0xab, 0x80, 0xe9, 0x87,
+    0x31, 0x80, 0x2c, 0x8a, 0xc3, 0x40, 0xde, 0x85, 0xa5, 0x78, 0x13, 0xcb, 0x2f, 0xc4, 0x0c, 0xdc,
+    0x42, 0xc5, 0x4c, 0xdc, 0x3e, 0xe8, 0x86, 0x0a, 0x09, 0xe8, 0xa2, 0xbb, 0x14, 0xb6, 0xdb, 0x00,
+    0x3a, 0xbc, 0x94, 0x04, 0xd8, 0x99, 0xd6, 0x48, 0xbd, 0x03, 0xa6, 0xa6, 0x7e, 0xa1, 0x39, 0x00,
+    0xd3, 0xa8, 0xd5, 0xd0, 0x20, 0x9b, 0xb4, 0xc2, 0xb8, 0x4e, 0x98, 0x80, 0x3f, 0x4e, 0x7c, 0x40,
+    0xe5, 0x54, 0xfc, 0x4e, 0x40, 0x66, 0xae, 0xc3, 0x31, 0x76, 0x6f, 0x18, 0x11, 0xef, 0xf3, 0x17,
+    0x3d, 0x99, 0xb1, 0x05, 0x97, 0x60, 0x8e, 0x19, 0x56, 0x8c, 0x1e, 0x18, 0xc1, 0x08, 0xd3, 0xb5,
+    0x62, 0x61, 0xdc, 0x35, 0xee, 0x8f, 0x2d, 0x97, 0x78, 0x08, 0xaf, 0x32, 0xe9, 0xf8, 0xa1, 0x38,
+    0x80, 0x74, 0x01, 0x12, 0x2c, 0x68, 0xee, 0x13, 0x0d, 0x03, 0x6c, 0x82, 0xaf, 0x41, 0x48, 0x8a,
+    0xdc, 0x9b, 0x09, 0xd5, 0x43, 0x22, 0x1c, 0xa0, 0x64, 0xd2, 0xd4, 0xe4, 0x32, 0x6d, 0x62, 0xa7,
+    0x61, 0xc3, 0x2f, 0x23, 0xf0, 0x07, 0x12, 0x86, 0xce, 0x1c, 0xb4, 0xcb, 0x28, 0x3c, 0x69, 0x76,
+    0xbe, 0x1a, 0x80, 0x3f, 0xec, 0x22, 0x45, 0x6f, 0xc1, 0x81, 0x73, 0x39, 0xaf, 0x8f, 0x03, 0xbc,
+    0x1b, 0xf9, 0xee, 0xcd, 0xe7, 0x28, 0xd4, 0x61, 0x99, 0x41, 0x07, 0x97, 0xcc, 0x74, 0x0e, 0x1d,
+    0x03, 0x54, 0x76, 0x75, 0x9f, 0x4d, 0x1d, 0xef, 0x45, 0xaf, 0xd2, 0xd9, 0x54, 0xb1, 0xe1, 0x2b,
+    0x2b, 0x11, 0xc8, 0x47, 0xf7, 0x70, 0x78, 0xcb, 0x70, 0x5b, 0xb1, 0x99, 0xfc, 0xc2, 0x64, 0x48,
+    0xa7, 0xac, 0xce, 0xd7, 0xae, 0xfc, 0xc4, 0xc3, 0x16, 0xbb, 0xb9, 0xda, 0x87, 0xc8, 0xdf, 0xf0,
+    0x54, 0x0e, 0x91, 0xc7, 0xed, 0xed, 0x19, 0x5c, 0xef, 0xd9, 0x33, 0xed, 0xb6, 0x65, 0x6f, 0xcf,
+    0xd1, 0x56, 0x22, 0x84, 0xe0, 0x84, 0xac, 0x1e, 0x80, 0x56, 0x5b, 0x38, 0x3b, 0xdc, 0x15, 0x8f,
+    0x4d, 0x04, 0x8e, 0x75, 0xe9, 0x3f, 0xc5, 0xa4, 0xe7, 0x0a, 0xfb, 0xc8, 0xc6, 0xc5, 0xcf, 0x34,
+    0x96, 0xfc, 0x9a, 0xf5, 0xad, 0xf2, 0xa2, 0xe3, 0xe6, 0x16, 0x6d, 0x8d, 0xb3, 0x88, 0x41, 0xf6,
+    0xbc, 0xad, 0x83, 0x42, 0x8a, 0x2e, 0x11, 0x78, 0x13, 0x5f, 0x05, 0x4d, 0x17, 0xff, 0x0e, 0x6e,
+    0x83, 0xf1, 0x32, 0x45, 0x7b, 0x22, 0x14, 0x25, 0xb0, 0x67, 0x01, 0x15, 0xc7, 0xc1, 0xe5, 0x72,
+    0xea, 0xc7, 0x0e, 0x4e, 0x2e, 0xc9, 0xb6, 0x1f, 0x40, 0xcd, 0xba, 0xc2, 0x89, 0x3b, 0xca, 0xce,
+    0x65, 0x5f, 0x9a, 0xca, 0xaa, 0x78, 0x5d, 0xfc, 0xdb, 0xa8, 0x8b, 0x8c, 0x46, 0xad, 0x89, 0xbf,
+    0x5d, 0xfd, 0xd4, 0x45, 0x90, 0xd4, 0x88, 0x09, 0x99, 0xbc, 0x2b, 0x9b, 0xc2, 0xb6, 0x71, 0x51,
+    0x5c, 0x38, 0x05, 0x58, 0xb2, 0x51, 0xd5, 0x36, 0x03, 0xa3, 0x1a, 0x97, 0x53, 0x68, 0x32, 0x49,
+    0x5b, 0x02, 0x8a, 0xcd, 0x8c, 0xfc, 0x17, 0x8a, 0x67, 0xf6, 0xfd, 0xba, 0x33, 0xc3, 0x0d, 0x58,
+    0x67, 0x6a, 0x46, 0xbd, 0x7b, 0xeb, 0x86, 0xa3, 0x29, 0x03, 0xb0, 0x6b, 0xba, 0x9c, 0xcd, 0xeb,
+    0xce, 0xe9, 0xc9, 0xd6, 0x16, 0xba, 0x09, 0xe2, 0x7e, 0x2e, 0x88, 0x7b, 0x57, 0x1d, 0xf4, 0x16,
+    0xb9, 0x53, 0x90, 0x00, 0xf9, 0x38, 0xfd, 0xcc, 0x6f, 0x34, 0x7d, 0xd2, 0xef, 0xe2, 0x95, 0x6d,
+    0x61, 0xc7, 0x81, 0xb9, 0x7e, 0xd1, 0x86, 0x0f, 0x6d, 0x87, 0xe5, 0xd3, 0xe2, 0x9d, 0xe5, 0xed,
+    0x15, 0xbb, 0x0c, 0xd5, 0xc5, 0xe2, 0xca, 0xaa, 0xb5, 0xa3, 0xe9, 0x5a, 0xae, 0x1d, 0x48, 0xc3,
+    0x99, 0xa5, 0x58, 0x02, 0x23, 0xfa, 0x9f, 0x81, 0x75, 0xe3, 0xce, 0x99, 0x96, 0xa0, 0x90, 0x14,
+    0x50, 0x6d, 0x45, 0x48, 0x5b, 0x24, 0x47, 0x53, 0x29, 0xeb, 0x62, 0x9f, 0x4f, 0xe8, 0x18, 0x7f,
+    0x29, 0x1f, 0x2a, 0x85, 0xb4, 0x47, 0xfc, 0xe8, 0xb9, 0x60, 0x8f, 0xa4, 0x7a, 0xed, 0x7d, 0xc7,
+    0xb4, 0x30, 0x52, 0xa0, 0xbe, 0x23, 0xb1, 0x71, 0x0b, 0x98, 0x07, 0x2b, 0x46, 0x2e, 0x92, 0x15,
+    0x23, 0x2f, 0x11, 0xe5, 0x54, 0xac, 0xc0, 0x51, 0xf6, 0x8c, 0x9e, 0x2d, 0xd3, 0x70, 0x7c, 0xbd,
+    0xf7, 0x1d, 0x1c, 0x23, 0x30, 0xa5, 0x26, 0xfe, 0xf0, 0x02, 0xbc, 0xa4, 0xaf, 0x2a, 0x5d, 0x56,
+    0x7f, 0x75, 0xb3, 0x8e, 0x7e, 0x75, 0x2b, 0x45, 0x7d, 0x4d, 0xce, 0xa7, 0x5a, 0x77, 0xad, 0xf3,
+    0x29, 0xeb, 0xb1, 0xac, 0xaf, 0x37, 0xb6, 0xce, 0xcc, 0x25, 0x67, 0x98, 0x8f, 0x4b, 0x79, 0x93,
+    0x15, 0xe1, 0xef, 0xdc, 0x11, 0x50, 0xd8, 0x8d, 0x20, 0x0a, 0xd9, 0x49, 0x90, 0x8c, 0xfd, 0x45,
+    0x70, 0x04, 0xf5, 0x15, 0x82, 0x5c, 0xbf, 0x4f, 0xa2, 0x2c, 0x44, 0x2c, 0xd6, 0x1b, 0x61, 0xde,
+    0x66, 0x8d, 0x11, 0x05, 0x58, 0x63, 0xc2, 0x92, 0xf2, 0xc6, 0x9a, 0xd8, 0x50, 0x24, 0x92, 0x62,
+    0x75, 0xe5, 0x50, 0x46, 0x82, 0x1e, 0xc7, 0x11, 0xe8, 0x55, 0x9c, 0xd9, 0x13, 0xaa, 0x82, 0x24,
+    0x9a, 0x46, 0xce, 0xe7, 0x30, 0xb8, 0x51, 0x4e, 0x7d, 0x51, 0x61, 0x8f, 0x75, 0x0a, 0x8a, 0x4d,
+    0x7c, 0xc7, 0xa4, 0x0c, 0xf4, 0x83, 0xa9, 0x89, 0xc3, 0x42, 0x31, 0x15, 0xf1, 0xa2, 0x8a, 0x68,
+    0x5a, 0x4b, 0x68, 0xa8, 0x0e, 0x74, 0xfe, 0x33, 0xf4, 0x0d, 0xc2, 0xe0, 0x39, 0x2a, 0xf1, 0x80,
+    0xe1, 0x73, 0x10, 0xee, 0x03, 0x14, 0x1a, 0xee, 0x55, 0x89, 0xc1, 0x7e, 0x56, 0xab, 0x02, 0x8c,
+    0xc6, 0x33, 0xd9, 0xee, 0x28, 0x26, 0x33, 0x56, 0xc0, 0x0d, 0x71, 0x8a, 0x94, 0x24, 0xae, 0x88,
+    0x6e, 0x98, 0x97, 0x28, 0xd4, 0x22, 0x03, 0xdf, 0x8d, 0xae, 0x45, 0xf3, 0x76, 0x54, 0xad, 0x06,
+    0x82, 0x52, 0xf2, 0x3e, 0x4c, 0x41, 0x87, 0xab, 0x25, 0x57, 0x70, 0x52, 0x82, 0xb6, 0x90, 0xfb,
+    0x00, 0xec, 0xb3, 0xe0, 0xcb, 0xb9, 0x9f, 0x16, 0x7c, 0x59, 0xdc, 0x99, 0xae, 0x15, 0x2a, 0x1f,
+    0x48, 0x13, 0x6d, 0x3d, 0xf8, 0x93, 0xcf, 0x4a, 0xb7, 0x75, 0x4d, 0xd4, 0x9b, 0xb6, 0x34, 0x61,
+    0x36, 0xed, 0x1d, 0xc3, 0x1a, 0x30, 0xa7, 0xab, 0xcc, 0xbf, 0xfa, 0x73, 0xb7, 0xea, 0x1e, 0x06,
+    0xe7, 0xf0, 0xdf, 0x63, 0x3f, 0x86, 0xff, 0x36, 0x16, 0x31, 0xfd, 0x7d, 0x07, 0xff, 0xfd, 0xeb,
+    0x72, 0x4e, 0xff, 0x9d, 0x62, 0xf9, 0xf2, 0x12, 0xfe, 0x3b, 0x0c, 0x16, 0xf0, 0xdf, 0xfe, 0x38,
+    0x85, 0xff, 0xf6, 0xa2, 0xcf, 0xf0, 0xdf, 0x16, 0x1c, 0x12, 0x67, 0x1f, 0x27, 0x28, 0xf5, 0x1d,
+    0x83, 0x0a, 0x75, 0xe5, 0x55, 0x34, 0xe1, 0x70, 0x42, 0xb7, 0x1c, 0xdc, 0xec, 0x49, 0xb5, 0xd8,
+    0xfd, 0x5f, 0x05, 0x34, 0xbc, 0xc9, 0x10, 0x5d, 0xb6, 0xbc, 0x97, 0x55, 0x3c, 0xd9, 0xb5, 0xe9,
+    0x5d, 0x5d, 0x19, 0x8d, 0x8e, 0xa2, 0x65, 0x9c, 0xe4, 0x5a, 0xed, 0xe8, 0xad, 0x66, 0x33, 0xa3,
+    0xd5, 0x71, 0x38, 0x5f, 0xa6, 0x41, 0x49, 0x3b, 0x0e, 0x3e, 0x84, 0x86, 0x30, 0x6f, 0xe1, 0x84,
+    0xc5, 0xdf, 0x30, 0x0d, 0xb4, 0x69, 0x90, 0x2d, 0x60, 0x66, 0xf3, 0x13, 0xd0, 0x91, 0x71, 0x6d,
+    0x89, 0xf9, 0x82, 0x9a, 0x70, 0x3f, 0xdf, 0x42, 0xb9, 0x39, 0xab, 0xa5, 0x49, 0xcf, 0x6a, 0x17,
+    0x68, 0x22, 0x5f, 0xdd, 0x05, 0xd6, 0xd2, 0xba, 0x60, 0xd4, 0x28, 0x7a, 0xaf, 0x68, 0xfe, 0xab,
+    0xa2, 0x34, 0xa7, 0x14, 0x0b, 0xa5, 0x5c, 0xd5, 0x8c, 0xef, 0x05, 0xd7, 0xa0, 0x89, 0xe0, 0x6d,
+    0x0c, 0xd0, 0x20, 0x87, 0xcd, 0x04, 0xe4, 0x49, 0x10, 0x02, 0xe0, 0x2f, 0xd0, 0x56, 0x3e, 0x87,
+    0xbe, 0x72, 0x55, 0x64, 0x81, 0xe4, 0x5a, 0xd7, 0x10, 0x1a, 0x80, 0x27, 0x50, 0x71, 0xc4, 0x5c,
+    0x47, 0x95, 0x1b, 0x90, 0xed, 0xf5, 0xee, 0x3f, 0x4c, 0x20, 0x76, 0xd7, 0x83, 0x62, 0xd7, 0x2d,
+    0xd8, 0x84, 0xc1, 0x7a, 0xed, 0x07, 0x6e, 0x6e, 0x07, 0xa8, 0xdb, 0x8a, 0x3a, 0x15, 0x03, 0xf2,
+    0x62, 0x9d, 0xb6, 0x86, 0x03, 0xb5, 0xe1, 0xa0, 0xb0, 0xa1, 0x0a, 0xee, 0xfc, 0xd9, 0x8d, 0x87,
+    0x6d, 0x95, 0x36, 0xb8, 0x23, 0x71, 0x58, 0xf7, 0xe8, 0xe2, 0xdf, 0x32, 0x55, 0x27, 0xf9, 0xc8,
+    0x8a, 0xce, 0x54, 0xb3, 0x0b, 0x74, 0x63, 0xe8, 0x77, 0xd4, 0x7f, 0x6d, 0x9c, 0xc6, 0x53, 0xee,
+    0x48, 0xc4, 0x0a, 0x66, 0x41, 0x8a, 0x8e, 0x33, 0x2a, 0xde, 0x31, 0xe7, 0x2c, 0x76, 0x7e, 0xf0,
+    0xe1, 0x98, 0xea, 0xa4, 0xd9, 0xef, 0xb2, 0x3e, 0xe9, 0x76, 0xda, 0xe8, 0x03, 0xd0, 0x70, 0xe0,
+    0xcf, 0x2f, 0x03, 0xae, 0xc7, 0x38, 0xf3, 0x08, 0xf4, 0xa6, 0xd9, 0x82, 0xed, 0x04, 0xa0, 0x23,
+    0x0a, 0x9d, 0x09, 0x16, 0x84, 0xa8, 0x26, 0x6e, 0x38, 0xf4, 0x97, 0x27, 0x16, 0x73, 0x81, 0x06,
+    0x97, 0x7b, 0x0b, 0x98, 0xa5, 0x4c, 0x63, 0x01, 0xb1, 0x85, 0x4d, 0x70, 0xa0, 0x6a, 0x3e, 0x27,
+    0x78, 0xfe, 0xee, 0x29, 0xfa, 0x25, 0xf0, 0x92, 0xdb, 0x33, 0x03, 0xce, 0x85, 0x12, 0xb2, 0x18,
+    0x23, 0x36, 0x88, 0xb8, 0x96, 0x2c, 0xcf, 0x13, 0xc6, 0x28, 0x77, 0xaa, 0x4a, 0x31, 0xc6, 0xa6,
+    0x74, 0x60, 0x79, 0xb7, 0xfd, 0x0b, 0x0f, 0x4d, 0x38, 0x15, 0x8d, 0xda, 0x99, 0x83, 0x00, 0x37,
+    0x04, 0x0a, 0x48, 0xb1, 0xce, 0xf3, 0xfb, 0x64, 0x17, 0xb9, 0x85, 0xc7, 0xf7, 0x0d, 0x67, 0x7e,
+    0x9e, 0x62, 0xec, 0x63, 0x66, 0x23, 0x21, 0x0e, 0xcb, 0x0f, 0x15, 0x49, 0xd6, 0x52, 0xe8, 0x2a,
+    0x99, 0x0e, 0xef, 0xba, 0x68, 0xf3, 0x44, 0x24, 0xc3, 0x21, 0x88, 0x53, 0xb6, 0xcd, 0xd6, 0xf6,
+    0xb0, 0x10, 0x33, 0x1e, 0x6d, 0x07, 0x2d, 0x9b, 0xc7, 0x6d, 0x0e, 0x88, 0xcd, 0x4d, 0x38, 0x9c,
+    0x53, 0x81, 0xcd, 0x7c, 0x13, 0x41, 0x89, 0xb2, 0xd8, 0x50, 0x72, 0xf6, 0x83, 0x8a, 0x69, 0x1f,
+    0x92, 0x35, 0x26, 0xf0, 0x47, 0x1a, 0x78, 0x25, 0x08, 0xae, 0xd7, 0xf7, 0x27, 0x13, 0xb5, 0xf2,
+    0x93, 0x32, 0x12, 0xb0, 0xd9, 0x9a, 0x64, 0x85, 0x3c, 0xcf, 0xcf, 0x19, 0xa5, 0xf8, 0x24, 0x50,
+    0x0a, 0x15, 0x9f, 0xd8, 0xa1, 0x32, 0x8f, 0x6e, 0xc8, 0xd4, 0x86, 0x3f, 0x1d, 0xee, 0x16, 0x7e,
+    0xee, 0xc7, 0xf0, 0x2b, 0x49, 0x03, 0x7f, 0xe2, 0x44, 0x17, 0x30, 0xa7, 0x59, 0xf4, 0x19, 0xa8,
+    0x9c, 0xb6, 0x23, 0x60, 0x44, 0x9f, 0xac, 0x79, 0x1e, 0x8f, 0xa3, 0x65, 0x46, 0x1f, 0x72, 0xe5,
+    0x28, 0xa0, 0x67, 0xdb, 0xc4, 0xea, 0xbc, 0xd1, 0xad, 0x53, 0xa6, 0x47, 0x0c, 0xab, 0x84, 0xa7,
+    0xce, 0xb0, 0xdd, 0x6d, 0x37, 0x47, 0xed, 0xd6, 0x99, 0xf3, 0x4f, 0xe7, 0x7f, 0xfe, 0xeb, 0xbf,
+    0xff, 0xe7, 0xbf, 0xfe, 0x9f, 0xd3, 0x6b, 0xfc, 0x0c, 0x3f, 0x86, 0x27, 0x8d, 0x66, 0x1b, 0x3f,
+    0xc3, 0xdf, 0xed, 0xde, 0xa8, 0x3d, 0x70, 0xda, 0xbf, 0xb4, 0x9b, 0x78, 0x6f, 0xd6, 0x38, 0x70,
+    0x0e, 0xbb, 0x9d, 0x13, 0xd7, 0x8a, 0x8b, 0x86, 0xeb, 0xae, 0x86, 0x81, 0xe1, 0x7c, 0xb1, 0x4c,
+    0x37, 0xf4, 0xf1, 0x7a, 0x4a, 0x8d, 0x74, 0x8b, 0x3c, 0x15, 0x59, 0x1c, 0xaf, 0xc7, 0x57, 0xc8,
+    0x56, 0xdd, 0xaa, 0xc3, 0x2e, 0x05, 0x3c, 0xab, 0x3d, 0x0b, 0x15, 0x14, 0x3c, 0x04, 0xa8, 0x0f,
+    0xd2, 0xed, 0xd1, 0x26, 0xa5, 0xfc, 0xfc, 0xb8, 0x73, 0x06, 0xb4, 0x6d, 0x14, 0xd4, 0x79, 0x60,
+    0x94, 0xaa, 0xef, 0xe3, 0xc7, 0x9c, 0x9a, 0x9e, 0xf9, 0xea, 0x51, 0xcc, 0x81, 0x2d, 0x98, 0xc5,
+    0x5f, 0x2c, 0xa6, 0x77, 0x00, 0xa3, 0x24, 0x18, 0xf3, 0x88, 0x30, 0xa2, 0x72, 0xea, 0x6e, 0xb7,
+    0xa8, 0x37, 0xd2, 0x03, 0xac, 0x9a, 0x3e, 0x9b, 0x29, 0xbb, 0xa9, 0xcf, 0x8c, 0x12, 0xf7, 0x16,
+    0x4f, 0xa6, 0xf7, 0x4a, 0xc4, 0x97, 0xe6, 0x05, 0x63, 0x09, 0x15, 0x93, 0x22, 0xbb, 0xe5, 0xdb,
+    0xae, 0xea, 0xd1, 0x68, 0xc6, 0x97, 0xd9, 0x23, 0x75, 0x34, 0xa7, 0x4c, 0x4b, 0xd8, 0x19, 0xaf,
+    0x6a, 0x1a, 0x02, 0x57, 0xfa, 0x31, 0xa9, 0xbd, 0x99, 0x97, 0x53, 0x6b, 0xb9, 0x54, 0xa9, 0x5a,
+    0x67, 0xd9, 0x8a, 0x55, 0x58, 0x8e, 0xa7, 0x51, 0x12, 0x68, 0xc0, 0x8c, 0x69, 0x1f, 0x37, 0xf4,
+    0xc1, 0xb2, 0xcd, 0x7d, 0x6d, 0x3f, 0x2c, 0xdb, 0xd6, 0x71, 0x70, 0x5a, 0x02, 0x5d, 0x24, 0x9c,
+    0x2d, 0xd5, 0x77, 0x57, 0x6c, 0x8d, 0x8e, 0xf8, 0xbc, 0x2b, 0xb1, 0x62, 0x95, 0xdb, 0x96, 0x05,
+    0x1c, 0x6a, 0x22, 0xc7, 0x22, 0x98, 0x73, 0xe8, 0x8d, 0xfc, 0x73, 0x0d, 0x11, 0x9f, 0xaa, 0x0e,
+    0xcb, 0x5a, 0x60, 0x9c, 0x74, 0x35, 0x73, 0x1b, 0xa7, 0xa3, 0x23, 0xe7, 0xa0, 0xdb, 0x6f, 0xbe,
+    0x6b, 0xb7, 0xea, 0xce, 0xbb, 0xf6, 0x07, 0x87, 0xbb, 0x1e, 0x3b, 0x5b, 0x4e, 0xb3, 0xdb, 0x69,
+    0xbe, 0x73, 0x86, 0xa3, 0xc6, 0xe8, 0x74, 0xe8, 0x8c, 0xfa, 0x4e, 0xb3, 0xdf, 0x3b, 0xec, 0xbc,
+    0x3d, 0x1d, 0xb4, 0xdd, 0x52, 0x6b, 0x39, 0xf7, 0x98, 0x8a, 0xc9, 0x52, 0x7e, 0x95, 0xa6, 0x8b,
+    0xa4, 0xbe, 0xbd, 0x0d, 0x93, 0xd8, 0x02, 0x12, 0xc5, 0xf8, 0x98, 0x79, 0xf0, 0xb9, 0x16, 0xc5,
+    0x97, 0xdb, 0xfb, 0x20, 0x8e, 0xcc, 0xc2, 0xf4, 0xd9, 0x75, 0x70, 0x57, 0x14, 0xee, 0xa4, 0x2d,
+    0x80, 0x13, 0x4a, 0x38, 0x87, 0xe3, 0xbc, 0x86, 0xcb, 0x66, 0x01, 0x73, 0xee, 0xa7, 0xf3, 0xa9,
+    0x3f, 0x97, 0x6c, 0xce, 0x5c, 0x1b, 0x32, 0xd8, 0xfe, 0x49, 0xbb, 0xd7, 0x6e, 0x99, 0x4a, 0x36,
+    0x8b, 0x27, 0xe1, 0xb0, 0x6b, 0x50, 0x99, 0xe7, 0xd3, 0x3f, 0x2a, 0x10, 0x59, 0x09, 0x93, 0x53,
+    0x7c, 0xa8, 0xa8, 0xdd, 0x70, 0x99, 0xc0, 0xd7, 0xc0, 0x90, 0xc3, 0x6b, 0xde, 0xb9, 0xcd, 0xa1,
+    0x2e, 0x98, 0x27, 0xcb, 0x58, 0xd4, 0xc6, 0x08, 0x55, 0x6f, 0xc1, 0xa2, 0x88, 0x9b, 0x78, 0xb6,
+    0xa8, 0xf3, 0x51, 0xcb, 0x9d, 0xd7, 0x7b, 0xce, 0x0e, 0x0a, 0x6b, 0x66, 0x68, 0xab, 0xe4, 0x37,
+    0xd9, 0xfd, 0xaa, 0xc4, 0x5d, 0x40, 0x34, 0x79, 0x8f, 0x9c, 0xe7, 0x63, 0x19, 0x2d, 0x88, 0xaa,
+    0x72, 0xe1, 0x38, 0x90, 0x5a, 0xb8, 0x88, 0xa3, 0x71, 0x80, 0xc6, 0x9e, 0x3c, 0x3f, 0x52, 0x63,
+    0x6c, 0xf5, 0xb8, 0x2c, 0xd3, 0xad, 0xdb, 0x6d, 0x0c, 0x87, 0xa7, 0xc7, 0x6c, 0x73, 0xb4, 0xc8,
+    0x86, 0x15, 0x03, 0x59, 0xb6, 0xba, 0xee, 0x9c, 0x0c, 0xfa, 0xcd, 0x76, 0xbb, 0xe5, 0x34, 0x7a,
+    0x1f, 0xde, 0x37, 0x3e, 0xb8, 0x56, 0x06, 0x9f, 0x03, 0x8c, 0xf4, 0x72, 0xd5, 0xe7, 0x25, 0xe3,
+    0x7f, 0x75, 0x76, 0xc6, 0x2d, 0x48, 0xf6, 0xbb, 0x72, 0x11, 0x4a, 0xa3, 0x6c, 0x97, 0x1a, 0x33,
+    0xad, 0x9f, 0xbb, 0x46, 0x34, 0x75, 0x91, 0x43, 0xa4, 0x12, 0x11, 0xcd, 0xf6, 0x0c, 0xe3, 0x10,
+    0x71, 0xdd, 0x54, 0xaa, 0xba, 0x00, 0x68, 0x81, 0xd2, 0x6a, 0x5d, 0x59, 0x9e, 0x77, 0x18, 0xb0,
+    0xf5, 0xc3, 0xbf, 0xe4, 0x5a, 0xd9, 0xbd, 0x08, 0x94, 0x80, 0xa1, 0xbf, 0x9d, 0xb6, 0x4f, 0xdb,
+    0x0e, 0x46, 0x31, 0x38, 0x87, 0x8d, 0x4e, 0x17, 0x19, 0x0a, 0xd9, 0x56, 0x82, 0x64, 0x1c, 0x87,
+    0xe7, 0x01, 0x0b, 0x96, 0xcb, 0xe2, 0x6b, 0x2d, 0x97, 0x9a, 0xf6, 0x08, 0xf3, 0x42, 0xf7, 0x04,
+    0x90, 0x55, 0x40, 0xd3, 0xf0, 0x54, 0xcf, 0x04, 0xab, 0x33, 0x5f, 0xc1, 0x45, 0xee, 0x3a, 0xae,
+    0x7b, 0xe2, 0xbe, 0x5b, 0x97, 0xcb, 0x50, 0x8b, 0x5a, 0xb4, 0x6f, 0x41, 0x52, 0x4a, 0x90, 0x6b,
+    0xa8, 0x46, 0x47, 0x6e, 0xa6, 0x88, 0x52, 0x61, 0x55, 0xd4, 0xb4, 0xab, 0x9a, 0x81, 0x4e, 0x58,
+    0x0f, 0xa4, 0x4b, 0x10, 0x91, 0xa8, 0xae, 0xa6, 0xa0, 0xc1, 0x37, 0xb4, 0xfc, 0x33, 0xd5, 0x47,
+    0xf3, 0x1e, 0xf7, 0xe3, 0x24, 0x38, 0x5d, 0x4c, 0x29, 0x92, 0x0e, 0xf5, 0x9e, 0xc4, 0x4b, 0x29,
+    0x48, 0x56, 0x9d, 0x41, 0x44, 0xc2, 0xa1, 0x4c, 0x89, 0xc0, 0x51, 0x0b, 0xaa, 0xd5, 0xe0, 0xf0,
+    0x0b, 0x53, 0x6f, 0xfb, 0xd7, 0x78, 0xff, 0xd7, 0xf9, 0x76, 0x45, 0xde, 0x5c, 0x32, 0x97, 0xf3,
+    0xbc, 0x88, 0x87, 0x21, 0x38, 0x33, 0x6e, 0xf2, 0x05, 0x41, 0xd9, 0x8c, 0xc8, 0x41, 0x24, 0xe7,
+    0x55, 0x2a, 0x38, 0x28, 0xa9, 0x0e, 0xa2, 0xc0, 0x2a, 0x11, 0x40, 0xa5, 0x92, 0xf5, 0x1c, 0x24,
+    0x49, 0x38, 0xf9, 0x57, 0x2f, 0xe8, 0xa9, 0x5c, 0x91, 0xdd, 0x19, 0xe7, 0x1c, 0x27, 0x89, 0xb3,
+    0x41, 0x3b, 0x2d, 0xc6, 0x3e, 0xd2, 0xac, 0x8d, 0x65, 0x8b, 0xce, 0xa8, 0xb2, 0x12, 0x77, 0xf9,
+    0xe2, 0x65, 0x06, 0x28, 0xfa, 0xb6, 0x09, 0x98, 0x34, 0x49, 0xf7, 0xd8, 0x5f, 0x94, 0x02, 0xea,
+    0x98, 0xc5, 0x45, 0xfe, 0x0e, 0x80, 0xc2, 0xb3, 0x81, 0xff, 0x59, 0xa3, 0x90, 0x5c, 0x6e, 0xdb,
+    0xfe, 0x0f, 0xb4, 0x26, 0x98, 0x30, 0x54, 0x50, 0x46, 0xab, 0xfc, 0xfe, 0xa4, 0xf1, 0xbd, 0x5b,
+    0xb1, 0xc7, 0xb3, 0x21, 0x15, 0x35, 0xa3, 0x69, 0xc4, 0x4e, 0x14, 0xd6, 0x56, 0xa3, 0xac, 0xba,
+    0x6b, 0x09, 0x99, 0xcf, 0x5a, 0xbd, 0x26, 0x0f, 0x03, 0x73, 0x26, 0x8a, 0xed, 0xd9, 0x4f, 0xae,
+    0x94, 0xae, 0x35, 0x42, 0x94, 0xbd, 0x54, 0x6c, 0x2d, 0x61, 0x43, 0x12, 0x6b, 0xcb, 0x6c, 0x70,
+    0x0c, 0x9b, 0xb7, 0xc7, 0xc2, 0x09, 0x4b, 0x0d, 0xc5, 0xc9, 0xe0, 0x1c, 0xf8, 0x1e, 0xb9, 0xdf,
+    0xdb, 0x96, 0x43, 0x15, 0x15, 0x4c, 0xfa, 0xb3, 0xcd, 0xdb, 0xa6, 0x14, 0x43, 0xa9, 0x87, 0x8f,
+    0xaf, 0xce, 0x78, 0x7c, 0xdd, 0x6e, 0xae, 0x75, 0x0e, 0x61, 0x5f, 0x13, 0xbe, 0xda, 0x00, 0xa7,
+    0xf8, 0x0f, 0x41, 0xfd, 0xa3, 0xe0, 0x96, 0x74, 0x69, 0xec, 0xff, 0x47, 0xde, 0x7f, 0x59, 0x7d,
+    0x94, 0xe5, 0x03, 0x14, 0xf8, 0xa0, 0x21, 0x08, 0x9c, 0x2d, 0x8f, 0x77, 0x62, 0x99, 0x13, 0x12,
+    0x0b, 0x9c, 0xcf, 0x6c, 0x5e, 0x55, 0xe7, 0x8b, 0xc3, 0xfe, 0x25, 0xc0, 0x97, 0x3b, 0x06, 0x99,
+    0xd3, 0xbe, 0xcf, 0xa9, 0xaf, 0x31, 0x79, 0xb1, 0x88, 0xcd, 0x0b, 0xad, 0xd8, 0x94, 0x61, 0xe0,
+    0x5a, 0xc8, 0xc7, 0xb4, 0x59, 0xec, 0x58, 0x88, 0x67, 0xd4, 0x14, 0x7e, 0x50, 0xe9, 0xc3, 0x78,
+    0x8a, 0x8e, 0x91, 0xac, 0xa3, 0x32, 0x3e, 0x63, 0xdf, 0x36, 0x0d, 0xfc, 0xf9, 0x9e, 0xd9, 0xac,
+    0x01, 0x5b, 0x19, 0xce, 0xe7, 0x71, 0x76, 0x0d, 0x8c, 0xb7, 0x23, 0xfb, 0x3a, 0x5b, 0xb8, 0x8a,
+    0xff, 0xe9, 0xe8, 0x72, 0x15, 0xdc, 0x6a, 0xba, 0x0e, 0xfc, 0x46, 0x50, 0xc3, 0x3f, 0x19, 0x08,
+    0x5e, 0x1a, 0x25, 0x7f, 0x82, 0x92, 0xa7, 0x7b, 0x0a, 0x27, 0xd0, 0x92, 0x1e, 0x30, 0xbe, 0x29,
+    0x4a, 0x64, 0x4e, 0x8f, 0x90, 0x65, 0xf3, 0x08, 0xa1, 0xbf, 0xac, 0x2b, 0xfc, 0xfd, 0x7c, 0xcf,
+    0x79, 0x99, 0xd7, 0x0e, 0xcf, 0xef, 0x52, 0x66, 0x71, 0x02, 0x66, 0xdd, 0x01, 0x15, 0x06, 0xdb,
+    0x30, 0x08, 0x79, 0x61, 0x15, 0x1a, 0x54, 0x9d, 0x17, 0x7f, 0x36, 0x36, 0x2e, 0x4c, 0x7a, 0x7e,
+    0xcf, 0xc3, 0x86, 0x95, 0xdc, 0xc4, 0xe4, 0xe6, 0x52, 0xb7, 0x6c, 0xee, 0xf9, 0x34, 0x05, 0xb2,
+    0xc6, 0x6b, 0xe7, 0x15, 0x2d, 0x9a, 0x7e, 0xbc, 0x01, 0x1c, 0xc8, 0xb1, 0x08, 0x5c, 0x25, 0xde,
+    0x14, 0xd7, 0xf2, 0x4e, 0x13, 0xd6, 0x8a, 0xec, 0x66, 0xad, 0x76, 0x01, 0x2a, 0x68, 0xf3, 0xca,
+    0x8f, 0x9b, 0xb0, 0x05, 0x6c, 0xaa, 0xb9, 0xa0, 0x5c, 0x63, 0xf3, 0x24, 0x0e, 0xe4, 0x05, 0x37,
+    0x43, 0x84, 0xd5, 0x4e, 0xaf, 0x8f, 0x64, 0x2d, 0xad, 0x3a, 0x4b, 0x2e, 0x0f, 0xe0, 0x5d, 0x46,
+    0x95, 0xeb, 0x1d, 0x09, 0xfe, 0x38, 0x93, 0xd2, 0x2d, 0x57, 0x8b, 0x6b, 0x20, 0x44, 0x7a, 0x1f,
+    0x35, 0xdf, 0x31, 0x94, 0x0a, 0xf5, 0x84, 0x57, 0x95, 0xaa, 0x9e, 0x9a, 0x84, 0x45, 0x76, 0x63,
+    0x7f, 0x9e, 0x9e, 0xdc, 0x8a, 0xe9, 0xa9, 0xf8, 0x2f, 0xfc, 0xf3, 0x49, 0xcc, 0xa2, 0x96, 0xde,
+    0xa6, 0xee, 0x03, 0xfb, 0xe0, 0x73, 0x67, 0x5d, 0x50, 0x0f, 0x67, 0xda, 0x7d, 0x92, 0x18, 0x03,
+    0xc4, 0x1a, 0x81, 0x38, 0x86, 0x30, 0xa4, 0xc2, 0xa2, 0x92, 0x57, 0xe7, 0x50, 0x0e, 0x10, 0x2d,
+    0x73, 0xf2, 0x81, 0x02, 0x39, 0xad, 0xe9, 0xdf, 0x95, 0x8c, 0x4a, 0x12, 0xdf, 0x15, 0xdb, 0x75,
+    0x74, 0xc1, 0xdc, 0x2a, 0x55, 0xfc, 0x91, 0x5e, 0x35, 0x22, 0x9d, 0x84, 0x30, 0xf5, 0xdb, 0x31,
+    0xf2, 0xa9, 0x34, 0xdd, 0x53, 0xa4, 0x88, 0xfc, 0xa5, 0x5f, 0xb4, 0x6b, 0x37, 0xe1, 0x63, 0x7f,
+    0x81, 0x12, 0x40, 0xbe, 0x3f, 0xa4, 0x44, 0x9e, 0x27, 0xc5, 0x10, 0xbe, 0x33, 0xa7, 0x0c, 0x83,
+    0x1e, 0xa0, 0xb6, 0xd2, 0xf7, 0xa7, 0xab, 0x04, 0x7b, 0xe6, 0x7d, 0xd0, 0x47, 0x8d, 0xa5, 0x52,
+    0x09, 0xe7, 0x13, 0x5b, 0xce, 0xab, 0x8a, 0x95, 0x3d, 0xb3, 0x50, 0x79, 0x83, 0x43, 0x63, 0xcb,
+    0x5c, 0x75, 0xa9, 0x68, 0x67, 0x5b, 0x84, 0x26, 0x2b, 0x4f, 0x74, 0x53, 0x29, 0x60, 0xca, 0x1e,
+    0x77, 0xf0, 0x0e, 0xfc, 0xc9, 0x91, 0xc8, 0xc9, 0x46, 0xfc, 0x8e, 0x46, 0xa1, 0x9b, 0x19, 0xa1,
+    0x1b, 0xef, 0xf3, 0xbe, 0x6b, 0xd4, 0xd4, 0x70, 0x11, 0xd2, 0x38, 0xb5, 0xd9, 0x80, 0x8a, 0xeb,
+    0x1a, 0x8f, 0x21, 0x4f, 0x2c, 0x9e, 0x79, 0x05, 0x23, 0xd1, 0x9b, 0x8d, 0xae, 0x6b, 0x39, 0x5e,
+    0x10, 0x00, 0xcf, 0x9e, 0x39, 0xc2, 0x42, 0x97, 0xb5, 0x68, 0x0e, 0x1a, 0x68, 0x42, 0x52, 0xda,
+    0xc8, 0x3b, 0x21, 0xb5, 0xa1, 0x82, 0xeb, 0x74, 0x6b, 0x21, 0xc1, 0xa1, 0xf6, 0x75, 0x7a, 0xc2,
+    0x23, 0xe1, 0x77, 0x75, 0xc5, 0x90, 0x7b, 0x0f, 0x1b, 0xce, 0xc9, 0x98, 0x13, 0xce, 0x48, 0x6e,
+    0x97, 0xbb, 0x3a, 0xaa, 0xe6, 0xfc, 0xde, 0xea, 0x45, 0x1f, 0xc5, 0x8c, 0xf4, 0x52, 0x2c, 0xac,
+    0xb3, 0x3d, 0xa2, 0x08, 0x8a, 0x7e, 0xaf, 0x71, 0xdc, 0x76, 0x0e, 0x06, 0x7d, 0xb7, 0x6a, 0x4c,
+    0x27, 0x49, 0x8c, 0x96, 0xb4, 0xac, 0x8c, 0x57, 0x6a, 0x36, 0x22, 0xb6, 0x2c, 0x74, 0xe1, 0xf6,
+    0x3c, 0x1f, 0x70, 0x90, 0x6c, 0xec, 0x3e, 0x23, 0x92, 0x29, 0x05, 0x9b, 0xa1, 0x2d, 0xcc, 0x8f,
+    0x81, 0xe5, 0x72, 0x47, 0x40, 0xed, 0x88, 0xa4, 0xe6, 0xc5, 0x0c, 0x56, 0xd1, 0xe0, 0x57, 0xb2,
+    0xd8, 0x75, 0xb9, 0xaa, 0xcc, 0x0a, 0xb8, 0x36, 0x33, 0xc4, 0x59, 0xb0, 0xff, 0x1a, 0xdc, 0x74,
+    0x33, 0x56, 0xc8, 0xf4, 0xdc, 0x42, 0x4e, 0xf8, 0x87, 0x64, 0x67, 0xb4, 0xea, 0xda, 0x38, 0xf9,
+    0x6c, 0xe7, 0x69, 0x82, 0x46, 0xe9, 0x4e, 0x34, 0x4b, 0xb7, 0x58, 0x72, 0xf1, 0xc9, 0x59, 0x85,
+    0xa0, 0x14, 0xcf, 0x24, 0x27, 0x66, 0x09, 0x81, 0xd9, 0x99, 0x1f, 0x54, 0x57, 0xd2, 0x7d, 0x85,
+    0xc2, 0x90, 0x0b, 0x98, 0xc4, 0x2e, 0x6e, 0x6b, 0x49, 0x27, 0x61, 0x38, 0x41, 0x37, 0x5c, 0x84,
+    0x4f, 0xbd, 0x20, 0xbd, 0x81, 0xad, 0x4d, 0x54, 0x03, 0x8a, 0x49, 0xa0, 0x0e, 0xf3, 0x92, 0x37,
+    0xc9, 0x8c, 0xba, 0xac, 0x8a, 0xd9, 0xff, 0x3e, 0x84, 0x60, 0xe7, 0xa3, 0xbd, 0x9c, 0xbd, 0x86,
+    0x6f, 0x42, 0x01, 0x1f, 0x11, 0x6d, 0xb0, 0x80, 0x70, 0x57, 0x0b, 0x4c, 0x64, 0xde, 0x28, 0x8a,
+    0x8d, 0x49, 0x21, 0x05, 0x05, 0x4a, 0x4c, 0x5d, 0x26, 0x6d, 0xdd, 0xea, 0xbf, 0xc5, 0x43, 0xfe,
+    0xad, 0x8a, 0x3a, 0xe8, 0x25, 0xde, 0x14, 0x41, 0x32, 0xe5, 0x52, 0x95, 0xe1, 0x9e, 0x86, 0x4d,
+    0xf7, 0x55, 0x2d, 0x9d, 0x73, 0x77, 0xdd, 0x66, 0x85, 0x70, 0x6f, 0xa2, 0x63, 0xe1, 0x61, 0x14,
+    0x7b, 0x3c, 0x51, 0x95, 0x1a, 0xbd, 0x9d, 0x25, 0xde, 0x92, 0xec, 0x3c, 0x9b, 0x2b, 0xfb, 0xba,
+    0x35, 0x8e, 0x7d, 0x8c, 0xb8, 0x53, 0xee, 0x4c, 0xd4, 0x66, 0x12, 0xaf, 0x72, 0xed, 0xa2, 0xeb,
+    0x82, 0x26, 0x0c, 0xfb, 0x72, 0xf5, 0x69, 0xd3, 0x5d, 0x6d, 0x95, 0xe2, 0x13, 0x02, 0xda, 0xb5,
+    0x25, 0x82, 0x28, 0x90, 0x28, 0x57, 0x45, 0x2a, 0x08, 0x0b, 0xab, 0x11, 0xe0, 0x6a, 0x6a, 0x6a,
+    0x54, 0x2c, 0xea, 0x72, 0x49, 0x61, 0x8d, 0x98, 0x05, 0xee, 0xc9, 0x49, 0x18, 0xba, 0x85, 0x79,
+    0xc3, 0x30, 0x97, 0x0c, 0xfb, 0x35, 0x09, 0x67, 0xdf, 0xbd, 0xc1, 0x4a, 0x6f, 0xb6, 0xb6, 0x98,
+    0xe3, 0x66, 0xf9, 0x0f, 0xbd, 0x2f, 0x06, 0x8d, 0xef, 0xde, 0xb4, 0x8f, 0x4f, 0x46, 0x1f, 0x78,
+    0x25, 0xd3, 0x2f, 0x34, 0x7f, 0x39, 0x63, 0x89, 0x62, 0x90, 0x6b, 0x92, 0x01, 0x34, 0xe4, 0xbb,
+    0x90, 0xb7, 0x07, 0xc1, 0x7c, 0x85, 0x1b, 0x73, 0x7e, 0x07, 0x29, 0x58, 0x40, 0xae, 0xcb, 0x35,
+    0xc4, 0x0b, 0x35, 0x12, 0xc1, 0x40, 0x44, 0xa5, 0xbf, 0x22, 0xf9, 0x85, 0xaa, 0xd0, 0xdf, 0xfb,
+    0xca, 0xdf, 0x75, 0x0a, 0x10, 0x5f, 0xe1, 0x41, 0xab, 0xc1, 0x9d, 0xac, 0xd1, 0xb0, 0x08, 0x72,
+    0x81, 0xa6, 0x48, 0x56, 0xe6, 0xf3, 0x6b, 0xba, 0xf8, 0x4a, 0x07, 0x94, 0x62, 0xcf, 0xe3, 0xaf,
+    0x71, 0x0d, 0xb6, 0xb6, 0x25, 0x43, 0xe0, 0xe6, 0x6d, 0x11, 0x12, 0x1b, 0x78, 0x23, 0xab, 0xa8,
+    0xe3, 0xa8, 0x8e, 0xe2, 0x6f, 0xe4, 0x89, 0xc3, 0x3f, 0x3e, 0x9a, 0x9b, 0xb1, 0x85, 0x4e, 0x8b,
+    0x04, 0x93, 0x95, 0x94, 0x2a, 0x1b, 0xae, 0x45, 0xab, 0xb2, 0xf6, 0xd7, 0x50, 0x2b, 0x25, 0x71,
+    0x5a, 0x9b, 0x5e, 0xbf, 0x15, 0x89, 0x66, 0x4b, 0xf9, 0xe3, 0x11, 0x29, 0x97, 0x14, 0x38, 0x09,
+    0xd0, 0x0f, 0x35, 0x0e, 0x5d, 0x0a, 0x57, 0xf2, 0x13, 0x5e, 0x62, 0x93, 0x18, 0xb2, 0x8f, 0x33,
+    0xe0, 0xae, 0xbb, 0xb2, 0x4a, 0x65, 0x7d, 0x8a, 0x46, 0xa8, 0xfc, 0x41, 0x69, 0x9a, 0x56, 0xf2,
+    0xbf, 0x86, 0x2e, 0xc3, 0x84, 0x68, 0xb2, 0xe5, 0xa7, 0x3e, 0x65, 0x1a, 0xa2, 0x44, 0x42, 0x7a,
+    0x22, 0xa7, 0xe2, 0xbb, 0x00, 0xdb, 0x85, 0x89, 0x7a, 0x75, 0x57, 0x64, 0xee, 0x57, 0xee, 0x06,
+    0xd6, 0xa9, 0x7e, 0xdc, 0x68, 0x56, 0x99, 0x03, 0xbd, 0xed, 0xeb, 0x01, 0x0a, 0x77, 0x55, 0x7b,
+    0x8f, 0xda, 0x95, 0x6f, 0x5e, 0x46, 0x2c, 0x12, 0x6e, 0xcb, 0x42, 0xbb, 0x83, 0x64, 0x51, 0x10,
+    0xdd, 0x2d, 0x7c, 0x0d, 0xf7, 0x2f, 0x4a, 0x73, 0xb8, 0xe6, 0x42, 0xbf, 0xa1, 0x47, 0x25, 0xfa,
+    0x1b, 0x69, 0xc3, 0x56, 0xe3, 0x3c, 0x9a, 0x90, 0x4b, 0x6d, 0xf6, 0x0b, 0x99, 0xe4, 0x80, 0x22,
+    0xbe, 0xed, 0x17, 0x27, 0x9a, 0x78, 0x4a, 0xad, 0x52, 0x25, 0x95, 0xae, 0xaa, 0xfe, 0x0b, 0x7f,
+    0xb8, 0x1d, 0xfd, 0xd3, 0x5a, 0x37, 0x47, 0xdc, 0x8e, 0x69, 0xc1, 0xa2, 0x0a, 0xeb, 0xf7, 0xf9,
+    0xf3, 0xdd, 0x9c, 0xad, 0x9e, 0x2f, 0x95, 0xbe, 0x17, 0xdb, 0xe8, 0x63, 0x5a, 0x1c, 0xb3, 0x62,
+    0x98, 0x4b, 0xce, 0xdb, 0xa6, 0x99, 0x91, 0x38, 0xe6, 0x17, 0x60, 0x28, 0x83, 0xb7, 0x58, 0x89,
+    0x5a, 0x95, 0x56, 0xeb, 0xc7, 0xf1, 0x9d, 0x11, 0x77, 0x56, 0x00, 0x85, 0x82, 0xb4, 0xb7, 0xd9,
+    0xa0, 0x5f, 0x1c, 0x72, 0x18, 0xc3, 0x2b, 0x5b, 0x80, 0xc7, 0xbd, 0x02, 0x6e, 0x9c, 0x64, 0x0d,
+    0xff, 0xf1, 0x2c, 0xd7, 0x39, 0x58, 0xbb, 0xe2, 0x9c, 0xc3, 0xe7, 0x6b, 0xe3, 0x5a, 0x88, 0xe6,
+    0xf6, 0x5c, 0xdc, 0x90, 0xc4, 0x35, 0xf6, 0xaf, 0xc7, 0x47, 0xf9, 0xc2, 0x73, 0x77, 0xb3, 0x20,
+    0xe9, 0x1c, 0x58, 0x33, 0x75, 0x02, 0xd9, 0x32, 0xf5, 0x65, 0xec, 0x9f, 0x6d, 0x34, 0x46, 0xd8,
+    0x49, 0x6d, 0x11, 0x61, 0xaa, 0x54, 0xcb, 0xf5, 0x0d, 0xfb, 0xfc, 0xf5, 0x3b, 0xaf, 0xa7, 0xd4,
+    0x65, 0x83, 0xa3, 0xcf, 0xa0, 0xd1, 0x05, 0x7d, 0x50, 0xfa, 0x78, 0x52, 0x8c, 0x35, 0xa5, 0x17,
+    0xf8, 0x92, 0x90, 0x8c, 0x1b, 0x7c, 0xf2, 0xf7, 0x6c, 0x4c, 0xa7, 0x5e, 0x89, 0x5f, 0x6f, 0x16,
+    0x5b, 0x7b, 0xb6, 0x79, 0xc0, 0xaf, 0x1a, 0x82, 0x28, 0xdc, 0x7c, 0x4b, 0x9d, 0x6c, 0xb5, 0x2c,
+    0x6a, 0xe4, 0x66, 0x9b, 0x8d, 0x5f, 0xe2, 0x6a, 0xab, 0x55, 0xca, 0xfb, 0x37, 0xf1, 0x7c, 0xb9,
+    0x19, 0x6c, 0x30, 0x6e, 0x23, 0x42, 0x17, 0x63, 0xf6, 0x1d, 0xe7, 0x19, 0xce, 0xb9, 0x7f, 0x1d,
+    0x79, 0x3f, 0x6a, 0xa9, 0x66, 0xb0, 0xef, 0x91, 0xaf, 0xe5, 0xd1, 0x63, 0x85, 0x5c, 0x30, 0x83,
+    0x63, 0xdc, 0xfe, 0xa1, 0x96, 0xfa, 0x97, 0xa4, 0x33, 0x67, 0x32, 0x86, 0x70, 0xa7, 0xe2, 0x3d,
+    0xa2, 0x58, 0xd2, 0xe9, 0x9d, 0x9c, 0x8e, 0xc8, 0xb3, 0xc8, 0xf8, 0x30, 0x6a, 0xff, 0x32, 0x6a,
+    0x0c, 0xda, 0x0d, 0xd7, 0x96, 0xee, 0x08, 0xb3, 0xe0, 0x1f, 0xaf, 0x72, 0x08, 0x94, 0x95, 0x54,
+    0x59, 0x31, 0x6b, 0x09, 0x28, 0x27, 0x7f, 0x98, 0x7e, 0x81, 0x7b, 0xc2, 0xa3, 0xd1, 0xb4, 0x16,
+    0x05, 0xb5, 0xeb, 0x80, 0x7f, 0x6f, 0xd3, 0x59, 0x9f, 0xf3, 0x49, 0x0a, 0x6a, 0x8b, 0x98, 0x82,
+    0x15, 0x5a, 0x2c, 0x0d, 0x69, 0xee, 0xc6, 0x17, 0xbd, 0xc2, 0xda, 0x62, 0xe0, 0x12, 0x47, 0xd4,
+    0x22, 0xbf, 0x3a, 0x91, 0x6b, 0x6e, 0xd3, 0x7c, 0x74, 0xb2, 0x1d, 0x2c, 0x5c, 0xfc, 0xfd, 0x15,
+    0xeb, 0xa6, 0xb8, 0x8e, 0xac, 0xf4, 0xf0, 0xc5, 0xce, 0xc6, 0xa0, 0x30, 0x73, 0xee, 0xad, 0x07,
+    0x05, 0x36, 0x1d, 0x11, 0x5d, 0x02, 0x8b, 0xd1, 0x26, 0x87, 0x41, 0xff, 0xe6, 0xdc, 0x7a, 0xcb,
+    0xd9, 0xc2, 0x9f, 0xb0, 0x4f, 0x9a, 0x77, 0x41, 0xd9, 0x04, 0xc5, 0x31, 0x3e, 0xe4, 0xc4, 0xea,
+    0xad, 0x4e, 0x10, 0xb0, 0x0e, 0x03, 0x79, 0xc2, 0xd3, 0x38, 0x53, 0xca, 0x08, 0x9c, 0xa2, 0x76,
+    0x81, 0x88, 0x77, 0x13, 0x6e, 0x23, 0x06, 0xd9, 0xf6, 0x74, 0xe1, 0xd6, 0x37, 0x02, 0xa6, 0x0c,
+    0x0a, 0x90, 0xa1, 0x39, 0x86, 0xd3, 0xba, 0xe6, 0xe7, 0x2f, 0x2a, 0xa9, 0x69, 0xf9, 0x2d, 0x91,
+    0x2e, 0x39, 0xfe, 0x63, 0xbf, 0x65, 0x37, 0x4e, 0x30, 0x65, 0x19, 0x2d, 0xcc, 0xdc, 0xfd, 0xb5,
+    0x0b, 0x79, 0xed, 0xe4, 0x33, 0x46, 0x6c, 0x39, 0x2f, 0x56, 0x2e, 0x4e, 0x3d, 0x34, 0x1e, 0x79,
+    0x71, 0x0c, 0x99, 0x36, 0x5b, 0x98, 0x11, 0x1b, 0xa4, 0x4d, 0xb5, 0xea, 0x14, 0xce, 0xc6, 0x3a,
+    0xbe, 0xb3, 0xe1, 0xd8, 0x5a, 0x4c, 0x4b, 0x36, 0x54, 0x55, 0x07, 0xd8, 0x3a, 0x23, 0x8f, 0xfc,
+    0xf3, 0x0d, 0xc7, 0xd6, 0x83, 0xca, 0x8c, 0x74, 0x15, 0x2e, 0xd3, 0x49, 0x07, 0xcc, 0x10, 0xed,
+    0x16, 0xe7, 0x68, 0x29, 0xff, 0x38, 0x70, 0xd7, 0x99, 0xfb, 0x81, 0x3f, 0xbe, 0xa6, 0xd4, 0x13,
+    0x0f, 0x45, 0xc9, 0x55, 0x89, 0x6e, 0x1e, 0x3f, 0xf0, 0x2a, 0x17, 0xf1, 0xa4, 0x6f, 0x9e, 0x12,
+    0x84, 0xb5, 0x01, 0xf6, 0xb6, 0x28, 0x18, 0x68, 0x43, 0x20, 0xb0, 0x08, 0x22, 0x1b, 0x3b, 0x2c,
+    0x1c, 0xc7, 0x37, 0x86, 0xd0, 0x59, 0x37, 0x31, 0x69, 0x4b, 0x50, 0xe0, 0xba, 0x13, 0x62, 0xb8,
+    0x25, 0xa5, 0xb8, 0x8d, 0xa1, 0x70, 0xf8, 0x62, 0x53, 0x44, 0xbe, 0x8a, 0x6e, 0x8e, 0x82, 0xe9,
+    0x62, 0xad, 0xb5, 0x1f, 0xbe, 0x7c, 0x40, 0xef, 0x83, 0x00, 0xad, 0x0d, 0x9a, 0x27, 0x76, 0xf9,
+    0x20, 0xaf, 0x36, 0x1c, 0x84, 0xbf, 0x50, 0xb5, 0x5e, 0xe7, 0x3f, 0x3c, 0x60, 0x05, 0x99, 0x64,
+    0xb3, 0xd6, 0x10, 0x3f, 0x6e, 0x38, 0xc4, 0x38, 0x5a, 0xdc, 0x6d, 0x84, 0x82, 0x87, 0x7f, 0xde,
+    0x70, 0x04, 0x0c, 0x27, 0xdb, 0x6c, 0x84, 0xff, 0xf3, 0x00, 0x30, 0xf5, 0x82, 0x9b, 0xc3, 0x68,
+    0x0a, 0xec, 0x6b, 0x03, 0x58, 0xfd, 0xf4, 0xed, 0x09, 0xf6, 0xf0, 0x2f, 0x9b, 0x9e, 0x2b, 0x71,
+    0x78, 0x79, 0x19, 0xc4, 0xec, 0x8e, 0x56, 0x7f, 0x60, 0x62, 0x05, 0xed, 0xed, 0x3c, 0x00, 0x6a,
+    0x76, 0x61, 0xd1, 0x18, 0x44, 0x57, 0xf3, 0x40, 0x32, 0x16, 0x10, 0x60, 0x17, 0xc8, 0xf9, 0x6b,
+    0x3f, 0x35, 0xab, 0xd9, 0x47, 0x7a, 0xeb, 0x03, 0x8e, 0x93, 0xb3, 0x15, 0xa9, 0xdb, 0xed, 0x71,
+    0x85, 0xf9, 0x38, 0xca, 0xac, 0x97, 0xdb, 0x7c, 0x62, 0xb5, 0xd5, 0x91, 0xa2, 0x65, 0xba, 0x64,
+    0xf1, 0xf1, 0xf3, 0x28, 0x31, 0xb6, 0xaa, 0x83, 0x45, 0xa2, 0x5f, 0xec, 0xf2, 0x8c, 0x6d, 0xd9,
+    0x8d, 0x79, 0x89, 0x17, 0x66, 0x81, 0x73, 0x1f, 0xf5, 0x6a, 0x33, 0xc6, 0x99, 0x58, 0xab, 0x87,
+    0x3c, 0xf2, 0x24, 0x74, 0xf9, 0x5d, 0xd5, 0x03, 0x6b, 0x8b, 0x13, 0x8b, 0x29, 0xd1, 0x0a, 0x2c,
+    0x56, 0xd3, 0x01, 0x2d, 0xf3, 0x6d, 0x7b, 0x34, 0x74, 0x0e, 0x3b, 0x83, 0xe1, 0xc8, 0x5d, 0x57,
+    0xca, 0x9f, 0x25, 0x97, 0x94, 0xd5, 0xf8, 0xf4, 0x5d, 0xdb, 0x11, 0x00, 0x94, 0xa3, 0x62, 0x24,
+    0x28, 0xbe, 0xa9, 0xe3, 0x0d, 0x2b, 0xfb, 0x98, 0xf1, 0xf8, 0xb4, 0xd7, 0xea, 0x53, 0xea, 0xe3,
+    0x41, 0xfb, 0xed, 0x00, 0xc6, 0xaa, 0x29, 0xfa, 0xf0, 0xd3, 0x31, 0x3e, 0x36, 0x12, 0xcf, 0x28,
+    0x09, 0xb7, 0xae, 0xeb, 0x9a, 0xef, 0xb1, 0xc0, 0x60, 0x18, 0x97, 0x65, 0x1d, 0x8e, 0xaf, 0xa2,
+    0x56, 0x93, 0x01, 0x06, 0x0f, 0xb1, 0x5d, 0x62, 0x66, 0xca, 0xf3, 0xe5, 0xf4, 0x9a, 0x6d, 0x02,
+    0x50, 0x82, 0x8e, 0x63, 0x70, 0x58, 0x5f, 0x45, 0x13, 0x10, 0xd4, 0x4e, 0xfa, 0x00, 0x2a, 0xdd,
+    0xcd, 0xe5, 0x8a, 0x4c, 0x5d, 0x09, 0x3e, 0xd3, 0xe8, 0xf2, 0x64, 0x04, 0x5b, 0x98, 0x1e, 0x14,
+    0x73, 0x83, 0x62, 0x88, 0x66, 0x38, 0xf6, 0x71, 0x7f, 0xb7, 0x31, 0x6f, 0xa5, 0x2b, 0x5e, 0x75,
+    0x94, 0xe4, 0x1b, 0x4d, 0xee, 0xea, 0xce, 0x5f, 0x87, 0xfd, 0x5e, 0x8d, 0x89, 0x49, 0xe1, 0xc5,
+    0x1d, 0xc7, 0xb6, 0xa4, 0xce, 0x17, 0x3b, 0xf3, 0x17, 0x2c, 0xb3, 0x5f, 0xc8, 0x71, 0xf7, 0xbe,
+    0x92, 0x43, 0xb2, 0xc2, 0x38, 0x27, 0x32, 0x1d, 0x9a, 0x29, 0x33, 0x75, 0xd0, 0xb6, 0x5b, 0xec,
+    0x05, 0x27, 0xe6, 0x21, 0xc5, 0x20, 0x30, 0xd1, 0x08, 0x44, 0x00, 0x5c, 0xc3, 0x11, 0xed, 0x3c,
+    0xb5, 0x26, 0x03, 0x34, 0x86, 0xd1, 0x42, 0x63, 0x50, 0x00, 0x4a, 0x12, 0x7c, 0xc6, 0xa9, 0x38,
+    0xca, 0x25, 0xaf, 0x89, 0x7e, 0x3b, 0x9a, 0xe8, 0xf5, 0x47, 0x47, 0x88, 0x63, 0xc7, 0x8d, 0xc1,
+    0x3b, 0x3d, 0x26, 0xab, 0x80, 0x1a, 0x94, 0xb6, 0xed, 0x5f, 0x0e, 0x3b, 0xdd, 0xd1, 0xa0, 0x31,
+    0x2a, 0x44, 0x52, 0x4e, 0x13, 0x26, 0x92, 0x92, 0x41, 0x8a, 0xad, 0x11, 0x04, 0x3a, 0xc0, 0xc8,
+    0x39, 0x3e, 0x28, 0x35, 0xbd, 0x73, 0xbc, 0x73, 0x50, 0x21, 0xf1, 0xc1, 0x14, 0x7a, 0xe1, 0xcc,
+    0x67, 0xc1, 0x73, 0x94, 0x50, 0x0c, 0xd6, 0x8e, 0x59, 0xd4, 0x30, 0xc0, 0xcc, 0x4f, 0x1c, 0x34,
+    0xba, 0xfe, 0xdf, 0xce, 0x49, 0xa1, 0xdb, 0xae, 0x3a, 0x11, 0x28, 0xd1, 0x9f, 0xe3, 0x2b, 0x7d,
+    0x12, 0xcf, 0xc6, 0xaf, 0x7d, 0xd5, 0xf2, 0x32, 0x86, 0x83, 0x27, 0x15, 0x26, 0x2f, 0xcf, 0xf5,
+    0x5d, 0xab, 0x2d, 0x76, 0xee, 0xcb, 0x04, 0x60, 0xc0, 0xdd, 0xcf, 0xb8, 0x4e, 0xc0, 0x1c, 0xfd,
+    0x41, 0xec, 0x67, 0x36, 0xd7, 0x3c, 0xc7, 0x97, 0xf5, 0xad, 0x39, 0xcc, 0x68, 0xf2, 0xb5, 0x2b,
+    0x40, 0x41, 0xca, 0x50, 0x27, 0xef, 0x1d, 0x4a, 0x5e, 0x8f, 0xd3, 0x26, 0x60, 0x11, 0xa7, 0xfd,
+    0x9a, 0xe8, 0x85, 0x07, 0x2f, 0x91, 0xc3, 0xcb, 0x3f, 0xc2, 0x85, 0xa1, 0x91, 0x58, 0xfd, 0x85,
+    0x8b, 0xe6, 0x73, 0xf1, 0x68, 0xb3, 0x29, 0x13, 0xf1, 0x31, 0xb5, 0x37, 0xaa, 0xd5, 0x79, 0xe5,
+    0xd3, 0xf6, 0xa6, 0x61, 0x85, 0x32, 0x2d, 0x0c, 0x67, 0x80, 0x66, 0x78, 0xe2, 0xf8, 0x77, 0xce,
+    0x79, 0x90, 0xde, 0x04, 0x41, 0x46, 0x6d, 0x45, 0x1e, 0x7b, 0x56, 0xac, 0x77, 0x9a, 0xfd, 0xe3,
+    0x93, 0x6e, 0x7b, 0xd4, 0xae, 0x3b, 0x16, 0x66, 0xa1, 0xf9, 0xb0, 0x17, 0x65, 0xa2, 0xf8, 0x16,
+    0xc9, 0x25, 0x08, 0x69, 0x72, 0x27, 0xca, 0xa3, 0x49, 0x09, 0x3c, 0x12, 0x17, 0x3d, 0x75, 0x70,
+    0x6d, 0x9b, 0x6c, 0x3d, 0xdf, 0x71, 0x9b, 0xbf, 0x16, 0x67, 0xa8, 0x1a, 0x3c, 0xe6, 0x94, 0x9e,
+    0x16, 0x53, 0x48, 0xd5, 0xe0, 0x4f, 0x3d, 0x48, 0xd5, 0x78, 0x91, 0x57, 0xbf, 0x01, 0x30, 0xde,
+    0xe3, 0xd5, 0x43, 0x51, 0xed, 0xb6, 0x45, 0x1c, 0x6b, 0xcb, 0x78, 0xae, 0xf7, 0x35, 0xbe, 0x8c,
+    0x9b, 0xbf, 0x5b, 0xd0, 0x93, 0x63, 0xe4, 0x9f, 0x06, 0xce, 0x86, 0x33, 0x5f, 0xff, 0x85, 0x41,
+    0x8a, 0x9f, 0x9a, 0xa3, 0x6d, 0xaf, 0x75, 0x55, 0xb2, 0xb0, 0x3d, 0x35, 0xc7, 0xaa, 0x0d, 0xec,
+    0xd5, 0xd6, 0x7a, 0x69, 0xae, 0xe8, 0x0d, 0xb8, 0x92, 0x67, 0x8e, 0x0d, 0xb8, 0x73, 0xd0, 0x96,
+    0x02, 0xdd, 0xc8, 0x4c, 0x6b, 0x1e, 0x99, 0xb9, 0xbc, 0x0a, 0xa6, 0x6e, 0x64, 0x3e, 0x11, 0x68,
+    0x1a, 0xbb, 0xe7, 0x5a, 0x7d, 0xe0, 0xa6, 0x65, 0xc9, 0x09, 0x56, 0xf7, 0x82, 0x77, 0x16, 0xd0,
+    0x89, 0x99, 0x01, 0x42, 0x61, 0x24, 0x2c, 0x13, 0xc6, 0xda, 0x3d, 0x91, 0x75, 0x0d, 0xdf, 0xa4,
+    0xfe, 0x71, 0xc7, 0x92, 0x45, 0x82, 0x19, 0x14, 0x56, 0xad, 0xf1, 0x0a, 0x6a, 0xad, 0x5a, 0x9e,
+    0xf9, 0x9c, 0xcd, 0xa3, 0x81, 0x4f, 0xc9, 0x91, 0xf0, 0xb0, 0x09, 0xae, 0xd3, 0x41, 0x9c, 0x99,
+    0x3e, 0x1e, 0xda, 0x05, 0x25, 0x0b, 0x58, 0xa7, 0x87, 0xc7, 0xb9, 0x48, 0xa9, 0x14, 0x5e, 0xa3,
+    0x58, 0x9f, 0xf7, 0xc1, 0xcd, 0x6e, 0xca, 0x19, 0xae, 0xde, 0x17, 0x5c, 0xcd, 0x7b, 0x4a, 0x7c,
+    0xa0, 0x60, 0xa3, 0xf6, 0x02, 0x9d, 0x72, 0x47, 0x5b, 0xde, 0x0b, 0xb9, 0x36, 0xe8, 0x68, 0x6d,
+    0x3e, 0x49, 0xb7, 0x51, 0x5f, 0xf4, 0x62, 0x9d, 0xbd, 0x33, 0xe5, 0xf1, 0xbe, 0xaf, 0xda, 0x2d,
+    0x85, 0x64, 0xd7, 0xa7, 0x3c, 0x0d, 0x64, 0xc5, 0x64, 0x87, 0xc4, 0xb1, 0xe9, 0x4e, 0xac, 0xc4,
+    0xab, 0xfc, 0x51, 0x96, 0xf8, 0x9f, 0xd9, 0x30, 0xf9, 0xb7, 0x04, 0x59, 0x18, 0xc9, 0x06, 0x5b,
+    0xaf, 0xf9, 0xdb, 0x28, 0xaf, 0x5a, 0x88, 0xa7, 0x4d, 0x36, 0xda, 0xfe, 0xa2, 0xce, 0xc4, 0x6b,
+    0x8c, 0x1b, 0x22, 0x80, 0xd6, 0xdd, 0xc3, 0x5e, 0xb5, 0x7c, 0x98, 0xa2, 0xb9, 0x5a, 0xcf, 0x5c,
+    0x4b, 0xcd, 0xcc, 0xc9, 0x9d, 0xf2, 0x11, 0xcc, 0x3a, 0xdf, 0xab, 0x6a, 0xbe, 0x8a, 0xf2, 0xd6,
+    0x65, 0x3d, 0xdb, 0x8a, 0xe2, 0x8a, 0xfc, 0xa1, 0xfb, 0x0c, 0xce, 0xba, 0x28, 0x6b, 0x57, 0x65,
+    0x0b, 0x5f, 0xf8, 0xd4, 0x5f, 0xee, 0x64, 0x7f, 0xac, 0x7a, 0xa3, 0x53, 0x4e, 0x72, 0xe5, 0x6b,
+    0x9c, 0xd9, 0x0f, 0xbd, 0xaa, 0xf5, 0x69, 0x45, 0xf3, 0x42, 0x57, 0x25, 0xac, 0x5d, 0x33, 0x5b,
+    0x87, 0x7c, 0x59, 0x76, 0xd0, 0x6e, 0xb5, 0x7b, 0xa3, 0x4e, 0xa3, 0x3b, 0x74, 0x86, 0x8d, 0x9f,
+    0x75, 0x4d, 0xd3, 0xaa, 0x5c, 0x18, 0x8d, 0x59, 0x33, 0x4d, 0x95, 0xb6, 0x3c, 0xbd, 0x7c, 0xbf,
+    0x96, 0x52, 0xae, 0xf4, 0xd7, 0x1e, 0x0c, 0xfa, 0x03, 0xb7, 0x44, 0x17, 0xa7, 0x07, 0x28, 0x74,
+    0xa2, 0xde, 0x8c, 0x81, 0x3f, 0x98, 0x61, 0x3f, 0x9c, 0x3b, 0x8b, 0x96, 0x3c, 0xe3, 0x4b, 0xc6,
+    0x95, 0x76, 0x4d, 0x4b, 0x29, 0x1a, 0xef, 0x0f, 0xee, 0x30, 0x75, 0xaa, 0x9a, 0x54, 0x80, 0x5b,
+    0xec, 0x84, 0x3b, 0x55, 0x7b, 0xce, 0xdd, 0xa9, 0x6a, 0x4c, 0xae, 0xa7, 0xba, 0xe2, 0xb9, 0x56,
+    0xae, 0x63, 0x6b, 0x1d, 0x93, 0xf2, 0xae, 0x77, 0x5d, 0x75, 0x66, 0xfe, 0x2d, 0xfd, 0xd4, 0x59,
+    0x23, 0xf4, 0xa8, 0x38, 0x6e, 0xc9, 0x91, 0x14, 0xf7, 0x8d, 0xf9, 0x58, 0x1d, 0xb6, 0x22, 0x43,
+    0x7d, 0xf7, 0x94, 0x1e, 0x85, 0xbb, 0x9f, 0xcc, 0x9e, 0x89, 0xe6, 0x00, 0x10, 0x47, 0x45, 0x70,
+    0x85, 0x98, 0xa4, 0xe2, 0xda, 0x85, 0x5f, 0x31, 0x0d, 0x07, 0x3a, 0x85, 0xe8, 0x43, 0xd4, 0x92,
+    0x29, 0xbe, 0x00, 0xbc, 0x53, 0xc5, 0x1e, 0x2a, 0x95, 0xec, 0x19, 0x45, 0x73, 0x05, 0x64, 0xc4,
+    0x9e, 0x4f, 0xc4, 0x8d, 0xba, 0x16, 0x0d, 0x9b, 0xef, 0xc8, 0x96, 0x18, 0x8f, 0xee, 0x4e, 0x82,
+    0xd4, 0x37, 0xce, 0x0b, 0x3f, 0x0e, 0xfc, 0x55, 0x7e, 0x2e, 0x08, 0x2e, 0x23, 0x2b, 0x6e, 0x90,
+    0xae, 0x6c, 0x95, 0x7f, 0x2c, 0x56, 0x46, 0x16, 0x95, 0xb6, 0x63, 0xd4, 0xaf, 0xb9, 0x60, 0xd3,
+    0x24, 0xd1, 0x2f, 0x91, 0xc6, 0xc5, 0x3f, 0x44, 0x7c, 0x49, 0xde, 0x7b, 0x07, 0xa3, 0x87, 0xb9,
+    0xc5, 0x2a, 0x43, 0x0b, 0xec, 0x80, 0xa1, 0x2c, 0xef, 0x16, 0x3b, 0x32, 0x52, 0x9b, 0xb2, 0x86,
+    0x42, 0x1b, 0x6d, 0xb7, 0x3a, 0xec, 0xf9, 0xf2, 0x83, 0x0f, 0xa3, 0xf6, 0x90, 0x3d, 0x09, 0x24,
+    0x44, 0x06, 0x1a, 0xdb, 0x68, 0x8d, 0x33, 0x07, 0x8d, 0x38, 0xa5, 0xa7, 0x7b, 0x8f, 0xfb, 0xad,
+    0xce, 0x61, 0x87, 0x07, 0x40, 0x0d, 0xda, 0x8d, 0xd6, 0x07, 0xd7, 0x92, 0x95, 0x4c, 0xf1, 0xd3,
+    0x89, 0xe2, 0xb1, 0x9e, 0x57, 0x9a, 0x4a, 0x84, 0x17, 0x11, 0xf5, 0x9b, 0x0b, 0x2d, 0x13, 0xa6,
+    0x5d, 0xb7, 0xd5, 0x19, 0x36, 0x1b, 0x83, 0x96, 0x73, 0xda, 0x23, 0x6e, 0xe7, 0x34, 0x8f, 0x1a,
+    0xbd, 0xb7, 0xed, 0xe1, 0xbe, 0x99, 0x1c, 0xe3, 0x7e, 0x93, 0x84, 0x67, 0x56, 0xff, 0xa6, 0xb5,
+    0xb3, 0x9d, 0x3d, 0x0c, 0xb7, 0xc8, 0x83, 0x0b, 0xda, 0x68, 0xac, 0x54, 0xee, 0x9c, 0xe1, 0x4d,
+    0x49, 0x1f, 0x94, 0x47, 0x64, 0xb5, 0x6c, 0x3e, 0x44, 0x2e, 0xd0, 0x3b, 0xcf, 0x08, 0x2a, 0xda,
+    0x65, 0x9b, 0xa4, 0xd5, 0xc7, 0xe2, 0x5c, 0x5a, 0xa0, 0xbc, 0xaf, 0x1b, 0xee, 0x17, 0xf0, 0x5b,
+    0x4f, 0xdb, 0xa9, 0x42, 0x67, 0xa1, 0xc8, 0x74, 0x14, 0xea, 0x9b, 0x05, 0x89, 0x59, 0x30, 0x5c,
+    0xdf, 0x81, 0x08, 0x19, 0x2d, 0xce, 0xa7, 0xdc, 0x71, 0xa8, 0x74, 0x82, 0xb7, 0xe6, 0xf0, 0xbf,
+    0xac, 0x3f, 0xfc, 0x0a, 0x3f, 0xb3, 0xa2, 0x99, 0x94, 0xb9, 0xb7, 0x3d, 0x70, 0xb8, 0xfb, 0x82,
+    0x8d, 0xea, 0xa0, 0xaf, 0xa1, 0x96, 0x2b, 0x4b, 0xd9, 0x65, 0x1b, 0xdf, 0x78, 0x08, 0xb2, 0x3e,
+    0x65, 0xd8, 0x6a, 0x7b, 0x31, 0x11, 0x4e, 0x25, 0xee, 0xcf, 0xae, 0x9d, 0x4f, 0x19, 0x3a, 0x57,
+    0x0d, 0x16, 0xa3, 0xea, 0x80, 0xbc, 0x35, 0xfa, 0x82, 0x28, 0x9c, 0xab, 0x88, 0x2a, 0x78, 0x75,
+    0xeb, 0xd5, 0x03, 0x8e, 0x51, 0x77, 0x5e, 0xbe, 0x3b, 0x70, 0xba, 0x9d, 0xe3, 0xce, 0xc8, 0xad,
+    0x98, 0x14, 0x22, 0xc8, 0x21, 0xb3, 0x26, 0x99, 0xc7, 0x85, 0x55, 0xfb, 0xd0, 0x2f, 0xe3, 0x37,
+    0xf0, 0x71, 0x2d, 0x32, 0x31, 0x6a, 0xae, 0x42, 0x67, 0x6a, 0x4e, 0x51, 0x3d, 0x82, 0x96, 0xbf,
+    0x6f, 0x61, 0x84, 0xd4, 0x7e, 0xb1, 0x5c, 0xbd, 0x1d, 0x82, 0xf4, 0x86, 0x79, 0x05, 0x11, 0x04,
+    0xb0, 0x6e, 0x99, 0x04, 0xf7, 0x5e, 0x37, 0x64, 0xd2, 0x93, 0x09, 0x6f, 0xcc, 0xcd, 0xd0, 0x7b,
+    0x64, 0x50, 0xe4, 0x1d, 0xf6, 0x9d, 0x2e, 0x5e, 0x87, 0xe9, 0x5d, 0x3e, 0xae, 0xed, 0x53, 0x61,
+    0x5d, 0xd9, 0x63, 0x65, 0x6b, 0x31, 0x2f, 0xb6, 0x8d, 0x5f, 0xc5, 0xe8, 0xbf, 0x46, 0x2e, 0x90,
+    0x2f, 0x6e, 0x96, 0x36, 0xc3, 0x4a, 0xff, 0x52, 0x79, 0x82, 0x01, 0x05, 0xe5, 0x08, 0x29, 0x59,
+    0xc8, 0xe7, 0x41, 0x8b, 0x65, 0x0c, 0xa6, 0x82, 0x62, 0x3d, 0xf3, 0x91, 0x3f, 0xc4, 0x0f, 0x67,
+    0xcb, 0xb1, 0xec, 0xa4, 0x45, 0xce, 0x50, 0xd0, 0x8e, 0x1e, 0x6b, 0x7d, 0xb0, 0xc8, 0xe1, 0x62,
+    0x34, 0x6c, 0xa7, 0xf7, 0x16, 0x6f, 0xbc, 0xb8, 0x10, 0x6e, 0x3b, 0x2c, 0xcd, 0x83, 0x32, 0xa3,
+    0xf4, 0xf2, 0x6c, 0xab, 0x85, 0x1a, 0xf7, 0xba, 0x21, 0xc9, 0x32, 0xdc, 0x26, 0x13, 0x8b, 0x6d,
+    0x84, 0x56, 0xa4, 0x89, 0x15, 0x10, 0x5d, 0x99, 0xbf, 0xb3, 0x25, 0x8d, 0x6f, 0x71, 0x8e, 0x26,
+    0x0d, 0x58, 0x99, 0x38, 0xbf, 0x42, 0xb6, 0x90, 0x9f, 0xb9, 0x05, 0x48, 0xc9, 0x48, 0x61, 0x93,
+    0x22, 0x74, 0xed, 0x56, 0x65, 0xaa, 0xc5, 0xa1, 0x05, 0xa5, 0x1d, 0x19, 0x00, 0x5a, 0x3b, 0x1f,
+    0x62, 0x39, 0xb4, 0xee, 0x0b, 0x2c, 0x4c, 0x4c, 0xc4, 0x58, 0xe7, 0x10, 0x25, 0xba, 0x12, 0x7c,
+    0xcb, 0xca, 0x3e, 0x7b, 0x7d, 0xda, 0xcc, 0x3c, 0x2b, 0x7e, 0xd4, 0xf3, 0x17, 0xb5, 0x31, 0x81,
+    0xa0, 0xd9, 0x06, 0x2b, 0x26, 0x43, 0xfe, 0xd1, 0xaa, 0x37, 0x16, 0x9e, 0xc8, 0xd4, 0xc8, 0x3c,
+    0x8e, 0x0b, 0x10, 0xa8, 0x44, 0x0d, 0x49, 0xb3, 0xbc, 0x12, 0x22, 0xa7, 0x52, 0x52, 0x4a, 0x12,
+    0xab, 0x4f, 0xf2, 0xbc, 0xb8, 0xa5, 0x25, 0x0f, 0x98, 0x2d, 0xf8, 0x39, 0x22, 0x8f, 0x14, 0x4a,
+    0x32, 0x30, 0x5b, 0x68, 0x82, 0xfa, 0xb9, 0x3f, 0xbe, 0x5e, 0x5a, 0x6b, 0x9e, 0xfb, 0xd7, 0x5a,
+    0xcd, 0x28, 0x0e, 0x2f, 0x31, 0xaf, 0xa6, 0x51, 0x37, 0x83, 0x3d, 0xeb, 0xaa, 0x49, 0x17, 0xd7,
+    0x0a, 0xe9, 0x3c, 0xb1, 0xe1, 0x2e, 0xa8, 0x2b, 0xc0, 0xbe, 0x18, 0xda, 0xaa, 0x1d, 0x57, 0xac,
+    0xcc, 0xc7, 0x1a, 0x0e, 0x47, 0x8e, 0x14, 0xc5, 0x37, 0x81, 0x02, 0x00, 0x2a, 0x15, 0x3c, 0xa4,
+    0x9f, 0x0c, 0x40, 0xf9, 0x9e, 0x58, 0x32, 0x0c, 0x44, 0xcd, 0x51, 0xc4, 0x18, 0xa1, 0x1c, 0xb6,
+    0xea, 0x30, 0xbc, 0x72, 0xf1, 0x9f, 0x6d, 0xe0, 0xaf, 0xe1, 0xdc, 0xb5, 0x38, 0x93, 0xe0, 0x71,
+    0xd1, 0x87, 0xf5, 0x97, 0x58, 0x32, 0x59, 0xa5, 0xfd, 0x68, 0x3a, 0x29, 0x9a, 0xa2, 0x06, 0x40,
+    0xdc, 0xbb, 0x67, 0xf3, 0xe0, 0x66, 0xb3, 0xf5, 0xb0, 0xab, 0x37, 0x31, 0x1b, 0x32, 0x0d, 0x9a,
+    0xdb, 0xa9, 0xdf, 0x71, 0xaa, 0x0b, 0x18, 0xc1, 0x9a, 0xbf, 0x6a, 0x01, 0x72, 0xaf, 0x56, 0x4d,
+    0x5e, 0x5b, 0x69, 0x3e, 0xd2, 0x51, 0x4c, 0x86, 0xe6, 0x9f, 0x5e, 0x61, 0x28, 0x2f, 0xda, 0x7c,
+    0x18, 0x3f, 0x04, 0x6d, 0x9c, 0x72, 0xeb, 0x30, 0x8e, 0xe9, 0xe6, 0x92, 0x3a, 0x29, 0xab, 0xcd,
+    0x1d, 0x4d, 0x8f, 0x86, 0x37, 0xf7, 0x1a, 0xab, 0xb7, 0xc8, 0x74, 0xc5, 0x27, 0xc6, 0xea, 0x43,
+    0xcf, 0xe2, 0x84, 0x6b, 0xa1, 0x3b, 0x71, 0x5a, 0x18, 0x64, 0x57, 0x7c, 0x28, 0x3d, 0x08, 0x3c,
+    0xeb, 0x6d, 0xbc, 0x02, 0xa4, 0x87, 0x6e, 0xfd, 0xfd, 0xe3, 0x73, 0x09, 0x0b, 0xcc, 0xd6, 0xca,
+    0x3b, 0x9c, 0xbb, 0x96, 0xd3, 0xdc, 0xae, 0x7f, 0x77, 0x4d, 0xc9, 0xae, 0x1b, 0xa1, 0xaf, 0x14,
+    0xea, 0x46, 0x8c, 0x1a, 0x8a, 0x8e, 0xe4, 0x47, 0xd0, 0x64, 0x56, 0xdc, 0xc8, 0xf6, 0xa7, 0xe4,
+    0x4e, 0xa6, 0xd8, 0x93, 0x33, 0x7d, 0x67, 0x45, 0xd3, 0x5e, 0x70, 0x63, 0x18, 0xb1, 0x37, 0x1b,
+    0xfa, 0x71, 0x2f, 0x07, 0xcd, 0x39, 0x31, 0x17, 0x5d, 0xf5, 0x82, 0x30, 0xe7, 0x77, 0xc7, 0xf0,
+    0xc2, 0x40, 0x89, 0x88, 0x01, 0xa4, 0x4c, 0x10, 0xb2, 0x42, 0x4e, 0x45, 0x99, 0x39, 0x9b, 0xc5,
+    0xea, 0x3e, 0x0c, 0x10, 0xe6, 0xc3, 0xee, 0x79, 0x4f, 0x84, 0x43, 0xd3, 0x20, 0x4e, 0x3d, 0xf7,
+    0x64, 0xd0, 0xff, 0xb9, 0xd3, 0x6a, 0x3b, 0xbd, 0xf6, 0x7b, 0xc7, 0x8e, 0x3a, 0xe4, 0xe5, 0xc2,
+    0xda, 0xd5, 0xc2, 0xf9, 0x78, 0xba, 0x04, 0x42, 0x21, 0x3f, 0x34, 0x44, 0xcd, 0xfc, 0x07, 0xf4,
+    0xd6, 0x53, 0xfa, 0xef, 0x74, 0xbb, 0xed, 0xb7, 0x8d, 0x2e, 0xda, 0x30, 0x07, 0x8d, 0xe6, 0xa8,
+    0x3d, 0x18, 0xe6, 0x47, 0xd8, 0x90, 0x82, 0x1e, 0xf8, 0x30, 0x10, 0x9f, 0xea, 0xd7, 0xb9, 0xbb,
+    0xae, 0x71, 0x6c, 0xb3, 0x7d, 0x5c, 0xc9, 0xf9, 0xc4, 0x1b, 0x44, 0x0f, 0xf2, 0x45, 0xcd, 0x52,
+    0xde, 0xd7, 0x92, 0xe5, 0x78, 0x6c, 0x38, 0x32, 0x19, 0xec, 0x8e, 0xf1, 0x04, 0xce, 0xe5, 0x04,
+    0x06, 0xe4, 0xaf, 0xe2, 0xac, 0xb7, 0x70, 0x05, 0x81, 0x44, 0x02, 0xb8, 0xf9, 0xca, 0xba, 0x6b,
+    0xd0, 0x3a, 0x17, 0x74, 0xda, 0x01, 0xce, 0x26, 0x29, 0xd6, 0x16, 0x20, 0x2b, 0x26, 0x59, 0xff,
+    0xb4, 0xf7, 0xae, 0xd7, 0x7f, 0xdf, 0x73, 0x2b, 0x1b, 0xdf, 0xd7, 0x1d, 0x36, 0x4e, 0xbb, 0xa3,
+    0xf5, 0xdd, 0x67, 0xf5, 0x90, 0x11, 0x8d, 0x94, 0x93, 0x78, 0xbc, 0x0a, 0x35, 0x27, 0x49, 0x6a,
+    0xa9, 0x62, 0x0b, 0x5d, 0x3b, 0xd3, 0x3d, 0x5a, 0x4f, 0x98, 0xa9, 0x94, 0x86, 0x47, 0x35, 0x31,
+    0x8d, 0x40, 0x5d, 0x63, 0x2f, 0xff, 0xd2, 0x63, 0x99, 0x77, 0x59, 0x32, 0xac, 0x78, 0x9c, 0x61,
+    0x3c, 0x8c, 0x57, 0x5b, 0x18, 0xaf, 0xf3, 0xa9, 0x87, 0x43, 0xff, 0x74, 0xd0, 0x6c, 0x3b, 0x8d,
+    0x5e, 0xcb, 0x69, 0xb5, 0x87, 0x23, 0xa7, 0x31, 0x68, 0xc3, 0xb9, 0x07, 0xc0, 0x6e, 0x75, 0x06,
+    0x70, 0x6a, 0xf4, 0x07, 0x1f, 0xd6, 0xf0, 0xd9, 0x85, 0xd9, 0xbd, 0x0d, 0x52, 0xf9, 0xee, 0xb3,
+    0x83, 0xaf, 0xf2, 0x2a, 0xef, 0x7e, 0x26, 0x52, 0x53, 0x30, 0xdf, 0x7c, 0xc7, 0x99, 0xae, 0x8e,
+    0x6c, 0xd0, 0x4e, 0x45, 0x6c, 0x62, 0x0b, 0x6a, 0x10, 0xc6, 0x3d, 0x34, 0x79, 0x9b, 0x81, 0x0d,
+    0xea, 0xab, 0xed, 0xf0, 0xa7, 0x11, 0x40, 0x20, 0x0f, 0x52, 0xe9, 0x5a, 0x0c, 0x5d, 0xe0, 0x30,
+    0x59, 0xe0, 0xab, 0xe1, 0xdf, 0x5c, 0x30, 0x21, 0xb5, 0xcd, 0x26, 0x33, 0x43, 0x80, 0xe0, 0x1f,
+    0x67, 0xa6, 0xf5, 0x5c, 0x9b, 0x55, 0xb1, 0xc5, 0x93, 0x3f, 0xa5, 0x72, 0xf2, 0x61, 0x05, 0xdf,
+    0x64, 0x91, 0x29, 0x86, 0xf3, 0xbb, 0x8e, 0x2d, 0x0a, 0x7f, 0x14, 0xe5, 0xca, 0x39, 0xaf, 0x26,
+    0x45, 0x55, 0xef, 0xbb, 0x61, 0xe8, 0x4d, 0x5d, 0xb4, 0x1f, 0xc0, 0x58, 0x11, 0xf1, 0xff, 0xb5,
+    0x8e, 0x1d, 0xf4, 0xdc, 0x54, 0x9d, 0x41, 0xb2, 0x8a, 0xd2, 0x60, 0x5a, 0x97, 0xf4, 0xf5, 0xd5,
+    0xc1, 0x03, 0x1b, 0x31, 0x6c, 0x00, 0x79, 0x47, 0xfa, 0x29, 0xb0, 0x46, 0x00, 0x9e, 0x90, 0xc5,
+    0x17, 0x08, 0x98, 0xbb, 0xab, 0x39, 0xb5, 0x8d, 0xef, 0x54, 0x33, 0x9e, 0xf1, 0x18, 0xcc, 0x1b,
+    0xb1, 0xe3, 0x8f, 0xc2, 0xba, 0xf5, 0x58, 0xbc, 0xdf, 0x9d, 0x75, 0xc3, 0xf0, 0xff, 0xe6, 0xdc,
+    0xff, 0xe6, 0xdc, 0x06, 0xe7, 0x3e, 0xee, 0xff, 0xdc, 0xfe, 0x17, 0x71, 0x6e, 0x18, 0xfa, 0x77,
+    0x60, 0xdc, 0x48, 0x75, 0xff, 0x66, 0xdc, 0x12, 0xe2, 0x06, 0xdf, 0x66, 0xcf, 0x4d, 0xae, 0xc3,
+    0xb6, 0x8b, 0x7c, 0xf9, 0xf3, 0x15, 0x0b, 0xbc, 0xf9, 0xbf, 0x8e, 0x91, 0xe3, 0xd4, 0xff, 0x30,
+    0x32, 0x38, 0x19, 0xa4, 0x98, 0x9b, 0xb9, 0x19, 0xda, 0xb1, 0x42, 0x0f, 0xb6, 0xfa, 0xe5, 0x5b,
+    0xf4, 0x60, 0x5d, 0x09, 0x26, 0x05, 0x64, 0x74, 0xa4, 0x73, 0x57, 0x9b, 0x1a, 0x6c, 0xd7, 0x81,
+    0x7f, 0x6f, 0x05, 0xf8, 0x21, 0x66, 0x9c, 0xf9, 0x57, 0xa9, 0xbe, 0xb3, 0x6b, 0x38, 0xce, 0x36,
+    0x4b, 0x51, 0x27, 0x33, 0xd4, 0x15, 0xa2, 0xdc, 0xf0, 0xa4, 0xf1, 0xbe, 0x27, 0xf5, 0xd2, 0x6f,
+    0xa1, 0x94, 0xae, 0x42, 0x7a, 0x9a, 0x81, 0xc5, 0x74, 0xfc, 0x4d, 0xb0, 0x9a, 0x5d, 0x2b, 0x60,
+    0x24, 0x57, 0x42, 0xcf, 0x8d, 0x26, 0xba, 0x7f, 0x18, 0x3d, 0x86, 0x8a, 0xb7, 0xd4, 0xf4, 0x97,
+    0x3c, 0x5c, 0x0a, 0xe3, 0xb1, 0x56, 0xa3, 0x09, 0xbe, 0x7d, 0x5b, 0x42, 0x2a, 0x0b, 0x1e, 0xad,
+    0x73, 0xe0, 0xc7, 0xc6, 0x83, 0xe5, 0xe1, 0x74, 0xba, 0x4e, 0x43, 0x58, 0x8a, 0xf4, 0x31, 0x80,
+    0xb1, 0x6a, 0x94, 0x9b, 0x12, 0x1f, 0x4c, 0xa3, 0x4c, 0x65, 0x2e, 0x9b, 0x95, 0x76, 0xbc, 0xa0,
+    0xac, 0x21, 0x52, 0x8d, 0x67, 0x39, 0xf3, 0x6c, 0x31, 0x98, 0x2a, 0x10, 0xf2, 0x31, 0x98, 0xd9,
+    0x1e, 0x74, 0x7a, 0x7f, 0x05, 0x82, 0x15, 0xc7, 0x9c, 0x17, 0x3e, 0x7f, 0x91, 0xa1, 0xbc, 0xda,
+    0x07, 0x16, 0xb2, 0xad, 0x62, 0xaf, 0xca, 0x86, 0x67, 0xe6, 0x1b, 0x10, 0xb8, 0x6a, 0x6e, 0x3b,
+    0xbc, 0x09, 0x27, 0xcc, 0xcb, 0x6c, 0xe7, 0x4f, 0x8a, 0x7f, 0x9a, 0xfd, 0x29, 0x5b, 0xd1, 0x9d,
+    0x9e, 0x15, 0x30, 0xba, 0xb8, 0x48, 0x02, 0x23, 0x2d, 0x20, 0x96, 0x53, 0xc2, 0xbf, 0xdc, 0xcd,
+    0x00, 0x7e, 0x01, 0x80, 0x62, 0x7a, 0xca, 0xfc, 0x47, 0x09, 0x1d, 0x3f, 0x45, 0xb3, 0x36, 0xeb,
+    0x54, 0xfe, 0x78, 0xbd, 0xe7, 0xb0, 0x24, 0xda, 0x9f, 0x06, 0xed, 0xd1, 0xa0, 0x03, 0x32, 0x07,
+    0x4a, 0x33, 0x38, 0x8c, 0xac, 0xa3, 0xc3, 0x4e, 0x21, 0x4f, 0x1c, 0xcf, 0x16, 0x25, 0x6a, 0x9b,
+    0xbc, 0xd5, 0x6e, 0x83, 0x2f, 0x31, 0xe2, 0xfb, 0x9f, 0xc7, 0x8d, 0x51, 0xf3, 0xa8, 0xe6, 0x40,
+    0xc1, 0xa8, 0x31, 0x90, 0x9b, 0x81, 0x90, 0xa9, 0x59, 0xc8, 0x5a, 0x79, 0xfe, 0x5b, 0xac, 0xa2,
+    0x20, 0xf7, 0x94, 0x9c, 0x88, 0x7a, 0x2f, 0x87, 0x6f, 0x95, 0xcc, 0x82, 0x3e, 0x7d, 0xca, 0x38,
+    0x60, 0xd5, 0xb1, 0xbc, 0xe0, 0x6b, 0x4c, 0xb8, 0xdb, 0xe9, 0xbd, 0x73, 0x5a, 0x83, 0xfe, 0xc9,
+    0x49, 0xbb, 0x45, 0xb3, 0x3d, 0x3d, 0xc6, 0xb9, 0x36, 0x46, 0xec, 0xe2, 0x84, 0x0d, 0xa6, 0x22,
+    0x0f, 0xf9, 0x74, 0x94, 0x66, 0x8a, 0x31, 0xdc, 0x56, 0xb8, 0xcf, 0x74, 0x30, 0x9f, 0xf0, 0x14,
+    0x17, 0x00, 0x61, 0x73, 0x8e, 0x55, 0x3e, 0x52, 0x15, 0x43, 0x83, 0x90, 0x10, 0x2a, 0xf9, 0xc8,
+    0xe1, 0x02, 0x7c, 0xf4, 0x3c, 0x39, 0x49, 0xd1, 0x74, 0xdb, 0x39, 0xc6, 0xe0, 0xe0, 0x99, 0x7f,
+    0xeb, 0xc9, 0x19, 0x57, 0x31, 0xd9, 0xd5, 0xf7, 0xce, 0x8b, 0x1d, 0xe6, 0x8a, 0xf2, 0x27, 0x33,
+    0x1a, 0xd7, 0x12, 0x3a, 0xac, 0xa4, 0xfe, 0x7d, 0x89, 0xcd, 0x38, 0x9e, 0xea, 0x97, 0x83, 0xda,
+    0x2b, 0x1d, 0x4a, 0x8b, 0x1f, 0x76, 0xfe, 0x82, 0x58, 0x27, 0x76, 0x8b, 0xc5, 0x8b, 0xb3, 0x14,
+    0x1b, 0xa4, 0x83, 0xe0, 0x13, 0xca, 0x55, 0x67, 0x1e, 0x61, 0x2c, 0xf4, 0x24, 0x8e, 0x16, 0x86,
+    0x3b, 0x87, 0xc0, 0x7b, 0xbd, 0xc7, 0xa2, 0x04, 0x90, 0x2c, 0x09, 0xa6, 0x60, 0x22, 0x6a, 0xce,
+    0x2e, 0x9a, 0x5a, 0x8e, 0x35, 0x68, 0x32, 0x8d, 0x89, 0x92, 0xca, 0xe9, 0xab, 0x33, 0x30, 0xf6,
+    0x4e, 0xb8, 0xc9, 0xc3, 0x72, 0x9d, 0xf3, 0x24, 0x00, 0x92, 0xa5, 0x15, 0x71, 0x1e, 0xe7, 0xa4,
+    0xf1, 0x01, 0x89, 0x74, 0x28, 0x7a, 0x5a, 0xeb, 0x04, 0xcb, 0x0b, 0x72, 0x6b, 0xbe, 0xe4, 0xbd,
+    0x94, 0xf9, 0x55, 0x54, 0xdf, 0x0a, 0xfe, 0x96, 0x77, 0xfe, 0xc5, 0x6a, 0x38, 0xaa, 0x60, 0x97,
+    0x88, 0xae, 0xd0, 0x3f, 0x86, 0x2f, 0x07, 0x24, 0x6a, 0xb6, 0x5d, 0x0b, 0x58, 0x58, 0x1a, 0xfb,
+    0xf3, 0xe4, 0x22, 0x88, 0xe5, 0xab, 0x14, 0x89, 0x83, 0x2f, 0x3c, 0x39, 0xe9, 0x55, 0x40, 0x6f,
+    0xb8, 0x85, 0xfe, 0x94, 0x16, 0x8d, 0x1d, 0xf9, 0x53, 0x4c, 0x60, 0x7a, 0xe7, 0xc0, 0x91, 0x87,
+    0x9f, 0xc7, 0x7e, 0x3c, 0x51, 0x9f, 0x60, 0xa7, 0xed, 0x46, 0x45, 0x19, 0x00, 0x1c, 0x3f, 0x61,
+    0x2b, 0x32, 0x58, 0xd8, 0x9e, 0xf3, 0x6a, 0x97, 0x7f, 0x61, 0x4c, 0xe6, 0x53, 0xf3, 0xa8, 0xdd,
+    0x7c, 0xc7, 0xdd, 0xa8, 0x08, 0x3d, 0xfe, 0x2c, 0x2a, 0x34, 0x07, 0xcd, 0x4f, 0xa3, 0xc6, 0x41,
+    0xb7, 0x4d, 0xf4, 0xa1, 0xd0, 0x12, 0x77, 0x98, 0xe0, 0x01, 0x02, 0xa7, 0xe1, 0x3c, 0x7d, 0xf5,
+    0xb2, 0x11, 0xc7, 0xfe, 0x9d, 0xf7, 0xf2, 0x47, 0xf1, 0xa2, 0x96, 0xed, 0xe4, 0x81, 0xaf, 0xb9,
+    0x03, 0x87, 0x12, 0xbd, 0xa2, 0x8e, 0x66, 0x61, 0xcb, 0xd7, 0xac, 0xe9, 0x35, 0x34, 0xfd, 0x09,
+    0xfe, 0xc1, 0x86, 0x58, 0xd5, 0x1b, 0x3b, 0xcf, 0x90, 0x0e, 0xf7, 0x1d, 0x6f, 0xe7, 0xb6, 0xdd,
+    0x3a, 0xf8, 0xe9, 0xa7, 0x57, 0x2f, 0x77, 0x9c, 0xff, 0xc4, 0xf2, 0x37, 0x6f, 0xde, 0xc0, 0x17,
+    0x7c, 0x73, 0x41, 0xfe, 0xc8, 0xfa, 0x4d, 0xe1, 0x2c, 0xc1, 0x18, 0x39, 0xfa, 0xb0, 0x63, 0x0b,
+    0x0e, 0x80, 0x0d, 0xab, 0x20, 0x42, 0x28, 0xce, 0xe7, 0xf1, 0xf8, 0xd5, 0xcb, 0xa3, 0xe0, 0x96,
+    0xf9, 0x9f, 0x88, 0x89, 0x8b, 0x49, 0xef, 0xdc, 0x1e, 0xf2, 0xff, 0x15, 0x2f, 0x9a, 0x1a, 0xea,
+    0xc7, 0x2d, 0x36, 0x95, 0xc0, 0xfd, 0x08, 0x33, 0xfd, 0x4f, 0x56, 0x0b, 0xe6, 0x57, 0x81, 0xa5,
+    0x61, 0xaf, 0x67, 0xd9, 0x7a, 0x7e, 0xd2, 0xf3, 0xb5, 0x78, 0x54, 0x3f, 0x1b, 0xb9, 0xc2, 0x96,
+    0x53, 0xa9, 0xa5, 0x11, 0xcf, 0xdf, 0xfd, 0xe2, 0xcf, 0x15, 0xc0, 0xf5, 0xc9, 0x10, 0xb1, 0xc1,
+    0xfb, 0xa9, 0x0a, 0x67, 0xad, 0x6b, 0xbd, 0x56, 0xb3, 0x30, 0x7d, 0x10, 0x45, 0x39, 0xbb, 0x2f,
+    0x49, 0xb9, 0x2c, 0x64, 0x64, 0xa8, 0x6c, 0x4a, 0xc7, 0x13, 0x74, 0x30, 0xd5, 0xf8, 0xbc, 0xed,
+    0xd5, 0x94, 0x58, 0xf7, 0x88, 0xe3, 0xda, 0x2e, 0x9b, 0x0e, 0xcf, 0xbc, 0xbd, 0x8f, 0x83, 0x6c,
+    0x96, 0xb6, 0x59, 0xcd, 0xd9, 0xbc, 0x63, 0x0e, 0xf9, 0x5b, 0xa6, 0x8a, 0xe6, 0xf4, 0x50, 0x01,
+    0xd8, 0xdf, 0x84, 0x7f, 0x2b, 0x45, 0x9f, 0xf0, 0x5f, 0xaf, 0x95, 0xe3, 0x0a, 0x56, 0xc9, 0x4b,
+    0xeb, 0x12, 0x7f, 0x6c, 0x82, 0xac, 0x3e, 0x09, 0xab, 0xbf, 0x98, 0x7e, 0x8e, 0x49, 0xb0, 0x67,
+    0x27, 0x58, 0x94, 0x8b, 0xa3, 0x47, 0xbc, 0x02, 0xd5, 0x81, 0xa5, 0x4a, 0xe6, 0xd0, 0x2a, 0x4b,
+    0x31, 0x21, 0xf6, 0xe2, 0x59, 0x4c, 0x3b, 0xbc, 0xf7, 0x42, 0xc9, 0x75, 0xc3, 0x0f, 0x94, 0x37,
+    0x36, 0x23, 0x4f, 0xea, 0x87, 0x53, 0x2e, 0x7d, 0xf1, 0x48, 0x19, 0x79, 0x0e, 0xee, 0x88, 0xf9,
+    0x39, 0x5b, 0x16, 0xf6, 0x51, 0x11, 0x5f, 0x73, 0xd6, 0x80, 0x31, 0xd9, 0x08, 0x25, 0x2d, 0x09,
+    0xae, 0xf1, 0x13, 0x63, 0x1a, 0x6c, 0x5f, 0x70, 0xd8, 0x9a, 0x8f, 0x05, 0x07, 0xcb, 0x8b, 0x0b,
+    0xd4, 0x4e, 0x2b, 0xfa, 0xa3, 0x36, 0x2c, 0x0f, 0xb3, 0xfb, 0x8c, 0x8d, 0xb1, 0xa7, 0x0b, 0x16,
+    0xcf, 0xa0, 0x73, 0x2a, 0x82, 0x7f, 0xf3, 0x11, 0x1c, 0x40, 0x97, 0x33, 0x4c, 0x67, 0xcc, 0x39,
+    0xd6, 0x21, 0xff, 0xe9, 0x65, 0xbc, 0x8a, 0x7e, 0xd7, 0xfc, 0x05, 0xbe, 0xe9, 0xed, 0xb9, 0xb8,
+    0x76, 0x57, 0xae, 0x95, 0xbd, 0x0a, 0xac, 0xc0, 0x83, 0xaf, 0x12, 0xb0, 0x80, 0xed, 0x99, 0x79,
+    0xf6, 0x69, 0x6f, 0x1d, 0xaf, 0xcc, 0x67, 0xc2, 0xa6, 0x78, 0x7b, 0x25, 0x32, 0x65, 0xff, 0x72,
+    0xdc, 0x3d, 0x4a, 0xd3, 0xc5, 0x00, 0xf3, 0xaf, 0x24, 0x9a, 0x6b, 0x3f, 0xd4, 0xa9, 0xb1, 0x7d,
+    0xaf, 0x45, 0xf3, 0x45, 0x96, 0x11, 0x00, 0xb1, 0x4f, 0x26, 0x80, 0x16, 0x4f, 0x2c, 0x20, 0x22,
+    0x2c, 0x53, 0x3c, 0x75, 0x2a, 0x0a, 0x32, 0xe1, 0x67, 0x26, 0xdf, 0x80, 0x82, 0xac, 0xf7, 0x1c,
+    0x89, 0x04, 0x1f, 0x8c, 0xd5, 0xf3, 0xb9, 0x7a, 0xf8, 0x29, 0x17, 0xcf, 0xc7, 0xea, 0x33, 0xfb,
+    0x85, 0xd9, 0x60, 0xc7, 0xac, 0x87, 0xef, 0xc3, 0x73, 0x6b, 0x15, 0xdb, 0x47, 0xa3, 0x02, 0x12,
+    0x83, 0x27, 0xf6, 0x40, 0xb1, 0x54, 0xaa, 0xce, 0x21, 0xd6, 0xf4, 0x66, 0x7a, 0xf6, 0x9d, 0xaf,
+    0x3a, 0xba, 0x15, 0xe7, 0x9d, 0xdc, 0x21, 0xae, 0x7f, 0xd1, 0x92, 0x9b, 0xe8, 0x1e, 0x2c, 0xc6,
+    0x6b, 0x74, 0xb1, 0x7f, 0x63, 0x44, 0xee, 0x41, 0x09, 0xc8, 0x3f, 0x8b, 0xa9, 0x0f, 0x48, 0xb4,
+    0xfd, 0xf1, 0x3f, 0xfd, 0xad, 0x8b, 0xc6, 0xd6, 0xe1, 0xce, 0xd6, 0x5f, 0xce, 0xb6, 0x2f, 0xab,
+    0x14, 0xb5, 0x97, 0x46, 0xa7, 0x80, 0x82, 0xfc, 0xfd, 0x2a, 0x1b, 0xcf, 0x56, 0x5c, 0x88, 0x0f,
+    0xa6, 0xd1, 0xb9, 0x96, 0x1e, 0xff, 0x91, 0x13, 0xe2, 0xeb, 0xc9, 0xf0, 0x73, 0xce, 0x61, 0x13,
+    0x9a, 0x04, 0x25, 0x56, 0x07, 0xbd, 0x2a, 0x44, 0xe7, 0x5f, 0x8f, 0x5b, 0xe7, 0x16, 0xca, 0x0b,
+    0x09, 0x15, 0xd7, 0x46, 0x14, 0x2c, 0x81, 0x3c, 0x2e, 0x60, 0xd5, 0x2a, 0x33, 0x47, 0xe9, 0xdf,
+    0x63, 0x95, 0xc6, 0x73, 0x50, 0xf9, 0x39, 0x8b, 0x8c, 0xfd, 0x65, 0x36, 0x08, 0xe9, 0xda, 0x98,
+    0x3b, 0x4d, 0xbf, 0x8a, 0x1b, 0x29, 0x5a, 0x98, 0x05, 0x06, 0xe2, 0x24, 0x5d, 0xeb, 0x5c, 0xe0,
+    0xc9, 0x4d, 0x2b, 0xaa, 0x6d, 0xb9, 0xc8, 0xae, 0xcc, 0x0c, 0xc3, 0x62, 0x52, 0xf9, 0x6b, 0x84,
+    0x95, 0x18, 0x72, 0x13, 0x87, 0x69, 0xb0, 0x12, 0x45, 0x8a, 0x00, 0xaa, 0xf9, 0x8a, 0x2e, 0x14,
+    0x3f, 0xd1, 0x59, 0x68, 0xbe, 0x1c, 0x96, 0x4c, 0xd9, 0xcb, 0xd1, 0xd6, 0x84, 0xae, 0xda, 0x7d,
+    0x14, 0x0a, 0x2e, 0xbc, 0x3a, 0x3d, 0x0c, 0xbc, 0x4f, 0x12, 0x0b, 0xb3, 0x73, 0xeb, 0x19, 0x62,
+    0xa9, 0x92, 0xd6, 0x98, 0x9b, 0x49, 0x79, 0x6b, 0x6a, 0x4c, 0x02, 0x51, 0xae, 0x35, 0xab, 0xf1,
+    0x5c, 0x8a, 0xa0, 0x9a, 0x6d, 0x83, 0x36, 0x1e, 0x33, 0x0f, 0x7d, 0xc4, 0xd5, 0x9c, 0xb1, 0x27,
+    0xda, 0xf0, 0x3d, 0x81, 0xf4, 0x6e, 0x11, 0xd4, 0x69, 0x71, 0xb4, 0x49, 0x8a, 0x33, 0xac, 0x04,
+    0xbb, 0xaa, 0xb2, 0x17, 0xe0, 0x9b, 0xce, 0x3c, 0x67, 0x41, 0x7c, 0x19, 0x60, 0x2a, 0x7f, 0x60,
+    0xff, 0xb7, 0xa0, 0x83, 0xc1, 0xec, 0xd8, 0x5b, 0xae, 0xa0, 0x75, 0x85, 0x58, 0xc3, 0x08, 0xfe,
+    0x65, 0x96, 0x01, 0xe3, 0x7d, 0x77, 0xb5, 0xe5, 0xb7, 0x7c, 0xb8, 0x1e, 0x06, 0x2f, 0x79, 0xb8,
+    0x5e, 0xce, 0xb8, 0x64, 0x4c, 0x16, 0x16, 0x86, 0xba, 0xac, 0xe8, 0x8b, 0x7e, 0x59, 0xb3, 0x1f,
+    0x92, 0x04, 0x42, 0x4f, 0xea, 0x7a, 0x78, 0xa4, 0xd7, 0x7e, 0x8b, 0x42, 0x38, 0xac, 0x7e, 0x9d,
+    0xbb, 0x24, 0x3a, 0xc1, 0xbf, 0xe6, 0xc3, 0xc7, 0xba, 0x23, 0xa3, 0x6a, 0x66, 0x0c, 0x32, 0xf6,
+    0x31, 0x68, 0xff, 0xed, 0x14, 0xaf, 0x16, 0xb9, 0xf9, 0x73, 0x37, 0x97, 0xae, 0x50, 0x1a, 0x35,
+    0x71, 0x93, 0xb9, 0xd8, 0x1e, 0xa8, 0xc1, 0xa3, 0x09, 0x4f, 0xbe, 0x7f, 0xc8, 0xc8, 0x26, 0x8d,
+    0x18, 0x81, 0x2b, 0xaf, 0xb3, 0x35, 0xfb, 0x83, 0xa1, 0xd3, 0x1f, 0x38, 0xbd, 0xf6, 0xe8, 0x7d,
+    0x7f, 0xf0, 0xce, 0x39, 0xe8, 0xf6, 0x95, 0x67, 0x3f, 0x79, 0x2d, 0xe8, 0xc7, 0x4e, 0x5a, 0xe8,
+    0x2f, 0xcb, 0x1e, 0xa8, 0x15, 0xaf, 0x3a, 0xa2, 0x72, 0x8e, 0x92, 0xd9, 0x01, 0x7b, 0xfe, 0xca,
+    0xf2, 0x24, 0xdf, 0xda, 0xaf, 0xf3, 0x6a, 0x96, 0x52, 0xfb, 0x5b, 0xda, 0x62, 0x20, 0xed, 0xf5,
+    0x73, 0x02, 0xe3, 0xb9, 0x28, 0x5e, 0xf1, 0x88, 0x36, 0x8f, 0x53, 0xe7, 0x58, 0xb9, 0x4e, 0x8c,
+    0x8d, 0xde, 0xa2, 0xf8, 0x8d, 0x5f, 0x51, 0x43, 0x8f, 0xf1, 0xe2, 0xaa, 0xf7, 0x9e, 0xda, 0x41,
+    0xf6, 0x70, 0xaa, 0x1a, 0x95, 0xcb, 0x6a, 0xda, 0x9e, 0xbf, 0x11, 0x01, 0x5c, 0x40, 0x8e, 0x08,
+    0x13, 0x0b, 0x5d, 0x56, 0x9d, 0x8f, 0xd4, 0xdf, 0x99, 0x85, 0xd6, 0x2d, 0xac, 0x90, 0x75, 0x65,
+    0x75, 0x9a, 0x5f, 0xf1, 0xd4, 0x8e, 0x8a, 0x02, 0x43, 0x38, 0x16, 0xbe, 0x6e, 0xfb, 0x13, 0x7a,
+    0x66, 0xe2, 0xdf, 0x5b, 0xff, 0xbf, 0x6e, 0xeb, 0x0f, 0x81, 0xf3, 0xf1, 0x27, 0xaa, 0xb5, 0x54,
+    0x13, 0xda, 0xa3, 0xd6, 0x27, 0xab, 0x11, 0x40, 0x7d, 0x59, 0x7b, 0xc5, 0xf4, 0x95, 0x4e, 0x4b,
+    0x62, 0x3e, 0xd6, 0x7e, 0x55, 0x5b, 0x89, 0x13, 0x12, 0x52, 0x76, 0xf6, 0xce, 0x33, 0x2a, 0xeb,
+    0x25, 0x20, 0xa0, 0xa4, 0x2c, 0x2a, 0xff, 0xbb, 0x58, 0x4e, 0x79, 0x50, 0xc8, 0x4a, 0x02, 0x28,
+    0x7a, 0x4c, 0x77, 0xd7, 0xfa, 0x54, 0x97, 0xec, 0x59, 0xe4, 0xe7, 0x58, 0xf5, 0x6c, 0xd7, 0x37,
+    0xc3, 0x74, 0x96, 0x92, 0xd4, 0x8a, 0xe8, 0xfc, 0x45, 0x6e, 0xf9, 0xa8, 0x97, 0x91, 0x16, 0x53,
+    0x79, 0xf0, 0x6b, 0x3d, 0xf2, 0x90, 0x4b, 0xc2, 0xd8, 0x79, 0x93, 0x74, 0xb2, 0xa7, 0xba, 0x1f,
+    0x83, 0x72, 0xf8, 0x50, 0xdf, 0x9c, 0x76, 0x30, 0x23, 0x11, 0x14, 0x68, 0x71, 0x7e, 0xd1, 0x22,
+    0x41, 0x3b, 0xbc, 0x25, 0xc6, 0x4f, 0x4d, 0x0f, 0x64, 0xdc, 0xb2, 0x01, 0x1e, 0x93, 0xb5, 0xfb,
+    0x5d, 0xfb, 0x03, 0xde, 0xf3, 0x0c, 0xf1, 0xba, 0x64, 0xcb, 0x69, 0x76, 0x3b, 0xcd, 0x77, 0xce,
+    0x70, 0xd4, 0x18, 0x9d, 0x72, 0xe7, 0xc4, 0xde, 0x61, 0xe7, 0xed, 0xe9, 0xa0, 0x5d, 0xee, 0x92,
+    0xc4, 0xd1, 0x94, 0x25, 0xfa, 0x3b, 0x89, 0x03, 0x96, 0x8a, 0x88, 0xbf, 0x52, 0x18, 0x4e, 0xd3,
+    0x20, 0x96, 0x8f, 0x14, 0x16, 0x3c, 0x47, 0xa8, 0x6c, 0x45, 0xd6, 0x8d, 0xe5, 0xb1, 0x46, 0xee,
+    0x79, 0x7f, 0x2d, 0x51, 0x31, 0x98, 0x27, 0xcb, 0x18, 0xa9, 0xb2, 0xb1, 0x4c, 0xaf, 0xde, 0x02,
+    0x51, 0x59, 0xda, 0x1b, 0x96, 0x3a, 0xeb, 0xcd, 0xb5, 0x80, 0xc7, 0xf0, 0x43, 0xaf, 0xe9, 0x34,
+    0x1b, 0xbd, 0x66, 0xbb, 0x6b, 0xdc, 0x1c, 0x17, 0x47, 0xa8, 0xde, 0x8b, 0x00, 0x84, 0x3e, 0xdb,
+    0x09, 0x35, 0xcc, 0x87, 0xcd, 0x12, 0xbd, 0x5f, 0xee, 0x34, 0xd6, 0x01, 0xd3, 0x8d, 0xd4, 0x7a,
+    0x1a, 0x08, 0x1f, 0x03, 0x7e, 0x16, 0xe0, 0x99, 0xcb, 0xa4, 0x3b, 0x3d, 0x76, 0x7d, 0xa2, 0x37,
+    0xa2, 0x8b, 0x0d, 0xf4, 0x73, 0x32, 0xbc, 0x5a, 0xe8, 0x69, 0xf8, 0xc0, 0x7c, 0x14, 0xcd, 0xf2,
+    0xc0, 0xf6, 0x22, 0x9f, 0x0d, 0xd2, 0xba, 0x7b, 0xb0, 0x4a, 0xc6, 0x17, 0xf0, 0x41, 0x14, 0xd5,
+    0x53, 0x4c, 0xdd, 0x30, 0xdc, 0x2f, 0x1c, 0x55, 0xbd, 0x11, 0xba, 0x2f, 0x5e, 0x54, 0xbb, 0xc7,
+    0xd7, 0x44, 0x33, 0x15, 0xc6, 0x60, 0x03, 0x2a, 0xc2, 0x7a, 0x6a, 0x38, 0x11, 0x18, 0x9d, 0x61,
+    0x20, 0x2c, 0x4b, 0x83, 0x7c, 0xd2, 0xee, 0x61, 0xf8, 0xb6, 0x9e, 0x93, 0x81, 0xf3, 0x1f, 0xf4,
+    0x6c, 0x22, 0xd6, 0x50, 0xba, 0xd7, 0x6a, 0x22, 0x0c, 0x05, 0x55, 0xd4, 0x62, 0x62, 0x44, 0xbc,
+    0xb7, 0x67, 0xcf, 0x44, 0xc7, 0xcc, 0x4d, 0xa7, 0x60, 0x1f, 0x1b, 0x27, 0x27, 0x5d, 0xe6, 0xa5,
+    0xc9, 0xd6, 0xac, 0xb7, 0xd1, 0x56, 0x59, 0xd0, 0x3b, 0x7b, 0xe5, 0xee, 0xa9, 0xfa, 0x4e, 0x67,
+    0xc9, 0x58, 0xd2, 0x79, 0x55, 0x6b, 0xbe, 0xd6, 0x40, 0x16, 0x9c, 0x50, 0xc1, 0xcd, 0x9c, 0xeb,
+    0x4e, 0xfa, 0x23, 0x91, 0x0b, 0x82, 0x96, 0xe6, 0xae, 0xb9, 0x53, 0x4e, 0xab, 0xdf, 0x6b, 0xeb,
+    0xbb, 0x63, 0xcb, 0x69, 0xaa, 0xea, 0x52, 0x80, 0x7b, 0x7d, 0x98, 0x93, 0x90, 0x3e, 0x34, 0x5d,
+    0xea, 0xf7, 0x65, 0x9c, 0xcb, 0x98, 0x5e, 0x78, 0xbd, 0x4a, 0xd3, 0x45, 0x52, 0xdf, 0x16, 0xa2,
+    0x0d, 0x52, 0xf9, 0x3c, 0xf8, 0x5c, 0x8b, 0xe2, 0xcb, 0xed, 0x7d, 0x7f, 0x11, 0x3e, 0x9b, 0x4c,
+    0xf7, 0x5e, 0x3c, 0xbb, 0x0e, 0xee, 0x8a, 0x0c, 0x2b, 0xda, 0xa4, 0xb5, 0xc4, 0xbc, 0x64, 0x02,
+    0x85, 0x51, 0xe0, 0xc4, 0xf9, 0x74, 0x3e, 0xf5, 0xe7, 0xd7, 0xca, 0xb5, 0xa7, 0x58, 0x0f, 0xda,
+    0xd3, 0xbb, 0x23, 0x98, 0x7c, 0xe3, 0xc0, 0xe9, 0x03, 0xba, 0x33, 0xe6, 0x97, 0x3f, 0x81, 0xf2,
+    0xe8, 0x4d, 0x76, 0x04, 0xd5, 0xcc, 0x24, 0xbd, 0x5e, 0xe4, 0x71, 0xfa, 0x85, 0x3d, 0xd2, 0x57,
+    0x77, 0x76, 0x84, 0xd5, 0xd7, 0xc4, 0x61, 0xfb, 0x2d, 0xee, 0xea, 0x94, 0x06, 0x21, 0xcf, 0xf0,
+    0x90, 0x7f, 0xff, 0x51, 0x3c, 0xdf, 0x28, 0xce, 0xe2, 0x12, 0xa1, 0x73, 0x77, 0x25, 0xba, 0xb3,
+    0xce, 0x90, 0x2d, 0x02, 0x7b, 0xc1, 0x9b, 0x4c, 0x37, 0x17, 0x5b, 0x6c, 0x77, 0xce, 0xd3, 0x01,
+    0x20, 0x56, 0x6f, 0x8f, 0xdb, 0x54, 0x35, 0x74, 0x53, 0xd3, 0xdf, 0x5d, 0x87, 0xfa, 0xf1, 0xe5,
+    0x80, 0xa2, 0xa1, 0x01, 0xf6, 0x55, 0x87, 0xd8, 0x42, 0x9d, 0x86, 0xb8, 0x2f, 0xbe, 0x1d, 0x2a,
+    0xe0, 0x60, 0xfe, 0x74, 0x1a, 0xdd, 0xe0, 0x55, 0xc2, 0x22, 0xb5, 0x5f, 0xcf, 0xe1, 0xbe, 0x73,
+    0x8c, 0xc3, 0x60, 0x4a, 0xa4, 0x2e, 0xc4, 0x0d, 0x66, 0x2e, 0xb7, 0x79, 0xaa, 0xe0, 0x23, 0xea,
+    0x7c, 0x84, 0x23, 0xca, 0x06, 0x64, 0x73, 0x15, 0x61, 0xc9, 0x03, 0xd4, 0xb1, 0xe5, 0xc2, 0x38,
+    0x4b, 0x11, 0xaf, 0x5f, 0xee, 0x16, 0xbd, 0x83, 0x01, 0x13, 0xc8, 0x7c, 0x38, 0x0a, 0x67, 0x68,
+    0x49, 0x00, 0x49, 0x86, 0x49, 0x98, 0x5e, 0xb8, 0x98, 0x06, 0x75, 0x26, 0x14, 0x56, 0xad, 0x95,
+    0xd0, 0x6c, 0x96, 0xd4, 0x9d, 0x8f, 0x5f, 0xf8, 0xc6, 0x2d, 0x10, 0x90, 0xb0, 0x29, 0xef, 0x4f,
+    0x1a, 0x5b, 0xc3, 0x76, 0x53, 0xe8, 0x04, 0x2e, 0x3e, 0xef, 0x35, 0x0e, 0x16, 0x29, 0xbd, 0x8e,
+    0xa0, 0x48, 0x7f, 0xd0, 0xd4, 0x25, 0xf1, 0x1d, 0x48, 0x14, 0xa4, 0xdd, 0x94, 0x6c, 0xae, 0x67,
+    0x80, 0x27, 0xf7, 0x67, 0xb9, 0xf1, 0xee, 0x2d, 0xbe, 0x30, 0x26, 0x20, 0x51, 0xea, 0xa6, 0x55,
+    0x03, 0x03, 0xa6, 0x3f, 0xc4, 0xc9, 0xbe, 0xcf, 0x7e, 0x7e, 0xdc, 0x39, 0x73, 0xea, 0xf4, 0xfc,
+    0x72, 0x99, 0x0f, 0xcc, 0xda, 0x7b, 0xb4, 0xde, 0x8e, 0xd8, 0x1c, 0x6c, 0xb8, 0x3d, 0x52, 0x8a,
+    0x03, 0xda, 0x50, 0x78, 0x87, 0x42, 0xdc, 0xc5, 0xfe, 0x5c, 0x6c, 0xd1, 0x79, 0x9b, 0x31, 0xa4,
+    0xe2, 0xb7, 0x64, 0x17, 0xb4, 0xe5, 0xa5, 0x4f, 0x8c, 0x2f, 0x7c, 0xf5, 0xb2, 0x46, 0x8a, 0x57,
+    0xac, 0x21, 0x1e, 0x6c, 0x79, 0x7a, 0x90, 0x4f, 0xa5, 0x50, 0x25, 0x7b, 0x22, 0xfa, 0xd5, 0xb0,
+    0xba, 0xff, 0x6a, 0x1e, 0x61, 0x41, 0x07, 0x7d, 0xaf, 0x55, 0x26, 0x72, 0x2a, 0x0e, 0xdb, 0xd5,
+    0x9c, 0xc4, 0xc6, 0x3f, 0xca, 0xd7, 0x64, 0x55, 0x61, 0x4c, 0x99, 0x8f, 0xaf, 0x4f, 0x13, 0x07,
+    0x7a, 0xad, 0xba, 0x9e, 0xa4, 0xa7, 0xe4, 0x48, 0xc0, 0x9b, 0x1c, 0x9b, 0x72, 0x4a, 0x57, 0x54,
+    0xd9, 0x9b, 0xdf, 0xbb, 0x76, 0x3f, 0xbf, 0xcc, 0x16, 0x8e, 0xfd, 0x9c, 0x55, 0xb3, 0x21, 0x33,
+    0x83, 0xb8, 0xe6, 0xbf, 0x1e, 0x8d, 0xd3, 0x20, 0xdd, 0x62, 0x2f, 0xef, 0xba, 0x16, 0xe7, 0xf3,
+    0x35, 0xce, 0xf3, 0x64, 0x79, 0x3e, 0x0b, 0xd3, 0x0d, 0x4f, 0x73, 0xfd, 0x0a, 0xa7, 0xe0, 0xfa,
+    0x46, 0x5c, 0xe1, 0xc8, 0xeb, 0x9b, 0x9b, 0xe0, 0x3c, 0x7f, 0x83, 0x93, 0x1d, 0x5b, 0xec, 0xe2,
+    0x86, 0x84, 0x83, 0x2f, 0xe6, 0x25, 0x8c, 0x72, 0xf9, 0x52, 0xc5, 0x0c, 0x44, 0x08, 0x88, 0x79,
+    0xb4, 0x35, 0x8e, 0x62, 0xe4, 0x64, 0x38, 0x43, 0xf6, 0x42, 0x07, 0x70, 0x3e, 0x97, 0x7b, 0x49,
+    0xbb, 0xb9, 0xbc, 0xb5, 0x04, 0x4d, 0xb2, 0x2c, 0xf1, 0xc4, 0x76, 0x5a, 0x81, 0x4c, 0x36, 0xb4,
+    0x47, 0x66, 0x36, 0x5b, 0x9e, 0x82, 0x42, 0x6b, 0xb1, 0xd6, 0x91, 0x99, 0x63, 0x36, 0xd7, 0x54,
+    0x5a, 0x19, 0x8b, 0x9a, 0x15, 0xb9, 0x14, 0x0b, 0x9c, 0x04, 0x5d, 0xa0, 0x4d, 0xa9, 0x71, 0xe8,
+    0x85, 0x71, 0x07, 0x05, 0xc0, 0xc3, 0xfe, 0xc0, 0x8a, 0xa4, 0xc5, 0x2a, 0x0a, 0x88, 0x0f, 0x8e,
+    0x77, 0xd0, 0xed, 0xf4, 0x5a, 0x95, 0x7a, 0x61, 0x53, 0xcd, 0x08, 0xf0, 0x88, 0xf2, 0x02, 0x52,
+    0x95, 0x42, 0xe4, 0x72, 0x68, 0x12, 0x6c, 0xb6, 0x8a, 0x09, 0x5f, 0xcb, 0xd7, 0x68, 0xa1, 0x68,
+    0xb4, 0x42, 0x6d, 0x6e, 0x96, 0x50, 0x53, 0x8e, 0x3f, 0x35, 0xb3, 0x0f, 0x9b, 0x52, 0x37, 0x7e,
+    0x50, 0x92, 0xf4, 0x3e, 0xae, 0xc9, 0x42, 0xa4, 0x3a, 0x7e, 0xa0, 0xc6, 0xfd, 0xb4, 0x5c, 0xe5,
+    0x96, 0x53, 0x2f, 0x55, 0x29, 0xed, 0xd3, 0x2c, 0x30, 0x2a, 0x98, 0xbd, 0x6e, 0xa6, 0xca, 0x93,
+    0x1b, 0xf3, 0x75, 0x53, 0x7f, 0xde, 0x7c, 0x3d, 0x2d, 0x3e, 0xaf, 0xc1, 0x67, 0x36, 0x4c, 0x9b,
+    0x0e, 0x2f, 0xf4, 0x77, 0x3e, 0x9c, 0x50, 0xe1, 0xb3, 0xb8, 0x0b, 0x31, 0x0f, 0xc3, 0x15, 0x48,
+    0xe9, 0x9c, 0xee, 0xd5, 0x31, 0x31, 0x9c, 0x26, 0x57, 0x17, 0x3c, 0x64, 0x71, 0x5f, 0xa6, 0x5f,
+    0xe7, 0xc1, 0x86, 0x5a, 0x23, 0x4f, 0xae, 0xc2, 0xe7, 0x51, 0x6a, 0x2f, 0x28, 0x50, 0x29, 0x6d,
+    0xe4, 0x50, 0x72, 0xc4, 0xc9, 0x29, 0x30, 0xdf, 0xc8, 0x3f, 0xd4, 0x31, 0x47, 0x22, 0xe9, 0x38,
+    0xf9, 0x6c, 0x3b, 0xd6, 0xfc, 0x25, 0x99, 0xa1, 0xcf, 0xd3, 0xc8, 0xf7, 0x4c, 0x12, 0x46, 0x1f,
+    0x7c, 0xe6, 0xfe, 0x64, 0x90, 0xf1, 0xd7, 0x9c, 0x5c, 0xf6, 0x63, 0xab, 0xd8, 0xf9, 0x40, 0x1c,
+    0xb8, 0xa0, 0x2c, 0xb3, 0x29, 0xd4, 0xe6, 0x41, 0x4a, 0xbe, 0x7d, 0x9f, 0x5f, 0x6e, 0x63, 0x2f,
+    0xdc, 0x3b, 0xe1, 0xc1, 0xcf, 0x99, 0xa1, 0x8d, 0x31, 0x8a, 0xc3, 0x7f, 0x90, 0x18, 0x80, 0x41,
+    0x07, 0x07, 0x7e, 0x12, 0x8e, 0x99, 0x3d, 0x04, 0x81, 0x63, 0x8d, 0x69, 0xa3, 0xd3, 0xd3, 0x78,
+    0x59, 0x92, 0x4e, 0x52, 0x3a, 0x46, 0xad, 0x31, 0x6c, 0x14, 0x4f, 0xc0, 0x3d, 0x34, 0x34, 0xb1,
+    0x8d, 0xb0, 0x42, 0x7c, 0xca, 0x87, 0xb6, 0xe9, 0xe7, 0xc4, 0xbd, 0x99, 0x6d, 0x89, 0x1c, 0x25,
+    0x88, 0xdb, 0x52, 0x0f, 0xf0, 0x07, 0xfe, 0x2b, 0x82, 0xdf, 0xc8, 0x06, 0x44, 0x4c, 0xc6, 0x80,
+    0x8e, 0xe9, 0x58, 0xe1, 0x51, 0x6b, 0x38, 0xc8, 0xa9, 0xb5, 0x88, 0x8e, 0xc1, 0xe7, 0xdf, 0x95,
+    0xdf, 0xe8, 0x02, 0xeb, 0x1e, 0x8d, 0x46, 0x27, 0x8e, 0xe1, 0x71, 0x51, 0x96, 0x0a, 0xa8, 0xe8,
+    0x5a, 0xc4, 0x86, 0xdb, 0x16, 0x4a, 0x72, 0xfa, 0xef, 0x7e, 0xc7, 0x33, 0xd5, 0x1c, 0xfc, 0x1b,
+    0x9d, 0xab, 0x2a, 0xfb, 0x2b, 0x71, 0x8a, 0x7d, 0x14, 0xe2, 0xc4, 0x1d, 0x4a, 0x06, 0x9b, 0x52,
+    0x16, 0xb5, 0xda, 0x5e, 0xc2, 0x48, 0x39, 0xc2, 0xfa, 0x0a, 0xe2, 0x59, 0x49, 0x24, 0x84, 0xd4,
+    0x72, 0xc6, 0xf6, 0x78, 0x34, 0x85, 0xdd, 0x83, 0x80, 0x30, 0xe4, 0x7b, 0x24, 0xd1, 0x32, 0x6b,
+    0x9d, 0xf3, 0x30, 0xb4, 0xef, 0x92, 0x4d, 0x93, 0xa4, 0x4e, 0xfe, 0x0a, 0x04, 0x98, 0x45, 0x89,
+    0xc8, 0x6e, 0x4d, 0x57, 0x5f, 0xa5, 0x05, 0xd4, 0xfe, 0xa2, 0xe8, 0x7c, 0x54, 0x56, 0x8b, 0xfd,
+    0xf9, 0x35, 0x8f, 0x97, 0xa0, 0x2e, 0x59, 0x01, 0x10, 0xaa, 0x97, 0x15, 0xe1, 0x5f, 0x78, 0xef,
+    0x34, 0x4e, 0x80, 0xe4, 0x6c, 0xc5, 0xac, 0x51, 0x1d, 0x0f, 0x54, 0x4c, 0x5a, 0x9a, 0x1b, 0x5d,
+    0x1b, 0x40, 0xe9, 0x0d, 0x2a, 0xe7, 0x67, 0x74, 0x13, 0x5e, 0xa0, 0x33, 0x79, 0x82, 0x59, 0x97,
+    0xc6, 0xe8, 0xd7, 0x8f, 0x6f, 0x0b, 0x1c, 0x86, 0x58, 0x99, 0x7d, 0x64, 0xc7, 0xa6, 0x3e, 0x10,
+    0x6b, 0x3a, 0x0e, 0x28, 0xd8, 0x4c, 0x6d, 0xda, 0xc4, 0x22, 0x6a, 0x8a, 0x1f, 0x8b, 0x9b, 0x9e,
+    0xa7, 0x46, 0xc3, 0x83, 0x94, 0x35, 0x3b, 0x4f, 0x6d, 0x8d, 0x0a, 0xaf, 0xdb, 0x0a, 0xaf, 0x4c,
+    0xd9, 0x30, 0x14, 0x88, 0x5c, 0x35, 0xa3, 0x8e, 0xe9, 0x5b, 0xa5, 0x6a, 0x89, 0x59, 0x2e, 0xe2,
+    0x00, 0x0c, 0xb9, 0x72, 0xef, 0x57, 0xac, 0xc9, 0x72, 0x0a, 0xf1, 0x74, 0x45, 0x8a, 0xd0, 0x02,
+    0x26, 0xa2, 0x38, 0x79, 0xf3, 0x7c, 0xba, 0xf4, 0xa2, 0xe8, 0xaa, 0x47, 0x2a, 0x12, 0x9e, 0x7a,
+    0xd7, 0x48, 0x5c, 0x2b, 0x3c, 0x78, 0x32, 0xdf, 0x48, 0xf4, 0xa6, 0x48, 0x87, 0xe1, 0x3f, 0x02,
+    0x3d, 0x26, 0x21, 0x4b, 0x92, 0xf9, 0xda, 0x79, 0xb1, 0xf3, 0xf2, 0x07, 0x69, 0xa6, 0x93, 0xb9,
+    0xfa, 0x0f, 0xdc, 0x5d, 0x6b, 0xcd, 0xef, 0xb5, 0xea, 0xec, 0xd3, 0x36, 0x95, 0xd5, 0xd2, 0xe8,
+    0x30, 0xbc, 0x0d, 0x26, 0x1e, 0x0b, 0xfd, 0x7b, 0x57, 0xd6, 0x41, 0x61, 0x2f, 0xd6, 0xae, 0x8e,
+    0x75, 0x3f, 0x25, 0xb3, 0xba, 0xd1, 0xe6, 0x25, 0xb5, 0x79, 0x6b, 0x38, 0x63, 0x05, 0x94, 0x18,
+    0xfd, 0x28, 0x9d, 0x4d, 0xbd, 0xc4, 0x70, 0xb4, 0x4d, 0x32, 0x37, 0xdb, 0x67, 0xdb, 0x97, 0x55,
+    0xf7, 0x99, 0x3f, 0x5b, 0xec, 0x02, 0x6c, 0x65, 0xe9, 0x6b, 0x2a, 0x9d, 0xa6, 0x5a, 0xe1, 0x1b,
+    0x2a, 0xbc, 0xd4, 0x0b, 0xbf, 0xa3, 0xc2, 0xbf, 0x2f, 0x23, 0x2c, 0xa6, 0x09, 0x3c, 0xf9, 0xff,
+    0x09, 0xdb, 0xdd, 0xb4, 0x36, 0xe8, 0x00, 0x00,
+};
@@ -2,12 +2,14 @@
 // https://wigle.net/
 
 #include "wigle.h"
+#include "gzip_stream.h"
 #include <SD.h>
 #include <WiFi.h>
 #include <WiFiClientSecure.h>
 #include <ArduinoJson.h>
 #include <esp_heap_caps.h>
 #include <mbedtls/base64.h>
+#include <new>
 #include "../core/config.h"
 #include "../core/sd_layout.h"
 #include "../core/heap_gates.h"
@@ -25,6 +27,20 @@ bool WiGLE::batchMode = false;
 
 static const size_t WIGLE_MAX_UPLOADED = 200;
 
+// Compressed upload body: streamed to the session, or only counted when
+// session is null (the Content-Length pass)
+struct GzipSend {
+    SyncSession* session;
+    uint32_t bytes;
+};
+
+static bool gzipSink(const uint8_t* data, size_t len, void* ctx) {
+    GzipSend& send = *static_cast<GzipSend*>(ctx);
+    if (send.session && !send.session->write(data, len)) return false;
+    send.bytes += (uint32_t)len;
+    return true;
+}
+
 // RAII helper for busy flag
 struct BusyScope {
     volatile bool& flag;
@@ -251,7 +267,7 @@ bool WiGLE::canSync() {
     return HeapGates::canTls(tls, lastError, sizeof(lastError));
 }
 
-bool WiGLE::uploadSingleFile(const char* csvPath) {
+bool WiGLE::uploadSingleFile(SyncSession& session, const char* csvPath, GzipStream* gz) {
     if (!csvPath) return false;
     
     Serial.printf("[WIGLE] Uploading: %s\n", csvPath);
@@ -286,27 +302,34 @@ bool WiGLE::uploadSingleFile(const char* csvPath) {
     char authHeader[192];  // "Basic " + b64 + NUL
     snprintf(authHeader, sizeof(authHeader), "Basic %s", b64Buf);
 
-    // Create WiFiClientSecure with minimal buffers
-    WiFiClientSecure client;
-    client.setInsecure();  // Skip cert validation - saves ~10KB heap
-    // NOTE: setNoDelay()/setTimeout() before connect() causes EBADF errors
-    // Socket doesn't exist yet - those calls require an active socket
+    // Stream file in chunks (heap-safe, 2KB for fewer TLS operations)
+    const size_t CHUNK_SIZE = 2048;
+    uint8_t chunk[CHUNK_SIZE];
 
-    // Connect with timeout (15s)
-    Serial.printf("[WIGLE] Connecting to %s:%d\n", API_HOST, API_PORT);
-    if (!client.connect(API_HOST, API_PORT, 15000)) {
-        csvFile.close();
-        // Capture mbedTLS error for diagnostics
-        char tlsErr[64] = {0};
-        int errCode = client.lastError(tlsErr, sizeof(tlsErr) - 1);
-        snprintf(lastError, sizeof(lastError), "TLS CONNECT: %d", errCode);
-        Serial.printf("[WIGLE] TLS connect failed: err=%d (%s)\n", errCode, tlsErr);
-        return false;
+    // WiGLE takes .csv.gz as is. Compress once only to learn the body size
+    // (nothing is sent), then again while streaming: the output is the same
+    // bytes both times. Plain CSV if that would not be smaller.
+    uint32_t gzBytes = 0;
+    if (gz) {
+        GzipSend count = {nullptr, 0};
+        bool ok = gz->begin(gzipSink, &count);
+        size_t left = fileSize;
+        while (ok && left > 0) {
+            size_t n = csvFile.read(chunk, left > CHUNK_SIZE ? CHUNK_SIZE : left);
+            ok = n > 0 && gz->write(chunk, n);
+            left -= ok ? n : 0;
+            yield();
+        }
+        ok = gz->finish() && ok;
+        if (ok && count.bytes < fileSize) {
+            gzBytes = count.bytes;
+            Serial.printf("[WIGLE] gzip: %u -> %u bytes\n",
+                          (unsigned int)fileSize, (unsigned int)gzBytes);
+        } else {
+            gz = nullptr;
+        }
     }
-    
-    // Set timeout for upload operations (30s - uploads can be slow)
-    client.setTimeout(30000);
-    
+
     // Build multipart boundary
     char boundary[48];
     snprintf(boundary, sizeof(boundary), "----PorkchopWiGLE%08lX", millis());
@@ -317,129 +340,99 @@ bool WiGLE::uploadSingleFile(const char* csvPath) {
     char bodyStart[220];
     int bodyStartLen = snprintf(bodyStart, sizeof(bodyStart),
         "--%s\r\n"
-        "Content-Disposition: form-data; name=\"file\"; filename=\"%s\"\r\n"
-        "Content-Type: text/csv\r\n\r\n",
-        boundary, filename);
+        "Content-Disposition: form-data; name=\"file\"; filename=\"%s%s\"\r\n"
+        "Content-Type: %s\r\n\r\n",
+        boundary, filename, gz ? ".gz" : "", gz ? "application/gzip" : "text/csv");
     
     // bodyEnd: "\r\n--boundary--\r\n" (~60 bytes max)
     char bodyEnd[64];
     int bodyEndLen = snprintf(bodyEnd, sizeof(bodyEnd), "\r\n--%s--\r\n", boundary);
     
-    size_t contentLength = bodyStartLen + fileSize + bodyEndLen;
-    
-    // Send HTTP headers
-    client.printf("POST %s HTTP/1.1\r\n", UPLOAD_PATH);
-    client.printf("Host: %s\r\n", API_HOST);
-    client.print("Authorization: ");
-    client.print(authHeader);
-    client.print("\r\n");
-    client.printf("Content-Type: multipart/form-data; boundary=%s\r\n", boundary);
-    client.printf("Content-Length: %u\r\n", (unsigned int)contentLength);
-    client.print("Connection: close\r\n\r\n");
+    size_t contentLength = bodyStartLen + (gz ? gzBytes : fileSize) + bodyEndLen;
+    char contentType[96];
+    snprintf(contentType, sizeof(contentType), "multipart/form-data; boundary=%s", boundary);
     
-    // Send multipart body start
-    client.print(bodyStart);
-    
-    // Stream file in chunks (heap-safe, 2KB for fewer TLS operations)
-    const size_t CHUNK_SIZE = 2048;
-    uint8_t chunk[CHUNK_SIZE];
-    size_t bytesRemaining = fileSize;
-    size_t bytesSent = 0;
+    int statusCode = 0;
+    char body[260];
+    size_t bodyLen = 0;
     
-    while (bytesRemaining > 0) {
-        // Verify connection is still alive before each chunk
-        if (!client.connected()) {
-            char tlsErr[64] = {0};
-            int errCode = client.lastError(tlsErr, sizeof(tlsErr) - 1);
-            snprintf(lastError, sizeof(lastError), "CONN LOST @%uB: %d", 
-                     (unsigned int)bytesSent, errCode);
-            Serial.printf("[WIGLE] Connection lost during upload: sent=%u/%u, err=%d (%s)\n",
-                          (unsigned int)bytesSent, (unsigned int)fileSize, errCode, tlsErr);
+    // A kept-alive connection the server dropped meanwhile gets one resend
+    for (uint8_t attempt = 0; attempt < 2; attempt++) {
+        if (!session.begin("POST", UPLOAD_PATH)) {
             csvFile.close();
-            client.stop();
+            // Capture mbedTLS error for diagnostics
+            char tlsErr[64] = {0};
+            int errCode = session.lastTlsError(tlsErr, sizeof(tlsErr) - 1);
+            snprintf(lastError, sizeof(lastError), "TLS CONNECT: %d", errCode);
             return false;
         }
+        session.header("Authorization", authHeader);
+        session.header("Content-Type", contentType);
+        bool sent = session.endHeaders((long)contentLength) && session.print(bodyStart);
         
-        size_t toRead = (bytesRemaining > CHUNK_SIZE) ? CHUNK_SIZE : bytesRemaining;
-        size_t bytesRead = csvFile.read(chunk, toRead);
-        if (bytesRead == 0) {
-            snprintf(lastError, sizeof(lastError), "SD READ @%uB", (unsigned int)bytesSent);
-            Serial.printf("[WIGLE] SD read failed at offset %u/%u\n", 
-                          (unsigned int)bytesSent, (unsigned int)fileSize);
-            csvFile.close();
-            client.stop();
-            return false;
+        size_t bytesRemaining = fileSize;
+        size_t bytesSent = 0;
+        csvFile.seek(0);
+        GzipSend send = {&session, 0};
+        if (sent && gz) gz->begin(gzipSink, &send);
+        while (sent && bytesRemaining > 0) {
+            size_t toRead = (bytesRemaining > CHUNK_SIZE) ? CHUNK_SIZE : bytesRemaining;
+            size_t bytesRead = csvFile.read(chunk, toRead);
+            if (bytesRead == 0) {
+                snprintf(lastError, sizeof(lastError), "SD READ @%uB", (unsigned int)bytesSent);
+                Serial.printf("[WIGLE] SD read failed at offset %u/%u\n", 
+                              (unsigned int)bytesSent, (unsigned int)fileSize);
+                csvFile.close();
+                if (gz) gz->finish();
+                session.end();   // Aborted mid-body: no response, closes
+                return false;
+            }
+            
+            if (!(gz ? gz->write(chunk, bytesRead) : session.write(chunk, bytesRead))) {
+                char tlsErr[64] = {0};
+                int errCode = session.lastTlsError(tlsErr, sizeof(tlsErr) - 1);
+                snprintf(lastError, sizeof(lastError), "TLS WRITE: %d @%uB", 
+                         errCode, (unsigned int)bytesSent);
+                Serial.printf("[WIGLE] TLS write failed: sent=%u/%u, err=%d (%s)\n",
+                              (unsigned int)bytesSent, (unsigned int)fileSize, errCode, tlsErr);
+                sent = false;
+                break;
+            }
+            
+            bytesSent += bytesRead;
+            bytesRemaining -= bytesRead;
+            yield();  // Let WiFi stack breathe
         }
         
-        size_t written = client.write(chunk, bytesRead);
-        if (written != bytesRead) {
+        if (gz && !gz->finish() && sent) {
+            // Last compressed block did not go out
             char tlsErr[64] = {0};
-            int errCode = client.lastError(tlsErr, sizeof(tlsErr) - 1);
-            snprintf(lastError, sizeof(lastError), "TLS WRITE: %d @%uB", 
+            int errCode = session.lastTlsError(tlsErr, sizeof(tlsErr) - 1);
+            snprintf(lastError, sizeof(lastError), "TLS WRITE: %d @%uB",
                      errCode, (unsigned int)bytesSent);
-            Serial.printf("[WIGLE] TLS write failed: wrote=%u/%u, sent=%u/%u, err=%d (%s), conn=%d\n",
-                          (unsigned int)written, (unsigned int)bytesRead,
-                          (unsigned int)bytesSent, (unsigned int)fileSize,
-                          errCode, tlsErr, client.connected());
-            csvFile.close();
-            client.stop();
-            return false;
+            sent = false;
         }
-        
-        bytesSent += bytesRead;
-        bytesRemaining -= bytesRead;
-        yield();  // Let WiFi stack breathe
-    }
-    csvFile.close();
-    
-    // Send multipart body end
-    client.print(bodyEnd);
-    client.flush();
-    
-    // Read response
-    unsigned long timeout = millis() + 15000;
-    while (client.connected() && !client.available() && millis() < timeout) {
-        delay(10);
-        yield();
-    }
-    
-    // Parse HTTP status code
-    int statusCode = 0;
-    if (client.available()) {
-        char statusLine[64];
-        size_t sLen = client.readBytesUntil('\n', statusLine, sizeof(statusLine) - 1);
-        statusLine[sLen] = '\0';
-        // Parse "HTTP/1.1 200 OK"
-        const char* sp = strchr(statusLine, ' ');
-        if (sp) statusCode = atoi(sp + 1);
-    }
-
-    // Skip headers
-    {
-        char hBuf[128];
-        while (client.connected()) {
-            size_t hLen = client.readBytesUntil('\n', hBuf, sizeof(hBuf) - 1);
-            hBuf[hLen] = '\0';
-            if (hLen <= 1) break;  // Empty line or just \r
+        if (gz && sent && send.bytes != gzBytes) {
+            // CSV changed since the size pass; the body is not Content-Length
+            strncpy(lastError, "GZIP SIZE CHANGED", sizeof(lastError) - 1);
+            sent = false;
         }
-    }
-    
-    // Read response body (for error context)
-    // FIX: Use stack buffer to avoid heap fragmentation from char-by-char concat
-    char body[260];
-    size_t bodyLen = 0;
-    unsigned long bodyTimeout = millis() + 5000;
-    while ((client.connected() || client.available()) && 
-           bodyLen < sizeof(body) - 1 && millis() < bodyTimeout) {
-        if (client.available()) {
-            body[bodyLen++] = (char)client.read();
-        } else {
-            delay(1);
+        
+        // Send multipart body end, then read the status and body (for error context)
+        sent = sent && session.print(bodyEnd);
+        statusCode = sent ? session.awaitResponse(15000) : 0;
+        bodyLen = 0;
+        size_t n;
+        while (statusCode > 0 && bodyLen < sizeof(body) - 1 &&
+               (n = session.read((uint8_t*)body + bodyLen, sizeof(body) - 1 - bodyLen)) > 0) {
+            bodyLen += n;
         }
+        body[bodyLen] = '\0';
+        session.end();
+        if (statusCode != 0 || !session.shouldRetry()) break;
+        Serial.println("[WIGLE] Kept-alive connection dropped, resending");
     }
-    body[bodyLen] = '\0';
-    
-    client.stop();
+    csvFile.close();
     
     // Check for success
     bool success = false;
@@ -459,23 +452,23 @@ bool WiGLE::uploadSingleFile(const char* csvPath) {
         // NOTE: Don't mark uploaded here - caller handles marking after all TLS operations
         // This avoids reloading list during TLS when heap is tight
         Serial.printf("[WIGLE] Upload success: %s\n", csvPath);
-        SDLog::log("WIGLE", "Upload OK: %s", filename);
+        SDLog::event(SDLogMsg::WIGLE_UPLOAD_OK, filename);
         return true;
     }
     
     // Build error message
     if (statusCode > 0) {
         snprintf(lastError, sizeof(lastError), "HTTP %d", statusCode);
-    } else {
+    } else if (strncmp(lastError, "TLS", 3) != 0) {
         strncpy(lastError, "NO RESPONSE", sizeof(lastError) - 1);
     }
     
     Serial.printf("[WIGLE] Upload failed: %s - %s\n", csvPath, lastError);
-    SDLog::log("WIGLE", "Upload failed: %s", filename);
+    SDLog::event(SDLogMsg::WIGLE_UPLOAD_FAILED, filename);
     return false;
 }
 
-bool WiGLE::fetchStats() {
+bool WiGLE::fetchStats(SyncSession& session) {
     Serial.println("[WIGLE] Fetching user stats...");
     
     // Build Basic Auth header on stack — no heap allocation during TLS window
@@ -489,74 +482,37 @@ bool WiGLE::fetchStats() {
     char authHeader[192];
     snprintf(authHeader, sizeof(authHeader), "Basic %s", b64Buf);
     
-    // Create WiFiClientSecure
-    WiFiClientSecure client;
-    client.setInsecure();
-    client.setTimeout(30000);
-    
-    if (!client.connect(API_HOST, API_PORT, 10000)) {
-        strncpy(lastError, "STATS TLS FAILED", sizeof(lastError) - 1);
-        Serial.println("[WIGLE] Stats TLS connection failed");
-        return false;
-    }
-    
-    // Send GET request
-    client.printf("GET %s HTTP/1.1\r\n", STATS_PATH);
-    client.printf("Host: %s\r\n", API_HOST);
-    client.print("Authorization: ");
-    client.print(authHeader);
-    client.print("\r\n");
-    client.print("Connection: close\r\n\r\n");
-    
-    // Wait for response
-    unsigned long timeout = millis() + 15000;
-    while (client.connected() && !client.available() && millis() < timeout) {
-        delay(10);
-        yield();
-    }
-    
-    // Read status code
     int statusCode = 0;
-    if (client.available()) {
-        char statusLine[64];
-        size_t sLen = client.readBytesUntil('\n', statusLine, sizeof(statusLine) - 1);
-        statusLine[sLen] = '\0';
-        const char* sp = strchr(statusLine, ' ');
-        if (sp) statusCode = atoi(sp + 1);
+    for (uint8_t attempt = 0; attempt < 2; attempt++) {
+        if (!session.begin("GET", STATS_PATH)) {
+            strncpy(lastError, "STATS TLS FAILED", sizeof(lastError) - 1);
+            Serial.println("[WIGLE] Stats TLS connection failed");
+            return false;
+        }
+        session.header("Authorization", authHeader);
+        statusCode = session.endHeaders(-1) ? session.awaitResponse(15000) : 0;
+        if (statusCode != 0 || !session.shouldRetry()) break;
+        session.end();
     }
 
     if (statusCode != 200) {
-        client.stop();
+        session.end();
         snprintf(lastError, sizeof(lastError), "STATS HTTP %d", statusCode);
         return false;
     }
     
-    // Skip headers
-    {
-        char hBuf[128];
-        while (client.connected()) {
-            size_t hLen = client.readBytesUntil('\n', hBuf, sizeof(hBuf) - 1);
-            hBuf[hLen] = '\0';
-            if (hLen <= 1) break;
-        }
-    }
-    
     // Read JSON body
     // FIX: Use stack buffer to avoid heap fragmentation from char-by-char concat
     char body[2050];
     size_t bodyLen = 0;
-    unsigned long bodyTimeout = millis() + 10000;
-    while ((client.connected() || client.available()) && 
-           bodyLen < sizeof(body) - 1 && millis() < bodyTimeout) {
-        if (client.available()) {
-            body[bodyLen++] = (char)client.read();
-        } else {
-            delay(1);
-        }
+    size_t n;
+    while (bodyLen < sizeof(body) - 1 &&
+           (n = session.read((uint8_t*)body + bodyLen, sizeof(body) - 1 - bodyLen, 10000)) > 0) {
+        bodyLen += n;
     }
     body[bodyLen] = '\0';
     
-    client.stop();
+    session.end();
     
     // Parse JSON
     JsonDocument doc;
@@ -733,6 +689,18 @@ WigleSyncResult WiGLE::syncFiles(WigleProgressCallback cb) {
     // Free memory before TLS operations - keeps heap clear for WiFiClientSecure
     freeUploadedListMemory();
     
+    // gzip encoder for the uploads, only with room for it beside the TLS
+    // buffers; without it files go up as plain CSV
+    GzipStream* gz = nullptr;
+    if (pendingCount > 0 &&
+        heap_caps_get_largest_free_block(MALLOC_CAP_8BIT) >= HeapPolicy::kMinContigForTls + sizeof(GzipStream)) {
+        void* mem = heap_caps_malloc(sizeof(GzipStream), MALLOC_CAP_8BIT);
+        if (mem) gz = new (mem) GzipStream();
+    }
+    
+    // One TLS connection for every upload and the stats fetch (keep-alive)
+    SyncSession session(API_HOST, API_PORT, "WIGLE");
+    
     // Track successful uploads with bitmask - avoids reloading list during TLS
     // We mark uploaded AFTER all TLS operations complete to keep heap clear
     uint8_t successMask[50] = {0};
@@ -751,7 +719,7 @@ WigleSyncResult WiGLE::syncFiles(WigleProgressCallback cb) {
         Serial.printf("[WIGLE] Heap before upload %u: %u\n", 
                       i, (unsigned int)ESP.getFreeHeap());
         
-        if (uploadSingleFile(pendingUploads[i].path)) {
+        if (uploadSingleFile(session, pendingUploads[i].path, gz)) {
             result.uploaded++;
             successMask[i] = 1;  // Track for deferred marking
         } else {
@@ -759,13 +727,15 @@ WigleSyncResult WiGLE::syncFiles(WigleProgressCallback cb) {
             Serial.printf("[WIGLE] Failed: %s\n", pendingUploads[i].path);
         }
         
-        // Small delay between uploads to let heap settle
-        delay(100);
         yield();
     }
     
-    // Mark successful uploads AFTER all TLS operations complete
-    // This avoids list reload during TLS when heap is tight
+    if (gz) {
+        gz->~GzipStream();
+        heap_caps_free(gz);
+    }
+    
+    // Mark successful uploads after the upload loop, not per request
     if (result.uploaded > 0) {
         if (cb) {
             cb("marking uploads", 0, 0);
@@ -788,7 +758,7 @@ WigleSyncResult WiGLE::syncFiles(WigleProgressCallback cb) {
             }
         }
         saveUploadedList();
-        Serial.printf("[WIGLE] Marked %u uploads after TLS complete\n", result.uploaded);
+        Serial.printf("[WIGLE] Marked %u uploads\n", result.uploaded);
     }
     
     // Fetch stats after uploads
@@ -807,9 +777,10 @@ WigleSyncResult WiGLE::syncFiles(WigleProgressCallback cb) {
                   (unsigned int)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
     
     // Attempt stats fetch if heap sufficient - no reconditioning, graceful skip if low
+    // A still-open upload connection needs no new handshake, so no gate
     HeapGates::GateStatus statsGate = HeapGates::checkGate(0, HeapPolicy::kMinContigForTls);
-    if (statsGate.failure == HeapGates::TlsGateFailure::None) {
-        result.statsFetched = fetchStats();
+    if (session.isConnected() || statsGate.failure == HeapGates::TlsGateFailure::None) {
+        result.statsFetched = fetchStats(session);
         if (!result.statsFetched) {
             Serial.printf("[WIGLE] Stats fetch failed: %s\n", lastError);
         }
@@ -818,6 +789,10 @@ WigleSyncResult WiGLE::syncFiles(WigleProgressCallback cb) {
         result.statsFetched = false;
     }
     
+    Serial.printf("[WIGLE] Session: %u requests, %u TLS handshakes\n",
+                  (unsigned int)session.requestCount(), (unsigned int)session.handshakeCount());
+    session.close();
+    
     // Determine overall success
     if (result.uploaded > 0 || (pendingCount == 0 && result.skipped > 0)) {
         result.success = true;
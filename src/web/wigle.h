@@ -5,6 +5,9 @@
 #include <Arduino.h>
 #include <vector>
 #include "../core/heap_policy.h"
+#include "sync_session.h"
+
+class GzipStream;
 
 // Upload status for tracking
 enum class WigleUploadStatus {
@@ -111,6 +114,6 @@ private:
     static const char* getFilenameFromPath(const char* path);
     
     // Network helpers (internal)
-    static bool uploadSingleFile(const char* csvPath);
-    static bool fetchStats();
+    static bool uploadSingleFile(SyncSession& session, const char* csvPath, GzipStream* gz);  // gz: nullptr sends plain CSV
+    static bool fetchStats(SyncSession& session);
 };
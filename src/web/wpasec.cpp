@@ -20,11 +20,11 @@ static const uint16_t WPASEC_PORT = 443;
 static const char* WPASEC_UPLOAD_PATH = "/";
 static const char* WPASEC_POTFILE_PATH = "/?api&dl=1";
 static const size_t WPASEC_MAX_CACHE_ENTRIES = 500;
+static const size_t WPASEC_UPLOAD_CHUNK = 1024;     // SD read / TLS write size
 
 // Static member initialization
 bool WPASec::cacheLoaded = false;
 char WPASec::lastError[64] = "";
-std::vector<WPASec::CrackedEntry> WPASec::crackedCache;
 std::vector<WPASec::UploadedEntry> WPASec::uploadedCache;
 volatile bool WPASec::busy = false;
 bool WPASec::batchMode = false;
@@ -86,80 +86,15 @@ bool WPASec::loadUploadedList() {
 bool WPASec::loadCache() {
     if (cacheLoaded) return true;
 
-    crackedCache.clear();
-    crackedCache.reserve(128);  // 128 * 110B = 14KB — avoids 6 reallocations vs no reserve
     uploadedCache.clear();
 
+    // Sorted index over the potfile: built once per potfile, then only the
+    // header and fences are read here
     const char* cachePath = SDLayout::wpasecResultsPath();
-    if (SD.exists(cachePath)) {
-        File f = SD.open(cachePath, FILE_READ);
-        if (!f) {
-            strncpy(lastError, "CANNOT OPEN CACHE", sizeof(lastError) - 1);
-            lastError[sizeof(lastError) - 1] = '\0';
-            return false;
-        }
-
-        // Format: AP_BSSID:CLIENT_BSSID:SSID:password (WPA-SEC potfile format)
-        // AP_BSSID is always 12 hex chars, CLIENT_BSSID is always 12 hex chars
-        // Cap at 500 entries to prevent memory exhaustion
-        char lineBuf[160];
-        while (f.available() && crackedCache.size() < WPASEC_MAX_CACHE_ENTRIES) {
-            size_t len = f.readBytesUntil('\n', lineBuf, sizeof(lineBuf) - 1);
-            lineBuf[len] = '\0';
-            // Trim trailing whitespace
-            while (len > 0 && (lineBuf[len - 1] == '\r' || lineBuf[len - 1] == ' ')) {
-                lineBuf[--len] = '\0';
-            }
-            if (len == 0) continue;
-
-            // WPA-SEC potfile: AP_BSSID:CLIENT_BSSID:SSID:password
-            // Both BSSIDs are exactly 12 hex chars (no colons)
-            // Password can contain colons, so we must find the THIRD colon
-            // Find colons by scanning
-            const char* firstColon = nullptr;
-            const char* secondColon = nullptr;
-            const char* thirdColon = nullptr;
-            for (const char* p = lineBuf; *p; p++) {
-                if (*p == ':') {
-                    if (!firstColon) firstColon = p;
-                    else if (!secondColon) secondColon = p;
-                    else if (!thirdColon) { thirdColon = p; break; }
-                }
-            }
-
-            // Validate: AP BSSID at pos 0-11 (colon at 12), client BSSID at pos 13-24 (colon at 25)
-            if (firstColon && secondColon && thirdColon &&
-                (firstColon - lineBuf) == 12 &&
-                (secondColon - lineBuf) == 25 &&
-                thirdColon > secondColon) {
-
-                CrackedEntry entry;
-                memset(&entry, 0, sizeof(entry));
-
-                // AP BSSID: first 12 chars, normalize
-                char rawBssid[13];
-                memcpy(rawBssid, lineBuf, 12);
-                rawBssid[12] = '\0';
-                normalizeBSSID_Char(rawBssid, entry.bssid, sizeof(entry.bssid));
-
-                // SSID: between 2nd and 3rd colon
-                size_t ssidLen = (size_t)(thirdColon - secondColon - 1);
-                if (ssidLen >= sizeof(entry.ssid)) ssidLen = sizeof(entry.ssid) - 1;
-                memcpy(entry.ssid, secondColon + 1, ssidLen);
-                entry.ssid[ssidLen] = '\0';
-
-                // Password: everything after 3rd colon
-                const char* pwStart = thirdColon + 1;
-                size_t pwLen = strlen(pwStart);
-                if (pwLen >= sizeof(entry.password)) pwLen = sizeof(entry.password) - 1;
-                memcpy(entry.password, pwStart, pwLen);
-                entry.password[pwLen] = '\0';
-
-                crackedCache.push_back(entry);
-            }
-        }
-
-        f.close();
+    if (SD.exists(cachePath) && !CrackedIndex::open()) {
+        strncpy(lastError, "CANNOT INDEX CACHE", sizeof(lastError) - 1);
+        lastError[sizeof(lastError) - 1] = '\0';
+        return false;
     }
 
     if (!loadUploadedList()) {
@@ -174,13 +109,15 @@ bool WPASec::loadCache() {
 // Local Cache Queries
 // ============================================================================
 
-const WPASec::CrackedEntry* WPASec::findCracked(const char* normalizedBssid) {
-    for (size_t i = 0; i < crackedCache.size(); i++) {
-        if (strcmp(crackedCache[i].bssid, normalizedBssid) == 0) {
-            return &crackedCache[i];
-        }
+const CrackedIndex::Entry* WPASec::findCracked(const char* normalizedBssid) {
+    if (strlen(normalizedBssid) != 12) return nullptr;
+    uint8_t bssid[6];
+    for (int i = 0; i < 6; i++) {
+        char hex[3] = {normalizedBssid[i * 2], normalizedBssid[i * 2 + 1], '\0'};
+        if (!isxdigit((unsigned char)hex[0]) || !isxdigit((unsigned char)hex[1])) return nullptr;
+        bssid[i] = (uint8_t)strtoul(hex, nullptr, 16);
     }
-    return nullptr;
+    return CrackedIndex::find(bssid);
 }
 
 bool WPASec::isCracked(const char* bssid) {
@@ -194,7 +131,7 @@ const char* WPASec::getPassword(const char* bssid) {
     loadCache();
     char key[13];
     normalizeBSSID_Char(bssid, key, sizeof(key));
-    const CrackedEntry* entry = findCracked(key);
+    const CrackedIndex::Entry* entry = findCracked(key);
     return entry ? entry->password : "";
 }
 
@@ -202,13 +139,14 @@ const char* WPASec::getSSID(const char* bssid) {
     loadCache();
     char key[13];
     normalizeBSSID_Char(bssid, key, sizeof(key));
-    const CrackedEntry* entry = findCracked(key);
+    const CrackedIndex::Entry* entry = findCracked(key);
     return entry ? entry->ssid : "";
 }
 
 uint16_t WPASec::getCrackedCount() {
     loadCache();
-    return crackedCache.size();
+    uint32_t count = CrackedIndex::count();
+    return count > 0xFFFF ? 0xFFFF : (uint16_t)count;
 }
 
 bool WPASec::isUploaded(const char* bssid) {
@@ -227,10 +165,9 @@ const char* WPASec::getLastError() {
 }
 
 void WPASec::freeCacheMemory() {
-    size_t crackedCount = crackedCache.size();
+    size_t crackedCount = CrackedIndex::count();
     size_t uploadedCount = uploadedCache.size();
-    crackedCache.clear();
-    crackedCache.shrink_to_fit();
+    CrackedIndex::close();
     uploadedCache.clear();
     uploadedCache.shrink_to_fit();
     cacheLoaded = false;
@@ -318,241 +255,218 @@ bool WPASec::canSync() {
     return HeapGates::canTls(tls, lastError, sizeof(lastError));
 }
 
-bool WPASec::uploadSingleCapture(const char* filepath, const char* bssid) {
-    if (!filepath || !bssid) return false;
-    
+// Capture files queued by one sync (paths kept until the uploads finish)
+struct PendingUpload {
+    char path[80];
+    char bssid[13];
+};
+static PendingUpload pendingUploads[16];  // Max 16 per sync (reduced from 50, saves ~3KB BSS)
+
+WPASec::UploadSend WPASec::sendCapture(SyncSession& session, const char* filepath, bool queued) {
     Serial.printf("[WPASEC] Uploading: %s\n", filepath);
     
     // Check file exists and get size
     File capFile = SD.open(filepath, FILE_READ);
     if (!capFile) {
         Serial.printf("[WPASEC] Cannot open file: %s\n", filepath);
-        return false;
+        return UploadSend::Invalid;
     }
     size_t fileSize = capFile.size();
     if (fileSize == 0 || fileSize > 100000) {  // Max 100KB
         capFile.close();
         Serial.printf("[WPASEC] Invalid file size: %u\n", (unsigned int)fileSize);
-        return false;
+        return UploadSend::Invalid;
     }
     
     // Extract filename from path
     const char* filename = strrchr(filepath, '/');
     filename = filename ? filename + 1 : filepath;
     
-    // Create WiFiClientSecure with minimal buffers
-    WiFiClientSecure client;
-    client.setInsecure();  // Skip cert validation - saves ~10KB heap
-    
-    // Connect with timeout
-    Serial.printf("[WPASEC] Connecting to %s:%d\n", WPASEC_HOST, WPASEC_PORT);
-    if (!client.connect(WPASEC_HOST, WPASEC_PORT, 10000)) {
-        capFile.close();
-        char tlsErr[64] = {0};
-        int errCode = client.lastError(tlsErr, sizeof(tlsErr) - 1);
-        snprintf(lastError, sizeof(lastError), "TLS CONNECT: %d", errCode);
-        Serial.printf("[WPASEC] TLS connect failed: err=%d (%s)\n", errCode, tlsErr);
-        return false;
-    }
-    
     // Build multipart boundary
     char boundary[32];
     snprintf(boundary, sizeof(boundary), "----WPASec%08lX", millis());
     
-    // Calculate content length
     // Multipart format:
     // --boundary\r\n
     // Content-Disposition: form-data; name="file"; filename="xxx"\r\n
     // Content-Type: application/octet-stream\r\n\r\n
     // <file data>
     // \r\n--boundary--\r\n
-    char disposition[128];
-    snprintf(disposition, sizeof(disposition),
-             "Content-Disposition: form-data; name=\"file\"; filename=\"%s\"",
-             filename);
-    
-    size_t contentLength = 2 + strlen(boundary) + 2 +           // --boundary\r\n
-                           strlen(disposition) + 2 +             // disposition\r\n
-                           36 + 4 +                              // Content-Type + \r\n\r\n
-                           fileSize +                            // file data
-                           2 + 2 + strlen(boundary) + 4;         // \r\n--boundary--\r\n
-    
-    // Send HTTP headers
-    client.printf("POST %s HTTP/1.1\r\n", WPASEC_UPLOAD_PATH);
-    client.printf("Host: %s\r\n", WPASEC_HOST);
-    client.printf("Cookie: key=%s\r\n", Config::wifi().wpaSecKey);
-    client.printf("Content-Type: multipart/form-data; boundary=%s\r\n", boundary);
-    client.printf("Content-Length: %u\r\n", (unsigned int)contentLength);
-    client.print("Connection: close\r\n\r\n");
-    
-    // Send multipart body
-    client.printf("--%s\r\n", boundary);
-    client.printf("%s\r\n", disposition);
-    client.print("Content-Type: application/octet-stream\r\n\r\n");
-    
-    // Stream file in chunks (heap-safe)
-    char chunk[256];
-    size_t sent = 0;
-    while (capFile.available() && sent < fileSize) {
-        size_t toRead = min((size_t)sizeof(chunk), fileSize - sent);
-        size_t bytesRead = capFile.read((uint8_t*)chunk, toRead);
-        if (bytesRead > 0) {
-            client.write((uint8_t*)chunk, bytesRead);
-            sent += bytesRead;
+    char bodyStart[200];
+    int bodyStartLen = snprintf(bodyStart, sizeof(bodyStart),
+        "--%s\r\n"
+        "Content-Disposition: form-data; name=\"file\"; filename=\"%s\"\r\n"
+        "Content-Type: application/octet-stream\r\n\r\n",
+        boundary, filename);
+    char bodyEnd[48];
+    int bodyEndLen = snprintf(bodyEnd, sizeof(bodyEnd), "\r\n--%s--\r\n", boundary);
+    size_t contentLength = bodyStartLen + fileSize + bodyEndLen;
+
+    char cookie[48];
+    snprintf(cookie, sizeof(cookie), "key=%s", Config::wifi().wpaSecKey);
+    char contentType[80];
+    snprintf(contentType, sizeof(contentType), "multipart/form-data; boundary=%s", boundary);
+    
+    bool started = queued ? session.queue("POST", WPASEC_UPLOAD_PATH)
+                          : session.begin("POST", WPASEC_UPLOAD_PATH);
+    if (!started) {
+        capFile.close();
+        if (!queued) {
+            char tlsErr[64] = {0};
+            int errCode = session.lastTlsError(tlsErr, sizeof(tlsErr) - 1);
+            snprintf(lastError, sizeof(lastError), "TLS CONNECT: %d", errCode);
         }
+        return UploadSend::NotSent;
+    }
+    session.header("Cookie", cookie);
+    session.header("Content-Type", contentType);
+    bool sent = session.endHeaders((long)contentLength) && session.print(bodyStart);
+    
+    // Stream file in fixed chunks (heap-safe)
+    uint8_t chunk[WPASEC_UPLOAD_CHUNK];
+    size_t done = 0;
+    while (sent && done < fileSize) {
+        size_t toRead = min((size_t)sizeof(chunk), fileSize - done);
+        size_t bytesRead = capFile.read(chunk, toRead);
+        if (bytesRead == 0) break;
+        sent = session.write(chunk, bytesRead);
+        done += bytesRead;
         yield();  // Let WiFi stack breathe
     }
     capFile.close();
-    
-    // End multipart
-    client.printf("\r\n--%s--\r\n", boundary);
-    
-    // Read response (just check status code)
-    unsigned long timeout = millis() + 10000;
-    while (client.connected() && !client.available() && millis() < timeout) {
-        delay(10);
-        yield();  // Prevent WDT during response wait
-    }
-    
-    bool success = false;
-    if (client.available()) {
-        char response[64];
-        size_t len = client.readBytesUntil('\n', response, sizeof(response) - 1);
-        response[len] = '\0';
-        Serial.printf("[WPASEC] Response: %s\n", response);
+    sent = sent && done == fileSize && session.print(bodyEnd);
+    return sent ? UploadSend::Sent : UploadSend::Broken;
+}
+
+void WPASec::uploadPending(SyncSession& session, uint8_t pendingCount, uint8_t* successMask,
+                           WPASecSyncResult& result, WPASecProgressCallback cb) {
+    // Work queue of pending upload slots; a dropped connection sends a
+    // capture once more (a repeat upload is answered with 409)
+    uint8_t todo[32];
+    uint8_t head = 0, tail = 0;
+    uint8_t attempts[16] = {0};
+    for (uint8_t i = 0; i < pendingCount; i++) todo[tail++] = i;
+    uint8_t finished = 0;
+    
+    while (head < tail) {
+        Serial.printf("[WPASEC] Heap before upload %u: %u\n", 
+                      (unsigned int)finished, (unsigned int)ESP.getFreeHeap());
         
-        // HTTP/1.1 200 OK or similar success
-        if (strstr(response, "200") || strstr(response, "201")) {
-            success = true;
-        } else if (strstr(response, "409")) {
-            // Already uploaded - treat as success
-            success = true;
-            Serial.println("[WPASEC] Already uploaded (409)");
+        // Send up to WPASEC_PIPELINE_DEPTH requests back to back...
+        uint8_t window[WPASEC_PIPELINE_DEPTH];
+        uint8_t inFlight = 0;
+        while (inFlight < WPASEC_PIPELINE_DEPTH && head < tail) {
+            uint8_t i = todo[head++];
+            UploadSend sent = sendCapture(session, pendingUploads[i].path, inFlight > 0);
+            if (sent == UploadSend::NotSent && inFlight > 0) {
+                head--;   // Connection went away: goes out with the next window
+                break;
+            }
+            attempts[i]++;
+            if (sent == UploadSend::Invalid || sent == UploadSend::NotSent) {
+                result.failed++;
+                finished++;
+                Serial.printf("[WPASEC] Failed: %s\n", pendingUploads[i].path);
+                continue;
+            }
+            window[inFlight++] = i;
+            if (sent == UploadSend::Broken) break;
         }
+        
+        // ...then read their responses in order
+        for (uint8_t k = 0; k < inFlight; k++) {
+            uint8_t i = window[k];
+            int status = session.awaitResponse(10000);
+            bool resend = status == 0 && session.shouldRetry();
+            session.end();
+            
+            if (status == 200 || status == 201 || status == 409) {
+                // NOTE: Don't mark uploaded here - caller handles marking after all TLS operations
+                if (status == 409) Serial.println("[WPASEC] Already uploaded (409)");
+                Serial.printf("[WPASEC] Upload success: %s\n", pendingUploads[i].bssid);
+                result.uploaded++;
+                successMask[i] = 1;  // Track for deferred marking
+            } else if (resend && attempts[i] < 2) {
+                Serial.printf("[WPASEC] Connection dropped, resending: %s\n", pendingUploads[i].path);
+                todo[tail++] = i;
+                continue;
+            } else {
+                if (status != 0) {
+                    snprintf(lastError, sizeof(lastError), "UPLOAD REJECTED: %d", status);
+                } else if (strncmp(lastError, "TLS", 3) != 0) {
+                    strncpy(lastError, "UPLOAD REJECTED", sizeof(lastError) - 1);
+                }
+                result.failed++;
+                Serial.printf("[WPASEC] Failed: %s\n", pendingUploads[i].path);
+            }
+            finished++;
+            if (cb) {
+                char progress[32];
+                snprintf(progress, sizeof(progress), "UPLOAD %u/%u",
+                         (unsigned int)finished, (unsigned int)pendingCount);
+                cb(progress, finished, pendingCount);
+            }
+        }
+        yield();
     }
-    
-    client.stop();
-    
-    if (success) {
-        // NOTE: Don't mark uploaded here - caller handles marking after all TLS operations
-        // This avoids reloading cache during TLS when heap is tight
-        Serial.printf("[WPASEC] Upload success: %s\n", bssid);
-    } else {
-        strncpy(lastError, "UPLOAD REJECTED", sizeof(lastError) - 1);
-    }
-    
-    return success;
 }
 
-bool WPASec::downloadPotfile(uint16_t& newCracks) {
-    newCracks = 0;
-    
+bool WPASec::downloadPotfile(SyncSession& session, PotfileSync::Result& pot) {
     Serial.println("[WPASEC] Downloading potfile...");
     
-    // Create WiFiClientSecure with minimal buffers
-    WiFiClientSecure client;
-    client.setInsecure();
-    
-    if (!client.connect(WPASEC_HOST, WPASEC_PORT, 10000)) {
-        char tlsErr[64] = {0};
-        int errCode = client.lastError(tlsErr, sizeof(tlsErr) - 1);
-        snprintf(lastError, sizeof(lastError), "POTFILE TLS: %d", errCode);
-        Serial.printf("[WPASEC] Potfile TLS failed: err=%d (%s)\n", errCode, tlsErr);
-        return false;
-    }
-    
-    // Send GET request
-    client.printf("GET %s HTTP/1.1\r\n", WPASEC_POTFILE_PATH);
-    client.printf("Host: %s\r\n", WPASEC_HOST);
-    client.printf("Cookie: key=%s\r\n", Config::wifi().wpaSecKey);
-    client.print("Connection: close\r\n\r\n");
+    char cookie[48];
+    snprintf(cookie, sizeof(cookie), "key=%s", Config::wifi().wpaSecKey);
     
-    // Wait for response
-    unsigned long timeout = millis() + 15000;
-    while (client.connected() && !client.available() && millis() < timeout) {
-        delay(10);
-        yield();  // Prevent WDT during response wait
-    }
-    
-    if (!client.available()) {
-        client.stop();
-        strncpy(lastError, "POTFILE TIMEOUT", sizeof(lastError) - 1);
-        return false;
-    }
-    
-    // Skip HTTP headers
-    bool headersEnded = false;
-    char headerLine[128];
-    while (client.connected() && client.available() && !headersEnded) {
-        size_t len = client.readBytesUntil('\n', headerLine, sizeof(headerLine) - 1);
-        headerLine[len] = '\0';
-        // Empty line marks end of headers
-        if (len <= 1 || (len == 1 && headerLine[0] == '\r')) {
-            headersEnded = true;
+    // Only what is new since the last sync; the index merge waits until
+    // the TLS connection is closed
+    return PotfileSync::fetch(session, WPASEC_POTFILE_PATH, cookie, pot,
+                              lastError, sizeof(lastError));
+}
+
+struct PendingScan {
+    const char* hsDir;
+    uint8_t count;
+    uint8_t skipped;
+};
+
+// CaptureIndex::forEach visitor: queue captures not yet on WPA-SEC
+bool WPASec::collectPendingUpload(const CaptureIndex::Record& rec, uint32_t slot, void* ctx) {
+    (void)slot;
+    PendingScan& scan = *static_cast<PendingScan*>(ctx);
+    if (scan.count >= 16) return false;
+    if (rec.flags & CaptureIndex::FLAG_NO_BSSID) return true;
+
+    char key[13];
+    snprintf(key, sizeof(key), "%02X%02X%02X%02X%02X%02X",
+             rec.bssid[0], rec.bssid[1], rec.bssid[2], rec.bssid[3], rec.bssid[4], rec.bssid[5]);
+
+    // Check uploaded list directly (avoids opening the cracked index from isUploaded)
+    for (size_t j = 0; j < uploadedCache.size(); j++) {
+        if (strcmp(uploadedCache[j].bssid, key) == 0) {
+            if (scan.skipped < 255) scan.skipped++;
+            return true;
         }
     }
-    
-    if (!headersEnded) {
-        client.stop();
-        strncpy(lastError, "POTFILE BAD RESPONSE", sizeof(lastError) - 1);
-        return false;
-    }
-    
-    // Open cache file for writing (overwrite)
-    const char* cachePath = SDLayout::wpasecResultsPath();
-    File cacheFile = SD.open(cachePath, FILE_WRITE);
-    if (!cacheFile) {
-        client.stop();
-        strncpy(lastError, "CANNOT WRITE CACHE", sizeof(lastError) - 1);
-        return false;
-    }
-    
-    // Stream potfile line-by-line directly to SD
-    // Format: BSSID:SSID:password (hashcat potfile format)
-    char lineBuf[160];  // Should be enough for BSSID:SSID:password
-    uint16_t lineCount = 0;
-    
-    while (client.connected() || client.available()) {
-        if (client.available()) {
-            size_t len = client.readBytesUntil('\n', lineBuf, sizeof(lineBuf) - 1);
-            if (len > 0) {
-                lineBuf[len] = '\0';
-                // Trim \r if present
-                if (len > 0 && lineBuf[len - 1] == '\r') {
-                    lineBuf[len - 1] = '\0';
-                }
-                
-                // Validate line has at least 2 colons (BSSID:SSID:password)
-                int colonCount = 0;
-                for (size_t i = 0; lineBuf[i]; i++) {
-                    if (lineBuf[i] == ':') colonCount++;
-                }
-                
-                if (colonCount >= 2 && strlen(lineBuf) > 10) {
-                    cacheFile.println(lineBuf);
-                    lineCount++;
-                }
-            }
-        } else {
-            delay(10);
-        }
-        
-        // Safety timeout
-        if (millis() > timeout + 30000) {
-            Serial.println("[WPASEC] Potfile download timeout");
-            break;
+    PendingUpload& up = pendingUploads[scan.count++];
+    snprintf(up.path, sizeof(up.path), "%s/%s", scan.hsDir, rec.name);
+    memcpy(up.bssid, key, sizeof(up.bssid));
+    return true;
+}
+
+// CaptureIndex::update pass after a sync: flag what was just uploaded
+bool WPASec::markIndexUploaded(CaptureIndex::Record& rec, void* ctx) {
+    const uint8_t* successMask = static_cast<const uint8_t*>(ctx);
+    if ((rec.flags & (CaptureIndex::FLAG_UPLOADED | CaptureIndex::FLAG_NO_BSSID)) != 0) return false;
+    char key[13];
+    snprintf(key, sizeof(key), "%02X%02X%02X%02X%02X%02X",
+             rec.bssid[0], rec.bssid[1], rec.bssid[2], rec.bssid[3], rec.bssid[4], rec.bssid[5]);
+    for (uint8_t i = 0; i < 16; i++) {
+        if (successMask[i] && strcmp(pendingUploads[i].bssid, key) == 0) {
+            rec.flags |= CaptureIndex::FLAG_UPLOADED;
+            return true;
         }
-        
-        yield();
     }
-    
-    cacheFile.close();
-    client.stop();
-    
-    Serial.printf("[WPASEC] Potfile downloaded: %u entries\n", (unsigned int)lineCount);
-    newCracks = lineCount;
-    
-    return true;
+    return false;
 }
 
 WPASecSyncResult WPASec::syncCaptures(WPASecProgressCallback cb) {
@@ -641,97 +555,22 @@ WPASecSyncResult WPASec::syncCaptures(WPASecProgressCallback cb) {
     }
     
     // First pass: count files and check which need upload
-    // Only load uploaded list (not cracked cache) to avoid 14KB allocation before TLS
+    // Only load uploaded list (not the cracked index) before TLS
     loadUploadedList();
     
-    // Collect pending uploads (store paths temporarily)
-    struct PendingUpload {
-        char path[80];
-        char bssid[13];
-    };
-    static PendingUpload pendingUploads[16];  // Max 16 per sync (reduced from 50, saves ~3KB BSS)
-    uint8_t pendingCount = 0;
-
-    File dir = SD.open(hsDir);
-    if (dir && dir.isDirectory()) {
-        File file = dir.openNextFile();
-        uint8_t filesScanned = 0;
-        while (file && pendingCount < 16) {
-            // Yield every 10 files to prevent WDT on large directories
-            if (++filesScanned >= 10) {
-                filesScanned = 0;
-                yield();
-            }
-            
-            const char* fname = file.name();
-            size_t fnameLen = strlen(fname);
-            
-            // Check extension without String allocation
-            bool isPCAP = (fnameLen > 5 && strcmp(fname + fnameLen - 5, ".pcap") == 0);
-            bool is22000 = (fnameLen > 6 && strcmp(fname + fnameLen - 6, ".22000") == 0);
-            
-            if (isPCAP || is22000) {
-                // Extract BSSID from filename — supports both formats:
-                // Legacy: BSSID12HEX.ext (first 12 chars)
-                // New:    SSID_BSSID12HEX.ext (last 12 chars of base)
-                const char* dot = strrchr(fname, '.');
-                size_t baseLen = dot ? (size_t)(dot - fname) : fnameLen;
-
-                // Strip _hs suffix
-                if (baseLen > 3 && strncmp(fname + baseLen - 3, "_hs", 3) == 0) {
-                    baseLen -= 3;
-                }
-
-                if (baseLen >= 12) {
-                    char bssid[13];
-
-                    // Check if last 12 chars are hex and preceded by '_' (new format)
-                    bool isNewFmt = false;
-                    if (baseLen > 13 && fname[baseLen - 13] == '_') {
-                        isNewFmt = true;
-                        for (size_t i = baseLen - 12; i < baseLen; i++) {
-                            char c = fname[i];
-                            if (!((c >= '0' && c <= '9') || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f'))) {
-                                isNewFmt = false;
-                                break;
-                            }
-                        }
-                    }
-
-                    if (isNewFmt) {
-                        memcpy(bssid, fname + baseLen - 12, 12);
-                    } else {
-                        memcpy(bssid, fname, 12);
-                    }
-                    bssid[12] = '\0';
-                    // Uppercase for consistency
-                    for (int i = 0; i < 12; i++) {
-                        if (bssid[i] >= 'a' && bssid[i] <= 'f') bssid[i] -= 32;
-                    }
-                    
-                    // Check uploaded list directly (avoids 14KB crackedCache load from isUploaded)
-                    char key[13];
-                    normalizeBSSID_Char(bssid, key, sizeof(key));
-                    bool alreadyUploaded = false;
-                    for (size_t j = 0; j < uploadedCache.size(); j++) {
-                        if (strcmp(uploadedCache[j].bssid, key) == 0) { alreadyUploaded = true; break; }
-                    }
-                    if (!alreadyUploaded) {
-                        snprintf(pendingUploads[pendingCount].path, 
-                                sizeof(pendingUploads[pendingCount].path),
-                                "%s/%s", hsDir, fname);
-                        memcpy(pendingUploads[pendingCount].bssid, bssid, 13);
-                        pendingCount++;
-                    } else {
-                        result.skipped++;
-                    }
-                }
-            }
-            file.close();
-            file = dir.openNextFile();
+    // Collect pending uploads from the capture index (rebuilt first if a
+    // file was added/removed behind its back) - no directory walk
+    if (CaptureIndex::isStale()) {
+        if (cb) {
+            cb("indexing caps", 0, 0);
         }
-        dir.close();
+        CaptureIndex::rebuild();
     }
+    PendingScan scan = {};
+    scan.hsDir = hsDir;
+    CaptureIndex::forEach(collectPendingUpload, &scan);
+    uint8_t pendingCount = scan.count;
+    result.skipped = scan.skipped;
     
     Serial.printf("[WPASEC] Found %u files to upload, %u skipped\n", 
                   (unsigned int)pendingCount, (unsigned int)result.skipped);
@@ -739,44 +578,26 @@ WPASecSyncResult WPASec::syncCaptures(WPASecProgressCallback cb) {
     // Free cache before TLS operations - keeps heap clear for WiFiClientSecure
     freeCacheMemory();
     
+    // One TLS connection for every upload and the potfile (keep-alive)
+    SyncSession session(WPASEC_HOST, WPASEC_PORT, "WPASEC");
+    
     // Track successful uploads with bitmask - avoids reloading cache during TLS
     // We mark uploaded AFTER all TLS operations complete to keep heap clear
     uint8_t successMask[50] = {0};
     
-    // Upload each pending file
+    // Upload the pending files, pipelined on the one connection
     if (cb) {
         cb("yoinking caps", 0, 0);
     }
-    for (uint8_t i = 0; i < pendingCount; i++) {
-        if (cb) {
-            char status[32];
-            snprintf(status, sizeof(status), "UPLOAD %u/%u", i + 1, pendingCount);
-            cb(status, i + 1, pendingCount);
-        }
-        
-        Serial.printf("[WPASEC] Heap before upload %u: %u\n", 
-                      i, (unsigned int)ESP.getFreeHeap());
-        
-        if (uploadSingleCapture(pendingUploads[i].path, pendingUploads[i].bssid)) {
-            result.uploaded++;
-            successMask[i] = 1;  // Track for deferred marking
-        } else {
-            result.failed++;
-            Serial.printf("[WPASEC] Failed: %s\n", pendingUploads[i].path);
-        }
-        
-        // Small delay between uploads to let heap settle
-        delay(100);
-        yield();
-    }
+    uploadPending(session, pendingCount, successMask, result, cb);
     
-    // Mark successful uploads AFTER all TLS operations complete
-    // This avoids cache reload during TLS when heap is tight
+    // Mark successful uploads after the upload loop, not per request
+    // Only the uploaded list is reloaded while the connection idles
     if (result.uploaded > 0) {
         if (cb) {
             cb("marking loot", 0, 0);
         }
-        loadCache();
+        loadUploadedList();
         for (uint8_t i = 0; i < pendingCount; i++) {
             if (successMask[i]) {
                 char key[13];
@@ -794,7 +615,8 @@ WPASecSyncResult WPASec::syncCaptures(WPASecProgressCallback cb) {
             }
         }
         saveUploadedList();
-        Serial.printf("[WPASEC] Marked %u uploads after TLS complete\n", result.uploaded);
+        CaptureIndex::update(markIndexUploaded, successMask);
+        Serial.printf("[WPASEC] Marked %u uploads\n", result.uploaded);
     }
     
     // Download potfile
@@ -812,19 +634,14 @@ WPASecSyncResult WPASec::syncCaptures(WPASecProgressCallback cb) {
                   (unsigned int)ESP.getFreeHeap(),
                   (unsigned int)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
     
-    uint16_t newCracks = 0;
+    PotfileSync::Result pot = {};
     bool potfileOk = false;
     
     // Attempt potfile if heap is sufficient - no reconditioning, graceful skip if low
+    // A still-open upload connection needs no new handshake, so no gate
     HeapGates::GateStatus potGate = HeapGates::checkGate(0, HeapPolicy::kMinContigForTls);
-    if (potGate.failure == HeapGates::TlsGateFailure::None) {
-        potfileOk = downloadPotfile(newCracks);
-        if (potfileOk) {
-            result.newCracked = newCracks;
-            // Reload cache to get cracked count
-            loadCache();
-            result.cracked = crackedCache.size();
-        }
+    if (session.isConnected() || potGate.failure == HeapGates::TlsGateFailure::None) {
+        potfileOk = downloadPotfile(session, pot);
     } else {
         Serial.printf("[WPASEC] Skipping potfile: insufficient heap (%u < %u)\n",
                       (unsigned int)potGate.largestBlock,
@@ -844,6 +661,19 @@ WPASecSyncResult WPASec::syncCaptures(WPASecProgressCallback cb) {
         result.success = (result.failed == 0);
     }
     
+    Serial.printf("[WPASEC] Session: %u requests, %u TLS handshakes\n",
+                  (unsigned int)session.requestCount(), (unsigned int)session.handshakeCount());
+    session.close();
+    
+    // Merge the new potfile lines into the cracked index (no full reparse)
+    if (potfileOk) {
+        uint32_t newCracks = 0;
+        PotfileSync::updateIndex(pot, newCracks);
+        uint32_t cracked = CrackedIndex::count();
+        result.newCracked = newCracks > 0xFFFF ? 0xFFFF : (uint16_t)newCracks;
+        result.cracked = cracked > 0xFFFF ? 0xFFFF : (uint16_t)cracked;
+    }
+    
     // Resume NetworkRecon after sync operations complete
     if (wasReconRunning) {
         Serial.println("[WPASEC] Resuming NetworkRecon after TLS operations");
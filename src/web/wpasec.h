@@ -5,6 +5,10 @@
 #include <Arduino.h>
 #include <vector>
 #include "../core/heap_policy.h"
+#include "../core/capture_index.h"
+#include "cracked_index.h"
+#include "sync_session.h"
+#include "potfile_sync.h"
 
 // Upload status for tracking
 enum class WPASecUploadStatus {
@@ -37,7 +41,7 @@ public:
     static bool isCracked(const char* bssid);        // Check if BSSID is cracked
     static const char* getPassword(const char* bssid);  // Get password for BSSID (returns "" if not found)
     static const char* getSSID(const char* bssid);      // Get SSID for BSSID (returns "" if not found)
-    static uint16_t getCrackedCount();               // Total cracked in cache
+    static uint16_t getCrackedCount();               // Distinct cracked BSSIDs
     static void normalizeBSSID_Char(const char* bssid, char* output, size_t outLen);
 
     // Upload tracking
@@ -59,9 +63,9 @@ public:
     /**
      * @brief Free cached WPA-SEC results from memory.
      *
-     * This releases the internal cracked and uploaded vectors to return heap
-     * space prior to large TLS operations.  After calling this, the cache
-     * will be reloaded from disk on the next lookup or fetch.
+     * This releases the uploaded vector and closes the cracked index to
+     * return heap space prior to large TLS operations.  After calling this,
+     * the cache will be reloaded from disk on the next lookup or fetch.
      */
     static void freeCacheMemory();
 
@@ -74,25 +78,35 @@ public:
     static volatile bool busy;
     static bool batchMode;  // Batch upload mode flag
 
-    // Flat cache entries — no std::map, no String. One contiguous vector each.
-    struct CrackedEntry {
-        char bssid[13];    // Normalized BSSID (no colons, uppercase)
-        char ssid[33];
-        char password[64];
-    };
+    // Cracked results live in CrackedIndex on SD; uploaded BSSIDs are a
+    // flat vector — no std::map, no String.
     struct UploadedEntry {
         char bssid[13];
     };
-    static std::vector<CrackedEntry> crackedCache;
     static std::vector<UploadedEntry> uploadedCache;
 
-    static const CrackedEntry* findCracked(const char* normalizedBssid);
+    static const CrackedIndex::Entry* findCracked(const char* normalizedBssid);
 
     // Helpers
     static bool loadUploadedList();
     static bool saveUploadedList();
 
     // Network helpers (internal)
-    static bool uploadSingleCapture(const char* filepath, const char* bssid);
-    static bool downloadPotfile(uint16_t& newCracks);
+    enum class UploadSend : uint8_t {
+        Sent,       // Whole request written
+        Invalid,    // Unreadable or oversized capture, nothing sent
+        NotSent,    // No connection, nothing sent
+        Broken      // Connection lost partway through the request
+    };
+    static constexpr uint8_t WPASEC_PIPELINE_DEPTH = 4;   // Uploads in flight at once
+    static_assert(WPASEC_PIPELINE_DEPTH <= SyncSession::kMaxInFlight,
+                  "SyncSession tracks too few pipelined requests");
+    static UploadSend sendCapture(SyncSession& session, const char* filepath, bool queued);
+    static void uploadPending(SyncSession& session, uint8_t pendingCount, uint8_t* successMask,
+                              WPASecSyncResult& result, WPASecProgressCallback cb);
+    static bool downloadPotfile(SyncSession& session, PotfileSync::Result& pot);
+
+    // Capture index visitors for syncCaptures()
+    static bool collectPendingUpload(const CaptureIndex::Record& rec, uint32_t slot, void* ctx);
+    static bool markIndexUploaded(CaptureIndex::Record& rec, void* ctx);
 };
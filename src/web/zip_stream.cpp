@@ -0,0 +1,204 @@
+// ZipStream - Streaming store-mode ZIP encoder
+
+#include "zip_stream.h"
+#include <string.h>
+
+namespace {
+
+static constexpr uint32_t kLocalSig = 0x04034B50;
+static constexpr uint32_t kDescriptorSig = 0x08074B50;
+static constexpr uint32_t kCentralSig = 0x02014B50;
+static constexpr uint32_t kEndSig = 0x06054B50;
+static constexpr size_t kLocalBytes = 30;
+static constexpr size_t kDescriptorBytes = 16;
+static constexpr size_t kCentralBytes = 46;
+static constexpr size_t kEndBytes = 22;
+static constexpr uint16_t kVersion = 20;           // 2.0: data descriptors
+static constexpr uint16_t kFlags = 0x0808;         // Bit 3 descriptor, bit 11 UTF-8
+
+// 1 KiB table in flash; 8x fewer steps per byte than the bitwise loop
+struct Crc32Table {
+    uint32_t v[256];
+    constexpr Crc32Table() : v() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) c = (c >> 1) ^ (0xEDB88320u & (0u - (c & 1u)));
+            v[i] = c;
+        }
+    }
+};
+static constexpr Crc32Table kCrcTable;
+
+inline void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+inline void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+void dosDateTime(time_t t, uint16_t& dosTime, uint16_t& dosDate) {
+    struct tm tmv;
+    if (t < 315532800 || !gmtime_r(&t, &tmv)) {   // Before 1980-01-01
+        dosTime = 0;
+        dosDate = (1 << 5) | 1;
+        return;
+    }
+    int year = tmv.tm_year + 1900 - 1980;
+    if (year > 127) year = 127;
+    dosTime = (uint16_t)((tmv.tm_hour << 11) | (tmv.tm_min << 5) | (tmv.tm_sec / 2));
+    dosDate = (uint16_t)((year << 9) | ((tmv.tm_mon + 1) << 5) | tmv.tm_mday);
+}
+
+}  // namespace
+
+uint32_t ZipStream::crc32(uint32_t crc, const uint8_t* data, size_t len) {
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc = kCrcTable.v[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+bool ZipStream::begin(Sink sink, void* ctx, const char* spillPath) {
+    abort();
+    if (!sink || !spillPath || strlen(spillPath) >= sizeof(spillPath_)) return false;
+    strcpy(spillPath_, spillPath);
+    spill_ = SD.open(spillPath_, FILE_WRITE);
+    if (!spill_) {
+        spillPath_[0] = '\0';
+        return false;
+    }
+    sink_ = sink;
+    ctx_ = ctx;
+    open_ = true;
+    inEntry_ = false;
+    entries_ = 0;
+    offset_ = 0;
+    cdBytes_ = 0;
+    return true;
+}
+
+bool ZipStream::emit(const uint8_t* data, size_t len) {
+    if (len > UINT32_MAX - offset_) return false;
+    if (!sink_(data, len, ctx_)) return false;
+    offset_ += (uint32_t)len;
+    return true;
+}
+
+bool ZipStream::beginEntry(const char* name, time_t mtime) {
+    if (!open_ || inEntry_ || !name) return false;
+    size_t nameLen = strlen(name);
+    if (nameLen == 0 || nameLen > kMaxNameBytes || entries_ == kMaxEntries) return false;
+
+    memcpy(entryName_, name, nameLen + 1);
+    entryNameLen_ = (uint16_t)nameLen;
+    entryOffset_ = offset_;
+    entryCrc_ = 0;
+    entrySize_ = 0;
+    dosDateTime(mtime, entryTime_, entryDate_);
+
+    // CRC and sizes are zero here and follow in the data descriptor
+    uint8_t hdr[kLocalBytes] = {0};
+    put32(hdr, kLocalSig);
+    put16(hdr + 4, kVersion);
+    put16(hdr + 6, kFlags);
+    put16(hdr + 8, 0);                  // Stored
+    put16(hdr + 10, entryTime_);
+    put16(hdr + 12, entryDate_);
+    put16(hdr + 26, entryNameLen_);
+    if (!emit(hdr, sizeof(hdr)) || !emit((const uint8_t*)entryName_, nameLen)) return false;
+    inEntry_ = true;
+    return true;
+}
+
+bool ZipStream::write(const uint8_t* data, size_t len) {
+    if (!inEntry_) return false;
+    if (len > UINT32_MAX - entrySize_) return false;
+    entryCrc_ = crc32(entryCrc_, data, len);
+    if (!emit(data, len)) return false;
+    entrySize_ += (uint32_t)len;
+    return true;
+}
+
+bool ZipStream::endEntry() {
+    if (!inEntry_) return false;
+    inEntry_ = false;
+
+    uint8_t desc[kDescriptorBytes];
+    put32(desc, kDescriptorSig);
+    put32(desc + 4, entryCrc_);
+    put32(desc + 8, entrySize_);        // Compressed == uncompressed
+    put32(desc + 12, entrySize_);
+    if (!emit(desc, sizeof(desc))) return false;
+
+    uint8_t cd[kCentralBytes] = {0};
+    put32(cd, kCentralSig);
+    put16(cd + 4, kVersion);            // Made by: MS-DOS, 2.0
+    put16(cd + 6, kVersion);
+    put16(cd + 8, kFlags);
+    put16(cd + 10, 0);                  // Stored
+    put16(cd + 12, entryTime_);
+    put16(cd + 14, entryDate_);
+    put32(cd + 16, entryCrc_);
+    put32(cd + 20, entrySize_);
+    put32(cd + 24, entrySize_);
+    put16(cd + 28, entryNameLen_);
+    put32(cd + 42, entryOffset_);
+    if (spill_.write(cd, sizeof(cd)) != sizeof(cd) ||
+        spill_.write((const uint8_t*)entryName_, entryNameLen_) != entryNameLen_) {
+        return false;
+    }
+    cdBytes_ += (uint32_t)(sizeof(cd) + entryNameLen_);
+    entries_++;
+    return true;
+}
+
+bool ZipStream::finish() {
+    if (!open_) return false;
+    bool ok = !inEntry_ || endEntry();
+
+    // Stream the spilled central directory back out
+    uint32_t cdOffset = offset_;
+    spill_.close();
+    if (ok) {
+        File cd = SD.open(spillPath_, FILE_READ);
+        ok = (bool)cd;
+        uint8_t buf[256];
+        uint32_t left = cdBytes_;
+        while (ok && left > 0) {
+            size_t n = left < sizeof(buf) ? left : sizeof(buf);
+            ok = cd.read(buf, n) == n && emit(buf, n);
+            left -= (uint32_t)n;
+        }
+        if (cd) cd.close();
+    }
+
+    if (ok) {
+        uint8_t end[kEndBytes] = {0};
+        put32(end, kEndSig);
+        put16(end + 8, entries_);
+        put16(end + 10, entries_);
+        put32(end + 12, cdBytes_);
+        put32(end + 16, cdOffset);
+        ok = emit(end, sizeof(end));
+    }
+    abort();
+    return ok;
+}
+
+void ZipStream::abort() {
+    if (spill_) spill_.close();
+    if (spillPath_[0] != '\0') {
+        SD.remove(spillPath_);
+        spillPath_[0] = '\0';
+    }
+    open_ = false;
+    inEntry_ = false;
+    sink_ = nullptr;
+    ctx_ = nullptr;
+}
@@ -0,0 +1,75 @@
+// ZipStream - Streaming store-mode ZIP encoder
+// Entries are emitted as local header + raw data + data descriptor while the
+// caller feeds bytes in, so file contents are never buffered and the archive
+// size does not need to be known up front. CRC32 is computed on the fly.
+// Central directory records (46 bytes + name per entry) are spilled to a
+// small SD temp file as entries close and streamed back out by finish(), so
+// RAM use stays constant no matter how many files are archived.
+//
+// No compression (method 0) and no ZIP64: archives stop at 65535 entries
+// and 4 GiB, which is far beyond anything on a porkchop SD card.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <SD.h>
+
+class ZipStream {
+public:
+    // Receives archive bytes in order. Return false to abort the archive.
+    typedef bool (*Sink)(const uint8_t* data, size_t len, void* ctx);
+
+    static constexpr size_t kMaxNameBytes = 255;
+    static constexpr uint16_t kMaxEntries = 0xFFFF;
+
+    ZipStream() = default;
+    ~ZipStream() { abort(); }
+    ZipStream(const ZipStream&) = delete;
+    ZipStream& operator=(const ZipStream&) = delete;
+
+    // Start an archive. spillPath is a scratch file for the central
+    // directory; it is truncated now and removed by finish()/abort().
+    bool begin(Sink sink, void* ctx, const char* spillPath);
+
+    // Open an entry (name relative, '/' separated, UTF-8). mtime is Unix
+    // seconds; anything before 1980 is clamped to the DOS epoch.
+    bool beginEntry(const char* name, time_t mtime);
+    bool write(const uint8_t* data, size_t len);
+    bool endEntry();
+
+    // Close any open entry, then emit the central directory and the end
+    // record. The archive is complete only if this returns true.
+    bool finish();
+    // Drop the spill file without finishing. Safe to call at any time.
+    void abort();
+
+    bool isOpen() const { return open_; }
+    uint16_t entries() const { return entries_; }
+    uint32_t bytesOut() const { return offset_; }
+
+    // Standard (IEEE 802.3) CRC32. Start with crc = 0.
+    static uint32_t crc32(uint32_t crc, const uint8_t* data, size_t len);
+
+private:
+    bool emit(const uint8_t* data, size_t len);
+
+    Sink sink_ = nullptr;
+    void* ctx_ = nullptr;
+    File spill_;
+    char spillPath_[96] = {0};
+    bool open_ = false;
+    bool inEntry_ = false;
+    uint16_t entries_ = 0;
+    uint32_t offset_ = 0;        // Archive bytes emitted so far
+    uint32_t cdBytes_ = 0;       // Central directory bytes spilled
+
+    // Current entry
+    uint32_t entryOffset_ = 0;   // Offset of its local header
+    uint32_t entryCrc_ = 0;
+    uint32_t entrySize_ = 0;
+    uint16_t entryTime_ = 0;     // DOS time/date
+    uint16_t entryDate_ = 0;
+    uint16_t entryNameLen_ = 0;
+    char entryName_[kMaxNameBytes + 1] = {0};
+};
@@ -0,0 +1,414 @@
+// Host HAL - Arduino core for native (Linux) builds of the real src/ modules
+// Virtual millis(): time only moves when a driver advances it (or delay() is called)
+// Serial is silent unless HostHal::setSerialEcho(true)
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdarg>
+#include <cmath>
+#include <cctype>
+#include <ctime>
+#include <string>
+#include <algorithm>
+#include <mutex>
+#include "pgmspace.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define PROGMEM
+#define F(s) (s)
+#define PSTR(s) (s)
+
+#ifndef PI
+#define PI 3.14159265358979323846
+#endif
+
+using std::min;
+using std::max;
+
+#ifndef constrain
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#endif
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// ============================================================================
+// Time (virtual clock, see host_hal.h)
+// ============================================================================
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+// SNTP (host clock is already set)
+inline void configTime(long, int, const char*, const char* = nullptr, const char* = nullptr) {}
+inline bool getLocalTime(struct tm* info, uint32_t = 5000) {
+    time_t now = time(nullptr);
+    return localtime_r(&now, info) != nullptr;
+}
+
+// ============================================================================
+// Random (deterministic: seeded once per process, reseed with randomSeed())
+// ============================================================================
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+uint32_t esp_random();
+
+// ============================================================================
+// String
+// ============================================================================
+
+class String {
+public:
+    String() {}
+    String(const char* s) : s_(s ? s : "") {}
+    String(const std::string& s) : s_(s) {}
+    String(char c) : s_(1, c) {}
+    String(int v) : s_(std::to_string(v)) {}
+    String(unsigned int v) : s_(std::to_string(v)) {}
+    String(long v) : s_(std::to_string(v)) {}
+    String(unsigned long v) : s_(std::to_string(v)) {}
+    String(long long v) : s_(std::to_string(v)) {}
+    String(unsigned long long v) : s_(std::to_string(v)) {}
+    String(int v, unsigned char base) { fromBase((unsigned long)v, base); }
+    String(unsigned int v, unsigned char base) { fromBase(v, base); }
+    String(unsigned long v, unsigned char base) { fromBase(v, base); }
+    String(float v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+    String(double v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+
+    const char* c_str() const { return s_.c_str(); }
+    size_t length() const { return s_.length(); }
+    bool isEmpty() const { return s_.empty(); }
+    bool reserve(size_t n) { s_.reserve(n); return true; }
+    const char* begin() const { return s_.c_str(); }
+    const char* end() const { return s_.c_str() + s_.length(); }
+
+    String& operator=(const char* s) { s_ = s ? s : ""; return *this; }
+    String& operator+=(const String& o) { s_ += o.s_; return *this; }
+    String& operator+=(const char* s) { if (s) s_ += s; return *this; }
+    String& operator+=(char c) { s_ += c; return *this; }
+    String& operator+=(int v) { s_ += std::to_string(v); return *this; }
+    String& operator+=(unsigned int v) { s_ += std::to_string(v); return *this; }
+    String& operator+=(long v) { s_ += std::to_string(v); return *this; }
+    String& operator+=(unsigned long v) { s_ += std::to_string(v); return *this; }
+    String& operator+=(float v) { return *this += String(v); }
+    String& operator+=(double v) { return *this += String(v); }
+    bool concat(const String& o) { s_ += o.s_; return true; }
+    bool concat(const char* s) { if (s) s_ += s; return true; }
+    bool concat(char c) { s_ += c; return true; }
+    bool concat(const char* s, size_t n) { if (s) s_.append(s, n); return true; }
+
+    template <typename T>
+    friend String operator+(const String& a, const T& b) { String r(a); r += b; return r; }
+    friend String operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+    friend String operator+(char a, const String& b) { String r(a); r += b; return r; }
+
+    bool operator==(const String& o) const { return s_ == o.s_; }
+    bool operator==(const char* s) const { return s_ == (s ? s : ""); }
+    bool operator!=(const String& o) const { return s_ != o.s_; }
+    bool operator!=(const char* s) const { return !(*this == s); }
+    bool operator<(const String& o) const { return s_ < o.s_; }
+    bool operator>(const String& o) const { return s_ > o.s_; }
+    bool equals(const String& o) const { return s_ == o.s_; }
+    bool equalsIgnoreCase(const String& o) const {
+        if (s_.size() != o.s_.size()) return false;
+        for (size_t i = 0; i < s_.size(); i++) {
+            if (tolower((unsigned char)s_[i]) != tolower((unsigned char)o.s_[i])) return false;
+        }
+        return true;
+    }
+    int compareTo(const String& o) const { return s_.compare(o.s_); }
+
+    char operator[](size_t i) const { return i < s_.size() ? s_[i] : 0; }
+    char& operator[](size_t i) { return s_[i]; }
+    char charAt(size_t i) const { return (*this)[i]; }
+    void setCharAt(size_t i, char c) { if (i < s_.size()) s_[i] = c; }
+
+    bool startsWith(const String& p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+    bool startsWith(const String& p, size_t off) const {
+        return off <= s_.size() && s_.compare(off, p.s_.size(), p.s_) == 0;
+    }
+    bool endsWith(const String& p) const {
+        return p.s_.size() <= s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+    }
+    int indexOf(char c, unsigned int from = 0) const { return toIndex(s_.find(c, from)); }
+    int indexOf(const String& p, unsigned int from = 0) const { return toIndex(s_.find(p.s_, from)); }
+    int lastIndexOf(char c) const { return toIndex(s_.rfind(c)); }
+    int lastIndexOf(const String& p) const { return toIndex(s_.rfind(p.s_)); }
+    int lastIndexOf(char c, unsigned int from) const { return toIndex(s_.rfind(c, from)); }
+
+    String substring(unsigned int from) const {
+        return from >= s_.size() ? String() : String(s_.substr(from));
+    }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) std::swap(from, to);
+        if (from >= s_.size()) return String();
+        return String(s_.substr(from, std::min<size_t>(to, s_.size()) - from));
+    }
+
+    void trim() {
+        size_t b = 0, e = s_.size();
+        while (b < e && isspace((unsigned char)s_[b])) b++;
+        while (e > b && isspace((unsigned char)s_[e - 1])) e--;
+        s_ = s_.substr(b, e - b);
+    }
+    void toLowerCase() { for (auto& c : s_) c = (char)tolower((unsigned char)c); }
+    void toUpperCase() { for (auto& c : s_) c = (char)toupper((unsigned char)c); }
+    void replace(const String& from, const String& to) {
+        if (from.s_.empty()) return;
+        size_t pos = 0;
+        while ((pos = s_.find(from.s_, pos)) != std::string::npos) {
+            s_.replace(pos, from.s_.size(), to.s_);
+            pos += to.s_.size();
+        }
+    }
+    void replace(char from, char to) { for (auto& c : s_) if (c == from) c = to; }
+    void remove(unsigned int index) { if (index < s_.size()) s_.erase(index); }
+    void remove(unsigned int index, unsigned int count) { if (index < s_.size()) s_.erase(index, count); }
+
+    long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(s_.c_str(), nullptr); }
+    double toDouble() const { return strtod(s_.c_str(), nullptr); }
+    void toCharArray(char* buf, unsigned int size, unsigned int index = 0) const { getBytes((unsigned char*)buf, size, index); }
+    void getBytes(unsigned char* buf, unsigned int size, unsigned int index = 0) const {
+        if (!buf || size == 0) return;
+        size_t n = index < s_.size() ? std::min<size_t>(size - 1, s_.size() - index) : 0;
+        if (n) memcpy(buf, s_.data() + index, n);
+        buf[n] = 0;
+    }
+
+    const std::string& str() const { return s_; }
+
+private:
+    static int toIndex(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+    void fromBase(unsigned long v, unsigned char base) {
+        if (base < 2 || base > 36) base = 10;
+        char buf[40];
+        int i = sizeof(buf) - 1;
+        buf[i] = 0;
+        do {
+            unsigned d = (unsigned)(v % base);
+            buf[--i] = (char)(d < 10 ? '0' + d : 'a' + d - 10);
+            v /= base;
+        } while (v && i > 0);
+        s_ = &buf[i];
+    }
+    void fromDouble(double v, unsigned int decimals) {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+        s_ = buf;
+    }
+
+    std::string s_;
+};
+
+// ============================================================================
+// Print / Stream
+// ============================================================================
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buf, size_t len) {
+        size_t n = 0;
+        while (len--) n += write(*buf++);
+        return n;
+    }
+    size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+    size_t write(const char* buf, size_t len) { return write((const uint8_t*)buf, len); }
+
+    size_t print(const char* s) { return write(s); }
+    size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v, int base = DEC) { return print(base == DEC ? String(v) : String(v, (unsigned char)base)); }
+    size_t print(unsigned int v, int base = DEC) { return print(String(v, (unsigned char)base)); }
+    size_t print(long v, int base = DEC) { return print(base == DEC ? String(v) : String((unsigned long)v, (unsigned char)base)); }
+    size_t print(unsigned long v, int base = DEC) { return print(String(v, (unsigned char)base)); }
+    size_t print(long long v) { return print(String(v)); }
+    size_t print(unsigned long long v) { return print(String(v)); }
+    size_t print(double v, int digits = 2) { return print(String(v, (unsigned int)digits)); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T& v) { size_t n = print(v); return n + println(); }
+    template <typename T>
+    size_t println(const T& v, int fmt) { size_t n = print(v, fmt); return n + println(); }
+
+    int printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        char stackBuf[256];
+        va_list args;
+        va_start(args, fmt);
+        int len = vsnprintf(stackBuf, sizeof(stackBuf), fmt, args);
+        va_end(args);
+        if (len < 0) return 0;
+        if ((size_t)len < sizeof(stackBuf)) return (int)write((const uint8_t*)stackBuf, len);
+        std::string big((size_t)len + 1, '\0');
+        va_start(args, fmt);
+        vsnprintf(&big[0], big.size(), fmt, args);
+        va_end(args);
+        return (int)write((const uint8_t*)big.data(), len);
+    }
+
+    virtual void flush() {}
+};
+
+class Stream : public Print {
+public:
+    virtual int available() { return 0; }
+    virtual int read() { return -1; }
+    virtual int peek() { return -1; }
+    void setTimeout(unsigned long ms) { timeout_ = ms; }
+    unsigned long getTimeout() const { return timeout_; }
+
+    size_t readBytes(uint8_t* buf, size_t len) {
+        size_t n = 0;
+        int c;
+        while (n < len && (c = read()) >= 0) buf[n++] = (uint8_t)c;
+        return n;
+    }
+    size_t readBytes(char* buf, size_t len) { return readBytes((uint8_t*)buf, len); }
+    size_t readBytesUntil(char term, char* buf, size_t len) {
+        size_t n = 0;
+        int c;
+        while (n < len && (c = read()) >= 0 && c != term) buf[n++] = (char)c;
+        return n;
+    }
+    String readStringUntil(char term) {
+        std::string out;
+        int c;
+        while ((c = read()) >= 0 && c != term) out += (char)c;
+        return String(out);
+    }
+    String readString() {
+        std::string out;
+        int c;
+        while ((c = read()) >= 0) out += (char)c;
+        return String(out);
+    }
+
+protected:
+    unsigned long timeout_ = 1000;
+};
+
+#define SERIAL_8N1 0x800001c
+
+// Serial: forwards to stderr when echo is enabled, otherwise discards
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long, uint32_t = SERIAL_8N1, int8_t = -1, int8_t = -1, bool = false, unsigned long = 20000) {}
+    void end() {}
+    void setDebugOutput(bool) {}
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buf, size_t len) override;
+    using Print::write;
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+
+// ============================================================================
+// ESP system info (fixed plausible values; see HostHal::setFreeHeap)
+// ============================================================================
+
+class EspClass {
+public:
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getHeapSize() { return 327680; }
+    uint32_t getPsramSize() { return 0; }
+    uint32_t getFreePsram() { return 0; }
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint8_t getChipCores() { return 2; }
+    uint8_t getChipRevision() { return 0; }
+    uint32_t getFlashChipSize() { return 8 * 1024 * 1024; }
+    uint32_t getCycleCount();
+    const char* getSdkVersion() { return "host"; }
+    const char* getChipModel() { return "ESP32-S3 (host)"; }
+    uint64_t getEfuseMac() { return 0x0000AABBCCDDEEFFULL; }
+    void restart();
+};
+
+extern EspClass ESP;
+
+inline bool psramFound() { return false; }
+
+// ============================================================================
+// IPAddress
+// ============================================================================
+
+class IPAddress {
+public:
+    IPAddress() : addr_(0) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+        : addr_((uint32_t)a | ((uint32_t)b << 8) | ((uint32_t)c << 16) | ((uint32_t)d << 24)) {}
+    IPAddress(uint32_t addr) : addr_(addr) {}
+    operator uint32_t() const { return addr_; }
+    uint8_t operator[](int i) const { return (uint8_t)(addr_ >> (i * 8)); }
+    bool operator==(const IPAddress& o) const { return addr_ == o.addr_; }
+    String toString() const {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+        return String(buf);
+    }
+
+private:
+    uint32_t addr_;
+};
+
+// ============================================================================
+// GPIO (no-op)
+// ============================================================================
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return HIGH; }  // Buttons are active-low
+inline int analogRead(uint8_t) { return 0; }
+inline uint32_t analogReadMilliVolts(uint8_t) { return 0; }
+inline void neopixelWrite(uint8_t, uint8_t, uint8_t, uint8_t) {}
+
+// ============================================================================
+// Critical sections (portMUX is a recursive lock, like the IDF spinlock)
+// ============================================================================
+
+struct portMUX_TYPE {
+    std::recursive_mutex lock;
+};
+
+#define portMUX_INITIALIZER_UNLOCKED {}
+
+inline void taskENTER_CRITICAL(portMUX_TYPE* mux) { mux->lock.lock(); }
+inline void taskEXIT_CRITICAL(portMUX_TYPE* mux) { mux->lock.unlock(); }
+#define portENTER_CRITICAL(mux) taskENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL(mux) taskEXIT_CRITICAL(mux)
+#define portENTER_CRITICAL_ISR(mux) taskENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux) taskEXIT_CRITICAL(mux)
+
+#include "freertos/FreeRTOS.h"
@@ -0,0 +1,83 @@
+// Host HAL - Arduino fs::FS / fs::File backed by a host directory
+// Each FS is "mounted" on a directory (HostHal::mountSD / mountSPIFFS);
+// firmware paths like "/porkchop/logs/x.txt" resolve under that root.
+// File is a shared handle like the Arduino one: copies refer to the same file.
+#pragma once
+
+#include <Arduino.h>
+#include <ctime>
+#include <memory>
+#include <string>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+struct HostFileImpl;
+
+class File : public Stream {
+public:
+    File() {}
+    explicit File(std::shared_ptr<HostFileImpl> impl) : impl_(impl) {}
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buf, size_t len) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t read(uint8_t* buf, size_t len);
+    void flush() override;
+    bool seek(uint32_t pos, SeekMode mode = SeekSet);
+    size_t position() const;
+    size_t size() const;
+    void close();
+    operator bool() const;
+    time_t getLastWrite();
+    const char* path() const;
+    const char* name() const;
+    bool isDirectory();
+    File openNextFile(const char* mode = FILE_READ);
+    void rewindDirectory();
+
+private:
+    std::shared_ptr<HostFileImpl> impl_;
+};
+
+class FS {
+public:
+    virtual ~FS() {}
+
+    // Host side: point this filesystem at a directory (empty = unmounted)
+    void setRoot(const std::string& dir) { root_ = dir; }
+    const std::string& root() const { return root_; }
+    bool isMounted() const { return !root_.empty(); }
+    std::string realPath(const char* path) const;
+
+    File open(const char* path, const char* mode = FILE_READ, bool create = false);
+    File open(const String& path, const char* mode = FILE_READ, bool create = false) {
+        return open(path.c_str(), mode, create);
+    }
+    bool exists(const char* path);
+    bool exists(const String& path) { return exists(path.c_str()); }
+    bool remove(const char* path);
+    bool remove(const String& path) { return remove(path.c_str()); }
+    bool rename(const char* from, const char* to);
+    bool rename(const String& from, const String& to) { return rename(from.c_str(), to.c_str()); }
+    bool mkdir(const char* path);
+    bool mkdir(const String& path) { return mkdir(path.c_str()); }
+    bool rmdir(const char* path);
+    bool rmdir(const String& path) { return rmdir(path.c_str()); }
+
+protected:
+    std::string root_;
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
@@ -0,0 +1,52 @@
+// Host HAL - M5Cardputer keyboard (no keys ever pressed)
+#pragma once
+
+#include <M5Unified.h>
+#include <vector>
+
+#define KEY_BACKSPACE 0x2a
+#define KEY_TAB 0x2b
+#define KEY_ENTER 0x28
+#define KEY_FN 0xff
+#define KEY_LEFT_CTRL 0x80
+#define KEY_LEFT_SHIFT 0x81
+#define KEY_LEFT_ALT 0x82
+
+class Keyboard_Class {
+public:
+    struct KeysState {
+        std::vector<char> word;
+        std::vector<uint8_t> hid_keys;
+        std::vector<uint8_t> modifier_keys;
+        bool tab = false;
+        bool fn = false;
+        bool shift = false;
+        bool ctrl = false;
+        bool opt = false;
+        bool alt = false;
+        bool del = false;
+        bool enter = false;
+        bool space = false;
+        uint8_t modifiers = 0;
+    };
+
+    bool isChange() { return false; }
+    uint8_t isPressed() { return 0; }
+    bool isKeyPressed(char) { return false; }
+    KeysState& keysState() { return state_; }
+
+private:
+    KeysState state_;
+};
+
+class M5CardputerHost {
+public:
+    M5GFX& Display = M5.Display;
+    Keyboard_Class Keyboard;
+
+    void begin(bool = true) {}
+    void begin(const M5HostConfig&, bool = true) {}
+    void update() {}
+};
+
+extern M5CardputerHost M5Cardputer;
@@ -0,0 +1,187 @@
+// Host HAL - M5Unified / M5GFX surface
+// Drawing calls are accepted and discarded; geometry queries return sane values
+// so layout code (text width, sprite size) behaves like the 240x135 panel.
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+
+namespace m5 {
+enum class board_t { board_unknown = 0, board_M5Cardputer, board_M5CardputerADV };
+
+struct rtc_date_t { int16_t year = 2024; int8_t month = 1; int8_t date = 1; int8_t weekDay = 1; };
+struct rtc_time_t { int8_t hours = 0; int8_t minutes = 0; int8_t seconds = 0; };
+struct rtc_datetime_t { rtc_date_t date; rtc_time_t time; };
+}  // namespace m5
+
+namespace lgfx {
+struct IFont {};
+namespace fonts {
+static const IFont Font0, Font2, Font4, FreeMono9pt7b, FreeMonoBold9pt7b, FreeSans9pt7b;
+}
+}  // namespace lgfx
+namespace fonts = lgfx::fonts;
+
+enum textdatum_t : uint8_t {
+    top_left = 0, top_center = 1, top_right = 2,
+    middle_left = 4, middle_center = 5, middle_right = 6,
+    bottom_left = 8, bottom_center = 9, bottom_right = 10,
+    baseline_left = 16, baseline_center = 17, baseline_right = 18
+};
+#define TL_DATUM top_left
+#define TC_DATUM top_center
+#define TR_DATUM top_right
+#define ML_DATUM middle_left
+#define MC_DATUM middle_center
+#define MR_DATUM middle_right
+#define BL_DATUM bottom_left
+#define BC_DATUM bottom_center
+#define BR_DATUM bottom_right
+
+#define TFT_BLACK 0x0000
+#define TFT_WHITE 0xFFFF
+#define TFT_RED 0xF800
+#define TFT_GREEN 0x07E0
+#define TFT_BLUE 0x001F
+#define TFT_YELLOW 0xFFE0
+#define TFT_ORANGE 0xFDA0
+#define TFT_DARKGREY 0x7BEF
+#define TFT_CYAN 0x07FF
+#define TFT_MAGENTA 0xF81F
+
+#define HOST_GFX_NOOP(name) template <typename... A> void name(A...) {}
+
+class LovyanGFX : public Print {
+public:
+    LovyanGFX(int16_t w = 240, int16_t h = 135) : w_(w), h_(h) {}
+
+    size_t write(uint8_t) override { return 1; }
+    using Print::write;
+
+    int16_t width() const { return w_; }
+    int16_t height() const { return h_; }
+    void setTextSize(float s) { textSize_ = s > 0 ? s : 1; }
+    void setTextSize(float sx, float) { setTextSize(sx); }
+    int32_t textWidth(const char* s) const { return s ? (int32_t)(strlen(s) * 6 * textSize_) : 0; }
+    int32_t textWidth(const String& s) const { return textWidth(s.c_str()); }
+    int32_t fontHeight() const { return (int32_t)(8 * textSize_); }
+    int32_t getCursorX() const { return cursorX_; }
+    int32_t getCursorY() const { return cursorY_; }
+    void setCursor(int32_t x, int32_t y) { cursorX_ = x; cursorY_ = y; }
+    uint8_t getTextDatum() const { return datum_; }
+    void setTextDatum(uint8_t d) { datum_ = d; }
+    void setTextDatum(textdatum_t d) { datum_ = d; }
+    void setFont(const lgfx::IFont*) {}
+    static uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+        return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+    }
+    template <typename... A> int32_t drawString(A...) { return 0; }
+    template <typename... A> int32_t drawCentreString(A...) { return 0; }
+    template <typename... A> size_t drawChar(A...) { return 0; }
+
+    HOST_GFX_NOOP(setTextColor) HOST_GFX_NOOP(setTextWrap) HOST_GFX_NOOP(setTextPadding)
+    HOST_GFX_NOOP(fillScreen) HOST_GFX_NOOP(fillSprite) HOST_GFX_NOOP(clear)
+    HOST_GFX_NOOP(drawPixel) HOST_GFX_NOOP(drawLine) HOST_GFX_NOOP(drawFastHLine) HOST_GFX_NOOP(drawFastVLine)
+    HOST_GFX_NOOP(drawRect) HOST_GFX_NOOP(fillRect) HOST_GFX_NOOP(drawRoundRect) HOST_GFX_NOOP(fillRoundRect)
+    HOST_GFX_NOOP(drawCircle) HOST_GFX_NOOP(fillCircle) HOST_GFX_NOOP(drawEllipse) HOST_GFX_NOOP(fillEllipse)
+    HOST_GFX_NOOP(drawTriangle) HOST_GFX_NOOP(fillTriangle) HOST_GFX_NOOP(drawArc) HOST_GFX_NOOP(fillArc)
+    HOST_GFX_NOOP(drawBitmap) HOST_GFX_NOOP(drawXBitmap) HOST_GFX_NOOP(pushImage) HOST_GFX_NOOP(readRectRGB)
+    HOST_GFX_NOOP(setColorDepth) HOST_GFX_NOOP(setRotation) HOST_GFX_NOOP(setBrightness)
+    HOST_GFX_NOOP(startWrite) HOST_GFX_NOOP(endWrite) HOST_GFX_NOOP(setPsram) HOST_GFX_NOOP(setClipRect)
+    HOST_GFX_NOOP(clearClipRect) HOST_GFX_NOOP(setScrollRect) HOST_GFX_NOOP(scroll) HOST_GFX_NOOP(display)
+
+protected:
+    int16_t w_;
+    int16_t h_;
+    float textSize_ = 1;
+    int32_t cursorX_ = 0;
+    int32_t cursorY_ = 0;
+    uint8_t datum_ = top_left;
+};
+
+class M5GFX : public LovyanGFX {};
+
+class M5Canvas : public LovyanGFX {
+public:
+    M5Canvas(LovyanGFX* parent = nullptr) : LovyanGFX(0, 0), parent_(parent) {}
+
+    void* createSprite(int32_t w, int32_t h) {
+        w_ = (int16_t)w;
+        h_ = (int16_t)h;
+        buffer_.assign((size_t)(w > 0 ? w : 0) * (size_t)(h > 0 ? h : 0), 0);
+        return buffer_.empty() ? nullptr : buffer_.data();
+    }
+    void deleteSprite() {
+        buffer_.clear();
+        buffer_.shrink_to_fit();
+        w_ = h_ = 0;
+    }
+    void* getBuffer() { return buffer_.empty() ? nullptr : buffer_.data(); }
+    HOST_GFX_NOOP(pushSprite)
+
+private:
+    LovyanGFX* parent_;
+    std::vector<uint16_t> buffer_;
+};
+
+namespace m5 {
+class Power_Class {
+public:
+    enum is_charging_t { is_discharging = 0, is_charging, charge_unknown };
+    int32_t getBatteryLevel() { return 100; }
+    int16_t getBatteryVoltage() { return 4100; }
+    int16_t getVBUSVoltage() { return 5000; }
+    is_charging_t isCharging() { return is_discharging; }
+};
+}  // namespace m5
+
+class M5HostSpeaker {
+public:
+    bool begin() { return true; }
+    void end() {}
+    bool tone(float, uint32_t = UINT32_MAX, int = -1, bool = true) { return true; }
+    void stop() {}
+    void setVolume(uint8_t) {}
+    bool isPlaying() { return false; }
+};
+
+class M5HostImu {
+public:
+    bool getAccel(float* x, float* y, float* z) {
+        if (x) *x = 0;
+        if (y) *y = 0;
+        if (z) *z = 1;
+        return true;
+    }
+};
+
+class M5HostRtc {
+public:
+    m5::rtc_datetime_t getDateTime() { return m5::rtc_datetime_t(); }
+};
+
+class M5HostButton {
+public:
+    bool wasPressed() { return false; }
+    bool wasReleased() { return false; }
+    bool isPressed() { return false; }
+};
+
+struct M5HostConfig {};
+
+class M5UnifiedHost {
+public:
+    M5GFX Display;
+    m5::Power_Class Power;
+    M5HostSpeaker Speaker;
+    M5HostImu Imu;
+    M5HostRtc Rtc;
+    M5HostButton BtnA;
+
+    M5HostConfig config() { return M5HostConfig(); }
+    void begin(const M5HostConfig& = M5HostConfig()) {}
+    void update() {}
+    m5::board_t getBoard() const { return m5::board_t::board_M5Cardputer; }
+};
+
+extern M5UnifiedHost M5;
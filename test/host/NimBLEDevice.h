@@ -0,0 +1,103 @@
+// Host HAL - NimBLE (stack is never initialized on the host; scans find nothing)
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+
+#define BLE_OWN_ADDR_PUBLIC 0
+#define BLE_OWN_ADDR_RANDOM 1
+#define BLE_GAP_CONN_MODE_NON 0
+#define BLE_GAP_CONN_MODE_DIR 1
+#define BLE_GAP_CONN_MODE_UND 2
+
+typedef enum { ESP_PWR_LVL_N12 = 0, ESP_PWR_LVL_N9, ESP_PWR_LVL_N6, ESP_PWR_LVL_N3, ESP_PWR_LVL_N0,
+               ESP_PWR_LVL_P3, ESP_PWR_LVL_P6, ESP_PWR_LVL_P9 } esp_power_level_t;
+
+typedef struct {
+    uint8_t type;
+    uint8_t val[6];
+} ble_addr_t;
+
+class NimBLEAddress {
+public:
+    const ble_addr_t* getBase() const { return &addr_; }
+    std::string toString() const { return "00:00:00:00:00:00"; }
+
+private:
+    ble_addr_t addr_ = {};
+};
+
+class NimBLEAdvertisedDevice {
+public:
+    NimBLEAddress getAddress() const { return NimBLEAddress(); }
+    const std::vector<uint8_t>& getPayload() const { return payload_; }
+    int getRSSI() const { return -127; }
+    std::string getName() const { return std::string(); }
+
+private:
+    std::vector<uint8_t> payload_;
+};
+
+class NimBLEScanResults {
+public:
+    int getCount() const { return 0; }
+};
+
+class NimBLEScanCallbacks {
+public:
+    virtual ~NimBLEScanCallbacks() {}
+    virtual void onDiscovered(const NimBLEAdvertisedDevice*) {}
+    virtual void onResult(const NimBLEAdvertisedDevice*) {}
+    virtual void onScanEnd(const NimBLEScanResults&, int) {}
+};
+
+class NimBLEScan {
+public:
+    bool isScanning() { return false; }
+    bool start(uint32_t = 0, bool = false, bool = true) { return true; }
+    bool stop() { return true; }
+    void clearResults() {}
+    void setScanCallbacks(NimBLEScanCallbacks*, bool = false) {}
+    void setActiveScan(bool) {}
+    void setInterval(uint16_t) {}
+    void setWindow(uint16_t) {}
+    void setDuplicateFilter(uint8_t) {}
+    void setMaxResults(uint8_t) {}
+};
+
+class NimBLEAdvertisementData {
+public:
+    bool addData(const uint8_t* data, size_t len) {
+        if (data_.size() + len > 31) return false;
+        data_.insert(data_.end(), data, data + len);
+        return true;
+    }
+    void clearData() { data_.clear(); }
+    const std::vector<uint8_t>& getPayload() const { return data_; }
+
+private:
+    std::vector<uint8_t> data_;
+};
+
+class NimBLEAdvertising {
+public:
+    bool isAdvertising() { return false; }
+    bool start(uint32_t = 0, const void* = nullptr) { return true; }
+    bool stop() { return true; }
+    bool setAdvertisementData(const NimBLEAdvertisementData&) { return true; }
+    bool setScanResponseData(const NimBLEAdvertisementData&) { return true; }
+    void setConnectableMode(uint8_t) {}
+    void setMinInterval(uint16_t) {}
+    void setMaxInterval(uint16_t) {}
+};
+
+class NimBLEDevice {
+public:
+    static bool isInitialized() { return false; }
+    static bool init(const std::string&) { return true; }
+    static bool deinit(bool = false) { return true; }
+    static bool setPower(int8_t) { return true; }
+    static bool setOwnAddrType(uint8_t) { return true; }
+    static NimBLEScan* getScan() { static NimBLEScan scan; return &scan; }
+    static NimBLEAdvertising* getAdvertising() { static NimBLEAdvertising adv; return &adv; }
+};
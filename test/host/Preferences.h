@@ -0,0 +1,5 @@
+// Host HAL - NVS Preferences (in-memory, shared with the unit test mock)
+#pragma once
+
+#include <Arduino.h>
+#include "../mocks/mock_preferences.h"
@@ -0,0 +1,20 @@
+// Host HAL - SD card on a host directory (no card until HostHal::mountSD)
+#pragma once
+
+#include <FS.h>
+#include <SPI.h>
+
+typedef enum { CARD_NONE, CARD_MMC, CARD_SD, CARD_SDHC, CARD_UNKNOWN } sdcard_type_t;
+
+class SDFS : public fs::FS {
+public:
+    bool begin(uint8_t = 0, SPIClass& = SPI, uint32_t = 4000000, const char* = "/sd",
+               uint8_t = 5, bool = false) { return isMounted(); }
+    void end() {}
+    sdcard_type_t cardType() { return isMounted() ? CARD_SDHC : CARD_NONE; }
+    uint64_t cardSize();
+    uint64_t totalBytes();
+    uint64_t usedBytes();
+};
+
+extern SDFS SD;
@@ -0,0 +1,16 @@
+// Host HAL - SPI bus (no-op)
+#pragma once
+
+#include <Arduino.h>
+
+class SPIClass {
+public:
+    SPIClass(uint8_t = 0) {}
+    void begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+    void end() {}
+};
+
+extern SPIClass SPI;
+
+#define FSPI 0
+#define HSPI 1
@@ -0,0 +1,17 @@
+// Host HAL - SPIFFS on a host directory (HostHal::mountSPIFFS)
+#pragma once
+
+#include <FS.h>
+
+class SPIFFSFS : public fs::FS {
+public:
+    bool begin(bool = false, const char* = "/spiffs", uint8_t = 10, const char* = nullptr) {
+        return isMounted();
+    }
+    void end() {}
+    bool format() { return isMounted(); }
+    size_t totalBytes() { return 1536 * 1024; }
+    size_t usedBytes() { return 0; }
+};
+
+extern SPIFFSFS SPIFFS;
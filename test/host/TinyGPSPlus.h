@@ -0,0 +1,87 @@
+// Host HAL - TinyGPSPlus (no fix, every field invalid)
+#pragma once
+
+#include <Arduino.h>
+
+struct TinyGPSLocation {
+    bool isValid() const { return false; }
+    bool isUpdated() { return false; }
+    uint32_t age() const { return UINT32_MAX; }
+    double lat() { return 0; }
+    double lng() { return 0; }
+};
+
+struct TinyGPSDate {
+    bool isValid() const { return false; }
+    bool isUpdated() { return false; }
+    uint32_t age() const { return UINT32_MAX; }
+    uint16_t year() { return 2000; }
+    uint8_t month() { return 1; }
+    uint8_t day() { return 1; }
+    uint32_t value() { return 0; }
+};
+
+struct TinyGPSTime {
+    bool isValid() const { return false; }
+    bool isUpdated() { return false; }
+    uint32_t age() const { return UINT32_MAX; }
+    uint8_t hour() { return 0; }
+    uint8_t minute() { return 0; }
+    uint8_t second() { return 0; }
+    uint8_t centisecond() { return 0; }
+    uint32_t value() { return 0; }
+};
+
+struct TinyGPSDecimal {
+    bool isValid() const { return false; }
+    bool isUpdated() { return false; }
+    uint32_t age() const { return UINT32_MAX; }
+    int32_t value() { return 0; }
+};
+
+struct TinyGPSInteger {
+    bool isValid() const { return false; }
+    bool isUpdated() { return false; }
+    uint32_t age() const { return UINT32_MAX; }
+    uint32_t value() { return 0; }
+};
+
+struct TinyGPSSpeed : TinyGPSDecimal {
+    double knots() { return 0; }
+    double mph() { return 0; }
+    double mps() { return 0; }
+    double kmph() { return 0; }
+};
+
+struct TinyGPSCourse : TinyGPSDecimal {
+    double deg() { return 0; }
+};
+
+struct TinyGPSAltitude : TinyGPSDecimal {
+    double meters() { return 0; }
+    double miles() { return 0; }
+    double kilometers() { return 0; }
+    double feet() { return 0; }
+};
+
+struct TinyGPSHDOP : TinyGPSDecimal {
+    double hdop() { return 0; }
+};
+
+class TinyGPSPlus {
+public:
+    TinyGPSLocation location;
+    TinyGPSDate date;
+    TinyGPSTime time;
+    TinyGPSSpeed speed;
+    TinyGPSCourse course;
+    TinyGPSAltitude altitude;
+    TinyGPSInteger satellites;
+    TinyGPSHDOP hdop;
+
+    bool encode(char) { return false; }
+    uint32_t charsProcessed() const { return 0; }
+    uint32_t sentencesWithFix() const { return 0; }
+    uint32_t failedChecksum() const { return 0; }
+    uint32_t passedChecksum() const { return 0; }
+};
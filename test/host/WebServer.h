@@ -0,0 +1,144 @@
+// Host HAL - Arduino WebServer with an in-process request injector
+// Handlers run exactly as on the device; HostHal tests call hostRequest()
+// / hostUpload() and get back the raw HTTP response bytes the handler wrote.
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <functional>
+#include <utility>
+#include <vector>
+
+typedef enum { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS } HTTPMethod;
+typedef enum { UPLOAD_FILE_START, UPLOAD_FILE_WRITE, UPLOAD_FILE_END, UPLOAD_FILE_ABORTED } HTTPUploadStatus;
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+#define HTTP_UPLOAD_BUFLEN 1436
+
+struct HTTPUpload {
+    HTTPUploadStatus status;
+    String filename;
+    String name;
+    String type;
+    size_t totalSize;
+    size_t currentSize;
+    uint8_t buf[HTTP_UPLOAD_BUFLEN];
+};
+
+class WebServer {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    explicit WebServer(int port = 80) : port_(port) {}
+    virtual ~WebServer() {}
+
+    void begin() { running_ = true; }
+    void begin(uint16_t port) { port_ = port; running_ = true; }
+    void stop() { running_ = false; }
+    void close() { stop(); }
+    void handleClient() {}
+
+    void on(const String& uri, THandlerFunction fn) { on(uri, HTTP_ANY, fn); }
+    void on(const String& uri, HTTPMethod method, THandlerFunction fn) { on(uri, method, fn, nullptr); }
+    void on(const String& uri, HTTPMethod method, THandlerFunction fn, THandlerFunction uploadFn) {
+        routes_.push_back({uri, method, fn, uploadFn});
+    }
+    void onNotFound(THandlerFunction fn) { notFound_ = fn; }
+
+    // Request
+    String uri() const { return uri_; }
+    HTTPMethod method() const { return method_; }
+    String arg(const String& name) const;
+    String arg(int i) const { return i >= 0 && (size_t)i < args_.size() ? args_[i].second : String(); }
+    String argName(int i) const { return i >= 0 && (size_t)i < args_.size() ? args_[i].first : String(); }
+    int args() const { return (int)args_.size(); }
+    bool hasArg(const String& name) const;
+    void collectHeaders(const char* headerKeys[], size_t count);
+    String header(const String& name) const;
+    bool hasHeader(const String& name) const;
+    int headers() const { return (int)headers_.size(); }
+    HTTPUpload& upload() { return upload_; }
+    WiFiClient client() { return _currentClient; }
+
+    // Response
+    void sendHeader(const String& name, const String& value, bool first = false);
+    void setContentLength(size_t len) { contentLength_ = len; }
+    void send(int code, const char* contentType = nullptr, const String& content = String());
+    void send(int code, const String& contentType, const String& content) { send(code, contentType.c_str(), content); }
+    void send_P(int code, const char* contentType, const char* content) { send(code, contentType, String(content)); }
+    void send_P(int code, const char* contentType, const char* content, size_t len) {
+        send(code, contentType, String(std::string(content, len)));
+    }
+    void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+    void sendContent(const char* content, size_t len);
+    void sendContent_P(const char* content) { sendContent(content, strlen(content)); }
+
+    template <typename T>
+    size_t streamFile(T& file, const String& contentType, int code = 200) {
+        setContentLength(file.size());
+        send(code, contentType.c_str(), String());
+        uint8_t buf[1024];
+        size_t total = 0;
+        size_t n;
+        while ((n = file.read(buf, sizeof(buf))) > 0) total += _currentClient.write(buf, n);
+        return total;
+    }
+
+    // Host side
+    struct HostHeader {
+        String name;
+        String value;
+    };
+
+    /**
+     * @brief Run one request through the registered handlers
+     * @param target Path with optional query string ("/api/ls?dir=/")
+     * @param body Raw body; form-encoded bodies are parsed into args, others land in arg("plain")
+     * @return Raw HTTP response (status line, headers, body) written by the handler
+     */
+    std::string hostRequest(HTTPMethod method, const char* target, const std::string& body = std::string(),
+                            const std::vector<HostHeader>& headers = {});
+
+    // Drive an upload route: START, WRITE per chunk, END, then the route handler
+    std::string hostUpload(const char* target, const char* filename, const std::string& data,
+                           size_t chunk = HTTP_UPLOAD_BUFLEN);
+
+    // Send window for the next requests' connections (SIZE_MAX = unlimited)
+    void hostSetTxWindow(size_t bytes) { hostTxWindow_ = bytes; }
+    // Connection of the last request; stays valid after a handler hands it off
+    std::shared_ptr<HostConnection> hostLastConnection() const { return lastConn_; }
+
+protected:
+    // Named as in the ESP32 core, where subclasses reach it the same way
+    WiFiClient _currentClient;
+
+private:
+    struct Route {
+        String uri;
+        HTTPMethod method;
+        THandlerFunction fn;
+        THandlerFunction uploadFn;
+    };
+
+    const Route* findRoute() const;
+    void beginRequest(HTTPMethod method, const char* target, const std::vector<HostHeader>& headers);
+    void writeRaw(const std::string& data);
+
+    int port_;
+    bool running_ = false;
+    std::vector<Route> routes_;
+    THandlerFunction notFound_;
+
+    String uri_;
+    HTTPMethod method_ = HTTP_GET;
+    std::vector<std::pair<String, String>> args_;
+    std::vector<String> collected_;
+    std::vector<std::pair<String, String>> headers_;
+    std::vector<std::pair<String, String>> responseHeaders_;
+    size_t contentLength_ = CONTENT_LENGTH_NOT_SET;
+    bool chunked_ = false;
+    HTTPUpload upload_ = {};
+    size_t hostTxWindow_ = SIZE_MAX;
+    std::shared_ptr<HostConnection> lastConn_;
+};
@@ -0,0 +1,80 @@
+// Host HAL - Arduino WiFi
+// Station connects only when HostHal::setStationLink(true); scans find nothing
+#pragma once
+
+#include <Arduino.h>
+#include "esp_wifi.h"
+#include "WiFiClient.h"
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6,
+    WL_NO_SHIELD = 255
+} wl_status_t;
+
+#define WIFI_OFF WIFI_MODE_NULL
+#define WIFI_STA WIFI_MODE_STA
+#define WIFI_AP WIFI_MODE_AP
+#define WIFI_AP_STA WIFI_MODE_APSTA
+
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED (-2)
+
+class WiFiClass {
+public:
+    void persistent(bool) {}
+    bool setSleep(bool) { return true; }
+    bool mode(wifi_mode_t m) { esp_wifi_set_mode(m); return true; }
+    wifi_mode_t getMode() {
+        wifi_mode_t m = WIFI_MODE_NULL;
+        esp_wifi_get_mode(&m);
+        return m;
+    }
+    bool disconnect(bool = false, bool = false);
+    wl_status_t begin(const char* ssid, const char* = nullptr, int32_t = 0, const uint8_t* = nullptr, bool = true);
+    wl_status_t status();
+    bool isConnected() { return status() == WL_CONNECTED; }
+    bool reconnect() { return begin(nullptr) == WL_CONNECTED; }
+    bool setAutoReconnect(bool) { return true; }
+    bool setHostname(const char*) { return true; }
+    bool config(IPAddress, IPAddress, IPAddress, IPAddress = IPAddress(), IPAddress = IPAddress()) { return true; }
+
+    String SSID();
+    String SSID(uint8_t) { return String(); }
+    int32_t RSSI() { return 0; }
+    int32_t RSSI(uint8_t) { return 0; }
+    uint8_t* BSSID(uint8_t = 0) { return nullptr; }
+    int32_t channel(uint8_t = 0) { return 0; }
+    wifi_auth_mode_t encryptionType(uint8_t) { return WIFI_AUTH_OPEN; }
+    IPAddress localIP() { return isConnected() ? IPAddress(10, 0, 0, 2) : IPAddress(); }
+    IPAddress gatewayIP() { return isConnected() ? IPAddress(10, 0, 0, 1) : IPAddress(); }
+    IPAddress dnsIP(uint8_t = 0) { return IPAddress(); }
+    uint8_t* macAddress(uint8_t* mac) {
+        esp_wifi_get_mac(WIFI_IF_STA, mac);
+        return mac;
+    }
+    String macAddress() {
+        uint8_t mac[6];
+        esp_wifi_get_mac(WIFI_IF_STA, mac);
+        char buf[18];
+        snprintf(buf, sizeof(buf), "%02X:%02X:%02X:%02X:%02X:%02X",
+                 mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+        return String(buf);
+    }
+
+    int16_t scanNetworks(bool = false, bool = false, bool = false, uint32_t = 300, uint8_t = 0) { return 0; }
+    int16_t scanComplete() { return 0; }
+    void scanDelete() {}
+
+    bool softAP(const char*, const char* = nullptr, int = 1, int = 0, int = 4) { return true; }
+    bool softAPConfig(IPAddress, IPAddress, IPAddress) { return true; }
+    bool softAPdisconnect(bool = false) { return true; }
+    IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,65 @@
+// Host HAL - WiFiClient over an in-process responder
+// Writes accumulate as a request; the first read after a write hands the
+// request to HostHal's NetResponder and serves its reply. Without a
+// responder (or with the station link down) connect() fails.
+// Server-side connections model the socket send buffer with txWindow. As
+// on the ESP32 core, write() into a full window blocks (the virtual clock
+// jumps by the core's 10 x 1 s select() retries, then the write comes back
+// short) and availableForWrite() is always 0; lwip_send() with
+// MSG_DONTWAIT on fd() is the non-blocking path.
+#pragma once
+
+#include <Arduino.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+struct HostConnection {
+    std::string host;
+    uint16_t port = 0;
+    std::string tx;          // Bytes written since the last exchange
+    std::string rx;          // Reply being served
+    size_t rxPos = 0;
+    bool open = false;       // Peer still accepting requests
+    bool serverSide = false; // Accepted by WebServer (writes are the response)
+    size_t txWindow = SIZE_MAX; // Server side: bytes the peer takes before it reads
+    int fd = -1;             // Assigned by the first WiFiClient::fd()
+};
+
+class WiFiClient : public Stream {
+public:
+    WiFiClient() {}
+    explicit WiFiClient(std::shared_ptr<HostConnection> conn) : conn_(conn) {}
+    virtual ~WiFiClient() {}
+
+    virtual int connect(const char* host, uint16_t port);
+    virtual int connect(const char* host, uint16_t port, int32_t) { return connect(host, port); }
+    int connect(IPAddress ip, uint16_t port) { return connect(ip.toString().c_str(), port); }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buf, size_t len) override;
+    using Print::write;
+    size_t write_P(const char* buf, size_t len) { return write((const uint8_t*)buf, len); }
+    int available() override;
+    int read() override;
+    int read(uint8_t* buf, size_t len);
+    int peek() override;
+    void flush() override {}
+    int availableForWrite() { return 0; }   // Print default, as on the ESP32 core
+
+    virtual void stop();
+    uint8_t connected();
+    int fd() const;
+    operator bool() { return connected(); }
+    int setNoDelay(bool) { return 0; }
+    IPAddress remoteIP() const { return IPAddress(10, 0, 0, 9); }
+    uint16_t remotePort() const { return conn_ ? conn_->port : 0; }
+
+    // Host side: the connection behind this handle (shared by copies)
+    std::shared_ptr<HostConnection> hostConnection() const { return conn_; }
+
+protected:
+    bool fill();
+
+    std::shared_ptr<HostConnection> conn_;
+};
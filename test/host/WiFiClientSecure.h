@@ -0,0 +1,15 @@
+// Host HAL - WiFiClientSecure (plain WiFiClient; no TLS on the host)
+#pragma once
+
+#include <WiFi.h>
+
+class WiFiClientSecure : public WiFiClient {
+public:
+    void setInsecure() {}
+    void setCACert(const char*) {}
+    void setHandshakeTimeout(unsigned long) {}
+    int lastError(char* buf, size_t size) {
+        if (buf && size) buf[0] = '\0';
+        return 0;
+    }
+};
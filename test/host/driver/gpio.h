@@ -0,0 +1,8 @@
+// Host HAL - ESP-IDF GPIO driver (no-op)
+#pragma once
+
+#include "../esp_wifi_types.h"
+
+typedef int gpio_num_t;
+
+inline esp_err_t gpio_reset_pin(gpio_num_t) { return ESP_OK; }
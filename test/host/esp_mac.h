@@ -0,0 +1,9 @@
+// Host HAL - factory MAC
+#pragma once
+
+#include <esp_wifi_types.h>
+
+typedef enum { ESP_MAC_WIFI_STA, ESP_MAC_WIFI_SOFTAP, ESP_MAC_BT, ESP_MAC_ETH } esp_mac_type_t;
+
+esp_err_t esp_efuse_mac_get_default(uint8_t* mac);
+esp_err_t esp_read_mac(uint8_t* mac, esp_mac_type_t type);
@@ -0,0 +1,11 @@
+// Host HAL - esp_system / esp_random
+#pragma once
+
+#include <Arduino.h>
+#include <esp_wifi_types.h>
+
+uint32_t esp_random();
+void esp_fill_random(void* buf, size_t len);
+uint32_t esp_get_free_heap_size();
+uint32_t esp_get_minimum_free_heap_size();
+void esp_restart();
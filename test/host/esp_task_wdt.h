@@ -0,0 +1,8 @@
+// Host HAL - task watchdog (no-op)
+#pragma once
+
+#include "esp_wifi_types.h"
+
+inline esp_err_t esp_task_wdt_reset() { return ESP_OK; }
+inline esp_err_t esp_task_wdt_add(void*) { return ESP_OK; }
+inline esp_err_t esp_task_wdt_delete(void*) { return ESP_OK; }
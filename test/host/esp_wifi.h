@@ -0,0 +1,23 @@
+// Host HAL - ESP-IDF WiFi driver
+// Promiscuous state, channel and TX are recorded for the driver (see host_hal.h)
+#pragma once
+
+#include "esp_wifi_types.h"
+
+esp_err_t esp_wifi_init(const wifi_init_config_t* config);
+esp_err_t esp_wifi_deinit();
+esp_err_t esp_wifi_start();
+esp_err_t esp_wifi_stop();
+esp_err_t esp_wifi_set_mode(wifi_mode_t mode);
+esp_err_t esp_wifi_get_mode(wifi_mode_t* mode);
+esp_err_t esp_wifi_get_config(wifi_interface_t iface, wifi_config_t* conf);
+esp_err_t esp_wifi_set_channel(uint8_t primary, wifi_second_chan_t second);
+esp_err_t esp_wifi_get_channel(uint8_t* primary, wifi_second_chan_t* second);
+esp_err_t esp_wifi_set_promiscuous(bool en);
+esp_err_t esp_wifi_get_promiscuous(bool* en);
+esp_err_t esp_wifi_set_promiscuous_rx_cb(wifi_promiscuous_cb_t cb);
+esp_err_t esp_wifi_set_promiscuous_filter(const wifi_promiscuous_filter_t* filter);
+esp_err_t esp_wifi_80211_tx(wifi_interface_t iface, const void* buffer, int len, bool en_sys_seq);
+esp_err_t esp_wifi_get_mac(wifi_interface_t iface, uint8_t mac[6]);
+esp_err_t esp_wifi_set_mac(wifi_interface_t iface, const uint8_t mac[6]);
+esp_err_t esp_wifi_set_max_tx_power(int8_t power);
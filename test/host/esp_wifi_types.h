@@ -0,0 +1,117 @@
+// Host HAL - ESP-IDF WiFi types (ESP32-S3 layouts where code depends on them)
+#pragma once
+
+#include <cstdint>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_WIFI_NOT_INIT 0x3001
+
+typedef enum {
+    WIFI_MODE_NULL = 0,
+    WIFI_MODE_STA,
+    WIFI_MODE_AP,
+    WIFI_MODE_APSTA,
+    WIFI_MODE_MAX
+} wifi_mode_t;
+
+typedef enum {
+    WIFI_IF_STA = 0,
+    WIFI_IF_AP,
+} wifi_interface_t;
+
+typedef enum {
+    WIFI_AUTH_OPEN = 0,
+    WIFI_AUTH_WEP,
+    WIFI_AUTH_WPA_PSK,
+    WIFI_AUTH_WPA2_PSK,
+    WIFI_AUTH_WPA_WPA2_PSK,
+    WIFI_AUTH_WPA2_ENTERPRISE,
+    WIFI_AUTH_WPA3_PSK,
+    WIFI_AUTH_WPA2_WPA3_PSK,
+    WIFI_AUTH_WAPI_PSK,
+    WIFI_AUTH_MAX
+} wifi_auth_mode_t;
+
+typedef enum {
+    WIFI_SECOND_CHAN_NONE = 0,
+    WIFI_SECOND_CHAN_ABOVE,
+    WIFI_SECOND_CHAN_BELOW,
+} wifi_second_chan_t;
+
+typedef enum {
+    WIFI_PKT_MGMT,
+    WIFI_PKT_CTRL,
+    WIFI_PKT_DATA,
+    WIFI_PKT_MISC,
+} wifi_promiscuous_pkt_type_t;
+
+// ESP32-S3 RX control header - sig_len includes the 4-byte FCS
+typedef struct {
+    signed rssi : 8;
+    unsigned rate : 5;
+    unsigned : 1;
+    unsigned sig_mode : 2;
+    unsigned : 16;
+    unsigned mcs : 7;
+    unsigned cwb : 1;
+    unsigned : 16;
+    unsigned smoothing : 1;
+    unsigned not_sounding : 1;
+    unsigned : 1;
+    unsigned aggregation : 1;
+    unsigned stbc : 2;
+    unsigned fec_coding : 1;
+    unsigned sgi : 1;
+    unsigned : 8;
+    unsigned ampdu_cnt : 8;
+    unsigned channel : 4;
+    unsigned secondary_channel : 4;
+    unsigned : 8;
+    unsigned timestamp : 32;
+    unsigned : 32;
+    signed noise_floor : 8;
+    unsigned : 24;
+    unsigned : 32;
+    unsigned : 31;
+    unsigned ant : 1;
+    unsigned sig_len : 12;
+    unsigned : 12;
+    unsigned rx_state : 8;
+} wifi_pkt_rx_ctrl_t;
+
+typedef struct {
+    wifi_pkt_rx_ctrl_t rx_ctrl;
+    uint8_t payload[0];
+} wifi_promiscuous_pkt_t;
+
+#define WIFI_PROMIS_FILTER_MASK_ALL 0xFFFFFFFF
+#define WIFI_PROMIS_FILTER_MASK_MGMT (1 << 0)
+#define WIFI_PROMIS_FILTER_MASK_CTRL (1 << 1)
+#define WIFI_PROMIS_FILTER_MASK_DATA (1 << 2)
+
+typedef struct {
+    uint32_t filter_mask;
+} wifi_promiscuous_filter_t;
+
+typedef void (*wifi_promiscuous_cb_t)(void* buf, wifi_promiscuous_pkt_type_t type);
+
+typedef struct {
+    uint8_t ssid[32];
+    uint8_t password[64];
+    uint8_t channel;
+    uint8_t bssid_set;
+    uint8_t bssid[6];
+} wifi_sta_config_t;
+
+typedef union {
+    wifi_sta_config_t sta;
+} wifi_config_t;
+
+typedef struct {
+    int reserved;
+} wifi_init_config_t;
+
+#define WIFI_INIT_CONFIG_DEFAULT() wifi_init_config_t{0}
@@ -0,0 +1,197 @@
+// Host HAL - mbedTLS SHA-256 / base64 subset and ESP-NOW peer table
+
+#include "host_hal.h"
+#include <esp_now.h>
+#include <mbedtls/base64.h>
+#include <mbedtls/sha256.h>
+#include <vector>
+
+// ============================================================================
+// SHA-256 (FIPS 180-4)
+// ============================================================================
+
+static const uint32_t kSha256K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+static inline uint32_t ror(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+static void sha256Block(mbedtls_sha256_context* ctx, const uint8_t* p) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) {
+        w[i] = ((uint32_t)p[i * 4] << 24) | ((uint32_t)p[i * 4 + 1] << 16) |
+               ((uint32_t)p[i * 4 + 2] << 8) | p[i * 4 + 3];
+    }
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = ror(w[i - 15], 7) ^ ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = ror(w[i - 2], 17) ^ ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    uint32_t a = ctx->state[0], b = ctx->state[1], c = ctx->state[2], d = ctx->state[3];
+    uint32_t e = ctx->state[4], f = ctx->state[5], g = ctx->state[6], h = ctx->state[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (ror(e, 6) ^ ror(e, 11) ^ ror(e, 25)) + ((e & f) ^ (~e & g)) + kSha256K[i] + w[i];
+        uint32_t t2 = (ror(a, 2) ^ ror(a, 13) ^ ror(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    ctx->state[0] += a; ctx->state[1] += b; ctx->state[2] += c; ctx->state[3] += d;
+    ctx->state[4] += e; ctx->state[5] += f; ctx->state[6] += g; ctx->state[7] += h;
+}
+
+void mbedtls_sha256_init(mbedtls_sha256_context* ctx) { memset(ctx, 0, sizeof(*ctx)); }
+void mbedtls_sha256_free(mbedtls_sha256_context* ctx) { if (ctx) memset(ctx, 0, sizeof(*ctx)); }
+
+int mbedtls_sha256_starts(mbedtls_sha256_context* ctx, int is224) {
+    static const uint32_t iv256[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                      0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    static const uint32_t iv224[8] = {0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939,
+                                      0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4};
+    memcpy(ctx->state, is224 ? iv224 : iv256, sizeof(ctx->state));
+    ctx->total = 0;
+    ctx->is224 = is224;
+    return 0;
+}
+
+int mbedtls_sha256_update(mbedtls_sha256_context* ctx, const unsigned char* input, size_t len) {
+    size_t fill = (size_t)(ctx->total & 63);
+    ctx->total += len;
+    while (len > 0) {
+        size_t n = std::min(len, (size_t)64 - fill);
+        memcpy(ctx->buffer + fill, input, n);
+        fill += n;
+        input += n;
+        len -= n;
+        if (fill == 64) {
+            sha256Block(ctx, ctx->buffer);
+            fill = 0;
+        }
+    }
+    return 0;
+}
+
+int mbedtls_sha256_finish(mbedtls_sha256_context* ctx, unsigned char output[32]) {
+    uint64_t bits = ctx->total * 8;
+    uint8_t pad = 0x80;
+    mbedtls_sha256_update(ctx, &pad, 1);
+    uint8_t zero = 0;
+    while ((ctx->total & 63) != 56) mbedtls_sha256_update(ctx, &zero, 1);
+    uint8_t len[8];
+    for (int i = 0; i < 8; i++) len[i] = (uint8_t)(bits >> (56 - i * 8));
+    mbedtls_sha256_update(ctx, len, 8);
+    int words = ctx->is224 ? 7 : 8;
+    for (int i = 0; i < words; i++) {
+        output[i * 4] = (uint8_t)(ctx->state[i] >> 24);
+        output[i * 4 + 1] = (uint8_t)(ctx->state[i] >> 16);
+        output[i * 4 + 2] = (uint8_t)(ctx->state[i] >> 8);
+        output[i * 4 + 3] = (uint8_t)ctx->state[i];
+    }
+    return 0;
+}
+
+int mbedtls_sha256(const unsigned char* input, size_t len, unsigned char output[32], int is224) {
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, is224);
+    mbedtls_sha256_update(&ctx, input, len);
+    mbedtls_sha256_finish(&ctx, output);
+    mbedtls_sha256_free(&ctx);
+    return 0;
+}
+
+// ============================================================================
+// Base64
+// ============================================================================
+
+static const char kB64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+int mbedtls_base64_encode(unsigned char* dst, size_t dlen, size_t* olen, const unsigned char* src, size_t slen) {
+    size_t need = ((slen + 2) / 3) * 4;
+    if (!dst || dlen < need + 1) {
+        *olen = need + 1;
+        return slen ? MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL : 0;
+    }
+    size_t o = 0;
+    for (size_t i = 0; i < slen; i += 3) {
+        uint32_t v = (uint32_t)src[i] << 16;
+        if (i + 1 < slen) v |= (uint32_t)src[i + 1] << 8;
+        if (i + 2 < slen) v |= src[i + 2];
+        dst[o++] = kB64[(v >> 18) & 63];
+        dst[o++] = kB64[(v >> 12) & 63];
+        dst[o++] = i + 1 < slen ? kB64[(v >> 6) & 63] : '=';
+        dst[o++] = i + 2 < slen ? kB64[v & 63] : '=';
+    }
+    dst[o] = 0;
+    *olen = o;
+    return 0;
+}
+
+int mbedtls_base64_decode(unsigned char* dst, size_t dlen, size_t* olen, const unsigned char* src, size_t slen) {
+    std::vector<uint8_t> out;
+    uint32_t acc = 0;
+    int bits = 0;
+    for (size_t i = 0; i < slen; i++) {
+        unsigned char c = src[i];
+        if (c == '=' || c == '\r' || c == '\n') continue;
+        const char* pos = strchr(kB64, c);
+        if (!pos || !c) return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+        acc = (acc << 6) | (uint32_t)(pos - kB64);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            out.push_back((uint8_t)(acc >> bits));
+        }
+    }
+    *olen = out.size();
+    if (!dst || dlen < out.size()) return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+    memcpy(dst, out.data(), out.size());
+    return 0;
+}
+
+// ============================================================================
+// ESP-NOW
+// ============================================================================
+
+static bool espNowUp = false;
+static std::vector<std::vector<uint8_t>> espNowPeers;
+
+esp_err_t esp_now_init() { espNowUp = true; return ESP_OK; }
+esp_err_t esp_now_deinit() { espNowUp = false; espNowPeers.clear(); return ESP_OK; }
+esp_err_t esp_now_set_pmk(const uint8_t*) { return espNowUp ? ESP_OK : ESP_ERR_ESPNOW_NOT_INIT; }
+esp_err_t esp_now_register_recv_cb(esp_now_recv_cb_t) { return ESP_OK; }
+esp_err_t esp_now_register_send_cb(esp_now_send_cb_t) { return ESP_OK; }
+
+bool esp_now_is_peer_exist(const uint8_t* mac) {
+    for (const auto& p : espNowPeers) {
+        if (memcmp(p.data(), mac, 6) == 0) return true;
+    }
+    return false;
+}
+
+esp_err_t esp_now_add_peer(const esp_now_peer_info_t* peer) {
+    if (!espNowUp) return ESP_ERR_ESPNOW_NOT_INIT;
+    if (esp_now_is_peer_exist(peer->peer_addr)) return ESP_ERR_ESPNOW_EXIST;
+    espNowPeers.emplace_back(peer->peer_addr, peer->peer_addr + 6);
+    return ESP_OK;
+}
+
+esp_err_t esp_now_del_peer(const uint8_t* mac) {
+    for (auto it = espNowPeers.begin(); it != espNowPeers.end(); ++it) {
+        if (memcmp(it->data(), mac, 6) == 0) {
+            espNowPeers.erase(it);
+            return ESP_OK;
+        }
+    }
+    return ESP_FAIL;
+}
+
+esp_err_t esp_now_send(const uint8_t*, const uint8_t*, size_t len) {
+    if (!espNowUp) return ESP_ERR_ESPNOW_NOT_INIT;
+    return len <= ESP_NOW_MAX_DATA_LEN ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
@@ -0,0 +1,235 @@
+// Host HAL - directory-backed fs::FS / fs::File
+
+#include "host_hal.h"
+#include <FS.h>
+#include <SD.h>
+#include <SPIFFS.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <unistd.h>
+#include <cerrno>
+
+SDFS SD;
+SPIFFSFS SPIFFS;
+
+static int64_t sdWriteBudget = -1;  // HostHal::setSdWriteBudget
+
+namespace fs {
+
+struct HostFileImpl {
+    FILE* fp = nullptr;
+    DIR* dir = nullptr;
+    std::string path;       // Firmware-visible path ("/porkchop/x.txt")
+    std::string real;       // Host path
+    std::string name;       // Basename (what ESP32 core 2.x+ returns)
+    const FS* owner = nullptr;
+
+    ~HostFileImpl() { closeAll(); }
+    void closeAll() {
+        if (fp) fclose(fp);
+        if (dir) closedir(dir);
+        fp = nullptr;
+        dir = nullptr;
+    }
+};
+
+static std::string normalize(const char* path) {
+    std::string p = path ? path : "/";
+    if (p.empty() || p[0] != '/') p.insert(p.begin(), '/');
+    while (p.size() > 1 && p.back() == '/') p.pop_back();
+    return p;
+}
+
+static std::string baseName(const std::string& path) {
+    size_t slash = path.rfind('/');
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+static std::string joinPath(const std::string& dir, const char* entry) {
+    return dir == "/" ? "/" + std::string(entry) : dir + "/" + entry;
+}
+
+static void makeParents(const std::string& real) {
+    for (size_t i = 1; i < real.size(); i++) {
+        if (real[i] == '/') ::mkdir(real.substr(0, i).c_str(), 0755);
+    }
+}
+
+// ============================================================================
+// File
+// ============================================================================
+
+size_t File::write(uint8_t c) { return write(&c, 1); }
+
+size_t File::write(const uint8_t* buf, size_t len) {
+    if (!impl_ || !impl_->fp) return 0;
+    if (impl_->owner == &SD && sdWriteBudget >= 0) {
+        if ((int64_t)len > sdWriteBudget) len = (size_t)sdWriteBudget;
+        sdWriteBudget -= (int64_t)len;
+    }
+    return fwrite(buf, 1, len, impl_->fp);
+}
+
+int File::available() {
+    if (!impl_ || !impl_->fp) return 0;
+    long pos = ftell(impl_->fp);
+    size_t total = size();
+    return pos < 0 || (size_t)pos >= total ? 0 : (int)(total - (size_t)pos);
+}
+
+int File::read() {
+    if (!impl_ || !impl_->fp) return -1;
+    int c = fgetc(impl_->fp);
+    return c == EOF ? -1 : c;
+}
+
+int File::peek() {
+    if (!impl_ || !impl_->fp) return -1;
+    int c = fgetc(impl_->fp);
+    if (c == EOF) return -1;
+    ungetc(c, impl_->fp);
+    return c;
+}
+
+size_t File::read(uint8_t* buf, size_t len) {
+    if (!impl_ || !impl_->fp) return 0;
+    return fread(buf, 1, len, impl_->fp);
+}
+
+void File::flush() {
+    if (impl_ && impl_->fp) fflush(impl_->fp);
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+    if (!impl_ || !impl_->fp) return false;
+    int whence = mode == SeekCur ? SEEK_CUR : (mode == SeekEnd ? SEEK_END : SEEK_SET);
+    return fseek(impl_->fp, (long)pos, whence) == 0;
+}
+
+size_t File::position() const {
+    if (!impl_ || !impl_->fp) return 0;
+    long pos = ftell(impl_->fp);
+    return pos < 0 ? 0 : (size_t)pos;
+}
+
+size_t File::size() const {
+    if (!impl_ || !impl_->fp) return 0;
+    fflush(impl_->fp);
+    struct stat st;
+    return fstat(fileno(impl_->fp), &st) == 0 ? (size_t)st.st_size : 0;
+}
+
+void File::close() {
+    if (impl_) impl_->closeAll();
+    impl_.reset();
+}
+
+File::operator bool() const { return impl_ && (impl_->fp || impl_->dir); }
+
+time_t File::getLastWrite() {
+    if (!impl_) return 0;
+    struct stat st;
+    return stat(impl_->real.c_str(), &st) == 0 ? st.st_mtime : 0;
+}
+
+const char* File::path() const { return impl_ ? impl_->path.c_str() : ""; }
+const char* File::name() const { return impl_ ? impl_->name.c_str() : ""; }
+bool File::isDirectory() { return impl_ && impl_->dir; }
+
+File File::openNextFile(const char* mode) {
+    if (!impl_ || !impl_->dir || !impl_->owner) return File();
+    struct dirent* ent;
+    while ((ent = readdir(impl_->dir)) != nullptr) {
+        if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) continue;
+        std::string child = joinPath(impl_->path, ent->d_name);
+        return const_cast<FS*>(impl_->owner)->open(child.c_str(), mode);
+    }
+    return File();
+}
+
+void File::rewindDirectory() {
+    if (impl_ && impl_->dir) rewinddir(impl_->dir);
+}
+
+// ============================================================================
+// FS
+// ============================================================================
+
+std::string FS::realPath(const char* path) const {
+    std::string p = normalize(path);
+    return p == "/" ? root_ : root_ + p;
+}
+
+File FS::open(const char* path, const char* mode, bool create) {
+    if (!isMounted() || !path) return File();
+    auto impl = std::make_shared<HostFileImpl>();
+    impl->path = normalize(path);
+    impl->real = realPath(path);
+    impl->name = baseName(impl->path);
+    impl->owner = this;
+
+    struct stat st;
+    bool isDir = stat(impl->real.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+    if (isDir) {
+        if (strcmp(mode, FILE_READ) != 0) return File();
+        impl->dir = opendir(impl->real.c_str());
+        return impl->dir ? File(impl) : File();
+    }
+
+    if (create) makeParents(impl->real);
+    std::string m = mode;
+    if (m.find('b') == std::string::npos) m += 'b';
+    impl->fp = fopen(impl->real.c_str(), m.c_str());
+    return impl->fp ? File(impl) : File();
+}
+
+bool FS::exists(const char* path) {
+    struct stat st;
+    return isMounted() && path && stat(realPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char* path) {
+    return isMounted() && path && unlink(realPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const char* from, const char* to) {
+    return isMounted() && from && to && ::rename(realPath(from).c_str(), realPath(to).c_str()) == 0;
+}
+
+bool FS::mkdir(const char* path) {
+    if (!isMounted() || !path) return false;
+    return ::mkdir(realPath(path).c_str(), 0755) == 0 || errno == EEXIST;
+}
+
+bool FS::rmdir(const char* path) {
+    return isMounted() && path && ::rmdir(realPath(path).c_str()) == 0;
+}
+
+}  // namespace fs
+
+// ============================================================================
+// SD card geometry (the host filesystem the root lives on)
+// ============================================================================
+
+uint64_t SDFS::cardSize() { return totalBytes(); }
+
+uint64_t SDFS::totalBytes() {
+    struct statvfs vfs;
+    if (!isMounted() || statvfs(root_.c_str(), &vfs) != 0) return 0;
+    return (uint64_t)vfs.f_blocks * vfs.f_frsize;
+}
+
+uint64_t SDFS::usedBytes() {
+    struct statvfs vfs;
+    if (!isMounted() || statvfs(root_.c_str(), &vfs) != 0) return 0;
+    return (uint64_t)(vfs.f_blocks - vfs.f_bfree) * vfs.f_frsize;
+}
+
+namespace HostHal {
+
+void mountSD(const char* dir) { SD.setRoot(dir ? dir : ""); }
+void mountSPIFFS(const char* dir) { SPIFFS.setRoot(dir ? dir : ""); }
+void setSdWriteBudget(int64_t bytes) { sdWriteBudget = bytes; }
+
+}  // namespace HostHal
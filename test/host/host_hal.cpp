@@ -0,0 +1,330 @@
+// Host HAL - globals and non-inline pieces of the Arduino/ESP-IDF shims
+
+#include "host_hal.h"
+#include <SD.h>
+#include <SPI.h>
+#include <WiFi.h>
+#include <M5Cardputer.h>
+#include <esp_heap_caps.h>
+#include <esp_mac.h>
+#include <esp_system.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+#include <unistd.h>
+
+HardwareSerial Serial;
+HardwareSerial Serial1;
+HardwareSerial Serial2;
+EspClass ESP;
+WiFiClass WiFi;
+SPIClass SPI;
+M5UnifiedHost M5;
+M5CardputerHost M5Cardputer;
+
+// ============================================================================
+// Virtual clock
+// ============================================================================
+
+static std::atomic<uint64_t> clockUs{0};
+
+namespace HostHal {
+
+void setMillis(uint32_t ms) { clockUs.store((uint64_t)ms * 1000ULL); }
+void advanceMillis(uint32_t ms) { clockUs.fetch_add((uint64_t)ms * 1000ULL); }
+void setMicros(uint64_t us) { clockUs.store(us); }
+uint64_t getMicros() { return clockUs.load(); }
+
+}  // namespace HostHal
+
+uint32_t millis() { return (uint32_t)(clockUs.load() / 1000ULL); }
+uint32_t micros() { return (uint32_t)clockUs.load(); }
+void delay(uint32_t ms) { HostHal::advanceMillis(ms); }
+void delayMicroseconds(uint32_t us) { clockUs.fetch_add(us); }
+void yield() { std::this_thread::yield(); }
+
+// ============================================================================
+// Random
+// ============================================================================
+
+static std::mt19937& rng() {
+    static std::mt19937 gen(0x504F524Bu);  // "PORK" - fixed so replays repeat
+    return gen;
+}
+
+long random(long howbig) {
+    if (howbig <= 0) return 0;
+    return (long)(rng()() % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig) {
+    if (howsmall >= howbig) return howsmall;
+    return howsmall + random(howbig - howsmall);
+}
+
+void randomSeed(unsigned long seed) { rng().seed((uint32_t)seed); }
+uint32_t esp_random() { return rng()(); }
+
+void esp_fill_random(void* buf, size_t len) {
+    uint8_t* out = (uint8_t*)buf;
+    for (size_t i = 0; i < len; i++) out[i] = (uint8_t)rng()();
+}
+
+// ============================================================================
+// Serial / ESP
+// ============================================================================
+
+static std::atomic<bool> serialEcho{false};
+
+void HostHal::setSerialEcho(bool enabled) { serialEcho.store(enabled); }
+
+size_t HardwareSerial::write(uint8_t c) {
+    if (serialEcho.load()) fputc(c, stderr);
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buf, size_t len) {
+    if (serialEcho.load()) fwrite(buf, 1, len, stderr);
+    return len;
+}
+
+static std::atomic<uint32_t> reportedFree{200000};
+static std::atomic<uint32_t> reportedLargest{110000};
+
+void HostHal::setFreeHeap(uint32_t freeBytes, uint32_t largestBlock) {
+    reportedFree.store(freeBytes);
+    reportedLargest.store(largestBlock);
+}
+
+uint32_t EspClass::getFreeHeap() { return reportedFree.load(); }
+uint32_t EspClass::getMinFreeHeap() { return reportedFree.load(); }
+uint32_t EspClass::getMaxAllocHeap() { return reportedLargest.load(); }
+uint32_t EspClass::getCycleCount() {
+    // 240 MHz core: cycles derived from the virtual clock
+    return (uint32_t)(HostHal::getMicros() * 240ULL);
+}
+void EspClass::restart() { exit(0); }
+
+uint32_t esp_get_free_heap_size() { return reportedFree.load(); }
+uint32_t esp_get_minimum_free_heap_size() { return reportedFree.load(); }
+void esp_restart() { exit(0); }
+
+void* heap_caps_malloc(size_t size, uint32_t) { return malloc(size); }
+void* heap_caps_calloc(size_t n, size_t size, uint32_t) { return calloc(n, size); }
+void* heap_caps_realloc(void* ptr, size_t size, uint32_t) { return realloc(ptr, size); }
+void heap_caps_free(void* ptr) { free(ptr); }
+size_t heap_caps_get_free_size(uint32_t) { return reportedFree.load(); }
+size_t heap_caps_get_minimum_free_size(uint32_t) { return reportedFree.load(); }
+size_t heap_caps_get_largest_free_block(uint32_t) { return reportedLargest.load(); }
+
+void heap_caps_get_info(multi_heap_info_t* info, uint32_t) {
+    if (!info) return;
+    memset(info, 0, sizeof(*info));
+    info->total_free_bytes = reportedFree.load();
+    info->largest_free_block = reportedLargest.load();
+    info->minimum_free_bytes = reportedFree.load();
+}
+
+// ============================================================================
+// WiFi driver
+// ============================================================================
+
+static wifi_mode_t wifiMode = WIFI_MODE_NULL;
+static std::atomic<bool> promiscuous{false};
+static std::atomic<wifi_promiscuous_cb_t> rxCallback{nullptr};
+static std::atomic<uint8_t> wifiChannel{1};
+static uint8_t staMac[6] = {0x02, 0x50, 0x4F, 0x52, 0x4B, 0x01};
+static HostHal::TxStats txStats = {};
+static std::vector<uint8_t> lastTx;
+
+esp_err_t esp_wifi_init(const wifi_init_config_t*) { return ESP_OK; }
+esp_err_t esp_wifi_deinit() { promiscuous.store(false); return ESP_OK; }
+esp_err_t esp_wifi_start() { return ESP_OK; }
+esp_err_t esp_wifi_stop() { promiscuous.store(false); return ESP_OK; }
+esp_err_t esp_wifi_set_mode(wifi_mode_t mode) { wifiMode = mode; return ESP_OK; }
+
+esp_err_t esp_wifi_get_mode(wifi_mode_t* mode) {
+    if (!mode) return ESP_ERR_INVALID_ARG;
+    *mode = wifiMode;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_get_config(wifi_interface_t, wifi_config_t* conf) {
+    if (!conf) return ESP_ERR_INVALID_ARG;
+    memset(conf, 0, sizeof(*conf));
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_channel(uint8_t primary, wifi_second_chan_t) {
+    if (primary < 1 || primary > 14) return ESP_ERR_INVALID_ARG;
+    wifiChannel.store(primary);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_get_channel(uint8_t* primary, wifi_second_chan_t* second) {
+    if (primary) *primary = wifiChannel.load();
+    if (second) *second = WIFI_SECOND_CHAN_NONE;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_promiscuous(bool en) { promiscuous.store(en); return ESP_OK; }
+
+esp_err_t esp_wifi_get_promiscuous(bool* en) {
+    if (!en) return ESP_ERR_INVALID_ARG;
+    *en = promiscuous.load();
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_promiscuous_rx_cb(wifi_promiscuous_cb_t cb) {
+    rxCallback.store(cb);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_promiscuous_filter(const wifi_promiscuous_filter_t*) { return ESP_OK; }
+
+esp_err_t esp_wifi_80211_tx(wifi_interface_t, const void* buffer, int len, bool) {
+    if (!buffer || len < 24) return ESP_ERR_INVALID_ARG;
+    uint8_t fc = ((const uint8_t*)buffer)[0];
+    txStats.frames++;
+    txStats.bytes += (uint32_t)len;
+    lastTx.assign((const uint8_t*)buffer, (const uint8_t*)buffer + len);
+    if (fc == 0xC0) txStats.deauths++;
+    else if (fc == 0xA0) txStats.disassocs++;
+    else if (fc == 0x40) txStats.probeReqs++;
+    else if (fc == 0x00) txStats.assocReqs++;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_get_mac(wifi_interface_t, uint8_t mac[6]) {
+    memcpy(mac, staMac, 6);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_mac(wifi_interface_t, const uint8_t mac[6]) {
+    memcpy(staMac, mac, 6);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_max_tx_power(int8_t) { return ESP_OK; }
+
+esp_err_t esp_efuse_mac_get_default(uint8_t* mac) {
+    static const uint8_t factory[6] = {0x34, 0x85, 0x18, 0x00, 0x50, 0x4B};
+    memcpy(mac, factory, 6);
+    return ESP_OK;
+}
+
+esp_err_t esp_read_mac(uint8_t* mac, esp_mac_type_t) { return esp_efuse_mac_get_default(mac); }
+
+namespace HostHal {
+
+bool isPromiscuous() { return promiscuous.load(); }
+uint8_t getChannel() { return wifiChannel.load(); }
+
+bool deliverFrame(wifi_promiscuous_pkt_t* buf, wifi_promiscuous_pkt_type_t type) {
+    wifi_promiscuous_cb_t cb = rxCallback.load();
+    if (!promiscuous.load() || !cb) return false;
+    cb(buf, type);
+    return true;
+}
+
+TxStats getTxStats() { return txStats; }
+void resetTxStats() {
+    txStats = {};
+    lastTx.clear();
+}
+
+size_t getLastTx(uint8_t* buf, size_t maxLen) {
+    size_t n = lastTx.size() < maxLen ? lastTx.size() : maxLen;
+    if (n) memcpy(buf, lastTx.data(), n);
+    return lastTx.size();
+}
+
+}  // namespace HostHal
+
+// ============================================================================
+// FreeRTOS
+// ============================================================================
+
+struct HostTask {
+    TaskFunction_t fn;
+    void* param;
+    std::string name;
+};
+
+static void* taskTrampoline(void* arg) {
+    HostTask* task = (HostTask*)arg;
+    task->fn(task->param);
+    return nullptr;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t,
+                                   void* param, UBaseType_t, TaskHandle_t* handleOut,
+                                   BaseType_t) {
+    HostTask* task = new HostTask{fn, param, name ? name : ""};
+    pthread_t thread;
+    if (pthread_create(&thread, nullptr, taskTrampoline, task) != 0) {
+        delete task;
+        return pdFAIL;
+    }
+    pthread_detach(thread);
+    if (handleOut) *handleOut = task;
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stackDepth,
+                       void* param, UBaseType_t priority, TaskHandle_t* handleOut) {
+    return xTaskCreatePinnedToCore(fn, name, stackDepth, param, priority, handleOut, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if (task == nullptr) pthread_exit(nullptr);
+}
+
+void vTaskDelay(TickType_t ticks) {
+    // Background tasks sleep in real time so they do not race the virtual clock
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks ? ticks : 1));
+}
+
+TickType_t xTaskGetTickCount() { return millis(); }
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 4096; }
+BaseType_t xPortGetCoreID() { return 1; }
+
+// Mutexes and binary semaphores share one token-based implementation
+struct HostSemaphore {
+    std::mutex lock;
+    std::condition_variable cv;
+    bool available;
+};
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new HostSemaphore{{}, {}, true}; }
+SemaphoreHandle_t xSemaphoreCreateBinary() { return new HostSemaphore{{}, {}, false}; }
+void vSemaphoreDelete(SemaphoreHandle_t sem) { delete sem; }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    if (!sem) return pdFALSE;
+    std::unique_lock<std::mutex> guard(sem->lock);
+    auto ready = [sem]() { return sem->available; };
+    if (ticks == portMAX_DELAY) {
+        sem->cv.wait(guard, ready);
+    } else if (!sem->cv.wait_for(guard, std::chrono::milliseconds(ticks), ready)) {
+        return pdFALSE;
+    }
+    sem->available = false;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    if (!sem) return pdFALSE;
+    {
+        std::lock_guard<std::mutex> guard(sem->lock);
+        if (sem->available) return pdFALSE;
+        sem->available = true;
+    }
+    sem->cv.notify_one();
+    return pdTRUE;
+}
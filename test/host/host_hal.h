@@ -0,0 +1,86 @@
+// Host HAL - driver controls for native builds of the firmware modules
+// Drivers own time: millis() only moves via setMillis()/advanceMillis()/delay().
+#pragma once
+
+#include <Arduino.h>
+#include <esp_wifi.h>
+#include <functional>
+#include <string>
+
+namespace HostHal {
+
+// Virtual clock (also drives micros() and FreeRTOS ticks)
+void setMillis(uint32_t ms);
+void advanceMillis(uint32_t ms);
+void setMicros(uint64_t us);
+uint64_t getMicros();
+
+// Serial.print* goes to stderr when enabled (default off)
+void setSerialEcho(bool enabled);
+
+// Reported heap figures for ESP.getFreeHeap()/heap_caps_* (default: healthy)
+void setFreeHeap(uint32_t freeBytes, uint32_t largestBlock);
+
+// Mount SD / SPIFFS on a host directory (nullptr or "" = no card / unmounted)
+void mountSD(const char* dir);
+void mountSPIFFS(const char* dir);
+
+// SD card fills up after this many more bytes: writes past it come up short
+// (-1 = unlimited, the default)
+void setSdWriteBudget(int64_t bytes);
+
+// Promiscuous RX path as configured by esp_wifi_* calls
+bool isPromiscuous();
+uint8_t getChannel();
+
+/**
+ * @brief Deliver one frame the way the WiFi driver would
+ * @param buf wifi_promiscuous_pkt_t followed by payload (sig_len includes FCS)
+ * @return false if promiscuous mode is off or no callback is registered
+ */
+bool deliverFrame(wifi_promiscuous_pkt_t* buf, wifi_promiscuous_pkt_type_t type);
+
+// esp_wifi_80211_tx() accounting
+struct TxStats {
+    uint32_t frames;
+    uint32_t bytes;
+    uint32_t deauths;      // Subtype 0xC0
+    uint32_t disassocs;    // Subtype 0xA0
+    uint32_t probeReqs;    // Subtype 0x40
+    uint32_t assocReqs;    // Subtype 0x00
+};
+
+TxStats getTxStats();
+void resetTxStats();
+
+// Copies the most recent esp_wifi_80211_tx() frame; returns its full length
+size_t getLastTx(uint8_t* buf, size_t maxLen);
+
+// Station link: WiFi.begin() connects only while the link is up (default down)
+void setStationLink(bool up);
+
+// Outbound WiFiClient traffic is answered in-process. The responder gets each
+// request (everything written since the last reply) and fills in the reply.
+struct NetExchange {
+    std::string host;
+    uint16_t port;
+    std::string request;
+    std::string response;
+    bool keepOpen;         // false = peer closes after the reply (default)
+};
+
+typedef std::function<void(NetExchange&)> NetResponder;
+
+void setNetResponder(NetResponder fn);
+
+struct NetStats {
+    uint32_t connects;
+    uint32_t exchanges;
+    uint64_t bytesTx;
+    uint64_t bytesRx;
+};
+
+NetStats getNetStats();
+void resetNetStats();
+
+}  // namespace HostHal
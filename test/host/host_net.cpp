@@ -0,0 +1,410 @@
+// Host HAL - station link, WiFiClient responder and WebServer request injection
+
+#include "host_hal.h"
+#include <WiFi.h>
+#include <WebServer.h>
+#include <ESPmDNS.h>
+#include <lwip/sockets.h>
+#include <mutex>
+#include <vector>
+
+MDNSResponder MDNS;
+
+static std::mutex netLock;
+static bool stationLink = false;
+static bool stationConnected = false;
+static std::string stationSsid;
+static HostHal::NetResponder responder;
+static HostHal::NetStats netStats = {};
+static std::vector<std::weak_ptr<HostConnection>> sockets;   // fd - kFirstFd
+static constexpr int kFirstFd = 3;
+
+// ESP32 core: write() retries select() up to 10 times, 1 s each
+static constexpr uint32_t kBlockedWriteMs = 10 * 1000;
+
+namespace HostHal {
+
+void setStationLink(bool up) {
+    std::lock_guard<std::mutex> guard(netLock);
+    stationLink = up;
+    if (!up) stationConnected = false;
+}
+
+void setNetResponder(NetResponder fn) {
+    std::lock_guard<std::mutex> guard(netLock);
+    responder = fn;
+}
+
+NetStats getNetStats() {
+    std::lock_guard<std::mutex> guard(netLock);
+    return netStats;
+}
+
+void resetNetStats() {
+    std::lock_guard<std::mutex> guard(netLock);
+    netStats = {};
+}
+
+}  // namespace HostHal
+
+// ============================================================================
+// Station
+// ============================================================================
+
+wl_status_t WiFiClass::begin(const char* ssid, const char*, int32_t, const uint8_t*, bool) {
+    std::lock_guard<std::mutex> guard(netLock);
+    if (ssid) stationSsid = ssid;
+    stationConnected = stationLink;
+    return stationConnected ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+bool WiFiClass::disconnect(bool, bool) {
+    std::lock_guard<std::mutex> guard(netLock);
+    stationConnected = false;
+    return true;
+}
+
+wl_status_t WiFiClass::status() {
+    std::lock_guard<std::mutex> guard(netLock);
+    return stationConnected ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+String WiFiClass::SSID() {
+    std::lock_guard<std::mutex> guard(netLock);
+    return stationConnected ? String(stationSsid) : String();
+}
+
+// ============================================================================
+// WiFiClient
+// ============================================================================
+
+int WiFiClient::connect(const char* host, uint16_t port) {
+    std::lock_guard<std::mutex> guard(netLock);
+    if (!stationConnected || !responder || !host) return 0;
+    conn_ = std::make_shared<HostConnection>();
+    conn_->host = host;
+    conn_->port = port;
+    conn_->open = true;
+    netStats.connects++;
+    return 1;
+}
+
+size_t WiFiClient::write(const uint8_t* buf, size_t len) {
+    if (!conn_ || (!conn_->open && !conn_->serverSide)) return 0;
+    if (conn_->serverSide) {
+        if (!conn_->open) return 0;
+        if (len > conn_->txWindow) {
+            HostHal::advanceMillis(kBlockedWriteMs);
+            len = conn_->txWindow;
+        }
+        if (conn_->txWindow != SIZE_MAX) conn_->txWindow -= len;
+    }
+    conn_->tx.append((const char*)buf, len);
+    if (!conn_->serverSide) {
+        std::lock_guard<std::mutex> guard(netLock);
+        netStats.bytesTx += len;
+    }
+    return len;
+}
+
+// Hand the pending request to the responder once the reply is drained
+bool WiFiClient::fill() {
+    if (!conn_) return false;
+    if (conn_->rxPos < conn_->rx.size()) return true;
+    if (conn_->serverSide || !conn_->open || conn_->tx.empty()) return false;
+
+    HostHal::NetExchange ex;
+    ex.host = conn_->host;
+    ex.port = conn_->port;
+    ex.request.swap(conn_->tx);
+    ex.keepOpen = false;
+    HostHal::NetResponder fn;
+    {
+        std::lock_guard<std::mutex> guard(netLock);
+        fn = responder;
+        netStats.exchanges++;
+    }
+    if (fn) fn(ex);
+    {
+        std::lock_guard<std::mutex> guard(netLock);
+        netStats.bytesRx += ex.response.size();
+    }
+    conn_->rx.swap(ex.response);
+    conn_->rxPos = 0;
+    conn_->open = ex.keepOpen;
+    return conn_->rxPos < conn_->rx.size();
+}
+
+int WiFiClient::fd() const {
+    if (!conn_ || !conn_->open) return -1;
+    if (conn_->fd < 0) {
+        std::lock_guard<std::mutex> guard(netLock);
+        conn_->fd = kFirstFd + (int)sockets.size();
+        sockets.push_back(conn_);
+    }
+    return conn_->fd;
+}
+
+ssize_t lwip_send(int s, const void* data, size_t size, int flags) {
+    std::shared_ptr<HostConnection> conn;
+    {
+        std::lock_guard<std::mutex> guard(netLock);
+        if (s >= kFirstFd && s - kFirstFd < (int)sockets.size()) conn = sockets[s - kFirstFd].lock();
+    }
+    if (!conn || !conn->open) {
+        errno = ENOTCONN;
+        return -1;
+    }
+    if (!(flags & MSG_DONTWAIT) || !conn->serverSide) {
+        return (ssize_t)WiFiClient(conn).write((const uint8_t*)data, size);
+    }
+    if (size > 0 && conn->txWindow == 0) {
+        errno = EWOULDBLOCK;
+        return -1;
+    }
+    size_t n = std::min(size, conn->txWindow);
+    if (conn->txWindow != SIZE_MAX) conn->txWindow -= n;
+    conn->tx.append((const char*)data, n);
+    return (ssize_t)n;
+}
+
+int WiFiClient::available() {
+    if (!fill()) return 0;
+    return (int)(conn_->rx.size() - conn_->rxPos);
+}
+
+int WiFiClient::read() {
+    if (!fill()) return -1;
+    return (uint8_t)conn_->rx[conn_->rxPos++];
+}
+
+int WiFiClient::read(uint8_t* buf, size_t len) {
+    if (!fill()) return -1;
+    size_t n = std::min(len, conn_->rx.size() - conn_->rxPos);
+    memcpy(buf, conn_->rx.data() + conn_->rxPos, n);
+    conn_->rxPos += n;
+    return (int)n;
+}
+
+int WiFiClient::peek() {
+    if (!fill()) return -1;
+    return (uint8_t)conn_->rx[conn_->rxPos];
+}
+
+void WiFiClient::stop() {
+    if (conn_ && !conn_->serverSide) conn_->open = false;
+    conn_.reset();
+}
+
+uint8_t WiFiClient::connected() {
+    if (!conn_) return 0;
+    if (conn_->serverSide) return conn_->open ? 1 : 0;
+    return (conn_->open || available() > 0) ? 1 : 0;
+}
+
+// ============================================================================
+// WebServer
+// ============================================================================
+
+static const char* statusText(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 206: return "Partial Content";
+        case 301: return "Moved Permanently";
+        case 302: return "Found";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 403: return "Forbidden";
+        case 404: return "Not Found";
+        case 409: return "Conflict";
+        case 413: return "Payload Too Large";
+        case 416: return "Range Not Satisfiable";
+        case 500: return "Internal Server Error";
+        case 503: return "Service Unavailable";
+        default: return "";
+    }
+}
+
+static String urlDecode(const std::string& in) {
+    std::string out;
+    for (size_t i = 0; i < in.size(); i++) {
+        if (in[i] == '+') {
+            out += ' ';
+        } else if (in[i] == '%' && i + 2 < in.size()) {
+            out += (char)strtol(in.substr(i + 1, 2).c_str(), nullptr, 16);
+            i += 2;
+        } else {
+            out += in[i];
+        }
+    }
+    return String(out);
+}
+
+static void parseArgs(const std::string& query, std::vector<std::pair<String, String>>& args) {
+    size_t pos = 0;
+    while (pos < query.size()) {
+        size_t amp = query.find('&', pos);
+        std::string pair = query.substr(pos, amp == std::string::npos ? std::string::npos : amp - pos);
+        size_t eq = pair.find('=');
+        if (!pair.empty()) {
+            args.push_back({urlDecode(pair.substr(0, eq)),
+                            eq == std::string::npos ? String() : urlDecode(pair.substr(eq + 1))});
+        }
+        if (amp == std::string::npos) break;
+        pos = amp + 1;
+    }
+}
+
+String WebServer::arg(const String& name) const {
+    for (const auto& a : args_) {
+        if (a.first == name) return a.second;
+    }
+    return String();
+}
+
+bool WebServer::hasArg(const String& name) const {
+    for (const auto& a : args_) {
+        if (a.first == name) return true;
+    }
+    return false;
+}
+
+void WebServer::collectHeaders(const char* headerKeys[], size_t count) {
+    collected_.clear();
+    for (size_t i = 0; i < count; i++) collected_.push_back(String(headerKeys[i]));
+}
+
+String WebServer::header(const String& name) const {
+    for (const auto& h : headers_) {
+        if (h.first.equalsIgnoreCase(name)) return h.second;
+    }
+    return String();
+}
+
+bool WebServer::hasHeader(const String& name) const {
+    for (const auto& h : headers_) {
+        if (h.first.equalsIgnoreCase(name)) return true;
+    }
+    return false;
+}
+
+void WebServer::sendHeader(const String& name, const String& value, bool first) {
+    if (first) responseHeaders_.insert(responseHeaders_.begin(), {name, value});
+    else responseHeaders_.push_back({name, value});
+}
+
+void WebServer::writeRaw(const std::string& data) {
+    _currentClient.write((const uint8_t*)data.data(), data.size());
+}
+
+void WebServer::send(int code, const char* contentType, const String& content) {
+    std::string head = "HTTP/1.1 " + std::to_string(code) + " " + statusText(code) + "\r\n";
+    if (contentType && *contentType) head += std::string("Content-Type: ") + contentType + "\r\n";
+    chunked_ = contentLength_ == CONTENT_LENGTH_UNKNOWN;
+    if (chunked_) {
+        head += "Transfer-Encoding: chunked\r\n";
+    } else {
+        size_t len = contentLength_ == CONTENT_LENGTH_NOT_SET ? content.length() : contentLength_;
+        head += "Content-Length: " + std::to_string(len) + "\r\n";
+    }
+    for (const auto& h : responseHeaders_) head += h.first.str() + ": " + h.second.str() + "\r\n";
+    head += "\r\n";
+    responseHeaders_.clear();
+    contentLength_ = CONTENT_LENGTH_NOT_SET;
+    writeRaw(head);
+    if (content.length()) sendContent(content);
+}
+
+void WebServer::sendContent(const char* content, size_t len) {
+    if (chunked_) {
+        char size[16];
+        snprintf(size, sizeof(size), "%zx\r\n", len);
+        writeRaw(size);
+        if (len) writeRaw(std::string(content, len));
+        writeRaw("\r\n");
+        if (len == 0) chunked_ = false;
+    } else if (len) {
+        writeRaw(std::string(content, len));
+    }
+}
+
+const WebServer::Route* WebServer::findRoute() const {
+    for (const auto& r : routes_) {
+        if (r.uri == uri_ && (r.method == HTTP_ANY || r.method == method_)) return &r;
+    }
+    return nullptr;
+}
+
+void WebServer::beginRequest(HTTPMethod method, const char* target, const std::vector<HostHeader>& headers) {
+    std::string t = target ? target : "/";
+    size_t q = t.find('?');
+    uri_ = String(t.substr(0, q));
+    method_ = method;
+    args_.clear();
+    if (q != std::string::npos) parseArgs(t.substr(q + 1), args_);
+    headers_.clear();
+    for (const auto& h : headers) {
+        for (const auto& key : collected_) {
+            if (key.equalsIgnoreCase(h.name)) headers_.push_back({h.name, h.value});
+        }
+    }
+    responseHeaders_.clear();
+    contentLength_ = CONTENT_LENGTH_NOT_SET;
+    chunked_ = false;
+    auto conn = std::make_shared<HostConnection>();
+    conn->serverSide = true;
+    conn->open = true;
+    conn->txWindow = hostTxWindow_;
+    lastConn_ = conn;
+    _currentClient = WiFiClient(conn);
+}
+
+std::string WebServer::hostRequest(HTTPMethod method, const char* target, const std::string& body,
+                                   const std::vector<HostHeader>& headers) {
+    beginRequest(method, target, headers);
+    bool form = false;
+    for (const auto& h : headers) {
+        if (h.name.equalsIgnoreCase("Content-Type") && h.value.startsWith("application/x-www-form-urlencoded")) form = true;
+    }
+    if (!body.empty()) {
+        if (form) parseArgs(body, args_);
+        else args_.push_back({String("plain"), String(body)});
+    }
+    const Route* route = findRoute();
+    if (route) route->fn();
+    else if (notFound_) notFound_();
+    else send(404, "text/plain", "Not found");
+    std::string out = lastConn_->tx;
+    _currentClient = WiFiClient();
+    return out;
+}
+
+std::string WebServer::hostUpload(const char* target, const char* filename, const std::string& data, size_t chunk) {
+    beginRequest(HTTP_POST, target, {});
+    const Route* route = findRoute();
+    if (!route) return hostRequest(HTTP_POST, target);
+    if (chunk == 0 || chunk > HTTP_UPLOAD_BUFLEN) chunk = HTTP_UPLOAD_BUFLEN;
+
+    upload_ = {};
+    upload_.filename = filename;
+    upload_.name = "file";
+    upload_.type = "application/octet-stream";
+    upload_.status = UPLOAD_FILE_START;
+    if (route->uploadFn) route->uploadFn();
+    for (size_t off = 0; off < data.size(); off += chunk) {
+        size_t n = std::min(chunk, data.size() - off);
+        memcpy(upload_.buf, data.data() + off, n);
+        upload_.currentSize = n;
+        upload_.totalSize += n;
+        upload_.status = UPLOAD_FILE_WRITE;
+        if (route->uploadFn) route->uploadFn();
+    }
+    upload_.currentSize = 0;
+    upload_.status = UPLOAD_FILE_END;
+    if (route->uploadFn) route->uploadFn();
+    route->fn();
+    std::string out = lastConn_->tx;
+    _currentClient = WiFiClient();
+    return out;
+}
@@ -0,0 +1,15 @@
+// Host HAL - lwIP socket send over the WiFiClient stand-in
+// lwip_send() reaches the HostConnection behind WiFiClient::fd(). With
+// MSG_DONTWAIT a full send window fails with EWOULDBLOCK instead of
+// waiting, as on the device.
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <sys/types.h>
+
+#ifndef MSG_DONTWAIT
+#define MSG_DONTWAIT 0x08
+#endif
+
+ssize_t lwip_send(int s, const void* data, size_t size, int flags);
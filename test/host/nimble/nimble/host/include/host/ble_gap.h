@@ -0,0 +1,2 @@
+// Host HAL - NimBLE GAP internals (constants come from NimBLEDevice.h)
+#pragma once
@@ -0,0 +1,19 @@
+// Host HAL - flash-resident data is ordinary memory on the host
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr) (*(void* const*)(addr))
+#define memcpy_P memcpy
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strlen_P strlen
+#define strcmp_P strcmp
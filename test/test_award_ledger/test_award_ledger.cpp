@@ -0,0 +1,210 @@
+// Award Ledger Tests
+// Hashed XP award set: lookups, persistence, migration from the line
+// journal, growth, and rebuilds of damaged or stale tables.
+
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <host_hal.h>
+#include "../../src/core/award_ledger.h"
+#include "../../src/core/config.h"
+#include "../../src/core/sd_layout.h"
+
+static char sdRoot[64];
+static char flashRoot[64];
+
+static std::string hostPath(const char* sdPath) {
+    return std::string(sdRoot) + sdPath;
+}
+
+static const char* ledgerPath() { return SDLayout::xpLedgerWpaPath(); }
+static const char* journalPath() { return SDLayout::xpAwardedWpaPath(); }
+
+static void writeJournal(const char* text) {
+    FILE* f = fopen(hostPath(journalPath()).c_str(), "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    fputs(text, f);
+    fclose(f);
+}
+
+static std::string readJournal() {
+    std::string out;
+    FILE* f = fopen(hostPath(journalPath()).c_str(), "rb");
+    if (!f) return out;
+    int c;
+    while ((c = fgetc(f)) != EOF) out.push_back((char)c);
+    fclose(f);
+    return out;
+}
+
+static void bssidKey(uint32_t i, char* out) {
+    snprintf(out, 13, "0011%08lX", (unsigned long)i);
+}
+
+void setUp(void) {
+    std::string cmd = "rm -f " + hostPath(ledgerPath()) + " " + hostPath(journalPath());
+    (void)system(cmd.c_str());
+}
+
+void tearDown(void) {}
+
+void test_add_and_contains(void) {
+    AwardLedger ledger;
+    TEST_ASSERT_TRUE(ledger.open(ledgerPath(), journalPath()));
+    TEST_ASSERT_EQUAL_UINT32(0, ledger.count());
+    TEST_ASSERT_FALSE(ledger.contains("AABBCCDDEEFF"));
+
+    TEST_ASSERT_TRUE(ledger.add("AABBCCDDEEFF"));
+    TEST_ASSERT_TRUE(ledger.contains("AABBCCDDEEFF"));
+    TEST_ASSERT_FALSE(ledger.contains("AABBCCDDEEF0"));
+    // Already awarded: not journaled twice
+    TEST_ASSERT_FALSE(ledger.add("AABBCCDDEEFF"));
+    TEST_ASSERT_EQUAL_UINT32(1, ledger.count());
+    TEST_ASSERT_EQUAL_STRING("AABBCCDDEEFF\r\n", readJournal().c_str());
+}
+
+void test_persists_across_reopen(void) {
+    {
+        AwardLedger ledger;
+        TEST_ASSERT_TRUE(ledger.open(ledgerPath(), journalPath()));
+        TEST_ASSERT_TRUE(ledger.add("001122334455"));
+        TEST_ASSERT_TRUE(ledger.add("warhog_20250101.wigle.csv"));
+    }
+    AwardLedger ledger;
+    TEST_ASSERT_TRUE(ledger.open(ledgerPath(), journalPath()));
+    TEST_ASSERT_EQUAL_UINT32(2, ledger.count());
+    TEST_ASSERT_TRUE(ledger.contains("001122334455"));
+    TEST_ASSERT_TRUE(ledger.contains("warhog_20250101.wigle.csv"));
+}
+
+void test_migrates_line_journal(void) {
+    writeJournal("AABBCCDDEEFF\r\n"
+                 "\n"
+                 "/m5porkchop/wardriving/old_run.wigle.csv\n"
+                 "new_run.wigle.csv  \n"
+                 "AABBCCDDEEFF\n");
+    AwardLedger ledger;
+    TEST_ASSERT_TRUE(ledger.open(ledgerPath(), journalPath()));
+    TEST_ASSERT_EQUAL_UINT32(3, ledger.count());
+    TEST_ASSERT_TRUE(ledger.contains("AABBCCDDEEFF"));
+    // Full-path lines match by basename
+    TEST_ASSERT_TRUE(ledger.contains("old_run.wigle.csv"));
+    TEST_ASSERT_TRUE(ledger.contains("new_run.wigle.csv"));
+    TEST_ASSERT_FALSE(ledger.contains("other.wigle.csv"));
+    FILE* f = fopen(hostPath(ledgerPath()).c_str(), "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    fclose(f);
+}
+
+void test_grows_past_half_full(void) {
+    AwardLedger ledger;
+    TEST_ASSERT_TRUE(ledger.open(ledgerPath(), journalPath()));
+    TEST_ASSERT_EQUAL_UINT32(AwardLedger::kInitialCapacity, ledger.capacity());
+    char key[16];
+    for (uint32_t i = 0; i < 300; i++) {
+        bssidKey(i, key);
+        TEST_ASSERT_TRUE(ledger.add(key));
+    }
+    TEST_ASSERT_TRUE(ledger.isOpen());
+    TEST_ASSERT_EQUAL_UINT32(300, ledger.count());
+    TEST_ASSERT_TRUE(ledger.capacity() >= 600);
+    for (uint32_t i = 0; i < 300; i++) {
+        bssidKey(i, key);
+        TEST_ASSERT_TRUE(ledger.contains(key));
+    }
+    bssidKey(300, key);
+    TEST_ASSERT_FALSE(ledger.contains(key));
+
+    AwardLedger reopened;
+    TEST_ASSERT_TRUE(reopened.open(ledgerPath(), journalPath()));
+    TEST_ASSERT_EQUAL_UINT32(300, reopened.count());
+    bssidKey(299, key);
+    TEST_ASSERT_TRUE(reopened.contains(key));
+}
+
+void test_corrupt_table_is_rebuilt(void) {
+    {
+        AwardLedger ledger;
+        TEST_ASSERT_TRUE(ledger.open(ledgerPath(), journalPath()));
+        TEST_ASSERT_TRUE(ledger.add("AABBCCDDEEFF"));
+    }
+    FILE* f = fopen(hostPath(ledgerPath()).c_str(), "r+b");
+    TEST_ASSERT_NOT_NULL(f);
+    fwrite("JUNK", 1, 4, f);
+    fclose(f);
+
+    AwardLedger ledger;
+    TEST_ASSERT_TRUE(ledger.open(ledgerPath(), journalPath()));
+    TEST_ASSERT_EQUAL_UINT32(1, ledger.count());
+    TEST_ASSERT_TRUE(ledger.contains("AABBCCDDEEFF"));
+}
+
+void test_journal_edits_make_table_stale(void) {
+    {
+        AwardLedger ledger;
+        TEST_ASSERT_TRUE(ledger.open(ledgerPath(), journalPath()));
+        TEST_ASSERT_TRUE(ledger.add("AABBCCDDEEFF"));
+    }
+    // Line written by an older build (or a crash before the table update)
+    FILE* f = fopen(hostPath(journalPath()).c_str(), "ab");
+    TEST_ASSERT_NOT_NULL(f);
+    fputs("001122334455\n", f);
+    fclose(f);
+
+    AwardLedger ledger;
+    TEST_ASSERT_TRUE(ledger.open(ledgerPath(), journalPath()));
+    TEST_ASSERT_EQUAL_UINT32(2, ledger.count());
+    TEST_ASSERT_TRUE(ledger.contains("001122334455"));
+}
+
+void test_long_keys_are_distinct(void) {
+    AwardLedger ledger;
+    TEST_ASSERT_TRUE(ledger.open(ledgerPath(), journalPath()));
+    const char* a = "a_very_long_wardriving_session_name_0001.wigle.csv";
+    const char* b = "a_very_long_wardriving_session_name_0002.wigle.csv";
+    TEST_ASSERT_TRUE(ledger.add(a));
+    TEST_ASSERT_TRUE(ledger.contains(a));
+    TEST_ASSERT_FALSE(ledger.contains(b));
+    TEST_ASSERT_TRUE(ledger.add(b));
+    TEST_ASSERT_EQUAL_UINT32(2, ledger.count());
+}
+
+void test_closed_ledger_awards_nothing(void) {
+    AwardLedger ledger;
+    TEST_ASSERT_FALSE(ledger.isOpen());
+    TEST_ASSERT_FALSE(ledger.contains("AABBCCDDEEFF"));
+    TEST_ASSERT_FALSE(ledger.add("AABBCCDDEEFF"));
+    TEST_ASSERT_EQUAL_STRING("", readJournal().c_str());
+    TEST_ASSERT_EQUAL_UINT32(AwardLedger::hash("x"), AwardLedger::hash("x"));
+    TEST_ASSERT_TRUE(AwardLedger::hash("") != 0);
+}
+
+int main(void) {
+    strcpy(sdRoot, "/tmp/xpledger_sd_XXXXXX");
+    strcpy(flashRoot, "/tmp/xpledger_fs_XXXXXX");
+    if (!mkdtemp(sdRoot) || !mkdtemp(flashRoot)) return 1;
+    HostHal::mountSD(sdRoot);
+    HostHal::mountSPIFFS(flashRoot);
+    Config::init();
+    std::string cmd = "mkdir -p " + hostPath(SDLayout::metaDir()) + " " +
+                      hostPath(SDLayout::xpDir());
+    (void)system(cmd.c_str());
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_add_and_contains);
+    RUN_TEST(test_persists_across_reopen);
+    RUN_TEST(test_migrates_line_journal);
+    RUN_TEST(test_grows_past_half_full);
+    RUN_TEST(test_corrupt_table_is_rebuilt);
+    RUN_TEST(test_journal_edits_make_table_stale);
+    RUN_TEST(test_long_keys_are_distinct);
+    RUN_TEST(test_closed_ledger_awards_nothing);
+
+    int rc = UNITY_END();
+    cmd = std::string("rm -rf ") + sdRoot + " " + flashRoot;
+    (void)system(cmd.c_str());
+    return rc;
+}
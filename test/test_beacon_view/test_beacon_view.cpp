@@ -0,0 +1,608 @@
+// BeaconView Tests + Benchmark
+// Single-pass IE decoder shared by NetworkRecon / OINK / DONOHAM / SPECTRUM
+//
+// The benchmark reports frames/sec for the single-pass decoder against the
+// legacy four-walk parse (SSID, DS channel, RSN/WPA, PMF). By default it runs
+// on a built-in corpus shaped like real captures. Point it at your own:
+//
+//     PORKCHOP_BEACON_PCAP=~/captures/downtown.pcap pio test -e native -f test_beacon_view
+//
+// Accepts classic pcap with LINKTYPE_IEEE802_11 (105) or radiotap (127).
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <esp_wifi_types.h>
+#include "../../src/core/beacon_view.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ============================================================================
+// Frame builder (same layout as test_beacon_parsing)
+// ============================================================================
+
+struct FrameBuilder {
+    uint8_t buffer[512];
+    uint16_t len;
+
+    explicit FrameBuilder(uint8_t fc0 = 0x80) {
+        memset(buffer, 0, sizeof(buffer));
+        len = 36;
+        buffer[0] = fc0;
+        buffer[32] = 0x64;  // 100 TU
+        buffer[34] = 0x11;  // ESS + Privacy
+        static const uint8_t bssid[6] = {0xAA, 0xBB, 0xCC, 0x11, 0x22, 0x33};
+        memcpy(buffer + 10, bssid, 6);
+        memcpy(buffer + 16, bssid, 6);
+    }
+
+    void setBssidLastOctet(uint8_t v) { buffer[21] = v; buffer[15] = v; }
+
+    void addIE(uint8_t id, const uint8_t* data, uint8_t dataLen) {
+        buffer[len] = id;
+        buffer[len + 1] = dataLen;
+        if (dataLen) memcpy(buffer + len + 2, data, dataLen);
+        len += 2 + dataLen;
+    }
+
+    void addSSID(const char* ssid) { addIE(0, (const uint8_t*)ssid, (uint8_t)strlen(ssid)); }
+    void addRates() {
+        uint8_t rates[] = {0x82, 0x84, 0x8B, 0x96, 0x0C, 0x12, 0x18, 0x24};
+        addIE(1, rates, 8);
+    }
+    void addDS(uint8_t ch) { addIE(3, &ch, 1); }
+    void addTIM() {
+        uint8_t tim[] = {0x00, 0x01, 0x00, 0x00};
+        addIE(5, tim, 4);
+    }
+    void addHT() {
+        uint8_t ht[26] = {0x2C, 0x01};
+        addIE(45, ht, 26);
+    }
+    void addHTInfo(uint8_t ch) {
+        uint8_t hti[22] = {ch};
+        addIE(61, hti, 22);
+    }
+    void addRSN(uint16_t caps, uint8_t akm = 0x02) {
+        uint8_t rsn[] = {0x01, 0x00,
+                         0x00, 0x0F, 0xAC, 0x04,
+                         0x01, 0x00, 0x00, 0x0F, 0xAC, 0x04,
+                         0x01, 0x00, 0x00, 0x0F, 0xAC, akm,
+                         (uint8_t)(caps & 0xFF), (uint8_t)(caps >> 8)};
+        addIE(48, rsn, sizeof(rsn));
+    }
+    void addWPA() {
+        uint8_t wpa[] = {0x00, 0x50, 0xF2, 0x01, 0x01, 0x00,
+                         0x00, 0x50, 0xF2, 0x02, 0x01, 0x00,
+                         0x00, 0x50, 0xF2, 0x02, 0x01, 0x00,
+                         0x00, 0x50, 0xF2, 0x02};
+        addIE(221, wpa, sizeof(wpa));
+    }
+    void addWMM() {
+        uint8_t wmm[24] = {0x00, 0x50, 0xF2, 0x02, 0x01, 0x01};
+        addIE(221, wmm, 24);
+    }
+    void addWPS() {
+        uint8_t wps[] = {0x00, 0x50, 0xF2, 0x04, 0x10, 0x4A, 0x00, 0x01, 0x10};
+        addIE(221, wps, sizeof(wps));
+    }
+    void addVendor(uint8_t size) {
+        uint8_t v[64] = {0x00, 0x10, 0x18, 0x02};
+        addIE(221, v, size > 64 ? 64 : size);
+    }
+};
+
+// ============================================================================
+// Legacy reference (four separate walks, as NetworkRecon::processBeacon did)
+// ============================================================================
+
+struct LegacyResult {
+    char ssid[33];
+    bool isHidden;
+    uint8_t channel;
+    wifi_auth_mode_t authmode;
+    bool pmfRequired;
+};
+
+static void legacyParse(const uint8_t* payload, uint16_t len, LegacyResult& r) {
+    memset(&r, 0, sizeof(r));
+    r.authmode = WIFI_AUTH_OPEN;
+    if (len < 36) return;
+
+    bool capable = false, required = false;
+    uint16_t offset = 36;
+    while (offset + 2 < len) {
+        uint8_t id = payload[offset];
+        uint8_t ieLen = payload[offset + 1];
+        if (offset + 2 + ieLen > len) break;
+        if (id == 0x30 && ieLen >= 8) {
+            uint16_t rsnOffset = offset + 2;
+            uint16_t rsnEnd = rsnOffset + ieLen;
+            uint16_t version = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
+            if (version != 1) { offset += 2 + ieLen; continue; }
+            rsnOffset += 6;
+            if (rsnOffset + 2 > rsnEnd) break;
+            uint16_t pc = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
+            rsnOffset += 2 + pc * 4;
+            if (rsnOffset + 2 > rsnEnd) break;
+            uint16_t ac = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
+            rsnOffset += 2 + ac * 4;
+            if (rsnOffset + 2 > rsnEnd) break;
+            uint16_t caps = payload[rsnOffset] | (payload[rsnOffset + 1] << 8);
+            capable = (caps >> 6) & 1;
+            required = (caps >> 7) & 1;
+            break;
+        }
+        offset += 2 + ieLen;
+    }
+    r.pmfRequired = required;
+
+    offset = 36;
+    while (offset + 2 < len) {
+        uint8_t id = payload[offset];
+        uint8_t ieLen = payload[offset + 1];
+        if (offset + 2 + ieLen > len) break;
+        if (id == 0) {
+            if (ieLen > 0 && ieLen <= 32) {
+                memcpy(r.ssid, payload + offset + 2, ieLen);
+                r.ssid[ieLen] = 0;
+                bool allNull = true;
+                for (uint8_t i = 0; i < ieLen; i++) if (r.ssid[i]) { allNull = false; break; }
+                r.isHidden = allNull;
+            } else if (ieLen == 0) {
+                r.isHidden = true;
+            }
+            break;
+        }
+        offset += 2 + ieLen;
+    }
+
+    offset = 36;
+    while (offset + 2 < len) {
+        uint8_t id = payload[offset];
+        uint8_t ieLen = payload[offset + 1];
+        if (offset + 2 + ieLen > len) break;
+        if (id == 3 && ieLen == 1) { r.channel = payload[offset + 2]; break; }
+        offset += 2 + ieLen;
+    }
+
+    bool hasRSN = false;
+    offset = 36;
+    while (offset + 2 < len) {
+        uint8_t id = payload[offset];
+        uint8_t ieLen = payload[offset + 1];
+        if (offset + 2 + ieLen > len) break;
+        if (id == 0x30 && ieLen >= 2) {
+            hasRSN = true;
+            r.authmode = WIFI_AUTH_WPA2_PSK;
+        } else if (id == 0xDD && ieLen >= 8 &&
+                   payload[offset + 2] == 0x00 && payload[offset + 3] == 0x50 &&
+                   payload[offset + 4] == 0xF2 && payload[offset + 5] == 0x01) {
+            r.authmode = hasRSN ? WIFI_AUTH_WPA_WPA2_PSK : WIFI_AUTH_WPA_PSK;
+        }
+        offset += 2 + ieLen;
+    }
+    if (hasRSN && r.authmode == WIFI_AUTH_WPA2_PSK) {
+        if (required) r.authmode = WIFI_AUTH_WPA3_PSK;
+        else if (capable) r.authmode = WIFI_AUTH_WPA2_WPA3_PSK;
+    }
+}
+
+// ============================================================================
+// Corpus
+// ============================================================================
+
+struct Corpus {
+    std::vector<std::vector<uint8_t>> frames;
+    const char* source = "built-in";
+};
+
+// Frame mix modeled on a dense urban capture: consumer WPA2 routers with
+// WMM/WPS/HT, WPA2/WPA3 transition, pure SAE, legacy WPA, open hotspots,
+// hidden SSIDs, and a few vendor-IE-heavy enterprise APs.
+static void buildSyntheticCorpus(Corpus& c) {
+    static const char* names[] = {
+        "NETGEAR42", "xfinitywifi", "ATT8fK2", "Starbucks WiFi", "DIRECT-7F-HP OfficeJet",
+        "linksys", "eduroam", "TP-Link_5G_A1B2", "CoffeeShop-Guest", "MyCharterWiFi9e-2G"
+    };
+    for (int i = 0; i < 256; i++) {
+        FrameBuilder b(i % 7 == 6 ? 0x50 : 0x80);
+        b.setBssidLastOctet((uint8_t)i);
+        int kind = i % 8;
+        if (kind == 5) b.addIE(0, nullptr, 0);
+        else b.addSSID(names[i % 10]);
+        b.addRates();
+        b.addDS((uint8_t)(1 + (i % 13)));
+        b.addTIM();
+        b.addHT();
+        b.addHTInfo((uint8_t)(1 + (i % 13)));
+        switch (kind) {
+            case 0: case 1: b.addRSN(0x000C); break;           // WPA2
+            case 2: b.addRSN(0x00CC, 0x08); break;             // WPA3 (MFPR)
+            case 3: b.addRSN(0x008C | 0x0040); break;          // WPA3
+            case 4: b.addRSN(0x004C); break;                   // WPA2/WPA3 transition
+            case 5: b.addRSN(0x000C); break;                   // Hidden WPA2
+            case 6: break;                                     // Open
+            case 7: b.addRSN(0x0000); b.addWPA(); break;       // WPA2 + WPA1
+        }
+        b.addWMM();
+        if (i % 3 == 0) b.addWPS();
+        if (i % 5 == 0) { b.addVendor(40); b.addVendor(28); b.addVendor(60); }
+        c.frames.emplace_back(b.buffer, b.buffer + b.len);
+    }
+}
+
+static uint32_t rd32(const uint8_t* p, bool swap) {
+    uint32_t v = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+    if (swap) v = __builtin_bswap32(v);
+    return v;
+}
+
+// Load beacons/probe responses from a classic pcap (105 raw or 127 radiotap)
+static bool loadPcapCorpus(const char* path, Corpus& c) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    uint8_t gh[24];
+    if (fread(gh, 1, 24, f) != 24) { fclose(f); return false; }
+    uint32_t magic = gh[0] | (gh[1] << 8) | (gh[2] << 16) | ((uint32_t)gh[3] << 24);
+    bool swap = false;
+    if (magic == 0xD4C3B2A1 || magic == 0x4D3CB2A1) swap = true;
+    else if (magic != 0xA1B2C3D4 && magic != 0xA1B23C4D) { fclose(f); return false; }
+    uint32_t linktype = rd32(gh + 20, swap);
+    if (linktype != 105 && linktype != 127) { fclose(f); return false; }
+
+    std::vector<uint8_t> buf;
+    uint8_t rh[16];
+    while (fread(rh, 1, 16, f) == 16) {
+        uint32_t incl = rd32(rh + 8, swap);
+        if (incl > 65535) break;
+        buf.resize(incl);
+        if (fread(buf.data(), 1, incl, f) != incl) break;
+        size_t off = 0;
+        if (linktype == 127) {
+            if (incl < 4) continue;
+            off = buf[2] | (buf[3] << 8);
+        }
+        if (incl < off + 36) continue;
+        uint8_t fc0 = buf[off];
+        if (fc0 != 0x80 && fc0 != 0x50) continue;
+        c.frames.emplace_back(buf.begin() + off, buf.end());
+    }
+    fclose(f);
+    c.source = path;
+    return !c.frames.empty();
+}
+
+static Corpus& corpus() {
+    static Corpus c;
+    if (c.frames.empty()) {
+        const char* path = getenv("PORKCHOP_BEACON_PCAP");
+        if (!path || !loadPcapCorpus(path, c)) {
+            c.frames.clear();
+            buildSyntheticCorpus(c);
+        }
+    }
+    return c;
+}
+
+// ============================================================================
+// IE iterator
+// ============================================================================
+
+void test_iterator_walks_all_elements(void) {
+    FrameBuilder b;
+    b.addSSID("pig");
+    b.addRates();
+    b.addDS(6);
+    BeaconView::IEIterator it(b.buffer, b.len, BeaconView::kBeaconIeOffset);
+    BeaconView::IE ie;
+    uint8_t ids[4];
+    int n = 0;
+    while (it.next(ie) && n < 4) ids[n++] = ie.id;
+    TEST_ASSERT_EQUAL(3, n);
+    TEST_ASSERT_EQUAL_UINT8(0, ids[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, ids[1]);
+    TEST_ASSERT_EQUAL_UINT8(3, ids[2]);
+    TEST_ASSERT_FALSE(it.truncated());
+}
+
+void test_iterator_stops_on_overlong_element(void) {
+    FrameBuilder b;
+    b.addSSID("pig");
+    b.buffer[b.len] = 0x30;
+    b.buffer[b.len + 1] = 200;  // Claims 200 bytes, frame ends after 4
+    b.len += 4;
+    BeaconView::IEIterator it(b.buffer, b.len, BeaconView::kBeaconIeOffset);
+    BeaconView::IE ie;
+    TEST_ASSERT_TRUE(it.next(ie));
+    TEST_ASSERT_FALSE(it.next(ie));
+    TEST_ASSERT_TRUE(it.truncated());
+}
+
+void test_iterator_accepts_zero_length_final_element(void) {
+    FrameBuilder b;
+    b.addIE(0, nullptr, 0);
+    BeaconView::IEIterator it(b.buffer, b.len, BeaconView::kBeaconIeOffset);
+    BeaconView::IE ie;
+    TEST_ASSERT_TRUE(it.next(ie));
+    TEST_ASSERT_EQUAL_UINT8(0, ie.len);
+    TEST_ASSERT_FALSE(it.next(ie));
+}
+
+// ============================================================================
+// Summary decode
+// ============================================================================
+
+void test_parse_rejects_short_frame(void) {
+    uint8_t tiny[30] = {0x80};
+    BeaconView::Summary s;
+    TEST_ASSERT_FALSE(BeaconView::parse(tiny, sizeof(tiny), s));
+    TEST_ASSERT_NULL(s.bssid);
+}
+
+void test_parse_fixed_fields_and_bssid(void) {
+    FrameBuilder b;
+    b.buffer[32] = 0x20; b.buffer[33] = 0x03;  // 800 TU
+    b.addSSID("home");
+    BeaconView::Summary s;
+    TEST_ASSERT_TRUE(BeaconView::parse(b.buffer, b.len, s));
+    TEST_ASSERT_EQUAL_UINT16(800, s.beaconInterval);
+    TEST_ASSERT_EQUAL_UINT16(0x0011, s.capability);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(b.buffer + 16, s.bssid, 6);
+}
+
+void test_parse_ssid_and_channel(void) {
+    FrameBuilder b;
+    b.addSSID("PORKCHOP");
+    b.addRates();
+    b.addDS(11);
+    BeaconView::Summary s;
+    BeaconView::parse(b.buffer, b.len, s);
+    TEST_ASSERT_EQUAL_STRING("PORKCHOP", s.ssid);
+    TEST_ASSERT_TRUE(s.hasNamedSsid());
+    TEST_ASSERT_FALSE(s.isHidden);
+    TEST_ASSERT_EQUAL_UINT8(11, s.dsChannel);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_OPEN, s.authmode);
+}
+
+void test_parse_hidden_zero_length(void) {
+    FrameBuilder b;
+    b.addIE(0, nullptr, 0);
+    b.addDS(1);
+    BeaconView::Summary s;
+    BeaconView::parse(b.buffer, b.len, s);
+    TEST_ASSERT_TRUE(s.ssidPresent);
+    TEST_ASSERT_TRUE(s.isHidden);
+    TEST_ASSERT_FALSE(s.hasNamedSsid());
+}
+
+void test_parse_hidden_null_padded(void) {
+    FrameBuilder b;
+    uint8_t nulls[8] = {0};
+    b.addIE(0, nulls, 8);
+    BeaconView::Summary s;
+    BeaconView::parse(b.buffer, b.len, s);
+    TEST_ASSERT_TRUE(s.isHidden);
+    TEST_ASSERT_EQUAL_UINT8(0, s.ssid[0]);
+}
+
+void test_parse_oversized_ssid_ignored(void) {
+    FrameBuilder b;
+    uint8_t big[40];
+    memset(big, 'A', sizeof(big));
+    b.addIE(0, big, sizeof(big));
+    BeaconView::Summary s;
+    BeaconView::parse(b.buffer, b.len, s);
+    TEST_ASSERT_FALSE(s.ssidPresent);
+    TEST_ASSERT_FALSE(s.isHidden);
+    TEST_ASSERT_EQUAL_UINT8(0, s.ssid[0]);
+}
+
+void test_parse_wpa2(void) {
+    FrameBuilder b;
+    b.addSSID("x");
+    b.addRSN(0x000C);
+    BeaconView::Summary s;
+    BeaconView::parse(b.buffer, b.len, s);
+    TEST_ASSERT_TRUE(s.hasRSN);
+    TEST_ASSERT_FALSE(s.pmfCapable);
+    TEST_ASSERT_FALSE(s.pmfRequired);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA2_PSK, s.authmode);
+}
+
+void test_parse_wpa3_requires_mfpr(void) {
+    FrameBuilder b;
+    b.addRSN(0x00C0, 0x08);
+    BeaconView::Summary s;
+    BeaconView::parse(b.buffer, b.len, s);
+    TEST_ASSERT_TRUE(s.pmfRequired);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA3_PSK, s.authmode);
+}
+
+void test_parse_wpa2_wpa3_transition(void) {
+    FrameBuilder b;
+    b.addRSN(0x0040);
+    BeaconView::Summary s;
+    BeaconView::parse(b.buffer, b.len, s);
+    TEST_ASSERT_TRUE(s.pmfCapable);
+    TEST_ASSERT_FALSE(s.pmfRequired);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA2_WPA3_PSK, s.authmode);
+}
+
+void test_parse_wpa1_only(void) {
+    FrameBuilder b;
+    b.addWPA();
+    BeaconView::Summary s;
+    BeaconView::parse(b.buffer, b.len, s);
+    TEST_ASSERT_TRUE(s.hasWPA);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA_PSK, s.authmode);
+}
+
+void test_parse_wpa_wpa2_mixed(void) {
+    FrameBuilder b;
+    b.addRSN(0x0000);
+    b.addWPA();
+    BeaconView::Summary s;
+    BeaconView::parse(b.buffer, b.len, s);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA_WPA2_PSK, s.authmode);
+}
+
+void test_parse_wps_vendor_not_wpa(void) {
+    FrameBuilder b;
+    b.addWPS();
+    BeaconView::Summary s;
+    BeaconView::parse(b.buffer, b.len, s);
+    TEST_ASSERT_FALSE(s.hasWPA);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_OPEN, s.authmode);
+}
+
+void test_parse_rsn_huge_suite_count_is_bounded(void) {
+    FrameBuilder b;
+    uint8_t rsn[] = {0x01, 0x00, 0x00, 0x0F, 0xAC, 0x04,
+                     0xFF, 0xFF,  // 65535 pairwise suites - way past element end
+                     0x00, 0x0F, 0xAC, 0x04};
+    b.addIE(48, rsn, sizeof(rsn));
+    BeaconView::Summary s;
+    BeaconView::parse(b.buffer, b.len, s);
+    TEST_ASSERT_TRUE(s.hasRSN);
+    TEST_ASSERT_FALSE(s.pmfCapable);
+    TEST_ASSERT_FALSE(s.pmfRequired);
+}
+
+void test_parse_rsn_wrong_version_ignored_for_pmf(void) {
+    FrameBuilder b;
+    b.addRSN(0x00C0);
+    b.buffer[38] = 0x02;  // RSN version 2
+    BeaconView::Summary s;
+    BeaconView::parse(b.buffer, b.len, s);
+    TEST_ASSERT_FALSE(s.pmfRequired);
+    TEST_ASSERT_EQUAL(WIFI_AUTH_WPA2_PSK, s.authmode);
+}
+
+void test_parse_truncated_keeps_decoded_prefix(void) {
+    FrameBuilder b;
+    b.addSSID("edge");
+    b.addDS(6);
+    b.buffer[b.len] = 0xDD;
+    b.buffer[b.len + 1] = 250;
+    b.len += 6;
+    BeaconView::Summary s;
+    BeaconView::parse(b.buffer, b.len, s);
+    TEST_ASSERT_TRUE(s.truncated);
+    TEST_ASSERT_EQUAL_STRING("edge", s.ssid);
+    TEST_ASSERT_EQUAL_UINT8(6, s.dsChannel);
+}
+
+void test_find_ssid_assoc_request(void) {
+    // Assoc request: tagged params start at 28
+    uint8_t frame[64] = {0x00};
+    const char* name = "secretnet";
+    frame[28] = 0;
+    frame[29] = (uint8_t)strlen(name);
+    memcpy(frame + 30, name, strlen(name));
+    uint16_t len = 30 + strlen(name);
+    char ssid[33];
+    bool allNull = true;
+    TEST_ASSERT_TRUE(BeaconView::findSsid(frame, len, BeaconView::kAssocReqIeOffset, ssid, allNull));
+    TEST_ASSERT_FALSE(allNull);
+    TEST_ASSERT_EQUAL_STRING("secretnet", ssid);
+}
+
+// ============================================================================
+// Parity with the legacy four-pass parse over the whole corpus
+// ============================================================================
+
+void test_parity_with_legacy_parse(void) {
+    // Built-in corpus only: real captures can carry out-of-order vendor IEs
+    // where the single pass intentionally classifies WPA+RSN as mixed.
+    Corpus c;
+    buildSyntheticCorpus(c);
+    for (const auto& f : c.frames) {
+        LegacyResult legacy;
+        BeaconView::Summary s;
+        legacyParse(f.data(), (uint16_t)f.size(), legacy);
+        BeaconView::parse(f.data(), (uint16_t)f.size(), s);
+        TEST_ASSERT_EQUAL_STRING(legacy.ssid, s.ssid);
+        TEST_ASSERT_EQUAL(legacy.isHidden, s.isHidden);
+        TEST_ASSERT_EQUAL_UINT8(legacy.channel, s.dsChannel);
+        TEST_ASSERT_EQUAL(legacy.pmfRequired, s.pmfRequired);
+        TEST_ASSERT_EQUAL(legacy.authmode, s.authmode);
+    }
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+template <typename Fn>
+static double framesPerSec(const Corpus& c, uint32_t rounds, Fn fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t r = 0; r < rounds; r++) {
+        for (const auto& f : c.frames) fn(f.data(), (uint16_t)f.size());
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    double secs = std::chrono::duration<double>(t1 - t0).count();
+    if (secs <= 0) secs = 1e-9;
+    return (double)c.frames.size() * rounds / secs;
+}
+
+void test_benchmark_frames_per_sec(void) {
+    Corpus& c = corpus();
+    const uint32_t rounds = 2000;
+    volatile uint32_t sink = 0;
+
+    double single = framesPerSec(c, rounds, [&](const uint8_t* p, uint16_t len) {
+        BeaconView::Summary s;
+        BeaconView::parse(p, len, s);
+        sink += s.authmode + s.dsChannel;
+    });
+    double legacy = framesPerSec(c, rounds, [&](const uint8_t* p, uint16_t len) {
+        LegacyResult r;
+        legacyParse(p, len, r);
+        sink += r.authmode + r.channel;
+    });
+
+    printf("[BENCH] corpus=%s frames=%u\n", c.source, (unsigned)c.frames.size());
+    printf("[BENCH] single-pass BeaconView: %.0f frames/sec\n", single);
+    printf("[BENCH] legacy four-pass parse: %.0f frames/sec (%.2fx)\n",
+           legacy, legacy > 0 ? single / legacy : 0.0);
+    TEST_ASSERT_TRUE(single > 0);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_iterator_walks_all_elements);
+    RUN_TEST(test_iterator_stops_on_overlong_element);
+    RUN_TEST(test_iterator_accepts_zero_length_final_element);
+
+    RUN_TEST(test_parse_rejects_short_frame);
+    RUN_TEST(test_parse_fixed_fields_and_bssid);
+    RUN_TEST(test_parse_ssid_and_channel);
+    RUN_TEST(test_parse_hidden_zero_length);
+    RUN_TEST(test_parse_hidden_null_padded);
+    RUN_TEST(test_parse_oversized_ssid_ignored);
+    RUN_TEST(test_parse_wpa2);
+    RUN_TEST(test_parse_wpa3_requires_mfpr);
+    RUN_TEST(test_parse_wpa2_wpa3_transition);
+    RUN_TEST(test_parse_wpa1_only);
+    RUN_TEST(test_parse_wpa_wpa2_mixed);
+    RUN_TEST(test_parse_wps_vendor_not_wpa);
+    RUN_TEST(test_parse_rsn_huge_suite_count_is_bounded);
+    RUN_TEST(test_parse_rsn_wrong_version_ignored_for_pmf);
+    RUN_TEST(test_parse_truncated_keeps_decoded_prefix);
+    RUN_TEST(test_find_ssid_assoc_request);
+
+    RUN_TEST(test_parity_with_legacy_parse);
+    RUN_TEST(test_benchmark_frames_per_sec);
+
+    return UNITY_END();
+}
@@ -0,0 +1,275 @@
+// BSSID Index Tests
+// Open-addressed BSSID -> network table index used by NetworkRecon
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "../../src/core/bssid_index.h"
+
+// Mirrors NetworkRecon: the table owns BSSIDs, the index stores positions
+struct Entry {
+    uint8_t bssid[6];
+};
+
+static std::vector<Entry> table;
+static BssidIndex bssidIndex;
+
+static uint64_t keyAt(uint16_t idx) {
+    return bssidToKey(table[idx].bssid);
+}
+
+// Dense-area mix: a handful of vendor OUIs with near-sequential NIC bytes
+static void makeBssid(uint32_t n, uint8_t* out) {
+    static const uint8_t ouis[6][3] = {
+        {0x00, 0x1A, 0x2B}, {0xF4, 0xF2, 0x6D}, {0x3C, 0x84, 0x6A},
+        {0xB0, 0xBE, 0x76}, {0x00, 0x14, 0xBF}, {0x9C, 0x53, 0x22}
+    };
+    const uint8_t* oui = ouis[n % 6];
+    out[0] = oui[0];
+    out[1] = oui[1];
+    out[2] = oui[2];
+    out[3] = 0x10;
+    out[4] = (uint8_t)(n >> 8);
+    out[5] = (uint8_t)(n & 0xF0) | (uint8_t)(n % 4);  // Multi-BSSID style low nibble
+}
+
+static void fillTable(uint16_t count) {
+    table.clear();
+    for (uint16_t i = 0; i < count; i++) {
+        Entry e;
+        makeBssid(i * 7 + 3, e.bssid);
+        table.push_back(e);
+    }
+    bssidIndex.rebuild((uint16_t)table.size(), keyAt);
+}
+
+static int linearFind(const uint8_t* bssid) {
+    for (size_t i = 0; i < table.size(); i++) {
+        if (memcmp(table[i].bssid, bssid, 6) == 0) return (int)i;
+    }
+    return -1;
+}
+
+void setUp(void) {
+    table.clear();
+    bssidIndex.clear();
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// bssidToKey
+// ============================================================================
+
+void test_bssidToKey_packs_big_endian(void) {
+    uint8_t bssid[6] = {0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF};
+    TEST_ASSERT_EQUAL_UINT64(0xAABBCCDDEEFFULL, bssidToKey(bssid));
+}
+
+// ============================================================================
+// Basic operations
+// ============================================================================
+
+void test_find_empty_index_misses(void) {
+    uint8_t bssid[6] = {1, 2, 3, 4, 5, 6};
+    TEST_ASSERT_EQUAL(-1, bssidIndex.find(bssidToKey(bssid), keyAt));
+}
+
+void test_every_entry_found_at_its_position(void) {
+    fillTable(200);
+    TEST_ASSERT_EQUAL_UINT16(200, bssidIndex.size());
+    for (uint16_t i = 0; i < table.size(); i++) {
+        TEST_ASSERT_EQUAL(i, bssidIndex.find(bssidToKey(table[i].bssid), keyAt));
+    }
+}
+
+void test_unknown_bssid_misses(void) {
+    fillTable(150);
+    uint8_t bssid[6] = {0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x01};
+    TEST_ASSERT_EQUAL(-1, bssidIndex.find(bssidToKey(bssid), keyAt));
+}
+
+void test_append_then_find(void) {
+    fillTable(10);
+    Entry e;
+    makeBssid(9999, e.bssid);
+    table.push_back(e);
+    uint16_t idx = (uint16_t)(table.size() - 1);
+    TEST_ASSERT_TRUE(bssidIndex.insert(keyAt(idx), idx));
+    TEST_ASSERT_EQUAL(idx, bssidIndex.find(bssidToKey(e.bssid), keyAt));
+}
+
+void test_insert_rejected_past_capacity(void) {
+    fillTable(BssidIndex::kMaxEntries);
+    Entry e;
+    makeBssid(123456, e.bssid);
+    table.push_back(e);
+    TEST_ASSERT_FALSE(bssidIndex.insert(bssidToKey(e.bssid), (uint16_t)(table.size() - 1)));
+    TEST_ASSERT_EQUAL_UINT16(BssidIndex::kMaxEntries, bssidIndex.size());
+}
+
+// ============================================================================
+// Erase / replace (eviction path)
+// ============================================================================
+
+void test_erase_keeps_probe_chains_intact(void) {
+    fillTable(200);
+    // Remove every third entry from the index only (positions unchanged)
+    for (uint16_t i = 0; i < table.size(); i += 3) {
+        TEST_ASSERT_TRUE(bssidIndex.erase(bssidToKey(table[i].bssid), keyAt));
+    }
+    for (uint16_t i = 0; i < table.size(); i++) {
+        int expected = (i % 3 == 0) ? -1 : (int)i;
+        TEST_ASSERT_EQUAL(expected, bssidIndex.find(bssidToKey(table[i].bssid), keyAt));
+    }
+}
+
+void test_erase_missing_key_is_noop(void) {
+    fillTable(20);
+    uint8_t bssid[6] = {9, 9, 9, 9, 9, 9};
+    TEST_ASSERT_FALSE(bssidIndex.erase(bssidToKey(bssid), keyAt));
+    TEST_ASSERT_EQUAL_UINT16(20, bssidIndex.size());
+}
+
+void test_replace_in_place_like_eviction(void) {
+    fillTable(200);
+    uint16_t victim = 77;
+    uint8_t oldBssid[6];
+    memcpy(oldBssid, table[victim].bssid, 6);
+
+    bssidIndex.erase(keyAt(victim), keyAt);
+    makeBssid(54321, table[victim].bssid);
+    bssidIndex.insert(keyAt(victim), victim);
+
+    TEST_ASSERT_EQUAL(-1, bssidIndex.find(bssidToKey(oldBssid), keyAt));
+    TEST_ASSERT_EQUAL(victim, bssidIndex.find(bssidToKey(table[victim].bssid), keyAt));
+    TEST_ASSERT_EQUAL_UINT16(200, bssidIndex.size());
+}
+
+// ============================================================================
+// Rebuild after cleanupStaleNetworks()-style compaction
+// ============================================================================
+
+void test_rebuild_after_stale_erase(void) {
+    fillTable(200);
+    std::vector<Entry> removed;
+    // Erase in reverse order like cleanupStaleNetworks()
+    for (int i = 199; i >= 0; i -= 4) {
+        removed.push_back(table[i]);
+        table.erase(table.begin() + i);
+    }
+    bssidIndex.rebuild((uint16_t)table.size(), keyAt);
+
+    TEST_ASSERT_EQUAL_UINT16(table.size(), bssidIndex.size());
+    for (uint16_t i = 0; i < table.size(); i++) {
+        TEST_ASSERT_EQUAL(i, bssidIndex.find(bssidToKey(table[i].bssid), keyAt));
+    }
+    for (const auto& e : removed) {
+        TEST_ASSERT_EQUAL(-1, bssidIndex.find(bssidToKey(e.bssid), keyAt));
+    }
+}
+
+void test_matches_linear_scan(void) {
+    fillTable(180);
+    for (uint32_t n = 0; n < 3000; n++) {
+        uint8_t bssid[6];
+        makeBssid(n, bssid);
+        TEST_ASSERT_EQUAL(linearFind(bssid), bssidIndex.find(bssidToKey(bssid), keyAt));
+    }
+}
+
+// ============================================================================
+// Lookup cost stays flat as the table grows
+// ============================================================================
+
+static double avgHitProbes() {
+    uint32_t total = 0;
+    for (uint16_t i = 0; i < table.size(); i++) {
+        uint16_t probes = 0;
+        bssidIndex.find(bssidToKey(table[i].bssid), keyAt, &probes);
+        total += probes;
+    }
+    return table.empty() ? 0.0 : (double)total / table.size();
+}
+
+static double avgMissProbes() {
+    uint32_t total = 0;
+    const uint32_t samples = 1000;
+    for (uint32_t n = 0; n < samples; n++) {
+        uint8_t bssid[6] = {0x02, 0x00, 0x5E, (uint8_t)(n >> 16), (uint8_t)(n >> 8), (uint8_t)n};
+        uint16_t probes = 0;
+        bssidIndex.find(bssidToKey(bssid), keyAt, &probes);
+        total += probes;
+    }
+    return (double)total / samples;
+}
+
+void test_probe_count_flat_as_table_grows(void) {
+    const uint16_t sizes[] = {25, 50, 100, 150, 200};
+    double hit25 = 0;
+    for (uint16_t n : sizes) {
+        fillTable(n);
+        double hit = avgHitProbes();
+        double miss = avgMissProbes();
+        if (n == 25) hit25 = hit;
+        printf("[BENCH] n=%3u avg probes: hit=%.2f miss=%.2f (linear avg hit=%.1f)\n",
+               n, hit, miss, (n + 1) / 2.0);
+        // Half-full table with linear probing: expected ~1.3 hit / ~1.8 miss
+        TEST_ASSERT_TRUE(hit < 2.0);
+        TEST_ASSERT_TRUE(miss < 3.0);
+    }
+    TEST_ASSERT_TRUE(avgHitProbes() < hit25 + 1.0);
+}
+
+void test_benchmark_lookup_vs_linear(void) {
+    const uint16_t sizes[] = {25, 100, 200};
+    volatile int sink = 0;
+    for (uint16_t n : sizes) {
+        fillTable(n);
+        const uint32_t rounds = 2000;
+        auto t0 = std::chrono::steady_clock::now();
+        for (uint32_t r = 0; r < rounds; r++) {
+            for (uint16_t i = 0; i < n; i++) sink += bssidIndex.find(bssidToKey(table[i].bssid), keyAt);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        for (uint32_t r = 0; r < rounds; r++) {
+            for (uint16_t i = 0; i < n; i++) sink += linearFind(table[i].bssid);
+        }
+        auto t2 = std::chrono::steady_clock::now();
+        double lookups = (double)rounds * n;
+        double hashNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / lookups;
+        double linNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / lookups;
+        printf("[BENCH] n=%3u index=%.1f ns/lookup linear=%.1f ns/lookup\n", n, hashNs, linNs);
+    }
+    TEST_ASSERT_TRUE(true);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_bssidToKey_packs_big_endian);
+
+    RUN_TEST(test_find_empty_index_misses);
+    RUN_TEST(test_every_entry_found_at_its_position);
+    RUN_TEST(test_unknown_bssid_misses);
+    RUN_TEST(test_append_then_find);
+    RUN_TEST(test_insert_rejected_past_capacity);
+
+    RUN_TEST(test_erase_keeps_probe_chains_intact);
+    RUN_TEST(test_erase_missing_key_is_noop);
+    RUN_TEST(test_replace_in_place_like_eviction);
+
+    RUN_TEST(test_rebuild_after_stale_erase);
+    RUN_TEST(test_matches_linear_scan);
+
+    RUN_TEST(test_probe_count_flat_as_table_grows);
+    RUN_TEST(test_benchmark_lookup_vs_linear);
+
+    return UNITY_END();
+}
@@ -0,0 +1,299 @@
+// Capture Index Tests
+// Name parsing, rebuild from the handshakes directory, save-path upserts,
+// cursor paging, in-place flag updates and staleness detection.
+
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <host_hal.h>
+#include "../../src/core/capture_index.h"
+#include "../../src/core/config.h"
+#include "../../src/core/sd_layout.h"
+
+static char sdRoot[64];
+static char flashRoot[64];
+
+static std::string hostPath(const char* sdPath) {
+    return std::string(sdRoot) + sdPath;
+}
+
+static void writeCapture(const char* name, size_t bytes) {
+    std::string path = hostPath(SDLayout::handshakesDir()) + "/" + name;
+    FILE* f = fopen(path.c_str(), "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    for (size_t i = 0; i < bytes; i++) fputc('x', f);
+    fclose(f);
+}
+
+struct Collected {
+    std::vector<std::string> names;
+    std::vector<uint32_t> slots;
+    size_t limit;
+};
+
+static bool collect(const CaptureIndex::Record& rec, uint32_t slot, void* ctx) {
+    Collected& c = *static_cast<Collected*>(ctx);
+    c.names.push_back(rec.name);
+    c.slots.push_back(slot);
+    return c.names.size() < c.limit;
+}
+
+static bool findRecord(const char* name, CaptureIndex::Record& out) {
+    struct Find { const char* name; CaptureIndex::Record* out; bool found; } find = {name, &out, false};
+    CaptureIndex::forEach([](const CaptureIndex::Record& rec, uint32_t, void* ctx) {
+        Find& f = *static_cast<Find*>(ctx);
+        if (strcmp(rec.name, f.name) != 0) return true;
+        *f.out = rec;
+        f.found = true;
+        return false;
+    }, &find);
+    return find.found;
+}
+
+void setUp(void) {
+    std::string cmd = "rm -rf " + hostPath(SDLayout::handshakesDir()) + " " +
+                      hostPath(SDLayout::captureIndexPath());
+    (void)system(cmd.c_str());
+    cmd = "mkdir -p " + hostPath(SDLayout::handshakesDir());
+    (void)system(cmd.c_str());
+}
+
+void tearDown(void) {
+    CaptureIndex::rebuildCancel();
+}
+
+// ============================================================================
+// Name parsing
+// ============================================================================
+
+void test_parse_ssid_bssid_names(void) {
+    CaptureIndex::Record rec;
+    TEST_ASSERT_TRUE(CaptureIndex::parseName("HomeNet_AABBCCDDEEFF_hs.22000", rec));
+    TEST_ASSERT_EQUAL_UINT8(CaptureIndex::TYPE_HS22000, rec.type);
+    TEST_ASSERT_EQUAL_STRING("HomeNet", rec.ssid);
+    const uint8_t bssid[6] = {0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF};
+    TEST_ASSERT_EQUAL_MEMORY(bssid, rec.bssid, 6);
+    TEST_ASSERT_EQUAL_UINT8(0, rec.flags);
+
+    TEST_ASSERT_TRUE(CaptureIndex::parseName("My_Wifi_001122334455.22000", rec));
+    TEST_ASSERT_EQUAL_UINT8(CaptureIndex::TYPE_PMKID, rec.type);
+    TEST_ASSERT_EQUAL_STRING("My_Wifi", rec.ssid);
+
+    TEST_ASSERT_TRUE(CaptureIndex::parseName("Cafe_001122334455.pcap", rec));
+    TEST_ASSERT_EQUAL_UINT8(CaptureIndex::TYPE_PCAP, rec.type);
+    TEST_ASSERT_EQUAL_STRING("Cafe_001122334455.pcap", rec.name);
+}
+
+void test_parse_legacy_and_unknown_names(void) {
+    CaptureIndex::Record rec;
+    TEST_ASSERT_TRUE(CaptureIndex::parseName("AABBCCDDEEFF.pcap", rec));
+    TEST_ASSERT_EQUAL_STRING("", rec.ssid);
+    TEST_ASSERT_EQUAL_UINT8(0xAA, rec.bssid[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, rec.flags);
+
+    TEST_ASSERT_TRUE(CaptureIndex::parseName("import.pcap", rec));
+    TEST_ASSERT_EQUAL_UINT8(CaptureIndex::FLAG_NO_BSSID, rec.flags);
+
+    TEST_ASSERT_FALSE(CaptureIndex::parseName("AABBCCDDEEFF.txt", rec));
+    TEST_ASSERT_FALSE(CaptureIndex::parseName("uploaded.txt", rec));
+    // Longer than a record can hold
+    TEST_ASSERT_FALSE(CaptureIndex::parseName(
+        "An_Extremely_Long_Network_Name_That_Overflows_AABBCCDDEEFF.pcap", rec));
+}
+
+// ============================================================================
+// Rebuild and staleness
+// ============================================================================
+
+void test_rebuild_indexes_captures_only(void) {
+    TEST_ASSERT_TRUE(CaptureIndex::isStale());
+    TEST_ASSERT_EQUAL_UINT32(0, CaptureIndex::count());
+
+    writeCapture("Alpha_AABBCCDDEEFF.pcap", 120);
+    writeCapture("Alpha_AABBCCDDEEFF_hs.22000", 40);
+    writeCapture("Beta_001122334455.22000", 30);
+    writeCapture("001122334466.txt", 5);
+    TEST_ASSERT_TRUE(CaptureIndex::rebuild());
+    TEST_ASSERT_FALSE(CaptureIndex::isStale());
+    TEST_ASSERT_EQUAL_UINT32(3, CaptureIndex::count());
+
+    CaptureIndex::Record rec;
+    TEST_ASSERT_TRUE(findRecord("Alpha_AABBCCDDEEFF.pcap", rec));
+    TEST_ASSERT_EQUAL_UINT32(120, rec.size);
+    TEST_ASSERT_FALSE(findRecord("001122334466.txt", rec));
+}
+
+void test_rebuild_reads_legacy_companion_ssid(void) {
+    writeCapture("AABBCCDDEEFF.pcap", 10);
+    std::string txt = hostPath(SDLayout::handshakesDir()) + "/AABBCCDDEEFF.txt";
+    FILE* f = fopen(txt.c_str(), "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    fputs("Old Network  \r\n", f);
+    fclose(f);
+
+    TEST_ASSERT_TRUE(CaptureIndex::rebuild());
+    CaptureIndex::Record rec;
+    TEST_ASSERT_TRUE(findRecord("AABBCCDDEEFF.pcap", rec));
+    TEST_ASSERT_EQUAL_STRING("Old Network", rec.ssid);
+}
+
+void test_torn_tail_marks_stale(void) {
+    writeCapture("Alpha_AABBCCDDEEFF.pcap", 10);
+    TEST_ASSERT_TRUE(CaptureIndex::rebuild());
+    FILE* f = fopen(hostPath(SDLayout::captureIndexPath()).c_str(), "ab");
+    TEST_ASSERT_NOT_NULL(f);
+    fputs("half a record", f);
+    fclose(f);
+    TEST_ASSERT_TRUE(CaptureIndex::isStale());
+    TEST_ASSERT_EQUAL_UINT32(0, CaptureIndex::count());
+}
+
+void test_invalidate_discards_inflight_rebuild(void) {
+    for (int i = 0; i < 6; i++) {
+        char name[40];
+        snprintf(name, sizeof(name), "Net%d_AABBCCDDEE%02X.pcap", i, i);
+        writeCapture(name, 10);
+    }
+    TEST_ASSERT_TRUE(CaptureIndex::rebuildBegin());
+    TEST_ASSERT_FALSE(CaptureIndex::rebuildStep(2));
+    CaptureIndex::invalidate();
+    while (!CaptureIndex::rebuildStep(2)) {}
+    TEST_ASSERT_FALSE(CaptureIndex::rebuildActive());
+    TEST_ASSERT_TRUE(CaptureIndex::isStale());
+
+    // A fresh incremental rebuild completes
+    TEST_ASSERT_TRUE(CaptureIndex::rebuildBegin());
+    while (!CaptureIndex::rebuildStep(4)) {}
+    TEST_ASSERT_EQUAL_UINT32(6, CaptureIndex::count());
+}
+
+// ============================================================================
+// Save path, paging, updates
+// ============================================================================
+
+void test_note_saved_appends_then_refreshes(void) {
+    std::string path = std::string(SDLayout::handshakesDir()) + "/Gamma_112233445566_hs.22000";
+    const uint8_t bssid[6] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66};
+
+    // Stale index: nothing to update, the next rebuild picks the file up
+    writeCapture("Gamma_112233445566_hs.22000", 20);
+    TEST_ASSERT_FALSE(CaptureIndex::noteSaved(path.c_str(), "Gamma Net", bssid));
+
+    writeCapture("Alpha_AABBCCDDEEFF.pcap", 10);
+    TEST_ASSERT_TRUE(CaptureIndex::rebuild());
+    TEST_ASSERT_EQUAL_UINT32(2, CaptureIndex::count());
+
+    // Existing record: refreshed in place, WPA-SEC flags kept
+    CaptureIndex::update([](CaptureIndex::Record& rec, void*) {
+        rec.flags |= CaptureIndex::FLAG_UPLOADED;
+        return true;
+    }, nullptr);
+    writeCapture("Gamma_112233445566_hs.22000", 64);
+    TEST_ASSERT_TRUE(CaptureIndex::noteSaved(path.c_str(), "Gamma Net", bssid));
+    TEST_ASSERT_EQUAL_UINT32(2, CaptureIndex::count());
+    CaptureIndex::Record rec;
+    TEST_ASSERT_TRUE(findRecord("Gamma_112233445566_hs.22000", rec));
+    TEST_ASSERT_EQUAL_STRING("Gamma Net", rec.ssid);
+    TEST_ASSERT_EQUAL_UINT32(64, rec.size);
+    TEST_ASSERT_TRUE(rec.flags & CaptureIndex::FLAG_UPLOADED);
+
+    // New record: appended
+    std::string pmkid = std::string(SDLayout::handshakesDir()) + "/Gamma_112233445566.22000";
+    writeCapture("Gamma_112233445566.22000", 8);
+    TEST_ASSERT_TRUE(CaptureIndex::noteSaved(pmkid.c_str(), "Gamma Net", bssid));
+    TEST_ASSERT_EQUAL_UINT32(3, CaptureIndex::count());
+    TEST_ASSERT_TRUE(findRecord("Gamma_112233445566.22000", rec));
+    TEST_ASSERT_FALSE(rec.flags & CaptureIndex::FLAG_UPLOADED);
+}
+
+void test_for_each_pages_with_cursor(void) {
+    for (int i = 0; i < 20; i++) {
+        char name[40];
+        snprintf(name, sizeof(name), "Net%02d_AABBCCDDEE%02X.pcap", i, i);
+        writeCapture(name, 10);
+    }
+    TEST_ASSERT_TRUE(CaptureIndex::rebuild());
+
+    std::vector<std::string> all;
+    uint32_t cursor = 0;
+    int pages = 0;
+    while (cursor < CaptureIndex::count()) {
+        Collected page;
+        page.limit = 7;
+        uint32_t next = CaptureIndex::forEach(collect, &page, cursor);
+        TEST_ASSERT_EQUAL_UINT32(cursor, page.slots.front());
+        TEST_ASSERT_EQUAL_UINT32(cursor + page.names.size(), next);
+        all.insert(all.end(), page.names.begin(), page.names.end());
+        cursor = next;
+        pages++;
+    }
+    TEST_ASSERT_EQUAL_INT(3, pages);
+    TEST_ASSERT_EQUAL_UINT32(20, all.size());
+    for (size_t i = 1; i < all.size(); i++) {
+        for (size_t j = 0; j < i; j++) TEST_ASSERT_TRUE(all[i] != all[j]);
+    }
+
+    // Past the end
+    Collected none;
+    none.limit = 5;
+    TEST_ASSERT_EQUAL_UINT32(20, CaptureIndex::forEach(collect, &none, 99));
+    TEST_ASSERT_EQUAL_UINT32(0, none.names.size());
+}
+
+void test_update_rewrites_changed_records(void) {
+    for (int i = 0; i < 10; i++) {
+        char name[40];
+        snprintf(name, sizeof(name), "Net%02d_AABBCCDDEE%02X.pcap", i, i);
+        writeCapture(name, 10);
+    }
+    TEST_ASSERT_TRUE(CaptureIndex::rebuild());
+
+    // Crack every even network; only those records change
+    size_t changed = CaptureIndex::update([](CaptureIndex::Record& rec, void*) {
+        if ((rec.bssid[5] & 1) != 0) return false;
+        rec.flags |= CaptureIndex::FLAG_CRACKED;
+        return true;
+    }, nullptr);
+    TEST_ASSERT_EQUAL_UINT32(5, changed);
+    TEST_ASSERT_FALSE(CaptureIndex::isStale());
+
+    CaptureIndex::Record rec;
+    TEST_ASSERT_TRUE(findRecord("Net04_AABBCCDDEE04.pcap", rec));
+    TEST_ASSERT_TRUE(rec.flags & CaptureIndex::FLAG_CRACKED);
+    TEST_ASSERT_TRUE(findRecord("Net09_AABBCCDDEE09.pcap", rec));
+    TEST_ASSERT_FALSE(rec.flags & CaptureIndex::FLAG_CRACKED);
+    TEST_ASSERT_EQUAL_STRING("Net09", rec.ssid);
+}
+
+int main(void) {
+    strcpy(sdRoot, "/tmp/capidx_sd_XXXXXX");
+    strcpy(flashRoot, "/tmp/capidx_fs_XXXXXX");
+    if (!mkdtemp(sdRoot) || !mkdtemp(flashRoot)) return 1;
+    HostHal::mountSD(sdRoot);
+    HostHal::mountSPIFFS(flashRoot);
+    Config::init();
+    std::string cmd = "mkdir -p " + hostPath(SDLayout::metaDir());
+    (void)system(cmd.c_str());
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_parse_ssid_bssid_names);
+    RUN_TEST(test_parse_legacy_and_unknown_names);
+
+    RUN_TEST(test_rebuild_indexes_captures_only);
+    RUN_TEST(test_rebuild_reads_legacy_companion_ssid);
+    RUN_TEST(test_torn_tail_marks_stale);
+    RUN_TEST(test_invalidate_discards_inflight_rebuild);
+
+    RUN_TEST(test_note_saved_appends_then_refreshes);
+    RUN_TEST(test_for_each_pages_with_cursor);
+    RUN_TEST(test_update_rewrites_changed_records);
+
+    int rc = UNITY_END();
+    cmd = std::string("rm -rf ") + sdRoot + " " + flashRoot;
+    (void)system(cmd.c_str());
+    return rc;
+}
@@ -0,0 +1,287 @@
+// Cracked Index Tests
+// Potfile parsing, sorted index builds past one sort run, lookups,
+// duplicate BSSIDs, staleness when the potfile changes and delta merges.
+
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <host_hal.h>
+#include "../../src/web/cracked_index.h"
+#include "../../src/core/config.h"
+#include "../../src/core/sd_layout.h"
+
+static char sdRoot[64];
+static char flashRoot[64];
+
+static std::string hostPath(const char* sdPath) {
+    return std::string(sdRoot) + sdPath;
+}
+
+static bool hostExists(const std::string& sdPath) {
+    FILE* f = fopen(hostPath(sdPath.c_str()).c_str(), "rb");
+    if (f) fclose(f);
+    return f != nullptr;
+}
+
+static void writePotfile(const std::string& text) {
+    FILE* f = fopen(hostPath(SDLayout::wpasecResultsPath()).c_str(), "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    fwrite(text.data(), 1, text.size(), f);
+    fclose(f);
+}
+
+static void apBssid(uint32_t i, uint8_t out[6]) {
+    out[0] = 0x02;
+    out[1] = 0x00;
+    out[2] = (uint8_t)(i >> 24);
+    out[3] = (uint8_t)(i >> 16);
+    out[4] = (uint8_t)(i >> 8);
+    out[5] = (uint8_t)i;
+}
+
+static std::string potLine(const uint8_t ap[6], const char* ssid, const char* password) {
+    char line[200];
+    snprintf(line, sizeof(line), "%02x%02x%02x%02x%02x%02x:a4b1c2d3e4f5:%s:%s\n",
+             ap[0], ap[1], ap[2], ap[3], ap[4], ap[5], ssid, password);
+    return line;
+}
+
+// Lines in scrambled BSSID order so the build really has to sort
+static std::string bigPotfile(uint32_t n) {
+    std::string text;
+    for (uint32_t k = 0; k < n; k++) {
+        uint32_t i = (k * 7919u) % n;
+        uint8_t ap[6];
+        apBssid(i, ap);
+        char ssid[16], pw[16];
+        snprintf(ssid, sizeof(ssid), "NET-%lu", (unsigned long)i);
+        snprintf(pw, sizeof(pw), "pw%lu", (unsigned long)i);
+        text += potLine(ap, ssid, pw);
+    }
+    return text;
+}
+
+void setUp(void) {
+    CrackedIndex::close();
+    std::string cmd = "rm -f " + hostPath(SDLayout::wpasecResultsPath()) + " " +
+                      hostPath(SDLayout::crackedIndexPath());
+    (void)system(cmd.c_str());
+}
+
+void tearDown(void) {}
+
+void test_parse_line(void) {
+    const char* line = "aabbccddeeff:112233445566:Home:Net:pass:word";
+    uint8_t bssid[6];
+    size_t ssidAt, ssidLen, pwLen;
+    TEST_ASSERT_TRUE(CrackedIndex::parseLine(line, strlen(line), bssid, ssidAt, ssidLen, pwLen));
+    const uint8_t expect[6] = {0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF};
+    TEST_ASSERT_EQUAL_MEMORY(expect, bssid, 6);
+    // SSID ends at the third colon; the password keeps the rest
+    TEST_ASSERT_EQUAL_UINT32(4, ssidLen);
+    TEST_ASSERT_EQUAL_MEMORY("Home", line + ssidAt, 4);
+    TEST_ASSERT_EQUAL_STRING("Net:pass:word", line + ssidAt + ssidLen + 1);
+    TEST_ASSERT_EQUAL_UINT32(13, pwLen);
+
+    const char* bad[] = {
+        "", "aabbccddeeff:112233445566:NoPassword", "aabbccddeeff112233445566:a:b",
+        "aabbccddeexx:112233445566:s:p", "aabbccddeeff:1122334455:s:p"
+    };
+    for (const char* b : bad) {
+        TEST_ASSERT_FALSE(CrackedIndex::parseLine(b, strlen(b), bssid, ssidAt, ssidLen, pwLen));
+    }
+}
+
+void test_no_potfile(void) {
+    TEST_ASSERT_FALSE(CrackedIndex::open());
+    TEST_ASSERT_EQUAL_UINT32(0, CrackedIndex::count());
+    uint8_t ap[6];
+    apBssid(1, ap);
+    TEST_ASSERT_NULL(CrackedIndex::find(ap));
+}
+
+void test_small_potfile_lookups(void) {
+    uint8_t a[6], b[6], c[6];
+    apBssid(10, a);
+    apBssid(20, b);
+    apBssid(30, c);
+    writePotfile(potLine(b, "Bravo", "secret:with:colons") + "junk line\n\r\n" +
+                 potLine(a, "Alpha", "hunter2"));
+    TEST_ASSERT_TRUE(CrackedIndex::open());
+    TEST_ASSERT_EQUAL_UINT32(2, CrackedIndex::count());
+
+    const CrackedIndex::Entry* e = CrackedIndex::find(a);
+    TEST_ASSERT_NOT_NULL(e);
+    TEST_ASSERT_EQUAL_STRING("Alpha", e->ssid);
+    TEST_ASSERT_EQUAL_STRING("hunter2", e->password);
+    e = CrackedIndex::find(b);
+    TEST_ASSERT_NOT_NULL(e);
+    TEST_ASSERT_EQUAL_STRING("Bravo", e->ssid);
+    TEST_ASSERT_EQUAL_STRING("secret:with:colons", e->password);
+    TEST_ASSERT_NULL(CrackedIndex::find(c));
+}
+
+void test_many_results_past_old_cap(void) {
+    const uint32_t n = 3000;   // Several sort runs, fence stride > one page
+    writePotfile(bigPotfile(n));
+    TEST_ASSERT_TRUE(CrackedIndex::open());
+    TEST_ASSERT_EQUAL_UINT32(n, CrackedIndex::count());
+
+    uint8_t ap[6];
+    char expect[16];
+    for (uint32_t i = 0; i < n; i += 37) {
+        apBssid(i, ap);
+        const CrackedIndex::Entry* e = CrackedIndex::find(ap);
+        TEST_ASSERT_NOT_NULL(e);
+        snprintf(expect, sizeof(expect), "NET-%lu", (unsigned long)i);
+        TEST_ASSERT_EQUAL_STRING(expect, e->ssid);
+        snprintf(expect, sizeof(expect), "pw%lu", (unsigned long)i);
+        TEST_ASSERT_EQUAL_STRING(expect, e->password);
+    }
+    apBssid(0, ap);
+    TEST_ASSERT_NOT_NULL(CrackedIndex::find(ap));
+    apBssid(n - 1, ap);
+    TEST_ASSERT_NOT_NULL(CrackedIndex::find(ap));
+    apBssid(n, ap);
+    TEST_ASSERT_NULL(CrackedIndex::find(ap));
+    const uint8_t below[6] = {0x00, 0, 0, 0, 0, 0};
+    TEST_ASSERT_NULL(CrackedIndex::find(below));
+    // Scratch files are cleaned up
+    TEST_ASSERT_FALSE(hostExists(std::string(SDLayout::crackedIndexPath()) + ".a"));
+    TEST_ASSERT_FALSE(hostExists(std::string(SDLayout::crackedIndexPath()) + ".b"));
+}
+
+void test_duplicate_bssid_keeps_first_line(void) {
+    uint8_t a[6];
+    apBssid(5, a);
+    writePotfile(potLine(a, "First", "one") + potLine(a, "Second", "two"));
+    TEST_ASSERT_TRUE(CrackedIndex::open());
+    TEST_ASSERT_EQUAL_UINT32(1, CrackedIndex::count());
+    const CrackedIndex::Entry* e = CrackedIndex::find(a);
+    TEST_ASSERT_NOT_NULL(e);
+    TEST_ASSERT_EQUAL_STRING("First", e->ssid);
+}
+
+void test_long_fields_are_truncated(void) {
+    uint8_t a[6];
+    apBssid(7, a);
+    std::string ssid(40, 'S');
+    std::string pw(80, 'p');
+    writePotfile(potLine(a, ssid.c_str(), pw.c_str()));
+    TEST_ASSERT_TRUE(CrackedIndex::open());
+    const CrackedIndex::Entry* e = CrackedIndex::find(a);
+    TEST_ASSERT_NOT_NULL(e);
+    TEST_ASSERT_EQUAL_UINT32(32, strlen(e->ssid));
+    TEST_ASSERT_EQUAL_UINT32(63, strlen(e->password));
+}
+
+void test_reopen_uses_index_and_detects_new_potfile(void) {
+    uint8_t a[6], b[6];
+    apBssid(1, a);
+    apBssid(2, b);
+    writePotfile(potLine(a, "Alpha", "one"));
+    TEST_ASSERT_TRUE(CrackedIndex::open());
+    CrackedIndex::close();
+
+    // Same potfile: the index is reused as is
+    TEST_ASSERT_TRUE(hostExists(SDLayout::crackedIndexPath()));
+    TEST_ASSERT_TRUE(CrackedIndex::open());
+    TEST_ASSERT_NOT_NULL(CrackedIndex::find(a));
+    CrackedIndex::close();
+
+    // Potfile grew behind the index: rebuilt on open
+    writePotfile(potLine(a, "Alpha", "one") + potLine(b, "Bravo", "two"));
+    TEST_ASSERT_TRUE(CrackedIndex::open());
+    TEST_ASSERT_EQUAL_UINT32(2, CrackedIndex::count());
+    TEST_ASSERT_NOT_NULL(CrackedIndex::find(b));
+}
+
+void test_invalidate_rebuilds(void) {
+    uint8_t a[6];
+    apBssid(1, a);
+    writePotfile(potLine(a, "Alpha", "one"));
+    TEST_ASSERT_TRUE(CrackedIndex::open());
+    CrackedIndex::invalidate();
+    TEST_ASSERT_FALSE(CrackedIndex::isOpen());
+    TEST_ASSERT_FALSE(hostExists(SDLayout::crackedIndexPath()));
+
+    // Same size, different content: only invalidate() can tell
+    writePotfile(potLine(a, "Omega", "two"));
+    TEST_ASSERT_TRUE(CrackedIndex::open());
+    const CrackedIndex::Entry* e = CrackedIndex::find(a);
+    TEST_ASSERT_NOT_NULL(e);
+    TEST_ASSERT_EQUAL_STRING("Omega", e->ssid);
+}
+
+void test_merge_appended_lines(void) {
+    const uint32_t n = 700;
+    writePotfile(bigPotfile(n));
+    TEST_ASSERT_TRUE(CrackedIndex::open());
+    uint32_t fromBytes = (uint32_t)bigPotfile(n).size();
+
+    // 300 new APs (more than one sort run) plus a repeat of a known one
+    uint8_t known[6];
+    apBssid(42, known);
+    std::string tail = potLine(known, "Again", "newer");
+    for (uint32_t i = n; i < n + 300; i++) {
+        uint8_t ap[6];
+        apBssid(i, ap);
+        tail += potLine(ap, "New", "fresh");
+    }
+    FILE* f = fopen(hostPath(SDLayout::wpasecResultsPath()).c_str(), "ab");
+    TEST_ASSERT_NOT_NULL(f);
+    fwrite(tail.data(), 1, tail.size(), f);
+    fclose(f);
+
+    uint32_t added = 0;
+    TEST_ASSERT_TRUE(CrackedIndex::merge(fromBytes, added));
+    TEST_ASSERT_EQUAL_UINT32(300, added);
+    TEST_ASSERT_EQUAL_UINT32(n + 300, CrackedIndex::count());
+    const CrackedIndex::Entry* e = CrackedIndex::find(known);
+    TEST_ASSERT_NOT_NULL(e);
+    TEST_ASSERT_EQUAL_STRING("pw42", e->password);
+    uint8_t ap[6];
+    apBssid(n + 299, ap);
+    e = CrackedIndex::find(ap);
+    TEST_ASSERT_NOT_NULL(e);
+    TEST_ASSERT_EQUAL_STRING("fresh", e->password);
+
+    // The merged index is what a fresh open() accepts
+    CrackedIndex::close();
+    TEST_ASSERT_TRUE(CrackedIndex::open());
+    TEST_ASSERT_EQUAL_UINT32(n + 300, CrackedIndex::count());
+
+    // An index that does not match fromBytes is refused
+    TEST_ASSERT_FALSE(CrackedIndex::merge(fromBytes, added));
+}
+
+int main(void) {
+    strcpy(sdRoot, "/tmp/wpaidx_sd_XXXXXX");
+    strcpy(flashRoot, "/tmp/wpaidx_fs_XXXXXX");
+    if (!mkdtemp(sdRoot) || !mkdtemp(flashRoot)) return 1;
+    HostHal::mountSD(sdRoot);
+    HostHal::mountSPIFFS(flashRoot);
+    Config::init();
+    std::string cmd = "mkdir -p " + hostPath(SDLayout::metaDir()) + " " +
+                      hostPath(SDLayout::wpaSecDir());
+    (void)system(cmd.c_str());
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_parse_line);
+    RUN_TEST(test_no_potfile);
+    RUN_TEST(test_small_potfile_lookups);
+    RUN_TEST(test_many_results_past_old_cap);
+    RUN_TEST(test_duplicate_bssid_keeps_first_line);
+    RUN_TEST(test_long_fields_are_truncated);
+    RUN_TEST(test_reopen_uses_index_and_detects_new_potfile);
+    RUN_TEST(test_invalidate_rebuilds);
+    RUN_TEST(test_merge_appended_lines);
+
+    int rc = UNITY_END();
+    cmd = std::string("rm -rf ") + sdRoot + " " + flashRoot;
+    (void)system(cmd.c_str());
+    return rc;
+}
@@ -0,0 +1,272 @@
+// Directory Index Tests
+// Cached listing build, cursor paging, external merge sort views,
+// generation changes on rebuild and the cases that refuse to index.
+
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include <utime.h>
+#include <host_hal.h>
+#include "../../src/web/dir_index.h"
+#include "../../src/core/config.h"
+#include "../../src/core/sd_layout.h"
+
+static char sdRoot[64];
+static char flashRoot[64];
+static const char* kDir = "/listing";
+
+static std::string hostPath(const char* sdPath) {
+    return std::string(sdRoot) + sdPath;
+}
+
+static void writeFile(const char* name, size_t bytes, time_t mtime = 0) {
+    std::string path = hostPath(kDir) + "/" + name;
+    FILE* f = fopen(path.c_str(), "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    for (size_t i = 0; i < bytes; i++) fputc('x', f);
+    fclose(f);
+    if (mtime) {
+        struct utimbuf times = {mtime, mtime};
+        utime(path.c_str(), &times);
+    }
+}
+
+static void makeDir(const char* name) {
+    std::string path = hostPath(kDir) + "/" + name;
+    mkdir(path.c_str(), 0755);
+}
+
+struct Collected {
+    std::vector<DirIndex::Entry> entries;
+    size_t limit;
+};
+
+static bool collect(const DirIndex::Entry& e, void* ctx) {
+    Collected& c = *static_cast<Collected*>(ctx);
+    c.entries.push_back(e);
+    return c.entries.size() < c.limit;
+}
+
+static std::vector<DirIndex::Entry> readAll(const DirIndex::Listing& listing) {
+    Collected c = {{}, (size_t)-1};
+    uint32_t next = DirIndex::read(listing, 0, collect, &c);
+    TEST_ASSERT_EQUAL_UINT32(listing.count, next);
+    return c.entries;
+}
+
+void setUp(void) {
+    DirIndex::invalidate();
+    std::string cmd = "rm -rf " + hostPath(kDir) + " && mkdir -p " + hostPath(kDir);
+    (void)system(cmd.c_str());
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Base listing and paging
+// ============================================================================
+
+void test_base_lists_every_entry(void) {
+    writeFile("a.pcap", 10);
+    writeFile("b.txt", 20);
+    makeDir("sub");
+
+    DirIndex::Listing listing;
+    TEST_ASSERT_TRUE(DirIndex::prepare(kDir, DirIndex::Sort::None, false, false, listing));
+    TEST_ASSERT_EQUAL_UINT32(3, listing.count);
+    TEST_ASSERT_TRUE(listing.generation != 0);
+
+    std::vector<DirIndex::Entry> all = readAll(listing);
+    int dirs = 0;
+    for (const DirIndex::Entry& e : all) {
+        if (e.isDir) {
+            dirs++;
+            TEST_ASSERT_EQUAL_STRING("sub", e.name);
+        } else if (strcmp(e.name, "a.pcap") == 0) {
+            TEST_ASSERT_EQUAL_UINT32(10, e.size);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(1, dirs);
+}
+
+void test_pages_resume_from_slot(void) {
+    char name[32];
+    for (int i = 0; i < 25; i++) {
+        snprintf(name, sizeof(name), "f%02d.bin", i);
+        writeFile(name, i);
+    }
+    DirIndex::Listing listing;
+    TEST_ASSERT_TRUE(DirIndex::prepare(kDir, DirIndex::Sort::Name, false, false, listing));
+
+    std::vector<std::string> seen;
+    uint32_t slot = 0;
+    int pages = 0;
+    while (slot < listing.count) {
+        Collected c = {{}, 10};
+        slot = DirIndex::read(listing, slot, collect, &c);
+        for (const DirIndex::Entry& e : c.entries) seen.push_back(e.name);
+        pages++;
+    }
+    TEST_ASSERT_EQUAL_INT(3, pages);
+    TEST_ASSERT_EQUAL_UINT32(25, seen.size());
+    for (int i = 0; i < 25; i++) {
+        snprintf(name, sizeof(name), "f%02d.bin", i);
+        TEST_ASSERT_EQUAL_STRING(name, seen[i].c_str());
+    }
+}
+
+// ============================================================================
+// Sorted views
+// ============================================================================
+
+void test_name_sort_spans_merge_passes(void) {
+    // 150 entries: five in-RAM runs, three merge passes
+    char name[32];
+    for (int i = 149; i >= 0; i--) {
+        snprintf(name, sizeof(name), "%s%03d", (i % 2) ? "Cap" : "cap", i);
+        writeFile(name, 1);
+    }
+    makeDir("zdir");
+    makeDir("Adir");
+
+    DirIndex::Listing listing;
+    TEST_ASSERT_TRUE(DirIndex::prepare(kDir, DirIndex::Sort::Name, false, false, listing));
+    TEST_ASSERT_EQUAL_UINT32(152, listing.count);
+    std::vector<DirIndex::Entry> all = readAll(listing);
+
+    // Directories first, then case-insensitive name order
+    TEST_ASSERT_EQUAL_STRING("Adir", all[0].name);
+    TEST_ASSERT_EQUAL_STRING("zdir", all[1].name);
+    for (size_t i = 3; i < all.size(); i++) {
+        TEST_ASSERT_FALSE(all[i].isDir);
+        TEST_ASSERT_TRUE(strcasecmp(all[i - 1].name, all[i].name) < 0);
+    }
+}
+
+void test_size_and_mtime_sort_descending(void) {
+    char name[32];
+    for (int i = 0; i < 70; i++) {
+        snprintf(name, sizeof(name), "s%02d", i);
+        writeFile(name, (i * 37) % 70, 1700000000 + (i * 13) % 70);
+    }
+
+    DirIndex::Listing listing;
+    TEST_ASSERT_TRUE(DirIndex::prepare(kDir, DirIndex::Sort::Size, true, false, listing));
+    std::vector<DirIndex::Entry> bySize = readAll(listing);
+    TEST_ASSERT_EQUAL_UINT32(70, bySize.size());
+    for (size_t i = 1; i < bySize.size(); i++) {
+        TEST_ASSERT_TRUE(bySize[i - 1].size >= bySize[i].size);
+    }
+
+    TEST_ASSERT_TRUE(DirIndex::prepare(kDir, DirIndex::Sort::Mtime, false, false, listing));
+    std::vector<DirIndex::Entry> byTime = readAll(listing);
+    TEST_ASSERT_EQUAL_UINT32(70, byTime.size());
+    for (size_t i = 1; i < byTime.size(); i++) {
+        TEST_ASSERT_TRUE(byTime[i - 1].mtime <= byTime[i].mtime);
+    }
+}
+
+// ============================================================================
+// Generations and invalidation
+// ============================================================================
+
+void test_cached_listing_keeps_generation(void) {
+    writeFile("one", 1);
+    DirIndex::Listing first;
+    DirIndex::Listing again;
+    TEST_ASSERT_TRUE(DirIndex::prepare(kDir, DirIndex::Sort::Name, false, false, first));
+    // Written behind the cache's back: not seen until a refresh
+    writeFile("two", 2);
+    TEST_ASSERT_TRUE(DirIndex::prepare(kDir, DirIndex::Sort::Name, false, false, again));
+    TEST_ASSERT_EQUAL_UINT32(first.generation, again.generation);
+    TEST_ASSERT_EQUAL_UINT32(1, again.count);
+
+    TEST_ASSERT_TRUE(DirIndex::prepare(kDir, DirIndex::Sort::Name, false, true, again));
+    TEST_ASSERT_TRUE(first.generation != again.generation);
+    TEST_ASSERT_EQUAL_UINT32(2, again.count);
+
+    // A page asked for with the old listing reads nothing
+    Collected c = {{}, 10};
+    TEST_ASSERT_EQUAL_UINT32(0, DirIndex::read(first, 0, collect, &c));
+    TEST_ASSERT_EQUAL_UINT32(0, c.entries.size());
+}
+
+void test_invalidate_forces_new_walk(void) {
+    writeFile("one", 1);
+    DirIndex::Listing first;
+    DirIndex::Listing again;
+    TEST_ASSERT_TRUE(DirIndex::prepare(kDir, DirIndex::Sort::None, false, false, first));
+    writeFile("two", 2);
+    DirIndex::invalidate();
+    TEST_ASSERT_TRUE(DirIndex::prepare(kDir, DirIndex::Sort::None, false, false, again));
+    TEST_ASSERT_TRUE(first.generation != again.generation);
+    TEST_ASSERT_EQUAL_UINT32(2, again.count);
+}
+
+void test_refuses_unindexable_directories(void) {
+    DirIndex::Listing listing;
+    TEST_ASSERT_FALSE(DirIndex::prepare("/missing", DirIndex::Sort::None, false, false, listing));
+
+    std::string longName(DirIndex::kMaxNameBytes + 1, 'n');
+    writeFile(longName.c_str(), 1);
+    TEST_ASSERT_FALSE(DirIndex::prepare(kDir, DirIndex::Sort::Name, false, false, listing));
+}
+
+// ============================================================================
+// Cursors and sort names
+// ============================================================================
+
+void test_cursor_round_trip(void) {
+    char buf[24];
+    uint32_t generation = 0;
+    uint32_t slot = 0;
+    DirIndex::formatCursor(0xdeadbeef, 400, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("deadbeef.400", buf);
+    TEST_ASSERT_TRUE(DirIndex::parseCursor(buf, generation, slot));
+    TEST_ASSERT_EQUAL_HEX32(0xdeadbeef, generation);
+    TEST_ASSERT_EQUAL_UINT32(400, slot);
+
+    TEST_ASSERT_FALSE(DirIndex::parseCursor("", generation, slot));
+    TEST_ASSERT_FALSE(DirIndex::parseCursor("zz.1", generation, slot));
+    TEST_ASSERT_FALSE(DirIndex::parseCursor("1234", generation, slot));
+    TEST_ASSERT_FALSE(DirIndex::parseCursor("1234.", generation, slot));
+    TEST_ASSERT_FALSE(DirIndex::parseCursor("1234.5x", generation, slot));
+
+    TEST_ASSERT_TRUE(DirIndex::parseSort("size") == DirIndex::Sort::Size);
+    TEST_ASSERT_TRUE(DirIndex::parseSort("bogus") == DirIndex::Sort::None);
+    TEST_ASSERT_TRUE(DirIndex::parseSort(nullptr) == DirIndex::Sort::None);
+}
+
+int main(void) {
+    strcpy(sdRoot, "/tmp/diridx_sd_XXXXXX");
+    strcpy(flashRoot, "/tmp/diridx_fs_XXXXXX");
+    if (!mkdtemp(sdRoot) || !mkdtemp(flashRoot)) return 1;
+    HostHal::mountSD(sdRoot);
+    HostHal::mountSPIFFS(flashRoot);
+    Config::init();
+    std::string cmd = "mkdir -p " + hostPath(SDLayout::metaDir());
+    (void)system(cmd.c_str());
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_base_lists_every_entry);
+    RUN_TEST(test_pages_resume_from_slot);
+
+    RUN_TEST(test_name_sort_spans_merge_passes);
+    RUN_TEST(test_size_and_mtime_sort_descending);
+
+    RUN_TEST(test_cached_listing_keeps_generation);
+    RUN_TEST(test_invalidate_forces_new_walk);
+    RUN_TEST(test_refuses_unindexable_directories);
+
+    RUN_TEST(test_cursor_round_trip);
+
+    int rc = UNITY_END();
+    cmd = std::string("rm -rf ") + sdRoot + " " + flashRoot;
+    (void)system(cmd.c_str());
+    return rc;
+}
@@ -0,0 +1,239 @@
+// EapolSlab Tests
+// Chunk pool allocation, fragmentation and the EAPOLFrame store/release
+// path that keeps handshake frames at their actual length.
+
+#include <unity.h>
+#include <string.h>
+#include "../../src/core/eapol_slab.h"
+#include "../../src/modes/oink.h"
+
+void setUp(void) {
+    EapolSlab::begin();
+}
+
+void tearDown(void) {
+    EapolSlab::end();
+}
+
+// Fake 802.11 data frame: 24 header + 8 LLC + EAPOL payload
+static uint16_t buildFrame(uint8_t* out, uint16_t eapolLen, uint8_t seed) {
+    for (uint16_t i = 0; i < 32 + eapolLen; i++) out[i] = (uint8_t)(seed + i * 7);
+    return 32 + eapolLen;
+}
+
+// ============================================================================
+// Pool
+// ============================================================================
+
+void test_chunksFor_rounds_up(void) {
+    TEST_ASSERT_EQUAL_UINT16(0, EapolSlab::chunksFor(0));
+    TEST_ASSERT_EQUAL_UINT16(1, EapolSlab::chunksFor(1));
+    TEST_ASSERT_EQUAL_UINT16(1, EapolSlab::chunksFor(32));
+    TEST_ASSERT_EQUAL_UINT16(2, EapolSlab::chunksFor(33));
+}
+
+void test_alloc_without_pool_fails(void) {
+    EapolSlab::end();
+    TEST_ASSERT_FALSE(EapolSlab::isReady());
+    TEST_ASSERT_EQUAL_UINT16(EapolSlab::kNone, EapolSlab::alloc(100));
+    TEST_ASSERT_NULL(EapolSlab::ptr(0));
+}
+
+void test_alloc_release_accounting(void) {
+    uint16_t a = EapolSlab::alloc(100);  // 4 chunks
+    uint16_t b = EapolSlab::alloc(40);   // 2 chunks
+    TEST_ASSERT_EQUAL_UINT16(0, a);
+    TEST_ASSERT_EQUAL_UINT16(4, b);
+    EapolSlab::Stats s = EapolSlab::getStats();
+    TEST_ASSERT_EQUAL_UINT16(6, s.chunksUsed);
+    TEST_ASSERT_EQUAL_UINT32(140, s.bytesStored);
+    EapolSlab::release(a, 100);
+    EapolSlab::release(b, 40);
+    s = EapolSlab::getStats();
+    TEST_ASSERT_EQUAL_UINT16(0, s.chunksUsed);
+    TEST_ASSERT_EQUAL_UINT16(6, s.highWater);
+    TEST_ASSERT_EQUAL_UINT16(EapolSlab::kChunks, s.largestFree);
+}
+
+void test_freed_hole_is_reused_first_fit(void) {
+    uint16_t a = EapolSlab::alloc(64);
+    uint16_t b = EapolSlab::alloc(64);
+    uint16_t c = EapolSlab::alloc(64);
+    EapolSlab::release(b, 64);
+    TEST_ASSERT_EQUAL_UINT16(b, EapolSlab::alloc(50));
+    // Too big for the hole - goes past the tail instead
+    EapolSlab::release(a, 64);
+    uint16_t d = EapolSlab::alloc(96);
+    TEST_ASSERT_EQUAL_UINT16(6, d);
+    EapolSlab::release(b, 50);
+    EapolSlab::release(c, 64);
+    EapolSlab::release(d, 96);
+    TEST_ASSERT_EQUAL_UINT16(0, EapolSlab::getStats().chunksUsed);
+}
+
+void test_full_pool_reports_failure(void) {
+    uint16_t all = EapolSlab::alloc(EapolSlab::kChunks * EapolSlab::kChunkBytes);
+    TEST_ASSERT_EQUAL_UINT16(0, all);
+    TEST_ASSERT_EQUAL_UINT16(EapolSlab::kNone, EapolSlab::alloc(1));
+    TEST_ASSERT_EQUAL_UINT32(1, EapolSlab::getStats().allocFails);
+    EapolSlab::release(all, EapolSlab::kChunks * EapolSlab::kChunkBytes);
+}
+
+void test_end_keeps_pool_while_in_use(void) {
+    uint16_t a = EapolSlab::alloc(10);
+    EapolSlab::end();
+    TEST_ASSERT_TRUE(EapolSlab::isReady());
+    EapolSlab::release(a, 10);
+    EapolSlab::end();
+    TEST_ASSERT_FALSE(EapolSlab::isReady());
+}
+
+void test_short_pool_limits_capacity(void) {
+    EapolSlab::end();
+    TEST_ASSERT_TRUE(EapolSlab::begin(4));
+    TEST_ASSERT_EQUAL_UINT16(4, EapolSlab::getStats().chunksTotal);
+    TEST_ASSERT_EQUAL_UINT16(EapolSlab::kNone, EapolSlab::alloc(5 * 32));
+    uint16_t a = EapolSlab::alloc(4 * 32);
+    TEST_ASSERT_EQUAL_UINT16(0, a);
+    EapolSlab::release(a, 4 * 32);
+}
+
+// ============================================================================
+// EAPOLFrame
+// ============================================================================
+
+void test_frame_payload_inside_full_frame_stored_once(void) {
+    uint8_t full[200];
+    uint16_t fullLen = buildFrame(full, 121, 3);
+    EAPOLFrame f = {};
+    TEST_ASSERT_TRUE(f.store(full + 32, 121, full, fullLen));
+    TEST_ASSERT_EQUAL_UINT16(fullLen, f.storedBytes());
+    TEST_ASSERT_EQUAL_MEMORY(full, f.fullFrame(), fullLen);
+    TEST_ASSERT_EQUAL_MEMORY(full + 32, f.data(), 121);
+    TEST_ASSERT_EQUAL_UINT16(EapolSlab::chunksFor(fullLen), EapolSlab::getStats().chunksUsed);
+    f.release();
+    TEST_ASSERT_EQUAL_UINT16(0, EapolSlab::getStats().chunksUsed);
+}
+
+void test_frame_copied_tail_is_deduped(void) {
+    // Staging buffers are separate copies - match on content
+    uint8_t full[200];
+    uint8_t payload[121];
+    uint16_t fullLen = buildFrame(full, 121, 9);
+    memcpy(payload, full + 32, 121);
+    EAPOLFrame f = {};
+    TEST_ASSERT_TRUE(f.store(payload, 121, full, fullLen));
+    TEST_ASSERT_EQUAL_UINT16(fullLen, f.storedBytes());
+    TEST_ASSERT_EQUAL_MEMORY(payload, f.data(), 121);
+    f.release();
+}
+
+void test_frame_tail_before_fcs_is_deduped(void) {
+    uint8_t full[200];
+    uint16_t fullLen = buildFrame(full, 99, 1);
+    memset(full + fullLen, 0xEE, 4);
+    uint8_t payload[99];
+    memcpy(payload, full + 32, 99);
+    EAPOLFrame f = {};
+    TEST_ASSERT_TRUE(f.store(payload, 99, full, fullLen + 4));
+    TEST_ASSERT_EQUAL_UINT16(fullLen + 4, f.storedBytes());
+    TEST_ASSERT_EQUAL_MEMORY(payload, f.data(), 99);
+    f.release();
+}
+
+void test_frame_unrelated_payload_stored_separately(void) {
+    uint8_t full[100];
+    uint8_t payload[99];
+    uint16_t fullLen = buildFrame(full, 60, 5);
+    memset(payload, 0x42, sizeof(payload));
+    EAPOLFrame f = {};
+    TEST_ASSERT_TRUE(f.store(payload, 99, full, fullLen));
+    TEST_ASSERT_EQUAL_UINT16(fullLen + 99, f.storedBytes());
+    TEST_ASSERT_EQUAL_MEMORY(full, f.fullFrame(), fullLen);
+    TEST_ASSERT_EQUAL_MEMORY(payload, f.data(), 99);
+    f.release();
+}
+
+void test_frame_payload_only(void) {
+    uint8_t payload[99];
+    memset(payload, 0x17, sizeof(payload));
+    EAPOLFrame f = {};
+    TEST_ASSERT_TRUE(f.store(payload, 99, nullptr, 0));
+    TEST_ASSERT_NULL(f.fullFrame());
+    TEST_ASSERT_EQUAL_MEMORY(payload, f.data(), 99);
+    f.release();
+}
+
+void test_frame_lengths_clamped(void) {
+    static uint8_t big[700];
+    memset(big, 0x5A, sizeof(big));
+    EAPOLFrame f = {};
+    TEST_ASSERT_TRUE(f.store(big, 700, big, 700));
+    TEST_ASSERT_EQUAL_UINT16(EAPOLFrame::kMaxData, f.len);
+    TEST_ASSERT_EQUAL_UINT16(EAPOLFrame::kMaxFull, f.fullFrameLen);
+    f.release();
+    TEST_ASSERT_EQUAL_UINT16(0, EapolSlab::getStats().chunksUsed);
+}
+
+void test_frame_restore_replaces_old_bytes(void) {
+    uint8_t full[200];
+    uint16_t fullLen = buildFrame(full, 121, 2);
+    EAPOLFrame f = {};
+    f.store(full + 32, 121, full, fullLen);
+    f.store(full + 32, 99, full, 32 + 99);
+    TEST_ASSERT_EQUAL_UINT16(99, f.len);
+    TEST_ASSERT_EQUAL_UINT16(EapolSlab::chunksFor(32 + 99), EapolSlab::getStats().chunksUsed);
+    f.release();
+}
+
+void test_zeroed_frame_release_is_noop(void) {
+    uint16_t a = EapolSlab::alloc(32);  // Handle 0 is live
+    EAPOLFrame f = {};
+    f.release();
+    TEST_ASSERT_EQUAL_UINT16(1, EapolSlab::getStats().chunksUsed);
+    EapolSlab::release(a, 32);
+}
+
+void test_handshake_footprint(void) {
+    // Four typical messages (M1 ~99, M2/M3 ~121-151, M4 ~99 bytes of EAPOL)
+    const uint16_t lens[4] = {99, 121, 151, 99};
+    uint8_t full[200];
+    CapturedHandshake hs = {};
+    uint32_t bytes = sizeof(CapturedHandshake);
+    for (int i = 0; i < 4; i++) {
+        uint16_t fullLen = buildFrame(full, lens[i], (uint8_t)i);
+        TEST_ASSERT_TRUE(hs.frames[i].store(full + 32, lens[i], full, fullLen));
+        hs.capturedMask |= (1 << i);
+        bytes += EapolSlab::chunksFor(fullLen) * EapolSlab::kChunkBytes;
+    }
+    // Old inline layout: 4 x 820-byte EAPOLFrame plus ~64 bytes of fields
+    const uint32_t oldBytes = 4 * 820 + 64;
+    TEST_ASSERT_TRUE(bytes * 4 <= oldBytes);
+    hs.releaseFrames();
+    TEST_ASSERT_EQUAL_UINT8(0, hs.capturedMask);
+    TEST_ASSERT_EQUAL_UINT16(0, EapolSlab::getStats().chunksUsed);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_chunksFor_rounds_up);
+    RUN_TEST(test_alloc_without_pool_fails);
+    RUN_TEST(test_alloc_release_accounting);
+    RUN_TEST(test_freed_hole_is_reused_first_fit);
+    RUN_TEST(test_full_pool_reports_failure);
+    RUN_TEST(test_end_keeps_pool_while_in_use);
+    RUN_TEST(test_short_pool_limits_capacity);
+
+    RUN_TEST(test_frame_payload_inside_full_frame_stored_once);
+    RUN_TEST(test_frame_copied_tail_is_deduped);
+    RUN_TEST(test_frame_tail_before_fcs_is_deduped);
+    RUN_TEST(test_frame_unrelated_payload_stored_separately);
+    RUN_TEST(test_frame_payload_only);
+    RUN_TEST(test_frame_lengths_clamped);
+    RUN_TEST(test_frame_restore_replaces_old_bytes);
+    RUN_TEST(test_zeroed_frame_release_is_noop);
+    RUN_TEST(test_handshake_footprint);
+
+    return UNITY_END();
+}
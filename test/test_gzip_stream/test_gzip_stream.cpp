@@ -0,0 +1,209 @@
+// Gzip Stream Tests
+// Container layout, determinism, and streams written through the encoder
+// checked with the system gzip (-t integrity test, -dc content round trip).
+
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../../src/web/gzip_stream.h"
+#include "../../src/web/zip_stream.h"
+
+static char workDir[64];
+static GzipStream gz;   // ~23 KiB; not on the test stack
+
+struct Capture {
+    std::vector<uint8_t> bytes;
+    size_t failAfter;   // Sink refuses writes past this many bytes
+    uint32_t calls;
+};
+
+static bool captureSink(const uint8_t* data, size_t len, void* ctx) {
+    Capture& cap = *static_cast<Capture*>(ctx);
+    if (cap.bytes.size() + len > cap.failAfter) return false;
+    cap.bytes.insert(cap.bytes.end(), data, data + len);
+    cap.calls++;
+    return true;
+}
+
+// Compress in pieces of `step` bytes
+static Capture compress(const std::string& text, size_t step) {
+    Capture cap = {{}, SIZE_MAX, 0};
+    TEST_ASSERT_TRUE(gz.begin(captureSink, &cap));
+    for (size_t off = 0; off < text.size(); off += step) {
+        size_t n = text.size() - off < step ? text.size() - off : step;
+        TEST_ASSERT_TRUE(gz.write((const uint8_t*)text.data() + off, n));
+    }
+    TEST_ASSERT_TRUE(gz.finish());
+    TEST_ASSERT_EQUAL_UINT32(cap.bytes.size(), gz.bytesOut());
+    TEST_ASSERT_EQUAL_UINT32(text.size(), gz.bytesIn());
+    return cap;
+}
+
+static int run(const std::string& cmd) {
+    return system((cmd + " >/dev/null 2>&1").c_str());
+}
+
+static std::string gunzip(const Capture& cap) {
+    std::string path = std::string(workDir) + "/out.gz";
+    FILE* f = fopen(path.c_str(), "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    fwrite(cap.bytes.data(), 1, cap.bytes.size(), f);
+    fclose(f);
+    TEST_ASSERT_EQUAL_INT(0, run("gzip -t '" + path + "'"));
+    FILE* p = popen(("gzip -dc '" + path + "'").c_str(), "r");
+    TEST_ASSERT_NOT_NULL(p);
+    std::string out;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), p)) > 0) out.append(buf, n);
+    pclose(p);
+    return out;
+}
+
+static uint32_t le32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// WiGLE CSV as Warhog writes it
+static std::string wigleCsv(size_t bytes) {
+    std::string s = "WigleWifi-1.6,appRelease=porkchop,model=M5Cardputer,release=1.0,"
+                    "device=porkchop,display=,board=esp32s3,brand=M5Stack,star=Sol,body=3,subBody=0\n"
+                    "MAC,SSID,AuthMode,FirstSeen,Channel,Frequency,RSSI,CurrentLatitude,"
+                    "CurrentLongitude,AltitudeMeters,AccuracyMeters,RCOIs,MfgrId,Type\n";
+    static const char* kAuth[] = {"[WPA2-PSK-CCMP][ESS]", "[WPA-PSK-TKIP][WPA2-PSK-CCMP][ESS]",
+                                  "[ESS]", "[WPA3-SAE-CCMP][ESS]"};
+    uint32_t seed = 0xC0FFEE;
+    char line[200];
+    for (uint32_t i = 0; s.size() < bytes; i++) {
+        seed = seed * 1103515245u + 12345u;
+        uint8_t ch = (uint8_t)(1 + (seed >> 8) % 11);
+        snprintf(line, sizeof(line),
+                 "%02X:%02X:%02X:%02X:%02X:%02X,Net%u,%s,2026-10-16 12:%02u:%02u,%u,%u,%d,"
+                 "52.%06u,4.%06u,%u.0,%u.0,,,WIFI\n",
+                 (seed >> 24) & 0xFF, (seed >> 16) & 0xFF, 0x3C, 0x71, (i >> 8) & 0xFF, i & 0xFF,
+                 (unsigned)((seed >> 4) % 500), kAuth[(seed >> 12) % 4],
+                 (unsigned)(i / 60 % 60), (unsigned)(i % 60), ch, 2407 + 5 * ch,
+                 -40 - (int)((seed >> 3) % 50), 370000 + i * 7 % 5000, 890000 + i * 3 % 5000,
+                 (unsigned)(10 + (seed >> 20) % 20), (unsigned)(3 + (seed >> 6) % 9));
+        s += line;
+    }
+    return s;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ============================================================================
+// Layout
+// ============================================================================
+
+void test_empty_stream_layout(void) {
+    Capture cap = compress("", 1);
+    // Header, one byte of block header + end of block, crc 0, size 0
+    TEST_ASSERT_EQUAL_UINT32(10 + 2 + 8, cap.bytes.size());
+    const uint8_t* b = cap.bytes.data();
+    TEST_ASSERT_EQUAL_HEX8(0x1F, b[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x8B, b[1]);
+    TEST_ASSERT_EQUAL_HEX8(8, b[2]);                    // Deflate
+    TEST_ASSERT_EQUAL_HEX8(0x03, b[10] & 0x07);         // Final fixed-Huffman block
+    TEST_ASSERT_EQUAL_HEX32(0, le32(b + 12));
+    TEST_ASSERT_EQUAL_UINT32(0, le32(b + 16));
+}
+
+void test_trailer_holds_crc_and_size(void) {
+    Capture cap = compress("123456789", 4);
+    size_t n = cap.bytes.size();
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, le32(cap.bytes.data() + n - 8));
+    TEST_ASSERT_EQUAL_UINT32(9, le32(cap.bytes.data() + n - 4));
+}
+
+void test_output_independent_of_write_sizes(void) {
+    std::string text = wigleCsv(20000);
+    Capture a = compress(text, 1);
+    Capture b = compress(text, 2048);
+    Capture c = compress(text, text.size());
+    TEST_ASSERT_TRUE(a.bytes == b.bytes);
+    TEST_ASSERT_TRUE(a.bytes == c.bytes);
+}
+
+void test_sink_gets_whole_kib_pieces(void) {
+    Capture cap = compress(wigleCsv(60000), 2048);
+    TEST_ASSERT_TRUE(cap.bytes.size() > 4096);
+    // Every call but the last hands over a full buffer
+    TEST_ASSERT_EQUAL_UINT32((cap.bytes.size() + 1023) / 1024, cap.calls);
+}
+
+void test_sink_failure_stops_stream(void) {
+    Capture cap = {{}, 1500, 0};
+    std::string text = wigleCsv(50000);
+    TEST_ASSERT_TRUE(gz.begin(captureSink, &cap));
+    bool ok = true;
+    for (size_t off = 0; ok && off < text.size(); off += 2048) {
+        ok = gz.write((const uint8_t*)text.data() + off, 2048);
+    }
+    TEST_ASSERT_FALSE(ok);
+    TEST_ASSERT_FALSE(gz.finish());
+    TEST_ASSERT_FALSE(gz.isOpen());
+    TEST_ASSERT_FALSE(gz.write((const uint8_t*)"x", 1));
+    TEST_ASSERT_FALSE(gz.finish());
+}
+
+// ============================================================================
+// Round trips through gzip
+// ============================================================================
+
+void test_wigle_csv_round_trip_and_ratio(void) {
+    std::string text = wigleCsv(400000);   // One rotated Warhog file
+    Capture cap = compress(text, 2048);
+    TEST_ASSERT_TRUE(gunzip(cap) == text);
+    printf("wigle csv: %u -> %u bytes\n", (unsigned)text.size(), (unsigned)cap.bytes.size());
+    TEST_ASSERT_TRUE(cap.bytes.size() * 3 < text.size());
+}
+
+void test_binary_and_runs_round_trip(void) {
+    std::string text;
+    uint32_t seed = 0x1234567;
+    for (int i = 0; i < 30000; i++) {             // Incompressible, all 256 literals
+        seed = seed * 1103515245u + 12345u;
+        text += (char)(seed >> 16);
+    }
+    text += std::string(10000, 'A');              // Maximum-length matches at distance 1
+    for (int i = 0; i < 3000; i++) text += "abcabd";
+    text += text.substr(100, 5000);               // Reference beyond the window
+    for (int i = 0; i < 40000; i++) {             // Skewed: long Huffman codes
+        seed = seed * 1103515245u + 12345u;
+        uint8_t c = 0;
+        while (c < 200 && ((seed >> (c % 24)) & 3) != 0) c++;
+        text += (char)c;
+    }
+    Capture cap = compress(text, 777);
+    TEST_ASSERT_TRUE(gunzip(cap) == text);
+}
+
+int main(void) {
+    strcpy(workDir, "/tmp/gzip_out_XXXXXX");
+    if (!mkdtemp(workDir)) return 1;
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty_stream_layout);
+    RUN_TEST(test_trailer_holds_crc_and_size);
+    RUN_TEST(test_output_independent_of_write_sizes);
+    RUN_TEST(test_sink_gets_whole_kib_pieces);
+    RUN_TEST(test_sink_failure_stops_stream);
+
+    if (run("gzip --version") == 0) {
+        RUN_TEST(test_wigle_csv_round_trip_and_ratio);
+        RUN_TEST(test_binary_and_runs_round_trip);
+    } else {
+        printf("gzip not found: skipping round-trip tests\n");
+    }
+
+    int rc = UNITY_END();
+    std::string cmd = std::string("rm -rf ") + workDir;
+    (void)system(cmd.c_str());
+    return rc;
+}
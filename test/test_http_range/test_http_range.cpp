@@ -0,0 +1,88 @@
+// HTTP Range Tests
+// "Range: bytes=..." parsing used by /download to resume transfers.
+
+#include <unity.h>
+#include "../../src/web/http_range.h"
+
+using HttpRange::Result;
+
+static size_t first;
+static size_t last;
+
+void setUp(void) {
+    first = 12345;
+    last = 12345;
+}
+
+void tearDown(void) {}
+
+void test_closed_range(void) {
+    TEST_ASSERT_TRUE(HttpRange::parse("bytes=0-99", 1000, first, last) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(0, first);
+    TEST_ASSERT_EQUAL_UINT32(99, last);
+    TEST_ASSERT_TRUE(HttpRange::parse("bytes=500-500", 1000, first, last) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(500, first);
+    TEST_ASSERT_EQUAL_UINT32(500, last);
+}
+
+void test_open_range_resumes_to_end(void) {
+    TEST_ASSERT_TRUE(HttpRange::parse("bytes=4096-", 10000, first, last) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(4096, first);
+    TEST_ASSERT_EQUAL_UINT32(9999, last);
+}
+
+void test_end_past_size_is_clamped(void) {
+    TEST_ASSERT_TRUE(HttpRange::parse("bytes=10-5000", 100, first, last) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(10, first);
+    TEST_ASSERT_EQUAL_UINT32(99, last);
+}
+
+void test_suffix_range(void) {
+    TEST_ASSERT_TRUE(HttpRange::parse("bytes=-100", 1000, first, last) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(900, first);
+    TEST_ASSERT_EQUAL_UINT32(999, last);
+    // Longer than the file: the whole file as a 206
+    TEST_ASSERT_TRUE(HttpRange::parse("bytes=-5000", 1000, first, last) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(0, first);
+    TEST_ASSERT_EQUAL_UINT32(999, last);
+}
+
+void test_unsatisfiable(void) {
+    TEST_ASSERT_TRUE(HttpRange::parse("bytes=1000-", 1000, first, last) == Result::Unsatisfiable);
+    TEST_ASSERT_TRUE(HttpRange::parse("bytes=2000-3000", 1000, first, last) == Result::Unsatisfiable);
+    TEST_ASSERT_TRUE(HttpRange::parse("bytes=-0", 1000, first, last) == Result::Unsatisfiable);
+    TEST_ASSERT_TRUE(HttpRange::parse("bytes=0-", 0, first, last) == Result::Unsatisfiable);
+}
+
+void test_ignored_headers_serve_full_file(void) {
+    const char* ignored[] = {
+        nullptr, "", "items=0-10", "bytes=", "bytes=abc-", "bytes=5-2",
+        "bytes=0-1,5-6", "bytes=--5", "bytes=1-2-3", "bytes=99999999999999999999-"
+    };
+    for (const char* h : ignored) {
+        TEST_ASSERT_TRUE(HttpRange::parse(h, 1000, first, last) == Result::Full);
+    }
+    // Untouched on Full
+    TEST_ASSERT_EQUAL_UINT32(12345, first);
+    TEST_ASSERT_EQUAL_UINT32(12345, last);
+}
+
+void test_tolerates_surrounding_spaces(void) {
+    TEST_ASSERT_TRUE(HttpRange::parse(" bytes=3-4 ", 10, first, last) == Result::Partial);
+    TEST_ASSERT_EQUAL_UINT32(3, first);
+    TEST_ASSERT_EQUAL_UINT32(4, last);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_closed_range);
+    RUN_TEST(test_open_range_resumes_to_end);
+    RUN_TEST(test_end_past_size_is_clamped);
+    RUN_TEST(test_suffix_range);
+    RUN_TEST(test_unsatisfiable);
+    RUN_TEST(test_ignored_headers_serve_full_file);
+    RUN_TEST(test_tolerates_surrounding_spaces);
+
+    return UNITY_END();
+}
@@ -0,0 +1,246 @@
+// HTTP Scheduler Tests
+// Slot pool, round-robin interleaving, time budgets, and dropped or
+// stalled clients, against the host socket stand-in (HostConnection with a
+// capped send window; a blocking write into it costs 10 s of virtual time).
+
+#include <unity.h>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <host_hal.h>
+#include <WiFiClient.h>
+#include "../../src/web/http_scheduler.h"
+
+struct Body {
+    size_t left;            // Bytes still to produce
+    char fillChar;
+    uint32_t msPerFill;     // Virtual time one fill() costs
+    bool finished;
+    bool complete;
+    size_t sent;
+};
+
+static size_t fillBody(uint8_t* buf, size_t cap, void* ctx) {
+    Body& b = *static_cast<Body*>(ctx);
+    size_t n = b.left < cap ? b.left : cap;
+    memset(buf, b.fillChar, n);
+    b.left -= n;
+    if (b.msPerFill) HostHal::advanceMillis(b.msPerFill);
+    return n;
+}
+
+static void finishBody(void* ctx, size_t sent, bool complete) {
+    Body& b = *static_cast<Body*>(ctx);
+    b.finished = true;
+    b.complete = complete;
+    b.sent = sent;
+}
+
+static std::shared_ptr<HostConnection> peer(size_t window = SIZE_MAX) {
+    auto conn = std::make_shared<HostConnection>();
+    conn->serverSide = true;
+    conn->open = true;
+    conn->txWindow = window;
+    return conn;
+}
+
+static bool startBody(std::shared_ptr<HostConnection> conn, Body& body, const char* head = "H\r\n\r\n") {
+    int slot = HttpScheduler::acquire();
+    if (slot < 0) return false;
+    HttpScheduler::Job job = {fillBody, finishBody, &body};
+    return HttpScheduler::start(slot, WiFiClient(conn), head, strlen(head), job);
+}
+
+static void drain() {
+    for (int i = 0; i < 1000 && HttpScheduler::active() > 0; i++) HttpScheduler::service(20);
+}
+
+void setUp(void) {
+    HostHal::setMillis(1000);
+    TEST_ASSERT_TRUE(HttpScheduler::begin());
+}
+
+void tearDown(void) {
+    HttpScheduler::end();
+}
+
+// ============================================================================
+// Slots
+// ============================================================================
+
+void test_streams_head_then_body(void) {
+    auto conn = peer();
+    Body body = {5000, 'a', 0, false, false, 0};
+    TEST_ASSERT_TRUE(startBody(conn, body, "HTTP/1.1 200 OK\r\n\r\n"));
+    TEST_ASSERT_EQUAL_UINT8(1, HttpScheduler::active());
+    drain();
+
+    TEST_ASSERT_EQUAL_UINT8(0, HttpScheduler::active());
+    TEST_ASSERT_TRUE(body.finished);
+    TEST_ASSERT_TRUE(body.complete);
+    TEST_ASSERT_EQUAL_UINT32(5000, body.sent);
+    TEST_ASSERT_EQUAL_UINT32(19 + 5000, conn->tx.size());
+    TEST_ASSERT_EQUAL_STRING("HTTP/1.1 200 OK\r\n\r\naaa", conn->tx.substr(0, 22).c_str());
+    TEST_ASSERT_EQUAL_INT('a', conn->tx.back());
+}
+
+void test_pool_is_fixed(void) {
+    int slots[HttpScheduler::kSlots];
+    for (uint8_t i = 0; i < HttpScheduler::kSlots; i++) {
+        slots[i] = HttpScheduler::acquire();
+        TEST_ASSERT_TRUE(slots[i] >= 0);
+    }
+    TEST_ASSERT_EQUAL_INT(-1, HttpScheduler::acquire());
+    // Reserved, not streaming
+    TEST_ASSERT_EQUAL_UINT8(0, HttpScheduler::active());
+    HttpScheduler::release(slots[1]);
+    TEST_ASSERT_EQUAL_INT(slots[1], HttpScheduler::acquire());
+
+    // Head larger than a slot buffer is refused
+    std::string head(HttpScheduler::kSlotBytes + 1, 'h');
+    Body body = {1, 'x', 0, false, false, 0};
+    HttpScheduler::Job job = {fillBody, finishBody, &body};
+    TEST_ASSERT_FALSE(HttpScheduler::start(slots[0], WiFiClient(peer()), head.data(), head.size(), job));
+}
+
+// ============================================================================
+// Interleaving and budgets
+// ============================================================================
+
+void test_slow_client_does_not_block_others(void) {
+    auto slow = peer(100);
+    auto fast = peer();
+    Body slowBody = {20000, 's', 0, false, false, 0};
+    Body fastBody = {20000, 'f', 0, false, false, 0};
+    TEST_ASSERT_TRUE(startBody(slow, slowBody));
+    TEST_ASSERT_TRUE(startBody(fast, fastBody));
+
+    drain();
+    TEST_ASSERT_TRUE(fastBody.finished);
+    TEST_ASSERT_FALSE(slowBody.finished);
+    TEST_ASSERT_EQUAL_UINT32(100, slow->tx.size());
+
+    slow->txWindow = SIZE_MAX;
+    drain();
+    TEST_ASSERT_TRUE(slowBody.complete);
+    TEST_ASSERT_EQUAL_UINT32(20000, slowBody.sent);
+}
+
+void test_round_robin_shares_the_link(void) {
+    auto a = peer(0);
+    auto b = peer(0);
+    Body bodyA = {30000, 'a', 0, false, false, 0};
+    Body bodyB = {30000, 'b', 0, false, false, 0};
+    TEST_ASSERT_TRUE(startBody(a, bodyA));
+    TEST_ASSERT_TRUE(startBody(b, bodyB));
+
+    // The peers read a little at a time; both must advance every round
+    for (int round = 0; round < 10; round++) {
+        a->txWindow = 700;
+        b->txWindow = 700;
+        HttpScheduler::service(20);
+        TEST_ASSERT_EQUAL_UINT32((round + 1) * 700, a->tx.size());
+        TEST_ASSERT_EQUAL_UINT32((round + 1) * 700, b->tx.size());
+    }
+    a->txWindow = SIZE_MAX;
+    b->txWindow = SIZE_MAX;
+    drain();
+    TEST_ASSERT_TRUE(bodyA.complete && bodyB.complete);
+}
+
+void test_full_socket_does_not_block_the_loop(void) {
+    auto conn = peer(0);
+    Body body = {5000, 'x', 0, false, false, 0};
+    TEST_ASSERT_TRUE(startBody(conn, body));
+
+    uint32_t before = millis();
+    TEST_ASSERT_EQUAL_UINT32(0, HttpScheduler::service(20));
+    TEST_ASSERT_EQUAL_UINT32(before, millis());
+    TEST_ASSERT_EQUAL_UINT8(1, HttpScheduler::active());
+
+    // A partial window takes what fits, still without waiting
+    conn->txWindow = 3;
+    TEST_ASSERT_EQUAL_UINT32(3, HttpScheduler::service(20));
+    TEST_ASSERT_EQUAL_UINT32(before, millis());
+
+    conn->txWindow = SIZE_MAX;
+    drain();
+    TEST_ASSERT_TRUE(body.complete);
+}
+
+void test_budget_bounds_a_slice(void) {
+    auto conn = peer();
+    Body body = {100000, 'x', 5, false, false, 0};
+    TEST_ASSERT_TRUE(startBody(conn, body));
+
+    size_t sent = HttpScheduler::service(20);
+    // Four fills fit in 20 ms of (virtual) SD time; the rest waits
+    TEST_ASSERT_TRUE(sent > 0);
+    TEST_ASSERT_TRUE(sent <= 4 * HttpScheduler::kSlotBytes + 5);
+    TEST_ASSERT_EQUAL_UINT8(1, HttpScheduler::active());
+    drain();
+    TEST_ASSERT_TRUE(body.complete);
+}
+
+// ============================================================================
+// Dropped and stalled clients
+// ============================================================================
+
+void test_disconnect_finishes_incomplete(void) {
+    auto conn = peer(3000);
+    Body body = {20000, 'x', 0, false, false, 0};
+    TEST_ASSERT_TRUE(startBody(conn, body, ""));
+    HttpScheduler::service(20);
+    conn->open = false;
+    HttpScheduler::service(20);
+
+    TEST_ASSERT_TRUE(body.finished);
+    TEST_ASSERT_FALSE(body.complete);
+    TEST_ASSERT_EQUAL_UINT32(3000, body.sent);
+    TEST_ASSERT_EQUAL_UINT8(0, HttpScheduler::active());
+}
+
+void test_stalled_client_is_dropped(void) {
+    auto conn = peer(0);
+    Body body = {5000, 'x', 0, false, false, 0};
+    TEST_ASSERT_TRUE(startBody(conn, body));
+    HostHal::advanceMillis(HttpScheduler::kStallMs - 1);
+    HttpScheduler::service(20);
+    TEST_ASSERT_FALSE(body.finished);
+
+    HostHal::advanceMillis(2);
+    HttpScheduler::service(20);
+    TEST_ASSERT_TRUE(body.finished);
+    TEST_ASSERT_FALSE(body.complete);
+    // Slot is free again
+    TEST_ASSERT_TRUE(HttpScheduler::acquire() >= 0);
+}
+
+void test_end_aborts_open_streams(void) {
+    Body a = {5000, 'a', 0, false, false, 0};
+    Body b = {5000, 'b', 0, false, false, 0};
+    TEST_ASSERT_TRUE(startBody(peer(0), a));
+    TEST_ASSERT_TRUE(startBody(peer(0), b));
+    HttpScheduler::end();
+    TEST_ASSERT_TRUE(a.finished && !a.complete);
+    TEST_ASSERT_TRUE(b.finished && !b.complete);
+    TEST_ASSERT_EQUAL_INT(-1, HttpScheduler::acquire());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_streams_head_then_body);
+    RUN_TEST(test_pool_is_fixed);
+
+    RUN_TEST(test_slow_client_does_not_block_others);
+    RUN_TEST(test_round_robin_shares_the_link);
+    RUN_TEST(test_full_socket_does_not_block_the_loop);
+    RUN_TEST(test_budget_bounds_a_slice);
+
+    RUN_TEST(test_disconnect_finishes_incomplete);
+    RUN_TEST(test_stalled_client_is_dropped);
+    RUN_TEST(test_end_aborts_open_streams);
+
+    return UNITY_END();
+}
@@ -0,0 +1,99 @@
+// JSON Writer Tests
+// Comma placement, escaping and flushing through a buffer smaller than
+// the document.
+
+#include <unity.h>
+#include <cstring>
+#include <string>
+#include "../../src/web/json_writer.h"
+
+static std::string out;
+static size_t flushes;
+static size_t failAfter;
+
+static bool capture(const char* data, size_t len, void* ctx) {
+    (void)ctx;
+    out.append(data, len);
+    flushes++;
+    return flushes < failAfter;
+}
+
+void setUp(void) {
+    out.clear();
+    flushes = 0;
+    failAfter = (size_t)-1;
+}
+
+void tearDown(void) {}
+
+void test_nested_containers_get_commas(void) {
+    char buf[256];
+    JsonWriter json(buf, sizeof(buf), capture, nullptr);
+    json.beginObject().key("items").beginArray();
+    json.beginObject().kv("name", "a").kv("size", 1u).kvBool("isDir", false).endObject();
+    json.beginObject().kv("name", "b").kv("size", 2u).endObject();
+    json.endArray();
+    json.key("next").null();
+    json.key("delta").i32(-5);
+    json.endObject();
+    TEST_ASSERT_TRUE(json.flush());
+    TEST_ASSERT_EQUAL_STRING(
+        "{\"items\":[{\"name\":\"a\",\"size\":1,\"isDir\":false},{\"name\":\"b\",\"size\":2}],"
+        "\"next\":null,\"delta\":-5}", out.c_str());
+    TEST_ASSERT_EQUAL_UINT32(out.size(), json.total());
+}
+
+void test_empty_containers(void) {
+    char buf[32];
+    JsonWriter json(buf, sizeof(buf), capture, nullptr);
+    json.beginArray().beginArray().endArray().beginObject().endObject().endArray();
+    json.flush();
+    TEST_ASSERT_EQUAL_STRING("[[],{}]", out.c_str());
+}
+
+void test_strings_are_escaped(void) {
+    char buf[64];
+    JsonWriter json(buf, sizeof(buf), capture, nullptr);
+    json.beginArray().str("say \"hi\"\\").str("tab\there\n").str(nullptr).str("caf\xc3\xa9").endArray();
+    json.flush();
+    TEST_ASSERT_EQUAL_STRING("[\"say \\\"hi\\\"\\\\\",\"tab\\u0009here\\u000a\",\"\",\"caf\xc3\xa9\"]",
+                             out.c_str());
+}
+
+void test_small_buffer_flushes_in_order(void) {
+    char buf[7];
+    JsonWriter json(buf, sizeof(buf), capture, nullptr);
+    json.beginArray();
+    for (uint32_t i = 0; i < 100; i++) json.u32(i * 1000);
+    json.endArray();
+    TEST_ASSERT_TRUE(json.buffered() <= sizeof(buf));
+    json.flush();
+    TEST_ASSERT_TRUE(flushes > 10);
+    TEST_ASSERT_EQUAL_STRING("[0,1000,2000", out.substr(0, 12).c_str());
+    TEST_ASSERT_EQUAL_STRING(",99000]", out.substr(out.size() - 7).c_str());
+}
+
+void test_failed_flush_stops_output(void) {
+    char buf[8];
+    failAfter = 2;
+    JsonWriter json(buf, sizeof(buf), capture, nullptr);
+    json.beginArray();
+    for (int i = 0; i < 50; i++) json.str("padding");
+    json.endArray();
+    TEST_ASSERT_FALSE(json.ok());
+    TEST_ASSERT_FALSE(json.flush());
+    TEST_ASSERT_EQUAL_UINT32(2, flushes);
+    TEST_ASSERT_EQUAL_UINT32(16, out.size());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_nested_containers_get_commas);
+    RUN_TEST(test_empty_containers);
+    RUN_TEST(test_strings_are_escaped);
+    RUN_TEST(test_small_buffer_flushes_in_order);
+    RUN_TEST(test_failed_flush_stops_output);
+
+    return UNITY_END();
+}
@@ -1,14 +1,41 @@
-// Test MAC address utilities, PCAP structures, and deauth frame construction
-// Tests pure functions from testable_functions.h
+// Test MAC address utilities, PCAP files, and deauth frame construction
+// Tests pure functions from testable_functions.h; deauth/disassoc frames and
+// MAC randomization come from the real WSLBypasser, PCAP files from the real
+// OinkMode writers, via the host HAL
 // Priority 4 of test expansion plan
 
 #include <unity.h>
+#include <host_hal.h>
+#include <esp_wifi.h>
+#include <SD.h>
+#include "../../src/core/wsl_bypasser.h"
+#include "../../src/modes/oink.h"
+#include "../../tools/pcap_replay/pcap_reader.h"
 #include "../mocks/testable_functions.h"
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <string>
+#include <vector>
 
-void setUp(void) {}
+void setUp(void) {
+    HostHal::resetTxStats();
+}
 void tearDown(void) {}
 
+// Frames are whatever WSLBypasser hands to esp_wifi_80211_tx()
+static size_t buildDeauthFrame(uint8_t* frame, const uint8_t* bssid,
+                               const uint8_t* station, uint8_t reason) {
+    if (!WSLBypasser::sendDeauthFrame(bssid, 6, station, reason)) return 0;
+    return HostHal::getLastTx(frame, DEAUTH_FRAME_SIZE);
+}
+
+static size_t buildDisassocFrame(uint8_t* frame, const uint8_t* bssid,
+                                 const uint8_t* station, uint8_t reason) {
+    if (!WSLBypasser::sendDisassocFrame(bssid, 6, station, reason)) return 0;
+    return HostHal::getLastTx(frame, DEAUTH_FRAME_SIZE);
+}
+
 // ============================================================================
 // BSSID Key Conversion Tests
 // ============================================================================
@@ -166,6 +193,32 @@ void test_isMulticastMAC_broadcast(void) {
     TEST_ASSERT_TRUE(isMulticastMAC(mac));
 }
 
+void test_randomizeMAC_isLocalUnicast(void) {
+    for (int i = 0; i < 32; i++) {
+        uint8_t mac[6];
+        WSLBypasser::randomizeMAC();
+        esp_wifi_get_mac(WIFI_IF_STA, mac);
+        TEST_ASSERT_TRUE(isValidLocalMAC(mac));
+    }
+}
+
+void test_randomizeMAC_changesAddress(void) {
+    uint8_t before[6], after[6];
+    WSLBypasser::randomizeMAC();
+    esp_wifi_get_mac(WIFI_IF_STA, before);
+    WSLBypasser::randomizeMAC();
+    esp_wifi_get_mac(WIFI_IF_STA, after);
+    TEST_ASSERT_FALSE(memcmp(before, after, 6) == 0);
+}
+
+void test_deauthFrame_tunesChannel(void) {
+    uint8_t bssid[6] = {0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF};
+    uint8_t station[6] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66};
+    WSLBypasser::sendDeauthFrame(bssid, 11, station, 7);
+    TEST_ASSERT_EQUAL_UINT8(11, HostHal::getChannel());
+    TEST_ASSERT_EQUAL_UINT32(1, HostHal::getTxStats().deauths);
+}
+
 // ============================================================================
 // MAC Formatting Tests
 // ============================================================================
@@ -272,88 +325,118 @@ void test_parseMAC_formatMAC_roundTrip(void) {
 }
 
 // ============================================================================
-// PCAP Header Tests
+// PCAP Tests
+// Files written by OinkMode::writePCAPHeader/writePCAPPacket (also used by
+// DO NO HAM) on the host SD, read back raw and through the replay reader
 // ============================================================================
 
-void test_PCAPHeader_size(void) {
-    TEST_ASSERT_EQUAL_UINT(24, sizeof(TestPCAPHeader));
+static char sdRoot[64];
+
+static std::vector<uint8_t> readHostFile(const char* sdPath) {
+    std::vector<uint8_t> out;
+    FILE* f = fopen((std::string(sdRoot) + sdPath).c_str(), "rb");
+    if (!f) return out;
+    uint8_t tmp[256];
+    size_t n;
+    while ((n = fread(tmp, 1, sizeof(tmp), f)) > 0) out.insert(out.end(), tmp, tmp + n);
+    fclose(f);
+    return out;
 }
 
-void test_PCAPPacketHeader_size(void) {
-    TEST_ASSERT_EQUAL_UINT(16, sizeof(TestPCAPPacketHeader));
+static uint32_t le32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
 }
 
-void test_initPCAPHeader_magic(void) {
-    TestPCAPHeader hdr;
-    initPCAPHeader(&hdr);
-    TEST_ASSERT_EQUAL_UINT32(0xA1B2C3D4, hdr.magic);
+static std::vector<uint8_t> writeTestPcap(const uint8_t* frame, uint16_t len, uint32_t tsMs) {
+    File f = SD.open("/test.pcap", FILE_WRITE);
+    TEST_ASSERT_TRUE((bool)f);
+    OinkMode::writePCAPHeader(f);
+    if (frame) OinkMode::writePCAPPacket(f, frame, len, tsMs);
+    f.close();
+    return readHostFile("/test.pcap");
 }
 
-void test_initPCAPHeader_version(void) {
-    TestPCAPHeader hdr;
-    initPCAPHeader(&hdr);
-    TEST_ASSERT_EQUAL_UINT16(2, hdr.version_major);
-    TEST_ASSERT_EQUAL_UINT16(4, hdr.version_minor);
+static const uint8_t TEST_BEACON[] = {
+    0x80, 0x00, 0x00, 0x00,                          // Beacon
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,              // DA
+    0x64, 0xEE, 0xB7, 0x20, 0x82, 0x86,              // SA
+    0x64, 0xEE, 0xB7, 0x20, 0x82, 0x86,              // BSSID
+    0x10, 0x00,
+    0, 0, 0, 0, 0, 0, 0, 0, 0x64, 0x00, 0x11, 0x04,  // Timestamp, interval, caps
+    0x00, 0x04, 'P', 'I', 'G', 'S'                   // SSID
+};
+
+void test_PCAPHeader_size(void) {
+    std::vector<uint8_t> b = writeTestPcap(nullptr, 0, 0);
+    TEST_ASSERT_EQUAL_UINT(24, b.size());
+}
+
+void test_PCAPHeader_magic(void) {
+    std::vector<uint8_t> b = writeTestPcap(nullptr, 0, 0);
+    TEST_ASSERT_EQUAL_HEX32(0xA1B2C3D4, le32(&b[0]));  // Microseconds, little endian
 }
 
-void test_initPCAPHeader_linktype(void) {
-    TestPCAPHeader hdr;
-    initPCAPHeader(&hdr);
-    TEST_ASSERT_EQUAL_UINT32(105, hdr.linktype);  // IEEE802.11
+void test_PCAPHeader_version(void) {
+    std::vector<uint8_t> b = writeTestPcap(nullptr, 0, 0);
+    TEST_ASSERT_EQUAL_UINT16(2, b[4] | (b[5] << 8));
+    TEST_ASSERT_EQUAL_UINT16(4, b[6] | (b[7] << 8));
 }
 
-void test_initPCAPHeader_snaplen(void) {
-    TestPCAPHeader hdr;
-    initPCAPHeader(&hdr);
-    TEST_ASSERT_EQUAL_UINT32(65535, hdr.snaplen);
+void test_PCAPHeader_linktype(void) {
+    std::vector<uint8_t> b = writeTestPcap(nullptr, 0, 0);
+    TEST_ASSERT_EQUAL_UINT32(127, le32(&b[20]));  // IEEE802_11_RADIOTAP (WPA-SEC needs it)
 }
 
-void test_isValidPCAPHeader_valid(void) {
-    TestPCAPHeader hdr;
-    initPCAPHeader(&hdr);
-    TEST_ASSERT_TRUE(isValidPCAPHeader(&hdr));
+void test_PCAPHeader_snaplen(void) {
+    std::vector<uint8_t> b = writeTestPcap(nullptr, 0, 0);
+    TEST_ASSERT_EQUAL_UINT32(65535, le32(&b[16]));
 }
 
-void test_isValidPCAPHeader_bigEndian(void) {
-    TestPCAPHeader hdr;
-    initPCAPHeader(&hdr);
-    hdr.magic = PCAP_MAGIC_BE;
-    TEST_ASSERT_TRUE(isValidPCAPHeader(&hdr));
+void test_PCAPPacket_size(void) {
+    std::vector<uint8_t> b = writeTestPcap(TEST_BEACON, sizeof(TEST_BEACON), 1000);
+    // Global header, record header, 8-byte radiotap, frame
+    TEST_ASSERT_EQUAL_UINT(24 + 16 + 8 + sizeof(TEST_BEACON), b.size());
 }
 
-void test_isValidPCAPHeader_invalidMagic(void) {
-    TestPCAPHeader hdr;
-    initPCAPHeader(&hdr);
-    hdr.magic = 0x12345678;
-    TEST_ASSERT_FALSE(isValidPCAPHeader(&hdr));
+void test_PCAPPacket_timestamp(void) {
+    std::vector<uint8_t> b = writeTestPcap(TEST_BEACON, sizeof(TEST_BEACON), 5500);  // 5.5 seconds
+    TEST_ASSERT_EQUAL_UINT32(5, le32(&b[24]));
+    TEST_ASSERT_EQUAL_UINT32(500000, le32(&b[28]));  // 500ms = 500000 usec
 }
 
-void test_isValidPCAPHeader_wrongVersion(void) {
-    TestPCAPHeader hdr;
-    initPCAPHeader(&hdr);
-    hdr.version_major = 3;
-    TEST_ASSERT_FALSE(isValidPCAPHeader(&hdr));
+void test_PCAPPacket_zeroTimestamp(void) {
+    std::vector<uint8_t> b = writeTestPcap(TEST_BEACON, sizeof(TEST_BEACON), 0);
+    TEST_ASSERT_EQUAL_UINT32(0, le32(&b[24]));
+    TEST_ASSERT_EQUAL_UINT32(0, le32(&b[28]));
 }
 
-void test_initPCAPPacketHeader_timestamp(void) {
-    TestPCAPPacketHeader pkt;
-    initPCAPPacketHeader(&pkt, 5500, 100);  // 5.5 seconds, 100 bytes
-    TEST_ASSERT_EQUAL_UINT32(5, pkt.ts_sec);
-    TEST_ASSERT_EQUAL_UINT32(500000, pkt.ts_usec);  // 500ms = 500000 usec
+void test_PCAPPacket_length_includes_radiotap(void) {
+    std::vector<uint8_t> b = writeTestPcap(TEST_BEACON, sizeof(TEST_BEACON), 1000);
+    TEST_ASSERT_EQUAL_UINT32(8 + sizeof(TEST_BEACON), le32(&b[32]));  // incl_len
+    TEST_ASSERT_EQUAL_UINT32(8 + sizeof(TEST_BEACON), le32(&b[36]));  // orig_len
 }
 
-void test_initPCAPPacketHeader_length(void) {
-    TestPCAPPacketHeader pkt;
-    initPCAPPacketHeader(&pkt, 1000, 256);
-    TEST_ASSERT_EQUAL_UINT32(256, pkt.incl_len);
-    TEST_ASSERT_EQUAL_UINT32(256, pkt.orig_len);
+void test_PCAPPacket_radiotap_then_frame(void) {
+    std::vector<uint8_t> b = writeTestPcap(TEST_BEACON, sizeof(TEST_BEACON), 1000);
+    TEST_ASSERT_EQUAL_HEX8(0x00, b[40]);       // Radiotap revision
+    TEST_ASSERT_EQUAL_UINT16(8, b[42] | (b[43] << 8));
+    TEST_ASSERT_EQUAL_UINT32(0, le32(&b[44])); // No optional fields
+    TEST_ASSERT_EQUAL_MEMORY(TEST_BEACON, &b[48], sizeof(TEST_BEACON));
 }
 
-void test_initPCAPPacketHeader_zeroTimestamp(void) {
-    TestPCAPPacketHeader pkt;
-    initPCAPPacketHeader(&pkt, 0, 50);
-    TEST_ASSERT_EQUAL_UINT32(0, pkt.ts_sec);
-    TEST_ASSERT_EQUAL_UINT32(0, pkt.ts_usec);
+void test_PCAP_reader_accepts_file(void) {
+    writeTestPcap(TEST_BEACON, sizeof(TEST_BEACON), 5500);
+    Pcap::Reader reader;
+    TEST_ASSERT_TRUE(reader.open((std::string(sdRoot) + "/test.pcap").c_str()));
+    TEST_ASSERT_FALSE(reader.isPcapng());
+    TEST_ASSERT_EQUAL_UINT32(Pcap::kLinkRadiotap, reader.linkType());
+    Pcap::Frame fr;
+    TEST_ASSERT_TRUE(reader.next(fr));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(TEST_BEACON), fr.len);
+    TEST_ASSERT_EQUAL_MEMORY(TEST_BEACON, fr.data, sizeof(TEST_BEACON));
+    TEST_ASSERT_EQUAL_UINT64(5500000ULL, fr.tsUs);
+    TEST_ASSERT_FALSE(reader.next(fr));
+    TEST_ASSERT_EQUAL_UINT32(0, reader.stats().malformed);
 }
 
 // ============================================================================
@@ -506,6 +589,10 @@ void test_buildDeauthFrame_broadcast(void) {
 // ============================================================================
 
 int main(int argc, char **argv) {
+    strcpy(sdRoot, "/tmp/mac_utils_sd_XXXXXX");
+    if (!mkdtemp(sdRoot)) return 1;
+    HostHal::mountSD(sdRoot);
+
     UNITY_BEGIN();
     
     // BSSID Key Conversion
@@ -533,6 +620,8 @@ int main(int argc, char **argv) {
     RUN_TEST(test_isMulticastMAC_multicast);
     RUN_TEST(test_isMulticastMAC_unicast);
     RUN_TEST(test_isMulticastMAC_broadcast);
+    RUN_TEST(test_randomizeMAC_isLocalUnicast);
+    RUN_TEST(test_randomizeMAC_changesAddress);
     
     // MAC Formatting
     RUN_TEST(test_formatMAC_typical);
@@ -550,20 +639,18 @@ int main(int argc, char **argv) {
     RUN_TEST(test_parseMAC_nullOutput);
     RUN_TEST(test_parseMAC_formatMAC_roundTrip);
     
-    // PCAP Headers
+    // PCAP Files
     RUN_TEST(test_PCAPHeader_size);
-    RUN_TEST(test_PCAPPacketHeader_size);
-    RUN_TEST(test_initPCAPHeader_magic);
-    RUN_TEST(test_initPCAPHeader_version);
-    RUN_TEST(test_initPCAPHeader_linktype);
-    RUN_TEST(test_initPCAPHeader_snaplen);
-    RUN_TEST(test_isValidPCAPHeader_valid);
-    RUN_TEST(test_isValidPCAPHeader_bigEndian);
-    RUN_TEST(test_isValidPCAPHeader_invalidMagic);
-    RUN_TEST(test_isValidPCAPHeader_wrongVersion);
-    RUN_TEST(test_initPCAPPacketHeader_timestamp);
-    RUN_TEST(test_initPCAPPacketHeader_length);
-    RUN_TEST(test_initPCAPPacketHeader_zeroTimestamp);
+    RUN_TEST(test_PCAPHeader_magic);
+    RUN_TEST(test_PCAPHeader_version);
+    RUN_TEST(test_PCAPHeader_linktype);
+    RUN_TEST(test_PCAPHeader_snaplen);
+    RUN_TEST(test_PCAPPacket_size);
+    RUN_TEST(test_PCAPPacket_timestamp);
+    RUN_TEST(test_PCAPPacket_zeroTimestamp);
+    RUN_TEST(test_PCAPPacket_length_includes_radiotap);
+    RUN_TEST(test_PCAPPacket_radiotap_then_frame);
+    RUN_TEST(test_PCAP_reader_accepts_file);
     
     // Deauth Frame Construction
     RUN_TEST(test_deauthFrame_size);
@@ -582,6 +669,10 @@ int main(int argc, char **argv) {
     RUN_TEST(test_isValidDisassocFrame_valid);
     RUN_TEST(test_isValidDisassocFrame_wrongType);
     RUN_TEST(test_buildDeauthFrame_broadcast);
+    RUN_TEST(test_deauthFrame_tunesChannel);
     
-    return UNITY_END();
+    int rc = UNITY_END();
+    std::string cmd = std::string("rm -rf ") + sdRoot;
+    (void)system(cmd.c_str());
+    return rc;
 }
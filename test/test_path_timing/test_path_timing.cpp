@@ -0,0 +1,158 @@
+// PathTiming Tests
+// Half-octave histogram math, summaries and drop counters for the
+// promiscuous callback instrumentation. Host ticks are nanoseconds.
+
+#include <unity.h>
+#include "../../src/core/path_timing.h"
+
+using PathTiming::Path;
+using PathTiming::Drop;
+
+void setUp(void) {
+    PathTiming::reset();
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Bucket math
+// ============================================================================
+
+void test_bucketFor_small_values(void) {
+    TEST_ASSERT_EQUAL_UINT8(0, PathTiming::bucketFor(0));
+    TEST_ASSERT_EQUAL_UINT8(1, PathTiming::bucketFor(1));
+    TEST_ASSERT_EQUAL_UINT8(2, PathTiming::bucketFor(2));
+    TEST_ASSERT_EQUAL_UINT8(3, PathTiming::bucketFor(3));
+    TEST_ASSERT_EQUAL_UINT8(4, PathTiming::bucketFor(4));
+    TEST_ASSERT_EQUAL_UINT8(4, PathTiming::bucketFor(5));
+    TEST_ASSERT_EQUAL_UINT8(5, PathTiming::bucketFor(6));
+    TEST_ASSERT_EQUAL_UINT8(5, PathTiming::bucketFor(7));
+}
+
+void test_bucketFor_max_fits(void) {
+    TEST_ASSERT_EQUAL_UINT8(PathTiming::kBuckets - 1, PathTiming::bucketFor(UINT32_MAX));
+}
+
+void test_bucketLower_inverts_bucketFor(void) {
+    for (uint8_t i = 0; i < PathTiming::kBuckets; i++) {
+        uint32_t lo = PathTiming::bucketLower(i);
+        TEST_ASSERT_EQUAL_UINT8(i, PathTiming::bucketFor(lo));
+        if (i > 0) {
+            TEST_ASSERT_EQUAL_UINT8(i - 1, PathTiming::bucketFor(lo - 1));
+        }
+    }
+}
+
+void test_bucket_width_is_half_octave(void) {
+    // [1024, 1536) and [1536, 2048)
+    TEST_ASSERT_EQUAL_UINT8(PathTiming::bucketFor(1024), PathTiming::bucketFor(1535));
+    TEST_ASSERT_EQUAL_UINT8(PathTiming::bucketFor(1024) + 1, PathTiming::bucketFor(1536));
+    TEST_ASSERT_EQUAL_UINT8(PathTiming::bucketFor(1536), PathTiming::bucketFor(2047));
+}
+
+// ============================================================================
+// Summaries
+// ============================================================================
+
+void test_summarize_empty_path(void) {
+    PathTiming::Summary s = PathTiming::summarize(Path::OinkData);
+    TEST_ASSERT_EQUAL_UINT32(0, s.count);
+    TEST_ASSERT_EQUAL_UINT32(0, s.maxNs);
+}
+
+void test_summarize_min_avg_max(void) {
+    PathTiming::record(Path::OinkMgmt, 100);
+    PathTiming::record(Path::OinkMgmt, 300);
+    PathTiming::record(Path::OinkMgmt, 800);
+    PathTiming::Summary s = PathTiming::summarize(Path::OinkMgmt);
+    TEST_ASSERT_EQUAL_UINT32(3, s.count);
+    TEST_ASSERT_EQUAL_UINT32(100, s.minNs);
+    TEST_ASSERT_EQUAL_UINT32(400, s.avgNs);
+    TEST_ASSERT_EQUAL_UINT32(800, s.maxNs);
+}
+
+void test_summarize_p99_ignores_outlier_tail(void) {
+    for (int i = 0; i < 999; i++) PathTiming::record(Path::ReconMgmt, 200);
+    PathTiming::record(Path::ReconMgmt, 1000000);
+    PathTiming::Summary s = PathTiming::summarize(Path::ReconMgmt);
+    // 200 lands in [192, 256): p99 reports the bucket's upper edge
+    TEST_ASSERT_EQUAL_UINT32(255, s.p99Ns);
+    TEST_ASSERT_EQUAL_UINT32(1000000, s.maxNs);
+}
+
+void test_summarize_p99_clamped_to_max(void) {
+    PathTiming::record(Path::DnhEapol, 1100);
+    PathTiming::Summary s = PathTiming::summarize(Path::DnhEapol);
+    TEST_ASSERT_EQUAL_UINT32(1100, s.p99Ns);
+}
+
+void test_paths_are_independent(void) {
+    PathTiming::record(Path::DnhMgmt, 50);
+    TEST_ASSERT_EQUAL_UINT32(1, PathTiming::summarize(Path::DnhMgmt).count);
+    TEST_ASSERT_EQUAL_UINT32(0, PathTiming::summarize(Path::DnhData).count);
+}
+
+void test_getBuckets_counts_samples(void) {
+    PathTiming::record(Path::SpectrumMgmt, 5);
+    PathTiming::record(Path::SpectrumMgmt, 4);
+    PathTiming::record(Path::SpectrumMgmt, 7);
+    uint32_t b[PathTiming::kBuckets];
+    PathTiming::getBuckets(Path::SpectrumMgmt, b);
+    TEST_ASSERT_EQUAL_UINT32(2, b[4]);
+    TEST_ASSERT_EQUAL_UINT32(1, b[5]);
+}
+
+void test_scope_records_one_sample(void) {
+    {
+        PathTiming::Scope t(Path::SpectrumData);
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, PathTiming::summarize(Path::SpectrumData).count);
+}
+
+// ============================================================================
+// Drops / reset
+// ============================================================================
+
+void test_countDrop_and_reset(void) {
+    PathTiming::countDrop(Drop::OinkPendingHs);
+    PathTiming::countDrop(Drop::OinkPendingHs);
+    PathTiming::countDrop(Drop::DnhPendingPmkid);
+    PathTiming::record(Path::OinkEapol, 10);
+    TEST_ASSERT_EQUAL_UINT32(2, PathTiming::getDrops(Drop::OinkPendingHs));
+    TEST_ASSERT_EQUAL_UINT32(1, PathTiming::getDrops(Drop::DnhPendingPmkid));
+    PathTiming::reset();
+    TEST_ASSERT_EQUAL_UINT32(0, PathTiming::getDrops(Drop::OinkPendingHs));
+    TEST_ASSERT_EQUAL_UINT32(0, PathTiming::summarize(Path::OinkEapol).count);
+}
+
+void test_names_cover_every_entry(void) {
+    for (uint8_t i = 0; i < (uint8_t)Path::Count; i++) {
+        TEST_ASSERT_TRUE(PathTiming::pathName((Path)i)[0] != 0);
+    }
+    for (uint8_t i = 0; i < (uint8_t)Drop::Count; i++) {
+        TEST_ASSERT_TRUE(PathTiming::dropName((Drop)i)[0] != 0);
+    }
+    TEST_ASSERT_EQUAL_STRING("?", PathTiming::pathName(Path::Count));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_bucketFor_small_values);
+    RUN_TEST(test_bucketFor_max_fits);
+    RUN_TEST(test_bucketLower_inverts_bucketFor);
+    RUN_TEST(test_bucket_width_is_half_octave);
+
+    RUN_TEST(test_summarize_empty_path);
+    RUN_TEST(test_summarize_min_avg_max);
+    RUN_TEST(test_summarize_p99_ignores_outlier_tail);
+    RUN_TEST(test_summarize_p99_clamped_to_max);
+    RUN_TEST(test_paths_are_independent);
+    RUN_TEST(test_getBuckets_counts_samples);
+    RUN_TEST(test_scope_records_one_sample);
+
+    RUN_TEST(test_countDrop_and_reset);
+    RUN_TEST(test_names_cover_every_entry);
+
+    return UNITY_END();
+}
@@ -0,0 +1,334 @@
+// PCAP Reader Tests
+// pcap / pcapng / radiotap decoding used by the pcap_replay driver
+
+#include <unity.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "../../tools/pcap_replay/pcap_reader.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+static void put16(Bytes& b, uint16_t v, bool be = false) {
+    if (be) { b.push_back(v >> 8); b.push_back(v & 0xFF); }
+    else { b.push_back(v & 0xFF); b.push_back(v >> 8); }
+}
+
+static void put32(Bytes& b, uint32_t v, bool be = false) {
+    if (be) { put16(b, v >> 16, true); put16(b, v & 0xFFFF, true); }
+    else { put16(b, v & 0xFFFF); put16(b, v >> 16); }
+}
+
+static void append(Bytes& b, const Bytes& more) {
+    b.insert(b.end(), more.begin(), more.end());
+}
+
+// Minimal beacon header: FC, duration, DA, SA, BSSID, seq
+static Bytes beaconHeader(uint8_t tag) {
+    Bytes f = {0x80, 0x00, 0x00, 0x00};
+    for (int i = 0; i < 6; i++) f.push_back(0xFF);
+    for (int a = 0; a < 2; a++) for (int i = 0; i < 6; i++) f.push_back(0x10 + i + tag);
+    f.push_back(0x00);
+    f.push_back(0x00);
+    return f;
+}
+
+// Radiotap with Flags, Channel and dBm signal (the common monitor-mode trio)
+static Bytes radiotap(uint16_t freq, int8_t rssi, bool fcs) {
+    Bytes r = {0x00, 0x00, 0x00, 0x00};
+    put32(r, (1u << 1) | (1u << 3) | (1u << 5));
+    r.push_back(fcs ? 0x10 : 0x00);  // Flags @8
+    r.push_back(0x00);               // Pad to 2-byte alignment
+    put16(r, freq);                  // Channel @10
+    put16(r, 0x00A0);
+    r.push_back((uint8_t)rssi);      // dBm signal @14
+    r[2] = (uint8_t)r.size();
+    return r;
+}
+
+static Bytes classicPcap(uint32_t linkType, const std::vector<Bytes>& pkts, bool be = false, bool nanos = false) {
+    Bytes b;
+    put32(b, nanos ? 0xA1B23C4D : 0xA1B2C3D4, be);
+    put16(b, 2, be);
+    put16(b, 4, be);
+    put32(b, 0, be);
+    put32(b, 0, be);
+    put32(b, 65535, be);
+    put32(b, linkType, be);
+    uint32_t sec = 1700000000;
+    for (size_t i = 0; i < pkts.size(); i++) {
+        put32(b, sec, be);
+        put32(b, (uint32_t)(nanos ? i * 250000000ULL : i * 250000ULL), be);
+        put32(b, (uint32_t)pkts[i].size(), be);
+        put32(b, (uint32_t)pkts[i].size(), be);
+        append(b, pkts[i]);
+    }
+    return b;
+}
+
+static void ngBlock(Bytes& out, uint32_t type, Bytes body) {
+    while (body.size() % 4) body.push_back(0);
+    uint32_t len = (uint32_t)body.size() + 12;
+    put32(out, type);
+    put32(out, len);
+    append(out, body);
+    put32(out, len);
+}
+
+static Bytes ngSectionHeader() {
+    Bytes shb;
+    put32(shb, 0x1A2B3C4D);
+    put16(shb, 1);
+    put16(shb, 0);
+    put32(shb, 0xFFFFFFFF);
+    put32(shb, 0xFFFFFFFF);
+    return shb;
+}
+
+static Bytes ngInterface(uint16_t linkType, int tsresol) {
+    Bytes idb;
+    put16(idb, linkType);
+    put16(idb, 0);
+    put32(idb, 65535);
+    if (tsresol >= 0) {
+        put16(idb, 9);
+        put16(idb, 1);
+        idb.push_back((uint8_t)tsresol);
+        idb.push_back(0); idb.push_back(0); idb.push_back(0);
+        put16(idb, 0);
+        put16(idb, 0);
+    }
+    return idb;
+}
+
+static Bytes ngEnhancedPacket(uint32_t iface, uint64_t ts, const Bytes& pkt) {
+    Bytes epb;
+    put32(epb, iface);
+    put32(epb, (uint32_t)(ts >> 32));
+    put32(epb, (uint32_t)ts);
+    put32(epb, (uint32_t)pkt.size());
+    put32(epb, (uint32_t)pkt.size());
+    append(epb, pkt);
+    return epb;
+}
+
+static FILE* asFile(const Bytes& b) {
+    FILE* f = tmpfile();
+    fwrite(b.data(), 1, b.size(), f);
+    rewind(f);
+    return f;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ============================================================================
+// Radiotap
+// ============================================================================
+
+void test_radiotap_extracts_rssi_channel_and_strips_fcs(void) {
+    Bytes pkt = radiotap(2437, -47, true);
+    Bytes frame = beaconHeader(0);
+    append(pkt, frame);
+    pkt.push_back(0xDE); pkt.push_back(0xAD); pkt.push_back(0xBE); pkt.push_back(0xEF);
+
+    Pcap::Frame out = {};
+    TEST_ASSERT_TRUE(Pcap::parseRadiotap(pkt.data(), (uint32_t)pkt.size(), out));
+    TEST_ASSERT_EQUAL_UINT32(frame.size(), out.len);
+    TEST_ASSERT_EQUAL_UINT8(6, out.channel);
+    TEST_ASSERT_TRUE(out.hasRssi);
+    TEST_ASSERT_EQUAL_INT8(-47, out.rssi);
+    TEST_ASSERT_EQUAL_UINT8(0x80, out.data[0]);
+}
+
+void test_radiotap_honours_tsft_alignment_and_extended_bitmap(void) {
+    // present word 0: TSFT + dBm signal + ext bit; word 1: empty
+    Bytes r = {0x00, 0x00, 0x00, 0x00};
+    put32(r, (1u << 0) | (1u << 5) | 0x80000000u);
+    put32(r, 0);
+    // TSFT needs 8-byte alignment: pad from offset 12 to 16
+    for (int i = 0; i < 4; i++) r.push_back(0x00);
+    for (int i = 0; i < 8; i++) r.push_back(0x11);
+    r.push_back((uint8_t)-71);
+    r[2] = (uint8_t)r.size();
+    Bytes frame = beaconHeader(1);
+    append(r, frame);
+
+    Pcap::Frame out = {};
+    TEST_ASSERT_TRUE(Pcap::parseRadiotap(r.data(), (uint32_t)r.size(), out));
+    TEST_ASSERT_EQUAL_INT8(-71, out.rssi);
+    TEST_ASSERT_EQUAL_UINT8(0, out.channel);
+    TEST_ASSERT_EQUAL_UINT32(frame.size(), out.len);
+}
+
+void test_radiotap_rejects_truncated_header(void) {
+    Bytes r = radiotap(2412, -50, false);
+    Pcap::Frame out = {};
+    TEST_ASSERT_FALSE(Pcap::parseRadiotap(r.data(), 10, out));
+}
+
+void test_freq_to_channel(void) {
+    TEST_ASSERT_EQUAL_UINT8(1, Pcap::freqToChannel(2412));
+    TEST_ASSERT_EQUAL_UINT8(13, Pcap::freqToChannel(2472));
+    TEST_ASSERT_EQUAL_UINT8(14, Pcap::freqToChannel(2484));
+    TEST_ASSERT_EQUAL_UINT8(36, Pcap::freqToChannel(5180));
+    TEST_ASSERT_EQUAL_UINT8(0, Pcap::freqToChannel(900));
+}
+
+// ============================================================================
+// Classic pcap
+// ============================================================================
+
+void test_classic_radiotap_capture(void) {
+    std::vector<Bytes> pkts;
+    for (uint8_t i = 0; i < 3; i++) {
+        Bytes p = radiotap(2412 + 5 * i, (int8_t)(-40 - i), false);
+        append(p, beaconHeader(i));
+        pkts.push_back(p);
+    }
+    FILE* f = asFile(classicPcap(Pcap::kLinkRadiotap, pkts));
+    Pcap::Reader reader;
+    TEST_ASSERT_TRUE(reader.attach(f));
+    TEST_ASSERT_FALSE(reader.isPcapng());
+
+    Pcap::Frame frame;
+    for (uint8_t i = 0; i < 3; i++) {
+        TEST_ASSERT_TRUE(reader.next(frame));
+        TEST_ASSERT_EQUAL_UINT8(1 + i, frame.channel);
+        TEST_ASSERT_EQUAL_INT8(-40 - i, frame.rssi);
+        TEST_ASSERT_EQUAL_UINT8(0x10 + i, frame.data[10]);
+        TEST_ASSERT_EQUAL_UINT64(1700000000ULL * 1000000ULL + i * 250000ULL, frame.tsUs);
+    }
+    TEST_ASSERT_FALSE(reader.next(frame));
+    TEST_ASSERT_EQUAL_UINT32(3, reader.stats().frames);
+    fclose(f);
+}
+
+void test_classic_big_endian_nanosecond_raw_80211(void) {
+    std::vector<Bytes> pkts = {beaconHeader(0), beaconHeader(1)};
+    FILE* f = asFile(classicPcap(Pcap::kLinkIeee80211, pkts, true, true));
+    Pcap::Reader reader;
+    TEST_ASSERT_TRUE(reader.attach(f));
+    TEST_ASSERT_EQUAL_UINT32(Pcap::kLinkIeee80211, reader.linkType());
+
+    Pcap::Frame frame;
+    TEST_ASSERT_TRUE(reader.next(frame));
+    TEST_ASSERT_FALSE(frame.hasRssi);
+    TEST_ASSERT_EQUAL_UINT32(24, frame.len);
+    TEST_ASSERT_TRUE(reader.next(frame));
+    TEST_ASSERT_EQUAL_UINT64(1700000000ULL * 1000000ULL + 250000ULL, frame.tsUs);
+    fclose(f);
+}
+
+void test_unsupported_linktype_skipped(void) {
+    std::vector<Bytes> pkts = {beaconHeader(0)};
+    FILE* f = asFile(classicPcap(1 /* Ethernet */, pkts));
+    Pcap::Reader reader;
+    TEST_ASSERT_TRUE(reader.attach(f));
+    Pcap::Frame frame;
+    TEST_ASSERT_FALSE(reader.next(frame));
+    TEST_ASSERT_EQUAL_UINT32(1, reader.stats().skippedLink);
+    fclose(f);
+}
+
+void test_bad_magic_rejected(void) {
+    Bytes junk = {'G', 'I', 'F', '8', '9', 'a', 0, 0};
+    FILE* f = asFile(junk);
+    Pcap::Reader reader;
+    TEST_ASSERT_FALSE(reader.attach(f));
+    fclose(f);
+}
+
+void test_truncated_record_ends_stream(void) {
+    std::vector<Bytes> pkts = {beaconHeader(0), beaconHeader(1)};
+    Bytes b = classicPcap(Pcap::kLinkIeee80211, pkts);
+    b.resize(b.size() - 5);
+    FILE* f = asFile(b);
+    Pcap::Reader reader;
+    TEST_ASSERT_TRUE(reader.attach(f));
+    Pcap::Frame frame;
+    TEST_ASSERT_TRUE(reader.next(frame));
+    TEST_ASSERT_FALSE(reader.next(frame));
+    fclose(f);
+}
+
+// ============================================================================
+// pcapng
+// ============================================================================
+
+void test_pcapng_enhanced_packets_with_tsresol(void) {
+    Bytes b;
+    ngBlock(b, 0x0A0D0D0A, ngSectionHeader());
+    ngBlock(b, 0x00000001, ngInterface(Pcap::kLinkRadiotap, 9));  // Nanoseconds
+    Bytes pkt = radiotap(2462, -63, true);
+    append(pkt, beaconHeader(2));
+    for (int i = 0; i < 4; i++) pkt.push_back(0xAA);
+    ngBlock(b, 0x00000005, Bytes(16, 0));  // Interface statistics - skipped
+    ngBlock(b, 0x00000006, ngEnhancedPacket(0, 1700000000123456789ULL, pkt));
+
+    FILE* f = asFile(b);
+    Pcap::Reader reader;
+    TEST_ASSERT_TRUE(reader.attach(f));
+    TEST_ASSERT_TRUE(reader.isPcapng());
+
+    Pcap::Frame frame;
+    TEST_ASSERT_TRUE(reader.next(frame));
+    TEST_ASSERT_EQUAL_UINT32(Pcap::kLinkRadiotap, reader.linkType());
+    TEST_ASSERT_EQUAL_UINT8(11, frame.channel);
+    TEST_ASSERT_EQUAL_INT8(-63, frame.rssi);
+    TEST_ASSERT_EQUAL_UINT32(24, frame.len);
+    TEST_ASSERT_EQUAL_UINT64(1700000000123456ULL, frame.tsUs);
+    TEST_ASSERT_FALSE(reader.next(frame));
+    fclose(f);
+}
+
+void test_pcapng_multiple_interfaces_and_sections(void) {
+    Bytes b;
+    ngBlock(b, 0x0A0D0D0A, ngSectionHeader());
+    ngBlock(b, 0x00000001, ngInterface(1, -1));                    // Ethernet
+    ngBlock(b, 0x00000001, ngInterface(Pcap::kLinkIeee80211, -1)); // 802.11, usec
+    ngBlock(b, 0x00000006, ngEnhancedPacket(0, 5, Bytes(60, 0)));  // Skipped
+    ngBlock(b, 0x00000006, ngEnhancedPacket(1, 1000, beaconHeader(0)));
+    // Second section resets interface numbering
+    ngBlock(b, 0x0A0D0D0A, ngSectionHeader());
+    ngBlock(b, 0x00000001, ngInterface(Pcap::kLinkIeee80211, -1));
+    ngBlock(b, 0x00000006, ngEnhancedPacket(0, 2000, beaconHeader(1)));
+
+    FILE* f = asFile(b);
+    Pcap::Reader reader;
+    TEST_ASSERT_TRUE(reader.attach(f));
+    Pcap::Frame frame;
+    TEST_ASSERT_TRUE(reader.next(frame));
+    TEST_ASSERT_EQUAL_UINT64(1000, frame.tsUs);
+    TEST_ASSERT_EQUAL_UINT8(0x10, frame.data[10]);
+    TEST_ASSERT_TRUE(reader.next(frame));
+    TEST_ASSERT_EQUAL_UINT64(2000, frame.tsUs);
+    TEST_ASSERT_EQUAL_UINT8(0x11, frame.data[10]);
+    TEST_ASSERT_FALSE(reader.next(frame));
+    TEST_ASSERT_EQUAL_UINT32(1, reader.stats().skippedLink);
+    fclose(f);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_radiotap_extracts_rssi_channel_and_strips_fcs);
+    RUN_TEST(test_radiotap_honours_tsft_alignment_and_extended_bitmap);
+    RUN_TEST(test_radiotap_rejects_truncated_header);
+    RUN_TEST(test_freq_to_channel);
+
+    RUN_TEST(test_classic_radiotap_capture);
+    RUN_TEST(test_classic_big_endian_nanosecond_raw_80211);
+    RUN_TEST(test_unsupported_linktype_skipped);
+    RUN_TEST(test_bad_magic_rejected);
+    RUN_TEST(test_truncated_record_ends_stream);
+
+    RUN_TEST(test_pcapng_enhanced_packets_with_tsresol);
+    RUN_TEST(test_pcapng_multiple_interfaces_and_sections);
+
+    return UNITY_END();
+}
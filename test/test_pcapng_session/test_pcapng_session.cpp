@@ -0,0 +1,273 @@
+// PcapngSession Tests
+// Session file lifecycle, size/time flush budgets and a round trip through
+// the pcap_replay reader. SD is a temp directory via the host HAL.
+
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <host_hal.h>
+#include "../../src/core/pcapng_session.h"
+#include "../../tools/pcap_replay/pcap_reader.h"
+
+static char sdRoot[64];
+
+static std::string hostPath(const char* sdPath) {
+    return std::string(sdRoot) + sdPath;
+}
+
+static int countSessionFiles() {
+    int n = 0;
+    DIR* d = opendir(hostPath("/handshakes").c_str());
+    if (!d) return 0;
+    while (dirent* e = readdir(d)) {
+        if (strstr(e->d_name, ".pcapng")) n++;
+    }
+    closedir(d);
+    return n;
+}
+
+static std::vector<uint8_t> readAll(const char* sdPath) {
+    std::vector<uint8_t> out;
+    FILE* f = fopen(hostPath(sdPath).c_str(), "rb");
+    if (!f) return out;
+    uint8_t tmp[512];
+    size_t n;
+    while ((n = fread(tmp, 1, sizeof(tmp), f)) > 0) out.insert(out.end(), tmp, tmp + n);
+    fclose(f);
+    return out;
+}
+
+// Data frame with a recognisable body
+static std::vector<uint8_t> dataFrame(uint16_t len, uint8_t seed) {
+    std::vector<uint8_t> f(len);
+    f[0] = 0x08;
+    f[1] = 0x02;
+    for (uint16_t i = 2; i < len; i++) f[i] = (uint8_t)(seed + i);
+    return f;
+}
+
+void setUp(void) {
+    strcpy(sdRoot, "/tmp/pcapng_sd_XXXXXX");
+    TEST_ASSERT_NOT_NULL(mkdtemp(sdRoot));
+    HostHal::mountSD(sdRoot);
+    HostHal::setMillis(1000);
+}
+
+void tearDown(void) {
+    HostHal::setSdWriteBudget(-1);
+    PcapngSession::end();
+    std::string cmd = std::string("rm -rf ") + sdRoot;
+    (void)system(cmd.c_str());
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void test_empty_session_leaves_no_file(void) {
+    TEST_ASSERT_TRUE(PcapngSession::begin("oink"));
+    TEST_ASSERT_TRUE(PcapngSession::isActive());
+    PcapngSession::end();
+    TEST_ASSERT_FALSE(PcapngSession::isActive());
+    TEST_ASSERT_EQUAL_INT(0, countSessionFiles());
+}
+
+void test_append_without_session_fails(void) {
+    std::vector<uint8_t> f = dataFrame(40, 1);
+    TEST_ASSERT_FALSE(PcapngSession::appendFrame(f.data(), f.size(), 0, -50, nullptr));
+}
+
+void test_append_is_buffered_until_flush(void) {
+    PcapngSession::begin("oink");
+    std::vector<uint8_t> f = dataFrame(120, 2);
+    TEST_ASSERT_TRUE(PcapngSession::appendFrame(f.data(), f.size(), 900, -40, "M1"));
+    TEST_ASSERT_EQUAL_STRING("", PcapngSession::path());
+    TEST_ASSERT_EQUAL_UINT32(0, PcapngSession::getStats().writes);
+    TEST_ASSERT_TRUE(PcapngSession::getStats().buffered > 0);
+    TEST_ASSERT_TRUE(PcapngSession::flush());
+    TEST_ASSERT_EQUAL_INT(1, countSessionFiles());
+    TEST_ASSERT_EQUAL_UINT32(1, PcapngSession::getStats().writes);
+    TEST_ASSERT_EQUAL_UINT16(0, PcapngSession::getStats().buffered);
+}
+
+// ============================================================================
+// Flush budgets
+// ============================================================================
+
+void test_flush_due_on_time_budget(void) {
+    PcapngSession::begin("dnh");
+    TEST_ASSERT_FALSE(PcapngSession::flushDue());
+    std::vector<uint8_t> f = dataFrame(60, 3);
+    PcapngSession::appendFrame(f.data(), f.size(), 1000, -70, nullptr);
+    TEST_ASSERT_FALSE(PcapngSession::flushDue());
+    HostHal::advanceMillis(PcapngSession::kFlushIntervalMs);
+    TEST_ASSERT_TRUE(PcapngSession::flushDue());
+    PcapngSession::flush();
+    TEST_ASSERT_FALSE(PcapngSession::flushDue());
+}
+
+void test_flush_due_on_size_budget(void) {
+    PcapngSession::begin("oink");
+    std::vector<uint8_t> f = dataFrame(300, 4);
+    while (PcapngSession::getStats().buffered < PcapngSession::kFlushBytes) {
+        TEST_ASSERT_FALSE(PcapngSession::flushDue());
+        PcapngSession::appendFrame(f.data(), f.size(), 1000, -60, nullptr);
+    }
+    TEST_ASSERT_TRUE(PcapngSession::flushDue());
+}
+
+void test_overflow_writes_whole_sectors(void) {
+    PcapngSession::begin("oink");
+    std::vector<uint8_t> f = dataFrame(300, 5);
+    for (int i = 0; i < 40; i++) {
+        TEST_ASSERT_TRUE(PcapngSession::appendFrame(f.data(), f.size(), 1000 + i, -55, nullptr));
+    }
+    PcapngSession::Stats s = PcapngSession::getStats();
+    TEST_ASSERT_TRUE(s.writes > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, s.bytesWritten % PcapngSession::kSectorBytes);
+    TEST_ASSERT_EQUAL_UINT32(0, s.dropped);
+}
+
+void test_short_write_moves_to_new_file(void) {
+    PcapngSession::begin("oink");
+    std::vector<uint8_t> f = dataFrame(300, 7);
+    for (int i = 0; i < 4; i++) PcapngSession::appendFrame(f.data(), f.size(), 1000 + i, -50, nullptr);
+    TEST_ASSERT_TRUE(PcapngSession::flush());
+    std::string first = PcapngSession::path();
+
+    // Card fills mid-write: the two buffered packets are lost, part of one lands
+    HostHal::setSdWriteBudget(100);
+    PcapngSession::appendFrame(f.data(), f.size(), 2000, -50, nullptr);
+    PcapngSession::appendFrame(f.data(), f.size(), 2001, -50, nullptr);
+    TEST_ASSERT_FALSE(PcapngSession::flush());
+    TEST_ASSERT_EQUAL_UINT32(2, PcapngSession::getStats().dropped);
+
+    HostHal::setSdWriteBudget(-1);
+    for (int i = 0; i < 3; i++) PcapngSession::appendFrame(f.data(), f.size(), 3000 + i, -50, nullptr);
+    TEST_ASSERT_TRUE(PcapngSession::flush());
+    std::string second = PcapngSession::path();
+    PcapngSession::end();
+    TEST_ASSERT_TRUE(first != second);
+    TEST_ASSERT_EQUAL_INT(2, countSessionFiles());
+
+    // Torn file keeps what was whole; the new one starts with its own headers
+    Pcap::Reader r;
+    Pcap::Frame fr;
+    int n = 0;
+    TEST_ASSERT_TRUE(r.open(hostPath(first.c_str()).c_str()));
+    while (r.next(fr)) n++;
+    TEST_ASSERT_EQUAL_INT(4, n);
+    n = 0;
+    TEST_ASSERT_TRUE(r.open(hostPath(second.c_str()).c_str()));
+    while (r.next(fr)) n++;
+    TEST_ASSERT_EQUAL_INT(3, n);
+    TEST_ASSERT_EQUAL_UINT32(0, r.stats().malformed);
+}
+
+// ============================================================================
+// Round trip
+// ============================================================================
+
+void test_round_trip_through_reader(void) {
+    PcapngSession::begin("oink");
+    std::vector<uint8_t> a = dataFrame(131, 6);
+    std::vector<uint8_t> b = dataFrame(153, 7);
+    std::vector<uint8_t> beacon = dataFrame(90, 8);
+    beacon[0] = 0x80;
+    beacon[1] = 0x00;
+    PcapngSession::appendFrame(beacon.data(), beacon.size(), 500, 0, "beacon ssid=NET-01");
+    PcapngSession::appendFrame(a.data(), a.size(), 600, -48, "M1 rssi=-48 ssid=NET-01");
+    PcapngSession::appendFrame(b.data(), b.size(), 700, -52, "M2 rssi=-52 ssid=NET-01");
+    PcapngSession::flush();
+    std::string path = PcapngSession::path();
+    PcapngSession::end();
+
+    Pcap::Reader r;
+    TEST_ASSERT_TRUE(r.open(hostPath(path.c_str()).c_str()));
+    TEST_ASSERT_TRUE(r.isPcapng());
+
+    Pcap::Frame fr;
+    TEST_ASSERT_TRUE(r.next(fr));
+    TEST_ASSERT_EQUAL_UINT32(Pcap::kLinkRadiotap, r.linkType());
+    TEST_ASSERT_EQUAL_UINT32(beacon.size(), fr.len);
+    TEST_ASSERT_FALSE(fr.hasRssi);
+    TEST_ASSERT_EQUAL_MEMORY(beacon.data(), fr.data, beacon.size());
+    uint64_t beaconTs = fr.tsUs;
+
+    TEST_ASSERT_TRUE(r.next(fr));
+    TEST_ASSERT_EQUAL_UINT32(a.size(), fr.len);
+    TEST_ASSERT_TRUE(fr.hasRssi);
+    TEST_ASSERT_EQUAL_INT8(-48, fr.rssi);
+    TEST_ASSERT_EQUAL_MEMORY(a.data(), fr.data, a.size());
+    // 100ms apart in capture time (host wall clock adds a little jitter)
+    uint64_t gapUs = fr.tsUs - beaconTs;
+    TEST_ASSERT_TRUE(gapUs >= 100000ULL && gapUs < 150000ULL);
+
+    TEST_ASSERT_TRUE(r.next(fr));
+    TEST_ASSERT_EQUAL_INT8(-52, fr.rssi);
+    TEST_ASSERT_EQUAL_MEMORY(b.data(), fr.data, b.size());
+    TEST_ASSERT_FALSE(r.next(fr));
+    TEST_ASSERT_EQUAL_UINT32(0, r.stats().malformed);
+}
+
+void test_comments_and_interface_metadata_written(void) {
+    PcapngSession::begin("dnh");
+    std::vector<uint8_t> f = dataFrame(100, 9);
+    PcapngSession::appendFrame(f.data(), f.size(), 800, -61, "M2 rssi=-61 gps=51.500000,-0.120000");
+    PcapngSession::flush();
+    std::string path = PcapngSession::path();
+    PcapngSession::end();
+
+    std::vector<uint8_t> bytes = readAll(path.c_str());
+    std::string s(bytes.begin(), bytes.end());
+    TEST_ASSERT_TRUE(s.find("M2 rssi=-61 gps=51.500000,-0.120000") != std::string::npos);
+    TEST_ASSERT_TRUE(s.find("dnh promiscuous") != std::string::npos);
+    TEST_ASSERT_TRUE(s.find("M5PORKCHOP") != std::string::npos);
+    TEST_ASSERT_TRUE(path.find("_dnh") != std::string::npos);
+    // Every block length is a multiple of 4
+    TEST_ASSERT_EQUAL_UINT32(0, bytes.size() % 4);
+}
+
+void test_many_frames_across_sector_writes(void) {
+    PcapngSession::begin("oink");
+    for (int i = 0; i < 60; i++) {
+        std::vector<uint8_t> f = dataFrame(100 + i, (uint8_t)i);
+        PcapngSession::appendFrame(f.data(), f.size(), 1000 + i, -30 - i % 40, nullptr);
+    }
+    PcapngSession::flush();
+    std::string path = PcapngSession::path();
+    PcapngSession::end();
+
+    Pcap::Reader r;
+    TEST_ASSERT_TRUE(r.open(hostPath(path.c_str()).c_str()));
+    Pcap::Frame fr;
+    int n = 0;
+    while (r.next(fr)) {
+        TEST_ASSERT_EQUAL_UINT32(100 + n, fr.len);
+        n++;
+    }
+    TEST_ASSERT_EQUAL_INT(60, n);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty_session_leaves_no_file);
+    RUN_TEST(test_append_without_session_fails);
+    RUN_TEST(test_append_is_buffered_until_flush);
+
+    RUN_TEST(test_flush_due_on_time_budget);
+    RUN_TEST(test_flush_due_on_size_budget);
+    RUN_TEST(test_overflow_writes_whole_sectors);
+    RUN_TEST(test_short_write_moves_to_new_file);
+
+    RUN_TEST(test_round_trip_through_reader);
+    RUN_TEST(test_comments_and_interface_metadata_written);
+    RUN_TEST(test_many_frames_across_sector_writes);
+
+    return UNITY_END();
+}
@@ -0,0 +1,360 @@
+// Potfile Sync Tests
+// Incremental potfile download against a stand-in WPA-SEC server with and
+// without Range / ETag support: deltas, 304 / 416, prefix hashing, server
+// rewrites and the merged cracked index.
+
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <WiFi.h>
+#include <host_hal.h>
+#include "../../src/web/potfile_sync.h"
+#include "../../src/web/cracked_index.h"
+#include "../../src/web/sync_session.h"
+#include "../../src/core/config.h"
+#include "../../src/core/sd_layout.h"
+
+using PotfileSync::Outcome;
+using PotfileSync::Result;
+
+static char sdRoot[64];
+static char flashRoot[64];
+
+static const char* kHost = "wpa-sec.stanev.org";
+static const char* kPath = "/?api&dl=1";
+
+// Stand-in server
+static std::string serverPot;
+static bool serverRange;
+static bool serverEtag;
+static bool serverChunked;
+static uint32_t requests;
+static std::string lastRequest;
+
+static std::string hostPath(const char* sdPath) {
+    return std::string(sdRoot) + sdPath;
+}
+
+static std::string readHostFile(const char* sdPath) {
+    std::string out;
+    FILE* f = fopen(hostPath(sdPath).c_str(), "rb");
+    if (!f) return out;
+    char buf[512];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+    fclose(f);
+    return out;
+}
+
+static std::string etagOf(const std::string& body) {
+    char tag[24];
+    snprintf(tag, sizeof(tag), "\"%zu-%02x\"", body.size(),
+             body.empty() ? 0 : (unsigned char)body[body.size() - 2]);
+    return tag;
+}
+
+static std::string headerValue(const std::string& rq, const char* name) {
+    std::string key = std::string("\r\n") + name + ": ";
+    size_t at = rq.find(key);
+    if (at == std::string::npos) return "";
+    at += key.size();
+    return rq.substr(at, rq.find("\r\n", at) - at);
+}
+
+static void respond(HostHal::NetExchange& ex) {
+    requests++;
+    lastRequest = ex.request;
+    ex.keepOpen = true;
+    std::string etag = etagOf(serverPot);
+    std::string extra;
+    if (serverEtag) extra += "ETag: " + etag + "\r\n";
+
+    if (serverEtag && headerValue(ex.request, "If-None-Match") == etag) {
+        ex.response = "HTTP/1.1 304 Not Modified\r\n" + extra + "\r\n";
+        return;
+    }
+    std::string range = headerValue(ex.request, "Range");
+    if (serverRange && range.compare(0, 6, "bytes=") == 0) {
+        size_t first = strtoul(range.c_str() + 6, nullptr, 10);
+        char cr[64];
+        if (first >= serverPot.size()) {
+            snprintf(cr, sizeof(cr), "Content-Range: bytes */%zu\r\n", serverPot.size());
+            ex.response = "HTTP/1.1 416 Range Not Satisfiable\r\n" + extra + cr +
+                          "Content-Length: 0\r\n\r\n";
+            return;
+        }
+        std::string part = serverPot.substr(first);
+        snprintf(cr, sizeof(cr), "Content-Range: bytes %zu-%zu/%zu\r\nContent-Length: %zu\r\n",
+                 first, serverPot.size() - 1, serverPot.size(), part.size());
+        ex.response = "HTTP/1.1 206 Partial Content\r\n" + extra + cr + "\r\n" + part;
+        return;
+    }
+    if (serverChunked) {
+        ex.response = "HTTP/1.1 200 OK\r\n" + extra + "Transfer-Encoding: chunked\r\n\r\n";
+        for (size_t i = 0; i < serverPot.size(); i += 37) {
+            std::string piece = serverPot.substr(i, 37);
+            char len[16];
+            snprintf(len, sizeof(len), "%zx\r\n", piece.size());
+            ex.response += len + piece + "\r\n";
+        }
+        ex.response += "0\r\n\r\n";
+        return;
+    }
+    char len[48];
+    snprintf(len, sizeof(len), "Content-Length: %zu\r\n", serverPot.size());
+    ex.response = "HTTP/1.1 200 OK\r\n" + extra + len + "\r\n" + serverPot;
+}
+
+static std::string potLine(uint32_t i, const char* password) {
+    char line[128];
+    snprintf(line, sizeof(line), "0200%08lx:a4b1c2d3e4f5:NET-%lu:%s\n",
+             (unsigned long)i, (unsigned long)i, password);
+    return line;
+}
+
+static std::string potLines(uint32_t from, uint32_t to) {
+    std::string out;
+    for (uint32_t i = from; i < to; i++) {
+        char pw[16];
+        snprintf(pw, sizeof(pw), "pw%lu", (unsigned long)i);
+        out += potLine(i, pw);
+    }
+    return out;
+}
+
+static void apBssid(uint32_t i, uint8_t out[6]) {
+    out[0] = 0x02;
+    out[1] = 0x00;
+    out[2] = (uint8_t)(i >> 24);
+    out[3] = (uint8_t)(i >> 16);
+    out[4] = (uint8_t)(i >> 8);
+    out[5] = (uint8_t)i;
+}
+
+static const char* passwordOf(uint32_t i) {
+    uint8_t ap[6];
+    apBssid(i, ap);
+    const CrackedIndex::Entry* e = CrackedIndex::find(ap);
+    return e ? e->password : nullptr;
+}
+
+// One sync: fetch over a fresh session, then the index update
+static Result sync(uint32_t& newCracked, const char* cookie = "key=abc") {
+    SyncSession session(kHost, 443, "TEST");
+    Result r;
+    char err[48] = {0};
+    TEST_ASSERT_TRUE_MESSAGE(PotfileSync::fetch(session, kPath, cookie, r, err, sizeof(err)), err);
+    session.close();
+    TEST_ASSERT_TRUE(PotfileSync::updateIndex(r, newCracked));
+    return r;
+}
+
+// Local potfile lines (CRLF as written) back to the server's LF form
+static std::string localPot() {
+    std::string s = readHostFile(SDLayout::wpasecResultsPath());
+    std::string out;
+    for (char c : s) {
+        if (c != '\r') out += c;
+    }
+    return out;
+}
+
+void setUp(void) {
+    serverPot.clear();
+    serverRange = false;
+    serverEtag = false;
+    serverChunked = false;
+    requests = 0;
+    HostHal::setStationLink(true);
+    WiFi.begin("ssid", "pass");
+    HostHal::setNetResponder(respond);
+    PotfileSync::reset();
+    CrackedIndex::invalidate();
+    remove(hostPath(SDLayout::wpasecResultsPath()).c_str());
+}
+
+void tearDown(void) {
+    HostHal::setNetResponder(nullptr);
+}
+
+void test_first_sync_downloads_everything(void) {
+    serverPot = potLines(0, 40);
+    uint32_t added = 0;
+    Result r = sync(added);
+    TEST_ASSERT_TRUE(r.outcome == Outcome::Full);
+    TEST_ASSERT_EQUAL_UINT32(40, r.lines);
+    TEST_ASSERT_EQUAL_UINT32(40, added);
+    TEST_ASSERT_EQUAL_UINT32(40, CrackedIndex::count());
+    TEST_ASSERT_EQUAL_STRING(serverPot.c_str(), localPot().c_str());
+    TEST_ASSERT_TRUE(lastRequest.find("Range:") == std::string::npos);
+}
+
+void test_range_server_sends_only_new_lines(void) {
+    serverRange = true;
+    serverPot = potLines(0, 300);
+    uint32_t added = 0;
+    sync(added);
+    std::string before = serverPot;
+    serverPot += potLines(300, 310);
+
+    Result r = sync(added);
+    TEST_ASSERT_TRUE(r.outcome == Outcome::Delta);
+    TEST_ASSERT_EQUAL_UINT32(10, r.lines);
+    TEST_ASSERT_EQUAL_UINT32(serverPot.size() - before.size(), r.bodyBytes);
+    TEST_ASSERT_EQUAL_UINT32(10, added);
+    TEST_ASSERT_EQUAL_UINT32(310, CrackedIndex::count());
+    TEST_ASSERT_EQUAL_STRING("pw0", passwordOf(0));
+    TEST_ASSERT_EQUAL_STRING("pw299", passwordOf(299));
+    TEST_ASSERT_EQUAL_STRING("pw305", passwordOf(305));
+    TEST_ASSERT_EQUAL_STRING(serverPot.c_str(), localPot().c_str());
+}
+
+void test_etag_unchanged_is_not_modified(void) {
+    serverRange = true;
+    serverEtag = true;
+    serverPot = potLines(0, 20);
+    uint32_t added = 0;
+    sync(added);
+
+    Result r = sync(added);
+    TEST_ASSERT_TRUE(r.outcome == Outcome::NotModified);
+    TEST_ASSERT_EQUAL_UINT32(0, r.bodyBytes);
+    TEST_ASSERT_EQUAL_UINT32(0, added);
+    TEST_ASSERT_EQUAL_UINT32(20, CrackedIndex::count());
+    TEST_ASSERT_TRUE(lastRequest.find("If-None-Match: \"") != std::string::npos);
+}
+
+void test_range_past_end_is_not_modified(void) {
+    serverRange = true;
+    serverPot = potLines(0, 20);
+    uint32_t added = 0;
+    sync(added);
+
+    Result r = sync(added);
+    TEST_ASSERT_TRUE(r.outcome == Outcome::NotModified);
+    TEST_ASSERT_EQUAL_UINT32(20, CrackedIndex::count());
+}
+
+void test_plain_server_appends_after_hashed_prefix(void) {
+    serverPot = potLines(0, 50);
+    uint32_t added = 0;
+    sync(added);
+    serverPot += potLines(50, 55);
+
+    Result r = sync(added);
+    TEST_ASSERT_TRUE(r.outcome == Outcome::Delta);
+    TEST_ASSERT_EQUAL_UINT32(5, r.lines);
+    TEST_ASSERT_EQUAL_UINT32(serverPot.size(), r.bodyBytes);
+    TEST_ASSERT_EQUAL_UINT32(5, added);
+    TEST_ASSERT_EQUAL_UINT32(55, CrackedIndex::count());
+    TEST_ASSERT_EQUAL_STRING(serverPot.c_str(), localPot().c_str());
+}
+
+void test_rewritten_server_file_downloads_again(void) {
+    serverPot = potLines(0, 30);
+    uint32_t added = 0;
+    sync(added);
+    // Same length, different content: the prefix hash no longer matches
+    serverPot = potLines(100, 130) + potLines(130, 131);
+
+    Result r = sync(added);
+    TEST_ASSERT_TRUE(r.outcome == Outcome::Full);
+    TEST_ASSERT_EQUAL_UINT32(31, r.lines);
+    TEST_ASSERT_EQUAL_UINT32(2, requests - 1);
+    TEST_ASSERT_EQUAL_STRING(serverPot.c_str(), localPot().c_str());
+    TEST_ASSERT_EQUAL_UINT32(31, CrackedIndex::count());
+    TEST_ASSERT_NULL(passwordOf(0));
+    TEST_ASSERT_EQUAL_STRING("pw100", passwordOf(100));
+}
+
+void test_delta_keeps_first_password_for_known_bssid(void) {
+    serverRange = true;
+    serverPot = potLines(0, 10);
+    uint32_t added = 0;
+    sync(added);
+    serverPot += potLine(3, "later") + potLine(10, "pw10");
+
+    Result r = sync(added);
+    TEST_ASSERT_EQUAL_UINT32(2, r.lines);
+    TEST_ASSERT_EQUAL_UINT32(1, added);
+    TEST_ASSERT_EQUAL_UINT32(11, CrackedIndex::count());
+    TEST_ASSERT_EQUAL_STRING("pw3", passwordOf(3));
+    TEST_ASSERT_EQUAL_STRING("pw10", passwordOf(10));
+}
+
+void test_local_potfile_change_forces_full(void) {
+    serverRange = true;
+    serverPot = potLines(0, 10);
+    uint32_t added = 0;
+    sync(added);
+    remove(hostPath(SDLayout::wpasecResultsPath()).c_str());
+    serverPot += potLines(10, 12);
+
+    Result r = sync(added);
+    TEST_ASSERT_TRUE(r.outcome == Outcome::Full);
+    TEST_ASSERT_EQUAL_UINT32(12, r.lines);
+    TEST_ASSERT_EQUAL_UINT32(2, added);
+    TEST_ASSERT_EQUAL_STRING(serverPot.c_str(), localPot().c_str());
+}
+
+void test_other_key_forces_full(void) {
+    serverRange = true;
+    serverPot = potLines(0, 10);
+    uint32_t added = 0;
+    sync(added, "key=abc");
+    serverPot = potLines(500, 504);
+
+    Result r = sync(added, "key=other");
+    TEST_ASSERT_TRUE(r.outcome == Outcome::Full);
+    TEST_ASSERT_EQUAL_STRING(serverPot.c_str(), localPot().c_str());
+}
+
+void test_chunked_body_with_unterminated_last_line(void) {
+    serverChunked = true;
+    serverPot = potLines(0, 8);
+    serverPot += "0200000000ff:a4b1c2d3e4f5:Tail:tailpw";   // No final newline
+    uint32_t added = 0;
+    Result r = sync(added);
+    TEST_ASSERT_EQUAL_UINT32(9, r.lines);
+    TEST_ASSERT_EQUAL_STRING("tailpw", passwordOf(0xff));
+
+    // The server finishes that line and adds another
+    serverPot += "\n" + potLine(8, "pw8");
+    r = sync(added);
+    TEST_ASSERT_TRUE(r.outcome == Outcome::Delta);
+    TEST_ASSERT_EQUAL_UINT32(1, r.lines);
+    TEST_ASSERT_EQUAL_UINT32(1, added);
+    TEST_ASSERT_EQUAL_STRING("pw8", passwordOf(8));
+}
+
+int main(void) {
+    strcpy(sdRoot, "/tmp/porkchop_pot_sd_XXXXXX");
+    strcpy(flashRoot, "/tmp/porkchop_pot_flash_XXXXXX");
+    if (!mkdtemp(sdRoot) || !mkdtemp(flashRoot)) return 1;
+    HostHal::mountSD(sdRoot);
+    HostHal::mountSPIFFS(flashRoot);
+    Config::init();
+    std::string mk = "mkdir -p " + hostPath(SDLayout::metaDir()) + " " +
+                     hostPath(SDLayout::wpaSecDir());
+    (void)system(mk.c_str());
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_first_sync_downloads_everything);
+    RUN_TEST(test_range_server_sends_only_new_lines);
+    RUN_TEST(test_etag_unchanged_is_not_modified);
+    RUN_TEST(test_range_past_end_is_not_modified);
+    RUN_TEST(test_plain_server_appends_after_hashed_prefix);
+    RUN_TEST(test_rewritten_server_file_downloads_again);
+    RUN_TEST(test_delta_keeps_first_password_for_known_bssid);
+    RUN_TEST(test_local_potfile_change_forces_full);
+    RUN_TEST(test_other_key_forces_full);
+    RUN_TEST(test_chunked_body_with_unterminated_last_line);
+
+    int rc = UNITY_END();
+    std::string rm = std::string("rm -rf ") + sdRoot + " " + flashRoot;
+    (void)system(rm.c_str());
+    return rc;
+}
@@ -0,0 +1,193 @@
+// SDJournal Tests
+// Write-behind row buffering: block and time budgets, durability of
+// flushed rows and the SD call count versus one open per row.
+// SD is a temp directory via the host HAL.
+
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <host_hal.h>
+#include "../../src/core/sd_journal.h"
+
+static char sdRoot[64];
+
+static std::string hostPath(const char* sdPath) {
+    return std::string(sdRoot) + sdPath;
+}
+
+static std::string readAll(const char* sdPath) {
+    std::string out;
+    FILE* f = fopen(hostPath(sdPath).c_str(), "rb");
+    if (!f) return out;
+    char tmp[512];
+    size_t n;
+    while ((n = fread(tmp, 1, sizeof(tmp), f)) > 0) out.append(tmp, n);
+    fclose(f);
+    return out;
+}
+
+static bool exists(const char* sdPath) {
+    FILE* f = fopen(hostPath(sdPath).c_str(), "rb");
+    if (f) fclose(f);
+    return f != nullptr;
+}
+
+// Typical WiGLE row (~130 bytes)
+static bool appendRow(SDJournal& j, int i) {
+    return j.appendf("AA:BB:CC:DD:%02X:%02X,\"NET-%04d\",[WPA2-PSK-CCMP][ESS],2026-10-16 12:00:00,"
+                     "6,2437,-67,51.500000,-0.120000,35.0,10.0,,,WIFI\r\n",
+                     (i >> 8) & 0xFF, i & 0xFF, i);
+}
+
+static SDJournal journal;
+
+void setUp(void) {
+    strcpy(sdRoot, "/tmp/journal_sd_XXXXXX");
+    TEST_ASSERT_NOT_NULL(mkdtemp(sdRoot));
+    HostHal::mountSD(sdRoot);
+    HostHal::setMillis(1000);
+}
+
+void tearDown(void) {
+    journal.end();
+    std::string cmd = std::string("rm -rf ") + sdRoot;
+    (void)system(cmd.c_str());
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void test_append_without_begin_fails(void) {
+    TEST_ASSERT_FALSE(journal.isOpen());
+    TEST_ASSERT_FALSE(journal.appendf("x\n"));
+}
+
+void test_begin_rejects_empty_path(void) {
+    TEST_ASSERT_FALSE(journal.begin(""));
+    TEST_ASSERT_FALSE(journal.begin(nullptr));
+}
+
+void test_rows_stay_in_ram_until_flush(void) {
+    TEST_ASSERT_TRUE(journal.begin("/w.csv"));
+    TEST_ASSERT_TRUE(journal.appendf("HDR\n"));
+    TEST_ASSERT_TRUE(appendRow(journal, 1));
+    TEST_ASSERT_FALSE(exists("/w.csv"));
+    TEST_ASSERT_EQUAL_UINT32(0, journal.getStats().writes);
+    TEST_ASSERT_TRUE(journal.flush());
+    TEST_ASSERT_TRUE(exists("/w.csv"));
+    TEST_ASSERT_EQUAL_UINT32(1, journal.getStats().writes);
+    TEST_ASSERT_EQUAL_UINT16(0, journal.getStats().buffered);
+}
+
+void test_end_flushes_remaining_rows(void) {
+    journal.begin("/w.csv");
+    journal.appendf("a,%d\n", 1);
+    journal.appendf("b,%d\n", 2);
+    journal.end();
+    TEST_ASSERT_FALSE(journal.isOpen());
+    TEST_ASSERT_EQUAL_STRING("a,1\nb,2\n", readAll("/w.csv").c_str());
+}
+
+void test_flush_appends_to_existing_file(void) {
+    journal.begin("/w.csv");
+    journal.appendf("one\n");
+    journal.flush();
+    journal.appendf("two\n");
+    journal.flush();
+    TEST_ASSERT_EQUAL_STRING("one\ntwo\n", readAll("/w.csv").c_str());
+}
+
+// ============================================================================
+// Budgets
+// ============================================================================
+
+void test_flush_due_on_time_budget(void) {
+    journal.begin("/w.csv");
+    TEST_ASSERT_FALSE(journal.flushDue());
+    appendRow(journal, 0);
+    TEST_ASSERT_FALSE(journal.flushDue());
+    HostHal::advanceMillis(SDJournal::kFlushIntervalMs);
+    TEST_ASSERT_TRUE(journal.flushDue());
+    journal.flush();
+    TEST_ASSERT_FALSE(journal.flushDue());
+}
+
+void test_flush_due_on_size_budget(void) {
+    journal.begin("/w.csv");
+    int i = 0;
+    while (journal.getStats().buffered < SDJournal::kFlushBytes) {
+        TEST_ASSERT_FALSE(journal.flushDue());
+        appendRow(journal, i++);
+    }
+    TEST_ASSERT_TRUE(journal.flushDue());
+}
+
+void test_full_block_written_whole(void) {
+    journal.begin("/w.csv");
+    for (int i = 0; i < 40; i++) TEST_ASSERT_TRUE(appendRow(journal, i));
+    SDJournal::Stats s = journal.getStats();
+    TEST_ASSERT_TRUE(s.writes > 0);
+    // Rows never straddle a write: each write ends on a row boundary
+    std::string disk = readAll("/w.csv");
+    TEST_ASSERT_EQUAL_UINT32(s.bytesWritten, disk.size());
+    TEST_ASSERT_EQUAL_STRING("\r\n", disk.substr(disk.size() - 2).c_str());
+    TEST_ASSERT_EQUAL_UINT32(disk.size() + s.buffered, journal.size());
+}
+
+void test_oversize_row_dropped(void) {
+    journal.begin("/w.csv");
+    std::string big(SDJournal::kBlockBytes, 'x');
+    TEST_ASSERT_FALSE(journal.appendf("%s\n", big.c_str()));
+    TEST_ASSERT_EQUAL_UINT32(1, journal.getStats().droppedRows);
+    TEST_ASSERT_TRUE(journal.appendf("ok\n"));
+}
+
+// ============================================================================
+// Scan at driving speed
+// ============================================================================
+
+void test_scan_costs_few_sd_writes(void) {
+    // 60 networks per scan, one row per network. The old path opened and
+    // closed the file once per row.
+    const int kRows = 60;
+    journal.begin("/w.csv");
+    for (int i = 0; i < kRows; i++) appendRow(journal, i);
+    journal.end();
+    SDJournal::Stats s = journal.getStats();
+    TEST_ASSERT_TRUE(s.writes * 10 <= kRows);
+    TEST_ASSERT_EQUAL_UINT32(kRows, s.rows);
+    TEST_ASSERT_EQUAL_UINT32(0, s.droppedRows);
+
+    // Every row landed intact and in order
+    std::string disk = readAll("/w.csv");
+    size_t pos = 0;
+    for (int i = 0; i < kRows; i++) {
+        char want[16];
+        snprintf(want, sizeof(want), "\"NET-%04d\"", i);
+        size_t at = disk.find(want, pos);
+        TEST_ASSERT_TRUE(at != std::string::npos);
+        pos = at;
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_append_without_begin_fails);
+    RUN_TEST(test_begin_rejects_empty_path);
+    RUN_TEST(test_rows_stay_in_ram_until_flush);
+    RUN_TEST(test_end_flushes_remaining_rows);
+    RUN_TEST(test_flush_appends_to_existing_file);
+
+    RUN_TEST(test_flush_due_on_time_budget);
+    RUN_TEST(test_flush_due_on_size_budget);
+    RUN_TEST(test_full_block_written_whole);
+    RUN_TEST(test_oversize_row_dropped);
+
+    RUN_TEST(test_scan_costs_few_sd_writes);
+
+    return UNITY_END();
+}
@@ -0,0 +1,274 @@
+// SDLog Tests
+// MpscRing ordering/drop/concurrency, and the async SDLog backend end to
+// end: log() only queues, the flush task or flush() writes in batches.
+// SD is a temp directory via the host HAL.
+
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <host_hal.h>
+#include "../../src/core/mpsc_ring.h"
+#include "../../src/core/sdlog.h"
+#include "../../src/core/config.h"
+#include "../../src/core/sd_layout.h"
+
+static char sdRoot[64];
+static char flashRoot[64];
+
+static std::string readAll(const char* sdPath) {
+    std::string out;
+    FILE* f = fopen((std::string(sdRoot) + sdPath).c_str(), "rb");
+    if (!f) return out;
+    char tmp[512];
+    size_t n;
+    while ((n = fread(tmp, 1, sizeof(tmp), f)) > 0) out.append(tmp, n);
+    fclose(f);
+    return out;
+}
+
+static std::string logPath() {
+    return std::string(SDLayout::logsDir()) + "/porkchop.log";
+}
+
+static size_t countOf(const std::string& hay, const char* needle) {
+    size_t n = 0;
+    for (size_t at = hay.find(needle); at != std::string::npos; at = hay.find(needle, at + 1)) n++;
+    return n;
+}
+
+void setUp(void) {
+    HostHal::setMillis(1000);
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// MpscRing
+// ============================================================================
+
+void test_ring_fifo_order(void) {
+    MpscRing<uint32_t, 8> r;
+    for (uint32_t i = 0; i < 5; i++) TEST_ASSERT_TRUE(r.push(i));
+    TEST_ASSERT_EQUAL_UINT16(5, r.size());
+    uint32_t v;
+    for (uint32_t i = 0; i < 5; i++) {
+        TEST_ASSERT_TRUE(r.pop(v));
+        TEST_ASSERT_EQUAL_UINT32(i, v);
+    }
+    TEST_ASSERT_FALSE(r.pop(v));
+    TEST_ASSERT_TRUE(r.empty());
+}
+
+void test_ring_full_counts_drops(void) {
+    MpscRing<uint32_t, 4> r;
+    for (uint32_t i = 0; i < 4; i++) TEST_ASSERT_TRUE(r.push(i));
+    TEST_ASSERT_FALSE(r.push(99));
+    TEST_ASSERT_FALSE(r.push(100));
+    TEST_ASSERT_EQUAL_UINT32(2, r.dropped());
+    TEST_ASSERT_EQUAL_UINT32(4, r.pushed());
+    TEST_ASSERT_EQUAL_UINT16(4, r.highWater());
+    uint32_t v;
+    TEST_ASSERT_TRUE(r.pop(v));
+    TEST_ASSERT_EQUAL_UINT32(0, v);
+    TEST_ASSERT_TRUE(r.push(4));
+}
+
+void test_ring_wraps_many_times(void) {
+    MpscRing<uint32_t, 4> r;
+    uint32_t v;
+    for (uint32_t i = 0; i < 1000; i++) {
+        TEST_ASSERT_TRUE(r.push(i));
+        TEST_ASSERT_TRUE(r.pop(v));
+        TEST_ASSERT_EQUAL_UINT32(i, v);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, r.dropped());
+}
+
+void test_ring_concurrent_producers(void) {
+    // Four producers race one consumer; every value arrives exactly once
+    // and each producer's values stay in order
+    static MpscRing<uint32_t, 64> r;
+    const uint32_t kPerProducer = 20000;
+    const int kProducers = 4;
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; p++) {
+        producers.emplace_back([p]() {
+            for (uint32_t i = 0; i < kPerProducer; i++) {
+                uint32_t v = ((uint32_t)p << 24) | i;
+                while (!r.push(v)) std::this_thread::yield();
+            }
+        });
+    }
+    uint32_t next[kProducers] = {0};
+    uint32_t got = 0;
+    bool ordered = true;
+    while (got < kPerProducer * kProducers) {
+        uint32_t v;
+        if (!r.pop(v)) {
+            std::this_thread::yield();
+            continue;
+        }
+        uint32_t p = v >> 24;
+        if ((v & 0xFFFFFF) != next[p]) ordered = false;
+        next[p] = (v & 0xFFFFFF) + 1;
+        got++;
+    }
+    for (auto& t : producers) t.join();
+    TEST_ASSERT_TRUE(ordered);
+    for (int p = 0; p < kProducers; p++) TEST_ASSERT_EQUAL_UINT32(kPerProducer, next[p]);
+    TEST_ASSERT_TRUE(r.empty());
+}
+
+// ============================================================================
+// SDLog backend
+// ============================================================================
+
+void test_disabled_log_is_noop(void) {
+    SDLog::setEnabled(false);
+    uint32_t before = SDLog::getStats().queued;
+    SDLog::log("TEST", "ignored %d", 1);
+    TEST_ASSERT_EQUAL_UINT32(before, SDLog::getStats().queued);
+}
+
+void test_log_queues_then_flush_writes(void) {
+    SDLog::setEnabled(true);
+    TEST_ASSERT_TRUE(SDLog::isEnabled());
+    SDLog::flush();
+    uint32_t before = SDLog::getStats().queued;
+    SDLog::log("TEST", "hello %s %d", "pig", 42);
+    TEST_ASSERT_EQUAL_UINT32(before + 1, SDLog::getStats().queued);
+    SDLog::flush();
+    std::string text = readAll(logPath().c_str());
+    TEST_ASSERT_TRUE(text.find("=== PORKCHOP LOG ===") != std::string::npos);
+    TEST_ASSERT_TRUE(text.find("[TEST] hello pig 42\n") != std::string::npos);
+    TEST_ASSERT_EQUAL_UINT16(0, SDLog::getStats().pending);
+}
+
+void test_lines_batched_into_few_writes(void) {
+    SDLog::setEnabled(true);
+    SDLog::flush();
+    SDLog::Stats before = SDLog::getStats();
+    for (int i = 0; i < 16; i++) SDLog::log("BATCH", "line %02d of a burst", i);
+    SDLog::flush();
+    SDLog::Stats after = SDLog::getStats();
+    TEST_ASSERT_EQUAL_UINT32(16, after.linesWritten - before.linesWritten);
+    TEST_ASSERT_TRUE(after.writes - before.writes <= 2);
+    std::string text = readAll(logPath().c_str());
+    TEST_ASSERT_TRUE(text.find("[BATCH] line 00 of a burst") < text.find("[BATCH] line 15 of a burst"));
+}
+
+void test_long_line_truncated_and_counted(void) {
+    SDLog::setEnabled(true);
+    uint32_t before = SDLog::getStats().truncated;
+    std::string big(400, 'z');
+    SDLog::log("LONG", "%s", big.c_str());
+    SDLog::flush();
+    TEST_ASSERT_EQUAL_UINT32(before + 1, SDLog::getStats().truncated);
+    std::string text = readAll(logPath().c_str());
+    size_t at = text.find("[LONG] ");
+    TEST_ASSERT_TRUE(at != std::string::npos);
+    size_t eol = text.find('\n', at);
+    TEST_ASSERT_TRUE(eol - at < 222);
+}
+
+void test_flush_task_drains_without_flush_call(void) {
+    SDLog::setEnabled(true);
+    SDLog::log("TASK", "background drain");
+    // The task syncs the file on its time budget
+    HostHal::advanceMillis(5000);
+    bool seen = false;
+    for (int i = 0; i < 40 && !seen; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        seen = SDLog::getStats().pending == 0 &&
+               readAll(logPath().c_str()).find("[TASK] background drain") != std::string::npos;
+    }
+    TEST_ASSERT_TRUE(seen);
+}
+
+void test_burst_past_capacity_counts_drops(void) {
+    SDLog::setEnabled(true);
+    SDLog::flush();
+    SDLog::Stats before = SDLog::getStats();
+    for (int i = 0; i < 500; i++) SDLog::log("BURST", "%d", i);
+    SDLog::flush();
+    SDLog::Stats after = SDLog::getStats();
+    uint32_t accepted = after.queued - before.queued;
+    uint32_t dropped = after.dropped - before.dropped;
+    TEST_ASSERT_EQUAL_UINT32(500, accepted + dropped);
+    TEST_ASSERT_EQUAL_UINT32(accepted, after.linesWritten - before.linesWritten);
+    TEST_ASSERT_EQUAL_UINT32(accepted, countOf(readAll(logPath().c_str()), "[BURST] "));
+}
+
+void test_crash_flush_drains_and_closes(void) {
+    SDLog::setEnabled(true);
+    SDLog::log("CRASH", "last words");
+    TEST_ASSERT_TRUE(SDLog::crashFlush(50));
+    TEST_ASSERT_TRUE(readAll(logPath().c_str()).find("[CRASH] last words") != std::string::npos);
+    // Logging continues afterwards (file reopened for append)
+    SDLog::log("CRASH", "after");
+    SDLog::flush();
+    std::string text = readAll(logPath().c_str());
+    TEST_ASSERT_TRUE(text.find("[CRASH] after") != std::string::npos);
+    TEST_ASSERT_EQUAL_UINT32(1, countOf(text, "=== PORKCHOP LOG ==="));
+}
+
+void test_suspend_holds_lines_until_resume(void) {
+    SDLog::setEnabled(true);
+    SDLog::log("REMOUNT", "before");
+    SDLog::flush();
+    SDLog::suspend();
+    // Card swapped underneath: the old handle must not be written through
+    std::string path = std::string(sdRoot) + logPath();
+    TEST_ASSERT_EQUAL_INT(0, remove(path.c_str()));
+    SDLog::log("REMOUNT", "during");
+    SDLog::flush();
+    TEST_ASSERT_EQUAL_UINT16(1, SDLog::getStats().pending);
+    FILE* f = fopen(path.c_str(), "rb");
+    TEST_ASSERT_NULL(f);
+    SDLog::suspend();   // Nested (reinitSD inside a format)
+    SDLog::resume();
+    SDLog::flush();
+    TEST_ASSERT_EQUAL_UINT16(1, SDLog::getStats().pending);
+    SDLog::resume();
+    SDLog::flush();
+    TEST_ASSERT_EQUAL_UINT16(0, SDLog::getStats().pending);
+    std::string text = readAll(logPath().c_str());
+    TEST_ASSERT_TRUE(text.find("[REMOUNT] during") != std::string::npos);
+    TEST_ASSERT_TRUE(text.find("[REMOUNT] before") == std::string::npos);
+}
+
+int main(void) {
+    strcpy(sdRoot, "/tmp/sdlog_sd_XXXXXX");
+    strcpy(flashRoot, "/tmp/sdlog_fs_XXXXXX");
+    if (!mkdtemp(sdRoot) || !mkdtemp(flashRoot)) return 1;
+    HostHal::mountSD(sdRoot);
+    HostHal::mountSPIFFS(flashRoot);
+    Config::init();
+    SDLog::init();
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_ring_fifo_order);
+    RUN_TEST(test_ring_full_counts_drops);
+    RUN_TEST(test_ring_wraps_many_times);
+    RUN_TEST(test_ring_concurrent_producers);
+
+    RUN_TEST(test_disabled_log_is_noop);
+    RUN_TEST(test_log_queues_then_flush_writes);
+    RUN_TEST(test_lines_batched_into_few_writes);
+    RUN_TEST(test_long_line_truncated_and_counted);
+    RUN_TEST(test_flush_task_drains_without_flush_call);
+    RUN_TEST(test_burst_past_capacity_counts_drops);
+    RUN_TEST(test_crash_flush_drains_and_closes);
+    RUN_TEST(test_suspend_holds_lines_until_resume);
+
+    int rc = UNITY_END();
+    SDLog::close();
+    std::string cmd = std::string("rm -rf ") + sdRoot + " " + flashRoot;
+    (void)system(cmd.c_str());
+    return rc;
+}
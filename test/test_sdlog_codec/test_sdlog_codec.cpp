@@ -0,0 +1,237 @@
+// SDLog Codec Tests
+// Varint/zigzag primitives, argument encoding, the host decoder's text
+// rendering, and a binary SDLog file written through the real backend and
+// read back with tools/sdlog_decode.
+
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <host_hal.h>
+#include "../../src/core/sdlog.h"
+#include "../../src/core/config.h"
+#include "../../src/core/sd_layout.h"
+#include "../../tools/sdlog_decode/sdlog_decoder.h"
+
+static char sdRoot[64];
+static char flashRoot[64];
+
+// Wrap encoded args into a one-record file image the decoder can read
+static std::vector<uint8_t> recordFile(uint16_t id, uint32_t dt, const uint8_t* args, size_t len) {
+    std::vector<uint8_t> out(SDLogCodec::kFileHeaderBytes);
+    SDLogCodec::putFileHeader(out.data(), SDLogMsg::kTableHash);
+    uint8_t body[256];
+    size_t n = SDLogCodec::putVarint(body, sizeof(body), SDLogCodec::zigzag(dt));
+    n += SDLogCodec::putVarint(body + n, sizeof(body) - n, id);
+    memcpy(body + n, args, len);
+    n += len;
+    uint8_t lenBuf[10];
+    size_t ln = SDLogCodec::putVarint(lenBuf, sizeof(lenBuf), n);
+    out.insert(out.end(), lenBuf, lenBuf + ln);
+    out.insert(out.end(), body, body + n);
+    return out;
+}
+
+template <typename... Args>
+static std::string decodeOne(SDLogMsg::Id id, Args... args) {
+    uint8_t buf[200];
+    size_t n = SDLogCodec::encodeArgs(buf, sizeof(buf), args...);
+    TEST_ASSERT_TRUE(n > 0);
+    std::vector<uint8_t> file = recordFile(id, 1234, buf, n);
+    SDLogDecode::Reader reader;
+    TEST_ASSERT_TRUE(reader.openBuffer(file.data(), file.size()));
+    SDLogDecode::Record rec;
+    TEST_ASSERT_TRUE(reader.next(rec));
+    TEST_ASSERT_FALSE(reader.next(rec));
+    TEST_ASSERT_EQUAL_UINT32(0, reader.stats().malformed);
+    return SDLogDecode::render(rec);
+}
+
+void setUp(void) {
+    HostHal::setMillis(1000);
+}
+
+void tearDown(void) {}
+
+// ============================================================================
+// Primitives
+// ============================================================================
+
+void test_varint_round_trip(void) {
+    const uint64_t values[] = {0, 1, 127, 128, 300, 16383, 16384, 0xFFFFFFFFull, ~0ull};
+    for (uint64_t v : values) {
+        uint8_t buf[10];
+        size_t n = SDLogCodec::putVarint(buf, sizeof(buf), v);
+        TEST_ASSERT_TRUE(n > 0);
+        uint64_t back = 0;
+        TEST_ASSERT_EQUAL_UINT32(n, SDLogCodec::getVarint(buf, n, back));
+        TEST_ASSERT_TRUE(back == v);
+    }
+    uint8_t one[1];
+    TEST_ASSERT_EQUAL_UINT32(1, SDLogCodec::putVarint(one, 1, 127));
+    TEST_ASSERT_EQUAL_UINT32(0, SDLogCodec::putVarint(one, 1, 128));
+    // Truncated input: continuation bit set on the last byte
+    uint8_t cut[] = {0x80, 0x80};
+    uint64_t v;
+    TEST_ASSERT_EQUAL_UINT32(0, SDLogCodec::getVarint(cut, sizeof(cut), v));
+}
+
+void test_zigzag_small_magnitudes_stay_small(void) {
+    TEST_ASSERT_TRUE(SDLogCodec::zigzag(0) == 0);
+    TEST_ASSERT_TRUE(SDLogCodec::zigzag(-1) == 1);
+    TEST_ASSERT_TRUE(SDLogCodec::zigzag(1) == 2);
+    TEST_ASSERT_TRUE(SDLogCodec::zigzag(-64) == 127);
+    const int64_t values[] = {0, -1, 1, -123456, 123456, INT64_MIN, INT64_MAX};
+    for (int64_t v : values) TEST_ASSERT_TRUE(SDLogCodec::unzigzag(SDLogCodec::zigzag(v)) == v);
+}
+
+void test_encode_args_layout_and_overflow(void) {
+    uint8_t buf[64];
+    // count, one mask byte (signed=0, string=3 -> 0b1100), zigzag(-2)=3, len 2 "hi"
+    size_t n = SDLogCodec::encodeArgs(buf, sizeof(buf), -2, "hi");
+    TEST_ASSERT_EQUAL_UINT32(6, n);
+    const uint8_t expect[] = {2, 0x0C, 3, 2, 'h', 'i'};
+    TEST_ASSERT_EQUAL_MEMORY(expect, buf, sizeof(expect));
+
+    TEST_ASSERT_EQUAL_UINT32(1, SDLogCodec::encodeArgs(buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_UINT32(0, SDLogCodec::encodeArgs(buf, 8, "longer than eight"));
+
+    // Strings are cut at kMaxStringBytes rather than failing the record
+    std::string big(300, 'x');
+    uint8_t wide[256];
+    n = SDLogCodec::encodeArgs(wide, sizeof(wide), big.c_str());
+    TEST_ASSERT_EQUAL_UINT32(2 + 2 + SDLogCodec::kMaxStringBytes, n);
+}
+
+// ============================================================================
+// Decoder
+// ============================================================================
+
+void test_render_reconstructs_table_text(void) {
+    TEST_ASSERT_EQUAL_STRING("[1234][XP] LEVEL UP: 4 -> 5 (MUD WRESTLER)",
+                             decodeOne(SDLogMsg::XP_LEVEL_UP, 4, 5, "MUD WRESTLER").c_str());
+    TEST_ASSERT_EQUAL_STRING("[1234][WARHOG] Found 12 new (3 geotagged)",
+                             decodeOne(SDLogMsg::WARHOG_FOUND, 12ul, 3ul).c_str());
+    TEST_ASSERT_EQUAL_STRING("[1234][GPS] Fix lost", decodeOne(SDLogMsg::GPS_FIX_LOST).c_str());
+    // Unsigned bytes printed through %d
+    TEST_ASSERT_EQUAL_STRING("[1234][GPS] Fix acquired (sats: 9)",
+                             decodeOne(SDLogMsg::GPS_FIX_ACQUIRED, (uint8_t)9).c_str());
+}
+
+void test_format_message_specs(void) {
+    std::vector<SDLogDecode::Arg> args(4);
+    args[0].type = SDLogCodec::ARG_SIGNED;   args[0].i = -7;
+    args[1].type = SDLogCodec::ARG_UNSIGNED; args[1].u = 0xBEEF;
+    args[2].type = SDLogCodec::ARG_DOUBLE;   args[2].d = 3.14159;
+    args[3].type = SDLogCodec::ARG_STRING;   args[3].s = "pig";
+    TEST_ASSERT_EQUAL_STRING("-7 0xbeef 3.14 [  pig] 100% ?",
+        SDLogDecode::formatMessage("%ld 0x%04lx %.2f [%5s] 100%% %d", args).c_str());
+}
+
+void test_text_record_and_raw_line(void) {
+    TEST_ASSERT_EQUAL_STRING("[1234][PORK] Mode: OINK",
+                             decodeOne(SDLogMsg::TEXT, "PORK", "Mode: OINK").c_str());
+    TEST_ASSERT_EQUAL_STRING("raw banner", decodeOne(SDLogMsg::TEXT, "", "raw banner").c_str());
+}
+
+void test_reader_rejects_bad_header_and_torn_tail(void) {
+    SDLogDecode::Reader reader;
+    const uint8_t text[] = "=== PORKCHOP LOG ===\n";
+    TEST_ASSERT_FALSE(reader.openBuffer(text, sizeof(text)));
+
+    uint8_t buf[32];
+    size_t n = SDLogCodec::encodeArgs(buf, sizeof(buf), "AA:BB");
+    std::vector<uint8_t> file = recordFile(SDLogMsg::OINK_PMKID_SAVED, 10, buf, n);
+    file.pop_back();  // Power cut mid-write
+    TEST_ASSERT_TRUE(reader.openBuffer(file.data(), file.size()));
+    SDLogDecode::Record rec;
+    TEST_ASSERT_FALSE(reader.next(rec));
+    TEST_ASSERT_EQUAL_UINT32(1, reader.stats().malformed);
+}
+
+// ============================================================================
+// End to end through SDLog
+// ============================================================================
+
+void test_binary_log_file_decodes(void) {
+    SDLog::setEnabled(true);
+    SDLog::setBinary(true);
+    TEST_ASSERT_TRUE(SDLog::isBinary());
+
+    HostHal::setMillis(5000);
+    SDLog::event(SDLogMsg::GPS_FIX_ACQUIRED, 7);
+    HostHal::setMillis(5250);
+    SDLog::event(SDLogMsg::OINK_HS_SAVED, "HomeNet", "OK", "FAIL");
+    HostHal::setMillis(5100);  // Out-of-order stamp from another task
+    SDLog::log("BACON", "Switched to tier %d (%dms)", 2, 100);
+    SDLog::logRaw("plain line");
+    SDLog::flush();
+
+    std::string path = std::string(sdRoot) + SDLayout::logsDir() + "/porkchop.blg";
+    SDLogDecode::Reader reader;
+    TEST_ASSERT_TRUE(reader.open(path.c_str()));
+    TEST_ASSERT_TRUE(reader.tableMatches());
+
+    std::vector<std::string> lines;
+    SDLogDecode::Record rec;
+    while (reader.next(rec)) lines.push_back(SDLogDecode::render(rec));
+    TEST_ASSERT_EQUAL_UINT32(0, reader.stats().malformed);
+
+    // "SD logging enabled" from setEnabled() precedes the switch to binary
+    // and lands in the text log, so the binary file starts with our events
+    TEST_ASSERT_EQUAL_UINT32(4, lines.size());
+    TEST_ASSERT_EQUAL_STRING("[5000][GPS] Fix acquired (sats: 7)", lines[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("[5250][OINK] Handshake saved: HomeNet (pcap:OK 22000:FAIL)", lines[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("[5100][BACON] Switched to tier 2 (100ms)", lines[2].c_str());
+    TEST_ASSERT_EQUAL_STRING("plain line", lines[3].c_str());
+
+    SDLog::setBinary(false);
+    TEST_ASSERT_FALSE(SDLog::isBinary());
+}
+
+void test_text_mode_event_matches_format(void) {
+    SDLog::setEnabled(true);
+    SDLog::event(SDLogMsg::XP_ACHIEVEMENT, "FIRST BLOOD");
+    SDLog::flush();
+    std::string path = std::string(sdRoot) + SDLayout::logsDir() + "/porkchop.log";
+    FILE* f = fopen(path.c_str(), "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    std::string text;
+    char tmp[512];
+    size_t n;
+    while ((n = fread(tmp, 1, sizeof(tmp), f)) > 0) text.append(tmp, n);
+    fclose(f);
+    TEST_ASSERT_TRUE(text.find("[XP] Achievement: FIRST BLOOD\n") != std::string::npos);
+}
+
+int main(void) {
+    strcpy(sdRoot, "/tmp/sdlogc_sd_XXXXXX");
+    strcpy(flashRoot, "/tmp/sdlogc_fs_XXXXXX");
+    if (!mkdtemp(sdRoot) || !mkdtemp(flashRoot)) return 1;
+    HostHal::mountSD(sdRoot);
+    HostHal::mountSPIFFS(flashRoot);
+    Config::init();
+    SDLog::init();
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_varint_round_trip);
+    RUN_TEST(test_zigzag_small_magnitudes_stay_small);
+    RUN_TEST(test_encode_args_layout_and_overflow);
+
+    RUN_TEST(test_render_reconstructs_table_text);
+    RUN_TEST(test_format_message_specs);
+    RUN_TEST(test_text_record_and_raw_line);
+    RUN_TEST(test_reader_rejects_bad_header_and_torn_tail);
+
+    RUN_TEST(test_binary_log_file_decodes);
+    RUN_TEST(test_text_mode_event_matches_format);
+
+    int rc = UNITY_END();
+    SDLog::close();
+    std::string cmd = std::string("rm -rf ") + sdRoot + " " + flashRoot;
+    (void)system(cmd.c_str());
+    return rc;
+}
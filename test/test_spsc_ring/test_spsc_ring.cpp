@@ -0,0 +1,170 @@
+// SPSC Ring Tests
+// Bounded single-producer/single-consumer ring between the WiFi task and update()
+
+#include <unity.h>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include "../../src/core/spsc_ring.h"
+
+// Same shape as NetworkRecon's frame summary: fixed size, copied by value
+struct Summary {
+    uint32_t seq;
+    uint8_t bssid[6];
+    int8_t rssi;
+    char ssid[33];
+};
+
+static Summary makeSummary(uint32_t seq) {
+    Summary s;
+    s.seq = seq;
+    for (int i = 0; i < 6; i++) s.bssid[i] = (uint8_t)(seq >> (i * 4));
+    s.rssi = (int8_t)(-(int)(seq % 90));
+    snprintf(s.ssid, sizeof(s.ssid), "net-%u", (unsigned)seq);
+    return s;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ============================================================================
+// Basic operations
+// ============================================================================
+
+void test_empty_ring_pops_nothing(void) {
+    SpscRing<Summary, 8> ring;
+    Summary out;
+    TEST_ASSERT_TRUE(ring.empty());
+    TEST_ASSERT_FALSE(ring.pop(out));
+    TEST_ASSERT_EQUAL_UINT16(0, ring.popBatch(&out, 1));
+}
+
+void test_fifo_order(void) {
+    SpscRing<Summary, 8> ring;
+    for (uint32_t i = 0; i < 5; i++) TEST_ASSERT_TRUE(ring.push(makeSummary(i)));
+    TEST_ASSERT_EQUAL_UINT16(5, ring.size());
+    Summary out;
+    for (uint32_t i = 0; i < 5; i++) {
+        TEST_ASSERT_TRUE(ring.pop(out));
+        TEST_ASSERT_EQUAL_UINT32(i, out.seq);
+        TEST_ASSERT_EQUAL_STRING(makeSummary(i).ssid, out.ssid);
+    }
+    TEST_ASSERT_TRUE(ring.empty());
+}
+
+void test_full_ring_drops_and_counts(void) {
+    SpscRing<Summary, 4> ring;
+    for (uint32_t i = 0; i < 4; i++) TEST_ASSERT_TRUE(ring.push(makeSummary(i)));
+    TEST_ASSERT_FALSE(ring.push(makeSummary(99)));
+    TEST_ASSERT_FALSE(ring.push(makeSummary(100)));
+    TEST_ASSERT_EQUAL_UINT32(4, ring.pushed());
+    TEST_ASSERT_EQUAL_UINT32(2, ring.dropped());
+    TEST_ASSERT_EQUAL_UINT16(4, ring.highWater());
+
+    // Oldest entries survive, dropped ones never appear
+    Summary out;
+    TEST_ASSERT_TRUE(ring.pop(out));
+    TEST_ASSERT_EQUAL_UINT32(0, out.seq);
+    TEST_ASSERT_TRUE(ring.push(makeSummary(4)));
+}
+
+void test_pop_batch_respects_max_and_wraps(void) {
+    SpscRing<Summary, 8> ring;
+    Summary batch[8];
+    uint32_t next = 0;
+    uint32_t expect = 0;
+    // Push/drain in uneven steps so indices wrap many times
+    for (int round = 0; round < 50; round++) {
+        for (int i = 0; i < 6; i++) TEST_ASSERT_TRUE(ring.push(makeSummary(next++)));
+        uint16_t n = ring.popBatch(batch, 4);
+        TEST_ASSERT_EQUAL_UINT16(4, n);
+        for (uint16_t i = 0; i < n; i++) TEST_ASSERT_EQUAL_UINT32(expect++, batch[i].seq);
+        n = ring.popBatch(batch, 8);
+        TEST_ASSERT_EQUAL_UINT16(2, n);
+        for (uint16_t i = 0; i < n; i++) TEST_ASSERT_EQUAL_UINT32(expect++, batch[i].seq);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, ring.dropped());
+}
+
+void test_counters_survive_16bit_index_wrap(void) {
+    SpscRing<Summary, 4> ring;
+    Summary out;
+    for (uint32_t i = 0; i < 70000; i++) {
+        TEST_ASSERT_TRUE(ring.push(makeSummary(i)));
+        TEST_ASSERT_TRUE(ring.pop(out));
+        TEST_ASSERT_EQUAL_UINT32(i, out.seq);
+    }
+    TEST_ASSERT_TRUE(ring.empty());
+    TEST_ASSERT_EQUAL_UINT32(70000, ring.pushed());
+}
+
+void test_reset_clears_state(void) {
+    SpscRing<Summary, 4> ring;
+    for (uint32_t i = 0; i < 6; i++) ring.push(makeSummary(i));
+    ring.reset();
+    TEST_ASSERT_TRUE(ring.empty());
+    TEST_ASSERT_EQUAL_UINT32(0, ring.pushed());
+    TEST_ASSERT_EQUAL_UINT32(0, ring.dropped());
+    TEST_ASSERT_EQUAL_UINT16(0, ring.highWater());
+}
+
+// ============================================================================
+// Cross-thread: producer bursts faster than the consumer drains
+// ============================================================================
+
+void test_concurrent_producer_consumer(void) {
+    static SpscRing<Summary, 128> ring;
+    ring.reset();
+    const uint32_t total = 200000;
+    std::atomic<bool> done{false};
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < total; i++) {
+            ring.push(makeSummary(i));
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    Summary batch[16];
+    uint32_t received = 0;
+    int64_t lastSeq = -1;
+    bool ordered = true;
+    bool intact = true;
+    while (true) {
+        uint16_t n = ring.popBatch(batch, 16);
+        for (uint16_t i = 0; i < n; i++) {
+            if ((int64_t)batch[i].seq <= lastSeq) ordered = false;
+            lastSeq = batch[i].seq;
+            if (strcmp(batch[i].ssid, makeSummary(batch[i].seq).ssid) != 0) intact = false;
+        }
+        received += n;
+        if (n == 0 && done.load(std::memory_order_acquire) && ring.empty()) break;
+    }
+    producer.join();
+
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_TRUE(intact);
+    // Every push is either delivered or counted as dropped
+    TEST_ASSERT_EQUAL_UINT32(total, received + ring.dropped());
+    TEST_ASSERT_EQUAL_UINT32(received, ring.pushed());
+    TEST_ASSERT_TRUE(ring.highWater() <= 128);
+}
+
+// ============================================================================
+// Main
+// ============================================================================
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_empty_ring_pops_nothing);
+    RUN_TEST(test_fifo_order);
+    RUN_TEST(test_full_ring_drops_and_counts);
+    RUN_TEST(test_pop_batch_respects_max_and_wraps);
+    RUN_TEST(test_counters_survive_16bit_index_wrap);
+    RUN_TEST(test_reset_clears_state);
+
+    RUN_TEST(test_concurrent_producer_consumer);
+
+    return UNITY_END();
+}
@@ -0,0 +1,572 @@
+// Sync Session Tests
+// Keep-alive reuse, chunked and until-close bodies, reconnects after the
+// server closes, the one-shot resend on a dropped connection, pipelined
+// requests, whole WiGLE / WPA-SEC syncs over one connection, and gzipped
+// WiGLE uploads. The responder stands in for the WPA-SEC and WiGLE APIs.
+
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <WiFi.h>
+#include <host_hal.h>
+#include "../../src/web/sync_session.h"
+#include "../../src/web/wigle.h"
+#include "../../src/web/wpasec.h"
+#include "../../src/core/capture_index.h"
+#include "../../src/core/config.h"
+#include "../../src/core/sd_layout.h"
+
+static char sdRoot[64];
+static char flashRoot[64];
+
+static const char* kWpasecHost = "wpa-sec.stanev.org";
+static const char* kWigleHost = "api.wigle.net";
+
+// Responder knobs
+static bool closeNext;        // Next reply carries "Connection: close"
+static bool dropNext;         // Next reply: peer closes without saying so
+static bool swallowNext;      // Next request: no reply, connection closed
+static uint32_t closeAfterUpload; // That upload's reply carries "Connection: close"
+static std::string rejectName;    // Captures with this in the request get a 400
+static uint32_t uploads;
+static uint32_t statsRequests;
+static uint32_t maxPipelined;     // Most requests answered in one exchange
+static std::string acceptedNames;
+static std::string lastRequest;
+static std::string lastWigleUpload;
+
+static std::string hostPath(const char* sdPath) {
+    return std::string(sdRoot) + sdPath;
+}
+
+static std::string reply(const char* status, const std::string& body, const char* extra = "") {
+    char head[256];
+    snprintf(head, sizeof(head), "HTTP/1.1 %s\r\nContent-Length: %u\r\n%s%s\r\n",
+             status, (unsigned int)body.size(), extra,
+             closeNext ? "Connection: close\r\n" : "");
+    return head + body;
+}
+
+static std::string chunked(const std::string& body, size_t chunk) {
+    std::string out = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n";
+    for (size_t i = 0; i < body.size(); i += chunk) {
+        size_t n = body.size() - i < chunk ? body.size() - i : chunk;
+        char len[16];
+        snprintf(len, sizeof(len), "%zx\r\n", n);
+        out += len;
+        out += body.substr(i, n);
+        out += "\r\n";
+    }
+    return out + "0\r\n\r\n";
+}
+
+// Reply to one request; false when the server closes after it
+static bool respondOne(const std::string& host, const std::string& rq, std::string& out) {
+    lastRequest = rq;
+    if (swallowNext) {
+        swallowNext = false;
+        return false;
+    }
+    if (host == kWpasecHost && rq.compare(0, 11, "POST / HTTP") == 0) {
+        uploads++;
+        if (uploads == closeAfterUpload) closeNext = true;
+        bool reject = !rejectName.empty() && rq.find(rejectName) != std::string::npos;
+        if (reject) {
+            out += reply("400 Bad Request", "bad capture");
+        } else {
+            size_t at = rq.find("filename=\"");
+            acceptedNames += rq.substr(at + 10, rq.find('"', at + 10) - at - 10) + ";";
+            out += reply("200 OK", "capture uploaded");
+        }
+    } else if (host == kWpasecHost && rq.compare(0, 19, "GET /?api&dl=1 HTTP") == 0) {
+        out += chunked("0a0b0c0d0e0f:112233445566:HomeNet:hunter22\n"
+                       "020000000001:112233445566:Cafe:latte123\n", 17);
+    } else if (host == kWigleHost && rq.compare(0, 25, "POST /api/v2/file/upload ") == 0) {
+        uploads++;
+        lastWigleUpload = rq;
+        out += reply("200 OK", "{\"success\":true}");
+    } else if (host == kWigleHost && rq.compare(0, 23, "GET /api/v2/stats/user ") == 0) {
+        statsRequests++;
+        out += reply("200 OK",
+            "{\"success\":true,\"statistics\":{\"rank\":42,\"discoveredWiFi\":1000,"
+            "\"discoveredWiFiGPS\":900,\"totalWiFiLocations\":5000}}");
+    } else if (rq.compare(0, 10, "GET /close") == 0) {
+        // Body runs until the server closes the connection
+        out += "HTTP/1.1 200 OK\r\nConnection: close\r\n\r\nall of it";
+        return false;
+    } else {
+        out += reply("404 Not Found", "nope");
+    }
+    bool open = !closeNext && !dropNext;
+    closeNext = false;
+    dropNext = false;
+    return open;
+}
+
+// Pipelined requests arrive together: answer them in order
+static void respond(HostHal::NetExchange& ex) {
+    std::string buf = ex.request;
+    uint32_t n = 0;
+    ex.keepOpen = true;
+    while (ex.keepOpen) {
+        size_t headEnd = buf.find("\r\n\r\n");
+        if (headEnd == std::string::npos) break;
+        size_t bodyLen = 0;
+        size_t cl = buf.find("Content-Length: ");
+        if (cl != std::string::npos && cl < headEnd) bodyLen = strtoul(buf.c_str() + cl + 16, nullptr, 10);
+        size_t total = headEnd + 4 + bodyLen;
+        ex.keepOpen = respondOne(ex.host, buf.substr(0, total), ex.response);
+        buf.erase(0, total);
+        n++;
+    }
+    if (n > maxPipelined) maxPipelined = n;
+}
+
+void setUp(void) {
+    closeNext = false;
+    dropNext = false;
+    swallowNext = false;
+    closeAfterUpload = 0;
+    rejectName.clear();
+    uploads = 0;
+    statsRequests = 0;
+    maxPipelined = 0;
+    acceptedNames.clear();
+    lastRequest.clear();
+    lastWigleUpload.clear();
+    HostHal::setStationLink(true);
+    WiFi.begin("ssid", "pass");
+    HostHal::setNetResponder(respond);
+    HostHal::resetNetStats();
+}
+
+void tearDown(void) {
+    HostHal::setNetResponder(nullptr);
+}
+
+static int post(SyncSession& s, const char* path, const char* body) {
+    TEST_ASSERT_TRUE(s.begin("POST", path));
+    s.header("Content-Type", "text/plain");
+    TEST_ASSERT_TRUE(s.endHeaders((long)strlen(body)));
+    TEST_ASSERT_TRUE(s.print(body));
+    return s.awaitResponse(5000);
+}
+
+static std::string readAll(SyncSession& s) {
+    std::string out;
+    uint8_t buf[7];
+    size_t n;
+    while ((n = s.read(buf, sizeof(buf), 1000)) > 0) out.append((const char*)buf, n);
+    return out;
+}
+
+void test_requests_share_one_connection(void) {
+    SyncSession s(kWpasecHost, 443, "TEST");
+    for (int i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL(200, post(s, "/", "capture bytes"));
+        TEST_ASSERT_EQUAL_STRING("capture uploaded", readAll(s).c_str());
+        s.end();
+        TEST_ASSERT_TRUE(s.isConnected());
+    }
+    TEST_ASSERT_EQUAL_UINT32(5, uploads);
+    TEST_ASSERT_EQUAL_UINT32(1, HostHal::getNetStats().connects);
+    TEST_ASSERT_EQUAL_UINT16(5, s.requestCount());
+    TEST_ASSERT_EQUAL_UINT16(1, s.handshakeCount());
+}
+
+void test_request_headers(void) {
+    SyncSession s(kWpasecHost, 443, "TEST");
+    TEST_ASSERT_EQUAL(200, post(s, "/", "abc"));
+    s.end();
+    TEST_ASSERT_TRUE(lastRequest.find("POST / HTTP/1.1\r\n") == 0);
+    TEST_ASSERT_TRUE(lastRequest.find("Host: wpa-sec.stanev.org\r\n") != std::string::npos);
+    TEST_ASSERT_TRUE(lastRequest.find("Connection: keep-alive\r\n") != std::string::npos);
+    TEST_ASSERT_TRUE(lastRequest.find("Content-Length: 3\r\n") != std::string::npos);
+    TEST_ASSERT_TRUE(lastRequest.find("\r\n\r\nabc") != std::string::npos);
+}
+
+void test_chunked_body_lines(void) {
+    SyncSession s(kWpasecHost, 443, "TEST");
+    TEST_ASSERT_TRUE(s.begin("GET", "/?api&dl=1"));
+    TEST_ASSERT_TRUE(s.endHeaders(-1));
+    TEST_ASSERT_EQUAL(200, s.awaitResponse(5000));
+
+    char line[128];
+    size_t len = 0;
+    TEST_ASSERT_TRUE(s.readLine(line, sizeof(line), len));
+    TEST_ASSERT_EQUAL_STRING("0a0b0c0d0e0f:112233445566:HomeNet:hunter22", line);
+    TEST_ASSERT_TRUE(s.readLine(line, sizeof(line), len));
+    TEST_ASSERT_EQUAL_STRING("020000000001:112233445566:Cafe:latte123", line);
+    TEST_ASSERT_FALSE(s.readLine(line, sizeof(line), len));
+    s.end();
+
+    // The chunked body was consumed exactly: the connection is reusable
+    TEST_ASSERT_EQUAL(200, post(s, "/", "x"));
+    s.end();
+    TEST_ASSERT_EQUAL_UINT32(1, HostHal::getNetStats().connects);
+}
+
+void test_unread_body_is_drained(void) {
+    SyncSession s(kWpasecHost, 443, "TEST");
+    TEST_ASSERT_TRUE(s.begin("GET", "/?api&dl=1"));
+    TEST_ASSERT_TRUE(s.endHeaders(-1));
+    TEST_ASSERT_EQUAL(200, s.awaitResponse(5000));
+    s.end();
+    TEST_ASSERT_EQUAL(200, post(s, "/", "x"));
+    TEST_ASSERT_EQUAL_STRING("capture uploaded", readAll(s).c_str());
+    s.end();
+    TEST_ASSERT_EQUAL_UINT32(1, HostHal::getNetStats().connects);
+}
+
+void test_connection_close_reconnects(void) {
+    SyncSession s(kWigleHost, 443, "TEST");
+    closeNext = true;
+    TEST_ASSERT_EQUAL(200, post(s, "/api/v2/file/upload", "csv"));
+    s.end();
+    TEST_ASSERT_FALSE(s.isConnected());
+
+    TEST_ASSERT_EQUAL(200, post(s, "/api/v2/file/upload", "csv"));
+    s.end();
+    TEST_ASSERT_FALSE(s.lastTiming().reused);
+    TEST_ASSERT_EQUAL_UINT32(2, HostHal::getNetStats().connects);
+    TEST_ASSERT_EQUAL_UINT16(2, s.handshakeCount());
+}
+
+void test_dropped_connection_reconnects(void) {
+    SyncSession s(kWigleHost, 443, "TEST");
+    dropNext = true;
+    TEST_ASSERT_EQUAL(200, post(s, "/api/v2/file/upload", "csv"));
+    s.end();
+    // Server went away without a header: the next begin() notices
+    TEST_ASSERT_EQUAL(200, post(s, "/api/v2/file/upload", "csv"));
+    s.end();
+    TEST_ASSERT_EQUAL_UINT32(2, uploads);
+    TEST_ASSERT_EQUAL_UINT32(2, HostHal::getNetStats().connects);
+}
+
+void test_silent_close_on_reuse_is_retryable(void) {
+    SyncSession s(kWpasecHost, 443, "TEST");
+    TEST_ASSERT_EQUAL(200, post(s, "/", "one"));
+    s.end();
+
+    swallowNext = true;
+    TEST_ASSERT_EQUAL(0, post(s, "/", "two"));
+    TEST_ASSERT_TRUE(s.shouldRetry());
+    s.end();
+    TEST_ASSERT_FALSE(s.isConnected());
+
+    TEST_ASSERT_EQUAL(200, post(s, "/", "two"));
+    TEST_ASSERT_FALSE(s.shouldRetry());
+    s.end();
+    TEST_ASSERT_EQUAL_UINT32(2, uploads);
+}
+
+void test_no_response_on_new_connection_is_not_retryable(void) {
+    SyncSession s(kWpasecHost, 443, "TEST");
+    swallowNext = true;
+    TEST_ASSERT_EQUAL(0, post(s, "/", "one"));
+    TEST_ASSERT_FALSE(s.shouldRetry());
+    s.end();
+}
+
+void test_body_until_close(void) {
+    SyncSession s(kWpasecHost, 443, "TEST");
+    TEST_ASSERT_TRUE(s.begin("GET", "/close"));
+    TEST_ASSERT_TRUE(s.endHeaders(-1));
+    TEST_ASSERT_EQUAL(200, s.awaitResponse(5000));
+    TEST_ASSERT_EQUAL_STRING("all of it", readAll(s).c_str());
+    s.end();
+    TEST_ASSERT_FALSE(s.isConnected());
+}
+
+void test_timing_marks_reuse(void) {
+    SyncSession s(kWpasecHost, 443, "TEST");
+    TEST_ASSERT_EQUAL(200, post(s, "/", "a"));
+    s.end();
+    TEST_ASSERT_FALSE(s.lastTiming().reused);
+    TEST_ASSERT_EQUAL(200, post(s, "/", "b"));
+    s.end();
+    TEST_ASSERT_TRUE(s.lastTiming().reused);
+    TEST_ASSERT_EQUAL_UINT32(0, s.lastTiming().connectMs);
+}
+
+void test_idle_connection_is_replaced(void) {
+    SyncSession s(kWpasecHost, 443, "TEST");
+    TEST_ASSERT_EQUAL(200, post(s, "/", "a"));
+    s.end();
+    delay(SyncSession::kIdleCloseMs + 1000);
+    TEST_ASSERT_EQUAL(200, post(s, "/", "b"));
+    s.end();
+    TEST_ASSERT_FALSE(s.lastTiming().reused);
+    TEST_ASSERT_EQUAL_UINT32(2, HostHal::getNetStats().connects);
+}
+
+void test_wigle_sync_uses_one_connection(void) {
+    strncpy(Config::wifi().wigleApiName, "AIDtest", sizeof(Config::wifi().wigleApiName) - 1);
+    strncpy(Config::wifi().wigleApiToken, "token", sizeof(Config::wifi().wigleApiToken) - 1);
+    for (int i = 0; i < 3; i++) {
+        char path[160];
+        snprintf(path, sizeof(path), "%s/run%d.wigle.csv",
+                 hostPath(SDLayout::wardrivingDir()).c_str(), i);
+        FILE* f = fopen(path, "wb");
+        TEST_ASSERT_NOT_NULL(f);
+        fputs("WigleWifi-1.6\nMAC,SSID\n", f);
+        fclose(f);
+    }
+
+    WigleSyncResult r = WiGLE::syncFiles(nullptr);
+    TEST_ASSERT_TRUE(r.success);
+    TEST_ASSERT_EQUAL_UINT32(3, r.uploaded);
+    TEST_ASSERT_TRUE(r.statsFetched);
+    TEST_ASSERT_EQUAL_UINT32(3, uploads);
+    TEST_ASSERT_EQUAL_UINT32(1, statsRequests);
+    TEST_ASSERT_EQUAL_UINT32(1, HostHal::getNetStats().connects);
+}
+
+// A WiGLE CSV big enough to compress: rows differ, the columns repeat
+static std::string writeWigleCsv(const char* name) {
+    std::string csv = "WigleWifi-1.6,appRelease=porkchop,model=M5Cardputer\n"
+                      "MAC,SSID,AuthMode,FirstSeen,Channel,RSSI,CurrentLatitude,CurrentLongitude,Type\n";
+    char line[160];
+    for (int i = 0; csv.size() < 60000; i++) {
+        snprintf(line, sizeof(line),
+                 "AA:BB:CC:%02X:%02X:%02X,Net%d,[WPA2-PSK-CCMP][ESS],2026-10-16 12:%02d:%02d,%d,-%d,"
+                 "52.%06d,4.%06d,WIFI\n",
+                 (i * 37) & 0xFF, (i * 11) & 0xFF, i & 0xFF, i % 97, i / 60 % 60, i % 60,
+                 1 + i % 11, 40 + i % 50, 370000 + i * 13 % 9000, 890000 + i * 7 % 9000);
+        csv += line;
+    }
+    std::string path = hostPath(SDLayout::wardrivingDir()) + "/" + name;
+    FILE* f = fopen(path.c_str(), "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    fwrite(csv.data(), 1, csv.size(), f);
+    fclose(f);
+    return csv;
+}
+
+// File name and bytes of the multipart upload in a request
+static std::string uploadPart(const std::string& rq, std::string& filename) {
+    size_t at = rq.find("filename=\"");
+    TEST_ASSERT_TRUE(at != std::string::npos);
+    filename = rq.substr(at + 10, rq.find('"', at + 10) - at - 10);
+    size_t start = rq.find("\r\n\r\n", at) + 4;
+    return rq.substr(start, rq.rfind("\r\n--") - start);
+}
+
+void test_wigle_upload_is_gzipped(void) {
+    std::string csv = writeWigleCsv("big.wigle.csv");
+    WigleSyncResult r = WiGLE::syncFiles(nullptr);
+    TEST_ASSERT_EQUAL_UINT32(1, r.uploaded);
+    TEST_ASSERT_TRUE(r.statsFetched);    // Content-Length matched the body
+    TEST_ASSERT_EQUAL_UINT32(1, HostHal::getNetStats().connects);
+
+    std::string name;
+    std::string gz = uploadPart(lastWigleUpload, name);
+    TEST_ASSERT_EQUAL_STRING("big.wigle.csv.gz", name.c_str());
+    TEST_ASSERT_TRUE(lastWigleUpload.find("Content-Type: application/gzip") != std::string::npos);
+    TEST_ASSERT_TRUE(gz.size() * 3 < csv.size());
+
+    std::string gzPath = std::string(sdRoot) + "/upload.gz";
+    FILE* f = fopen(gzPath.c_str(), "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    fwrite(gz.data(), 1, gz.size(), f);
+    fclose(f);
+    FILE* p = popen(("gzip -dc '" + gzPath + "'").c_str(), "r");
+    TEST_ASSERT_NOT_NULL(p);
+    std::string out;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), p)) > 0) out.append(buf, n);
+    TEST_ASSERT_EQUAL_INT(0, pclose(p));
+    TEST_ASSERT_TRUE(out == csv);
+    TEST_ASSERT_TRUE(WiGLE::isUploaded("big.wigle.csv"));
+}
+
+void test_wigle_upload_plain_when_heap_is_tight(void) {
+    // Enough for TLS, not for the encoder beside it
+    HostHal::setFreeHeap(200000, HeapPolicy::kProactiveTlsConditioning + 1000);
+    std::string csv = writeWigleCsv("tight.wigle.csv");
+    WigleSyncResult r = WiGLE::syncFiles(nullptr);
+    HostHal::setFreeHeap(200000, 110000);
+    TEST_ASSERT_EQUAL_UINT32(1, r.uploaded);
+
+    std::string name;
+    std::string body = uploadPart(lastWigleUpload, name);
+    TEST_ASSERT_EQUAL_STRING("tight.wigle.csv", name.c_str());
+    TEST_ASSERT_TRUE(lastWigleUpload.find("Content-Type: text/csv") != std::string::npos);
+    TEST_ASSERT_TRUE(body == csv);
+}
+
+static void queuePost(SyncSession& s, const char* body) {
+    TEST_ASSERT_TRUE(s.queue("POST", "/"));
+    TEST_ASSERT_TRUE(s.endHeaders((long)strlen(body)));
+    TEST_ASSERT_TRUE(s.print(body));
+}
+
+void test_queued_requests_answer_in_order(void) {
+    SyncSession s(kWpasecHost, 443, "TEST");
+    queuePost(s, "one");
+    queuePost(s, "two");
+    queuePost(s, "three");
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL(200, s.awaitResponse(5000));
+        TEST_ASSERT_EQUAL_STRING("capture uploaded", readAll(s).c_str());
+        s.end();
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, uploads);
+    TEST_ASSERT_EQUAL_UINT32(3, maxPipelined);
+    TEST_ASSERT_EQUAL_UINT32(1, HostHal::getNetStats().connects);
+    TEST_ASSERT_TRUE(s.isConnected());
+}
+
+void test_queued_requests_keep_their_own_timing(void) {
+    SyncSession s(kWpasecHost, 443, "TEST");
+    uint32_t sentAt[3];
+    for (int i = 0; i < 3; i++) {
+        sentAt[i] = millis();
+        queuePost(s, "x");
+        HostHal::advanceMillis(100);
+    }
+    for (int i = 0; i < 3; i++) {
+        uint32_t waitFrom = millis();
+        TEST_ASSERT_EQUAL(200, s.awaitResponse(5000));
+        // Measured from this request's own start, not the last one queued
+        TEST_ASSERT_EQUAL_UINT32(waitFrom - sentAt[i], s.lastTiming().sendMs);
+        TEST_ASSERT_EQUAL(i > 0, s.lastTiming().reused);
+        if (i > 0) TEST_ASSERT_EQUAL_UINT32(0, s.lastTiming().connectMs);
+        s.end();
+    }
+}
+
+void test_queue_refuses_past_max_in_flight(void) {
+    SyncSession s(kWpasecHost, 443, "TEST");
+    for (uint8_t i = 0; i < SyncSession::kMaxInFlight; i++) queuePost(s, "x");
+    TEST_ASSERT_FALSE(s.queue("POST", "/"));
+    TEST_ASSERT_FALSE(s.shouldRetry());
+    for (uint8_t i = 0; i < SyncSession::kMaxInFlight; i++) {
+        TEST_ASSERT_EQUAL(200, s.awaitResponse(5000));
+        s.end();
+    }
+    TEST_ASSERT_EQUAL_UINT32(SyncSession::kMaxInFlight, uploads);
+}
+
+void test_close_mid_pipeline_is_retryable(void) {
+    SyncSession s(kWpasecHost, 443, "TEST");
+    closeAfterUpload = 2;
+    queuePost(s, "one");
+    queuePost(s, "two");
+    queuePost(s, "three");
+    TEST_ASSERT_EQUAL(200, s.awaitResponse(5000));
+    s.end();
+    TEST_ASSERT_EQUAL(200, s.awaitResponse(5000));
+    s.end();
+    // The server stopped after the second reply: the third never ran
+    TEST_ASSERT_EQUAL(0, s.awaitResponse(1000));
+    TEST_ASSERT_TRUE(s.shouldRetry());
+    s.end();
+    TEST_ASSERT_EQUAL_UINT32(2, uploads);
+}
+
+static void writeCapture(const char* name) {
+    std::string path = hostPath(SDLayout::handshakesDir()) + "/" + name;
+    FILE* f = fopen(path.c_str(), "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    std::string body(3000, 'h');
+    fwrite(body.data(), 1, body.size(), f);
+    fclose(f);
+}
+
+void test_wpasec_sync_pipelines_uploads(void) {
+    strncpy(Config::wifi().wpaSecKey, "0123456789abcdef0123456789abcdef",
+            sizeof(Config::wifi().wpaSecKey) - 1);
+    for (int i = 0; i < 6; i++) {
+        char name[48];
+        snprintf(name, sizeof(name), "Net%d_02000000000%d_hs.22000", i, i);
+        writeCapture(name);
+    }
+    CaptureIndex::invalidate();   // Written behind the index's back
+
+    WPASecSyncResult r = WPASec::syncCaptures(nullptr);
+    TEST_ASSERT_TRUE(r.success);
+    TEST_ASSERT_EQUAL_UINT8(6, r.uploaded);
+    TEST_ASSERT_EQUAL_UINT8(0, r.failed);
+    TEST_ASSERT_EQUAL_UINT16(2, r.cracked);
+    TEST_ASSERT_EQUAL_UINT32(6, uploads);
+    TEST_ASSERT_EQUAL_UINT32(4, maxPipelined);
+    TEST_ASSERT_EQUAL_UINT32(1, HostHal::getNetStats().connects);
+    TEST_ASSERT_TRUE(WPASec::isUploaded("02:00:00:00:00:05"));
+}
+
+void test_wpasec_partial_failure_marks_only_accepted(void) {
+    for (int i = 6; i < 12; i++) {
+        char name[48];
+        snprintf(name, sizeof(name), "Net%d_0200000000%02d_hs.22000", i, i);
+        writeCapture(name);
+    }
+    CaptureIndex::invalidate();
+    rejectName = "Net8_";
+    closeAfterUpload = 2;   // Drops the rest of the first window
+
+    WPASecSyncResult r = WPASec::syncCaptures(nullptr);
+    TEST_ASSERT_EQUAL_UINT8(6, r.skipped);
+    TEST_ASSERT_EQUAL_UINT8(5, r.uploaded);
+    TEST_ASSERT_EQUAL_UINT8(1, r.failed);
+    TEST_ASSERT_EQUAL_UINT32(2, HostHal::getNetStats().connects);
+    // Each accepted capture reached the server once
+    for (int i = 6; i < 12; i++) {
+        char name[24];
+        snprintf(name, sizeof(name), "Net%d_", i);
+        size_t first = acceptedNames.find(name);
+        TEST_ASSERT_TRUE((i == 8) == (first == std::string::npos));
+        if (first != std::string::npos) {
+            TEST_ASSERT_TRUE(acceptedNames.find(name, first + 1) == std::string::npos);
+        }
+    }
+    TEST_ASSERT_TRUE(WPASec::isUploaded("02:00:00:00:00:07"));
+    TEST_ASSERT_TRUE(WPASec::isUploaded("02:00:00:00:00:11"));
+    TEST_ASSERT_FALSE(WPASec::isUploaded("02:00:00:00:00:08"));
+}
+
+int main(void) {
+    strcpy(sdRoot, "/tmp/porkchop_sync_sd_XXXXXX");
+    strcpy(flashRoot, "/tmp/porkchop_sync_flash_XXXXXX");
+    if (!mkdtemp(sdRoot) || !mkdtemp(flashRoot)) return 1;
+    HostHal::mountSD(sdRoot);
+    HostHal::mountSPIFFS(flashRoot);
+    Config::init();
+    std::string mk = "mkdir -p " + hostPath(SDLayout::metaDir()) + " " +
+                     hostPath(SDLayout::wardrivingDir()) + " " +
+                     hostPath(SDLayout::handshakesDir()) + " " +
+                     hostPath(SDLayout::wpaSecDir());
+    (void)system(mk.c_str());
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_requests_share_one_connection);
+    RUN_TEST(test_request_headers);
+    RUN_TEST(test_chunked_body_lines);
+    RUN_TEST(test_unread_body_is_drained);
+    RUN_TEST(test_connection_close_reconnects);
+    RUN_TEST(test_dropped_connection_reconnects);
+    RUN_TEST(test_silent_close_on_reuse_is_retryable);
+    RUN_TEST(test_no_response_on_new_connection_is_not_retryable);
+    RUN_TEST(test_body_until_close);
+    RUN_TEST(test_timing_marks_reuse);
+    RUN_TEST(test_idle_connection_is_replaced);
+    RUN_TEST(test_wigle_sync_uses_one_connection);
+    RUN_TEST(test_wigle_upload_is_gzipped);
+    RUN_TEST(test_wigle_upload_plain_when_heap_is_tight);
+    RUN_TEST(test_queued_requests_answer_in_order);
+    RUN_TEST(test_queued_requests_keep_their_own_timing);
+    RUN_TEST(test_queue_refuses_past_max_in_flight);
+    RUN_TEST(test_close_mid_pipeline_is_retryable);
+    RUN_TEST(test_wpasec_sync_pipelines_uploads);
+    RUN_TEST(test_wpasec_partial_failure_marks_only_accepted);
+
+    int rc = UNITY_END();
+    std::string rm = std::string("rm -rf ") + sdRoot + " " + flashRoot;
+    (void)system(rm.c_str());
+    return rc;
+}
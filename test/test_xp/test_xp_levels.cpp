@@ -1,9 +1,12 @@
 // XP Level Calculation Tests
-// Tests the core XP/leveling system math
+// Tests the core XP/leveling system math (real XP:: statics from src/core/xp.cpp)
 
 #include <unity.h>
+#include "../../src/core/xp.h"
 #include "../mocks/testable_functions.h"
 
+static const uint8_t MAX_LEVEL = 50;
+
 void setUp(void) {
     // No setup needed for pure function tests
 }
@@ -17,63 +20,63 @@ void tearDown(void) {
 // ============================================================================
 
 void test_calculateLevel_at_0_xp_is_level_1(void) {
-    TEST_ASSERT_EQUAL_UINT8(1, calculateLevel(0));
+    TEST_ASSERT_EQUAL_UINT8(1, XP::calculateLevel(0));
 }
 
 void test_calculateLevel_at_99_xp_is_level_1(void) {
-    TEST_ASSERT_EQUAL_UINT8(1, calculateLevel(99));
+    TEST_ASSERT_EQUAL_UINT8(1, XP::calculateLevel(99));
 }
 
 void test_calculateLevel_at_100_xp_is_level_2(void) {
-    TEST_ASSERT_EQUAL_UINT8(2, calculateLevel(100));
+    TEST_ASSERT_EQUAL_UINT8(2, XP::calculateLevel(100));
 }
 
 void test_calculateLevel_at_101_xp_is_level_2(void) {
-    TEST_ASSERT_EQUAL_UINT8(2, calculateLevel(101));
+    TEST_ASSERT_EQUAL_UINT8(2, XP::calculateLevel(101));
 }
 
 void test_calculateLevel_at_299_xp_is_level_2(void) {
-    TEST_ASSERT_EQUAL_UINT8(2, calculateLevel(299));
+    TEST_ASSERT_EQUAL_UINT8(2, XP::calculateLevel(299));
 }
 
 void test_calculateLevel_at_300_xp_is_level_3(void) {
-    TEST_ASSERT_EQUAL_UINT8(3, calculateLevel(300));
+    TEST_ASSERT_EQUAL_UINT8(3, XP::calculateLevel(300));
 }
 
 void test_calculateLevel_at_600_xp_is_level_4(void) {
-    TEST_ASSERT_EQUAL_UINT8(4, calculateLevel(600));
+    TEST_ASSERT_EQUAL_UINT8(4, XP::calculateLevel(600));
 }
 
 void test_calculateLevel_at_1000_xp_is_level_5(void) {
-    TEST_ASSERT_EQUAL_UINT8(5, calculateLevel(1000));
+    TEST_ASSERT_EQUAL_UINT8(5, XP::calculateLevel(1000));
 }
 
 void test_calculateLevel_at_midgame_50000_xp(void) {
     // 49000 is level 20, 56000 is level 21
-    TEST_ASSERT_EQUAL_UINT8(20, calculateLevel(50000));
+    TEST_ASSERT_EQUAL_UINT8(20, XP::calculateLevel(50000));
 }
 
 void test_calculateLevel_at_599999_xp_is_level_39(void) {
-    TEST_ASSERT_EQUAL_UINT8(39, calculateLevel(599999));
+    TEST_ASSERT_EQUAL_UINT8(39, XP::calculateLevel(599999));
 }
 
 void test_calculateLevel_at_600000_xp_is_level_40(void) {
-    TEST_ASSERT_EQUAL_UINT8(40, calculateLevel(600000));
+    TEST_ASSERT_EQUAL_UINT8(40, XP::calculateLevel(600000));
 }
 
 void test_calculateLevel_at_1850000_xp_is_level_50(void) {
-    TEST_ASSERT_EQUAL_UINT8(50, calculateLevel(1850000));
+    TEST_ASSERT_EQUAL_UINT8(50, XP::calculateLevel(1850000));
 }
 
 void test_calculateLevel_at_max_uint32_is_level_50(void) {
-    TEST_ASSERT_EQUAL_UINT8(50, calculateLevel(UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT8(50, XP::calculateLevel(UINT32_MAX));
 }
 
 void test_calculateLevel_all_boundaries(void) {
     // Test each level boundary
     for (uint8_t level = 1; level <= MAX_LEVEL; level++) {
-        uint32_t threshold = XP_THRESHOLDS[level - 1];
-        TEST_ASSERT_EQUAL_UINT8(level, calculateLevel(threshold));
+        uint32_t threshold = XP::getXPForLevel(level);
+        TEST_ASSERT_EQUAL_UINT8(level, XP::calculateLevel(threshold));
     }
 }
 
@@ -82,33 +85,33 @@ void test_calculateLevel_all_boundaries(void) {
 // ============================================================================
 
 void test_getXPForLevel_level_1_is_0(void) {
-    TEST_ASSERT_EQUAL_UINT32(0, getXPForLevel(1));
+    TEST_ASSERT_EQUAL_UINT32(0, XP::getXPForLevel(1));
 }
 
 void test_getXPForLevel_level_2_is_100(void) {
-    TEST_ASSERT_EQUAL_UINT32(100, getXPForLevel(2));
+    TEST_ASSERT_EQUAL_UINT32(100, XP::getXPForLevel(2));
 }
 
 void test_getXPForLevel_level_40_is_600000(void) {
-    TEST_ASSERT_EQUAL_UINT32(600000, getXPForLevel(40));
+    TEST_ASSERT_EQUAL_UINT32(600000, XP::getXPForLevel(40));
 }
 
 void test_getXPForLevel_level_50_is_1850000(void) {
-    TEST_ASSERT_EQUAL_UINT32(1850000, getXPForLevel(50));
+    TEST_ASSERT_EQUAL_UINT32(1850000, XP::getXPForLevel(50));
 }
 
 void test_getXPForLevel_level_0_returns_0(void) {
-    TEST_ASSERT_EQUAL_UINT32(0, getXPForLevel(0));
+    TEST_ASSERT_EQUAL_UINT32(0, XP::getXPForLevel(0));
 }
 
 void test_getXPForLevel_level_51_returns_0(void) {
     // Level 51 is beyond MAX_LEVEL, should clamp to MAX_LEVEL (1850000)
-    TEST_ASSERT_EQUAL_UINT32(1850000, getXPForLevel(51));
+    TEST_ASSERT_EQUAL_UINT32(1850000, XP::getXPForLevel(51));
 }
 
 void test_getXPForLevel_level_255_returns_0(void) {
     // Level 255 is beyond MAX_LEVEL, should clamp to MAX_LEVEL (1850000)
-    TEST_ASSERT_EQUAL_UINT32(1850000, getXPForLevel(255));
+    TEST_ASSERT_EQUAL_UINT32(1850000, XP::getXPForLevel(255));
 }
 
 // ============================================================================
@@ -117,57 +120,57 @@ void test_getXPForLevel_level_255_returns_0(void) {
 
 void test_getXPToNextLevel_at_0_xp(void) {
     // At 0 XP (level 1), need 100 XP to reach level 2
-    TEST_ASSERT_EQUAL_UINT32(100, getXPToNextLevel(0));
+    TEST_ASSERT_EQUAL_UINT32(100, XP::getXPToNextLevel(0));
 }
 
 void test_getXPToNextLevel_at_50_xp(void) {
     // At 50 XP (level 1), need 50 more XP to reach level 2
-    TEST_ASSERT_EQUAL_UINT32(50, getXPToNextLevel(50));
+    TEST_ASSERT_EQUAL_UINT32(50, XP::getXPToNextLevel(50));
 }
 
 void test_getXPToNextLevel_at_100_xp(void) {
     // At 100 XP (level 2), need 200 more XP to reach level 3 (threshold 300)
-    TEST_ASSERT_EQUAL_UINT32(200, getXPToNextLevel(100));
+    TEST_ASSERT_EQUAL_UINT32(200, XP::getXPToNextLevel(100));
 }
 
 void test_getXPToNextLevel_at_max_level(void) {
     // At max level (50), returns 0 (no next level)
-    TEST_ASSERT_EQUAL_UINT32(0, getXPToNextLevel(1850000));
+    TEST_ASSERT_EQUAL_UINT32(0, XP::getXPToNextLevel(1850000));
 }
 
 void test_getXPToNextLevel_beyond_max_level(void) {
     // Beyond max level XP, still returns 0
-    TEST_ASSERT_EQUAL_UINT32(0, getXPToNextLevel(2000000));
+    TEST_ASSERT_EQUAL_UINT32(0, XP::getXPToNextLevel(2000000));
 }
 
 // ============================================================================
-// getLevelProgress() tests
+// getProgress() tests
 // ============================================================================
 
 void test_getLevelProgress_at_level_start_is_0(void) {
-    TEST_ASSERT_EQUAL_UINT8(0, getLevelProgress(0));
-    TEST_ASSERT_EQUAL_UINT8(0, getLevelProgress(100));  // Start of level 2
-    TEST_ASSERT_EQUAL_UINT8(0, getLevelProgress(300));  // Start of level 3
+    TEST_ASSERT_EQUAL_UINT8(0, XP::getProgress(0));
+    TEST_ASSERT_EQUAL_UINT8(0, XP::getProgress(100));  // Start of level 2
+    TEST_ASSERT_EQUAL_UINT8(0, XP::getProgress(300));  // Start of level 3
 }
 
 void test_getLevelProgress_at_50_percent(void) {
     // Level 1 is 0-99 XP (100 XP range), 50 XP is 50%
-    TEST_ASSERT_EQUAL_UINT8(50, getLevelProgress(50));
+    TEST_ASSERT_EQUAL_UINT8(50, XP::getProgress(50));
 }
 
 void test_getLevelProgress_at_level_2_midpoint(void) {
     // Level 2 is 100-299 XP (200 XP range), 200 XP is 50%
-    TEST_ASSERT_EQUAL_UINT8(50, getLevelProgress(200));
+    TEST_ASSERT_EQUAL_UINT8(50, XP::getProgress(200));
 }
 
 void test_getLevelProgress_at_99_percent(void) {
     // Level 1: 99 XP should be 99%
-    TEST_ASSERT_EQUAL_UINT8(99, getLevelProgress(99));
+    TEST_ASSERT_EQUAL_UINT8(99, XP::getProgress(99));
 }
 
 void test_getLevelProgress_at_max_level_is_100(void) {
-    TEST_ASSERT_EQUAL_UINT8(100, getLevelProgress(1850000));
-    TEST_ASSERT_EQUAL_UINT8(100, getLevelProgress(2000000));
+    TEST_ASSERT_EQUAL_UINT8(100, XP::getProgress(1850000));
+    TEST_ASSERT_EQUAL_UINT8(100, XP::getProgress(2000000));
 }
 
 // ============================================================================
@@ -0,0 +1,233 @@
+// ZIP Stream Tests
+// CRC32, archive layout, and archives written through the encoder checked
+// with the system unzip (-t integrity test, -p content round trip).
+
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <host_hal.h>
+#include "../../src/web/zip_stream.h"
+#include "../../src/core/config.h"
+
+static char sdRoot[64];
+static char flashRoot[64];
+static char workDir[64];
+
+struct Capture {
+    std::vector<uint8_t> bytes;
+    size_t failAfter;   // Sink refuses writes past this many bytes
+};
+
+static bool captureSink(const uint8_t* data, size_t len, void* ctx) {
+    Capture& cap = *static_cast<Capture*>(ctx);
+    if (cap.bytes.size() + len > cap.failAfter) return false;
+    cap.bytes.insert(cap.bytes.end(), data, data + len);
+    return true;
+}
+
+static std::string saveArchive(const Capture& cap, const char* name) {
+    std::string path = std::string(workDir) + "/" + name;
+    FILE* f = fopen(path.c_str(), "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    fwrite(cap.bytes.data(), 1, cap.bytes.size(), f);
+    fclose(f);
+    return path;
+}
+
+static int run(const std::string& cmd) {
+    return system((cmd + " >/dev/null 2>&1").c_str());
+}
+
+static std::string unzipEntry(const std::string& zipPath, const char* entry) {
+    std::string cmd = "unzip -p '" + zipPath + "' '" + entry + "'";
+    FILE* p = popen(cmd.c_str(), "r");
+    TEST_ASSERT_NOT_NULL(p);
+    std::string out;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), p)) > 0) out.append(buf, n);
+    pclose(p);
+    return out;
+}
+
+static bool spillExists() {
+    std::string path = std::string(sdRoot) + "/zip_cd.tmp";
+    FILE* f = fopen(path.c_str(), "rb");
+    if (f) fclose(f);
+    return f != nullptr;
+}
+
+static uint32_t le32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// ============================================================================
+// Primitives and layout
+// ============================================================================
+
+void test_crc32_known_vectors(void) {
+    TEST_ASSERT_EQUAL_HEX32(0, ZipStream::crc32(0, nullptr, 0));
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, ZipStream::crc32(0, (const uint8_t*)"123456789", 9));
+    // Incremental == one shot
+    uint32_t crc = ZipStream::crc32(0, (const uint8_t*)"1234", 4);
+    crc = ZipStream::crc32(crc, (const uint8_t*)"56789", 5);
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, crc);
+}
+
+void test_empty_archive_is_end_record_only(void) {
+    ZipStream zip;
+    Capture cap = {{}, SIZE_MAX};
+    TEST_ASSERT_TRUE(zip.begin(captureSink, &cap, "/zip_cd.tmp"));
+    TEST_ASSERT_TRUE(zip.finish());
+    TEST_ASSERT_EQUAL_UINT32(22, cap.bytes.size());
+    TEST_ASSERT_EQUAL_HEX32(0x06054B50, le32(cap.bytes.data()));
+    TEST_ASSERT_FALSE(spillExists());
+}
+
+void test_entry_layout_uses_data_descriptor(void) {
+    ZipStream zip;
+    Capture cap = {{}, SIZE_MAX};
+    TEST_ASSERT_TRUE(zip.begin(captureSink, &cap, "/zip_cd.tmp"));
+    TEST_ASSERT_TRUE(zip.beginEntry("a.txt", 0));
+    TEST_ASSERT_TRUE(zip.write((const uint8_t*)"123456789", 9));
+    TEST_ASSERT_TRUE(zip.endEntry());
+    TEST_ASSERT_TRUE(zip.finish());
+    TEST_ASSERT_EQUAL_UINT16(1, zip.entries());
+
+    const uint8_t* b = cap.bytes.data();
+    TEST_ASSERT_EQUAL_HEX32(0x04034B50, le32(b));
+    TEST_ASSERT_EQUAL_HEX8(0x08, b[6] & 0x08);          // Descriptor flag
+    TEST_ASSERT_EQUAL_HEX32(0, le32(b + 14));           // CRC deferred
+    // Local header, name, data, then the descriptor
+    const uint8_t* desc = b + 30 + 5 + 9;
+    TEST_ASSERT_EQUAL_HEX32(0x08074B50, le32(desc));
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, le32(desc + 4));
+    TEST_ASSERT_EQUAL_UINT32(9, le32(desc + 8));
+    TEST_ASSERT_EQUAL_UINT32(30 + 5 + 9 + 16 + 46 + 5 + 22, cap.bytes.size());
+}
+
+void test_rejects_bad_names_and_misuse(void) {
+    ZipStream zip;
+    Capture cap = {{}, SIZE_MAX};
+    TEST_ASSERT_FALSE(zip.beginEntry("early.txt", 0));   // Not begun
+    TEST_ASSERT_TRUE(zip.begin(captureSink, &cap, "/zip_cd.tmp"));
+    TEST_ASSERT_FALSE(zip.beginEntry("", 0));
+    std::string longName(ZipStream::kMaxNameBytes + 1, 'n');
+    TEST_ASSERT_FALSE(zip.beginEntry(longName.c_str(), 0));
+    TEST_ASSERT_FALSE(zip.write((const uint8_t*)"x", 1));  // No open entry
+    TEST_ASSERT_TRUE(zip.beginEntry("ok.txt", 0));
+    TEST_ASSERT_FALSE(zip.beginEntry("nested.txt", 0));
+    zip.abort();
+    TEST_ASSERT_FALSE(zip.isOpen());
+    TEST_ASSERT_FALSE(spillExists());
+}
+
+// ============================================================================
+// Round trips through unzip
+// ============================================================================
+
+void test_archive_passes_unzip_integrity_test(void) {
+    std::vector<uint8_t> big(150000);
+    uint32_t seed = 0x1234567;
+    for (auto& b : big) {
+        seed = seed * 1103515245u + 12345u;
+        b = (uint8_t)(seed >> 16);
+    }
+
+    ZipStream zip;
+    Capture cap = {{}, SIZE_MAX};
+    TEST_ASSERT_TRUE(zip.begin(captureSink, &cap, "/zip_cd.tmp"));
+    TEST_ASSERT_TRUE(zip.beginEntry("handshakes/HomeNet_AABBCCDDEEFF.pcap", 1700000000));
+    for (size_t off = 0; off < big.size(); off += 1024) {
+        size_t n = big.size() - off < 1024 ? big.size() - off : 1024;
+        TEST_ASSERT_TRUE(zip.write(big.data() + off, n));
+    }
+    TEST_ASSERT_TRUE(zip.endEntry());
+    TEST_ASSERT_TRUE(zip.beginEntry("handshakes/empty.txt", 1700000000));
+    TEST_ASSERT_TRUE(zip.endEntry());
+    TEST_ASSERT_TRUE(zip.beginEntry("handshakes/sub/Cafe_001122334455.22000", 1700000100));
+    TEST_ASSERT_TRUE(zip.write((const uint8_t*)"WPA*02*abc\n", 11));
+    // finish() closes the open entry
+    TEST_ASSERT_TRUE(zip.finish());
+    TEST_ASSERT_EQUAL_UINT16(3, zip.entries());
+    TEST_ASSERT_EQUAL_UINT32(cap.bytes.size(), zip.bytesOut());
+
+    std::string path = saveArchive(cap, "round.zip");
+    TEST_ASSERT_EQUAL_INT(0, run("unzip -t '" + path + "'"));
+
+    std::string got = unzipEntry(path, "handshakes/HomeNet_AABBCCDDEEFF.pcap");
+    TEST_ASSERT_EQUAL_UINT32(big.size(), got.size());
+    TEST_ASSERT_EQUAL_MEMORY(big.data(), got.data(), big.size());
+    TEST_ASSERT_EQUAL_STRING("WPA*02*abc\n",
+        unzipEntry(path, "handshakes/sub/Cafe_001122334455.22000").c_str());
+}
+
+void test_many_entries_spill_central_directory(void) {
+    ZipStream zip;
+    Capture cap = {{}, SIZE_MAX};
+    TEST_ASSERT_TRUE(zip.begin(captureSink, &cap, "/zip_cd.tmp"));
+    for (int i = 0; i < 400; i++) {
+        char name[48];
+        snprintf(name, sizeof(name), "captures/Net%03d_AABBCCDDEE%02X.22000", i, i & 0xFF);
+        TEST_ASSERT_TRUE(zip.beginEntry(name, 1700000000 + i));
+        TEST_ASSERT_TRUE(zip.write((const uint8_t*)name, strlen(name)));
+        TEST_ASSERT_TRUE(zip.endEntry());
+    }
+    TEST_ASSERT_TRUE(spillExists());
+    TEST_ASSERT_TRUE(zip.finish());
+    TEST_ASSERT_FALSE(spillExists());
+
+    std::string path = saveArchive(cap, "many.zip");
+    TEST_ASSERT_EQUAL_INT(0, run("unzip -t '" + path + "'"));
+    TEST_ASSERT_EQUAL_STRING("captures/Net399_AABBCCDDEE8F.22000",
+        unzipEntry(path, "captures/Net399_AABBCCDDEE8F.22000").c_str());
+}
+
+void test_sink_failure_aborts(void) {
+    ZipStream zip;
+    Capture cap = {{}, 120};
+    TEST_ASSERT_TRUE(zip.begin(captureSink, &cap, "/zip_cd.tmp"));
+    TEST_ASSERT_TRUE(zip.beginEntry("big.bin", 0));
+    uint8_t block[64] = {0};
+    TEST_ASSERT_TRUE(zip.write(block, sizeof(block)));
+    TEST_ASSERT_FALSE(zip.write(block, sizeof(block)));
+    TEST_ASSERT_FALSE(zip.finish());
+    TEST_ASSERT_FALSE(zip.isOpen());
+    TEST_ASSERT_FALSE(spillExists());
+}
+
+int main(void) {
+    strcpy(sdRoot, "/tmp/zip_sd_XXXXXX");
+    strcpy(flashRoot, "/tmp/zip_fs_XXXXXX");
+    strcpy(workDir, "/tmp/zip_out_XXXXXX");
+    if (!mkdtemp(sdRoot) || !mkdtemp(flashRoot) || !mkdtemp(workDir)) return 1;
+    HostHal::mountSD(sdRoot);
+    HostHal::mountSPIFFS(flashRoot);
+    Config::init();
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_crc32_known_vectors);
+    RUN_TEST(test_empty_archive_is_end_record_only);
+    RUN_TEST(test_entry_layout_uses_data_descriptor);
+    RUN_TEST(test_rejects_bad_names_and_misuse);
+
+    if (run("unzip -v") == 0) {
+        RUN_TEST(test_archive_passes_unzip_integrity_test);
+        RUN_TEST(test_many_entries_spill_central_directory);
+    } else {
+        printf("unzip not found: skipping round-trip tests\n");
+    }
+    RUN_TEST(test_sink_failure_aborts);
+
+    int rc = UNITY_END();
+    std::string cmd = std::string("rm -rf ") + sdRoot + " " + flashRoot + " " + workDir;
+    (void)system(cmd.c_str());
+    return rc;
+}
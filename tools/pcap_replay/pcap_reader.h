@@ -0,0 +1,308 @@
+// PcapReader - streaming pcap / pcapng reader for 802.11 captures
+// Handles classic pcap (either byte order, usec or nsec timestamps) and
+// pcapng (SHB/IDB/EPB/SPB, per-interface link type and tsresol).
+// Radiotap (127) frames are unwrapped to the 802.11 header with RSSI,
+// channel and FCS flag extracted; raw 802.11 (105) passes straight through.
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace Pcap {
+
+static constexpr uint32_t kLinkIeee80211 = 105;
+static constexpr uint32_t kLinkRadiotap = 127;
+
+static constexpr uint32_t kMaxFrame = 65535;
+
+// One decoded 802.11 frame. data points into the reader's buffer and stays
+// valid until the next next() call.
+struct Frame {
+    const uint8_t* data;
+    uint32_t len;          // 802.11 header + body, FCS stripped
+    uint64_t tsUs;         // Capture timestamp (microseconds since epoch)
+    int8_t rssi;           // dBm, valid if hasRssi
+    bool hasRssi;
+    uint8_t channel;       // 2.4/5GHz channel from radiotap, 0 if unknown
+};
+
+struct ReaderStats {
+    uint32_t records;      // Packet records seen
+    uint32_t frames;       // Frames returned by next()
+    uint32_t skippedLink;  // Unsupported link type
+    uint32_t malformed;    // Truncated radiotap / short frames
+};
+
+inline uint8_t freqToChannel(uint16_t mhz) {
+    if (mhz == 2484) return 14;
+    if (mhz >= 2412 && mhz <= 2472) return (uint8_t)((mhz - 2407) / 5);
+    if (mhz >= 5000 && mhz <= 5900) return (uint8_t)((mhz - 5000) / 5);
+    return 0;
+}
+
+/**
+ * @brief Strip a radiotap header
+ * Walks the present bitmap(s) far enough to read Flags (bit 1), Channel
+ * (bit 3) and dBm antenna signal (bit 5), honouring field alignment.
+ * @return false if the header is truncated or inconsistent
+ */
+inline bool parseRadiotap(const uint8_t* buf, uint32_t len, Frame& out) {
+    if (len < 8 || buf[0] != 0) return false;
+    uint16_t hdrLen = (uint16_t)(buf[2] | (buf[3] << 8));
+    if (hdrLen < 8 || hdrLen > len) return false;
+
+    // Skip extended present words (bit 31 chains another 32-bit bitmap)
+    uint32_t present = (uint32_t)buf[4] | ((uint32_t)buf[5] << 8) |
+                       ((uint32_t)buf[6] << 16) | ((uint32_t)buf[7] << 24);
+    uint32_t off = 8;
+    uint32_t word = present;
+    while (word & 0x80000000u) {
+        if (off + 4 > hdrLen) return false;
+        word = (uint32_t)buf[off] | ((uint32_t)buf[off + 1] << 8) |
+               ((uint32_t)buf[off + 2] << 16) | ((uint32_t)buf[off + 3] << 24);
+        off += 4;
+    }
+
+    // Field sizes/alignments for bits 0..5: TSFT, Flags, Rate, Channel, FHSS, dBm signal
+    static const uint8_t kSize[6] = {8, 1, 1, 4, 2, 1};
+    static const uint8_t kAlign[6] = {8, 1, 1, 2, 1, 1};
+    bool hasFcs = false;
+    for (uint8_t bit = 0; bit < 6; bit++) {
+        if (!(present & (1u << bit))) continue;
+        off = (off + kAlign[bit] - 1) & ~(uint32_t)(kAlign[bit] - 1);
+        if (off + kSize[bit] > hdrLen) return false;
+        const uint8_t* f = buf + off;
+        if (bit == 1) {
+            hasFcs = (f[0] & 0x10) != 0;
+        } else if (bit == 3) {
+            out.channel = freqToChannel((uint16_t)(f[0] | (f[1] << 8)));
+        } else if (bit == 5) {
+            out.rssi = (int8_t)f[0];
+            out.hasRssi = true;
+        }
+        off += kSize[bit];
+    }
+
+    out.data = buf + hdrLen;
+    out.len = len - hdrLen;
+    if (hasFcs) {
+        if (out.len < 4) return false;
+        out.len -= 4;
+    }
+    return true;
+}
+
+class Reader {
+public:
+    ~Reader() { close(); }
+
+    bool open(const char* path) {
+        close();
+        FILE* f = fopen(path, "rb");
+        if (!f) return false;
+        ownsFile_ = true;
+        return attach(f);
+    }
+
+    // Takes a FILE* positioned at the start of a capture (not closed unless opened here)
+    bool attach(FILE* f) {
+        file_ = f;
+        stats_ = {};
+        interfaces_.clear();
+        uint8_t magic[4];
+        if (fread(magic, 1, 4, file_) != 4) return false;
+        uint32_t le = rd32(magic, false);
+        if (le == 0x0A0D0D0A) {
+            ng_ = true;
+            return readSectionHeader();
+        }
+        ng_ = false;
+        if (le == 0xA1B2C3D4 || le == 0xA1B23C4D) {
+            swap_ = false;
+        } else if (rd32(magic, true) == 0xA1B2C3D4 || rd32(magic, true) == 0xA1B23C4D) {
+            swap_ = true;
+        } else {
+            return false;
+        }
+        nanos_ = rd32(magic, swap_) == 0xA1B23C4D;
+        uint8_t rest[20];
+        if (fread(rest, 1, 20, file_) != 20) return false;
+        Interface ifc;
+        ifc.linkType = rd32(rest + 16, swap_) & 0x0FFFFFFF;
+        ifc.unitsPerSec = nanos_ ? 1000000000ULL : 1000000ULL;
+        interfaces_.push_back(ifc);
+        return true;
+    }
+
+    void close() {
+        if (file_ && ownsFile_) fclose(file_);
+        file_ = nullptr;
+        ownsFile_ = false;
+    }
+
+    bool isPcapng() const { return ng_; }
+    uint32_t linkType(uint32_t iface = 0) const {
+        return iface < interfaces_.size() ? interfaces_[iface].linkType : 0;
+    }
+    const ReaderStats& stats() const { return stats_; }
+
+    /**
+     * @brief Read the next 802.11 frame, skipping unsupported records
+     * @return false at end of file or on a truncated record
+     */
+    bool next(Frame& out) {
+        while (file_) {
+            uint32_t iface = 0;
+            uint64_t ts = 0;
+            uint32_t capLen = 0;
+            if (!(ng_ ? nextNgPacket(iface, ts, capLen) : nextClassicPacket(ts, capLen))) return false;
+            stats_.records++;
+
+            const Interface& ifc = interfaces_[iface];
+            out = {};
+            if (ifc.unitsPerSec % 1000000ULL == 0) {
+                out.tsUs = ts / (ifc.unitsPerSec / 1000000ULL);  // Exact for usec/nsec
+            } else {
+                out.tsUs = (uint64_t)((double)ts * 1000000.0 / (double)ifc.unitsPerSec);
+            }
+            if (ifc.linkType == kLinkRadiotap) {
+                if (!parseRadiotap(buf_.data(), capLen, out)) {
+                    stats_.malformed++;
+                    continue;
+                }
+            } else if (ifc.linkType == kLinkIeee80211) {
+                out.data = buf_.data();
+                out.len = capLen;
+            } else {
+                stats_.skippedLink++;
+                continue;
+            }
+            if (out.len < 10) {  // Shorter than any 802.11 header (ACK/CTS)
+                stats_.malformed++;
+                continue;
+            }
+            stats_.frames++;
+            return true;
+        }
+        return false;
+    }
+
+private:
+    struct Interface {
+        uint32_t linkType;
+        uint64_t unitsPerSec;
+    };
+
+    static uint16_t rd16(const uint8_t* p, bool swap) {
+        return swap ? (uint16_t)((p[0] << 8) | p[1]) : (uint16_t)(p[0] | (p[1] << 8));
+    }
+    static uint32_t rd32(const uint8_t* p, bool swap) {
+        return swap ? ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3]
+                    : (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    bool readInto(uint32_t len) {
+        if (len > kMaxFrame + 4096) return false;
+        if (buf_.size() < len) buf_.resize(len);
+        return len == 0 || fread(buf_.data(), 1, len, file_) == len;
+    }
+
+    bool nextClassicPacket(uint64_t& ts, uint32_t& capLen) {
+        uint8_t hdr[16];
+        if (fread(hdr, 1, 16, file_) != 16) return false;
+        uint32_t sec = rd32(hdr, swap_);
+        uint32_t frac = rd32(hdr + 4, swap_);
+        capLen = rd32(hdr + 8, swap_);
+        ts = (uint64_t)sec * (nanos_ ? 1000000000ULL : 1000000ULL) + frac;
+        return readInto(capLen);
+    }
+
+    // Called with the SHB block type already consumed
+    bool readSectionHeader() {
+        uint8_t hdr[8];  // block length + byte-order magic
+        if (fread(hdr, 1, 8, file_) != 8) return false;
+        uint32_t bom = rd32(hdr + 4, false);
+        if (bom == 0x1A2B3C4D) swap_ = false;
+        else if (bom == 0x4D3C2B1A) swap_ = true;
+        else return false;
+        uint32_t blockLen = rd32(hdr, swap_);
+        if (blockLen < 28 || (blockLen & 3)) return false;
+        interfaces_.clear();
+        return readInto(blockLen - 12);  // Version, section length, options, trailing length
+    }
+
+    bool nextNgPacket(uint32_t& iface, uint64_t& ts, uint32_t& capLen) {
+        while (true) {
+            uint8_t hdr[8];
+            if (fread(hdr, 1, 8, file_) != 8) return false;
+            uint32_t type = rd32(hdr, swap_);
+            if (type == 0x0A0D0D0A) {
+                if (fseek(file_, -4, SEEK_CUR) != 0) return false;
+                if (!readSectionHeader()) return false;
+                continue;
+            }
+            uint32_t blockLen = rd32(hdr + 4, swap_);
+            if (blockLen < 12 || (blockLen & 3)) return false;
+            uint32_t bodyLen = blockLen - 12;
+            if (!readInto(bodyLen + 4)) return false;  // Body + trailing length
+            const uint8_t* b = buf_.data();
+
+            if (type == 0x00000001) {  // Interface Description
+                if (bodyLen < 8) return false;
+                Interface ifc;
+                ifc.linkType = rd16(b, swap_);
+                ifc.unitsPerSec = 1000000ULL;
+                parseIdbOptions(b + 8, bodyLen - 8, ifc);
+                interfaces_.push_back(ifc);
+            } else if (type == 0x00000006) {  // Enhanced Packet
+                if (bodyLen < 20) return false;
+                iface = rd32(b, swap_);
+                ts = ((uint64_t)rd32(b + 4, swap_) << 32) | rd32(b + 8, swap_);
+                capLen = rd32(b + 12, swap_);
+                if (iface >= interfaces_.size() || capLen > bodyLen - 20) return false;
+                memmove(buf_.data(), b + 20, capLen);
+                return true;
+            } else if (type == 0x00000003) {  // Simple Packet (no timestamp)
+                if (bodyLen < 4 || interfaces_.empty()) return false;
+                iface = 0;
+                ts = 0;
+                capLen = rd32(b, swap_);
+                if (capLen > bodyLen - 4) capLen = bodyLen - 4;
+                memmove(buf_.data(), b + 4, capLen);
+                return true;
+            }
+            // Other blocks (name resolution, statistics, custom) are skipped
+        }
+    }
+
+    void parseIdbOptions(const uint8_t* p, uint32_t len, Interface& ifc) {
+        uint32_t off = 0;
+        while (off + 4 <= len) {
+            uint16_t code = rd16(p + off, swap_);
+            uint16_t olen = rd16(p + off + 2, swap_);
+            off += 4;
+            if (code == 0 || off + olen > len) break;
+            if (code == 9 && olen >= 1) {  // if_tsresol
+                uint8_t r = p[off];
+                uint64_t units = 1;
+                uint8_t exp = r & 0x7F;
+                for (uint8_t i = 0; i < exp && units < (1ULL << 62); i++) units *= (r & 0x80) ? 2 : 10;
+                ifc.unitsPerSec = units;
+            }
+            off += (olen + 3u) & ~3u;
+        }
+    }
+
+    FILE* file_ = nullptr;
+    bool ownsFile_ = false;
+    bool ng_ = false;
+    bool swap_ = false;
+    bool nanos_ = false;
+    std::vector<Interface> interfaces_;
+    std::vector<uint8_t> buf_;
+    ReaderStats stats_ = {};
+};
+
+}  // namespace Pcap
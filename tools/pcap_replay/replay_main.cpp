@@ -0,0 +1,397 @@
+// PCAP replay - feed a recorded capture through the real promiscuous path
+//
+//   pcap_replay <capture.pcap|pcapng> [options]
+//     --mode recon|oink|dnh|spectrum  Mode callback to register (default oink)
+//     --loop-ms N       Main loop period in virtual ms (default 10)
+//     --tuned           Only deliver frames on the channel recon is tuned to
+//     --repeat N        Replay the capture N times (timestamps keep advancing)
+//     --rows N          Max rows per table (default 40)
+//     --verbose         Echo firmware Serial output to stderr
+//
+// Frames are wrapped in a wifi_promiscuous_pkt_t exactly like the ESP32 driver
+// delivers them (sig_len includes the FCS) and handed to the callback recon
+// registered via esp_wifi_set_promiscuous_rx_cb(). millis() follows capture
+// timestamps; NetworkRecon::update() and the mode update() run every loop tick.
+
+#include <Arduino.h>
+#include <host_hal.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "pcap_reader.h"
+#include "../../src/core/network_recon.h"
+#include "../../src/core/path_timing.h"
+#include "../../src/modes/oink.h"
+#include "../../src/modes/donoham.h"
+#include "../../src/modes/spectrum.h"
+
+namespace {
+
+enum class ReplayMode { Recon, Oink, DoNoHam, Spectrum };
+
+struct Options {
+    const char* path = nullptr;
+    ReplayMode mode = ReplayMode::Oink;
+    uint32_t loopMs = 10;
+    bool tuned = false;
+    uint32_t repeat = 1;
+    uint32_t rows = 40;
+    bool verbose = false;
+};
+
+// Virtual clock starts past zero: firmware treats 0 timestamps as "never"
+const uint32_t kBootMs = 5000;
+// Gaps longer than this are skipped in one step instead of ticking through
+const uint32_t kMaxIdleTicksMs = 2000;
+// ESP32 promiscuous buffers top out well below the 12-bit sig_len limit
+const uint32_t kMaxPayload = 2500;
+
+using Clock = std::chrono::steady_clock;
+
+struct Latency {
+    std::vector<uint32_t> ns;
+    uint64_t totalNs = 0;
+
+    void add(uint64_t v) {
+        ns.push_back(v > UINT32_MAX ? UINT32_MAX : (uint32_t)v);
+        totalNs += v;
+    }
+
+    uint32_t pct(double p) {
+        if (ns.empty()) return 0;
+        size_t idx = (size_t)(p / 100.0 * (double)(ns.size() - 1) + 0.5);
+        std::nth_element(ns.begin(), ns.begin() + idx, ns.end());
+        return ns[idx];
+    }
+
+    void print(const char* label) {
+        if (ns.empty()) {
+            printf("  %-10s (none)\n", label);
+            return;
+        }
+        uint32_t p50 = pct(50), p90 = pct(90), p99 = pct(99), p999 = pct(99.9);
+        uint32_t worst = *std::max_element(ns.begin(), ns.end());
+        printf("  %-10s n=%-8zu mean=%6.0f p50=%6u p90=%6u p99=%6u p99.9=%6u max=%7u ns\n",
+               label, ns.size(), (double)totalNs / ns.size(), p50, p90, p99, p999, worst);
+    }
+};
+
+const char* modeName(ReplayMode m) {
+    switch (m) {
+        case ReplayMode::Recon: return "recon";
+        case ReplayMode::Oink: return "oink";
+        case ReplayMode::DoNoHam: return "dnh";
+        case ReplayMode::Spectrum: return "spectrum";
+    }
+    return "?";
+}
+
+const char* authName(wifi_auth_mode_t a) {
+    switch (a) {
+        case WIFI_AUTH_OPEN: return "OPEN";
+        case WIFI_AUTH_WEP: return "WEP";
+        case WIFI_AUTH_WPA_PSK: return "WPA";
+        case WIFI_AUTH_WPA2_PSK: return "WPA2";
+        case WIFI_AUTH_WPA_WPA2_PSK: return "WPA/2";
+        case WIFI_AUTH_WPA2_ENTERPRISE: return "WPA2-E";
+        case WIFI_AUTH_WPA3_PSK: return "WPA3";
+        case WIFI_AUTH_WPA2_WPA3_PSK: return "WPA2/3";
+        default: return "?";
+    }
+}
+
+void printMac(const uint8_t* m) {
+    printf("%02X:%02X:%02X:%02X:%02X:%02X", m[0], m[1], m[2], m[3], m[4], m[5]);
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        auto value = [&](const char* name) -> const char* {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s needs a value\n", name);
+                return nullptr;
+            }
+            return argv[++i];
+        };
+        if (a == "--mode") {
+            const char* v = value("--mode");
+            if (!v) return false;
+            std::string m = v;
+            if (m == "recon") opt.mode = ReplayMode::Recon;
+            else if (m == "oink") opt.mode = ReplayMode::Oink;
+            else if (m == "dnh" || m == "donoham") opt.mode = ReplayMode::DoNoHam;
+            else if (m == "spectrum") opt.mode = ReplayMode::Spectrum;
+            else {
+                fprintf(stderr, "unknown mode: %s\n", v);
+                return false;
+            }
+        } else if (a == "--loop-ms") {
+            const char* v = value("--loop-ms");
+            if (!v) return false;
+            opt.loopMs = std::max(1, atoi(v));
+        } else if (a == "--repeat") {
+            const char* v = value("--repeat");
+            if (!v) return false;
+            opt.repeat = std::max(1, atoi(v));
+        } else if (a == "--rows") {
+            const char* v = value("--rows");
+            if (!v) return false;
+            opt.rows = (uint32_t)std::max(0, atoi(v));
+        } else if (a == "--tuned") {
+            opt.tuned = true;
+        } else if (a == "--verbose") {
+            opt.verbose = true;
+        } else if (!a.empty() && a[0] == '-') {
+            fprintf(stderr, "unknown option: %s\n", a.c_str());
+            return false;
+        } else {
+            opt.path = argv[i];
+        }
+    }
+    return opt.path != nullptr;
+}
+
+void startMode(ReplayMode mode) {
+    NetworkRecon::init();
+    NetworkRecon::start();
+    switch (mode) {
+        case ReplayMode::Recon: break;
+        case ReplayMode::Oink: OinkMode::init(); OinkMode::start(); break;
+        case ReplayMode::DoNoHam: DoNoHamMode::init(); DoNoHamMode::start(); break;
+        case ReplayMode::Spectrum: SpectrumMode::init(); SpectrumMode::start(); break;
+    }
+}
+
+void updateMode(ReplayMode mode) {
+    NetworkRecon::update();
+    switch (mode) {
+        case ReplayMode::Recon: break;
+        case ReplayMode::Oink: OinkMode::update(); break;
+        case ReplayMode::DoNoHam: DoNoHamMode::update(); break;
+        case ReplayMode::Spectrum: SpectrumMode::update(); break;
+    }
+}
+
+void printNetworks(uint32_t maxRows) {
+    std::vector<DetectedNetwork> nets;
+    nets.reserve(MAX_RECON_NETWORKS);
+    NetworkRecon::copySnapshot(nets);
+    std::sort(nets.begin(), nets.end(),
+              [](const DetectedNetwork& a, const DetectedNetwork& b) { return a.rssiAvg > b.rssiAvg; });
+
+    printf("\nNETWORKS (%zu)\n", nets.size());
+    printf("  %-17s  CH  RSSI  AUTH    FLAGS  BEACONS  CLI  Q   SSID\n", "BSSID");
+    uint32_t shown = 0;
+    for (const auto& n : nets) {
+        if (shown++ >= maxRows) {
+            printf("  ... %zu more\n", nets.size() - maxRows);
+            break;
+        }
+        char flags[5] = {
+            n.isHidden ? 'H' : '-',
+            n.hasPMF ? 'P' : '-',
+            n.isTarget ? 'T' : '-',
+            n.hasHandshake ? 'K' : '-',
+            0
+        };
+        printf("  ");
+        printMac(n.bssid);
+        printf("  %2u  %4d  %-6s  %s  %7u  %3u  %3u %s\n",
+               n.channel, n.rssiAvg, authName(n.authmode), flags, n.beaconCount,
+               NetworkRecon::estimateClientCount(n), NetworkRecon::getQualityScore(n),
+               n.ssid[0] ? n.ssid : "<hidden>");
+    }
+}
+
+void printPmkids(const std::vector<CapturedPMKID>& pmkids, uint32_t maxRows) {
+    printf("\nPMKIDS (%zu)\n", pmkids.size());
+    uint32_t shown = 0;
+    for (const auto& p : pmkids) {
+        if (shown++ >= maxRows) break;
+        printf("  ");
+        printMac(p.bssid);
+        printf(" <- ");
+        printMac(p.station);
+        printf("  ");
+        for (int i = 0; i < 16; i++) printf("%02x", p.pmkid[i]);
+        printf("  %s\n", p.ssid[0] ? p.ssid : "<unknown>");
+    }
+}
+
+void printHandshakes(const std::vector<CapturedHandshake>& hs, uint32_t maxRows) {
+    printf("\nHANDSHAKES (%zu)\n", hs.size());
+    uint32_t shown = 0;
+    for (const auto& h : hs) {
+        if (shown++ >= maxRows) break;
+        printf("  ");
+        printMac(h.bssid);
+        printf(" <- ");
+        printMac(h.station);
+        printf("  M%c%c%c%c  %-8s %s  %s\n",
+               h.hasM1() ? '1' : '-', h.hasM2() ? '2' : '-', h.hasM3() ? '3' : '-', h.hasM4() ? '4' : '-',
+               h.isComplete() ? "complete" : "partial", h.hasBeacon() ? "beacon" : "      ",
+               h.ssid[0] ? h.ssid : "<unknown>");
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        fprintf(stderr, "usage: %s <capture.pcap|pcapng> [--mode recon|oink|dnh|spectrum]"
+                        " [--loop-ms N] [--tuned] [--repeat N] [--rows N] [--verbose]\n", argv[0]);
+        return 2;
+    }
+
+    HostHal::setSerialEcho(opt.verbose);
+    HostHal::setMillis(kBootMs);
+    startMode(opt.mode);
+
+    // One reusable packet buffer, laid out like the driver's RX buffer
+    std::vector<uint8_t> pktBuf(sizeof(wifi_promiscuous_pkt_t) + kMaxPayload + 4);
+    wifi_promiscuous_pkt_t* pkt = (wifi_promiscuous_pkt_t*)pktBuf.data();
+
+    Latency cbLatency;
+    Latency loopLatency;
+    uint32_t delivered = 0, offChannel = 0, oversize = 0, dropped = 0;
+    uint32_t typeCount[4] = {0, 0, 0, 0};
+    uint32_t nextLoopMs = kBootMs;
+    uint32_t virtualStart = millis();
+    Pcap::ReaderStats readerTotals = {};
+
+    auto runLoopUntil = [&](uint32_t targetMs) {
+        if ((int32_t)(targetMs - nextLoopMs) > (int32_t)kMaxIdleTicksMs) {
+            nextLoopMs = targetMs - kMaxIdleTicksMs;
+        }
+        while ((int32_t)(targetMs - nextLoopMs) >= 0) {
+            if ((int32_t)(nextLoopMs - millis()) > 0) HostHal::setMillis(nextLoopMs);
+            auto t0 = Clock::now();
+            updateMode(opt.mode);
+            loopLatency.add((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count());
+            nextLoopMs += opt.loopMs;
+        }
+    };
+
+    auto wallStart = Clock::now();
+    uint32_t passOffsetMs = 0;
+    for (uint32_t pass = 0; pass < opt.repeat; pass++) {
+        Pcap::Reader reader;
+        if (!reader.open(opt.path)) {
+            fprintf(stderr, "cannot read capture: %s\n", opt.path);
+            return 1;
+        }
+        Pcap::Frame frame;
+        uint64_t firstTs = 0;
+        bool haveFirst = false;
+        uint32_t lastFrameMs = millis();
+        while (reader.next(frame)) {
+            if (!haveFirst) {
+                firstTs = frame.tsUs;
+                haveFirst = true;
+            }
+            uint64_t relMs = frame.tsUs >= firstTs ? (frame.tsUs - firstTs) / 1000ULL : 0;
+            uint32_t frameMs = virtualStart + passOffsetMs + (uint32_t)relMs;
+            lastFrameMs = frameMs;
+            runLoopUntil(frameMs);
+            if ((int32_t)(frameMs - millis()) > 0) HostHal::setMillis(frameMs);
+
+            if (frame.len > kMaxPayload) {
+                oversize++;
+                continue;
+            }
+            uint8_t channel = frame.channel ? frame.channel : HostHal::getChannel();
+            if (opt.tuned && channel != HostHal::getChannel()) {
+                offChannel++;
+                continue;
+            }
+
+            memset(&pkt->rx_ctrl, 0, sizeof(pkt->rx_ctrl));
+            pkt->rx_ctrl.rssi = frame.hasRssi ? frame.rssi : -60;
+            pkt->rx_ctrl.channel = channel & 0x0F;
+            pkt->rx_ctrl.sig_len = (frame.len + 4) & 0x0FFF;  // Driver counts the FCS
+            pkt->rx_ctrl.timestamp = (uint32_t)HostHal::getMicros();
+            memcpy(pkt->payload, frame.data, frame.len);
+            memset(pkt->payload + frame.len, 0, 4);
+
+            uint8_t ftype = (frame.data[0] >> 2) & 0x03;
+            wifi_promiscuous_pkt_type_t type = (wifi_promiscuous_pkt_type_t)ftype;
+            typeCount[ftype]++;
+
+            auto t0 = Clock::now();
+            bool ok = HostHal::deliverFrame(pkt, type);
+            uint64_t ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count();
+            if (ok) {
+                cbLatency.add(ns);
+                delivered++;
+            } else {
+                dropped++;
+            }
+        }
+        // Let the loop drain whatever the last frames queued
+        runLoopUntil(lastFrameMs + 4 * opt.loopMs);
+        passOffsetMs = lastFrameMs - virtualStart + opt.loopMs;
+
+        if (pass == 0) {
+            // pcapng link type is only known once the first IDB has been read
+            printf("capture: %s (%s, linktype %u)  mode: %s  loop: %ums%s\n",
+                   opt.path, reader.isPcapng() ? "pcapng" : "pcap", reader.linkType(),
+                   modeName(opt.mode), opt.loopMs, opt.tuned ? "  tuned" : "");
+        }
+        const Pcap::ReaderStats& rs = reader.stats();
+        readerTotals.records += rs.records;
+        readerTotals.frames += rs.frames;
+        readerTotals.skippedLink += rs.skippedLink;
+        readerTotals.malformed += rs.malformed;
+    }
+    double wallSec = std::chrono::duration<double>(Clock::now() - wallStart).count();
+    double cbSec = (double)cbLatency.totalNs / 1e9;
+    uint32_t virtualMs = millis() - virtualStart;
+
+    printf("\nTHROUGHPUT\n");
+    printf("  records=%u frames=%u delivered=%u (mgmt=%u ctrl=%u data=%u misc=%u)\n",
+           readerTotals.records, readerTotals.frames, delivered,
+           typeCount[0], typeCount[1], typeCount[2], typeCount[3]);
+    printf("  skipped: linktype=%u malformed=%u oversize=%u off-channel=%u no-callback=%u\n",
+           readerTotals.skippedLink, readerTotals.malformed, oversize, offChannel, dropped);
+    printf("  callback: %.0f frames/s   end-to-end: %.0f frames/s   virtual %.1fs in %.3fs wall\n",
+           cbSec > 0 ? delivered / cbSec : 0.0, wallSec > 0 ? delivered / wallSec : 0.0,
+           virtualMs / 1000.0, wallSec);
+
+    printf("\nLATENCY\n");
+    cbLatency.print("callback");
+    loopLatency.print("loop");
+    for (uint8_t i = 0; i < (uint8_t)PathTiming::Path::Count; i++) {
+        PathTiming::Summary s = PathTiming::summarize((PathTiming::Path)i);
+        if (s.count == 0) continue;
+        printf("  %-10s n=%-8u mean=%6u p99<=%6u min=%6u max=%7u ns\n",
+               PathTiming::pathName((PathTiming::Path)i), s.count, s.avgNs, s.p99Ns, s.minNs, s.maxNs);
+    }
+
+    NetworkRecon::FrameRingStats ring = NetworkRecon::getFrameRingStats();
+    HostHal::TxStats tx = HostHal::getTxStats();
+    printf("\nRECON\n");
+    printf("  packets=%u ring: queued=%u dropped=%u drained=%u highWater=%u/%u pendingAddDrops=%u\n",
+           NetworkRecon::getPacketCount(), ring.queued, ring.dropped, ring.drained,
+           ring.highWater, ring.capacity, ring.pendingAddDrops);
+    printf("  tx: frames=%u deauth=%u disassoc=%u probe=%u assoc=%u\n",
+           tx.frames, tx.deauths, tx.disassocs, tx.probeReqs, tx.assocReqs);
+    printf("  queue drops:");
+    for (uint8_t i = 0; i < (uint8_t)PathTiming::Drop::Count; i++) {
+        printf(" %s=%u", PathTiming::dropName((PathTiming::Drop)i), PathTiming::getDrops((PathTiming::Drop)i));
+    }
+    printf("\n");
+
+    printNetworks(opt.rows);
+    if (opt.mode == ReplayMode::Oink) {
+        printPmkids(OinkMode::getPMKIDs(), opt.rows);
+        printHandshakes(OinkMode::getHandshakes(), opt.rows);
+    } else if (opt.mode == ReplayMode::DoNoHam) {
+        printPmkids(DoNoHamMode::getPMKIDs(), opt.rows);
+        printHandshakes(DoNoHamMode::getHandshakes(), opt.rows);
+    }
+    return 0;
+}
@@ -0,0 +1,67 @@
+// PCAP replay - no-op stand-ins for UI / persistence collaborators
+// Recon and the mode callbacks run for real; everything they notify
+// (mood, avatar, display, XP, sound) is swallowed here. SwineStats returns
+// the un-buffed baseline so timing matches a fresh level-1 pig.
+
+#include "../../src/core/config.h"
+#include "../../src/core/xp.h"
+#include "../../src/ui/display.h"
+#include "../../src/ui/swine_stats.h"
+#include "../../src/piglet/mood.h"
+#include "../../src/piglet/avatar.h"
+#include "../../src/audio/sfx.h"
+#include "../../src/modes/warhog.h"
+#include "../../src/gps/gps.h"
+
+// Config - defaults from WiFiConfig, no SD card
+WiFiConfig Config::wifiConfig;
+bool Config::isSDAvailable() { return false; }
+
+// SwineStats - baseline values (no class buffs or mood debuffs)
+uint8_t SwineStats::getDeauthBurstCount() { return 5; }
+uint8_t SwineStats::getDeauthJitterMax() { return 5; }
+uint16_t SwineStats::getChannelHopInterval() { return Config::wifi().channelHopInterval; }
+uint32_t SwineStats::getLockTime() { return Config::wifi().lockTime; }
+
+// XP
+static SessionStats replaySession;
+void XP::addXP(XPEvent) {}
+const SessionStats& XP::getSession() { return replaySession; }
+void XP::processPendingSave() {}
+void XP::unlockAchievement(PorkAchievement) {}
+bool XP::hasAchievement(PorkAchievement) { return false; }
+
+// Display
+uint16_t getColorFG() { return 0xFFFF; }
+uint16_t getColorBG() { return 0x0000; }
+void Display::notify(NoticeKind, const String&, uint32_t, NoticeChannel) {}
+void Display::setWiFiStatus(bool) {}
+void Display::showLoot(const String&) {}
+void Display::showToast(const char*, uint32_t) {}
+
+// Mood
+void Mood::onBored(uint16_t) {}
+void Mood::onDeauthSuccess(const uint8_t*) {}
+void Mood::onDeauthing(const char*, uint32_t) {}
+void Mood::onHandshakeCaptured(const char*) {}
+void Mood::onNewNetwork(const char*, int8_t, uint8_t) {}
+void Mood::onPMKIDCaptured(const char*) {}
+void Mood::onPassiveRecon(uint16_t, uint8_t) {}
+void Mood::onSniffing(uint16_t, uint8_t) {}
+void Mood::setDialogueLock(bool) {}
+void Mood::setStatusMessage(const char*) {}
+
+// Avatar
+void Avatar::setGrassMoving(bool, bool) {}
+void Avatar::setGrassSpeed(uint16_t) {}
+void Avatar::setState(AvatarState) {}
+void Avatar::sniff() {}
+
+// Sound
+void SFX::play(SFX::Event) {}
+
+// WARHOG bounty bookkeeping
+void WarhogMode::markCaptured(const uint8_t*) {}
+
+// GPS - no fix
+GPSData GPS::getData() { return GPSData{}; }
@@ -0,0 +1,255 @@
+// SDLogDecode - Parse binary SD logs (porkchop.blg) back into text
+// Header-only so the decoder tool and the native tests share it.
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../../src/core/sdlog_codec.h"
+#include "../../src/core/sdlog_messages.h"
+
+namespace SDLogDecode {
+
+struct Arg {
+    SDLogCodec::ArgType type;
+    int64_t i;
+    uint64_t u;
+    double d;
+    std::string s;
+};
+
+struct Record {
+    uint32_t ms;            // Absolute millis() at capture
+    uint16_t id;
+    std::vector<Arg> args;
+};
+
+struct Stats {
+    uint32_t records;
+    uint32_t malformed;     // Records skipped (bad framing or args)
+    uint32_t unknownIds;    // IDs past the end of this build's table
+};
+
+class Reader {
+public:
+    bool openBuffer(const uint8_t* data, size_t len) {
+        data_.assign(data, data + len);
+        return parseHeader();
+    }
+
+    bool open(const char* path) {
+        FILE* f = fopen(path, "rb");
+        if (!f) return false;
+        data_.clear();
+        uint8_t tmp[4096];
+        size_t n;
+        while ((n = fread(tmp, 1, sizeof(tmp), f)) > 0) data_.insert(data_.end(), tmp, tmp + n);
+        fclose(f);
+        return parseHeader();
+    }
+
+    uint8_t version() const { return version_; }
+    uint32_t tableHash() const { return tableHash_; }
+    bool tableMatches() const { return tableHash_ == SDLogMsg::kTableHash; }
+    const Stats& stats() const { return stats_; }
+
+    // False at end of file or on a truncated tail
+    bool next(Record& rec) {
+        while (pos_ < data_.size()) {
+            uint64_t len = 0;
+            size_t n = SDLogCodec::getVarint(&data_[pos_], data_.size() - pos_, len);
+            if (n == 0 || len > data_.size() - pos_ - n) {
+                // Torn final write (power cut mid-batch)
+                stats_.malformed++;
+                pos_ = data_.size();
+                return false;
+            }
+            const uint8_t* body = &data_[pos_ + n];
+            pos_ += n + (size_t)len;
+            if (parseRecord(body, (size_t)len, rec)) {
+                stats_.records++;
+                if (rec.id >= SDLogMsg::Count) stats_.unknownIds++;
+                return true;
+            }
+            stats_.malformed++;
+        }
+        return false;
+    }
+
+private:
+    bool parseHeader() {
+        pos_ = 0;
+        stats_ = {};
+        if (data_.size() < SDLogCodec::kFileHeaderBytes) return false;
+        if (memcmp(data_.data(), SDLogCodec::kMagic, 4) != 0) return false;
+        version_ = data_[4];
+        if (version_ != SDLogCodec::kVersion) return false;
+        tableHash_ = 0;
+        for (int i = 0; i < 4; i++) tableHash_ |= (uint32_t)data_[5 + i] << (8 * i);
+        lastMs_ = 0;
+        pos_ = SDLogCodec::kFileHeaderBytes;
+        return true;
+    }
+
+    bool parseRecord(const uint8_t* p, size_t len, Record& rec) {
+        size_t o = 0;
+        uint64_t v;
+        size_t n = SDLogCodec::getVarint(p, len, v);
+        if (!n) return false;
+        o += n;
+        lastMs_ = (uint32_t)(lastMs_ + (int32_t)SDLogCodec::unzigzag(v));
+        rec.ms = lastMs_;
+
+        n = SDLogCodec::getVarint(p + o, len - o, v);
+        if (!n || v > 0xFFFF) return false;
+        o += n;
+        rec.id = (uint16_t)v;
+
+        rec.args.clear();
+        if (o >= len) return false;
+        uint8_t count = p[o++];
+        if (count > SDLogCodec::kMaxArgs) return false;
+        size_t maskBytes = (count + 3) / 4;
+        if (o + maskBytes > len) return false;
+        const uint8_t* masks = p + o;
+        o += maskBytes;
+
+        for (uint8_t i = 0; i < count; i++) {
+            Arg a = {};
+            a.type = (SDLogCodec::ArgType)((masks[i / 4] >> ((i % 4) * 2)) & 3);
+            switch (a.type) {
+                case SDLogCodec::ARG_SIGNED:
+                case SDLogCodec::ARG_UNSIGNED:
+                    n = SDLogCodec::getVarint(p + o, len - o, v);
+                    if (!n) return false;
+                    o += n;
+                    a.u = v;
+                    a.i = a.type == SDLogCodec::ARG_SIGNED ? SDLogCodec::unzigzag(v) : (int64_t)v;
+                    if (a.type == SDLogCodec::ARG_SIGNED) a.u = (uint64_t)a.i;
+                    break;
+                case SDLogCodec::ARG_DOUBLE:
+                    if (o + 8 > len) return false;
+                    memcpy(&a.d, p + o, 8);
+                    o += 8;
+                    break;
+                case SDLogCodec::ARG_STRING:
+                    n = SDLogCodec::getVarint(p + o, len - o, v);
+                    if (!n || v > len - o - n) return false;
+                    o += n;
+                    a.s.assign((const char*)p + o, (size_t)v);
+                    o += (size_t)v;
+                    break;
+            }
+            rec.args.push_back(a);
+        }
+        return o == len;
+    }
+
+    std::vector<uint8_t> data_;
+    size_t pos_ = 0;
+    uint8_t version_ = 0;
+    uint32_t tableHash_ = 0;
+    uint32_t lastMs_ = 0;
+    Stats stats_ = {};
+};
+
+// printf the table format with decoded args. Each conversion takes the next
+// argument and is re-issued with a 64-bit length modifier, so an int logged
+// for %lu still prints right. Missing args render as "?".
+inline std::string formatMessage(const char* fmt, const std::vector<Arg>& args, size_t firstArg = 0) {
+    std::string out;
+    size_t ai = firstArg;
+    char buf[256];
+    for (const char* p = fmt; *p; p++) {
+        if (*p != '%') {
+            out += *p;
+            continue;
+        }
+        if (p[1] == '%') {
+            out += '%';
+            p++;
+            continue;
+        }
+        // %[flags][width][.precision][length]conv
+        std::string spec = "%";
+        const char* q = p + 1;
+        while (*q && strchr("-+ #0", *q)) spec += *q++;
+        while (*q >= '0' && *q <= '9') spec += *q++;
+        if (*q == '.') {
+            spec += *q++;
+            while (*q >= '0' && *q <= '9') spec += *q++;
+        }
+        while (*q && strchr("hlLqjzt", *q)) q++;
+        char conv = *q;
+        if (!conv) break;
+        p = q;
+
+        if (ai >= args.size()) {
+            out += '?';
+            continue;
+        }
+        const Arg& a = args[ai++];
+        switch (conv) {
+            case 'd': case 'i': case 'c':
+                if (conv == 'c') {
+                    snprintf(buf, sizeof(buf), (spec + "c").c_str(), (int)a.i);
+                } else if (a.type == SDLogCodec::ARG_DOUBLE) {
+                    snprintf(buf, sizeof(buf), (spec + "lld").c_str(), (long long)a.d);
+                } else if (a.type == SDLogCodec::ARG_STRING) {
+                    snprintf(buf, sizeof(buf), "%s", a.s.c_str());
+                } else {
+                    snprintf(buf, sizeof(buf), (spec + "lld").c_str(), (long long)a.i);
+                }
+                break;
+            case 'u': case 'x': case 'X': case 'o':
+                if (a.type == SDLogCodec::ARG_STRING) {
+                    snprintf(buf, sizeof(buf), "%s", a.s.c_str());
+                } else {
+                    snprintf(buf, sizeof(buf), (spec + "ll" + conv).c_str(), (unsigned long long)a.u);
+                }
+                break;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G':
+                snprintf(buf, sizeof(buf), (spec + conv).c_str(),
+                         a.type == SDLogCodec::ARG_DOUBLE ? a.d : (double)a.i);
+                break;
+            case 's':
+                if (a.type == SDLogCodec::ARG_STRING) {
+                    snprintf(buf, sizeof(buf), (spec + "s").c_str(), a.s.c_str());
+                } else {
+                    snprintf(buf, sizeof(buf), "%lld", (long long)a.i);
+                }
+                break;
+            default:
+                snprintf(buf, sizeof(buf), "%%%c", conv);
+                break;
+        }
+        out += buf;
+    }
+    return out;
+}
+
+// One log line, matching the text log: "[ms][TAG] message"
+inline std::string render(const Record& rec) {
+    char head[48];
+    if (rec.id == SDLogMsg::TEXT) {
+        // args: tag, message; an empty tag is a logRaw() line
+        std::string tag = rec.args.size() > 0 ? rec.args[0].s : "";
+        std::string msg = rec.args.size() > 1 ? rec.args[1].s : "";
+        if (tag.empty()) return msg;
+        snprintf(head, sizeof(head), "[%lu][", (unsigned long)rec.ms);
+        return head + tag + "] " + msg;
+    }
+    const char* fmt = SDLogMsg::format(rec.id);
+    snprintf(head, sizeof(head), "[%lu][%s] ", (unsigned long)rec.ms, SDLogMsg::tag(rec.id));
+    if (!fmt) {
+        char id[24];
+        snprintf(id, sizeof(id), "<unknown id %u>", rec.id);
+        return std::string(head) + id;
+    }
+    return head + formatMessage(fmt, rec.args);
+}
+
+}  // namespace SDLogDecode